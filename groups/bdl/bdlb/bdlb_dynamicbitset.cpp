@@ -0,0 +1,302 @@
+// bdlb_dynamicbitset.cpp                                             -*-C++-*-
+#include <bdlb_dynamicbitset.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlb_dynamicbitset_cpp,"$Id$ $CSID$")
+
+#include <bslim_printer.h>
+
+#include <bsls_performancehint.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_ostream.h>
+
+namespace BloombergLP {
+namespace bdlb {
+
+namespace {
+
+typedef BitUtil::uint64_t Word;
+
+bsl::size_t countBits(const Word *begin, const Word *end)
+    // Return the number of set bits in the words in the specified range
+    // '[begin, end)'.
+{
+    // Four independent sums let successive population counts of a long range
+    // execute in parallel rather than serialize on a single accumulator.
+
+    bsl::size_t sum0 = 0;
+    bsl::size_t sum1 = 0;
+    bsl::size_t sum2 = 0;
+    bsl::size_t sum3 = 0;
+
+    for (; end - begin >= 4; begin += 4) {
+        sum0 += BitUtil::numBitsSet(begin[0]);
+        sum1 += BitUtil::numBitsSet(begin[1]);
+        sum2 += BitUtil::numBitsSet(begin[2]);
+        sum3 += BitUtil::numBitsSet(begin[3]);
+    }
+    for (; begin != end; ++begin) {
+        sum0 += BitUtil::numBitsSet(*begin);
+    }
+
+    return sum0 + sum1 + sum2 + sum3;
+}
+
+int selectInWord(Word word, int ordinal)
+    // Return the index of the set bit of the specified 'word' preceded by
+    // exactly the specified 'ordinal' set bits.  The behavior is undefined
+    // unless 'ordinal < BitUtil::numBitsSet(word)'.
+{
+    for (; ordinal > 0; --ordinal) {
+        word &= word - 1;  // clear the lowest set bit
+    }
+    return BitUtil::numTrailingUnsetBits(word);
+}
+
+}  // close unnamed namespace
+
+                            // -------------------
+                            // class DynamicBitset
+                            // -------------------
+
+// PUBLIC CLASS DATA
+const bsl::size_t DynamicBitset::k_INVALID_INDEX;
+
+// PRIVATE MANIPULATORS
+void DynamicBitset::clearUnusedBits()
+{
+    const int numUsed = static_cast<int>(d_length % k_BITS_PER_WORD);
+
+    if (numUsed) {
+        d_words.back() &= (static_cast<Word>(1) << numUsed) - 1;
+    }
+}
+
+// CREATORS
+DynamicBitset::DynamicBitset(bsl::size_t       length,
+                             bool              value,
+                             bslma::Allocator *basicAllocator)
+: d_words(numWordsForLength(length), value ? ~Word() : Word(), basicAllocator)
+, d_length(length)
+{
+    clearUnusedBits();
+}
+
+// MANIPULATORS
+DynamicBitset& DynamicBitset::operator&=(const DynamicBitset& rhs)
+{
+    BSLS_ASSERT(d_length == rhs.d_length);
+
+    Word             *dst = d_words.data();
+    const Word       *src = rhs.d_words.data();
+    const bsl::size_t n   = d_words.size();
+
+    for (bsl::size_t i = 0; i < n; ++i) {
+        dst[i] &= src[i];
+    }
+    return *this;
+}
+
+DynamicBitset& DynamicBitset::operator|=(const DynamicBitset& rhs)
+{
+    BSLS_ASSERT(d_length == rhs.d_length);
+
+    Word             *dst = d_words.data();
+    const Word       *src = rhs.d_words.data();
+    const bsl::size_t n   = d_words.size();
+
+    for (bsl::size_t i = 0; i < n; ++i) {
+        dst[i] |= src[i];
+    }
+    return *this;
+}
+
+DynamicBitset& DynamicBitset::operator^=(const DynamicBitset& rhs)
+{
+    BSLS_ASSERT(d_length == rhs.d_length);
+
+    Word             *dst = d_words.data();
+    const Word       *src = rhs.d_words.data();
+    const bsl::size_t n   = d_words.size();
+
+    for (bsl::size_t i = 0; i < n; ++i) {
+        dst[i] ^= src[i];
+    }
+    return *this;
+}
+
+DynamicBitset& DynamicBitset::operator-=(const DynamicBitset& rhs)
+{
+    BSLS_ASSERT(d_length == rhs.d_length);
+
+    Word             *dst = d_words.data();
+    const Word       *src = rhs.d_words.data();
+    const bsl::size_t n   = d_words.size();
+
+    for (bsl::size_t i = 0; i < n; ++i) {
+        dst[i] &= ~src[i];
+    }
+    return *this;
+}
+
+void DynamicBitset::assignAll(bool value)
+{
+    bsl::fill(d_words.begin(), d_words.end(), value ? ~Word() : Word());
+    clearUnusedBits();
+}
+
+void DynamicBitset::resize(bsl::size_t newLength, bool value)
+{
+    if (value && newLength > d_length) {
+        // Set the unused bits of the current last word before they become
+        // part of the sequence.
+
+        const int numUsed = static_cast<int>(d_length % k_BITS_PER_WORD);
+        if (numUsed) {
+            d_words.back() |= ~Word() << numUsed;
+        }
+    }
+
+    d_words.resize(numWordsForLength(newLength), value ? ~Word() : Word());
+    d_length = newLength;
+
+    clearUnusedBits();
+}
+
+// ACCESSORS
+bsl::size_t DynamicBitset::findFirstSet() const
+{
+    const Word        *words = d_words.data();
+    const bsl::size_t  n     = d_words.size();
+
+    for (bsl::size_t i = 0; i < n; ++i) {
+        if (words[i]) {
+            return i * k_BITS_PER_WORD
+                 + BitUtil::numTrailingUnsetBits(words[i]);           // RETURN
+        }
+    }
+    return k_INVALID_INDEX;
+}
+
+bsl::size_t DynamicBitset::findNextSet(bsl::size_t index) const
+{
+    BSLS_ASSERT(index < d_length);
+
+    ++index;
+
+    const int shift = static_cast<int>(index % k_BITS_PER_WORD);
+
+    bsl::size_t i = index / k_BITS_PER_WORD;
+    if (shift) {
+        // Examine the remainder of the word holding 'index'.
+
+        const Word word = d_words[i] & (~Word() << shift);
+        if (word) {
+            return i * k_BITS_PER_WORD
+                 + BitUtil::numTrailingUnsetBits(word);               // RETURN
+        }
+        ++i;
+    }
+
+    const Word        *words = d_words.data();
+    const bsl::size_t  n     = d_words.size();
+
+    for (; i < n; ++i) {
+        if (words[i]) {
+            return i * k_BITS_PER_WORD
+                 + BitUtil::numTrailingUnsetBits(words[i]);           // RETURN
+        }
+    }
+    return k_INVALID_INDEX;
+}
+
+bsl::size_t DynamicBitset::numBitsSet() const
+{
+    return countBits(d_words.data(), d_words.data() + d_words.size());
+}
+
+bsl::size_t DynamicBitset::rank(bsl::size_t index) const
+{
+    BSLS_ASSERT(index <= d_length);
+
+    const Word        *words   = d_words.data();
+    const bsl::size_t  numFull = index / k_BITS_PER_WORD;
+    const int          numRest = static_cast<int>(index % k_BITS_PER_WORD);
+
+    bsl::size_t result = countBits(words, words + numFull);
+    if (numRest) {
+        const Word mask = (static_cast<Word>(1) << numRest) - 1;
+
+        result += BitUtil::numBitsSet(words[numFull] & mask);
+    }
+    return result;
+}
+
+bsl::size_t DynamicBitset::select(bsl::size_t ordinal) const
+{
+    const Word        *words = d_words.data();
+    const bsl::size_t  n     = d_words.size();
+
+    for (bsl::size_t i = 0; i < n; ++i) {
+        const bsl::size_t count = BitUtil::numBitsSet(words[i]);
+
+        if (ordinal < count) {
+            return i * k_BITS_PER_WORD
+                 + selectInWord(words[i], static_cast<int>(ordinal)); // RETURN
+        }
+        ordinal -= count;
+    }
+    return k_INVALID_INDEX;
+}
+
+                                  // Aspects
+
+bsl::ostream& DynamicBitset::print(bsl::ostream& stream,
+                                   int           level,
+                                   int           spacesPerLevel) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(stream.bad())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return stream;                                                // RETURN
+    }
+
+    bslim::Printer printer(&stream, level, spacesPerLevel);
+
+    printer.start(true);
+    for (bsl::size_t i = d_length; i > 0; --i) {
+        stream << ((*this)[i - 1] ? '1' : '0');
+    }
+    printer.end(true);
+
+    return stream;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+bool bdlb::operator==(const DynamicBitset& lhs, const DynamicBitset& rhs)
+{
+    return lhs.d_length == rhs.d_length
+        && bsl::equal(lhs.d_words.begin(),
+                      lhs.d_words.end(),
+                      rhs.d_words.begin());
+}
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
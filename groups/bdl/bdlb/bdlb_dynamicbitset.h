@@ -0,0 +1,531 @@
+// bdlb_dynamicbitset.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLB_DYNAMICBITSET
+#define INCLUDED_BDLB_DYNAMICBITSET
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a dynamically sized bitset with word-parallel scanning.
+//
+//@CLASSES:
+//  bdlb::DynamicBitset: allocator-aware, resizable sequence of bits
+//
+//@SEE_ALSO: bdlb_bitutil, bslstl_bitset
+//
+//@DESCRIPTION: This component provides a value-semantic, allocator-aware
+// class, 'bdlb::DynamicBitset', representing a sequence of bits whose length
+// is specified at run time and may be changed with 'resize'.  Unlike
+// 'bsl::vector<bool>', the bits are exposed as a set: in addition to
+// per-bit access, the class provides
+//
+//: o whole-set bitwise operations, 'operator&=', 'operator|=', 'operator^=',
+//:   and 'operator-=' (AND-NOT, i.e., set difference),
+//:
+//: o 'numBitsSet', the number of bits that are set (a.k.a. "population
+//:   count"),
+//:
+//: o 'findFirstSet' and 'findNextSet', to iterate over the indices of the
+//:   set bits in increasing order, and
+//:
+//: o 'rank' and 'select', which map between the index of a set bit and its
+//:   ordinal position among the set bits.
+//
+///Word-Parallel Implementation
+///----------------------------
+// Bits are stored 64 to a word, with bit 'i' held in bit 'i % 64' of word
+// 'i / 64', and all bits of the last word beyond 'length()' kept clear.  Each
+// operation above processes a full word at a time:
+//
+//: o Counting, 'rank', and 'select' use 'bdlb::BitUtil::numBitsSet', which
+//:   compiles to the hardware population-count instruction where the compiler
+//:   provides it (e.g., '__builtin_popcountll' on GCC and Clang, used as
+//:   'popcnt' when targeting a CPU that supports it).  The counting loops keep
+//:   several independent partial sums so that successive word counts can
+//:   execute in parallel.
+//:
+//: o 'findFirstSet' and 'findNextSet' skip zero words, then locate the bit
+//:   within a word using 'bdlb::BitUtil::numTrailingUnsetBits' (a single
+//:   'tzcnt'/'bsf' where available).
+//:
+//: o The bitwise operators are simple loops over contiguous word arrays,
+//:   which optimizing compilers vectorize using the SIMD instruction set
+//:   selected at compile time (e.g., SSE2, AVX2).
+//
+// The choice of instruction is thus made at compile time, by the compiler and
+// its target flags; there is no run-time dispatch.
+//
+// 'findNextSet' visits every word between two consecutive set bits, and
+// 'rank' and 'select' visit every word preceding the position of interest;
+// i.e., these operations are linear in the number of bits spanned, but touch
+// only '1/64' as many words, sequentially.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Combining Entitlement and Subscription Masks
+///-------------------------------------------------------
+// Suppose that instruments are identified by small, dense integer ids, and
+// that, for each user, we maintain one bitset indicating the instruments the
+// user is entitled to see and another indicating the instruments the user has
+// subscribed to.
+//
+// First, we create the two masks over a universe of 1000 instruments:
+//..
+//  const bsl::size_t NUM_INSTRUMENTS = 1000;
+//
+//  bdlb::DynamicBitset entitled(NUM_INSTRUMENTS);
+//  bdlb::DynamicBitset subscribed(NUM_INSTRUMENTS);
+//
+//  assert(NUM_INSTRUMENTS == entitled.length());
+//  assert(0               == entitled.numBitsSet());
+//..
+// Then, we grant entitlements to every instrument with an id divisible by 3,
+// and record subscriptions to every instrument with an id divisible by 5:
+//..
+//  for (bsl::size_t id = 0; id < NUM_INSTRUMENTS; id += 3) {
+//      entitled.assign(id, true);
+//  }
+//  for (bsl::size_t id = 0; id < NUM_INSTRUMENTS; id += 5) {
+//      subscribed.assign(id, true);
+//  }
+//..
+// Next, we compute the set of instruments that should actually be delivered
+// to the user, i.e., the subscriptions that are also entitled, and the set of
+// subscriptions that must be rejected:
+//..
+//  bdlb::DynamicBitset delivered(subscribed);
+//  delivered &= entitled;
+//
+//  bdlb::DynamicBitset rejected(subscribed);
+//  rejected -= entitled;
+//
+//  assert(67  == delivered.numBitsSet());  // multiples of 15 in [0, 1000)
+//  assert(133 == rejected.numBitsSet());
+//..
+// Then, we iterate over the delivered instruments in increasing order of id:
+//..
+//  bsl::size_t numVisited = 0;
+//  for (bsl::size_t id  = delivered.findFirstSet();
+//                   id != bdlb::DynamicBitset::k_INVALID_INDEX;
+//                   id  = delivered.findNextSet(id)) {
+//      assert(0 == id % 15);
+//      ++numVisited;
+//  }
+//  assert(67 == numVisited);
+//..
+// Finally, we use 'rank' and 'select' to present the delivered instruments a
+// page at a time; 'select(n)' returns the id of the 'n'th delivered
+// instrument, and 'rank(id)' returns the number of delivered instruments
+// having an id less than 'id':
+//..
+//  const bsl::size_t PAGE_SIZE = 10;
+//
+//  const bsl::size_t firstOfThirdPage = delivered.select(2 * PAGE_SIZE);
+//  assert(300 == firstOfThirdPage);
+//  assert(2 * PAGE_SIZE == delivered.rank(firstOfThirdPage));
+//
+//  assert(bdlb::DynamicBitset::k_INVALID_INDEX == delivered.select(67));
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLB_BITUTIL
+#include <bdlb_bitutil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_IOSFWD
+#include <bsl_iosfwd.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlb {
+
+                            // ===================
+                            // class DynamicBitset
+                            // ===================
+
+class DynamicBitset {
+    // This value-semantic class represents a sequence of bits of a length
+    // that is specified at run time and may be changed, and provides
+    // word-parallel counting, searching, and bitwise operations over that
+    // sequence.  Two 'DynamicBitset' objects have the same value if they have
+    // the same length and the same bit at each index.
+
+    // PRIVATE TYPES
+    typedef BitUtil::uint64_t Word;  // unit of storage
+
+    enum {
+        k_BITS_PER_WORD = 64         // number of bits in a 'Word'
+    };
+
+    // DATA
+    bsl::vector<Word> d_words;   // bits, 'k_BITS_PER_WORD' per word; unused
+                                 // bits of the last word are clear
+
+    bsl::size_t       d_length;  // number of bits
+
+    // FRIENDS
+    friend bool operator==(const DynamicBitset&, const DynamicBitset&);
+
+    // PRIVATE CLASS METHODS
+    static bsl::size_t numWordsForLength(bsl::size_t length);
+        // Return the number of words required to hold the specified 'length'
+        // bits.
+
+    // PRIVATE MANIPULATORS
+    void clearUnusedBits();
+        // Clear the bits of the last word of this object at indices greater
+        // than or equal to 'length()'.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(DynamicBitset, bslma::UsesBslmaAllocator);
+
+    // PUBLIC CLASS DATA
+    static const bsl::size_t k_INVALID_INDEX = ~static_cast<bsl::size_t>(0);
+        // Value returned by the search methods when no bit is found.
+
+    // CREATORS
+    explicit
+    DynamicBitset(bslma::Allocator *basicAllocator = 0);
+        // Create an empty bitset, i.e., having a length of 0.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    explicit
+    DynamicBitset(bsl::size_t       length,
+                  bool              value = false,
+                  bslma::Allocator *basicAllocator = 0);
+        // Create a bitset having the specified 'length' bits, each having the
+        // optionally specified 'value'.  If 'value' is not specified, all
+        // bits are clear.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    DynamicBitset(const DynamicBitset&  original,
+                  bslma::Allocator     *basicAllocator = 0);
+        // Create a bitset having the same value as the specified 'original'
+        // object.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.
+
+    //! ~DynamicBitset() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    DynamicBitset& operator=(const DynamicBitset& rhs);
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.
+
+    DynamicBitset& operator&=(const DynamicBitset& rhs);
+        // Clear each bit of this object for which the corresponding bit of the
+        // specified 'rhs' is clear, and return a reference providing
+        // modifiable access to this object.  The behavior is undefined unless
+        // 'length() == rhs.length()'.
+
+    DynamicBitset& operator|=(const DynamicBitset& rhs);
+        // Set each bit of this object for which the corresponding bit of the
+        // specified 'rhs' is set, and return a reference providing modifiable
+        // access to this object.  The behavior is undefined unless
+        // 'length() == rhs.length()'.
+
+    DynamicBitset& operator^=(const DynamicBitset& rhs);
+        // Toggle each bit of this object for which the corresponding bit of
+        // the specified 'rhs' is set, and return a reference providing
+        // modifiable access to this object.  The behavior is undefined unless
+        // 'length() == rhs.length()'.
+
+    DynamicBitset& operator-=(const DynamicBitset& rhs);
+        // Clear each bit of this object for which the corresponding bit of the
+        // specified 'rhs' is set (i.e., assign to this object the AND-NOT of
+        // its value and that of 'rhs'), and return a reference providing
+        // modifiable access to this object.  The behavior is undefined unless
+        // 'length() == rhs.length()'.
+
+    void assign(bsl::size_t index, bool value);
+        // Set the bit at the specified 'index' to the specified 'value'.  The
+        // behavior is undefined unless 'index < length()'.
+
+    void assignAll(bool value);
+        // Set every bit of this object to the specified 'value'.
+
+    void reserveCapacity(bsl::size_t numBits);
+        // Reserve sufficient memory for this object to hold at least the
+        // specified 'numBits' bits without further allocation.
+
+    void resize(bsl::size_t newLength, bool value = false);
+        // Set the length of this object to the specified 'newLength'.  If
+        // 'newLength > length()', the added bits have the optionally specified
+        // 'value'; if 'value' is not specified, the added bits are clear.  If
+        // 'newLength < length()', the bits at indices greater than or equal to
+        // 'newLength' are discarded.
+
+    void swap(DynamicBitset& other);
+        // Exchange the value of this object with that of the specified 'other'
+        // object.  This method provides the no-throw exception-safety
+        // guarantee.  The behavior is undefined unless this object was created
+        // with the same allocator as 'other'.
+
+    // ACCESSORS
+    bool operator[](bsl::size_t index) const;
+        // Return the value of the bit at the specified 'index'.  The behavior
+        // is undefined unless 'index < length()'.
+
+    bsl::size_t findFirstSet() const;
+        // Return the index of the lowest-indexed set bit of this object, or
+        // 'k_INVALID_INDEX' if no bit is set.
+
+    bsl::size_t findNextSet(bsl::size_t index) const;
+        // Return the index of the lowest-indexed set bit of this object whose
+        // index is greater than the specified 'index', or 'k_INVALID_INDEX' if
+        // there is no such bit.  The behavior is undefined unless
+        // 'index < length()'.
+
+    bsl::size_t length() const;
+        // Return the number of bits in this object.
+
+    bsl::size_t numBitsSet() const;
+        // Return the number of set bits in this object.
+
+    bsl::size_t rank(bsl::size_t index) const;
+        // Return the number of set bits in this object whose index is less
+        // than the specified 'index'.  The behavior is undefined unless
+        // 'index <= length()'.  Note that, if the bit at 'index' is set,
+        // 'select(rank(index)) == index'.
+
+    bsl::size_t select(bsl::size_t ordinal) const;
+        // Return the index of the set bit of this object preceded by exactly
+        // the specified 'ordinal' set bits (i.e., the index of the first set
+        // bit if 'ordinal' is 0), or 'k_INVALID_INDEX' if
+        // 'numBitsSet() <= ordinal'.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this object to supply memory.
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level = 0,
+                        int           spacesPerLevel = 4) const;
+        // Write the value of this object to the specified output 'stream' in a
+        // human-readable format, and return a reference to 'stream'.
+        // Optionally specify an initial indentation 'level', whose absolute
+        // value is incremented recursively for nested objects.  If 'level' is
+        // specified, optionally specify 'spacesPerLevel', whose absolute value
+        // indicates the number of spaces per indentation level for this and
+        // all of its nested objects.  If 'level' is negative, suppress
+        // indentation of the first line.  If 'spacesPerLevel' is negative,
+        // format the entire output on one line, suppressing all but the
+        // initial indentation (as governed by 'level').  If 'stream' is not
+        // valid on entry, this operation has no effect.  Note that the bits
+        // are written as a string of '0' and '1' characters, highest index
+        // first (as for 'bsl::bitset'), and that this human-readable format
+        // is not fully specified, and can change without notice.
+};
+
+// FREE OPERATORS
+bool operator==(const DynamicBitset& lhs, const DynamicBitset& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'DynamicBitset' objects have the same
+    // value if they have the same length and the same bit at each index.
+
+bool operator!=(const DynamicBitset& lhs, const DynamicBitset& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'DynamicBitset' objects do not
+    // have the same value if they differ in length or in the bit at any index.
+
+bsl::ostream& operator<<(bsl::ostream& stream, const DynamicBitset& object);
+    // Write the value of the specified 'object' to the specified output
+    // 'stream' in a single-line format, and return a reference to 'stream'.
+    // If 'stream' is not valid on entry, this operation has no effect.  Note
+    // that this human-readable format is not fully specified and can change
+    // without notice.  Also note that this method has the same behavior as
+    // 'object.print(stream, 0, -1)'.
+
+// FREE FUNCTIONS
+void swap(DynamicBitset& a, DynamicBitset& b);
+    // Exchange the values of the specified 'a' and 'b' objects.  This
+    // function provides the no-throw exception-safety guarantee if the two
+    // objects were created with the same allocator and the basic guarantee
+    // otherwise.
+
+// ============================================================================
+//                         INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // class DynamicBitset
+                            // -------------------
+
+// PRIVATE CLASS METHODS
+inline
+bsl::size_t DynamicBitset::numWordsForLength(bsl::size_t length)
+{
+    return (length + k_BITS_PER_WORD - 1) / k_BITS_PER_WORD;
+}
+
+// CREATORS
+inline
+DynamicBitset::DynamicBitset(bslma::Allocator *basicAllocator)
+: d_words(basicAllocator)
+, d_length(0)
+{
+}
+
+inline
+DynamicBitset::DynamicBitset(const DynamicBitset&  original,
+                             bslma::Allocator     *basicAllocator)
+: d_words(original.d_words, basicAllocator)
+, d_length(original.d_length)
+{
+}
+
+// MANIPULATORS
+inline
+DynamicBitset& DynamicBitset::operator=(const DynamicBitset& rhs)
+{
+    d_words  = rhs.d_words;
+    d_length = rhs.d_length;
+    return *this;
+}
+
+inline
+void DynamicBitset::assign(bsl::size_t index, bool value)
+{
+    BSLS_ASSERT_SAFE(index < d_length);
+
+    Word&      word = d_words[index / k_BITS_PER_WORD];
+    const Word mask = static_cast<Word>(1) << (index % k_BITS_PER_WORD);
+
+    if (value) {
+        word |= mask;
+    }
+    else {
+        word &= ~mask;
+    }
+}
+
+inline
+void DynamicBitset::reserveCapacity(bsl::size_t numBits)
+{
+    d_words.reserve(numWordsForLength(numBits));
+}
+
+inline
+void DynamicBitset::swap(DynamicBitset& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    d_words.swap(other.d_words);
+
+    const bsl::size_t length = d_length;
+    d_length       = other.d_length;
+    other.d_length = length;
+}
+
+// ACCESSORS
+inline
+bool DynamicBitset::operator[](bsl::size_t index) const
+{
+    BSLS_ASSERT_SAFE(index < d_length);
+
+    return BitUtil::isBitSet(d_words[index / k_BITS_PER_WORD],
+                             static_cast<int>(index % k_BITS_PER_WORD));
+}
+
+inline
+bsl::size_t DynamicBitset::length() const
+{
+    return d_length;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *DynamicBitset::allocator() const
+{
+    return d_words.get_allocator().mechanism();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool bdlb::operator!=(const DynamicBitset& lhs, const DynamicBitset& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline
+bsl::ostream& bdlb::operator<<(bsl::ostream&        stream,
+                               const DynamicBitset& object)
+{
+    return object.print(stream, 0, -1);
+}
+
+// FREE FUNCTIONS
+inline
+void bdlb::swap(DynamicBitset& a, DynamicBitset& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+
+        return;                                                       // RETURN
+    }
+
+    DynamicBitset futureA(b, a.allocator());
+    DynamicBitset futureB(a, b.allocator());
+
+    futureA.swap(a);
+    futureB.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1100 @@
+// bdlb_dynamicbitset.t.cpp                                           -*-C++-*-
+#include <bdlb_dynamicbitset.h>
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bdlb::DynamicBitset' is a value-semantic, allocator-aware sequence of bits
+// providing word-parallel counting, searching, and bitwise operations.  After
+// establishing the primary manipulators ('assign', 'resize') and basic
+// accessors ('operator[]', 'length'), we verify each remaining operation
+// against a naive, bit-by-bit computation using 'operator[]', over bitsets of
+// many lengths (in particular, lengths near multiples of the word size) and
+// many pseudo-random patterns.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] DynamicBitset(bslma::Allocator *basicAllocator = 0);
+// [ 2] DynamicBitset(size_t length, bool value = false, Allocator *ba = 0);
+// [ 4] DynamicBitset(const DynamicBitset& original, Allocator *ba = 0);
+//
+// MANIPULATORS
+// [ 4] DynamicBitset& operator=(const DynamicBitset& rhs);
+// [ 8] DynamicBitset& operator&=(const DynamicBitset& rhs);
+// [ 8] DynamicBitset& operator|=(const DynamicBitset& rhs);
+// [ 8] DynamicBitset& operator^=(const DynamicBitset& rhs);
+// [ 8] DynamicBitset& operator-=(const DynamicBitset& rhs);
+// [ 2] void assign(size_t index, bool value);
+// [ 3] void assignAll(bool value);
+// [ 3] void reserveCapacity(size_t numBits);
+// [ 3] void resize(size_t newLength, bool value = false);
+// [ 4] void swap(DynamicBitset& other);
+//
+// ACCESSORS
+// [ 2] bool operator[](size_t index) const;
+// [ 6] size_t findFirstSet() const;
+// [ 6] size_t findNextSet(size_t index) const;
+// [ 2] size_t length() const;
+// [ 6] size_t numBitsSet() const;
+// [ 7] size_t rank(size_t index) const;
+// [ 7] size_t select(size_t ordinal) const;
+// [ 2] bslma::Allocator *allocator() const;
+// [ 5] ostream& print(ostream& stream, int level, int sp) const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const DynamicBitset& lhs, const DynamicBitset& rhs);
+// [ 4] bool operator!=(const DynamicBitset& lhs, const DynamicBitset& rhs);
+// [ 5] ostream& operator<<(ostream& stream, const DynamicBitset& object);
+//
+// FREE FUNCTIONS
+// [ 4] void swap(DynamicBitset& a, DynamicBitset& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 9] USAGE EXAMPLE
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                    GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlb::DynamicBitset Obj;
+
+const bsl::size_t INVALID = Obj::k_INVALID_INDEX;
+
+const bsl::size_t LENGTHS[] = {
+    0, 1, 2, 31, 32, 33, 63, 64, 65, 127, 128, 129, 191, 255, 256, 257, 1000
+};
+const int NUM_LENGTHS = static_cast<int>(sizeof LENGTHS / sizeof *LENGTHS);
+
+// ============================================================================
+//                     HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static unsigned int nextRandom(unsigned int *state)
+    // Advance the specified linear-congruential generator 'state', and return
+    // a pseudo-random value derived from the new state.
+{
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 16;
+}
+
+static void fillRandom(Obj *object, unsigned int *state, int density)
+    // Assign a pseudo-random value to each bit of the specified 'object',
+    // using the specified generator 'state', such that each bit is set with
+    // probability 'density / 8'.  The behavior is undefined unless
+    // '0 <= density <= 8'.
+{
+    for (bsl::size_t i = 0; i < object->length(); ++i) {
+        object->assign(i, static_cast<int>(nextRandom(state) % 8) < density);
+    }
+}
+
+static bsl::size_t naiveCount(const Obj& object, bsl::size_t end)
+    // Return the number of set bits of the specified 'object' at indices less
+    // than the specified 'end', computed bit by bit.
+{
+    bsl::size_t result = 0;
+    for (bsl::size_t i = 0; i < end; ++i) {
+        result += object[i];
+    }
+    return result;
+}
+
+static bsl::size_t naiveFind(const Obj& object, bsl::size_t begin)
+    // Return the index of the first set bit of the specified 'object' at or
+    // after the specified 'begin' index, or 'INVALID' if there is none,
+    // computed bit by bit.
+{
+    for (bsl::size_t i = begin; i < object.length(); ++i) {
+        if (object[i]) {
+            return i;                                                 // RETURN
+        }
+    }
+    return INVALID;
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator         defaultAllocator("default",
+                                                  veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Example 1: Combining Entitlement and Subscription Masks
+///-------------------------------------------------------
+// Suppose that instruments are identified by small, dense integer ids, and
+// that, for each user, we maintain one bitset indicating the instruments the
+// user is entitled to see and another indicating the instruments the user has
+// subscribed to.
+//
+// First, we create the two masks over a universe of 1000 instruments:
+//..
+    const bsl::size_t NUM_INSTRUMENTS = 1000;
+
+    bdlb::DynamicBitset entitled(NUM_INSTRUMENTS);
+    bdlb::DynamicBitset subscribed(NUM_INSTRUMENTS);
+
+    ASSERT(NUM_INSTRUMENTS == entitled.length());
+    ASSERT(0               == entitled.numBitsSet());
+//..
+// Then, we grant entitlements to every instrument with an id divisible by 3,
+// and record subscriptions to every instrument with an id divisible by 5:
+//..
+    for (bsl::size_t id = 0; id < NUM_INSTRUMENTS; id += 3) {
+        entitled.assign(id, true);
+    }
+    for (bsl::size_t id = 0; id < NUM_INSTRUMENTS; id += 5) {
+        subscribed.assign(id, true);
+    }
+//..
+// Next, we compute the set of instruments that should actually be delivered
+// to the user, i.e., the subscriptions that are also entitled, and the set of
+// subscriptions that must be rejected:
+//..
+    bdlb::DynamicBitset delivered(subscribed);
+    delivered &= entitled;
+
+    bdlb::DynamicBitset rejected(subscribed);
+    rejected -= entitled;
+
+    ASSERT(67  == delivered.numBitsSet());  // multiples of 15 in [0, 1000)
+    ASSERT(133 == rejected.numBitsSet());
+//..
+// Then, we iterate over the delivered instruments in increasing order of id:
+//..
+    bsl::size_t numVisited = 0;
+    for (bsl::size_t id  = delivered.findFirstSet();
+                     id != bdlb::DynamicBitset::k_INVALID_INDEX;
+                     id  = delivered.findNextSet(id)) {
+        ASSERT(0 == id % 15);
+        ++numVisited;
+    }
+    ASSERT(67 == numVisited);
+//..
+// Finally, we use 'rank' and 'select' to present the delivered instruments a
+// page at a time; 'select(n)' returns the id of the 'n'th delivered
+// instrument, and 'rank(id)' returns the number of delivered instruments
+// having an id less than 'id':
+//..
+    const bsl::size_t PAGE_SIZE = 10;
+
+    const bsl::size_t firstOfThirdPage = delivered.select(2 * PAGE_SIZE);
+    ASSERT(300 == firstOfThirdPage);
+    ASSERT(2 * PAGE_SIZE == delivered.rank(firstOfThirdPage));
+
+    ASSERT(bdlb::DynamicBitset::k_INVALID_INDEX == delivered.select(67));
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // BITWISE OPERATORS
+        //
+        // Concerns:
+        //: 1 Each operator computes, for every index, the corresponding
+        //:   boolean function of the bits of its operands.
+        //:
+        //: 2 The right-hand operand is not modified.
+        //:
+        //: 3 The operators work when both operands are the same object.
+        //:
+        //: 4 Unused bits of the last word remain clear (e.g., '^=' of a
+        //:   full bitset does not produce bits beyond 'length()').
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each length in a table, and several pseudo-random pairs of
+        //:   operands, apply each operator to a copy of the left operand and
+        //:   compare each bit of the result with the expected boolean
+        //:   function.  Verify that the right operand is unchanged.  (C-1..2)
+        //:
+        //: 2 Apply each operator with an object as both operands.  (C-3)
+        //:
+        //: 3 Verify 'numBitsSet' after toggling a full bitset, and that the
+        //:   result compares equal to an empty bitset of the same length.
+        //:   (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for operands of different lengths.  (C-5)
+        //
+        // Testing:
+        //   DynamicBitset& operator&=(const DynamicBitset& rhs);
+        //   DynamicBitset& operator|=(const DynamicBitset& rhs);
+        //   DynamicBitset& operator^=(const DynamicBitset& rhs);
+        //   DynamicBitset& operator-=(const DynamicBitset& rhs);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BITWISE OPERATORS" << endl
+                          << "=================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        unsigned int state = 7;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const bsl::size_t LENGTH = LENGTHS[ti];
+
+            for (int trial = 0; trial < 5; ++trial) {
+                Obj mA(LENGTH, false, &oa);  const Obj& A = mA;
+                Obj mB(LENGTH, false, &oa);  const Obj& B = mB;
+
+                fillRandom(&mA, &state, trial + 2);
+                fillRandom(&mB, &state, 6 - trial);
+
+                const Obj B0(B, &oa);
+
+                Obj mAnd(A, &oa);  mAnd &= B;
+                Obj mOr (A, &oa);  mOr  |= B;
+                Obj mXor(A, &oa);  mXor ^= B;
+                Obj mDif(A, &oa);  mDif -= B;
+
+                ASSERTV(LENGTH, trial, B0 == B);
+
+                for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                    ASSERTV(LENGTH, i, (A[i] && B[i])  == mAnd[i]);
+                    ASSERTV(LENGTH, i, (A[i] || B[i])  == mOr[i]);
+                    ASSERTV(LENGTH, i, (A[i] != B[i])  == mXor[i]);
+                    ASSERTV(LENGTH, i, (A[i] && !B[i]) == mDif[i]);
+                }
+
+                // Self-application.
+
+                Obj mX(A, &oa);
+                mX &= mX;  ASSERTV(LENGTH, A == mX);
+                mX |= mX;  ASSERTV(LENGTH, A == mX);
+                mX -= mX;  ASSERTV(LENGTH, 0 == mX.numBitsSet());
+                mX  = A;
+                mX ^= mX;  ASSERTV(LENGTH, 0 == mX.numBitsSet());
+            }
+
+            Obj mF(LENGTH, true, &oa);
+            Obj mG(LENGTH, true, &oa);
+
+            mF ^= mG;
+            ASSERTV(LENGTH, 0 == mF.numBitsSet());
+            ASSERTV(LENGTH, Obj(LENGTH, false, &oa) == mF);
+
+            mF |= mG;
+            ASSERTV(LENGTH, LENGTH == mF.numBitsSet());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(10, false, &oa);
+            Obj mY(10, false, &oa);
+            Obj mZ(11, false, &oa);
+
+            ASSERT_PASS(mX &= mY);
+            ASSERT_FAIL(mX &= mZ);
+            ASSERT_PASS(mX |= mY);
+            ASSERT_FAIL(mX |= mZ);
+            ASSERT_PASS(mX ^= mY);
+            ASSERT_FAIL(mX ^= mZ);
+            ASSERT_PASS(mX -= mY);
+            ASSERT_FAIL(mX -= mZ);
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // 'rank' AND 'select'
+        //
+        // Concerns:
+        //: 1 'rank(i)' returns the number of set bits at indices less than
+        //:   'i', for every 'i' in '[0, length()]'.
+        //:
+        //: 2 'select(n)' returns the index of the set bit preceded by 'n' set
+        //:   bits, or 'k_INVALID_INDEX' if 'n >= numBitsSet()'.
+        //:
+        //: 3 'rank' and 'select' are inverses on the indices of set bits.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each length in a table and several pseudo-random patterns of
+        //:   varying density, compare 'rank' for each index with a bit-by-bit
+        //:   count.  (C-1)
+        //:
+        //: 2 Walk the set bits using 'operator[]', verifying 'select' of each
+        //:   ordinal, and 'rank' of each selected index.  (C-2..3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for an out-of-range 'rank' argument.  (C-4)
+        //
+        // Testing:
+        //   size_t rank(size_t index) const;
+        //   size_t select(size_t ordinal) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'rank' AND 'select'" << endl
+                          << "===================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        unsigned int state = 3;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const bsl::size_t LENGTH = LENGTHS[ti];
+
+            for (int density = 0; density <= 8; ++density) {
+                Obj mX(LENGTH, false, &oa);  const Obj& X = mX;
+                fillRandom(&mX, &state, density);
+
+                for (bsl::size_t i = 0; i <= LENGTH; ++i) {
+                    ASSERTV(LENGTH, density, i,
+                            naiveCount(X, i) == X.rank(i));
+                }
+
+                bsl::size_t ordinal = 0;
+                for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                    if (X[i]) {
+                        ASSERTV(LENGTH, density, ordinal, i,
+                                i == X.select(ordinal));
+                        ASSERTV(LENGTH, density, i, ordinal == X.rank(i));
+                        ++ordinal;
+                    }
+                }
+                ASSERTV(LENGTH, density, INVALID == X.select(ordinal));
+                ASSERTV(LENGTH, density, INVALID == X.select(ordinal + 64));
+                ASSERTV(LENGTH, density, INVALID == X.select(INVALID));
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(10, false, &oa);  const Obj& X = mX;
+
+            ASSERT_PASS(X.rank(10));
+            ASSERT_FAIL(X.rank(11));
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // 'numBitsSet', 'findFirstSet', AND 'findNextSet'
+        //
+        // Concerns:
+        //: 1 'numBitsSet' returns the number of set bits, including when the
+        //:   length spans multiple words or ends mid-word.
+        //:
+        //: 2 'findFirstSet' and 'findNextSet' visit exactly the set bits, in
+        //:   increasing order of index, across word boundaries.
+        //:
+        //: 3 'k_INVALID_INDEX' is returned when there is no further set bit,
+        //:   including for an empty object and from the last index.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each length in a table, and several pseudo-random patterns of
+        //:   varying density (including all-clear and all-set), compare
+        //:   'numBitsSet' with a bit-by-bit count, and compare 'findFirstSet'
+        //:   and 'findNextSet' from every index with a bit-by-bit search.
+        //:   (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for an out-of-range 'findNextSet' argument.  (C-4)
+        //
+        // Testing:
+        //   size_t findFirstSet() const;
+        //   size_t findNextSet(size_t index) const;
+        //   size_t numBitsSet() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'numBitsSet', 'findFirstSet', AND 'findNextSet'"
+                          << endl
+                          << "==============================================="
+                          << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(0       == X.numBitsSet());
+            ASSERT(INVALID == X.findFirstSet());
+        }
+
+        unsigned int state = 11;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const bsl::size_t LENGTH = LENGTHS[ti];
+
+            for (int density = 0; density <= 8; ++density) {
+                Obj mX(LENGTH, false, &oa);  const Obj& X = mX;
+                fillRandom(&mX, &state, density);
+
+                ASSERTV(LENGTH, density,
+                        naiveCount(X, LENGTH) == X.numBitsSet());
+                ASSERTV(LENGTH, density,
+                        naiveFind(X, 0) == X.findFirstSet());
+
+                for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                    ASSERTV(LENGTH, density, i,
+                            naiveFind(X, i + 1) == X.findNextSet(i));
+                }
+
+                bsl::size_t numVisited = 0;
+                for (bsl::size_t i  = X.findFirstSet();
+                                 i != INVALID;
+                                 i  = X.findNextSet(i)) {
+                    ASSERTV(LENGTH, density, i, X[i]);
+                    ++numVisited;
+                }
+                ASSERTV(LENGTH, density, X.numBitsSet() == numVisited);
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(10, false, &oa);  const Obj& X = mX;
+
+            ASSERT_PASS(X.findNextSet( 9));
+            ASSERT_FAIL(X.findNextSet(10));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'print' AND 'operator<<'
+        //
+        // Concerns:
+        //: 1 The bits are written highest index first, as '0' and '1'.
+        //:
+        //: 2 'level' and 'spacesPerLevel' control indentation as for other
+        //:   value-semantic types.
+        //:
+        //: 3 'operator<<' matches 'print(stream, 0, -1)'.
+        //
+        // Plan:
+        //: 1 Print objects of known value using a table of 'level' and
+        //:   'spacesPerLevel' values, and compare with the expected output.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   ostream& print(ostream& stream, int level, int sp) const;
+        //   ostream& operator<<(ostream& stream, const DynamicBitset& object);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'print' AND 'operator<<'" << endl
+                          << "========================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(5, false, &oa);  const Obj& X = mX;
+        mX.assign(0, true);
+        mX.assign(3, true);
+
+        static const struct {
+            int         d_line;
+            int         d_level;
+            int         d_spacesPerLevel;
+            const char *d_expected_p;
+        } DATA[] = {
+            //LINE  LEVEL  SPL  EXPECTED
+            //----  -----  ---  --------------
+            { L_,       0,   0, "01001\n"      },
+            { L_,       0,  -1, "01001"        },
+            { L_,       1,   2, "  01001\n"    },
+            { L_,      -1,   2, "01001\n"      },
+            { L_,       2,   3, "      01001\n" },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE = DATA[ti].d_line;
+
+            bsl::ostringstream oss(&oa);
+            X.print(oss, DATA[ti].d_level, DATA[ti].d_spacesPerLevel);
+
+            ASSERTV(LINE, oss.str(), DATA[ti].d_expected_p == oss.str());
+        }
+
+        {
+            bsl::ostringstream oss(&oa);
+            oss << X;
+            ASSERTV(oss.str(), "01001" == oss.str());
+        }
+        {
+            bsl::ostringstream oss(&oa);
+            oss << Obj(&oa);
+            ASSERTV(oss.str(), "" == oss.str());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // VALUE SEMANTICS
+        //
+        // Concerns:
+        //: 1 The copy constructor creates an object having the same value,
+        //:   using the supplied (or default) allocator.
+        //:
+        //: 2 Two objects compare equal if and only if they have the same
+        //:   length and the same bit at each index.
+        //:
+        //: 3 Copy assignment gives the target the value of the source and
+        //:   returns a reference to the target, including for self-assignment.
+        //:
+        //: 4 'swap' exchanges values without allocation when the allocators
+        //:   match; the free 'swap' also handles differing allocators.
+        //
+        // Plan:
+        //: 1 For each pair of lengths in a table, create objects with
+        //:   pseudo-random values, and objects that differ in a single bit,
+        //:   and verify '==', '!=', copy construction, assignment, and
+        //:   'swap'.  (C-1..4)
+        //
+        // Testing:
+        //   DynamicBitset(const DynamicBitset& original, Allocator *ba = 0);
+        //   DynamicBitset& operator=(const DynamicBitset& rhs);
+        //   void swap(DynamicBitset& other);
+        //   bool operator==(const DynamicBitset& lhs, const DynamicBitset&);
+        //   bool operator!=(const DynamicBitset& lhs, const DynamicBitset&);
+        //   void swap(DynamicBitset& a, DynamicBitset& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VALUE SEMANTICS" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        unsigned int state = 5;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const bsl::size_t LENGTH1 = LENGTHS[ti];
+
+            Obj mX(LENGTH1, false, &oa);  const Obj& X = mX;
+            fillRandom(&mX, &state, 4);
+
+            // Copy construction.
+
+            {
+                Obj mY(X, &za);  const Obj& Y = mY;
+
+                ASSERTV(LENGTH1, X == Y);
+                ASSERTV(LENGTH1, !(X != Y));
+                ASSERTV(LENGTH1, &za == Y.allocator());
+
+                const bsls::Types::Int64 NUM_BLOCKS =
+                                             defaultAllocator.numBlocksTotal();
+                Obj mZ(X);
+                ASSERTV(LENGTH1, X == mZ);
+                ASSERTV(LENGTH1, &defaultAllocator == mZ.allocator());
+                ASSERTV(LENGTH1, (0 == LENGTH1) ==
+                         (NUM_BLOCKS == defaultAllocator.numBlocksTotal()));
+            }
+
+            // Objects differing in a single bit.
+
+            for (bsl::size_t i = 0; i < LENGTH1; i += 7) {
+                Obj mY(X, &oa);  const Obj& Y = mY;
+                mY.assign(i, !X[i]);
+
+                ASSERTV(LENGTH1, i, !(X == Y));
+                ASSERTV(LENGTH1, i,   X != Y);
+            }
+
+            for (int tj = 0; tj < NUM_LENGTHS; ++tj) {
+                const bsl::size_t LENGTH2 = LENGTHS[tj];
+
+                Obj mY(LENGTH2, false, &za);  const Obj& Y = mY;
+                fillRandom(&mY, &state, 4);
+
+                // Objects of different lengths never compare equal, even if
+                // all bits are clear.
+
+                {
+                    const Obj Z1(LENGTH1, false, &oa);
+                    const Obj Z2(LENGTH2, false, &oa);
+
+                    ASSERTV(LENGTH1, LENGTH2,
+                            (LENGTH1 == LENGTH2) == (Z1 == Z2));
+                }
+
+                // Assignment.
+
+                {
+                    Obj mZ(Y, &oa);  const Obj& Z = mZ;
+
+                    Obj *mR = &(mZ = X);
+                    ASSERTV(LENGTH1, LENGTH2, mR == &mZ);
+                    ASSERTV(LENGTH1, LENGTH2, X  == Z);
+                    ASSERTV(LENGTH1, LENGTH2, &oa == Z.allocator());
+
+                    mR = &(mZ = Z);
+                    ASSERTV(LENGTH1, LENGTH2, mR == &mZ);
+                    ASSERTV(LENGTH1, LENGTH2, X  == Z);
+                }
+
+                // Member 'swap' (same allocator).
+
+                {
+                    Obj mA(X, &oa);  const Obj& A = mA;
+                    Obj mB(Y, &oa);  const Obj& B = mB;
+
+                    const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+                    mA.swap(mB);
+
+                    ASSERTV(LENGTH1, LENGTH2, Y == A);
+                    ASSERTV(LENGTH1, LENGTH2, X == B);
+                    ASSERTV(LENGTH1, LENGTH2,
+                            NUM_BLOCKS == oa.numBlocksTotal());
+
+                    swap(mA, mB);
+
+                    ASSERTV(LENGTH1, LENGTH2, X == A);
+                    ASSERTV(LENGTH1, LENGTH2, Y == B);
+                    ASSERTV(LENGTH1, LENGTH2,
+                            NUM_BLOCKS == oa.numBlocksTotal());
+                }
+
+                // Free 'swap' (different allocators).
+
+                {
+                    Obj mA(X, &oa);  const Obj& A = mA;
+                    Obj mB(Y, &za);  const Obj& B = mB;
+
+                    swap(mA, mB);
+
+                    ASSERTV(LENGTH1, LENGTH2, Y == A);
+                    ASSERTV(LENGTH1, LENGTH2, X == B);
+                    ASSERTV(LENGTH1, LENGTH2, &oa == A.allocator());
+                    ASSERTV(LENGTH1, LENGTH2, &za == B.allocator());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(&oa);
+            Obj mY(&oa);
+            Obj mZ(&za);
+
+            ASSERT_SAFE_PASS(mX.swap(mY));
+            ASSERT_SAFE_FAIL(mX.swap(mZ));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'resize', 'reserveCapacity', AND 'assignAll'
+        //
+        // Concerns:
+        //: 1 Growing an object preserves the existing bits and gives the added
+        //:   bits the specified value, including the previously unused bits
+        //:   of the old last word.
+        //:
+        //: 2 Shrinking an object preserves the retained bits, and bits that
+        //:   are discarded do not reappear when the object grows again.
+        //:
+        //: 3 'assignAll' sets every bit to the specified value, and only bits
+        //:   below 'length()'.
+        //:
+        //: 4 After 'reserveCapacity(n)', growing to at most 'n' bits does not
+        //:   allocate.
+        //
+        // Plan:
+        //: 1 For each pair of lengths in a table, and each fill value, resize
+        //:   an object with a known pattern and verify each bit, and the
+        //:   count of set bits.  (C-1..2)
+        //:
+        //: 2 Call 'assignAll' on objects of each length and verify
+        //:   'numBitsSet'.  (C-3)
+        //:
+        //: 3 Reserve capacity, then resize, and verify the allocation count.
+        //:   (C-4)
+        //
+        // Testing:
+        //   void assignAll(bool value);
+        //   void reserveCapacity(size_t numBits);
+        //   void resize(size_t newLength, bool value = false);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'resize', 'reserveCapacity', AND 'assignAll'"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const bsl::size_t LENGTH1 = LENGTHS[ti];
+
+            for (int tj = 0; tj < NUM_LENGTHS; ++tj) {
+                const bsl::size_t LENGTH2 = LENGTHS[tj];
+
+                for (int value = 0; value < 2; ++value) {
+                    const bool VALUE = value;
+
+                    // Pattern: bit 'i' is set if 'i % 3 == 0'.
+
+                    Obj mX(LENGTH1, false, &oa);  const Obj& X = mX;
+                    for (bsl::size_t i = 0; i < LENGTH1; i += 3) {
+                        mX.assign(i, true);
+                    }
+
+                    mX.resize(LENGTH2, VALUE);
+                    ASSERTV(LENGTH1, LENGTH2, LENGTH2 == X.length());
+
+                    bsl::size_t expectedCount = 0;
+                    for (bsl::size_t i = 0; i < LENGTH2; ++i) {
+                        const bool EXP = i < LENGTH1 ? 0 == i % 3 : VALUE;
+                        ASSERTV(LENGTH1, LENGTH2, VALUE, i, EXP == X[i]);
+                        expectedCount += EXP;
+                    }
+                    ASSERTV(LENGTH1, LENGTH2, VALUE,
+                            expectedCount == X.numBitsSet());
+
+                    // Grow again with clear bits: nothing discarded by a
+                    // shrink may reappear.
+
+                    mX.resize(LENGTH1 + LENGTH2);
+                    ASSERTV(LENGTH1, LENGTH2, VALUE,
+                            expectedCount == X.numBitsSet());
+                }
+            }
+
+            Obj mX(LENGTH1, false, &oa);  const Obj& X = mX;
+
+            mX.assignAll(true);
+            ASSERTV(LENGTH1, LENGTH1 == X.numBitsSet());
+            ASSERTV(LENGTH1, Obj(LENGTH1, true, &oa) == X);
+
+            mX.resize(LENGTH1 + 100);
+            ASSERTV(LENGTH1, LENGTH1 == X.numBitsSet());
+
+            mX.assignAll(false);
+            ASSERTV(LENGTH1, 0 == X.numBitsSet());
+        }
+
+        {
+            Obj mX(&oa);
+
+            mX.reserveCapacity(1000);
+
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+            mX.resize(1000, true);
+            ASSERT(1000 == mX.numBitsSet());
+            ASSERT(NUM_BLOCKS == oa.numBlocksTotal());
+
+            mX.resize(1025);
+            ASSERT(NUM_BLOCKS < oa.numBlocksTotal());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The default constructor creates an empty object.
+        //:
+        //: 2 The value constructor creates an object of the specified length
+        //:   with every bit having the specified (or default) value.
+        //:
+        //: 3 Memory comes from the supplied allocator, or the default
+        //:   allocator if none is supplied, and 'allocator' returns it.
+        //:
+        //: 4 'assign' changes exactly the specified bit, which 'operator[]'
+        //:   then reflects.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create objects with each constructor and verify 'length',
+        //:   'operator[]', and 'allocator'.  (C-1..3)
+        //:
+        //: 2 For each length in a table, set and clear each bit in turn and
+        //:   verify every bit with 'operator[]'.  (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for out-of-range indices.  (C-5)
+        //
+        // Testing:
+        //   DynamicBitset(bslma::Allocator *basicAllocator = 0);
+        //   DynamicBitset(size_t length, bool value = false, Allocator *ba);
+        //   void assign(size_t index, bool value);
+        //   bool operator[](size_t index) const;
+        //   size_t length() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(0                 == X.length());
+            ASSERT(&defaultAllocator == X.allocator());
+        }
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(0   == X.length());
+            ASSERT(&oa == X.allocator());
+            ASSERT(0   == oa.numBlocksTotal());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const bsl::size_t LENGTH = LENGTHS[ti];
+
+            for (int value = 0; value < 2; ++value) {
+                const bool VALUE = value;
+
+                Obj mX(LENGTH, VALUE, &oa);  const Obj& X = mX;
+
+                ASSERTV(LENGTH, LENGTH == X.length());
+                ASSERTV(LENGTH, &oa    == X.allocator());
+
+                for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                    ASSERTV(LENGTH, VALUE, i, VALUE == X[i]);
+                }
+
+                for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                    mX.assign(i, !VALUE);
+
+                    for (bsl::size_t j = 0; j < LENGTH; ++j) {
+                        ASSERTV(LENGTH, i, j,
+                                (i == j ? !VALUE : VALUE) == X[j]);
+                    }
+
+                    mX.assign(i, VALUE);
+                    ASSERTV(LENGTH, i, VALUE == X[i]);
+                }
+            }
+
+            Obj mY(LENGTH);  const Obj& Y = mY;
+            ASSERTV(LENGTH, &defaultAllocator == Y.allocator());
+            for (bsl::size_t i = 0; i < LENGTH; ++i) {
+                ASSERTV(LENGTH, i, false == Y[i]);
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(10, false, &oa);  const Obj& X = mX;
+
+            ASSERT_SAFE_PASS(X[9]);
+            ASSERT_SAFE_FAIL(X[10]);
+            ASSERT_SAFE_PASS(mX.assign( 9, true));
+            ASSERT_SAFE_FAIL(mX.assign(10, true));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create objects, set bits, and exercise the primary operations.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(130, false, &oa);  const Obj& X = mX;
+        ASSERT(130 == X.length());
+        ASSERT(0   == X.numBitsSet());
+
+        mX.assign(  3, true);
+        mX.assign( 64, true);
+        mX.assign(129, true);
+
+        ASSERT(3       == X.numBitsSet());
+        ASSERT(3       == X.findFirstSet());
+        ASSERT(64      == X.findNextSet(3));
+        ASSERT(129     == X.findNextSet(64));
+        ASSERT(INVALID == X.findNextSet(129));
+        ASSERT(2       == X.rank(129));
+        ASSERT(64      == X.select(1));
+
+        Obj mY(X, &oa);  const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        mY.assign(64, false);
+        ASSERT(X != Y);
+
+        mX -= Y;
+        ASSERT(1  == X.numBitsSet());
+        ASSERT(64 == X.findFirstSet());
+
+        mX.resize(10);
+        ASSERT(0 == X.numBitsSet());
+
+        if (veryVerbose) { P(X) P(Y) }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
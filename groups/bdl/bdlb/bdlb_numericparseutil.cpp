@@ -0,0 +1,648 @@
+// bdlb_numericparseutil.cpp                                          -*-C++-*-
+#include <bdlb_numericparseutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(RCSid_bdlb_numericparseutil_cpp,"$Id$ $CSID$")
+
+#include <bslalg_numericformatterutil.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_limits.h>
+
+#include <float.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// Integers are accumulated in the unsigned type of the result, checking
+// before each step that the next digit cannot carry the value past the
+// largest magnitude permitted by the sign that was read.
+//
+// A floating-point significand is scanned once, accumulating its first 19
+// significant digits into a 64-bit integer 'm' (19 decimal digits being the
+// most that cannot overflow a 'Uint64'), and the value of the input is
+// 'm * 10^e' for the decimal exponent 'e' implied by the explicit exponent and
+// the position of the decimal point.  If there were no more than 19
+// significant digits (so that 'm' is the whole significand), 'm <= 2^53' (so
+// 'm' is exactly representable as a 'double'), and '|e| <= 22' (so '10^e' is
+// exactly representable as well), the correctly rounded result is a single
+// IEEE multiplication or division (see W. D. Clinger, "How to Read Floating
+// Point Numbers Accurately", PLDI 1990).  Note that the digit limit alone does
+// not bound 'm' by 2^53 (19 digits reach nearly 10^19), so both bounds are
+// checked separately.
+// This argument requires that intermediate results are not kept in a wider
+// format, so the fast path is disabled unless 'FLT_EVAL_METHOD' is 0.
+//
+// Any other input is rewritten into a buffer on the stack as its significant
+// digits followed by 'e' and the decimal exponent.  This canonical form
+// contains no decimal point, and so is parsed by 'strtod' identically in
+// every locale.  No more than 'k_MAX_DIGITS' significant digits are needed to
+// decide the rounding of any 'double': should the input have more, the digits
+// beyond the limit are replaced by a single non-zero "sticky" digit if any of
+// them is non-zero, which preserves the direction of every rounding decision.
+
+namespace BloombergLP {
+namespace bdlb {
+
+namespace {
+
+enum {
+    k_MAX_FAST_DIGITS   = 19,    // significant digits that fit a 'Uint64'
+    k_MAX_FAST_EXPONENT = 22,    // largest exact power of 10 in a 'double'
+    k_MAX_DIGITS        = 768,   // significant digits passed to 'strtod'
+    k_BUFFER_SIZE       = k_MAX_DIGITS + 32
+};
+
+#if !defined(FLT_EVAL_METHOD) || 0 == FLT_EVAL_METHOD
+#define BDLB_NUMERICPARSEUTIL_FAST_PATH 1
+#endif
+
+const bsls::Types::Int64 k_MAX_EXPONENT = 1000000000000000LL;
+    // The magnitude at which an explicit exponent saturates.  Any value
+    // having an exponent of this magnitude is zero or infinite, however many
+    // digits its significand has.
+
+#ifdef BDLB_NUMERICPARSEUTIL_FAST_PATH
+const double k_POWERS_OF_10[k_MAX_FAST_EXPONENT + 1] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+    // The powers of 10 that are exactly representable as a 'double'.
+#endif
+
+inline
+bool isDigit(char c)
+    // Return 'true' if the specified 'c' is a decimal digit, and 'false'
+    // otherwise.
+{
+    return static_cast<unsigned>(c - '0') < 10;
+}
+
+inline
+int digitValue(char c)
+    // Return the value of the specified 'c' as a digit in base 36, or 36 if
+    // 'c' is not such a digit.
+{
+    const unsigned decimal = static_cast<unsigned>(c - '0');
+    if (decimal < 10) {
+        return decimal;                                               // RETURN
+    }
+    const unsigned letter = static_cast<unsigned>((c | 0x20) - 'a');
+    return letter < 26 ? letter + 10 : 36;
+}
+
+bool matchWord(const char **position,
+               const char  *end,
+               const char  *lowerCaseWord)
+    // If the characters starting at the specified '*position' and ending
+    // before the specified 'end' begin with the specified null-terminated
+    // 'lowerCaseWord' (compared case-insensitively), advance '*position' past
+    // them and return 'true'; otherwise return 'false' with no effect.
+{
+    const char *p = *position;
+    for (; *lowerCaseWord; ++lowerCaseWord, ++p) {
+        if (p == end || (*p | 0x20) != *lowerCaseWord) {
+            return false;                                             // RETURN
+        }
+    }
+    *position = p;
+    return true;
+}
+
+const char *scanDigits(bsls::Types::Uint64 *mantissa,
+                       bsls::Types::Int64  *numDigits,
+                       const char          *position,
+                       const char          *end)
+    // Scan the longest sequence of decimal digits starting at the specified
+    // 'position' and ending before the specified 'end', and return the
+    // address one past it.  Append the significant digits of the sequence to
+    // the specified 'mantissa' until it holds 'k_MAX_FAST_DIGITS' of them, and
+    // add the number of significant digits to the specified 'numDigits', the
+    // number of significant digits already in 'mantissa' (or more).
+{
+    for (; position != end && isDigit(*position); ++position) {
+        if (*numDigits >= k_MAX_FAST_DIGITS) {
+            ++*numDigits;
+        }
+        else if (*numDigits || '0' != *position) {
+            *mantissa = *mantissa * 10 + (*position - '0');
+            ++*numDigits;
+        }
+    }
+    return position;
+}
+
+template <class UNSIGNED>
+int parseMagnitude(UNSIGNED    *result,
+                   const char **position,
+                   const char  *end,
+                   int          base,
+                   UNSIGNED     maxValue)
+    // Parse the longest sequence of digits in the specified 'base' starting at
+    // the specified '*position' and ending before the specified 'end', load
+    // its value into the specified 'result', and advance '*position' past the
+    // digits.  Return 0 on success, and a non-zero value with no effect if
+    // there are no digits or if their value exceeds the specified 'maxValue'.
+{
+    BSLS_ASSERT(2 <= base);
+    BSLS_ASSERT(base <= 36);
+
+    const char *p     = *position;
+    UNSIGNED    value = 0;
+
+    if (10 == base) {
+        // Decimal input is by far the most common, and dividing by a constant
+        // is much cheaper than dividing by 'base'.
+
+        const UNSIGNED limit     = maxValue / 10;
+        const unsigned lastDigit = static_cast<unsigned>(maxValue % 10);
+        for (; p != end; ++p) {
+            const unsigned digit = static_cast<unsigned>(*p - '0');
+            if (digit > 9) {
+                break;
+            }
+            if (value >= limit && (value > limit || digit > lastDigit)) {
+                return -2;                                            // RETURN
+            }
+            value = value * 10 + digit;
+        }
+    }
+    else {
+        const UNSIGNED limit = maxValue / base;
+        for (; p != end; ++p) {
+            const int digit = digitValue(*p);
+            if (digit >= base) {
+                break;
+            }
+            if (value > limit) {
+                return -2;                                            // RETURN
+            }
+            value *= base;
+            if (value > maxValue - digit) {
+                return -2;                                            // RETURN
+            }
+            value += digit;
+        }
+    }
+
+    if (p == *position) {
+        return -1;                                                    // RETURN
+    }
+
+    *result   = value;
+    *position = p;
+    return 0;
+}
+
+template <class SIGNED, class UNSIGNED>
+int parseSigned(SIGNED                   *result,
+                bslstl::StringRef        *remainder,
+                const bslstl::StringRef&  inputString,
+                int                       base)
+    // Parse the longest prefix of the specified 'inputString' that forms a
+    // signed integer in the specified 'base', load its value into the
+    // specified 'result' and the rest of 'inputString' into the specified
+    // 'remainder'.  Return 0 on success, and a non-zero value with no effect
+    // otherwise.  The type 'UNSIGNED' must be the unsigned type corresponding
+    // to 'SIGNED'.
+{
+    const char *p   = inputString.begin();
+    const char *end = inputString.end();
+
+    bool negative = false;
+    if (p != end && ('+' == *p || '-' == *p)) {
+        negative = '-' == *p;
+        ++p;
+    }
+
+    const UNSIGNED maxPositive =
+                     static_cast<UNSIGNED>(bsl::numeric_limits<SIGNED>::max());
+
+    UNSIGNED magnitude;
+    if (0 != parseMagnitude(&magnitude,
+                            &p,
+                            end,
+                            base,
+                            negative ? maxPositive + 1 : maxPositive)) {
+        return -1;                                                    // RETURN
+    }
+
+    // Negate in the unsigned type, whose arithmetic is modular, so that the
+    // most negative value is produced without overflow.
+
+    *result = negative ? static_cast<SIGNED>(0 - magnitude)
+                       : static_cast<SIGNED>(magnitude);
+    *remainder = bslstl::StringRef(p, end);
+    return 0;
+}
+
+template <class UNSIGNED>
+int parseUnsigned(UNSIGNED                 *result,
+                  bslstl::StringRef        *remainder,
+                  const bslstl::StringRef&  inputString,
+                  int                       base)
+    // Parse the longest prefix of the specified 'inputString' that forms an
+    // unsigned integer in the specified 'base', load its value into the
+    // specified 'result' and the rest of 'inputString' into the specified
+    // 'remainder'.  Return 0 on success, and a non-zero value with no effect
+    // otherwise.
+{
+    const char *p   = inputString.begin();
+    const char *end = inputString.end();
+
+    if (p != end && '+' == *p) {
+        ++p;
+    }
+
+    UNSIGNED value;
+    if (0 != parseMagnitude(&value,
+                            &p,
+                            end,
+                            base,
+                            bsl::numeric_limits<UNSIGNED>::max())) {
+        return -1;                                                    // RETURN
+    }
+
+    *result    = value;
+    *remainder = bslstl::StringRef(p, end);
+    return 0;
+}
+
+double convertSlow(const char         *intBegin,
+                   const char         *intEnd,
+                   const char         *fracBegin,
+                   const char         *fracEnd,
+                   bsls::Types::Int64  exponent)
+    // Return the 'double' nearest to the value of the significand whose
+    // integral digits are in the range '[intBegin, intEnd)' and whose
+    // fractional digits are in the range '[fracBegin, fracEnd)', multiplied
+    // by 10 to the power of the specified 'exponent'.
+{
+    char  buffer[k_BUFFER_SIZE];
+    char *out = buffer;
+
+    bsls::Types::Int64 numDropped = 0;
+    bool               sticky     = false;
+
+    const char *ranges[2][2] = { { intBegin,  intEnd  },
+                                 { fracBegin, fracEnd } };
+    for (int i = 0; i < 2; ++i) {
+        for (const char *p = ranges[i][0]; p != ranges[i][1]; ++p) {
+            if (out == buffer && '0' == *p) {
+                continue;  // leading zero
+            }
+            if (out - buffer < k_MAX_DIGITS) {
+                *out++ = *p;
+            }
+            else {
+                ++numDropped;
+                sticky |= '0' != *p;
+            }
+        }
+    }
+
+    if (out == buffer) {
+        return 0.0;                                                   // RETURN
+    }
+
+    exponent += numDropped;
+    if (sticky) {
+        *out++ = '1';
+        --exponent;
+    }
+
+    *out++ = 'e';
+    out = bslalg::NumericFormatterUtil::toChars(out,
+                                                buffer + k_BUFFER_SIZE - 1,
+                                                exponent);
+    BSLS_ASSERT(out);
+    *out = '\0';
+
+    return bsl::strtod(buffer, 0);
+}
+
+int parseDoubleImp(double                   *result,
+                   bslstl::StringRef        *remainder,
+                   const bslstl::StringRef&  inputString)
+    // Parse the longest prefix of the specified 'inputString' that forms a
+    // floating-point number, load the nearest 'double' into the specified
+    // 'result' and the rest of 'inputString' into the specified 'remainder'.
+    // Return 0 on success, and a non-zero value with no effect otherwise.
+{
+    typedef bsl::numeric_limits<double> Limits;
+
+    const char *p   = inputString.begin();
+    const char *end = inputString.end();
+
+    bool negative = false;
+    if (p != end && ('+' == *p || '-' == *p)) {
+        negative = '-' == *p;
+        ++p;
+    }
+
+    if (p != end && !isDigit(*p) && '.' != *p) {
+        double value;
+        if (matchWord(&p, end, "inf")) {
+            matchWord(&p, end, "inity");
+            value = Limits::infinity();
+        }
+        else if (matchWord(&p, end, "nan")) {
+            value = Limits::quiet_NaN();
+        }
+        else {
+            return -1;                                                // RETURN
+        }
+        *result    = negative ? -value : value;
+        *remainder = bslstl::StringRef(p, end);
+        return 0;                                                     // RETURN
+    }
+
+    // Scan the significand, accumulating up to 'k_MAX_FAST_DIGITS'
+    // significant digits.
+
+    bsls::Types::Uint64 mantissa  = 0;
+    bsls::Types::Int64  numDigits = 0;  // significant digits
+
+    const char *intBegin = p;
+    p = scanDigits(&mantissa, &numDigits, p, end);
+    const char *intEnd = p;
+
+    const char *fracBegin = p;
+    const char *fracEnd   = p;
+    if (p != end && '.' == *p) {
+        fracBegin = ++p;
+        p = scanDigits(&mantissa, &numDigits, p, end);
+        fracEnd = p;
+    }
+
+    if (intBegin == intEnd && fracBegin == fracEnd) {
+        return -1;                                                    // RETURN
+    }
+
+    // Scan the exponent, if it is well-formed; otherwise the number ends
+    // before the 'e'.
+
+    bsls::Types::Int64 exponent = 0;
+    if (p != end && ('e' == *p || 'E' == *p)) {
+        const char *q = p + 1;
+        bool        negativeExponent = false;
+        if (q != end && ('+' == *q || '-' == *q)) {
+            negativeExponent = '-' == *q;
+            ++q;
+        }
+        if (q != end && isDigit(*q)) {
+            for (; q != end && isDigit(*q); ++q) {
+                if (exponent < k_MAX_EXPONENT) {
+                    exponent = exponent * 10 + (*q - '0');
+                }
+            }
+            if (negativeExponent) {
+                exponent = -exponent;
+            }
+            p = q;
+        }
+    }
+    exponent -= fracEnd - fracBegin;
+
+    double value;
+    if (0 == numDigits) {
+        value = 0.0;
+    }
+#ifdef BDLB_NUMERICPARSEUTIL_FAST_PATH
+    else if (numDigits <= k_MAX_FAST_DIGITS
+          && mantissa  <= (1ULL << 53)
+          && exponent  >= -k_MAX_FAST_EXPONENT
+          && exponent  <=  k_MAX_FAST_EXPONENT) {
+        value = static_cast<double>(mantissa);
+        if (exponent >= 0) {
+            value *= k_POWERS_OF_10[exponent];
+        }
+        else {
+            value /= k_POWERS_OF_10[-exponent];
+        }
+    }
+#endif
+    else {
+        value = convertSlow(intBegin, intEnd, fracBegin, fracEnd, exponent);
+        if (value > Limits::max()) {
+            return -2;                                                // RETURN
+        }
+    }
+
+    *result    = negative ? -value : value;
+    *remainder = bslstl::StringRef(p, end);
+    return 0;
+}
+
+inline
+int parseInteger(int                      *result,
+                 bslstl::StringRef        *remainder,
+                 const bslstl::StringRef&  inputString,
+                 int                       base)
+{
+    return parseSigned<int, unsigned int>(result,
+                                          remainder,
+                                          inputString,
+                                          base);
+}
+
+inline
+int parseInteger(bsls::Types::Int64       *result,
+                 bslstl::StringRef        *remainder,
+                 const bslstl::StringRef&  inputString,
+                 int                       base)
+{
+    return parseSigned<bsls::Types::Int64, bsls::Types::Uint64>(result,
+                                                                remainder,
+                                                                inputString,
+                                                                base);
+}
+
+inline
+int parseInteger(unsigned int             *result,
+                 bslstl::StringRef        *remainder,
+                 const bslstl::StringRef&  inputString,
+                 int                       base)
+{
+    return parseUnsigned(result, remainder, inputString, base);
+}
+
+inline
+int parseInteger(bsls::Types::Uint64      *result,
+                 bslstl::StringRef        *remainder,
+                 const bslstl::StringRef&  inputString,
+                 int                       base)
+    // Parse the longest prefix of the specified 'inputString' that forms an
+    // integer in the specified 'base', load its value into the specified
+    // 'result' and the rest of 'inputString' into the specified 'remainder'.
+    // Return 0 on success, and a non-zero value with no effect otherwise.
+{
+    return parseUnsigned(result, remainder, inputString, base);
+}
+
+template <class TYPE>
+int parseAll(TYPE                     *result,
+             const bslstl::StringRef&  inputString,
+             int                       base)
+    // Parse the specified 'inputString' as an integer in the specified
+    // 'base', and load its value into the specified 'result' if the whole of
+    // 'inputString' was consumed.  Return 0 on success, and a non-zero value
+    // with no effect otherwise.
+{
+    TYPE              value;
+    bslstl::StringRef remainder;
+
+    if (0 != parseInteger(&value, &remainder, inputString, base)) {
+        return -1;                                                    // RETURN
+    }
+    if (!remainder.isEmpty()) {
+        return -3;                                                    // RETURN
+    }
+
+    *result = value;
+    return 0;
+}
+
+}  // close unnamed namespace
+
+                          // -----------------------
+                          // struct NumericParseUtil
+                          // -----------------------
+
+// CLASS METHODS
+int NumericParseUtil::parseDouble(double                   *result,
+                                  bslstl::StringRef        *remainder,
+                                  const bslstl::StringRef&  inputString)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(remainder);
+
+    return parseDoubleImp(result, remainder, inputString);
+}
+
+int NumericParseUtil::parseDouble(double                   *result,
+                                  const bslstl::StringRef&  inputString)
+{
+    BSLS_ASSERT(result);
+
+    double            value;
+    bslstl::StringRef remainder;
+
+    if (0 != parseDoubleImp(&value, &remainder, inputString)) {
+        return -1;                                                    // RETURN
+    }
+    if (!remainder.isEmpty()) {
+        return -3;                                                    // RETURN
+    }
+
+    *result = value;
+    return 0;
+}
+
+int NumericParseUtil::parseInt(int                      *result,
+                               bslstl::StringRef        *remainder,
+                               const bslstl::StringRef&  inputString,
+                               int                       base)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(remainder);
+    BSLS_ASSERT(2 <= base);
+    BSLS_ASSERT(base <= 36);
+
+    return parseInteger(result, remainder, inputString, base);
+}
+
+int NumericParseUtil::parseInt64(bsls::Types::Int64       *result,
+                                 bslstl::StringRef        *remainder,
+                                 const bslstl::StringRef&  inputString,
+                                 int                       base)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(remainder);
+    BSLS_ASSERT(2 <= base);
+    BSLS_ASSERT(base <= 36);
+
+    return parseInteger(result, remainder, inputString, base);
+}
+
+int NumericParseUtil::parseUint(unsigned int             *result,
+                                bslstl::StringRef        *remainder,
+                                const bslstl::StringRef&  inputString,
+                                int                       base)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(remainder);
+    BSLS_ASSERT(2 <= base);
+    BSLS_ASSERT(base <= 36);
+
+    return parseInteger(result, remainder, inputString, base);
+}
+
+int NumericParseUtil::parseUint64(bsls::Types::Uint64      *result,
+                                  bslstl::StringRef        *remainder,
+                                  const bslstl::StringRef&  inputString,
+                                  int                       base)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(remainder);
+    BSLS_ASSERT(2 <= base);
+    BSLS_ASSERT(base <= 36);
+
+    return parseInteger(result, remainder, inputString, base);
+}
+
+int NumericParseUtil::parseInt(int                      *result,
+                               const bslstl::StringRef&  inputString,
+                               int                       base)
+{
+    BSLS_ASSERT(result);
+
+    return parseAll(result, inputString, base);
+}
+
+int NumericParseUtil::parseInt64(bsls::Types::Int64       *result,
+                                 const bslstl::StringRef&  inputString,
+                                 int                       base)
+{
+    BSLS_ASSERT(result);
+
+    return parseAll(result, inputString, base);
+}
+
+int NumericParseUtil::parseUint(unsigned int             *result,
+                                const bslstl::StringRef&  inputString,
+                                int                       base)
+{
+    BSLS_ASSERT(result);
+
+    return parseAll(result, inputString, base);
+}
+
+int NumericParseUtil::parseUint64(bsls::Types::Uint64      *result,
+                                  const bslstl::StringRef&  inputString,
+                                  int                       base)
+{
+    BSLS_ASSERT(result);
+
+    return parseAll(result, inputString, base);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
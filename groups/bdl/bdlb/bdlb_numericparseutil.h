@@ -0,0 +1,201 @@
+// bdlb_numericparseutil.h                                            -*-C++-*-
+#ifndef INCLUDED_BDLB_NUMERICPARSEUTIL
+#define INCLUDED_BDLB_NUMERICPARSEUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide conversions from text to numeric values.
+//
+//@CLASSES:
+//  bdlb::NumericParseUtil: namespace for parsing numbers from strings
+//
+//@SEE_ALSO: bslalg_numericformatterutil
+//
+//@DESCRIPTION: This component provides a namespace 'struct',
+// 'bdlb::NumericParseUtil', containing functions that parse integral and
+// 'double' values from a 'bslstl::StringRef', in the manner of the C++17
+// 'std::from_chars' functions.  The input need not be null-terminated, and
+// the functions neither allocate memory nor consult the current locale.
+//
+// Each function comes in two forms.  The form taking a 'remainder' parses the
+// longest prefix of the input that forms a number, and loads the rest of the
+// input into 'remainder'; the form without one succeeds only if the entire
+// input forms a number.  Every function returns 0 on success, and a non-zero
+// value, with no effect on its output arguments, if no number could be parsed
+// or if the number is not representable in the result type.
+//
+///Syntax
+///------
+// An integer consists of an optional sign, followed by one or more digits in
+// the specified base (10 by default), where the letters 'a' to 'z' (in either
+// case) stand for the digits 10 to 35.  A '-' sign is accepted only for
+// signed result types.  Neither leading white space nor a radix prefix such
+// as '0x' is accepted.
+//
+// A floating-point number consists of an optional sign, followed either by a
+// decimal significand ('123', '123.', '123.45', or '.45') with an optional
+// exponent ('e' or 'E', an optional sign, and one or more digits), or by one
+// of the (case-insensitive) words 'inf', 'infinity', or 'nan'.  The result is
+// the 'double' nearest to the exact value of the input (rounding ties to
+// even).  An input whose magnitude is too large for a 'double' is an error;
+// an input too small is parsed as a subnormal value or as zero.
+//
+///Performance
+///-----------
+// Integers are parsed in a single pass.  A decimal floating-point input with
+// at most 19 significant digits whose value is exactly 'm * 10^e', for an
+// integer 'm < 2^53' and '|e| <= 22', is converted with a single
+// floating-point multiplication or division, which is exact and therefore
+// correctly rounded; this covers typical prices and measurements.  Other
+// inputs are reduced to a canonical, locale-independent form in a buffer on
+// the stack and converted by 'strtod'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Parsing the Fields of a CSV Record
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a CSV record holds an identifier and a price.  We parse each field
+// in turn, using the remainder of each parse to find the next field.
+//
+// First, we define the record:
+//..
+//  bslstl::StringRef record("1042,101.25");
+//..
+// Then, we parse the identifier, which is followed by a comma:
+//..
+//  int               identifier;
+//  bslstl::StringRef rest;
+//
+//  int rc = bdlb::NumericParseUtil::parseInt(&identifier, &rest, record);
+//  assert(0    == rc);
+//  assert(1042 == identifier);
+//  assert(','  == rest[0]);
+//..
+// Finally, we parse the price, which must occupy the rest of the record:
+//..
+//  double price;
+//
+//  rc = bdlb::NumericParseUtil::parseDouble(
+//                                      &price,
+//                                      bslstl::StringRef(rest.begin() + 1,
+//                                                        rest.end()));
+//  assert(0      == rc);
+//  assert(101.25 == price);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_STRING
+#include <bsl_string.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlb {
+
+                          // =======================
+                          // struct NumericParseUtil
+                          // =======================
+
+struct NumericParseUtil {
+    // This 'struct' provides a namespace for functions that parse numeric
+    // values from strings.
+
+    // CLASS METHODS
+    static int parseDouble(double                   *result,
+                           bslstl::StringRef        *remainder,
+                           const bslstl::StringRef&  inputString);
+        // Parse the longest prefix of the specified 'inputString' that forms
+        // a floating-point number (see {Syntax}), load the 'double' nearest
+        // to its value into the specified 'result', and load the rest of
+        // 'inputString' into the specified 'remainder'.  Return 0 on success,
+        // and a non-zero value, with no effect on 'result' or 'remainder', if
+        // no prefix of 'inputString' forms a floating-point number or if its
+        // magnitude is too large to be represented.
+
+    static int parseDouble(double                   *result,
+                           const bslstl::StringRef&  inputString);
+        // Parse the specified 'inputString' as a floating-point number (see
+        // {Syntax}) and load the 'double' nearest to its value into the
+        // specified 'result'.  Return 0 on success, and a non-zero value, with
+        // no effect on 'result', if 'inputString' does not form a
+        // floating-point number or if its magnitude is too large to be
+        // represented.
+
+    static int parseInt(int                      *result,
+                        bslstl::StringRef        *remainder,
+                        const bslstl::StringRef&  inputString,
+                        int                       base = 10);
+    static int parseInt64(bsls::Types::Int64       *result,
+                          bslstl::StringRef        *remainder,
+                          const bslstl::StringRef&  inputString,
+                          int                       base = 10);
+    static int parseUint(unsigned int             *result,
+                         bslstl::StringRef        *remainder,
+                         const bslstl::StringRef&  inputString,
+                         int                       base = 10);
+    static int parseUint64(bsls::Types::Uint64      *result,
+                           bslstl::StringRef        *remainder,
+                           const bslstl::StringRef&  inputString,
+                           int                       base = 10);
+        // Parse the longest prefix of the specified 'inputString' that forms
+        // an integer in the optionally specified 'base' (see {Syntax}), load
+        // its value into the specified 'result', and load the rest of
+        // 'inputString' into the specified 'remainder'.  If 'base' is not
+        // specified, 10 is used.  Return 0 on success, and a non-zero value,
+        // with no effect on 'result' or 'remainder', if no prefix of
+        // 'inputString' forms an integer or if its value cannot be represented
+        // by the type of 'result'.  The behavior is undefined unless
+        // '2 <= base <= 36'.
+
+    static int parseInt(int                      *result,
+                        const bslstl::StringRef&  inputString,
+                        int                       base = 10);
+    static int parseInt64(bsls::Types::Int64       *result,
+                          const bslstl::StringRef&  inputString,
+                          int                       base = 10);
+    static int parseUint(unsigned int             *result,
+                         const bslstl::StringRef&  inputString,
+                         int                       base = 10);
+    static int parseUint64(bsls::Types::Uint64      *result,
+                           const bslstl::StringRef&  inputString,
+                           int                       base = 10);
+        // Parse the specified 'inputString' as an integer in the optionally
+        // specified 'base' (see {Syntax}) and load its value into the
+        // specified 'result'.  If 'base' is not specified, 10 is used.  Return
+        // 0 on success, and a non-zero value, with no effect on 'result', if
+        // 'inputString' does not form an integer or if its value cannot be
+        // represented by the type of 'result'.  The behavior is undefined
+        // unless '2 <= base <= 36'.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,906 @@
+// bdlb_numericparseutil.t.cpp                                        -*-C++-*-
+#include <bdlb_numericparseutil.h>
+
+#include <bdls_testutil.h>
+
+#include <bslalg_numericformatterutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides pure functions that parse a prefix of a
+// string.  Each function is tested with a table of inputs covering the
+// accepted syntax, the boundaries of the result type, and malformed input,
+// checking the return code, the result, and the remainder, and checking that
+// the outputs are unmodified on failure.  'parseDouble' is additionally
+// checked to agree exactly with 'strtod' on a large number of pseudo-random
+// inputs, including inputs with far more significant digits than a 'double'
+// can hold, and to recover every value written by
+// 'bslalg::NumericFormatterUtil'.  No test allocates memory.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] int parseDouble(double *, StringRef *, const StringRef&);
+// [ 3] int parseDouble(double *, const StringRef&);
+// [ 2] int parseInt(int *, StringRef *, const StringRef&, int);
+// [ 2] int parseInt64(Int64 *, StringRef *, const StringRef&, int);
+// [ 2] int parseUint(unsigned *, StringRef *, const StringRef&, int);
+// [ 2] int parseUint64(Uint64 *, StringRef *, const StringRef&, int);
+// [ 2] int parseInt(int *, const StringRef&, int);
+// [ 2] int parseInt64(Int64 *, const StringRef&, int);
+// [ 2] int parseUint(unsigned *, const StringRef&, int);
+// [ 2] int parseUint64(Uint64 *, const StringRef&, int);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlb::NumericParseUtil Util;
+typedef bsls::Types::Int64     Int64;
+typedef bsls::Types::Uint64    Uint64;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+Uint64 nextRandom(Uint64 *state)
+    // Advance the specified 'state' of a xorshift pseudo-random generator and
+    // return the next value of the sequence.
+{
+    Uint64 x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return *state = x;
+}
+
+bool sameBits(double lhs, double rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have the same object
+    // representation, and 'false' otherwise.  Note that, unlike 'operator==',
+    // this distinguishes '0.0' from '-0.0'.
+{
+    return 0 == memcmp(&lhs, &rhs, sizeof lhs);
+}
+
+bool isNegative(double value)
+    // Return 'true' if the sign bit of the specified 'value' is set, and
+    // 'false' otherwise.
+{
+    Uint64 bits;
+    memcpy(&bits, &value, sizeof bits);
+    return 0 != (bits >> 63);
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator         defaultAllocator("default",
+                                                  veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Parsing the Fields of a CSV Record
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a CSV record holds an identifier and a price.  We parse each field
+// in turn, using the remainder of each parse to find the next field.
+//
+// First, we define the record:
+//..
+    bslstl::StringRef record("1042,101.25");
+//..
+// Then, we parse the identifier, which is followed by a comma:
+//..
+    int               identifier;
+    bslstl::StringRef rest;
+
+    int rc = bdlb::NumericParseUtil::parseInt(&identifier, &rest, record);
+    ASSERT(0    == rc);
+    ASSERT(1042 == identifier);
+    ASSERT(','  == rest[0]);
+//..
+// Finally, we parse the price, which must occupy the rest of the record:
+//..
+    double price;
+
+    rc = bdlb::NumericParseUtil::parseDouble(
+                                        &price,
+                                        bslstl::StringRef(rest.begin() + 1,
+                                                          rest.end()));
+    ASSERT(0      == rc);
+    ASSERT(101.25 == price);
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // PARSING 'double' VALUES
+        //
+        // Concerns:
+        //: 1 Every documented form of significand and exponent is accepted,
+        //:   and the longest valid prefix is consumed; in particular, an 'e'
+        //:   not followed by a well-formed exponent is not consumed.
+        //:
+        //: 2 'inf', 'infinity', and 'nan' are recognized in any case, with
+        //:   an optional sign.
+        //:
+        //: 3 Input without a significand, or whose magnitude overflows a
+        //:   'double', is rejected with no effect on the outputs; input that
+        //:   underflows yields a subnormal value or a zero of the right sign.
+        //:
+        //: 4 The result is the 'double' nearest to the input, as computed by
+        //:   'strtod', both for inputs taking the fast path and for inputs
+        //:   with more significant digits than are passed to 'strtod'.
+        //:
+        //: 5 Every value written by 'bslalg::NumericFormatterUtil' is
+        //:   recovered exactly.
+        //:
+        //: 6 The overload without a remainder rejects trailing characters.
+        //:
+        //: 7 No memory is allocated.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, parse a set of inputs covering
+        //:   the syntax, the special values, and the limits of 'double', and
+        //:   verify the return code, the result, and the length of the
+        //:   remainder; on failure verify that neither output was modified.
+        //:   Parse each input with the other overload, and verify that it
+        //:   succeeds exactly when the whole input is consumed.  (C-1..3, 6)
+        //:
+        //: 2 Parse the exact decimal value of the smallest subnormal halfway
+        //:   point, alone, followed by further zeros, and followed by a
+        //:   non-zero digit beyond 'strtod's precision limit.  (C-4)
+        //:
+        //: 3 Parse a large number of pseudo-random decimal strings having
+        //:   between 1 and 60 digits and exponents throughout the range of
+        //:   'double', and compare the result bitwise with that of 'strtod'.
+        //:   (C-4)
+        //:
+        //: 4 Format a large number of 'double' values having pseudo-random
+        //:   bit patterns with 'bslalg::NumericFormatterUtil', parse the
+        //:   result, and compare bitwise.  (C-5)
+        //:
+        //: 5 Verify that the default allocator was not used.  (C-7)
+        //
+        // Testing:
+        //   int parseDouble(double *, StringRef *, const StringRef&);
+        //   int parseDouble(double *, const StringRef&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PARSING 'double' VALUES" << endl
+                          << "=======================" << endl;
+
+        const double INF = numeric_limits<double>::infinity();
+        const double MAX = numeric_limits<double>::max();
+        const double MIN = numeric_limits<double>::denorm_min();
+
+        if (verbose) cout << "\nTesting table of inputs." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_input;
+                int         d_success;    // 1 if a number is parsed
+                double      d_expected;
+                int         d_remaining;  // length of the remainder
+            } DATA[] = {
+                //LINE  INPUT                        OK  EXPECTED  REM
+                //----  ---------------------------  --  --------  ---
+                { L_,   "",                          0,  0,        0 },
+                { L_,   "+",                         0,  0,        0 },
+                { L_,   "-",                         0,  0,        0 },
+                { L_,   ".",                         0,  0,        0 },
+                { L_,   "e5",                        0,  0,        0 },
+                { L_,   " 1",                        0,  0,        0 },
+                { L_,   "in",                        0,  0,        0 },
+                { L_,   "1e309",                     0,  0,        0 },
+                { L_,   "-1e309",                    0,  0,        0 },
+                { L_,   "17976931348623159e292",     0,  0,        0 },
+
+                { L_,   "0",                         1,  0.0,      0 },
+                { L_,   "-0",                        1,  -0.0,     0 },
+                { L_,   "+0.000",                    1,  0.0,      0 },
+                { L_,   "0e999999999999999999999",   1,  0.0,      0 },
+                { L_,   "1",                         1,  1.0,      0 },
+                { L_,   "-1",                        1,  -1.0,     0 },
+                { L_,   "1.",                        1,  1.0,      0 },
+                { L_,   ".5",                        1,  0.5,      0 },
+                { L_,   "-.5",                       1,  -0.5,     0 },
+                { L_,   "101.25",                    1,  101.25,   0 },
+                { L_,   "0.1",                       1,  0.1,      0 },
+                { L_,   "1e3",                       1,  1000.0,   0 },
+                { L_,   "1E+3",                      1,  1000.0,   0 },
+                { L_,   "1500e-3",                   1,  1.5,      0 },
+                { L_,   "1e",                        1,  1.0,      1 },
+                { L_,   "1e+",                       1,  1.0,      2 },
+                { L_,   "1e-x",                      1,  1.0,      3 },
+                { L_,   "1.5,2",                     1,  1.5,      2 },
+                { L_,   "2..5",                      1,  2.0,      2 },
+                { L_,   "7x",                        1,  7.0,      1 },
+                { L_,   "1e22",                      1,  1e22,     0 },
+                { L_,   "1e23",                      1,  1e23,     0 },
+                { L_,   "9007199254740993",          1,  9007199254740992.0,
+                                                                   0 },
+                { L_,   "1e-400",                    1,  0.0,      0 },
+                { L_,   "-1e-400",                   1,  -0.0,     0 },
+                { L_,   "4.9406564584124654e-324",   1,  MIN,      0 },
+                { L_,   "2.4703282292062328e-324",   1,  MIN,      0 },
+                { L_,   "1.7976931348623157e308",    1,  MAX,      0 },
+                { L_,   "17976931348623158e292",     1,  MAX,      0 },
+                { L_,   "0.000000000000000000000000000000000000000001e42",
+                                                     1,  1.0,      0 },
+                { L_,   "inf",                       1,  INF,      0 },
+                { L_,   "-INF",                      1,  -INF,     0 },
+                { L_,   "+Infinity",                 1,  INF,      0 },
+                { L_,   "infinit",                   1,  INF,      4 },
+                { L_,   "infinityx",                 1,  INF,      1 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE      = DATA[ti].d_line;
+                const char *const INPUT     = DATA[ti].d_input;
+                const bool        SUCCESS   = DATA[ti].d_success;
+                const double      EXPECTED  = DATA[ti].d_expected;
+                const int         REMAINING = DATA[ti].d_remaining;
+
+                if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+                const bslstl::StringRef INITIAL("initial");
+
+                double            result    = 42.0;
+                bslstl::StringRef remainder = INITIAL;
+
+                int rc = Util::parseDouble(&result, &remainder, INPUT);
+                ASSERTV(LINE, SUCCESS == (0 == rc));
+                if (SUCCESS) {
+                    ASSERTV(LINE, result, sameBits(EXPECTED, result));
+                    ASSERTV(LINE, REMAINING == (int)remainder.length());
+                    ASSERTV(LINE, remainder.end() == INPUT + strlen(INPUT));
+                }
+                else {
+                    ASSERTV(LINE, 42.0 == result);
+                    ASSERTV(LINE, INITIAL.data() == remainder.data());
+                }
+
+                result = 42.0;
+                rc     = Util::parseDouble(&result, INPUT);
+                ASSERTV(LINE, (SUCCESS && 0 == REMAINING) == (0 == rc));
+                if (0 == rc) {
+                    ASSERTV(LINE, result, sameBits(EXPECTED, result));
+                }
+                else {
+                    ASSERTV(LINE, 42.0 == result);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting NaN." << endl;
+        {
+            static const char *const DATA[] = { "nan", "NaN", "+nan", "-NAN" };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                double result = 0.0;
+                ASSERTV(DATA[ti], 0 == Util::parseDouble(&result, DATA[ti]));
+                ASSERTV(DATA[ti], result != result);
+                ASSERTV(DATA[ti], ('-' == DATA[ti][0]) == isNegative(result));
+            }
+        }
+
+        if (verbose) cout << "\nTesting very long significands." << endl;
+        {
+            // The exact decimal value of '2^-1075', halfway between 0 and the
+            // smallest subnormal value: rounding to even yields 0.
+
+            const char HALFWAY[] =
+                "2.470328229206232720882843964341106861825299013071623822127"
+                "92841250337753635104375932649918180817996189898282347722858"
+                "86546332835517796989819938739800539093906315035659515570226"
+                "39229085839244910518443593180284993653615250031937045767824"
+                "92193656236698636584807570015857692699037063119282795585513"
+                "32927834338409351978015531246597263579574622766465272827220"
+                "05637400648549997709659947045402082816622623785739345073633"
+                "90079677619305775067401763246736009689513405355374585166611"
+                "34223766678604162159680461914467291840300530057530849048765"
+                "39171138659164623952491262365388187963623937328042389101867"
+                "23484976682350898633885879256283027559956575244555072551893"
+                "13690836254779186948667994968324049705821028513185451396213"
+                "837722826145437693412532098591327667236328125e-324";
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+            string               input(HALFWAY, &sa);
+
+            double result = 1.0;
+            ASSERT(0 == Util::parseDouble(&result, input));
+            ASSERT(sameBits(0.0, result));
+
+            input.insert(input.size() - 5, 2000, '0');
+            result = 1.0;
+            ASSERT(0 == Util::parseDouble(&result, input));
+            ASSERT(sameBits(0.0, result));
+
+            input.insert(input.size() - 5, 1, '1');
+            result = 1.0;
+            ASSERT(0 == Util::parseDouble(&result, input));
+            ASSERT(MIN == result);
+
+            input.assign("0.");
+            input.append(5000, '0');
+            input.append("1e5000");
+            ASSERT(0 == Util::parseDouble(&result, input));
+            ASSERT(0.1 == result);
+        }
+
+        if (verbose) cout << "\nTesting pseudo-random decimal strings."
+                          << endl;
+        {
+            const int NUM_VALUES = veryVeryVerbose ? 10000000 : 200000;
+
+            Uint64 state = 0x9e3779b97f4a7c15ULL;
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                char  buffer[128];
+                char *p = buffer;
+
+                if (nextRandom(&state) & 1) {
+                    *p++ = '-';
+                }
+                const int numDigits   = 1 + nextRandom(&state) % 60;
+                const int pointBefore = nextRandom(&state) % (numDigits + 1);
+                for (int d = 0; d < numDigits; ++d) {
+                    if (d == pointBefore) {
+                        *p++ = '.';
+                    }
+                    *p++ = static_cast<char>('0' + nextRandom(&state) % 10);
+                }
+                p += sprintf(p,
+                             "e%d",
+                             static_cast<int>(nextRandom(&state) % 700) - 350);
+
+                const double EXPECTED = strtod(buffer, 0);
+
+                double rc_result;
+                int    rc = Util::parseDouble(&rc_result,
+                                              bslstl::StringRef(buffer, p));
+                if (EXPECTED > MAX || EXPECTED < -MAX) {
+                    ASSERTV(buffer, 0 != rc);
+                }
+                else {
+                    ASSERTV(buffer, 0 == rc);
+                    ASSERTV(buffer, sameBits(EXPECTED, rc_result));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting round trip from 'toChars'." << endl;
+        {
+            typedef bslalg::NumericFormatterUtil Formatter;
+
+            const int NUM_VALUES = veryVeryVerbose ? 10000000 : 200000;
+
+            Uint64 state = 0x0123456789abcdefULL;
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                const Uint64 BITS = nextRandom(&state);
+
+                double value;
+                memcpy(&value, &BITS, sizeof value);
+                if (value != value) {
+                    continue;
+                }
+
+                char        buffer[Formatter::k_MAX_LENGTH_DOUBLE];
+                const char *end = Formatter::toChars(buffer,
+                                                     buffer + sizeof buffer,
+                                                     value);
+                ASSERTV(i, end);
+
+                double result;
+                ASSERTV(i, 0 == Util::parseDouble(
+                                          &result,
+                                          bslstl::StringRef(buffer, end)));
+                ASSERTV(i, sameBits(value, result));
+            }
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PARSING INTEGRAL VALUES
+        //
+        // Concerns:
+        //: 1 Digits in every base from 2 to 36 are accepted in either case,
+        //:   with an optional sign, and the longest valid prefix is consumed.
+        //:
+        //: 2 The extreme values of each type are accepted, and values one
+        //:   beyond them are rejected with no effect on the outputs.
+        //:
+        //: 3 A '-' sign is rejected for unsigned types, and input without
+        //:   digits is rejected, with no effect on the outputs.
+        //:
+        //: 4 The overloads without a remainder reject trailing characters.
+        //:
+        //: 5 No memory is allocated.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, parse a set of inputs with each
+        //:   of the four functions, and verify the return code, the result,
+        //:   and the length of the remainder, where the expected value of
+        //:   each function is determined by whether the expected value
+        //:   (held as a sign and a 'Uint64' magnitude) is in the range of its
+        //:   result type.  Parse each input with the overloads without a
+        //:   remainder.  (C-1..4)
+        //:
+        //: 2 Verify that the default allocator was not used.  (C-5)
+        //
+        // Testing:
+        //   int parseInt(int *, StringRef *, const StringRef&, int);
+        //   int parseInt64(Int64 *, StringRef *, const StringRef&, int);
+        //   int parseUint(unsigned *, StringRef *, const StringRef&, int);
+        //   int parseUint64(Uint64 *, StringRef *, const StringRef&, int);
+        //   int parseInt(int *, const StringRef&, int);
+        //   int parseInt64(Int64 *, const StringRef&, int);
+        //   int parseUint(unsigned *, const StringRef&, int);
+        //   int parseUint64(Uint64 *, const StringRef&, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PARSING INTEGRAL VALUES" << endl
+                          << "=======================" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_input;
+            int         d_base;
+            int         d_valid;      // 1 if digits are present
+            bool        d_negative;
+            Uint64      d_magnitude;
+            int         d_remaining;  // length of the remainder
+        } DATA[] = {
+            //LINE INPUT                   BASE  OK  NEG    MAGNITUDE    REM
+            //---- ----------------------  ----  --  -----  -----------  ---
+            { L_,  "",                     10,   0,  false, 0,           0 },
+            { L_,  "+",                    10,   0,  false, 0,           0 },
+            { L_,  "-",                    10,   0,  false, 0,           0 },
+            { L_,  "x1",                   10,   0,  false, 0,           0 },
+            { L_,  " 1",                   10,   0,  false, 0,           0 },
+            { L_,  "+-1",                  10,   0,  false, 0,           0 },
+            { L_,  "2",                     2,   0,  false, 0,           0 },
+
+            { L_,  "0",                    10,   1,  false, 0,           0 },
+            { L_,  "-0",                   10,   1,  true,  0,           0 },
+            { L_,  "007",                  10,   1,  false, 7,           0 },
+            { L_,  "+42",                  10,   1,  false, 42,          0 },
+            { L_,  "-42",                  10,   1,  true,  42,          0 },
+            { L_,  "1042,101.25",          10,   1,  false, 1042,        7 },
+            { L_,  "12ab",                 10,   1,  false, 12,          2 },
+            { L_,  "12ab",                 16,   1,  false, 0x12ab,      0 },
+            { L_,  "-BeEf",                16,   1,  true,  0xbeef,      0 },
+            { L_,  "0x1f",                 16,   1,  false, 0,           3 },
+            { L_,  "1012",                  2,   1,  false, 5,           1 },
+            { L_,  "777",                   8,   1,  false, 511,         0 },
+            { L_,  "zZ",                   36,   1,  false, 1295,        0 },
+            { L_,  "2147483647",           10,   1,  false, 2147483647,  0 },
+            { L_,  "-2147483648",          10,   1,  true,  2147483648u, 0 },
+            { L_,  "2147483648",           10,   1,  false, 2147483648u, 0 },
+            { L_,  "-2147483649",          10,   1,  true,  2147483649u, 0 },
+            { L_,  "4294967295",           10,   1,  false, 4294967295u, 0 },
+            { L_,  "4294967296",           10,   1,  false, 4294967296LL,0 },
+            { L_,  "ffffffff",             16,   1,  false, 0xffffffffu, 0 },
+            { L_,  "9223372036854775807",  10,   1,  false,
+                                                  9223372036854775807ULL,  0 },
+            { L_,  "-9223372036854775808", 10,   1,  true,
+                                                  9223372036854775808ULL,  0 },
+            { L_,  "9223372036854775808",  10,   1,  false,
+                                                  9223372036854775808ULL,  0 },
+            { L_,  "18446744073709551615", 10,   1,  false,
+                                                 18446744073709551615ULL,  0 },
+            { L_,  "ffffffffffffffff",     16,   1,  false,
+                                                 18446744073709551615ULL,  0 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        // Inputs whose magnitude overflows 'Uint64' are rejected by every
+        // function.
+
+        static const char *const OVERFLOW_DATA[] = {
+            "18446744073709551616",
+            "-18446744073709551616",
+            "10000000000000000",  // base 16
+            "99999999999999999999999999",
+        };
+        const int NUM_OVERFLOW_DATA =
+                                 sizeof OVERFLOW_DATA / sizeof *OVERFLOW_DATA;
+
+        const bslstl::StringRef INITIAL("initial");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE      = DATA[ti].d_line;
+            const char *const INPUT     = DATA[ti].d_input;
+            const int         BASE      = DATA[ti].d_base;
+            const bool        VALID     = DATA[ti].d_valid;
+            const bool        NEGATIVE  = DATA[ti].d_negative;
+            const Uint64      MAGNITUDE = DATA[ti].d_magnitude;
+            const int         REMAINING = DATA[ti].d_remaining;
+
+            if (veryVerbose) { T_ P_(LINE) P_(INPUT) P(BASE) }
+
+            const bool WHOLE = VALID && 0 == REMAINING;
+
+            // 'Int64' result
+
+            {
+                const bool IN_RANGE = VALID &&
+                    (NEGATIVE ? MAGNITUDE <= 9223372036854775808ULL
+                              : MAGNITUDE <= 9223372036854775807ULL);
+                const Int64 EXPECTED = NEGATIVE
+                                     ? static_cast<Int64>(0 - MAGNITUDE)
+                                     : static_cast<Int64>(MAGNITUDE);
+
+                Int64             result    = 42;
+                bslstl::StringRef remainder = INITIAL;
+
+                int rc = Util::parseInt64(&result, &remainder, INPUT, BASE);
+                ASSERTV(LINE, IN_RANGE == (0 == rc));
+                ASSERTV(LINE, (IN_RANGE ? EXPECTED : 42) == result);
+                ASSERTV(LINE, IN_RANGE ? REMAINING == (int)remainder.length()
+                                       : INITIAL.data() == remainder.data());
+
+                result = 42;
+                rc     = Util::parseInt64(&result, INPUT, BASE);
+                ASSERTV(LINE, (IN_RANGE && WHOLE) == (0 == rc));
+                ASSERTV(LINE, (IN_RANGE && WHOLE ? EXPECTED : 42) == result);
+            }
+
+            // 'int' result
+
+            {
+                const bool IN_RANGE = VALID &&
+                    (NEGATIVE ? MAGNITUDE <= 2147483648ULL
+                              : MAGNITUDE <= 2147483647ULL);
+                const unsigned LOW_BITS = static_cast<unsigned>(MAGNITUDE);
+                const int      EXPECTED = NEGATIVE
+                                        ? static_cast<int>(0 - LOW_BITS)
+                                        : static_cast<int>(LOW_BITS);
+
+                int               result    = 42;
+                bslstl::StringRef remainder = INITIAL;
+
+                int rc = Util::parseInt(&result, &remainder, INPUT, BASE);
+                ASSERTV(LINE, IN_RANGE == (0 == rc));
+                ASSERTV(LINE, (IN_RANGE ? EXPECTED : 42) == result);
+                ASSERTV(LINE, IN_RANGE ? REMAINING == (int)remainder.length()
+                                       : INITIAL.data() == remainder.data());
+
+                result = 42;
+                rc     = Util::parseInt(&result, INPUT, BASE);
+                ASSERTV(LINE, (IN_RANGE && WHOLE) == (0 == rc));
+                ASSERTV(LINE, (IN_RANGE && WHOLE ? EXPECTED : 42) == result);
+            }
+
+            // 'Uint64' result
+
+            {
+                const bool IN_RANGE = VALID && !NEGATIVE;
+
+                Uint64            result    = 42;
+                bslstl::StringRef remainder = INITIAL;
+
+                int rc = Util::parseUint64(&result, &remainder, INPUT, BASE);
+                ASSERTV(LINE, IN_RANGE == (0 == rc));
+                ASSERTV(LINE, (IN_RANGE ? MAGNITUDE : 42) == result);
+                ASSERTV(LINE, IN_RANGE ? REMAINING == (int)remainder.length()
+                                       : INITIAL.data() == remainder.data());
+
+                result = 42;
+                rc     = Util::parseUint64(&result, INPUT, BASE);
+                ASSERTV(LINE, (IN_RANGE && WHOLE) == (0 == rc));
+                ASSERTV(LINE, (IN_RANGE && WHOLE ? MAGNITUDE : 42) == result);
+            }
+
+            // 'unsigned int' result
+
+            {
+                const bool IN_RANGE = VALID
+                                   && !NEGATIVE
+                                   && MAGNITUDE <= 4294967295ULL;
+                const unsigned EXPECTED = static_cast<unsigned>(MAGNITUDE);
+
+                unsigned          result    = 42;
+                bslstl::StringRef remainder = INITIAL;
+
+                int rc = Util::parseUint(&result, &remainder, INPUT, BASE);
+                ASSERTV(LINE, IN_RANGE == (0 == rc));
+                ASSERTV(LINE, (IN_RANGE ? EXPECTED : 42) == result);
+                ASSERTV(LINE, IN_RANGE ? REMAINING == (int)remainder.length()
+                                       : INITIAL.data() == remainder.data());
+
+                result = 42;
+                rc     = Util::parseUint(&result, INPUT, BASE);
+                ASSERTV(LINE, (IN_RANGE && WHOLE) == (0 == rc));
+                ASSERTV(LINE, (IN_RANGE && WHOLE ? EXPECTED : 42u) == result);
+            }
+        }
+
+        for (int ti = 0; ti < NUM_OVERFLOW_DATA; ++ti) {
+            const char *const INPUT = OVERFLOW_DATA[ti];
+            const int         BASE  = 2 == ti ? 16 : 10;
+
+            if (veryVerbose) { T_ P(INPUT) }
+
+            Int64    i64 = 42;
+            int      i   = 42;
+            Uint64   u64 = 42;
+            unsigned u   = 42;
+
+            bslstl::StringRef remainder = INITIAL;
+
+            ASSERTV(INPUT, 0 != Util::parseInt64( &i64, &remainder, INPUT,
+                                                 BASE));
+            ASSERTV(INPUT, 0 != Util::parseInt(   &i,   &remainder, INPUT,
+                                                 BASE));
+            ASSERTV(INPUT, 0 != Util::parseUint64(&u64, &remainder, INPUT,
+                                                 BASE));
+            ASSERTV(INPUT, 0 != Util::parseUint(  &u,   &remainder, INPUT,
+                                                 BASE));
+            ASSERTV(INPUT, 42 == i64 && 42 == i && 42 == u64 && 42 == u);
+            ASSERTV(INPUT, INITIAL.data() == remainder.data());
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Parse a few integral and 'double' values and verify the result.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        int               i;
+        double            d;
+        bslstl::StringRef remainder;
+
+        ASSERT(0  == Util::parseInt(&i, "-42"));
+        ASSERT(-42 == i);
+
+        ASSERT(0  == Util::parseInt(&i, "ff", 16));
+        ASSERT(255 == i);
+
+        ASSERT(0  != Util::parseInt(&i, "42 "));
+        ASSERT(255 == i);
+
+        ASSERT(0  == Util::parseInt(&i, &remainder, "42 "));
+        ASSERT(42 == i);
+        ASSERT(" " == remainder);
+
+        ASSERT(0   == Util::parseDouble(&d, "0.25"));
+        ASSERT(.25 == d);
+
+        ASSERT(0   != Util::parseDouble(&d, "x"));
+        ASSERT(.25 == d);
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Compare the time taken to parse integral and 'double' values with
+        //   that taken by 'strtol' and 'strtod'.
+        //
+        // Concerns:
+        //: 1 Parsing is substantially faster than the C library.
+        //
+        // Plan:
+        //: 1 Parse a set of typical inputs repeatedly with each method and
+        //:   report the average time per value.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        enum { k_ITERATIONS = 1000000 };
+
+        static const char *const INTEGERS[] = {
+            "1042", "-7", "65536", "2147483647", "31"
+        };
+        static const char *const DOUBLES[] = {
+            "101.25", "3.14159", "12345.678", "0.001", "6.02214076e23"
+        };
+        const int NUM_INPUTS = 5;
+
+        bsls::Stopwatch timer;
+        double          checksum = 0;
+
+        timer.start();
+        for (int i = 0; i < k_ITERATIONS; ++i) {
+            int value = 0;
+            Util::parseInt(&value, INTEGERS[i % NUM_INPUTS]);
+            checksum += value;
+        }
+        timer.stop();
+        cout << "parseInt:    " << timer.elapsedTime() * 1e9 / k_ITERATIONS
+             << " ns" << endl;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < k_ITERATIONS; ++i) {
+            checksum += strtol(INTEGERS[i % NUM_INPUTS], 0, 10);
+        }
+        timer.stop();
+        cout << "strtol:      " << timer.elapsedTime() * 1e9 / k_ITERATIONS
+             << " ns" << endl;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < k_ITERATIONS; ++i) {
+            double value = 0;
+            Util::parseDouble(&value, DOUBLES[i % NUM_INPUTS]);
+            checksum += value;
+        }
+        timer.stop();
+        cout << "parseDouble: " << timer.elapsedTime() * 1e9 / k_ITERATIONS
+             << " ns" << endl;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < k_ITERATIONS; ++i) {
+            checksum += strtod(DOUBLES[i % NUM_INPUTS], 0);
+        }
+        timer.stop();
+        cout << "strtod:      " << timer.elapsedTime() * 1e9 / k_ITERATIONS
+             << " ns" << endl;
+
+        if (veryVerbose) { P(checksum) }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -641,15 +641,12 @@ DecimalNumPut<CHARTYPE, OUTPUTITERATOR>::do_put(iter_type      out,
                                                 char_type      fill,
                                                 Decimal32      value) const
 {
-    char  buffer[BDLDFP_DECIMALPLATFORM_SNPRINTF_BUFFER_SIZE];
+    char buffer[BDLDFP_DECIMALPLATFORM_SNPRINTF_BUFFER_SIZE];
 
-    DenselyPackedDecimalImpUtil::StorageType32 dpdStorage;
-    dpdStorage = DecimalImpUtil::convertToDPD(*value.data());
-
-    DecimalImpUtil_DecNumber::ValueType32 dpdValue;
-    bsl::memcpy(&dpdValue, &dpdStorage, sizeof(dpdValue));
-
-    DecimalImpUtil_DecNumber::format(dpdValue, buffer);
+    const int length = DecimalImpUtil::format(buffer,
+                                              sizeof buffer - 1,
+                                              *value.data());
+    buffer[length] = 0;
 
     return doPutCommon(out, ios_format, fill, &buffer[0]);
 }
@@ -660,15 +657,12 @@ DecimalNumPut<CHARTYPE, OUTPUTITERATOR>::do_put(iter_type      out,
                                                 char_type      fill,
                                                 Decimal64      value) const
 {
-    char  buffer[BDLDFP_DECIMALPLATFORM_SNPRINTF_BUFFER_SIZE];
-
-    DenselyPackedDecimalImpUtil::StorageType64 dpdStorage;
-    dpdStorage = DecimalImpUtil::convertToDPD(*value.data());
+    char buffer[BDLDFP_DECIMALPLATFORM_SNPRINTF_BUFFER_SIZE];
 
-    DecimalImpUtil_DecNumber::ValueType64 dpdValue;
-    bsl::memcpy(&dpdValue, &dpdStorage, sizeof(dpdValue));
-
-    DecimalImpUtil_DecNumber::format(dpdValue, buffer);
+    const int length = DecimalImpUtil::format(buffer,
+                                              sizeof buffer - 1,
+                                              *value.data());
+    buffer[length] = 0;
 
     return doPutCommon(out, ios_format, fill, &buffer[0]);
 }
@@ -679,15 +673,12 @@ DecimalNumPut<CHARTYPE, OUTPUTITERATOR>::do_put(iter_type      out,
                                                 char_type      fill,
                                                 Decimal128     value) const
 {
-    char  buffer[BDLDFP_DECIMALPLATFORM_SNPRINTF_BUFFER_SIZE];
-
-    DenselyPackedDecimalImpUtil::StorageType128 dpdStorage;
-    dpdStorage = DecimalImpUtil::convertToDPD(*value.data());
-
-    DecimalImpUtil_DecNumber::ValueType128 dpdValue;
-    bsl::memcpy(&dpdValue, &dpdStorage, sizeof(dpdValue));
+    char buffer[BDLDFP_DECIMALPLATFORM_SNPRINTF_BUFFER_SIZE];
 
-    DecimalImpUtil_DecNumber::format(dpdValue, buffer);
+    const int length = DecimalImpUtil::format(buffer,
+                                              sizeof buffer - 1,
+                                              *value.data());
+    buffer[length] = 0;
 
     return doPutCommon(out, ios_format, fill, &buffer[0]);
 }
@@ -6,7 +6,11 @@ BSLS_IDENT_RCSID(bdldfp_decimalconvertutil_cpp,"$Id$ $CSID$")
 
 #include <bdldfp_decimalplatform.h>
 
+#include <bslmf_assert.h>
+
 #include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
 
 #ifdef BDLDFP_DECIMALPLATFORM_C99_TR
 #  ifndef  __STDC_WANT_DEC_FP__
@@ -19,6 +23,7 @@ BSLS_IDENT_RCSID(bdldfp_decimalconvertutil_cpp,"$Id$ $CSID$")
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <ctype.h>
+#include <float.h>
 
 namespace BloombergLP {
 namespace bdldfp {
@@ -272,6 +277,250 @@ void restoreDecimalFromBinary(DECIMAL_TYPE *dfp, BINARY_TYPE bfp)
     }
 }
 
+
+                  // Helpers for Exact Binary-Decimal Conversion
+
+typedef bsls::Types::Uint64 Uint64;
+
+// The exact conversion of a 'Decimal64' to 'double' by a single
+// multiplication or division is correctly rounded only if intermediate
+// results are not kept in a wider format (e.g., on x87), so it is disabled
+// unless 'FLT_EVAL_METHOD' is 0.
+
+#if !defined(FLT_EVAL_METHOD) || 0 == FLT_EVAL_METHOD
+#define BDLDFP_DECIMALCONVERTUTIL_FAST_PATH 1
+#endif
+
+#ifdef BDLDFP_DECIMALCONVERTUTIL_FAST_PATH
+const double k_DOUBLE_POWERS_OF_10[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+    // Powers of 10 that are exactly representable as 'double' values.
+
+const int k_MAX_EXACT_DOUBLE_POWER_OF_10 = 22;
+    // The largest exponent of 10 in 'k_DOUBLE_POWERS_OF_10'.
+
+const Uint64 k_MAX_DECIMAL64_SIGNIFICAND = 9999999999999999ULL;
+    // The largest canonical 'Decimal64' significand.  A larger encoded
+    // significand is non-canonical and represents zero.
+#endif
+
+const Uint64 k_POWERS_OF_5[] = {
+    1ULL,
+    5ULL,
+    25ULL,
+    125ULL,
+    625ULL,
+    3125ULL,
+    15625ULL,
+    78125ULL,
+    390625ULL,
+    1953125ULL,
+    9765625ULL,
+    48828125ULL,
+    244140625ULL,
+    1220703125ULL,
+    6103515625ULL,
+    30517578125ULL,
+    152587890625ULL,
+    762939453125ULL,
+    3814697265625ULL,
+    19073486328125ULL,
+    95367431640625ULL,
+    476837158203125ULL,
+    2384185791015625ULL,
+    11920928955078125ULL,
+    59604644775390625ULL,
+    298023223876953125ULL,
+    1490116119384765625ULL,
+    7450580596923828125ULL
+};
+    // Powers of 5 that are representable as 'Uint64' values.
+
+const int k_MAX_POWER_OF_5 = 27;
+    // The largest exponent of 5 in 'k_POWERS_OF_5'.
+
+const int k_DOUBLE_RESTORE_DIGITS = 15;
+    // The number of significant decimal digits of a 'double' value that are
+    // used to restore a decimal value (see 'StdioFormat<double>').
+
+const Uint64 k_MIN_RESTORED_SIGNIFICAND = 100000000000000ULL;
+const Uint64 k_MAX_RESTORED_SIGNIFICAND = 999999999999999ULL;
+    // The range of significands having 'k_DOUBLE_RESTORE_DIGITS' digits.
+
+void multiply(Uint64 *high, Uint64 *low, Uint64 lhs, Uint64 rhs)
+    // Load into the specified 'high' and 'low' the high and low 64 bits,
+    // respectively, of the 128-bit product of the specified 'lhs' and 'rhs'.
+{
+    const Uint64 lhsLow  = lhs & 0xFFFFFFFFULL;
+    const Uint64 lhsHigh = lhs >> 32;
+    const Uint64 rhsLow  = rhs & 0xFFFFFFFFULL;
+    const Uint64 rhsHigh = rhs >> 32;
+
+    const Uint64 lowLow   = lhsLow  * rhsLow;
+    const Uint64 lowHigh  = lhsLow  * rhsHigh;
+    const Uint64 highLow  = lhsHigh * rhsLow;
+    const Uint64 highHigh = lhsHigh * rhsHigh;
+
+    const Uint64 middle = (lowLow >> 32)
+                        + (lowHigh & 0xFFFFFFFFULL)
+                        + (highLow & 0xFFFFFFFFULL);
+
+    *low  = (middle << 32) | (lowLow & 0xFFFFFFFFULL);
+    *high = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+}
+
+Uint64 scaleAndRound(Uint64 significand, int binaryExponent, int power)
+    // Return the value of the specified 'significand' multiplied by 2 raised
+    // to the specified 'binaryExponent' and by 10 raised to the specified
+    // 'power', rounded to the nearest integer, with ties rounded to the even
+    // integer.  The behavior is undefined unless '0 <= power',
+    // 'power <= k_MAX_POWER_OF_5', 'significand < 2^53', and the result,
+    // before rounding, is at least 1 and less than 2^62.
+{
+    // The exact product 'significand * 5^power' has at most 116 bits; the
+    // remaining factor, '2^(binaryExponent + power)', is applied by shifting
+    // that product right, which is exact up to the rounding of the bits that
+    // are shifted out.
+
+    Uint64 high;
+    Uint64 low;
+    multiply(&high, &low, significand, k_POWERS_OF_5[power]);
+
+    // Shift one bit less than required, to retain the rounding bit in the
+    // least significant bit of 'scaled'.
+
+    const int shift = -(binaryExponent + power) - 1;
+    BSLS_ASSERT_SAFE(0 <= shift && shift < 128);
+
+    Uint64 scaled;
+    Uint64 sticky;
+    if (0 == shift) {
+        scaled = low;
+        sticky = 0;
+    }
+    else if (shift < 64) {
+        scaled = (low >> shift) | (high << (64 - shift));
+        sticky = low & ((1ULL << shift) - 1);
+    }
+    else {
+        scaled = high >> (shift - 64);
+        sticky = low | (high & ((1ULL << (shift - 64)) - 1));
+    }
+
+    const Uint64 result = scaled >> 1;
+    if ((scaled & 1) && (sticky || (result & 1))) {
+        return result + 1;                                            // RETURN
+    }
+    return result;
+}
+
+int restoreDecimal64Components(bool   *isNegative,
+                               Uint64 *significand,
+                               int    *exponent,
+                               double  binary)
+    // Load into the specified 'isNegative', 'significand', and 'exponent' the
+    // sign, significand, and (unbiased) exponent of the 'Decimal64' value
+    // that 'restoreDecimalFromBinary' creates from the specified 'binary',
+    // and return 0, if 'binary' is zero or its absolute value is between
+    // approximately 1e-13 and 1e15; otherwise, return a non-zero value with
+    // no effect on 'isNegative', 'significand', and 'exponent'.
+{
+    // 'restoreDecimalFromBinary' rounds the exact value of 'binary' to 15
+    // significant digits (using "%.15g"), and removes the trailing zeros of
+    // the fractional part of the result (only).  We do the same, computing
+    // the significant digits as 'binary * 10^power', rounded to an integer,
+    // for the 'power' that yields 15 digits.
+
+    BSLMF_ASSERT(sizeof(double) == sizeof(Uint64));
+
+    Uint64 bits;
+    bsl::memcpy(&bits, &binary, sizeof bits);
+
+    const int    biasedExponent = static_cast<int>((bits >> 52) & 0x7FF);
+    const Uint64 fraction       = bits & 0x000FFFFFFFFFFFFFULL;
+
+    if (0 == biasedExponent) {
+        if (0 != fraction) {
+            return -1;                                                // RETURN
+        }
+
+        // Zero is restored as zero having an exponent of 0 (and the sign of
+        // 'binary').
+
+        *isNegative  = 0 != (bits >> 63);
+        *significand = 0;
+        *exponent    = 0;
+        return 0;                                                     // RETURN
+    }
+    if (0x7FF == biasedExponent) {
+        return -1;                                                    // RETURN
+    }
+
+    // 'binary' has the absolute value 'binarySignificand * 2^binaryExponent',
+    // and lies in '[2^leadingExponent, 2^(leadingExponent + 1))'.
+
+    const Uint64 binarySignificand = fraction | (1ULL << 52);
+    const int    binaryExponent    = biasedExponent - 1075;
+    const int    leadingExponent   = biasedExponent - 1023;
+
+    // Estimate the decimal exponent of the leading digit of 'binary' as
+    // 'floor(leadingExponent * log10(2))', which is either exact or one less
+    // than the exact value.
+
+    const int scaledExponent = leadingExponent * 78913;  // log10(2) * 2^18
+    const int decimalExponent = scaledExponent >= 0
+                              ? scaledExponent / (1 << 18)
+                              : -((-scaledExponent + (1 << 18) - 1)
+                                                                 / (1 << 18));
+
+    int power = k_DOUBLE_RESTORE_DIGITS - 1 - decimalExponent;
+    if (power < 0 || power > k_MAX_POWER_OF_5) {
+        return -1;                                                    // RETURN
+    }
+
+    Uint64 digits = scaleAndRound(binarySignificand, binaryExponent, power);
+    if (digits > k_MAX_RESTORED_SIGNIFICAND) {
+
+        // Either the decimal exponent was underestimated, or the value is
+        // rounded up to the next power of 10.
+
+        if (0 == power) {
+            return -1;                                                // RETURN
+        }
+        --power;
+        digits = scaleAndRound(binarySignificand, binaryExponent, power);
+    }
+    BSLS_ASSERT_SAFE(k_MIN_RESTORED_SIGNIFICAND <= digits);
+    BSLS_ASSERT_SAFE(digits <= k_MAX_RESTORED_SIGNIFICAND);
+
+    // Remove the trailing zeros of the fractional part.  Note that a value of
+    // 15 digits has at most 14 trailing zeros.
+
+    if (power >= 8 && 0 == digits % 100000000) {
+        digits /= 100000000;
+        power  -= 8;
+    }
+    if (power >= 4 && 0 == digits % 10000) {
+        digits /= 10000;
+        power  -= 4;
+    }
+    if (power >= 2 && 0 == digits % 100) {
+        digits /= 100;
+        power  -= 2;
+    }
+    if (power >= 1 && 0 == digits % 10) {
+        digits /= 10;
+        power  -= 1;
+    }
+
+    *isNegative  = 0 != (bits >> 63);
+    *significand = digits;
+    *exponent    = -power;
+    return 0;
+}
+
 }  // close unnamed namespace
 
                         // Network format converters
@@ -375,6 +624,48 @@ const unsigned char *DecimalConvertUtil::decimalFromNetwork(
     return decimalFromNetworkT(decimal, buffer);
 }
 
+                        // decimalToDouble functions
+
+double DecimalConvertUtil::decimal64ToDouble(Decimal64 decimal)
+{
+#ifdef BDLDFP_DECIMALCONVERTUTIL_FAST_PATH
+    bool   isNegative;
+    int    biasedExponent;
+    Uint64 significand;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                    0 == decimal64ToUnpackedSpecial(&isNegative,
+                                                    &biasedExponent,
+                                                    &significand,
+                                                    decimal))) {
+
+        // The significand of a value that is not specially encoded is less
+        // than 2^53, and therefore exactly representable as a 'double'.  If
+        // the power of 10 is also exactly representable, a single
+        // multiplication or division yields the correctly rounded result.
+        // Non-canonical significands, which represent zero, are left to the
+        // general conversion.
+
+        const int exponent = biasedExponent - 398;
+        if (significand <= k_MAX_DECIMAL64_SIGNIFICAND
+         && -k_MAX_EXACT_DOUBLE_POWER_OF_10 <= exponent
+         && exponent <= k_MAX_EXACT_DOUBLE_POWER_OF_10) {
+            double result = static_cast<double>(
+                                        static_cast<long long>(significand));
+            if (exponent < 0) {
+                result /= k_DOUBLE_POWERS_OF_10[-exponent];
+            }
+            else {
+                result *= k_DOUBLE_POWERS_OF_10[exponent];
+            }
+            return isNegative ? -result : result;                     // RETURN
+        }
+    }
+#endif
+
+    return Imp::decimalToDouble(decimal);
+}
+
             // Restore a Decimal Floating-Point from a Binary
 
 
@@ -388,6 +679,20 @@ Decimal32 DecimalConvertUtil::decimal32FromDouble(double binary)
 }
 Decimal64 DecimalConvertUtil::decimal64FromDouble(double binary)
 {
+    bool   isNegative;
+    Uint64 significand;
+    int    exponent;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                    0 == restoreDecimal64Components(&isNegative,
+                                                    &significand,
+                                                    &exponent,
+                                                    binary))) {
+        return decimal64FromUnpackedSpecial(isNegative,
+                                            significand,
+                                            exponent);                // RETURN
+    }
+
     Decimal64 rv;
     restoreDecimalFromBinary(&rv, binary);
     return rv;
@@ -420,6 +725,32 @@ Decimal128 DecimalConvertUtil::decimal128FromFloat(float binary)
     return rv;
 }
 
+                        // Array conversion functions
+
+void DecimalConvertUtil::decimal64ToDouble(double                 *binaries,
+                                           const Decimal64        *decimals,
+                                           bsls::Types::size_type  numValues)
+{
+    BSLS_ASSERT(binaries || 0 == numValues);
+    BSLS_ASSERT(decimals || 0 == numValues);
+
+    for (bsls::Types::size_type i = 0; i < numValues; ++i) {
+        binaries[i] = decimal64ToDouble(decimals[i]);
+    }
+}
+
+void DecimalConvertUtil::decimal64FromDouble(Decimal64              *decimals,
+                                             const double           *binaries,
+                                             bsls::Types::size_type  numValues)
+{
+    BSLS_ASSERT(decimals || 0 == numValues);
+    BSLS_ASSERT(binaries || 0 == numValues);
+
+    for (bsls::Types::size_type i = 0; i < numValues; ++i) {
+        decimals[i] = decimal64FromDouble(binaries[i]);
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -134,6 +134,29 @@ BSLS_IDENT("$Id$")
 // from this format.  Currently, only 64-bit decimal values are supported by
 // this encoding format.
 //
+///Conversion To and From Binary Floating-Point
+///--------------------------------------------
+// 'decimal64ToDouble' and 'decimal64FromDouble' handle the values most
+// commonly encountered by financial applications without calling into the
+// underlying decimal floating-point library or formatting text:
+//
+//: o 'decimal64ToDouble' converts a value whose significand is less than 2^53
+//:   and whose exponent is in the range '[-22, 22]' by a single
+//:   multiplication or division of two 'double' values that are exact, which
+//:   produces the correctly rounded result.  This is done only on platforms
+//:   that evaluate 'double' expressions without excess precision (i.e., on
+//:   which 'FLT_EVAL_METHOD' is 0).
+//:
+//: o 'decimal64FromDouble' obtains the 15 significant decimal digits of a
+//:   'double' whose absolute value is between approximately 1e-13 and 1e15
+//:   using integer arithmetic, instead of formatting the value with
+//:   'snprintf' and parsing the resulting text.
+//
+// Other values are converted as before, and both functions return the same
+// result for every value regardless of the path taken.  Overloads of both
+// functions that convert arrays of values are also provided, for use by
+// applications that convert large numbers of values at once.
+//
 ///Usage
 ///-----
 // This section shows the intended use of this component.
@@ -241,6 +264,10 @@ BSLS_IDENT("$Id$")
 #include <bsls_platform.h>
 #endif
 
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
 #ifndef INCLUDED_BSL_CSTRING
 #include <bsl_cstring.h>
 #endif
@@ -474,6 +501,26 @@ struct DecimalConvertUtil {
         // *not* to create a decimal from the exact base-2 value.  Use the
         // conversion constructors when you are not restoring a decimal.
 
+                        // Array conversion functions
+
+    static void decimal64ToDouble(double                 *binaries,
+                                  const Decimal64        *decimals,
+                                  bsls::Types::size_type  numValues);
+        // Load into each of the specified 'numValues' elements of the
+        // specified 'binaries' array the result of 'decimal64ToDouble' for the
+        // corresponding element of the specified 'decimals' array.  The
+        // behavior is undefined unless 'binaries' and 'decimals' each refer to
+        // an array of at least 'numValues' elements.
+
+    static void decimal64FromDouble(Decimal64              *decimals,
+                                    const double           *binaries,
+                                    bsls::Types::size_type  numValues);
+        // Load into each of the specified 'numValues' elements of the
+        // specified 'decimals' array the result of 'decimal64FromDouble' for
+        // the corresponding element of the specified 'binaries' array.  The
+        // behavior is undefined unless 'decimals' and 'binaries' each refer to
+        // an array of at least 'numValues' elements.
+
                         // decimalToBID functions
 
     static void decimal32ToBID (unsigned char *buffer,
@@ -1128,12 +1175,6 @@ double DecimalConvertUtil::decimal32ToDouble(Decimal32 decimal)
     return Imp::decimalToDouble(decimal);
 }
 
-inline
-double DecimalConvertUtil::decimal64ToDouble(Decimal64 decimal)
-{
-    return Imp::decimalToDouble(decimal);
-}
-
 inline
 double DecimalConvertUtil::decimal128ToDouble(Decimal128 decimal)
 {
@@ -1149,7 +1190,7 @@ double DecimalConvertUtil::decimalToDouble(Decimal32 decimal)
 inline
 double DecimalConvertUtil::decimalToDouble(Decimal64 decimal)
 {
-    return Imp::decimalToDouble(decimal);
+    return decimal64ToDouble(decimal);
 }
 
 inline
@@ -15,6 +15,7 @@
 #include <bsl_iostream.h>
 #include <bsl_iomanip.h>
 #include <bsl_sstream.h>
+#include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
 #include <bsl_climits.h>
 #include <bsl_limits.h>
@@ -22,6 +23,7 @@
 #include <bsl_cfloat.h>
 #include <bsl_cstring.h>
 #include <bsl_algorithm.h>
+#include <bsl_vector.h>
 
 #include <typeinfo>
 
@@ -43,9 +45,13 @@ using namespace bsl;
 // [ 2] size_type decimal64ToMultiWidthEncodingRaw(*buffer, decimal);
 // [ 4] unsigned char *decimal64FromVariableWidthEncoding(*decimal, *buffer);
 // [ 4] unsigned char *decimal64ToVariableWidthEncoding(*buffer, value);
+// [ 5] double decimal64ToDouble(Decimal64);
+// [ 5] Decimal64 decimal64FromDouble(double);
+// [ 5] void decimal64ToDouble(double *, const Decimal64 *, size_type);
+// [ 5] void decimal64FromDouble(Decimal64 *, const double *, size_type);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 3] USAGE EXAMPLE
+// [ 6] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 
@@ -403,6 +409,15 @@ bool strictEqual(DECIMAL_TYPE lhs, DECIMAL_TYPE rhs)
     return bsl::memcmp(blhs, brhs, sizeof(DECIMAL_TYPE)) == 0;
 }
 
+bool hasNegativeSign(double value)
+    // Return true if the sign bit of the specified 'value' is set, and false
+    // otherwise.  Note that this function distinguishes -0.0 from 0.0.
+{
+    bsls::Types::Uint64 bits;
+    bsl::memcpy(&bits, &value, sizeof bits);
+    return 0 != (bits >> 63);
+}
+
 void bufferToStream(bsl::ostream           &out,
                     unsigned char          *buffer,
                     bsls::Types::size_type  size)
@@ -453,7 +468,7 @@ int main(int argc, char* argv[])
     cout.precision(35);
 
     switch (test) { case 0:
-      case 5: {
+      case 6: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -545,6 +560,304 @@ int main(int argc, char* argv[])
         }
         //..
       } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'decimal64ToDouble' AND 'decimal64FromDouble'
+        //
+        // Concerns:
+        //: 1 'decimal64ToDouble' returns the 'double' value closest to the
+        //:   value of its argument, both for values that are converted exactly
+        //:   using powers of 10 and for those that are not.
+        //:
+        //: 2 'decimal64FromDouble' returns a value having the 15 significant
+        //:   digits of its argument, with the trailing zeros of its
+        //:   fractional part removed, regardless of the magnitude of the
+        //:   argument.
+        //:
+        //: 3 The sign of zero is preserved by both conversions.
+        //:
+        //: 4 The array overloads produce the same results as the scalar
+        //:   functions, and accept null arrays having no elements.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //:
+        //: 6 A 'Decimal64' value having a non-canonical significand converts
+        //:   to zero having the sign of the value.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, convert a set of values at the
+        //:   boundaries of the exact conversion, and compare the result with
+        //:   the expected value.  (C-1..3)
+        //:
+        //: 2 Convert pseudo-random 'Decimal64' values to 'double', and compare
+        //:   the result with that of 'strtod' applied to the text
+        //:   representation of the decimal value.  Convert pseudo-random
+        //:   'double' values, and values converted from pseudo-random decimal
+        //:   values, to 'Decimal64', and compare the result with that of
+        //:   parsing the output of 'snprintf' using the "%.15g" format.
+        //:   (C-1..2)
+        //:
+        //: 3 Convert arrays of the values from P-2 and compare the results
+        //:   with those of the scalar functions.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for null arrays having elements.  (C-5)
+        //:
+        //: 5 Convert BID encodings whose significand exceeds the largest
+        //:   canonical significand, and verify that the result is a zero
+        //:   having the sign of the encoding.  (C-6)
+        //
+        // Testing:
+        //   double decimal64ToDouble(Decimal64);
+        //   Decimal64 decimal64FromDouble(double);
+        //   void decimal64ToDouble(double *, const Decimal64 *, size_type);
+        //   void decimal64FromDouble(Decimal64 *, const double *, size_type);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'decimal64ToDouble' AND "
+                             "'decimal64FromDouble'" << endl
+                          << "================================"
+                             "=====================" << endl;
+
+        Decimal64 (*MDR)(long long, int) = &DecimalUtil::makeDecimalRaw64;
+
+        if (verbose) cout << "\tConverting a table of decimal values." << endl;
+        {
+            static const struct {
+                int       d_line;
+                long long d_significand;
+                int       d_exponent;
+                double    d_expected;
+            } DATA[] = {
+                //LINE  SIGNIFICAND        EXP  EXPECTED
+                //----  -----------------  ---  ---------------------
+                { L_,                   0,   0,  0.0                   },
+                { L_,                   0, -30,  0.0                   },
+                { L_,                   1,   0,  1.0                   },
+                { L_,               16148,  -2,  161.48                },
+                { L_,              -16148,  -2, -161.48                },
+                { L_,                   1, -22,  1e-22                 },
+                { L_,                   1, -23,  1e-23                 },
+                { L_,                   5,  22,  5e22                  },
+                { L_,                   5,  23,  5e23                  },
+                { L_,    9007199254740991,  -3,  9007199254740.991     },
+                { L_,    9007199254740993,   0,  9007199254740993.0    },
+                { L_,    9999999999999999, -22,  9.999999999999999e-7  },
+                { L_,    9999999999999999,  22,  9.999999999999999e37  },
+                { L_,                   1, 308,  1e308                 },
+                { L_,                   1, 309,
+                                   bsl::numeric_limits<double>::infinity() },
+                { L_,                   1,-398,  0.0                   },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int       LINE     = DATA[ti].d_line;
+                const long long SIG      = DATA[ti].d_significand;
+                const int       EXP      = DATA[ti].d_exponent;
+                const double    EXPECTED = DATA[ti].d_expected;
+
+                const Decimal64 VALUE  = MDR(SIG, EXP);
+                const double    RESULT = Util::decimal64ToDouble(VALUE);
+                ASSERTV(LINE, RESULT, EXPECTED == RESULT);
+                ASSERTV(LINE, !hasNegativeSign(RESULT) == (0 <= SIG));
+
+                const double NEGATED = Util::decimal64ToDouble(-VALUE);
+                ASSERTV(LINE, NEGATED, -EXPECTED == NEGATED);
+                ASSERTV(LINE, hasNegativeSign(NEGATED) == (0 <= SIG));
+            }
+
+            const double NAN_RESULT = Util::decimal64ToDouble(
+                                 bsl::numeric_limits<Decimal64>::quiet_NaN());
+            ASSERT(NAN_RESULT != NAN_RESULT);
+            ASSERT(bsl::numeric_limits<double>::infinity() ==
+                   Util::decimal64ToDouble(
+                                 bsl::numeric_limits<Decimal64>::infinity()));
+        }
+
+        if (verbose) cout << "\tConverting non-canonical values." << endl;
+        {
+            typedef bsls::Types::Uint64 Uint64;
+
+            static const struct {
+                int    d_line;
+                Uint64 d_bid;
+            } DATA[] = {
+                //LINE  BID                      SIGNIFICAND         EXP
+                //----  ---------------------    -----------------   ---
+                { L_,   0x6C77FFFFFFFFFFFFULL }, //  11258999068426239   0
+                { L_,   0x6C4C000000000000ULL }, //  10133099161583616  -5
+                { L_,   0xEC77FFFFFFFFFFFFULL }, // -11258999068426239   0
+                { L_,   0xEC4C000000000000ULL }, // -10133099161583616  -5
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int    LINE = DATA[ti].d_line;
+                const Uint64 BID  = DATA[ti].d_bid;
+
+                const Decimal64 VALUE = Util::decimal64FromBID(
+                                reinterpret_cast<const unsigned char *>(&BID));
+                const double    RESULT = Util::decimal64ToDouble(VALUE);
+                ASSERTV(LINE, RESULT, 0.0 == RESULT);
+                ASSERTV(LINE, hasNegativeSign(RESULT) == (0 != (BID >> 63)));
+            }
+        }
+
+        if (verbose) cout << "\tConverting a table of binary values." << endl;
+        {
+            static const struct {
+                int       d_line;
+                double    d_value;
+                long long d_significand;
+                int       d_exponent;
+            } DATA[] = {
+                //LINE  VALUE                 SIGNIFICAND        EXP
+                //----  --------------------  -----------------  ---
+                { L_,   0.0,                                  0,   0 },
+                { L_,   1.0,                                  1,   0 },
+                { L_,   100.0,                              100,   0 },
+                { L_,   161.48,                           16148,  -2 },
+                { L_,   0.1,                                  1,  -1 },
+                { L_,   0.1 + 0.2,                            3,  -1 },
+                { L_,   1.0 / 3,                333333333333333, -15 },
+                { L_,   2.0 / 3,                666666666666667, -15 },
+                { L_,   0.0001,                               1,  -4 },
+                { L_,   0.00001,                              1,  -5 },
+                { L_,   0.000123456789012345, 123456789012345, -18 },
+                { L_,   1e-13,                                1, -13 },
+                { L_,   1e-20,                                1, -20 },
+                { L_,   999999999999999.0,      999999999999999,   0 },
+                { L_,   999999999999999.5,                    1,  15 },
+                { L_,   1e15,                                 1,  15 },
+                { L_,   1234567890123456789.0,  123456789012346,   4 },
+                { L_,   1e300,                                1, 300 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int       LINE  = DATA[ti].d_line;
+                const double    VALUE = DATA[ti].d_value;
+                const long long SIG   = DATA[ti].d_significand;
+                const int       EXP   = DATA[ti].d_exponent;
+
+                const Decimal64 EXPECTED = MDR(SIG, EXP);
+                const Decimal64 RESULT   = Util::decimal64FromDouble(VALUE);
+                ASSERTV(LINE, RESULT, strictEqual(EXPECTED, RESULT));
+
+                const Decimal64 NEGATED_EXPECTED = -EXPECTED;
+                const Decimal64 NEGATED = Util::decimal64FromDouble(-VALUE);
+                ASSERTV(LINE, NEGATED, strictEqual(NEGATED_EXPECTED, NEGATED));
+            }
+        }
+
+        if (verbose) cout << "\tConverting pseudo-random values." << endl;
+
+        enum { k_NUM_VALUES = 20000 };
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        bsl::vector<Decimal64> decimals(&ta);
+        bsl::vector<double>    binaries(&ta);
+
+        bsls::Types::Uint64 state = 0x9E3779B97F4A7C15ULL;
+        for (int i = 0; i < k_NUM_VALUES; ++i) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+
+            // Choose a significand of 1 to 16 digits, and an exponent around
+            // the range of exact conversions.
+
+            long long significand = static_cast<long long>(
+                                        (state >> 8) % 10000000000000000ULL);
+            for (int digits = static_cast<int>(state % 16); digits > 0;
+                                                                    --digits) {
+                significand /= 10;
+            }
+            const int exponent = static_cast<int>((state >> 4) % 64) - 40;
+
+            const Decimal64 DECIMAL = MDR(state & 1 ? -significand
+                                                     : significand,
+                                          exponent);
+            decimals.push_back(DECIMAL);
+
+            char buffer[64];
+            const int length = DecimalUtil::format(buffer,
+                                                   sizeof buffer - 1,
+                                                   DECIMAL);
+            buffer[length] = 0;
+
+            const double BINARY = Util::decimal64ToDouble(DECIMAL);
+            ASSERTV(buffer, BINARY, bsl::strtod(buffer, 0) == BINARY);
+
+            binaries.push_back(BINARY);
+
+            // Also include arbitrary binary values.
+
+            double arbitrary;
+            bsl::memcpy(&arbitrary, &state, sizeof arbitrary);
+            if (arbitrary == arbitrary
+             && bsl::fabs(arbitrary) != bsl::numeric_limits<double>::infinity()
+             && (0 == arbitrary
+              || bsl::numeric_limits<double>::min() <= bsl::fabs(arbitrary))) {
+                binaries.push_back(arbitrary);
+            }
+        }
+
+        for (bsl::size_t i = 0; i < binaries.size(); ++i) {
+            const double BINARY = binaries[i];
+
+            char buffer[64];
+            sprintf(buffer, "%.15g", BINARY);
+
+            const Decimal64 EXPECTED = PARSEDEC64(buffer);
+            const Decimal64 RESULT   = Util::decimal64FromDouble(BINARY);
+            ASSERTV(buffer, RESULT, strictEqual(EXPECTED, RESULT));
+        }
+
+        if (verbose) cout << "\tConverting arrays." << endl;
+        {
+            bsl::vector<double> results(decimals.size(), 0.0, &ta);
+            Util::decimal64ToDouble(&results[0],
+                                    &decimals[0],
+                                    decimals.size());
+            for (bsl::size_t i = 0; i < decimals.size(); ++i) {
+                ASSERTV(i, Util::decimal64ToDouble(decimals[i]) == results[i]);
+            }
+
+            bsl::vector<Decimal64> restored(binaries.size(), Decimal64(), &ta);
+            Util::decimal64FromDouble(&restored[0],
+                                      &binaries[0],
+                                      binaries.size());
+            for (bsl::size_t i = 0; i < binaries.size(); ++i) {
+                const Decimal64 EXPECTED =
+                                       Util::decimal64FromDouble(binaries[i]);
+                ASSERTV(i, strictEqual(EXPECTED, restored[i]));
+            }
+
+            Util::decimal64ToDouble(0, 0, 0);
+            Util::decimal64FromDouble(0, 0, 0);
+        }
+
+        if (verbose) cout << "\tNegative testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            double    binary  = 1.0;
+            Decimal64 decimal = MDR(1, 0);
+
+            ASSERT_FAIL(Util::decimal64ToDouble(0, &decimal, 1));
+            ASSERT_FAIL(Util::decimal64ToDouble(&binary, 0, 1));
+            ASSERT_PASS(Util::decimal64ToDouble(&binary, &decimal, 1));
+
+            ASSERT_FAIL(Util::decimal64FromDouble(0, &binary, 1));
+            ASSERT_FAIL(Util::decimal64FromDouble(&decimal, 0, 1));
+            ASSERT_PASS(Util::decimal64FromDouble(&decimal, &binary, 1));
+        }
+      } break;
       case 4: {
         // --------------------------------------------------------------------
         // VARIABLE-WIDTH ENCODE AND DECODE
@@ -6,9 +6,10 @@ BSLS_IDENT_RCSID(bdldfp_decimalimputil_cpp,"$Id$ $CSID$")
 
 #include <bdldfp_uint128.h>
 
-#include <bsl_cstring.h>
-
 #include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
 
 namespace BloombergLP {
 namespace bdldfp {
@@ -27,6 +28,629 @@ struct Properties64
 
 };
 
+                        // Text conversion
+
+typedef bsls::Types::Uint64 Uint64;
+
+enum {
+    k_MAX_SIGNIFICANT_DIGITS = 40,  // maximum number of digits kept by 'scan'
+                                    // (at least two more than the precision
+                                    // of 'ValueType128')
+
+    k_MAX_EXPONENT_MAGNITUDE = 99999,
+                                    // maximum magnitude of the exponent
+                                    // passed to a 'parseXX' function (well
+                                    // beyond the range of every type)
+
+    k_MAX_FORMATTED_LENGTH   = 42,  // maximum length of a representation
+                                    // written by 'format'
+
+    k_MAX_CANONICAL_LENGTH   = 64   // maximum length of a representation
+                                    // written by 'writeCanonical', including
+                                    // the null terminator
+};
+
+const char k_DIGIT_PAIRS[] = "00010203040506070809"
+                             "10111213141516171819"
+                             "20212223242526272829"
+                             "30313233343536373839"
+                             "40414243444546474849"
+                             "50515253545556575859"
+                             "60616263646566676869"
+                             "70717273747576777879"
+                             "80818283848586878889"
+                             "90919293949596979899";
+    // The two-digit decimal representations of the integers from 0 to 99.
+
+const Uint64 k_POWERS_OF_10[] = {
+                                                             1ull,
+                                                            10ull,
+                                                           100ull,
+                                                          1000ull,
+                                                         10000ull,
+                                                        100000ull,
+                                                       1000000ull,
+                                                      10000000ull,
+                                                     100000000ull,
+                                                    1000000000ull,
+                                                   10000000000ull,
+                                                  100000000000ull,
+                                                 1000000000000ull,
+                                                10000000000000ull,
+                                               100000000000000ull,
+                                              1000000000000000ull,
+                                             10000000000000000ull,
+                                            100000000000000000ull,
+                                           1000000000000000000ull,
+                                          10000000000000000000ull
+};
+    // The powers of 10 that are representable by 'Uint64'.
+
+inline
+char *writeDigits(char *end, Uint64 value)
+    // Write the decimal digits of the specified 'value', without leading
+    // zeros (but at least one digit), into the characters immediately
+    // preceding the specified 'end', and return the address of the first
+    // digit written.
+{
+    while (value >= 100) {
+        const unsigned int pair = static_cast<unsigned int>(value % 100) * 2;
+        value /= 100;
+        end -= 2;
+        end[0] = k_DIGIT_PAIRS[pair];
+        end[1] = k_DIGIT_PAIRS[pair + 1];
+    }
+    if (value >= 10) {
+        const unsigned int pair = static_cast<unsigned int>(value) * 2;
+        end -= 2;
+        end[0] = k_DIGIT_PAIRS[pair];
+        end[1] = k_DIGIT_PAIRS[pair + 1];
+    }
+    else {
+        *--end = static_cast<char>('0' + value);
+    }
+    return end;
+}
+
+inline
+char *writeDigits(char *end, Uint64 *value, int numDigits)
+    // Write the specified 'numDigits' least significant decimal digits of the
+    // specified 'value', including leading zeros, into the characters
+    // immediately preceding the specified 'end', divide 'value' by
+    // '10^numDigits', and return the address of the first digit written.
+    // The behavior is undefined unless '0 <= numDigits'.
+{
+    Uint64 remaining = *value;
+    for (; numDigits >= 2; numDigits -= 2) {
+        const unsigned int pair = static_cast<unsigned int>(remaining % 100)
+                                                                           * 2;
+        remaining /= 100;
+        end -= 2;
+        end[0] = k_DIGIT_PAIRS[pair];
+        end[1] = k_DIGIT_PAIRS[pair + 1];
+    }
+    if (numDigits) {
+        *--end = static_cast<char>('0' + remaining % 10);
+        remaining /= 10;
+    }
+    *value = remaining;
+    return end;
+}
+
+unsigned int divideBy100000000(Uint64 *high, Uint64 *low)
+    // Divide the 128-bit unsigned integer whose high and low order 64 bits
+    // are the specified 'high' and 'low', respectively, by 10^8, load the
+    // quotient into 'high' and 'low', and return the remainder.
+{
+    const Uint64 divisor = 100000000;
+    Uint64       limbs[4] = { *high >> 32, *high & 0xFFFFFFFF,
+                              *low  >> 32, *low  & 0xFFFFFFFF };
+    Uint64       remainder = 0;
+
+    for (int i = 0; i < 4; ++i) {
+        const Uint64 current = (remainder << 32) | limbs[i];
+        limbs[i]  = current / divisor;
+        remainder = current % divisor;
+    }
+    *high = (limbs[0] << 32) | limbs[1];
+    *low  = (limbs[2] << 32) | limbs[3];
+    return static_cast<unsigned int>(remainder);
+}
+
+char *writeDigits(char *end, Uint64 high, Uint64 low)
+    // Write the decimal digits of the 128-bit unsigned integer whose high and
+    // low order 64 bits are the specified 'high' and 'low', respectively,
+    // without leading zeros (but at least one digit), into the characters
+    // immediately preceding the specified 'end', and return the address of
+    // the first digit written.  The behavior is undefined unless the integer
+    // is less than 10^34.
+{
+    if (0 == high) {
+        return writeDigits(end, low);                                 // RETURN
+    }
+
+    // The integer is at least 2^64, so that its quotient by 10^16 is not 0,
+    // and is less than 10^34, so that this quotient fits in 'low'.
+
+    Uint64 remainder = divideBy100000000(&high, &low);
+    end = writeDigits(end, &remainder, 8);
+    remainder = divideBy100000000(&high, &low);
+    end = writeDigits(end, &remainder, 8);
+    return writeDigits(end, low);
+}
+
+inline
+char *copyBackward(char *end, const char *first, const char *last)
+    // Copy the characters in the specified range '[first, last)' into the
+    // characters immediately preceding the specified 'end', and return the
+    // address of the first character written.
+{
+    while (first != last) {
+        *--end = *--last;
+    }
+    return end;
+}
+
+char *formatFinite(char   *end,
+                   bool    isNegative,
+                   Uint64  high,
+                   Uint64  low,
+                   int     exponent)
+    // Write the "to-scientific-string" representation of the finite value
+    // having the specified 'isNegative' sign, the coefficient whose high and
+    // low order 64 bits are the specified 'high' and 'low', respectively, and
+    // the specified 'exponent' into the characters immediately preceding the
+    // specified 'end', and return the address of the first character
+    // written.  The behavior is undefined unless the coefficient is less than
+    // 10^34.
+{
+    // The representation is written backward, i.e., starting with its least
+    // significant digit.  In plain notation, which is used if 'exponent' is
+    // not positive and the adjusted exponent, 'exponent + numDigits - 1', is
+    // not less than -6, the '-exponent' least significant digits of the
+    // coefficient (including leading zeros) follow the decimal point.
+
+    const int numFractionDigits = -exponent;
+
+    if (0 == high
+     && 0 <= numFractionDigits
+     && (numFractionDigits <= 6
+      || (numFractionDigits - 6 < 20
+       && low >= k_POWERS_OF_10[numFractionDigits - 6]))) {
+        char *begin = end;
+        if (numFractionDigits) {
+            begin = writeDigits(begin, &low, numFractionDigits);
+            *--begin = '.';
+        }
+        begin = writeDigits(begin, low);
+        if (isNegative) {
+            *--begin = '-';
+        }
+        return begin;                                                 // RETURN
+    }
+
+    char        digitBuffer[k_MAX_SIGNIFICANT_DIGITS];
+    char *const digitsEnd = digitBuffer + sizeof digitBuffer;
+    const char *digits    = writeDigits(digitsEnd, high, low);
+    const int   numDigits = static_cast<int>(digitsEnd - digits);
+    const int   adjusted  = exponent + numDigits - 1;
+    char       *begin     = end;
+
+    if (exponent <= 0 && adjusted >= -6) {
+
+        // Plain notation (with a coefficient of 20 or more digits).
+
+        const int numIntegerDigits = numDigits + exponent;
+
+        if (0 == exponent) {
+            begin = copyBackward(begin, digits, digitsEnd);
+        }
+        else if (numIntegerDigits > 0) {
+            begin = copyBackward(begin,
+                                 digits + numIntegerDigits,
+                                 digitsEnd);
+            *--begin = '.';
+            begin = copyBackward(begin, digits, digits + numIntegerDigits);
+        }
+        else {
+            begin = copyBackward(begin, digits, digitsEnd);
+            for (int i = numIntegerDigits; i < 0; ++i) {
+                *--begin = '0';
+            }
+            *--begin = '.';
+            *--begin = '0';
+        }
+    }
+    else {
+
+        // Scientific notation.
+
+        begin = writeDigits(begin,
+                            static_cast<Uint64>(adjusted < 0 ? -adjusted
+                                                             :  adjusted));
+        *--begin = adjusted < 0 ? '-' : '+';
+        *--begin = 'E';
+        if (numDigits > 1) {
+            begin = copyBackward(begin, digits + 1, digitsEnd);
+            *--begin = '.';
+        }
+        *--begin = digits[0];
+    }
+    if (isNegative) {
+        *--begin = '-';
+    }
+    return begin;
+}
+
+char *formatInfinity(char *end, bool isNegative)
+    // Write the representation of the infinity having the specified
+    // 'isNegative' sign into the characters immediately preceding the
+    // specified 'end', and return the address of the first character
+    // written.
+{
+    static const char k_INFINITY[] = "Infinity";
+
+    char *begin = copyBackward(end,
+                               k_INFINITY,
+                               k_INFINITY + sizeof k_INFINITY - 1);
+    if (isNegative) {
+        *--begin = '-';
+    }
+    return begin;
+}
+
+char *formatNan(char   *end,
+                bool    isNegative,
+                bool    isSignaling,
+                Uint64  payloadHigh,
+                Uint64  payloadLow)
+    // Write the representation of the NaN having the specified 'isNegative'
+    // sign, the specified 'isSignaling' kind, and the payload whose high and
+    // low order 64 bits are the specified 'payloadHigh' and 'payloadLow',
+    // respectively, into the characters immediately preceding the specified
+    // 'end', and return the address of the first character written.  Note
+    // that the payload is omitted if it is 0.  The behavior is undefined
+    // unless the payload is less than 10^34.
+{
+    char *begin = end;
+    if (0 != payloadHigh || 0 != payloadLow) {
+        begin = writeDigits(begin, payloadHigh, payloadLow);
+    }
+    *--begin = 'N';
+    *--begin = 'a';
+    *--begin = 'N';
+    if (isSignaling) {
+        *--begin = 's';
+    }
+    if (isNegative) {
+        *--begin = '-';
+    }
+    return begin;
+}
+
+int copyFormatted(char       *buffer,
+                  int         length,
+                  const char *begin,
+                  const char *end)
+    // Copy the representation in the specified range '[begin, end)' into
+    // the specified 'buffer' having the specified 'length' if it fits, and
+    // return the length of the representation.
+{
+    const int resultLength = static_cast<int>(end - begin);
+    if (resultLength <= length) {
+        bsl::memcpy(buffer, begin, resultLength);
+    }
+    return resultLength;
+}
+
+                        // ===================
+                        // struct ScannedValue
+                        // ===================
+
+struct ScannedValue {
+    // This 'struct' describes the value represented by the textual
+    // representation of a decimal floating point number, as determined by
+    // 'scan'.
+
+    // TYPES
+    enum Kind {
+        e_FINITE,
+        e_INFINITY,
+        e_QUIET_NAN,
+        e_SIGNALING_NAN
+    };
+
+    // DATA
+    Kind      d_kind;         // kind of value
+
+    bool      d_isNegative;   // 'true' if a '-' sign is present
+
+    char      d_digits[k_MAX_SIGNIFICANT_DIGITS];
+                              // significant digits of the coefficient,
+                              // without leading zeros
+
+    int       d_numDigits;    // number of digits in 'd_digits' (0 for a zero
+                              // coefficient)
+
+    Uint64    d_coefficient;  // value of 'd_digits' if 'd_numDigits <= 19'
+
+    bool      d_isInexact;    // 'true' if non-zero digits beyond
+                              // 'k_MAX_SIGNIFICANT_DIGITS' were discarded
+
+    long long d_exponent;     // exponent applying to 'd_digits'
+};
+
+bool isWord(const char *begin, const char *end, const char *word)
+    // Return 'true' if the characters in the specified range '[begin, end)'
+    // are, ignoring case, those of the specified null-terminated, lower-case
+    // 'word', and 'false' otherwise.
+{
+    for (; begin != end; ++begin, ++word) {
+        if (0 == *word || (*begin | 0x20) != *word) {
+            return false;                                             // RETURN
+        }
+    }
+    return 0 == *word;
+}
+
+inline
+unsigned int digitValue(char character)
+    // Return the value of the specified 'character' if it is a decimal
+    // digit, and a value greater than 9 otherwise.
+{
+    return static_cast<unsigned int>(static_cast<unsigned char>(character))
+                                                                         - '0';
+}
+
+int scan(ScannedValue *result, const bslstl::StringRef& input)
+    // Load into the specified 'result' a description of the value
+    // represented by the specified 'input', and return 0, or return a
+    // non-zero value if 'input' is not a valid representation of a decimal
+    // floating point number (as specified for 'DecimalImpUtil::parse').
+{
+    const char *current = input.data();
+    const char *end     = current + input.length();
+
+    result->d_isNegative = false;
+    if (current != end && ('-' == *current || '+' == *current)) {
+        result->d_isNegative = '-' == *current;
+        ++current;
+    }
+
+    if (current == end || (digitValue(*current) > 9 && '.' != *current)) {
+        if (isWord(current, end, "inf") || isWord(current, end, "infinity")) {
+            result->d_kind = ScannedValue::e_INFINITY;
+            return 0;                                                 // RETURN
+        }
+        if (isWord(current, end, "nan")) {
+            result->d_kind = ScannedValue::e_QUIET_NAN;
+            return 0;                                                 // RETURN
+        }
+        if (isWord(current, end, "snan")) {
+            result->d_kind = ScannedValue::e_SIGNALING_NAN;
+            return 0;                                                 // RETURN
+        }
+        return -1;                                                    // RETURN
+    }
+
+    // The state is kept in local variables, rather than in 'result', so that
+    // the stores to 'digits' do not force it to be reloaded.
+
+    char        *digits      = result->d_digits;
+    int          numDigits   = 0;
+    Uint64       coefficient = 0;
+    long long    exponent    = 0;
+    bool         isInexact   = false;
+    const char  *start       = current;
+
+    // Integer part (after leading zeros).
+
+    while (current != end && '0' == *current) {
+        ++current;
+    }
+    for (; current != end; ++current) {
+        const unsigned int digit = digitValue(*current);
+        if (digit > 9) {
+            break;                                                     // BREAK
+        }
+        if (numDigits < k_MAX_SIGNIFICANT_DIGITS) {
+            digits[numDigits++] = *current;
+            coefficient = coefficient * 10 + digit;
+        }
+        else {
+            isInexact |= 0 != digit;
+            ++exponent;
+        }
+    }
+    bool hasDigit = current != start;
+
+    // Fractional part.
+
+    if (current != end && '.' == *current) {
+        ++current;
+        start = current;
+        if (0 == numDigits) {
+            while (current != end && '0' == *current) {
+                ++current;
+            }
+            exponent -= current - start;
+        }
+        for (; current != end; ++current) {
+            const unsigned int digit = digitValue(*current);
+            if (digit > 9) {
+                break;                                                 // BREAK
+            }
+            if (numDigits < k_MAX_SIGNIFICANT_DIGITS) {
+                digits[numDigits++] = *current;
+                coefficient = coefficient * 10 + digit;
+                --exponent;
+            }
+            else {
+                isInexact |= 0 != digit;
+            }
+        }
+        hasDigit |= current != start;
+    }
+
+    if (!hasDigit) {
+        return -1;                                                    // RETURN
+    }
+
+    // Exponent.
+
+    if (current != end && ('e' == *current || 'E' == *current)) {
+        ++current;
+
+        bool isNegativeExponent = false;
+        if (current != end && ('-' == *current || '+' == *current)) {
+            isNegativeExponent = '-' == *current;
+            ++current;
+        }
+
+        start = current;
+
+        long long exponentValue = 0;
+        for (; current != end; ++current) {
+            const unsigned int digit = digitValue(*current);
+            if (digit > 9) {
+                break;                                                 // BREAK
+            }
+            if (exponentValue <= k_MAX_EXPONENT_MAGNITUDE) {
+                exponentValue = exponentValue * 10 + digit;
+            }
+        }
+        if (current == start) {
+            return -1;                                                // RETURN
+        }
+        exponent += isNegativeExponent ? -exponentValue : exponentValue;
+    }
+
+    if (current != end) {
+        return -1;                                                    // RETURN
+    }
+
+    result->d_kind        = ScannedValue::e_FINITE;
+    result->d_numDigits   = numDigits;
+    result->d_coefficient = coefficient;
+    result->d_isInexact   = isInexact;
+    result->d_exponent    = exponent;
+    return 0;
+}
+
+void writeCanonical(char *result, const ScannedValue& value)
+    // Write to the specified 'result' a null-terminated representation of the
+    // specified 'value' that is no longer than 'k_MAX_CANONICAL_LENGTH'
+    // characters (including the null terminator), and that a 'parseXX'
+    // function rounds to the same value as the representation described by
+    // 'value'.
+{
+    char *out = result;
+    if (value.d_isNegative) {
+        *out++ = '-';
+    }
+
+    switch (value.d_kind) {
+      case ScannedValue::e_INFINITY: {
+        bsl::memcpy(out, "inf", 4);
+        return;                                                       // RETURN
+      }
+      case ScannedValue::e_QUIET_NAN: {
+        bsl::memcpy(out, "nan", 4);
+        return;                                                       // RETURN
+      }
+      case ScannedValue::e_SIGNALING_NAN: {
+        bsl::memcpy(out, "snan", 5);
+        return;                                                       // RETURN
+      }
+      case ScannedValue::e_FINITE: {
+      } break;
+    }
+
+    long long exponent = value.d_exponent;
+
+    if (0 == value.d_numDigits) {
+        *out++ = '0';
+    }
+    else {
+        bsl::memcpy(out, value.d_digits, value.d_numDigits);
+        out += value.d_numDigits;
+        if (value.d_isInexact) {
+
+            // Since at least two digits more than the precision of any type
+            // are kept, a non-zero digit standing for the discarded ones
+            // yields the same rounding.
+
+            *out++ = '1';
+            --exponent;
+        }
+    }
+
+    if (exponent < -k_MAX_EXPONENT_MAGNITUDE) {
+        exponent = -k_MAX_EXPONENT_MAGNITUDE;
+    }
+    else if (exponent > k_MAX_EXPONENT_MAGNITUDE) {
+        exponent = k_MAX_EXPONENT_MAGNITUDE;
+    }
+
+    *out++ = 'e';
+    if (exponent < 0) {
+        *out++ = '-';
+        exponent = -exponent;
+    }
+
+    char        exponentBuffer[8];
+    char *const exponentEnd   = exponentBuffer + sizeof exponentBuffer;
+    const char *exponentBegin = writeDigits(exponentEnd,
+                                            static_cast<Uint64>(exponent));
+    bsl::memcpy(out, exponentBegin, exponentEnd - exponentBegin);
+    out[exponentEnd - exponentBegin] = 0;
+}
+
+inline
+Uint64 digitsToUint64(const char *digits, const char *digitsEnd)
+    // Return the integer whose decimal digits are in the specified range
+    // '[digits, digitsEnd)'.  The behavior is undefined unless the range has
+    // at most 19 digits.
+{
+    Uint64 result = 0;
+    for (; digits != digitsEnd; ++digits) {
+        result = result * 10 + (*digits - '0');
+    }
+    return result;
+}
+
+void multiplyAdd(Uint64 *high,
+                 Uint64 *low,
+                 Uint64  multiplicand,
+                 Uint64  multiplier,
+                 Uint64  addend)
+    // Load into the specified 'high' and 'low' the high and low order 64 bits,
+    // respectively, of the 128-bit result of 'multiplicand * multiplier +
+    // addend' for the specified 'multiplicand', 'multiplier', and 'addend'.
+{
+    const Uint64 aLow  = multiplicand & 0xFFFFFFFF;
+    const Uint64 aHigh = multiplicand >> 32;
+    const Uint64 bLow  = multiplier   & 0xFFFFFFFF;
+    const Uint64 bHigh = multiplier   >> 32;
+
+    const Uint64 lowLow   = aLow  * bLow;
+    const Uint64 lowHigh  = aLow  * bHigh;
+    const Uint64 highLow  = aHigh * bLow;
+    const Uint64 highHigh = aHigh * bHigh;
+
+    const Uint64 middle = (lowLow >> 32)
+                        + (lowHigh & 0xFFFFFFFF)
+                        + (highLow & 0xFFFFFFFF);
+
+    *low  = (middle << 32) | (lowLow & 0xFFFFFFFF);
+    *high = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+
+    *low += addend;
+    if (*low < addend) {
+        ++*high;
+    }
+}
+
 }  // close unnamed namespace
 
                         // --------------------
@@ -169,6 +793,307 @@ DecimalImpUtil::ValueType64 DecimalImpUtil::makeInfinity64(bool isNegative)
     return DecimalImpUtil::parse64( isNegative ? "-inf" : "inf" );
 }
 
+                        // Parsing functions
+
+int DecimalImpUtil::parse(ValueType32 *value, const bslstl::StringRef& input)
+{
+    BSLS_ASSERT(value);
+
+    ScannedValue scanned;
+    if (0 != scan(&scanned, input)) {
+        return -1;                                                    // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                            ScannedValue::e_FINITE == scanned.d_kind
+                         && !scanned.d_isInexact
+                         && scanned.d_numDigits <= 7
+                         && -101 <= scanned.d_exponent
+                         &&         scanned.d_exponent <= 90)) {
+        const unsigned int coefficient =
+                           static_cast<unsigned int>(scanned.d_coefficient);
+        const unsigned int biasedExponent =
+                           static_cast<unsigned int>(scanned.d_exponent + 101);
+
+        BinaryIntegralDecimalImpUtil::StorageType32 bid;
+        bid.d_raw = scanned.d_isNegative ? 0x80000000u : 0;
+        if (coefficient < 0x800000) {
+            bid.d_raw |= (biasedExponent << 23) | coefficient;
+        }
+        else {
+            bid.d_raw |= 0x60000000u
+                       | (biasedExponent << 21)
+                       | (coefficient & 0x1FFFFF);
+        }
+        *value = convertFromBID(bid);
+        return 0;                                                     // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    char buffer[k_MAX_CANONICAL_LENGTH];
+    writeCanonical(buffer, scanned);
+    *value = parse32(buffer);
+    return 0;
+}
+
+int DecimalImpUtil::parse(ValueType64 *value, const bslstl::StringRef& input)
+{
+    BSLS_ASSERT(value);
+
+    ScannedValue scanned;
+    if (0 != scan(&scanned, input)) {
+        return -1;                                                    // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                            ScannedValue::e_FINITE == scanned.d_kind
+                         && !scanned.d_isInexact
+                         && scanned.d_numDigits <= Properties64::digits
+                         && -Properties64::bias <= scanned.d_exponent
+                         && scanned.d_exponent <= Properties64::maxExponent)) {
+        const Uint64 coefficient = scanned.d_coefficient;
+        const Uint64 biasedExponent = static_cast<Uint64>(
+                                   scanned.d_exponent + Properties64::bias);
+
+        BinaryIntegralDecimalImpUtil::StorageType64 bid;
+        bid.d_raw = scanned.d_isNegative ? 0x8000000000000000ull : 0;
+        if (coefficient < 0x20000000000000ull) {
+            bid.d_raw |= (biasedExponent << 53) | coefficient;
+        }
+        else {
+            bid.d_raw |= 0x6000000000000000ull
+                       | (biasedExponent << 51)
+                       | (coefficient & 0x7FFFFFFFFFFFFull);
+        }
+        *value = convertFromBID(bid);
+        return 0;                                                     // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    char buffer[k_MAX_CANONICAL_LENGTH];
+    writeCanonical(buffer, scanned);
+    *value = parse64(buffer);
+    return 0;
+}
+
+int DecimalImpUtil::parse(ValueType128 *value, const bslstl::StringRef& input)
+{
+    BSLS_ASSERT(value);
+
+    ScannedValue scanned;
+    if (0 != scan(&scanned, input)) {
+        return -1;                                                    // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                            ScannedValue::e_FINITE == scanned.d_kind
+                         && !scanned.d_isInexact
+                         && scanned.d_numDigits <= 34
+                         && -6176 <= scanned.d_exponent
+                         &&          scanned.d_exponent <= 6111)) {
+
+        // Split the (at most 34) digits of the coefficient into a high order
+        // part and a low order part of (at most) 17 digits each.
+
+        const char *digitsEnd = scanned.d_digits + scanned.d_numDigits;
+        const char *split     = scanned.d_numDigits > 17
+                              ? digitsEnd - 17
+                              : scanned.d_digits;
+
+        Uint64 high;
+        Uint64 low;
+        multiplyAdd(&high,
+                    &low,
+                    digitsToUint64(scanned.d_digits, split),
+                    100000000000000000ull,
+                    digitsToUint64(split, digitsEnd));
+
+        const Uint64 biasedExponent =
+                              static_cast<Uint64>(scanned.d_exponent + 6176);
+
+        // Since the coefficient is less than 10^34 (and so less than 2^113),
+        // the combination field never begins with '11'.
+
+        BinaryIntegralDecimalImpUtil::StorageType128 bid;
+        bid.d_raw.setHigh((scanned.d_isNegative ? 0x8000000000000000ull : 0)
+                        | (biasedExponent << 49)
+                        | high);
+        bid.d_raw.setLow(low);
+        *value = convertFromBID(bid);
+        return 0;                                                     // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    char buffer[k_MAX_CANONICAL_LENGTH];
+    writeCanonical(buffer, scanned);
+    *value = parse128(buffer);
+    return 0;
+}
+
+                        // Formatting functions
+
+int DecimalImpUtil::format(char *buffer, int length, ValueType32 value)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 <= length);
+
+    const unsigned int bits       = convertToBID(value).d_raw;
+    const bool         isNegative = 0 != (bits & 0x80000000u);
+
+    char        localBuffer[k_MAX_FORMATTED_LENGTH];
+    char *const end = localBuffer + sizeof localBuffer;
+    const char *begin;
+
+    if (0x60000000u == (bits & 0x60000000u)) {
+        if (0x7C000000u == (bits & 0x7C000000u)) {
+            const unsigned int payload = bits & 0xFFFFF;
+            begin = formatNan(end,
+                              isNegative,
+                              0 != (bits & 0x02000000u),
+                              0,
+                              payload < 1000000 ? payload : 0);
+        }
+        else if (0x78000000u == (bits & 0x78000000u)) {
+            begin = formatInfinity(end, isNegative);
+        }
+        else {
+            unsigned int coefficient = (bits & 0x1FFFFF) | 0x800000;
+            if (coefficient > 9999999) {
+                coefficient = 0;  // non-canonical
+            }
+            begin = formatFinite(end,
+                                 isNegative,
+                                 0,
+                                 coefficient,
+                                 static_cast<int>((bits >> 21) & 0xFF) - 101);
+        }
+    }
+    else {
+        begin = formatFinite(end,
+                             isNegative,
+                             0,
+                             bits & 0x7FFFFF,
+                             static_cast<int>((bits >> 23) & 0xFF) - 101);
+    }
+
+    return copyFormatted(buffer, length, begin, end);
+}
+
+int DecimalImpUtil::format(char *buffer, int length, ValueType64 value)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 <= length);
+
+    const Uint64 bits       = convertToBID(value).d_raw;
+    const bool   isNegative = 0 != (bits & 0x8000000000000000ull);
+
+    char        localBuffer[k_MAX_FORMATTED_LENGTH];
+    char *const end = localBuffer + sizeof localBuffer;
+    const char *begin;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+               0x6000000000000000ull != (bits & 0x6000000000000000ull))) {
+        begin = formatFinite(end,
+                             isNegative,
+                             0,
+                             bits & 0x1FFFFFFFFFFFFFull,
+                             static_cast<int>((bits >> 53) & 0x3FF)
+                                                         - Properties64::bias);
+    }
+    else if (0x7C00000000000000ull == (bits & 0x7C00000000000000ull)) {
+        const Uint64 payload = bits & 0x3FFFFFFFFFFFFull;
+        begin = formatNan(end,
+                          isNegative,
+                          0 != (bits & 0x0200000000000000ull),
+                          0,
+                          payload < 1000000000000000ull ? payload : 0);
+    }
+    else if (0x7800000000000000ull == (bits & 0x7800000000000000ull)) {
+        begin = formatInfinity(end, isNegative);
+    }
+    else {
+        Uint64 coefficient = (bits & 0x7FFFFFFFFFFFFull) | 0x20000000000000ull;
+        if (coefficient >= static_cast<Uint64>(Properties64::mediumLimit)) {
+            coefficient = 0;  // non-canonical
+        }
+        begin = formatFinite(end,
+                             isNegative,
+                             0,
+                             coefficient,
+                             static_cast<int>((bits >> 51) & 0x3FF)
+                                                         - Properties64::bias);
+    }
+
+    return copyFormatted(buffer, length, begin, end);
+}
+
+int DecimalImpUtil::format(char *buffer, int length, ValueType128 value)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 <= length);
+
+    const Uint128 bits       = convertToBID(value).d_raw;
+    const Uint64  high       = bits.high();
+    const Uint64  low        = bits.low();
+    const bool    isNegative = 0 != (high & 0x8000000000000000ull);
+
+    char        localBuffer[k_MAX_FORMATTED_LENGTH];
+    char *const end = localBuffer + sizeof localBuffer;
+    const char *begin;
+
+    if (0x7C00000000000000ull == (high & 0x7C00000000000000ull)) {
+
+        // A payload of 10^33 or more is non-canonical.
+
+        const Uint64 payloadHigh = high & 0x3FFFFFFFFFFFull;
+        const bool   isCanonical = payloadHigh < 0x314DC6448D93ull
+                                || (payloadHigh == 0x314DC6448D93ull
+                                 && low < 0x38C15B0A00000000ull);
+        begin = formatNan(end,
+                          isNegative,
+                          0 != (high & 0x0200000000000000ull),
+                          isCanonical ? payloadHigh : 0,
+                          isCanonical ? low         : 0);
+    }
+    else if (0x7800000000000000ull == (high & 0x7800000000000000ull)) {
+        begin = formatInfinity(end, isNegative);
+    }
+    else if (0x6000000000000000ull == (high & 0x6000000000000000ull)) {
+
+        // A coefficient having the implicit '100' prefix is at least 2^113,
+        // and so is non-canonical.
+
+        begin = formatFinite(end,
+                             isNegative,
+                             0,
+                             0,
+                             static_cast<int>((high >> 47) & 0x3FFF) - 6176);
+    }
+    else {
+
+        // A coefficient of 10^34 or more is non-canonical.
+
+        Uint64 coefficientHigh = high & 0x1FFFFFFFFFFFFull;
+        Uint64 coefficientLow  = low;
+        if (coefficientHigh > 0x1ED09BEAD87C0ull
+         || (coefficientHigh == 0x1ED09BEAD87C0ull
+          && coefficientLow > 0x378D8E63FFFFFFFFull)) {
+            coefficientHigh = 0;
+            coefficientLow  = 0;
+        }
+        begin = formatFinite(end,
+                             isNegative,
+                             coefficientHigh,
+                             coefficientLow,
+                             static_cast<int>((high >> 49) & 0x3FFF) - 6176);
+    }
+
+    return copyFormatted(buffer, length, begin, end);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -156,6 +156,10 @@ BSLS_IDENT("$Id$")
 #include <bsls_assert.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_STRINGREF
+#include <bslstl_stringref.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ASSERT
 #include <bslmf_assert.h>
 #endif
@@ -853,6 +857,29 @@ class DecimalImpUtil {
         // ISO/EIC TR 24732 C when parsing NaN because the AIX compiler
         // intrinsics return a signaling NaN.
 
+    static int parse(ValueType32              *value,
+                     const bslstl::StringRef&  input);
+    static int parse(ValueType64              *value,
+                     const bslstl::StringRef&  input);
+    static int parse(ValueType128             *value,
+                     const bslstl::StringRef&  input);
+        // Load into the specified 'value' the decimal floating point number
+        // represented by the entirety of the specified 'input', rounded (if
+        // necessary) as for 'parseXX', and return 0.  Return a non-zero value,
+        // with no effect on 'value', if 'input' is not a valid representation.
+        // A valid representation consists of an optional sign ('+' or '-')
+        // followed by either a decimal number (a sequence of digits
+        // optionally containing a single '.', having at least one digit, and
+        // optionally followed by 'e' or 'E', an optional sign, and at least
+        // one exponent digit), or one of the (case-insensitive) strings
+        // "inf", "infinity", "nan", or "snan"; in particular, leading and
+        // trailing whitespace is not allowed.  Note that, unlike 'parseXX',
+        // 'input' need not be null-terminated; also note that values having
+        // no more significant digits than the precision of the type and an
+        // exponent in the range of the type are composed directly from their
+        // coefficient and exponent, without allocating memory, and that all
+        // other values are delegated to 'parseXX'.
+
                         // Formatting functions
 
     static void format(ValueType32  value, char *buffer);
@@ -867,6 +894,30 @@ class DecimalImpUtil {
         // returned are quiet or signaling.  The behavior is undefined unless
         // there are 'size' bytes available in 'buffer'.
 
+    static int format(char *buffer, int length, ValueType32  value);
+    static int format(char *buffer, int length, ValueType64  value);
+    static int format(char *buffer, int length, ValueType128 value);
+        // Write the textual representation of the specified decimal 'value'
+        // into the specified 'buffer' having the specified 'length', and
+        // return the number of characters in that representation.  If
+        // 'length' is less than the returned value, the contents of 'buffer'
+        // are unspecified.  The representation is the one produced by the
+        // "to-scientific-string" operation of the IEEE 754 standard (as
+        // implemented by the decNumber library): finite values are written
+        // in plain notation (e.g., "-12.340") if their exponent is not
+        // positive and their adjusted exponent (i.e., the exponent of their
+        // most significant digit) is not less than -6, and in scientific
+        // notation (e.g., "1.2340E+7") otherwise; infinities are written as
+        // "Infinity", and NaNs as "NaN" or "sNaN" followed by their payload,
+        // if any, each of which is preceded by '-' if 'value' is negative.
+        // No terminating null character is written, no memory is allocated,
+        // and the result does not depend on the current locale.  The behavior
+        // is undefined unless 'buffer' is non-null and '0 <= length'.  Note
+        // that the representation of a 'ValueType32', 'ValueType64', and
+        // 'ValueType128' value is never longer than 15, 24, and 42
+        // characters, respectively, and that 'parse' restores every finite or
+        // infinite value from its representation, including its cohort.
+
                         // Densely Packed Conversion Functions
 
     static ValueType32  convertFromDPD(
@@ -12,11 +12,14 @@ BSLS_IDENT("$Id$")
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
 #include <bsls_stopwatch.h>
+#include <bsls_types.h>
 
 #include <bsl_algorithm.h>
 #include <bsl_climits.h>
 #include <bsl_cmath.h>
+#include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
 #include <bsl_fstream.h>
 #include <bsl_limits.h>
 #include <bsl_iostream.h>
@@ -117,6 +120,12 @@ using bsl::atoi;
 // [18] format(ValueType32,  char *)
 // [18] format(ValueType64,  char *)
 // [18] format(ValueType128, char *)
+// [23] format(char *, int, ValueType32)
+// [23] format(char *, int, ValueType64)
+// [23] format(char *, int, ValueType128)
+// [23] parse(ValueType32  *, const bslstl::StringRef&)
+// [23] parse(ValueType64  *, const bslstl::StringRef&)
+// [23] parse(ValueType128 *, const bslstl::StringRef&)
 // [ 1] checkLiteral(double)
 // [20] convertFromDPD(DenselyPackedDecimalImpUtil::StorageType32)
 // [20] convertFromDPD(DenselyPackedDecimalImpUtil::StorageType64)
@@ -133,7 +142,7 @@ using bsl::atoi;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 4] TEST 'notEqual' FOR 'NaN' CORRECTNESS
-// [23] USAGE EXAMPLE
+// [24] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 //=============================================================================
@@ -791,6 +800,7 @@ static int veryVeryVeryVerbose;
 
 struct TestDriver {
     typedef bsls::AssertFailureHandlerGuard AssertFailureHandlerGuard;
+    static void testCase24();
     static void testCase23();
     static void testCase22();
     static void testCase21();
@@ -816,7 +826,7 @@ struct TestDriver {
     static void testCase1();
 };
 
-void TestDriver::testCase23()
+void TestDriver::testCase24()
 {
     // ------------------------------------------------------------------------
     // TESTING USAGE EXAMPLE
@@ -918,6 +928,549 @@ void TestDriver::testCase23()
 // for public consumption, or direct use in decimal arithmetic.
 }
 
+void TestDriver::testCase23()
+{
+    // ------------------------------------------------------------------------
+    // TESTING 'format(char *, int, ...)' AND 'parse(..., StringRef)'
+    //
+    // Concerns:
+    //:  1 'format' writes the "to-scientific-string" representation of the
+    //:    value, in plain or scientific notation as appropriate, and returns
+    //:    its length.
+    //:
+    //:  2 'format' agrees with the formatting of the decNumber library for
+    //:    all values, including non-canonical encodings, infinities, and NaNs
+    //:    having a payload.
+    //:
+    //:  3 'format' writes nothing past 'length' characters, and returns the
+    //:    required length if the buffer is too short.
+    //:
+    //:  4 'parse' yields the same value, including its cohort, as the
+    //:    corresponding 'parseXX' function for every valid representation,
+    //:    including those that must be rounded, that overflow, or that
+    //:    underflow.
+    //:
+    //:  5 'parse' rejects invalid representations, leaving the value
+    //:    unchanged, and does not read past the end of its input.
+    //:
+    //:  6 'parse' restores every finite value from its representation as
+    //:    written by 'format'.
+    //:
+    //:  7 Neither function allocates memory.
+    //:
+    //:  8 QoI: Asserted precondition violations are detected when enabled.
+    //
+    // Plan:
+    //:  1 Using the table-driven technique, format a set of values having
+    //:    various coefficients and exponents, and compare the result with
+    //:    the expected representation.  (C-1)
+    //:
+    //:  2 Format values having pseudo-random encodings, and compare the
+    //:    result with the output of the decNumber library for the same
+    //:    value.  Parse the result for finite values and compare with the
+    //:    original value.  (C-2, 6)
+    //:
+    //:  3 Format into buffers of every length up to the required length,
+    //:    and verify that a sentinel character following the buffer is
+    //:    unchanged.  (C-3)
+    //:
+    //:  4 Using the table-driven technique, parse a set of valid and invalid
+    //:    representations, and compare the result with 'parseXX'.  Repeat
+    //:    for pseudo-random representations, and for representations that
+    //:    are followed by unrelated characters outside the input.  (C-4, 5)
+    //:
+    //:  5 Verify that the default allocator is not used.  (C-7)
+    //:
+    //:  6 Verify that, in appropriate build modes, defensive checks are
+    //:    triggered for a null buffer or value, and a negative length.
+    //:    (C-8)
+    //
+    // Testing:
+    //   int format(char *, int, ValueType32);
+    //   int format(char *, int, ValueType64);
+    //   int format(char *, int, ValueType128);
+    //   int parse(ValueType32  *, const bslstl::StringRef&);
+    //   int parse(ValueType64  *, const bslstl::StringRef&);
+    //   int parse(ValueType128 *, const bslstl::StringRef&);
+    // ------------------------------------------------------------------------
+
+    if (verbose) cout << endl
+                      << "TESTING 'format' AND 'parse' WITH BUFFERS" << endl
+                      << "=========================================" << endl;
+
+    typedef BloombergLP::bdldfp::BinaryIntegralDecimalImpUtil BidUtil;
+    typedef BloombergLP::bdldfp::DenselyPackedDecimalImpUtil  DpdUtil;
+    typedef BloombergLP::bdldfp::DecimalImpUtil_DecNumber     DecNumberUtil;
+    typedef bsls::Types::Uint64                               Uint64;
+
+    if (verbose) cout << "\tFormatting a table of values." << endl;
+    {
+        static const struct {
+            int         d_line;
+            long long   d_coefficient;
+            int         d_exponent;
+            const char *d_expected;
+        } DATA[] = {
+            //LINE  COEFFICIENT  EXP  EXPECTED
+            //----  -----------  ---  ---------------
+            { L_,            0,   0,  "0"             },
+            { L_,            0,   2,  "0E+2"          },
+            { L_,            0,  -2,  "0.00"          },
+            { L_,            0,  -6,  "0.000000"      },
+            { L_,            0,  -7,  "0E-7"          },
+            { L_,            1,   0,  "1"             },
+            { L_,           -1,   0,  "-1"            },
+            { L_,           15,  -1,  "1.5"           },
+            { L_,        12340,  -3,  "12.340"        },
+            { L_,       -16148,  -2,  "-161.48"       },
+            { L_,          123,  -3,  "0.123"         },
+            { L_,          123,  -5,  "0.00123"       },
+            { L_,          123,  -8,  "0.00000123"    },
+            { L_,          123,  -9,  "1.23E-7"       },
+            { L_,            1,  -6,  "0.000001"      },
+            { L_,            1,  -7,  "1E-7"          },
+            { L_,            1,   3,  "1E+3"          },
+            { L_,         1234,   3,  "1.234E+6"      },
+            { L_,      9999999,   0,  "9999999"       },
+            { L_,     -9999999,  90,  "-9.999999E+96" },
+            { L_,            1, -101, "1E-101"        },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int          LINE     = DATA[ti].d_line;
+            const long long    COEFF    = DATA[ti].d_coefficient;
+            const int          EXP      = DATA[ti].d_exponent;
+            const bsl::string  EXPECTED = DATA[ti].d_expected;
+            const int          LENGTH   = static_cast<int>(EXPECTED.length());
+
+            char buffer[64];
+
+            const Util::ValueType32 V32 = Util::makeDecimalRaw32(
+                                                 static_cast<int>(COEFF), EXP);
+            int length = Util::format(buffer, sizeof buffer, V32);
+            ASSERTV(LINE, length, LENGTH == length);
+            ASSERTV(LINE, EXPECTED == bsl::string(buffer, length));
+
+            const Util::ValueType64 V64 = Util::makeDecimalRaw64(COEFF, EXP);
+            length = Util::format(buffer, sizeof buffer, V64);
+            ASSERTV(LINE, length, LENGTH == length);
+            ASSERTV(LINE, EXPECTED == bsl::string(buffer, length));
+
+            const Util::ValueType128 V128 = Util::makeDecimalRaw128(COEFF,
+                                                                    EXP);
+            length = Util::format(buffer, sizeof buffer, V128);
+            ASSERTV(LINE, length, LENGTH == length);
+            ASSERTV(LINE, EXPECTED == bsl::string(buffer, length));
+        }
+
+        static const struct {
+            int         d_line;
+            const char *d_input;
+            const char *d_expected;
+        } DATA128[] = {
+            //LINE  INPUT / EXPECTED
+            //----  --------------------------------------------------------
+            { L_,   "1234567890123456789012345678901234",
+                    "1234567890123456789012345678901234"                     },
+            { L_,   "-123456789012345678901234.5678901234",
+                    "-123456789012345678901234.5678901234"                   },
+            { L_,   "0.0000012345678901234567890123456789012",
+                    "0.0000012345678901234567890123456789012"                },
+            { L_,   "1234567890123456789012345678901234e-39",
+                    "0.000001234567890123456789012345678901234"              },
+            { L_,   "1234567890123456789012345678901234e-40",
+                    "1.234567890123456789012345678901234E-7"                 },
+            { L_,   "9999999999999999999999999999999999e6111",
+                    "9.999999999999999999999999999999999E+6144"              },
+            { L_,   "-inf",                 "-Infinity"                      },
+            { L_,   "nan",                  "NaN"                            },
+            { L_,   "-snan",                "-sNaN"                          },
+        };
+        const int NUM_DATA128 = static_cast<int>(sizeof DATA128
+                                                 / sizeof *DATA128);
+
+        for (int ti = 0; ti < NUM_DATA128; ++ti) {
+            const int         LINE     = DATA128[ti].d_line;
+            const char       *INPUT    = DATA128[ti].d_input;
+            const bsl::string EXPECTED = DATA128[ti].d_expected;
+
+            char buffer[64];
+
+            const Util::ValueType128 V = Util::parse128(INPUT);
+            const int length = Util::format(buffer, sizeof buffer, V);
+            ASSERTV(LINE, bsl::string(buffer, length),
+                    EXPECTED == bsl::string(buffer, length));
+        }
+    }
+
+    if (verbose) cout << "\tFormatting pseudo-random encodings." << endl;
+    {
+        Uint64 state = 0x9E3779B97F4A7C15ull;
+
+        for (int i = 0; i < 20000; ++i) {
+            Uint64 random[3];
+            for (int j = 0; j < 3; ++j) {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                random[j] = state;
+            }
+            if (i % 2) {
+
+                // Favor finite values with small exponents.
+
+                random[0] &= ~(3ull << 61);
+                random[1] &= 0x803FFFFFFFFFFFFFull;
+                random[1] |= 0x3000000000000000ull;
+                random[2] &= 0xF9FFFFFFFFFFFFFFull;
+            }
+
+            char expected[BDLDFP_DECIMALPLATFORM_SNPRINTF_BUFFER_SIZE];
+            char buffer[64];
+            int  length;
+
+            BidUtil::StorageType32 bid32;
+            bid32.d_raw = static_cast<unsigned int>(random[0] >> 32);
+            const Util::ValueType32 V32 = Util::convertFromBID(bid32);
+            {
+                DpdUtil::StorageType32 dpd = Util::convertToDPD(V32);
+                DecNumberUtil::ValueType32 decNumber;
+                bsl::memcpy(&decNumber, &dpd, sizeof decNumber);
+                DecNumberUtil::format(decNumber, expected);
+            }
+            length = Util::format(buffer, sizeof buffer, V32);
+            ASSERTV(i, expected, expected == bsl::string(buffer, length));
+            ASSERTV(i, length, length <= 15);
+            if (!bsl::strstr(expected, "NaN")) {
+                Util::ValueType32 result;
+                ASSERTV(i, 0 == Util::parse(&result,
+                                            bslstl::StringRef(buffer,
+                                                              length)));
+                const Util::ValueType32 CANONICAL = Util::convertFromDPD(
+                                                 Util::convertToDPD(V32));
+                ASSERTV(i, expected,
+                        0 == bsl::memcmp(&result, &CANONICAL, sizeof result));
+            }
+
+            BidUtil::StorageType64 bid64;
+            bid64.d_raw = random[1];
+            const Util::ValueType64 V64 = Util::convertFromBID(bid64);
+            {
+                DpdUtil::StorageType64 dpd = Util::convertToDPD(V64);
+                DecNumberUtil::ValueType64 decNumber;
+                bsl::memcpy(&decNumber, &dpd, sizeof decNumber);
+                DecNumberUtil::format(decNumber, expected);
+            }
+            length = Util::format(buffer, sizeof buffer, V64);
+            ASSERTV(i, expected, expected == bsl::string(buffer, length));
+            ASSERTV(i, length, length <= 24);
+            if (!bsl::strstr(expected, "NaN")) {
+                Util::ValueType64 result;
+                ASSERTV(i, 0 == Util::parse(&result,
+                                            bslstl::StringRef(buffer,
+                                                              length)));
+                const Util::ValueType64 CANONICAL = Util::convertFromDPD(
+                                                 Util::convertToDPD(V64));
+                ASSERTV(i, expected,
+                        0 == bsl::memcmp(&result, &CANONICAL, sizeof result));
+            }
+
+            BidUtil::StorageType128 bid128;
+            bid128.d_raw.setHigh(random[2]);
+            bid128.d_raw.setLow(random[0]);
+            const Util::ValueType128 V128 = Util::convertFromBID(bid128);
+            {
+                DpdUtil::StorageType128 dpd = Util::convertToDPD(V128);
+                DecNumberUtil::ValueType128 decNumber;
+                bsl::memcpy(&decNumber, &dpd, sizeof decNumber);
+                DecNumberUtil::format(decNumber, expected);
+            }
+            length = Util::format(buffer, sizeof buffer, V128);
+            ASSERTV(i, expected, expected == bsl::string(buffer, length));
+            ASSERTV(i, length, length <= 42);
+            if (!bsl::strstr(expected, "NaN")) {
+                Util::ValueType128 result;
+                ASSERTV(i, 0 == Util::parse(&result,
+                                            bslstl::StringRef(buffer,
+                                                              length)));
+                const Util::ValueType128 CANONICAL = Util::convertFromDPD(
+                                                 Util::convertToDPD(V128));
+                ASSERTV(i, expected,
+                        0 == bsl::memcmp(&result, &CANONICAL, sizeof result));
+            }
+        }
+    }
+
+    if (verbose) cout << "\tFormatting into short buffers." << endl;
+    {
+        const Util::ValueType128 V = Util::parse128(
+                                       "-1.234567890123456789012345678901234");
+
+        char expected[64];
+        const int EXPECTED_LENGTH = Util::format(expected, sizeof expected, V);
+        ASSERT(36 == EXPECTED_LENGTH);
+
+        for (int length = 0; length <= EXPECTED_LENGTH; ++length) {
+            char buffer[64];
+            bsl::memset(buffer, '#', sizeof buffer);
+
+            ASSERTV(length, EXPECTED_LENGTH == Util::format(buffer,
+                                                            length,
+                                                            V));
+            for (int j = length; j < static_cast<int>(sizeof buffer); ++j) {
+                ASSERTV(length, j, '#' == buffer[j]);
+            }
+            if (EXPECTED_LENGTH == length) {
+                ASSERT(0 == bsl::memcmp(buffer, expected, length));
+            }
+        }
+    }
+
+    if (verbose) cout << "\tParsing a table of representations." << endl;
+    {
+        static const struct {
+            int         d_line;
+            const char *d_input;
+            bool        d_isValid;
+        } DATA[] = {
+            //LINE  INPUT                                              VALID
+            //----  -------------------------------------------------  -----
+            { L_,   "0",                                               true  },
+            { L_,   "-0",                                              true  },
+            { L_,   "+0",                                              true  },
+            { L_,   "0.000",                                           true  },
+            { L_,   "000.000e+5",                                      true  },
+            { L_,   "1",                                               true  },
+            { L_,   "1.",                                              true  },
+            { L_,   ".5",                                              true  },
+            { L_,   "-.5e-3",                                          true  },
+            { L_,   "161.48",                                          true  },
+            { L_,   "-0.00012340",                                     true  },
+            { L_,   "12.5E2",                                          true  },
+            { L_,   "9999999",                                         true  },
+            { L_,   "99999995",                                        true  },
+            { L_,   "12345675",                                        true  },
+            { L_,   "12345685",                                        true  },
+            { L_,   "9999999999999999",                                true  },
+            { L_,   "9999999999999999.5",                              true  },
+            { L_,   "9999999999999998.5",                              true  },
+            { L_,   "1234567890123456789012345678901234",              true  },
+            { L_,   "12345678901234567890123456789012345",             true  },
+            { L_,   "1.0000000000000000000000000000000000000000000001",
+                                                                       true  },
+            { L_,   "0.9999999999999999999999999999999999999999999999",
+                                                                       true  },
+            { L_,   "1e-101",                                          true  },
+            { L_,   "1e-398",                                          true  },
+            { L_,   "1.5e-398",                                        true  },
+            { L_,   "5e-399",                                          true  },
+            { L_,   "1e-6176",                                         true  },
+            { L_,   "1e-6177",                                         true  },
+            { L_,   "1e90",                                            true  },
+            { L_,   "1e96",                                            true  },
+            { L_,   "1e97",                                            true  },
+            { L_,   "1e369",                                           true  },
+            { L_,   "1e385",                                           true  },
+            { L_,   "1e6144",                                          true  },
+            { L_,   "1e6145",                                          true  },
+            { L_,   "0e-99999999999999999999",                         true  },
+            { L_,   "-1e99999999999999999999",                         true  },
+            { L_,   "inf",                                             true  },
+            { L_,   "-INF",                                            true  },
+            { L_,   "Infinity",                                        true  },
+            { L_,   "nan",                                             true  },
+            { L_,   "-NaN",                                            true  },
+            { L_,   "sNaN",                                            true  },
+
+            { L_,   "",                                                false },
+            { L_,   "-",                                               false },
+            { L_,   ".",                                               false },
+            { L_,   "-.",                                              false },
+            { L_,   "e5",                                              false },
+            { L_,   ".e5",                                             false },
+            { L_,   "1e",                                              false },
+            { L_,   "1e+",                                             false },
+            { L_,   "1e5.5",                                           false },
+            { L_,   "1.2.3",                                           false },
+            { L_,   "--1",                                             false },
+            { L_,   " 1",                                              false },
+            { L_,   "1 ",                                              false },
+            { L_,   "0x10",                                            false },
+            { L_,   "1,5",                                             false },
+            { L_,   "in",                                              false },
+            { L_,   "inff",                                            false },
+            { L_,   "infinit",                                         false },
+            { L_,   "nan1",                                            false },
+            { L_,   "qnan",                                            false },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const bsl::string INPUT    = DATA[ti].d_input;
+            const bool        IS_VALID = DATA[ti].d_isValid;
+
+            // Follow the input by characters that would change its value, to
+            // verify that they are not read.
+
+            const bsl::string       PADDED = INPUT + "12e3";
+            const bslstl::StringRef REF(PADDED.data(),
+                                        static_cast<int>(INPUT.length()));
+
+            Util::ValueType32  v32  = Util::makeDecimalRaw32(7, 0);
+            Util::ValueType64  v64  = Util::makeDecimalRaw64(7, 0);
+            Util::ValueType128 v128 = Util::makeDecimalRaw128(7, 0);
+
+            const Util::ValueType32  ORIGINAL32  = v32;
+            const Util::ValueType64  ORIGINAL64  = v64;
+            const Util::ValueType128 ORIGINAL128 = v128;
+
+            const int rc32  = Util::parse(&v32,  REF);
+            const int rc64  = Util::parse(&v64,  REF);
+            const int rc128 = Util::parse(&v128, REF);
+
+            ASSERTV(LINE, rc32,  IS_VALID == (0 == rc32));
+            ASSERTV(LINE, rc64,  IS_VALID == (0 == rc64));
+            ASSERTV(LINE, rc128, IS_VALID == (0 == rc128));
+
+            if (IS_VALID) {
+                const Util::ValueType32  EXPECTED32  =
+                                                Util::parse32(INPUT.c_str());
+                const Util::ValueType64  EXPECTED64  =
+                                                Util::parse64(INPUT.c_str());
+                const Util::ValueType128 EXPECTED128 =
+                                               Util::parse128(INPUT.c_str());
+
+                ASSERTV(LINE, 0 == bsl::memcmp(&v32,
+                                               &EXPECTED32,
+                                               sizeof v32));
+                ASSERTV(LINE, 0 == bsl::memcmp(&v64,
+                                               &EXPECTED64,
+                                               sizeof v64));
+                ASSERTV(LINE, 0 == bsl::memcmp(&v128,
+                                               &EXPECTED128,
+                                               sizeof v128));
+            }
+            else {
+                ASSERTV(LINE, 0 == bsl::memcmp(&v32,
+                                               &ORIGINAL32,
+                                               sizeof v32));
+                ASSERTV(LINE, 0 == bsl::memcmp(&v64,
+                                               &ORIGINAL64,
+                                               sizeof v64));
+                ASSERTV(LINE, 0 == bsl::memcmp(&v128,
+                                               &ORIGINAL128,
+                                               sizeof v128));
+            }
+        }
+    }
+
+    if (verbose) cout << "\tParsing pseudo-random representations." << endl;
+    {
+        Uint64 state = 0x2545F4914F6CDD1Dull;
+
+        for (int i = 0; i < 20000; ++i) {
+            bsl::string input;
+
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            const int numDigits = static_cast<int>(state % 45);
+            const int point     = static_cast<int>((state >> 8) % 50);
+            if (state & 0x10000) {
+                input += '-';
+            }
+            for (int j = 0; j < numDigits; ++j) {
+                if (j == point) {
+                    input += '.';
+                }
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                input += static_cast<char>('0' + (state % 3 ? state % 10 : 0));
+            }
+            if (0 == numDigits) {
+                input += '0';
+            }
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            if (state % 3) {
+                char exponent[16];
+                sprintf(exponent,
+                        "e%d",
+                        static_cast<int>(state % 13000) - 6500);
+                input += exponent;
+            }
+
+            Util::ValueType32  v32;
+            Util::ValueType64  v64;
+            Util::ValueType128 v128;
+
+            ASSERTV(input, 0 == Util::parse(&v32,  input));
+            ASSERTV(input, 0 == Util::parse(&v64,  input));
+            ASSERTV(input, 0 == Util::parse(&v128, input));
+
+            const Util::ValueType32  EXPECTED32  =
+                                                Util::parse32(input.c_str());
+            const Util::ValueType64  EXPECTED64  =
+                                                Util::parse64(input.c_str());
+            const Util::ValueType128 EXPECTED128 =
+                                               Util::parse128(input.c_str());
+
+            ASSERTV(input, 0 == bsl::memcmp(&v32,  &EXPECTED32,  sizeof v32));
+            ASSERTV(input, 0 == bsl::memcmp(&v64,  &EXPECTED64,  sizeof v64));
+            ASSERTV(input, 0 == bsl::memcmp(&v128,
+                                            &EXPECTED128,
+                                            sizeof v128));
+        }
+    }
+
+    if (verbose) cout << "\tVerifying that no memory is allocated." << endl;
+    {
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const char INPUT[] = "-12345678901234567890.123456789012345e-20";
+
+        Util::ValueType32  v32;
+        Util::ValueType64  v64;
+        Util::ValueType128 v128;
+
+        ASSERT(0 == Util::parse(&v32,  INPUT));
+        ASSERT(0 == Util::parse(&v64,  INPUT));
+        ASSERT(0 == Util::parse(&v128, INPUT));
+
+        char buffer[64];
+
+        ASSERT(0 < Util::format(buffer, sizeof buffer, v32));
+        ASSERT(0 < Util::format(buffer, sizeof buffer, v64));
+        ASSERT(0 < Util::format(buffer, sizeof buffer, v128));
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+    }
+
+    if (verbose) cout << "\tNegative testing." << endl;
+    {
+        AssertFailureHandlerGuard g(bsls::AssertTest::failTestDriver);
+
+        char                     buffer[64];
+        const Util::ValueType64  V   = Util::makeDecimalRaw64(1, 0);
+        const bslstl::StringRef  REF("1");
+        Util::ValueType64        value;
+
+        BSLS_ASSERTTEST_ASSERT_FAIL(Util::format(0,      64, V));
+        BSLS_ASSERTTEST_ASSERT_FAIL(Util::format(buffer, -1, V));
+        BSLS_ASSERTTEST_ASSERT_PASS(Util::format(buffer,  0, V));
+
+        BSLS_ASSERTTEST_ASSERT_FAIL(Util::parse(
+                                       static_cast<Util::ValueType64 *>(0),
+                                       REF));
+        BSLS_ASSERTTEST_ASSERT_PASS(Util::parse(&value, REF));
+    }
+}
+
 void TestDriver::testCase22()
 {
     // ------------------------------------------------------------------------
@@ -7899,6 +8452,9 @@ int main(int argc, char* argv[])
 
 
     switch (test) { case 0:
+      case 24: {
+        TestDriver::testCase24();
+      } break;
       case 23: {
         TestDriver::testCase23();
       } break;
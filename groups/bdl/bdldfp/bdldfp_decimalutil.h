@@ -35,6 +35,9 @@ BSLS_IDENT("$Id$")
 //:
 //: o the 'parseDecimal' functions that convert text to decimal value.
 //:
+//: o the 'parse' and 'format' functions that convert between decimal values
+//:   and character buffers without allocating memory.
+//:
 //: o 'fma', 'fabs', 'ceil', 'floor', 'trunc', 'round' - math functions
 //:
 //: o 'classify' and the 'isXxxx' floating-point value classification functions
@@ -63,6 +66,40 @@ BSLS_IDENT("$Id$")
 //  assert(BDLDFP_DECIMAL_DD(4.2) == d64);
 //  assert(BDLDFP_DECIMAL_DL(4.2) == d128);
 //..
+//
+///Example 2: Formatting and Parsing Prices
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we receive prices as text (e.g., in the fields of a market data
+// message that are not null-terminated), and have to send them on as text.
+// The 'parse' and 'format' functions convert between decimal values and
+// character buffers without allocating memory and without making a copy of
+// the input.
+//
+// First, we parse a price from a field of a message:
+//..
+//  const char *message = "IBM|161.48|100";
+//
+//  Decimal64 price;
+//  int rc = DecimalUtil::parse(&price, bslstl::StringRef(message + 4, 6));
+//  assert(0                          == rc);
+//  assert(BDLDFP_DECIMAL_DD(161.48) == price);
+//..
+// Then, we observe that a field that is not a number is rejected:
+//..
+//  rc = DecimalUtil::parse(&price, bslstl::StringRef(message, 3));
+//  assert(0                          != rc);
+//  assert(BDLDFP_DECIMAL_DD(161.48) == price);
+//..
+// Finally, we format the price, increased by one tick, into a buffer.  Note
+// that the buffer is not null-terminated, and that the quantum of the value
+// (two decimal places) is preserved:
+//..
+//  char buffer[32];
+//  int  length = DecimalUtil::format(buffer,
+//                                    sizeof buffer,
+//                                    price + BDLDFP_DECIMAL_DD(0.01));
+//  assert(bsl::string("161.49") == bsl::string(buffer, length));
+//..
 
 // TODO TBD Priority description:
 //
@@ -87,6 +124,10 @@ BSLS_IDENT("$Id$")
 #include <bsls_platform.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_STRINGREF
+#include <bslstl_stringref.h>
+#endif
+
 #ifndef INCLUDED_BSL_STRING
 #include <bsl_string.h>
 #endif
@@ -193,6 +234,38 @@ struct DecimalUtil {
         // successful and non-zero otherwise.  The value of 'out' is
         // unspecified if the function returns a non-zero value.
 
+    static int parse(Decimal32  *out, const bslstl::StringRef& str);
+    static int parse(Decimal64  *out, const bslstl::StringRef& str);
+    static int parse(Decimal128 *out, const bslstl::StringRef& str);
+        // Load into the specified 'out' the decimal floating point number
+        // represented by the entirety of the specified 'str', rounded if
+        // necessary; return zero if 'str' is a valid representation and
+        // non-zero, with no effect on 'out', otherwise.  A valid
+        // representation consists of an optional sign followed by either a
+        // number in fixed or scientific notation, or one of the
+        // (case-insensitive) strings "inf", "infinity", "nan", or "snan", with
+        // no leading or trailing whitespace.  'str' need not be
+        // null-terminated, and no memory is allocated.  See
+        // 'DecimalImpUtil::parse' for details.
+
+                              // formatting
+
+    static int format(char *buffer, int length, Decimal32  value);
+    static int format(char *buffer, int length, Decimal64  value);
+    static int format(char *buffer, int length, Decimal128 value);
+        // Write the textual representation of the specified 'value' into the
+        // specified 'buffer' having the specified 'length', and return the
+        // length of that representation.  If 'length' is less than the
+        // returned value, the contents of 'buffer' are unspecified.  The
+        // representation is the one written by 'operator<<' for the classic
+        // locale and default formatting flags, except that the exponent
+        // character and the names of the special values are capitalized as
+        // in "1.5E+7", "Infinity", "NaN", and "sNaN".  No terminating null
+        // character is written, and no memory is allocated.  The behavior is
+        // undefined unless 'buffer' is non-null and '0 <= length'.  Note that
+        // a representation is never longer than 15, 24, and 42 characters for
+        // 'Decimal32', 'Decimal64', and 'Decimal128', respectively.
+
 
                                   // math
 
@@ -505,6 +578,57 @@ Decimal64 DecimalUtil::makeDecimal64(unsigned long long significand,
     return DecimalImpUtil::makeDecimal64(significand, exponent);
 }
 
+                             // Parsing functions
+
+inline
+int DecimalUtil::parse(Decimal32 *out, const bslstl::StringRef& str)
+{
+    BSLS_ASSERT(out);
+
+    return DecimalImpUtil::parse(out->data(), str);
+}
+inline
+int DecimalUtil::parse(Decimal64 *out, const bslstl::StringRef& str)
+{
+    BSLS_ASSERT(out);
+
+    return DecimalImpUtil::parse(out->data(), str);
+}
+inline
+int DecimalUtil::parse(Decimal128 *out, const bslstl::StringRef& str)
+{
+    BSLS_ASSERT(out);
+
+    return DecimalImpUtil::parse(out->data(), str);
+}
+
+                             // Formatting functions
+
+inline
+int DecimalUtil::format(char *buffer, int length, Decimal32 value)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 <= length);
+
+    return DecimalImpUtil::format(buffer, length, *value.data());
+}
+inline
+int DecimalUtil::format(char *buffer, int length, Decimal64 value)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 <= length);
+
+    return DecimalImpUtil::format(buffer, length, *value.data());
+}
+inline
+int DecimalUtil::format(char *buffer, int length, Decimal128 value)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 <= length);
+
+    return DecimalImpUtil::format(buffer, length, *value.data());
+}
+
                              // Quantum functions
 
 inline
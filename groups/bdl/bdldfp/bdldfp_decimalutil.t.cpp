@@ -18,6 +18,7 @@
 #include <bsl_climits.h>
 #include <bsl_cmath.h>
 #include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
 #include <bsl_fstream.h>
 #include <bsl_limits.h>
 #include <bsl_iostream.h>
@@ -52,8 +53,15 @@ using bsl::atoi;
 //
 // TRAITS
 // ----------------------------------------------------------------------------
+// [12] int parse(Decimal32  *, const bslstl::StringRef&)
+// [12] int parse(Decimal64  *, const bslstl::StringRef&)
+// [12] int parse(Decimal128 *, const bslstl::StringRef&)
+// [12] int format(char *, int, Decimal32)
+// [12] int format(char *, int, Decimal64)
+// [12] int format(char *, int, Decimal128)
+// ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [  ] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 
@@ -486,6 +494,195 @@ int main(int argc, char* argv[])
 
 
     switch (test) { case 0:
+    case 13: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example 2 from header into test driver, replace
+        //:   leading comment characters with spaces, replace 'assert' with
+        //:   'ASSERT', and insert 'if (veryVerbose)' before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace BDEC;
+
+///Example 2: Formatting and Parsing Prices
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose we receive prices as text (e.g., in the fields of a market data
+// message that are not null-terminated), and have to send them on as text.
+// The 'parse' and 'format' functions convert between decimal values and
+// character buffers without allocating memory and without making a copy of
+// the input.
+//
+// First, we parse a price from a field of a message:
+//..
+        const char *message = "IBM|161.48|100";
+
+        Decimal64 price;
+        int rc = DecimalUtil::parse(&price, bslstl::StringRef(message + 4, 6));
+        ASSERT(0                          == rc);
+        ASSERT(BDLDFP_DECIMAL_DD(161.48) == price);
+//..
+// Then, we observe that a field that is not a number is rejected:
+//..
+        rc = DecimalUtil::parse(&price, bslstl::StringRef(message, 3));
+        ASSERT(0                          != rc);
+        ASSERT(BDLDFP_DECIMAL_DD(161.48) == price);
+//..
+// Finally, we format the price, increased by one tick, into a buffer.  Note
+// that the buffer is not null-terminated, and that the quantum of the value
+// (two decimal places) is preserved:
+//..
+        char buffer[32];
+        int  length = DecimalUtil::format(buffer,
+                                          sizeof buffer,
+                                          price + BDLDFP_DECIMAL_DD(0.01));
+        ASSERT(bsl::string("161.49") == bsl::string(buffer, length));
+//..
+      } break;
+    case 12: {
+        // --------------------------------------------------------------------
+        // TESTING parse AND format
+        // Concerns: Forwarding to the right routines, for each type.
+        // Plan: Parse a set of valid and invalid representations of each
+        //       type, comparing the result with 'parseDecimalNN', and format
+        //       the result, comparing it with the output of 'operator<<'.
+        //       Verify that the default allocator is not used, and that
+        //       defensive checks are triggered for null arguments.
+        // Testing: parse, format
+        // --------------------------------------------------------------------
+        if (verbose) bsl::cout << "parse and format tests..." << bsl::endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_input;
+                bool        d_isValid;
+            } DATA[] = {
+                //LINE  INPUT                                       VALID
+                //----  ------------------------------------------  -----
+                { L_,   "0",                                        true  },
+                { L_,   "-0.00",                                    true  },
+                { L_,   "161.48",                                   true  },
+                { L_,   "-1.5e-3",                                  true  },
+                { L_,   "12345678",                                 true  },
+                { L_,   "12345678901234567",                        true  },
+                { L_,   "1234567890123456789012345678901234567",    true  },
+                { L_,   "1e-400",                                   true  },
+                { L_,   "-1e400",                                   true  },
+                { L_,   "1e7000",                                   true  },
+                { L_,   "Inf",                                      true  },
+                { L_,   "",                                         false },
+                { L_,   "1.5 ",                                     false },
+                { L_,   "1.5x",                                     false },
+                { L_,   "e5",                                       false },
+                { L_,   "nan(1)",                                   false },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            bslma::TestAllocator         da(veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE     = DATA[ti].d_line;
+                const char *INPUT    = DATA[ti].d_input;
+                const bool  IS_VALID = DATA[ti].d_isValid;
+
+                BDEC::Decimal32  v32(7);
+                BDEC::Decimal64  v64(7);
+                BDEC::Decimal128 v128(7);
+
+                LOOP_ASSERT(LINE, IS_VALID == !Util::parse(&v32,  INPUT));
+                LOOP_ASSERT(LINE, IS_VALID == !Util::parse(&v64,  INPUT));
+                LOOP_ASSERT(LINE, IS_VALID == !Util::parse(&v128, INPUT));
+
+                BDEC::Decimal32  e32(7);
+                BDEC::Decimal64  e64(7);
+                BDEC::Decimal128 e128(7);
+
+                if (IS_VALID) {
+                    Util::parseDecimal32( &e32,  INPUT);
+                    Util::parseDecimal64( &e64,  INPUT);
+                    Util::parseDecimal128(&e128, INPUT);
+                }
+
+                LOOP_ASSERT(LINE, 0 == bsl::memcmp(&v32,  &e32,  sizeof v32));
+                LOOP_ASSERT(LINE, 0 == bsl::memcmp(&v64,  &e64,  sizeof v64));
+                LOOP_ASSERT(LINE, 0 == bsl::memcmp(&v128, &e128, sizeof v128));
+
+                char buffer[64];
+                int  length;
+
+                length = Util::format(buffer, sizeof buffer, v32);
+                LOOP_ASSERT(LINE, 0 < length && length <= 15);
+                BDEC::Decimal32 r32;
+                LOOP_ASSERT(LINE, 0 == Util::parse(
+                                           &r32,
+                                           bslstl::StringRef(buffer, length)));
+                LOOP_ASSERT(LINE, 0 == bsl::memcmp(&r32, &v32, sizeof r32));
+
+                length = Util::format(buffer, sizeof buffer, v64);
+                LOOP_ASSERT(LINE, 0 < length && length <= 24);
+                BDEC::Decimal64 r64;
+                LOOP_ASSERT(LINE, 0 == Util::parse(
+                                           &r64,
+                                           bslstl::StringRef(buffer, length)));
+                LOOP_ASSERT(LINE, 0 == bsl::memcmp(&r64, &v64, sizeof r64));
+
+                length = Util::format(buffer, sizeof buffer, v128);
+                LOOP_ASSERT(LINE, 0 < length && length <= 42);
+                BDEC::Decimal128 r128;
+                LOOP_ASSERT(LINE, 0 == Util::parse(
+                                           &r128,
+                                           bslstl::StringRef(buffer, length)));
+                LOOP_ASSERT(LINE, 0 == bsl::memcmp(&r128, &v128, sizeof r128));
+            }
+
+            LOOP_ASSERT(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+        }
+
+        if (verbose) bsl::cout << "format matches operator<<..." << bsl::endl;
+        {
+            const BDEC::Decimal64 VALUE = Util::makeDecimal64(-16148, -2);
+
+            char buffer[64];
+            const int length = Util::format(buffer, sizeof buffer, VALUE);
+
+            bsl::ostringstream out(pa);
+            out << bsl::uppercase << VALUE;
+            LOOP_ASSERT(out.str(), out.str() == bsl::string(buffer, length));
+        }
+
+        if (verbose) bsl::cout << "negative tests..." << bsl::endl;
+        {
+            AssertFailureHandlerGuard g(bsls::AssertTest::failTestDriver);
+
+            char                  buffer[64];
+            const BDEC::Decimal64 VALUE(1);
+            BDEC::Decimal64       value;
+
+            BSLS_ASSERTTEST_ASSERT_FAIL(Util::format(0,      64, VALUE));
+            BSLS_ASSERTTEST_ASSERT_FAIL(Util::format(buffer, -1, VALUE));
+            BSLS_ASSERTTEST_ASSERT_PASS(Util::format(buffer,  0, VALUE));
+
+            BDEC::Decimal64 *const NULL_VALUE = 0;
+
+            BSLS_ASSERTTEST_ASSERT_FAIL(Util::parse(NULL_VALUE, "1"));
+            BSLS_ASSERTTEST_ASSERT_PASS(Util::parse(&value,     "1"));
+        }
+      } break;
     case 11: {
         // --------------------------------------------------------------------
         // TESTING multiplyByPowerOf10
@@ -0,0 +1,154 @@
+// bdlma_sharedptrreppool.cpp                                         -*-C++-*-
+#include <bdlma_sharedptrreppool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_sharedptrreppool_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+namespace {
+
+int pooledBlockSize(int blockSize, int headerSize)
+    // Return the size of the blocks to be obtained from the underlying pool
+    // for the specified 'blockSize', each preceded by a header of the
+    // specified 'headerSize'.  The returned size is a multiple of the maximum
+    // alignment, so that, since the chunks of a 'bdlma::Pool' are maximally
+    // aligned, so is every block dispensed by the pool (and the address
+    // following its header).
+{
+    return static_cast<int>(bsls::AlignmentUtil::roundUpToMaximalAlignment(
+                                                      blockSize + headerSize));
+}
+
+}  // close unnamed namespace
+
+                         // --------------------------
+                         // class SharedPtrRepPool_Imp
+                         // --------------------------
+
+// CREATORS
+SharedPtrRepPool_Imp::SharedPtrRepPool_Imp(int               blockSize,
+                                           bslma::Allocator *basicAllocator)
+: d_blockSize(blockSize)
+, d_pool(pooledBlockSize(blockSize, static_cast<int>(sizeof(Header))),
+         basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+, d_freeList_p(0)
+, d_releasedList(0)
+{
+    BSLS_ASSERT(1 <= blockSize);
+}
+
+SharedPtrRepPool_Imp::~SharedPtrRepPool_Imp()
+{
+    // The blocks on both free lists are owned by 'd_pool', which returns them
+    // to the underlying allocator on destruction.
+}
+
+// MANIPULATORS
+void *SharedPtrRepPool_Imp::allocate(size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                size > static_cast<size_type>(d_blockSize))) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // The request cannot be satisfied by a pooled block (e.g., it is made
+        // by a member of an allocator-aware object created by
+        // 'bsl::allocate_shared'), so forward it to the upstream allocator.
+
+        Header *header = static_cast<Header *>(
+                               d_allocator_p->allocate(size + sizeof(Header)));
+        header->d_isOversize = 1;
+        return header + 1;                                            // RETURN
+    }
+
+    Header *header;
+    {
+        bsls::BslLockGuard guard(&d_lock);
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == d_freeList_p)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            // Adopt every block released since the private list was last
+            // replenished.  No other thread removes blocks from
+            // 'd_releasedList', so the detached list is not subject to ABA.
+
+            d_freeList_p = d_releasedList.swapAcqRel(0);
+        }
+
+        if (d_freeList_p) {
+            Link *block  = d_freeList_p;
+            d_freeList_p = block->d_next_p;
+            header       = reinterpret_cast<Header *>(block);
+        }
+        else {
+            header = static_cast<Header *>(d_pool.allocate());
+        }
+    }
+
+    header->d_isOversize = 0;
+    return header + 1;
+}
+
+void SharedPtrRepPool_Imp::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    Header *header = static_cast<Header *>(address) - 1;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(header->d_isOversize)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        d_allocator_p->deallocate(header);
+        return;                                                       // RETURN
+    }
+
+    Link *block = reinterpret_cast<Link *>(header);
+    Link *head;
+
+    do {
+        head            = d_releasedList.loadRelaxed();
+        block->d_next_p = head;
+    } while (head != d_releasedList.testAndSwapAcqRel(head, block));
+}
+
+void SharedPtrRepPool_Imp::reserveCapacity(int numBlocks)
+{
+    BSLS_ASSERT(0 <= numBlocks);
+
+    bsls::BslLockGuard guard(&d_lock);
+
+    d_pool.reserveCapacity(numBlocks);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
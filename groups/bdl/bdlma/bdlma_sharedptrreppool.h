@@ -0,0 +1,391 @@
+// bdlma_sharedptrreppool.h                                           -*-C++-*-
+#ifndef INCLUDED_BDLMA_SHAREDPTRREPPOOL
+#define INCLUDED_BDLMA_SHAREDPTRREPPOOL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a per-type pool of in-place shared pointer representations.
+//
+//@CLASSES:
+//  bdlma::SharedPtrRepPool: pool allocator for in-place 'shared_ptr' reps
+//
+//@SEE_ALSO: bdlma_pool, bslma_sharedptrinplacerep, bslstl_sharedptr
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bdlma::SharedPtrRepPool', that implements the 'bslma::Allocator' protocol
+// and dispenses memory blocks just large enough to hold the in-place
+// representation of a 'bsl::shared_ptr<ELEMENT_TYPE>', i.e., the block
+// allocated by a single call to 'bsl::shared_ptr::createInplace' or
+// 'bsl::allocate_shared'.  Shared pointers created with a pool as their
+// allocator draw their combined representation-and-object footprint from the
+// pool, and return it to the pool when the last reference is released, so
+// that steady-state creation of shared objects of a given type performs no
+// allocation from the general-purpose heap:
+//..
+//   ,-----------------------.
+//  ( bdlma::SharedPtrRepPool )
+//   `-----------------------'
+//              |         ctor/dtor
+//              |         reserveCapacity
+//              |         blockSize
+//              V
+//     ,----------------.
+//    ( bslma::Allocator )
+//     `----------------'
+//                        allocate
+//                        deallocate
+//..
+// Memory is obtained from an underlying 'bdlma::Pool' (see 'bdlma_pool'),
+// which in turn obtains memory in geometrically growing chunks from the
+// allocator supplied at construction.  A block that is deallocated is kept by
+// the pool for reuse, and is *never* returned to the underlying allocator
+// before the pool is destroyed.  Consequently, the memory footprint of a pool
+// is bounded by the largest number of shared objects of 'ELEMENT_TYPE' that
+// were simultaneously alive during its lifetime.
+//
+///Cross-Thread Release
+///--------------------
+// The last reference to a shared object is frequently released by a thread
+// other than the one that created it (e.g., a message created by a producer
+// and released by a consumer).  'bdlma::Pool' is not thread-safe, so a
+// 'bdlma::SharedPtrRepPool' keeps two free lists in front of it:
+//
+//: o Blocks passed to 'deallocate' are pushed onto a lock-free list using a
+//:   single compare-and-swap; 'deallocate' never blocks, and may be called
+//:   concurrently from any number of threads.
+//:
+//: o 'allocate' acquires a lock, takes a block from a private free list if
+//:   one is available, and otherwise detaches the *entire* lock-free list in
+//:   a single atomic exchange to become the new private free list.  Only when
+//:   both lists are empty is a new block taken from the underlying pool.
+//
+// Since blocks are only ever removed from the lock-free list all at once,
+// the list is not subject to the ABA problem that afflicts lock-free stacks
+// supporting concurrent single-element removal.
+//
+///In-Place Representation Types
+///-----------------------------
+// 'bsl::shared_ptr::createInplace' allocates a
+// 'bslma::SharedPtrInplaceRep<ELEMENT_TYPE>' from the supplied allocator,
+// whereas 'bsl::allocate_shared' allocates a (slightly larger)
+// 'bslstl::SharedPtrAllocateInplaceRep'.  The block size of a
+// 'bdlma::SharedPtrRepPool<ELEMENT_TYPE>' accommodates either, so both may be
+// used with the same pool.  Note that 'bsl::allocate_shared' passes its
+// allocator to the constructor of an 'ELEMENT_TYPE' that uses 'bslma'
+// allocators, so that the members of the object then allocate from the pool
+// as well.  Requests for more than 'blockSize' bytes are forwarded to the
+// allocator supplied at construction (and returned to it on deallocation),
+// so this is correct, but such types are better created with
+// 'createInplace' and supplied (as a constructor argument) an allocator
+// suitable for their members.
+//
+///Thread Safety
+///-------------
+// The 'allocate' and 'deallocate' methods of 'bdlma::SharedPtrRepPool' are
+// fully thread-safe (see 'bsldoc_glossary') provided that the allocator
+// supplied at construction is fully thread-safe.  'reserveCapacity' is also
+// thread-safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Pooling Shared Market-Data Events
+///--------------------------------------------
+// Suppose that a feed handler publishes each incoming market-data update as a
+// 'bsl::shared_ptr<Event>' to a set of subscribers, and that creating the
+// shared representation for every message is the dominant source of small
+// allocations in the process.
+//
+// First, we define a simple 'Event' type:
+//..
+//  struct Event {
+//      // This 'struct' holds a single market-data update.
+//
+//      int    d_instrumentId;
+//      double d_price;
+//
+//      Event(int instrumentId, double price)
+//      : d_instrumentId(instrumentId)
+//      , d_price(price)
+//      {
+//      }
+//  };
+//..
+// Then, we create a pool for the representations of shared 'Event' objects,
+// supplying it with an upstream allocator from which it obtains its memory:
+//..
+//  bslma::TestAllocator upstream;
+//
+//  bdlma::SharedPtrRepPool<Event> pool(&upstream);
+//..
+// Next, we create a shared 'Event' in place using the pool, and observe that
+// the pool obtained memory from the upstream allocator to do so:
+//..
+//  bsl::shared_ptr<Event> event;
+//  event.createInplace(&pool, 17, 101.25);
+//
+//  assert(17     == event->d_instrumentId);
+//  assert(101.25 == event->d_price);
+//
+//  const bsls::Types::Int64 numUpstreamAllocations =
+//                                                  upstream.numAllocations();
+//  assert(0 < numUpstreamAllocations);
+//..
+// Then, we release the event; its footprint is returned to the pool, not to
+// the upstream allocator:
+//..
+//  event.reset();
+//  assert(0 < upstream.numBlocksInUse());
+//..
+// Now, we publish a stream of events, holding two at a time, using both
+// 'createInplace' and 'bsl::allocate_shared':
+//..
+//  for (int i = 0; i < 1000; ++i) {
+//      bsl::shared_ptr<Event> a;
+//      a.createInplace(&pool, i, 1.0);
+//
+//      bsl::shared_ptr<Event> b = bsl::allocate_shared<Event>(&pool, i, 2.0);
+//
+//      assert(i == a->d_instrumentId);
+//      assert(i == b->d_instrumentId);
+//  }
+//..
+// Finally, we observe that the only allocations from the upstream allocator
+// are those needed to hold the largest number of simultaneously live events:
+//..
+//  assert(numUpstreamAllocations + 1 >= upstream.numAllocations());
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLMA_POOL
+#include <bdlma_pool.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_SHAREDPTRINPLACEREP
+#include <bslma_sharedptrinplacerep.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_BSLLOCK
+#include <bsls_bsllock.h>
+#endif
+
+#ifndef INCLUDED_BSL_MEMORY
+#include <bsl_memory.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                         // ==========================
+                         // class SharedPtrRepPool_Imp
+                         // ==========================
+
+class SharedPtrRepPool_Imp : public bslma::Allocator {
+    // This class implements a thread-safe pool of memory blocks of a size
+    // fixed at construction, in which 'deallocate' is lock-free.  This class
+    // provides the implementation of 'SharedPtrRepPool' that does not depend
+    // on its template parameter, and should not be used directly.
+
+    // PRIVATE TYPES
+    union Header {
+        // This 'union' precedes each allocated memory block, and records
+        // whether the block was obtained from 'd_pool' or, being larger than
+        // 'blockSize()', directly from the allocator supplied at
+        // construction.
+
+        int                                 d_isOversize;  // non-zero if not
+                                                           // pooled
+
+        bsls::AlignmentUtil::MaxAlignedType d_dummy;       // force maximum
+                                                           // alignment
+    };
+
+    struct Link {
+        // This 'struct' overlays the header of a free memory block.
+
+        Link *d_next_p;  // next free block
+    };
+
+    // DATA
+    bsls::BslLock             d_lock;          // guards 'd_pool' and
+                                               // 'd_freeList_p'
+
+    int                       d_blockSize;     // size of the blocks
+                                               // dispensed, excluding
+                                               // their header
+
+    Pool                      d_pool;          // source of new blocks
+
+    bslma::Allocator         *d_allocator_p;   // source of oversize blocks
+                                               // (held, not owned)
+
+    Link                     *d_freeList_p;    // blocks available to
+                                               // 'allocate'
+
+    bsls::AtomicPointer<Link> d_releasedList;  // blocks released by
+                                               // 'deallocate'
+
+  private:
+    // NOT IMPLEMENTED
+    SharedPtrRepPool_Imp(const SharedPtrRepPool_Imp&);
+    SharedPtrRepPool_Imp& operator=(const SharedPtrRepPool_Imp&);
+
+  public:
+    // CREATORS
+    SharedPtrRepPool_Imp(int blockSize, bslma::Allocator *basicAllocator);
+        // Create a pool dispensing memory blocks of the specified 'blockSize'
+        // (in bytes).  Use the specified 'basicAllocator' to supply memory.
+        // If 'basicAllocator' is 0, the currently installed default allocator
+        // is used.  The behavior is undefined unless '1 <= blockSize'.
+
+    virtual ~SharedPtrRepPool_Imp();
+        // Destroy this pool, returning all memory it has obtained to the
+        // allocator supplied at construction.  The behavior is undefined
+        // unless all blocks allocated from this pool have been deallocated.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return the address of a maximally-aligned memory block of at least
+        // the specified 'size' (in bytes) if 'size' is positive, and 0
+        // otherwise.  A block of 'blockSize()' bytes is taken from this pool
+        // if 'size <= blockSize()'; otherwise, the block is obtained from
+        // the allocator supplied at construction.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' to this pool for
+        // reuse, or, if it was larger than 'blockSize()', to the allocator
+        // supplied at construction.  If 'address' is 0, this function has no
+        // effect.  This method does not block unless the block is returned
+        // to the allocator supplied at construction.  The behavior is
+        // undefined unless 'address' was allocated from this pool and has not
+        // already been deallocated.
+
+    void reserveCapacity(int numBlocks);
+        // Reserve memory from this pool to satisfy memory requests for at
+        // least the specified 'numBlocks' before the pool replenishes from
+        // the allocator supplied at construction.  The behavior is undefined
+        // unless '0 <= numBlocks'.
+
+    // ACCESSORS
+    int blockSize() const;
+        // Return the size (in bytes) of the memory blocks dispensed by this
+        // pool.
+};
+
+                           // ======================
+                           // class SharedPtrRepPool
+                           // ======================
+
+template <class ELEMENT_TYPE>
+class SharedPtrRepPool : public SharedPtrRepPool_Imp {
+    // This class provides a thread-safe pool of memory blocks sized to hold
+    // the in-place representation of a 'bsl::shared_ptr' to an object of
+    // (template parameter) 'ELEMENT_TYPE', as created by
+    // 'bsl::shared_ptr::createInplace' or 'bsl::allocate_shared'.  Blocks
+    // are returned to the pool, not to the allocator supplied at
+    // construction, when the last reference to the shared object is released
+    // (from any thread).
+
+    // PRIVATE TYPES
+    typedef bslma::SharedPtrInplaceRep<ELEMENT_TYPE>       InplaceRep;
+    typedef bslstl::SharedPtrAllocateInplaceRep<
+                                       ELEMENT_TYPE,
+                                       bsl::allocator<ELEMENT_TYPE> >
+                                                           AllocateInplaceRep;
+
+  public:
+    // PUBLIC CLASS DATA
+    enum {
+        k_BLOCK_SIZE = sizeof(InplaceRep) < sizeof(AllocateInplaceRep)
+                     ? sizeof(AllocateInplaceRep)
+                     : sizeof(InplaceRep)
+                                   // size of the blocks dispensed by the pool
+    };
+
+  private:
+    // NOT IMPLEMENTED
+    SharedPtrRepPool(const SharedPtrRepPool&);
+    SharedPtrRepPool& operator=(const SharedPtrRepPool&);
+
+  public:
+    // CREATORS
+    explicit
+    SharedPtrRepPool(bslma::Allocator *basicAllocator = 0);
+        // Create a pool of in-place representations for shared objects of
+        // (template parameter) 'ELEMENT_TYPE'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    //! virtual ~SharedPtrRepPool() = default;
+        // Destroy this pool, returning all memory it has obtained to the
+        // allocator supplied at construction.  The behavior is undefined
+        // unless no shared object created using this pool is still alive.
+};
+
+// ============================================================================
+//                         INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                         // --------------------------
+                         // class SharedPtrRepPool_Imp
+                         // --------------------------
+
+// ACCESSORS
+inline
+int SharedPtrRepPool_Imp::blockSize() const
+{
+    return d_blockSize;
+}
+
+                           // ----------------------
+                           // class SharedPtrRepPool
+                           // ----------------------
+
+// CREATORS
+template <class ELEMENT_TYPE>
+inline
+SharedPtrRepPool<ELEMENT_TYPE>::SharedPtrRepPool(
+                                              bslma::Allocator *basicAllocator)
+: SharedPtrRepPool_Imp(k_BLOCK_SIZE, basicAllocator)
+{
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
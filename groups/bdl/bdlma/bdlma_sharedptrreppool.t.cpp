@@ -0,0 +1,921 @@
+// bdlma_sharedptrreppool.t.cpp                                       -*-C++-*-
+#include <bdlma_sharedptrreppool.h>
+
+#include <bdls_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_sharedptrinplacerep.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::SharedPtrRepPool' is a thread-safe pool allocator dispensing blocks
+// large enough to hold the in-place representation of a 'bsl::shared_ptr' to
+// an object of its template parameter type.  The primary concerns are that
+// deallocated blocks are reused rather than returned to the underlying
+// allocator, that blocks released from any thread become available to
+// 'allocate', and that shared pointers created with 'createInplace' and
+// 'bsl::allocate_shared' obtain their representations from the pool.  We make
+// heavy use of 'bslma::TestAllocator' to verify the traffic to the underlying
+// allocator.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] SharedPtrRepPool(bslma::Allocator *basicAllocator = 0);
+// [ 2] ~SharedPtrRepPool();
+//
+// MANIPULATORS
+// [ 2] void *allocate(size_type size);
+// [ 2] void deallocate(void *address);
+// [ 3] void reserveCapacity(int numBlocks);
+//
+// ACCESSORS
+// [ 2] int blockSize() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [ 4] CONCERN: 'createInplace' and 'allocate_shared' draw from the pool.
+// [ 5] CONCERN: Blocks may be released from any thread.
+// [ 2] CONCERN: Requests exceeding 'blockSize' are forwarded upstream.
+// [ 2] CONCERN: Every block returned is maximally aligned.
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+//-----------------------------------------------------------------------------
+
+struct Event {
+    // This 'struct' holds a single market-data update.
+
+    int    d_instrumentId;
+    double d_price;
+
+    Event(int instrumentId, double price)
+    : d_instrumentId(instrumentId)
+    , d_price(price)
+    {
+    }
+};
+
+typedef bdlma::SharedPtrRepPool<Event> Obj;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+// ============================================================================
+//                  HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+bool isMaximallyAligned(const void *address)
+    // Return 'true' if the specified 'address' is aligned to
+    // 'bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT', and 'false' otherwise.
+{
+    return 0 == reinterpret_cast<bsls::Types::UintPtr>(address)
+                                   % bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+}
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+namespace TestCase5 {
+
+enum { k_NUM_THREADS = 4, k_NUM_OBJECTS = 64, k_NUM_ITERATIONS = 2000 };
+
+struct ThreadInfo {
+    int                     d_id;         // index of the set of objects
+
+    Obj                    *d_pool_p;     // pool (held, not owned)
+
+    bsl::shared_ptr<Event> *d_objects_p;  // 'k_NUM_OBJECTS' shared objects
+                                          // created by another thread
+};
+
+extern "C" void *threadFunction(void *arg)
+    // Repeatedly release the shared objects handed to this thread (created by
+    // another thread) and replace them with new objects created using the
+    // pool, verifying the value of each object before it is released.
+{
+    ThreadInfo *info = static_cast<ThreadInfo *>(arg);
+
+    bsl::shared_ptr<Event> *objects = info->d_objects_p;
+
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        const int j = i % k_NUM_OBJECTS;
+
+        ASSERTV(info->d_id, j, objects[j]->d_instrumentId,
+                info->d_id == objects[j]->d_instrumentId);
+        ASSERTV(info->d_id, j, objects[j]->d_price, j == objects[j]->d_price);
+
+        objects[j].reset();
+
+        if (i % 2) {
+            objects[j].createInplace(info->d_pool_p, info->d_id, j);
+        }
+        else {
+            objects[j] = bsl::allocate_shared<Event>(info->d_pool_p,
+                                                     info->d_id,
+                                                     j);
+        }
+    }
+
+    return arg;
+}
+
+}  // close namespace TestCase5
+
+// ============================================================================
+//                                MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+// Then, we create a pool for the representations of shared 'Event' objects,
+// supplying it with an upstream allocator from which it obtains its memory:
+//..
+    bslma::TestAllocator upstream;
+
+    bdlma::SharedPtrRepPool<Event> pool(&upstream);
+//..
+// Next, we create a shared 'Event' in place using the pool, and observe that
+// the pool obtained memory from the upstream allocator to do so:
+//..
+    bsl::shared_ptr<Event> event;
+    event.createInplace(&pool, 17, 101.25);
+
+    ASSERT(17     == event->d_instrumentId);
+    ASSERT(101.25 == event->d_price);
+
+    const bsls::Types::Int64 numUpstreamAllocations =
+                                                    upstream.numAllocations();
+    ASSERT(0 < numUpstreamAllocations);
+//..
+// Then, we release the event; its footprint is returned to the pool, not to
+// the upstream allocator:
+//..
+    event.reset();
+    ASSERT(0 < upstream.numBlocksInUse());
+//..
+// Now, we publish a stream of events, holding two at a time, using both
+// 'createInplace' and 'bsl::allocate_shared':
+//..
+    for (int i = 0; i < 1000; ++i) {
+        bsl::shared_ptr<Event> a;
+        a.createInplace(&pool, i, 1.0);
+
+        bsl::shared_ptr<Event> b = bsl::allocate_shared<Event>(&pool, i, 2.0);
+
+        ASSERT(i == a->d_instrumentId);
+        ASSERT(i == b->d_instrumentId);
+    }
+//..
+// Finally, we observe that the only allocations from the upstream allocator
+// are those needed to hold the largest number of simultaneously live events:
+//..
+    ASSERT(numUpstreamAllocations + 1 >= upstream.numAllocations());
+//..
+
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CROSS-THREAD RELEASE
+        //   Ensure that blocks may be released from any thread.
+        //
+        // Concerns:
+        //: 1 Shared objects created using the pool in one thread may be
+        //:   released in another thread, concurrently with allocation from
+        //:   the pool in other threads.
+        //:
+        //: 2 Blocks released from other threads are reused by 'allocate'.
+        //:
+        //: 3 No block is dispensed to two live objects at once.
+        //
+        // Plan:
+        //: 1 Create, in the main thread, a set of shared objects using the
+        //:   pool for each of several threads, tagging each object with the
+        //:   index of its thread and its slot.
+        //:
+        //: 2 In each of several rounds, hand each set of objects to a
+        //:   different thread, which repeatedly verifies the tag of an object,
+        //:   releases it, and replaces it with a new object created (in that
+        //:   thread) using the pool.  (C-1, 3)
+        //:
+        //: 3 After joining the threads, verify that the number of blocks
+        //:   obtained from the pool's underlying allocator is bounded by the
+        //:   number of simultaneously live objects, and that recreating that
+        //:   many objects obtains no further memory.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: Blocks may be released from any thread.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CROSS-THREAD RELEASE" << endl
+                          << "====================" << endl;
+
+        using namespace TestCase5;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator         sa("supplied", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX(&sa);
+
+            bsl::shared_ptr<Event> objects[k_NUM_THREADS][k_NUM_OBJECTS];
+            ThreadInfo             infos[k_NUM_THREADS];
+
+            for (int t = 0; t < k_NUM_THREADS; ++t) {
+                for (int j = 0; j < k_NUM_OBJECTS; ++j) {
+                    objects[t][j].createInplace(&mX, t, j);
+                }
+            }
+
+            const bsls::Types::Int64 BYTES = sa.numBytesInUse();
+
+            for (int round = 0; round < 5; ++round) {
+                // Hand each set of objects to a different thread than in the
+                // previous round, so that objects are released by a thread
+                // other than the one that created them.
+
+                ThreadId ids[k_NUM_THREADS];
+                for (int t = 0; t < k_NUM_THREADS; ++t) {
+                    const int set = (t + round) % k_NUM_THREADS;
+
+                    infos[t].d_id        = set;
+                    infos[t].d_pool_p    = &mX;
+                    infos[t].d_objects_p = objects[set];
+
+                    ids[t] = createThread(&threadFunction, &infos[t]);
+                }
+                for (int t = 0; t < k_NUM_THREADS; ++t) {
+                    joinThread(ids[t]);
+                }
+
+                // At most 'k_NUM_THREADS' additional blocks are live while
+                // objects are being replaced; the pool grows by chunks of at
+                // most 32 blocks.
+
+                ASSERTV(round, BYTES, sa.numBytesInUse(),
+                        sa.numBytesInUse() <= 2 * BYTES);
+            }
+
+            for (int t = 0; t < k_NUM_THREADS; ++t) {
+                for (int j = 0; j < k_NUM_OBJECTS; ++j) {
+                    ASSERTV(t, j, t == objects[t][j]->d_instrumentId);
+                    objects[t][j].reset();
+                }
+            }
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = sa.numAllocations();
+
+            for (int t = 0; t < k_NUM_THREADS; ++t) {
+                for (int j = 0; j < k_NUM_OBJECTS; ++j) {
+                    objects[t][j].createInplace(&mX, t, j);
+                }
+            }
+            ASSERTV(NUM_ALLOCATIONS, sa.numAllocations(),
+                    NUM_ALLOCATIONS == sa.numAllocations());
+        }
+
+        ASSERT(0 == sa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SHARED POINTER CREATION
+        //   Ensure that shared pointers draw their representations from the
+        //   pool and return them on last release.
+        //
+        // Concerns:
+        //: 1 'k_BLOCK_SIZE' accommodates the representations created by both
+        //:   'createInplace' and 'bsl::allocate_shared'.
+        //:
+        //: 2 A shared object created using the pool obtains its footprint from
+        //:   the pool, and returns it to the pool when the last shared or weak
+        //:   reference is released.
+        //:
+        //: 3 After warm-up, creating shared objects obtains no memory from the
+        //:   underlying allocator.
+        //
+        // Plan:
+        //: 1 Compare 'k_BLOCK_SIZE' with the size of each representation
+        //:   type.  (C-1)
+        //:
+        //: 2 Create shared objects using the pool, holding shared and weak
+        //:   references in various orders, and verify that the block is
+        //:   reused only after the last reference is released.  (C-2)
+        //:
+        //: 3 Verify the allocation count of the underlying allocator after a
+        //:   warm-up period.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: 'createInplace' and 'allocate_shared' draw from the pool.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SHARED POINTER CREATION" << endl
+                          << "=======================" << endl;
+
+        typedef bslma::SharedPtrInplaceRep<Event>                 InplaceRep;
+        typedef bslstl::SharedPtrAllocateInplaceRep<Event,
+                                                    bsl::allocator<Event> >
+                                                          AllocateInplaceRep;
+
+        ASSERT(sizeof(InplaceRep)         <= Obj::k_BLOCK_SIZE);
+        ASSERT(sizeof(AllocateInplaceRep) <= Obj::k_BLOCK_SIZE);
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator         sa("supplied", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        {
+            Obj mX(&sa);
+
+            if (verbose) cout << "\tLast release by a weak pointer." << endl;
+
+            const void *address;
+            {
+                bsl::shared_ptr<Event> p;
+                p.createInplace(&mX, 1, 2.0);
+                address = p.rep();
+
+                bsl::weak_ptr<Event> w(p);
+                p.reset();
+
+                // The object is destroyed, but its footprint remains in use.
+
+                bsl::shared_ptr<Event> q;
+                q.createInplace(&mX, 3, 4.0);
+                ASSERT(address != q.rep());
+            }
+            {
+                bsl::shared_ptr<Event> p;
+                p.createInplace(&mX, 5, 6.0);
+
+                // The block released last (by 'w') is reused first.
+
+                ASSERT(address == p.rep());
+            }
+
+            if (verbose) cout << "\tSteady state." << endl;
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = sa.numAllocations();
+
+            for (int i = 0; i < 100; ++i) {
+                bsl::shared_ptr<Event> p =
+                                 bsl::allocate_shared<Event>(&mX, i, i + 0.5);
+                bsl::shared_ptr<Event> q;
+                q.createInplace(&mX, -i, 0.25);
+
+                ASSERTV(i,  i == p->d_instrumentId);
+                ASSERTV(i, -i == q->d_instrumentId);
+            }
+            ASSERTV(NUM_ALLOCATIONS, sa.numAllocations(),
+                    NUM_ALLOCATIONS == sa.numAllocations());
+        }
+
+        ASSERT(0 == sa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'reserveCapacity'
+        //
+        // Concerns:
+        //: 1 'reserveCapacity(n)' obtains memory for at least 'n' blocks, so
+        //:   that the next 'n' allocations obtain no memory from the
+        //:   underlying allocator.
+        //:
+        //: 2 'reserveCapacity(0)' has no effect.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a range of 'n', reserve 'n' blocks in a new pool, then
+        //:   allocate 'n' blocks and verify that the number of allocations
+        //:   from the underlying allocator is unchanged.  (C-1, 2)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a negative argument.  (C-3)
+        //
+        // Testing:
+        //   void reserveCapacity(int numBlocks);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'reserveCapacity'" << endl
+                          << "=================" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        for (int n = 0; n < 70; n += 3) {
+            Obj mX(&sa);
+
+            mX.reserveCapacity(n);
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = sa.numAllocations();
+            ASSERTV(n, (0 == n) == (0 == NUM_ALLOCATIONS));
+
+            void *blocks[70];
+            for (int i = 0; i < n; ++i) {
+                blocks[i] = mX.allocate(Obj::k_BLOCK_SIZE);
+            }
+            ASSERTV(n, NUM_ALLOCATIONS == sa.numAllocations());
+
+            for (int i = 0; i < n; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(&sa);
+
+            ASSERT_FAIL(mX.reserveCapacity(-1));
+            ASSERT_PASS(mX.reserveCapacity( 0));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CTOR, 'allocate', 'deallocate', AND 'blockSize'
+        //
+        // Concerns:
+        //: 1 The pool uses the allocator supplied at construction, or the
+        //:   default allocator if none is supplied.
+        //:
+        //: 2 'blockSize' returns 'k_BLOCK_SIZE'.
+        //:
+        //: 3 'allocate' returns distinct, writable blocks of 'blockSize'
+        //:   bytes, and 0 for a request of 0 bytes.
+        //:
+        //: 4 A deallocated block is reused by a subsequent 'allocate', and is
+        //:   not returned to the underlying allocator.
+        //:
+        //: 5 'deallocate(0)' has no effect.
+        //:
+        //: 6 All memory is returned to the underlying allocator on
+        //:   destruction.
+        //:
+        //: 7 A request exceeding 'blockSize' is satisfied by a distinct,
+        //:   writable block obtained from the underlying allocator, and is
+        //:   returned to it on deallocation without disturbing pooled blocks.
+        //:
+        //: 8 Every block returned by 'allocate', pooled or not, is maximally
+        //:   aligned, whatever the size of the blocks of the pool.
+        //
+        // Plan:
+        //: 1 Create pools with and without a supplied allocator, and verify
+        //:   which allocator supplies memory.  (C-1)
+        //:
+        //: 2 Allocate and fill a set of blocks, verify that the blocks do not
+        //:   overlap, deallocate them in various orders, and verify that
+        //:   reallocation obtains the same blocks without obtaining memory
+        //:   from the underlying allocator.  (C-2..5)
+        //:
+        //: 3 Verify that no memory is in use in the underlying allocator
+        //:   after the pool is destroyed.  (C-6)
+        //:
+        //: 4 Interleave oversize and pooled requests, fill each block, and
+        //:   verify the allocations and deallocations seen by the underlying
+        //:   allocator.  (C-7)
+        //:
+        //: 5 Verify that every block returned, from pools having block sizes
+        //:   that are not multiples of the maximum alignment, is maximally
+        //:   aligned.  (C-8)
+        //
+        // Testing:
+        //   SharedPtrRepPool(bslma::Allocator *basicAllocator = 0);
+        //   ~SharedPtrRepPool();
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   int blockSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CTOR, 'allocate', 'deallocate', AND 'blockSize'"
+                          << endl
+                          << "==============================================="
+                          << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator         sa("supplied", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\tAllocator selection." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(Obj::k_BLOCK_SIZE == X.blockSize());
+
+            void *p = mX.allocate(1);
+            ASSERT(0 != p);
+            ASSERT(0 <  da.numBlocksInUse());
+
+            mX.deallocate(p);
+        }
+        ASSERT(0 == da.numBlocksInUse());
+        {
+            Obj mX(&sa);
+
+            void *p = mX.allocate(Obj::k_BLOCK_SIZE);
+            ASSERT(0 != p);
+            ASSERT(0 <  sa.numBlocksInUse());
+            ASSERT(0 == da.numBlocksInUse());
+
+            mX.deallocate(p);
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+
+        if (verbose) cout << "\tZero-sized requests." << endl;
+        {
+            Obj mX(&sa);
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = sa.numAllocations();
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+
+            ASSERT(NUM_ALLOCATIONS == sa.numAllocations());
+        }
+
+        if (verbose) cout << "\tBlock reuse." << endl;
+        {
+            enum { k_NUM_BLOCKS = 20 };
+
+            const int SIZE = Obj::k_BLOCK_SIZE;
+
+            Obj mX(&sa);
+
+            char *blocks[k_NUM_BLOCKS];
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                blocks[i] = static_cast<char *>(mX.allocate(SIZE));
+                ASSERTV(i, isMaximallyAligned(blocks[i]));
+                bsl::memset(blocks[i], i, SIZE);
+            }
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                for (int j = 0; j < SIZE; ++j) {
+                    ASSERTV(i, j, i == blocks[i][j]);
+                }
+            }
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = sa.numAllocations();
+            const bsls::Types::Int64 NUM_BYTES       = sa.numBytesInUse();
+
+            for (int round = 0; round < 3; ++round) {
+                // Deallocate the even blocks, then the odd blocks.
+
+                for (int i = 0; i < k_NUM_BLOCKS; i += 2) {
+                    mX.deallocate(blocks[i]);
+                }
+                for (int i = 1; i < k_NUM_BLOCKS; i += 2) {
+                    mX.deallocate(blocks[i]);
+                }
+                ASSERTV(round, NUM_BYTES == sa.numBytesInUse());
+
+                char *newBlocks[k_NUM_BLOCKS];
+                for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                    newBlocks[i] = static_cast<char *>(mX.allocate(SIZE));
+
+                    bool found = false;
+                    for (int j = 0; j < k_NUM_BLOCKS; ++j) {
+                        if (newBlocks[i] == blocks[j]) {
+                            found = true;
+                        }
+                    }
+                    ASSERTV(round, i, found);
+
+                    for (int j = 0; j < i; ++j) {
+                        ASSERTV(round, i, j, newBlocks[i] != newBlocks[j]);
+                    }
+                }
+                bsl::memcpy(blocks, newBlocks, sizeof blocks);
+            }
+            ASSERT(NUM_ALLOCATIONS == sa.numAllocations());
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+
+        if (verbose) cout << "\tOversize requests." << endl;
+        {
+            const int SIZE     = Obj::k_BLOCK_SIZE;
+            const int BIG_SIZE = 4 * Obj::k_BLOCK_SIZE + 1;
+
+            Obj mX(&sa);
+
+            char *small = static_cast<char *>(mX.allocate(SIZE));
+            bsl::memset(small, 's', SIZE);
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = sa.numAllocations();
+            const bsls::Types::Int64 NUM_BLOCKS      = sa.numBlocksInUse();
+
+            char *big = static_cast<char *>(mX.allocate(BIG_SIZE));
+            ASSERT(0 != big);
+            ASSERT(isMaximallyAligned(big));
+            ASSERT(NUM_ALLOCATIONS + 1 == sa.numAllocations());
+            ASSERT(NUM_BLOCKS      + 1 == sa.numBlocksInUse());
+            ASSERT(BIG_SIZE < sa.lastAllocatedNumBytes());
+
+            bsl::memset(big, 'b', BIG_SIZE);
+            for (int j = 0; j < SIZE; ++j) {
+                ASSERTV(j, 's' == small[j]);
+            }
+
+            mX.deallocate(small);
+            ASSERT(NUM_BLOCKS + 1 == sa.numBlocksInUse());
+
+            for (int j = 0; j < BIG_SIZE; ++j) {
+                ASSERTV(j, 'b' == big[j]);
+            }
+
+            mX.deallocate(big);
+            ASSERT(NUM_BLOCKS == sa.numBlocksInUse());
+
+            // The pooled block is reused, not obtained anew.
+
+            ASSERT(small == mX.allocate(SIZE));
+            ASSERT(NUM_ALLOCATIONS + 1 == sa.numAllocations());
+
+            mX.deallocate(small);
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+        {
+            // An allocator-aware object created by 'bsl::allocate_shared'
+            // allocates its members from the pool.
+
+            typedef bsl::vector<char> Vector;
+
+            bdlma::SharedPtrRepPool<Vector> mX(&sa);
+
+            const Vector::size_type LENGTH = 4 * mX.blockSize() + 1;
+            {
+                bsl::shared_ptr<Vector> p =
+                              bsl::allocate_shared<Vector>(&mX, LENGTH, 'v');
+                ASSERT(LENGTH == p->size());
+                ASSERT('v'    == (*p)[LENGTH - 1]);
+            }
+            ASSERT(0 < sa.numBlocksInUse());
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+
+        if (verbose) cout << "\tAlignment." << endl;
+        {
+            enum { k_NUM_BLOCKS = 50 };
+
+            bdlma::SharedPtrRepPool<char>    mA(&sa);
+            bdlma::SharedPtrRepPool<Event>   mB(&sa);
+            bdlma::SharedPtrRepPool<char[3]> mC(&sa);
+
+            bslma::Allocator *const POOLS[]   = { &mA, &mB, &mC };
+            const int               SIZES[]   = { mA.blockSize(),
+                                                  mB.blockSize(),
+                                                  mC.blockSize() };
+            const int               NUM_POOLS = sizeof SIZES / sizeof *SIZES;
+
+            for (int ti = 0; ti < NUM_POOLS; ++ti) {
+                const int SIZE = SIZES[ti];
+
+                void *blocks[k_NUM_BLOCKS];
+                for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                    const int REQUEST = i % 5 ? 1 + i % SIZE : 2 * SIZE;
+
+                    blocks[i] = POOLS[ti]->allocate(REQUEST);
+                    ASSERTV(ti, i, isMaximallyAligned(blocks[i]));
+                    bsl::memset(blocks[i], 'a', REQUEST);
+                }
+                for (int i = 0; i < k_NUM_BLOCKS; i += 2) {
+                    POOLS[ti]->deallocate(blocks[i]);
+                    blocks[i] = POOLS[ti]->allocate(SIZE);
+                    ASSERTV(ti, i, isMaximallyAligned(blocks[i]));
+                }
+                for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                    POOLS[ti]->deallocate(blocks[i]);
+                }
+            }
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a pool, allocate and deallocate blocks, and create and
+        //:   release a shared object using the pool.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+        {
+            Obj mX(&sa);
+
+            void *b1 = mX.allocate(Obj::k_BLOCK_SIZE);
+            mX.deallocate(b1);
+
+            void *b2 = mX.allocate(Obj::k_BLOCK_SIZE);
+            ASSERT(b1 == b2);
+
+            void *b3 = mX.allocate(Obj::k_BLOCK_SIZE);
+            ASSERT(b2 != b3);
+
+            mX.deallocate(b2);
+            mX.deallocate(b3);
+
+            bsl::shared_ptr<Event> p;
+            p.createInplace(&mX, 7, 8.5);
+            ASSERT(7   == p->d_instrumentId);
+            ASSERT(8.5 == p->d_price);
+            ASSERT(b3  == p.rep());
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
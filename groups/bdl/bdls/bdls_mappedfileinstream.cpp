@@ -0,0 +1,371 @@
+// bdls_mappedfileinstream.cpp                                        -*-C++-*-
+#include <bdls_mappedfileinstream.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdls_mappedfileinstream_cpp,"$Id$ $CSID$")
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+#include <windows.h>    // 'CreateFileA', 'CreateFileMappingA',
+                        // 'MapViewOfFile', 'UnmapViewOfFile', 'CloseHandle',
+                        // 'GetFileSizeEx', 'GetSystemInfo'
+#else
+
+#include <fcntl.h>      // 'open'
+#include <sys/mman.h>   // 'mmap', 'munmap', 'posix_madvise'
+#include <sys/stat.h>   // 'fstat'
+#include <unistd.h>     // 'close', 'sysconf'
+
+#endif
+
+///IMPLEMENTATION NOTES
+///--------------------
+// A region of a file can only be mapped starting at an offset that is a
+// multiple of the allocation granularity of the platform (the page size on
+// Unix, typically 64K on Windows).  'MappedFileInStream_Mapping::map'
+// therefore maps the view starting at the requested offset rounded down to
+// such a multiple, and returns the address within the view corresponding to
+// the requested offset.
+
+namespace BloombergLP {
+
+namespace {
+
+bsls::Types::Int64 allocationGranularity()
+    // Return the granularity (in bytes) of the offsets at which a view of a
+    // file may be mapped.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwAllocationGranularity;
+
+#else
+
+    return sysconf(_SC_PAGESIZE);
+
+#endif
+}
+
+}  // close unnamed namespace
+
+namespace bdls {
+
+                      // --------------------------------
+                      // class MappedFileInStream_Mapping
+                      // --------------------------------
+
+// CREATORS
+MappedFileInStream_Mapping::MappedFileInStream_Mapping()
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+: d_file_p(0)
+, d_fileMapping_p(0)
+#else
+: d_fileDescriptor(-1)
+#endif
+, d_view_p(0)
+, d_viewLength(0)
+, d_fileSize(0)
+{
+}
+
+MappedFileInStream_Mapping::~MappedFileInStream_Mapping()
+{
+    close();
+}
+
+// MANIPULATORS
+void MappedFileInStream_Mapping::close()
+{
+    unmap();
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    if (d_fileMapping_p) {
+        CloseHandle(d_fileMapping_p);
+        d_fileMapping_p = 0;
+    }
+    if (d_file_p) {
+        CloseHandle(d_file_p);
+        d_file_p = 0;
+    }
+
+#else
+
+    if (-1 != d_fileDescriptor) {
+        ::close(d_fileDescriptor);
+        d_fileDescriptor = -1;
+    }
+
+#endif
+
+    d_fileSize = 0;
+}
+
+int MappedFileInStream_Mapping::map(const char         **data,
+                                    bsls::Types::Int64   offset,
+                                    bsl::size_t          length)
+{
+    BSLS_ASSERT(data);
+    BSLS_ASSERT(isOpen());
+    BSLS_ASSERT(0 <= offset);
+    BSLS_ASSERT(offset + static_cast<bsls::Types::Int64>(length)
+                                                              <= d_fileSize);
+
+    unmap();
+
+    *data = 0;
+
+    if (0 == length) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsls::Types::Int64 viewOffset = offset
+                                        - offset % allocationGranularity();
+    const bsl::size_t        viewLength = length
+                                   + static_cast<bsl::size_t>(offset
+                                                              - viewOffset);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    void *view = MapViewOfFile(d_fileMapping_p,
+                               FILE_MAP_READ,
+                               static_cast<DWORD>(viewOffset >> 32),
+                               static_cast<DWORD>(viewOffset & 0xFFFFFFFF),
+                               viewLength);
+    if (0 == view) {
+        return -1;                                                    // RETURN
+    }
+
+    // Windows has no counterpart to 'posix_madvise' for mapped views; the
+    // file was instead opened with 'FILE_FLAG_SEQUENTIAL_SCAN'.
+
+#else
+
+    void *view = mmap(0,
+                      viewLength,
+                      PROT_READ,
+                      MAP_SHARED,
+                      d_fileDescriptor,
+                      static_cast<off_t>(viewOffset));
+    if (MAP_FAILED == view) {
+        return -1;                                                    // RETURN
+    }
+
+    // The advice is a hint only, so failures are ignored.
+
+    posix_madvise(view, viewLength, POSIX_MADV_SEQUENTIAL);
+    posix_madvise(view, viewLength, POSIX_MADV_WILLNEED);
+
+#endif
+
+    d_view_p     = view;
+    d_viewLength = viewLength;
+
+    *data = static_cast<const char *>(view) + (offset - viewOffset);
+
+    return 0;
+}
+
+int MappedFileInStream_Mapping::open(const char *filePath)
+{
+    BSLS_ASSERT(filePath);
+
+    close();
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    HANDLE file = CreateFileA(filePath,
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              0,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL
+                                                  | FILE_FLAG_SEQUENTIAL_SCAN,
+                              0);
+    if (INVALID_HANDLE_VALUE == file) {
+        return -1;                                                    // RETURN
+    }
+    d_file_p = file;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        close();
+        return -2;                                                    // RETURN
+    }
+    d_fileSize = size.QuadPart;
+
+    // A file-mapping object cannot be created for an empty file.
+
+    if (0 < d_fileSize) {
+        d_fileMapping_p = CreateFileMappingA(file, 0, PAGE_READONLY, 0, 0, 0);
+        if (0 == d_fileMapping_p) {
+            close();
+            return -3;                                                // RETURN
+        }
+    }
+
+#else
+
+    const int fd = ::open(filePath, O_RDONLY);
+    if (-1 == fd) {
+        return -1;                                                    // RETURN
+    }
+    d_fileDescriptor = fd;
+
+    struct stat status;
+    if (0 != fstat(fd, &status)) {
+        close();
+        return -2;                                                    // RETURN
+    }
+
+    if (!S_ISREG(status.st_mode)) {
+        close();
+        return -3;                                                    // RETURN
+    }
+    d_fileSize = status.st_size;
+
+#endif
+
+    return 0;
+}
+
+void MappedFileInStream_Mapping::unmap()
+{
+    if (d_view_p) {
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+        UnmapViewOfFile(d_view_p);
+#else
+        munmap(static_cast<char *>(d_view_p), d_viewLength);
+#endif
+        d_view_p     = 0;
+        d_viewLength = 0;
+    }
+}
+
+                          // ------------------------
+                          // class MappedFileInStream
+                          // ------------------------
+
+// MANIPULATORS
+void MappedFileInStream::close()
+{
+    d_stream.reset(0, 0);
+    d_mapping.close();
+}
+
+int MappedFileInStream::open(const char *filePath)
+{
+    BSLS_ASSERT(filePath);
+
+    close();
+
+    if (0 != d_mapping.open(filePath)) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsls::Types::Uint64 size = d_mapping.fileSize();
+
+    if (size > static_cast<bsl::size_t>(-1)) {
+        // The file does not fit in the address space.
+
+        d_mapping.close();
+        return -2;                                                    // RETURN
+    }
+
+    const char *data;
+    if (0 != d_mapping.map(&data, 0, static_cast<bsl::size_t>(size))) {
+        d_mapping.close();
+        return -3;                                                    // RETURN
+    }
+
+    d_stream.reset(data, static_cast<bsl::size_t>(size));
+
+    return 0;
+}
+
+                      // -------------------------------
+                      // class ChunkedMappedFileInStream
+                      // -------------------------------
+
+// PRIVATE MANIPULATORS
+int ChunkedMappedFileInStream::mapWindow()
+{
+    const bsls::Types::Int64 remaining = d_mapping.fileSize()
+                                       - d_windowOffset;
+    const bsl::size_t        length    =
+                    remaining < static_cast<bsls::Types::Int64>(d_windowSize)
+                    ? static_cast<bsl::size_t>(remaining)
+                    : d_windowSize;
+
+    const char *data;
+    if (0 != d_mapping.map(&data, d_windowOffset, length)) {
+        close();
+        return -1;                                                    // RETURN
+    }
+
+    d_stream.reset(data, length);
+
+    return 0;
+}
+
+// MANIPULATORS
+int ChunkedMappedFileInStream::advance(bsl::size_t numBytes)
+{
+    BSLS_ASSERT(isOpen());
+    BSLS_ASSERT(numBytes <= d_stream.length());
+
+    if (0 == numBytes) {
+        return 0;                                                     // RETURN
+    }
+
+    d_windowOffset += numBytes;
+
+    return mapWindow();
+}
+
+void ChunkedMappedFileInStream::close()
+{
+    d_stream.reset(0, 0);
+    d_mapping.close();
+    d_windowOffset = 0;
+}
+
+int ChunkedMappedFileInStream::open(const char *filePath)
+{
+    BSLS_ASSERT(filePath);
+
+    close();
+
+    if (0 != d_mapping.open(filePath)) {
+        return -1;                                                    // RETURN
+    }
+
+    return mapWindow();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
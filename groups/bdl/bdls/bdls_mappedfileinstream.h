@@ -0,0 +1,546 @@
+// bdls_mappedfileinstream.h                                          -*-C++-*-
+#ifndef INCLUDED_BDLS_MAPPEDFILEINSTREAM
+#define INCLUDED_BDLS_MAPPEDFILEINSTREAM
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide BDEX input streams reading memory-mapped files.
+//
+//@CLASSES:
+//  bdls::MappedFileInStream: 'bslx::ByteInStream' over a mapped file
+//  bdls::ChunkedMappedFileInStream: 'bslx::ByteInStream' over a mapped window
+//
+//@SEE_ALSO: bslx_byteinstream, bslx_byteoutstream
+//
+//@DESCRIPTION: This component provides two mechanisms that map a file
+// read-only into memory and expose the mapped content through a
+// 'bslx::ByteInStream', so that BDEX-externalized data can be unexternalized
+// directly from a file without first reading the file into an intermediate
+// buffer.  Pages of the file are brought into memory by the operating system
+// as they are accessed; the mapping is advised as being accessed sequentially
+// and as being needed soon, so that the operating system reads ahead of the
+// consumer.
+//
+// 'bdls::MappedFileInStream' maps an entire file, and its 'stream' presents
+// the whole content of the file.  This is the simplest choice when the
+// address space of the process can accommodate the file.
+//
+// 'bdls::ChunkedMappedFileInStream' maps a *window* of the file, of at most a
+// fixed size supplied at construction, and its 'stream' presents the content
+// of that window.  The 'advance' method moves the start of the window forward
+// by a number of bytes (typically the number of bytes consumed from 'stream')
+// and remaps it, so that a file of any size can be read within a bounded
+// amount of address space.  Because a 'bslx::ByteInStream' cannot read past
+// the end of its buffer, a value that extends beyond the end of a window is
+// not available until the window is advanced past the start of that value;
+// the window size must therefore be at least the size of the largest
+// externalized value that is read as a unit.  Usage example 2 shows the
+// resulting reading pattern.
+//
+// Both mechanisms map the file as it is when it is opened; the behavior is
+// undefined if the file is truncated while it is open.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Loading a Snapshot File
+/// - - - - - - - - - - - - - - - - -
+// Suppose we keep a snapshot of an application's state in a file holding a
+// sequence of records, each being an 'int' identifier followed by a string,
+// externalized using 'bslx::ByteOutStream', and that the identifier -1 marks
+// the end of the snapshot.  (The file was written earlier; its name is held
+// in 'filePath'.)
+//
+// First, we open the file using a 'bdls::MappedFileInStream':
+//..
+//  bdls::MappedFileInStream mappedFile;
+//  int rc = mappedFile.open(filePath);
+//  assert(0 == rc);
+//..
+// Then, we read the records directly from the mapped file:
+//..
+//  bslx::ByteInStream& in = mappedFile.stream();
+//
+//  int         numRecords = 0;
+//  int         id;
+//  bsl::string name;
+//  while (in.getInt32(id) && -1 != id && in.getString(name)) {
+//      ++numRecords;
+//  }
+//  assert(in);
+//  assert(in.isEmpty());
+//  assert(3 == numRecords);
+//  assert("third" == name);
+//..
+// Finally, we close the file, which unmaps it:
+//..
+//  mappedFile.close();
+//  assert(!mappedFile.isOpen());
+//..
+//
+///Example 2: Loading a Snapshot File in Chunks
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Now suppose the snapshot file of example 1 is too large to be mapped in its
+// entirety.  We read it through a window of (an unrealistically small) 16
+// bytes using a 'bdls::ChunkedMappedFileInStream'.
+//
+// First, we open the file:
+//..
+//  bdls::ChunkedMappedFileInStream chunkedFile(16);
+//  rc = chunkedFile.open(filePath);
+//  assert(0 == rc);
+//..
+// Then, we read the records.  When a record is not entirely in the current
+// window, reading it invalidates the stream; we then advance the window to
+// the start of that record and read the record again:
+//..
+//  numRecords = 0;
+//  while (true) {
+//      bslx::ByteInStream& in     = chunkedFile.stream();
+//      const bsl::size_t   cursor = in.cursor();
+//
+//      if (in.getInt32(id) && (-1 == id || in.getString(name))) {
+//          if (-1 == id) {
+//              break;
+//          }
+//          ++numRecords;
+//      }
+//      else {
+//          assert(!chunkedFile.isLastWindow());
+//          assert(0 < cursor);  // the window is large enough for a record
+//
+//          rc = chunkedFile.advance(cursor);
+//          assert(0 == rc);
+//      }
+//  }
+//  assert(3 == numRecords);
+//  assert("third" == name);
+//..
+// Finally, we verify that the whole file was read:
+//..
+//  assert(chunkedFile.isLastWindow());
+//  assert(chunkedFile.stream().isEmpty());
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLX_BYTEINSTREAM
+#include <bslx_byteinstream.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+namespace BloombergLP {
+namespace bdls {
+
+                      // ================================
+                      // class MappedFileInStream_Mapping
+                      // ================================
+
+class MappedFileInStream_Mapping {
+    // This component-private class provides a mechanism that owns a file
+    // opened for reading and, optionally, a read-only mapping of a region of
+    // that file.  This class should not be used directly by clients.
+
+    // DATA
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    void               *d_file_p;          // open file ('HANDLE'), or 0
+
+    void               *d_fileMapping_p;   // file-mapping object ('HANDLE'),
+                                           // or 0
+#else
+    int                 d_fileDescriptor;  // open file, or -1
+#endif
+
+    void               *d_view_p;          // address of mapped view, or 0
+
+    bsl::size_t         d_viewLength;      // length of mapped view (in bytes)
+
+    bsls::Types::Int64  d_fileSize;        // size of open file (in bytes)
+
+  private:
+    // NOT IMPLEMENTED
+    MappedFileInStream_Mapping(const MappedFileInStream_Mapping&);
+    MappedFileInStream_Mapping& operator=(const MappedFileInStream_Mapping&);
+
+  public:
+    // CREATORS
+    MappedFileInStream_Mapping();
+        // Create a mapping object having no open file.
+
+    ~MappedFileInStream_Mapping();
+        // Unmap the mapped region, if any, close the open file, if any, and
+        // destroy this object.
+
+    // MANIPULATORS
+    void close();
+        // Unmap the mapped region, if any, and close the open file, if any.
+
+    int map(const char         **data,
+            bsls::Types::Int64   offset,
+            bsl::size_t          length);
+        // Replace the mapped region, if any, with a read-only mapping of the
+        // specified 'length' bytes of the open file starting at the specified
+        // 'offset', advised as being read sequentially and needed soon, and
+        // load into the specified 'data' the address of the first of those
+        // bytes.  Return 0 on success, and a non-zero value (with no region
+        // mapped) otherwise.  If 'length' is 0, nothing is mapped and 0 is
+        // loaded into 'data'.  The behavior is undefined unless 'isOpen()',
+        // '0 <= offset', and 'offset + length <= fileSize()'.
+
+    int open(const char *filePath);
+        // Close the open file, if any, and open the file at the specified
+        // 'filePath' for reading.  Return 0 on success, and a non-zero value
+        // (with no file open) otherwise.
+
+    void unmap();
+        // Unmap the mapped region, if any.
+
+    // ACCESSORS
+    bsls::Types::Int64 fileSize() const;
+        // Return the size (in bytes) of the open file, or 0 if there is no
+        // open file.
+
+    bool isOpen() const;
+        // Return 'true' if this object has an open file, and 'false'
+        // otherwise.
+};
+
+                          // ========================
+                          // class MappedFileInStream
+                          // ========================
+
+class MappedFileInStream {
+    // This class provides a mechanism that maps an entire file read-only into
+    // memory and exposes its content through a 'bslx::ByteInStream'.
+
+    // DATA
+    MappedFileInStream_Mapping d_mapping;  // open file and its mapping
+
+    bslx::ByteInStream         d_stream;   // stream over the mapped file
+
+  private:
+    // NOT IMPLEMENTED
+    MappedFileInStream(const MappedFileInStream&);
+    MappedFileInStream& operator=(const MappedFileInStream&);
+
+  public:
+    // CREATORS
+    MappedFileInStream();
+        // Create an object having no open file and an empty stream.
+
+    ~MappedFileInStream();
+        // Close the open file, if any, and destroy this object.
+
+    // MANIPULATORS
+    void close();
+        // Unmap and close the open file, if any, and reset 'stream()' to be
+        // empty.
+
+    int open(const char *filePath);
+        // Close the open file, if any, open the file at the specified
+        // 'filePath', map its entire content, and reset 'stream()' to read
+        // that content from the beginning.  Return 0 on success, and a
+        // non-zero value (with no file open and an empty 'stream()')
+        // otherwise.  Note that opening an empty file succeeds.
+
+    bslx::ByteInStream& stream();
+        // Return a reference providing modifiable access to the stream
+        // reading the content of the open file.  The stream is empty if no
+        // file is open.  The behavior is undefined if the stream is reset to
+        // use another buffer.
+
+    // ACCESSORS
+    bsls::Types::Int64 fileSize() const;
+        // Return the size (in bytes) of the open file, or 0 if no file is
+        // open.
+
+    bool isOpen() const;
+        // Return 'true' if this object has an open file, and 'false'
+        // otherwise.
+
+    const bslx::ByteInStream& stream() const;
+        // Return a reference providing non-modifiable access to the stream
+        // reading the content of the open file.
+};
+
+                      // ===============================
+                      // class ChunkedMappedFileInStream
+                      // ===============================
+
+class ChunkedMappedFileInStream {
+    // This class provides a mechanism that maps a window of bounded size of a
+    // file read-only into memory, exposes the content of the window through a
+    // 'bslx::ByteInStream', and moves the window forward on request.
+
+  public:
+    // TYPES
+    enum { k_DEFAULT_WINDOW_SIZE = 64 * 1024 * 1024 };
+        // default maximum size (in bytes) of a window
+
+  private:
+    // DATA
+    MappedFileInStream_Mapping d_mapping;       // open file and the mapping
+                                                // of the current window
+
+    bslx::ByteInStream         d_stream;        // stream over the current
+                                                // window
+
+    bsls::Types::Int64         d_windowOffset;  // offset in the file of the
+                                                // current window
+
+    bsl::size_t                d_windowSize;    // maximum size of a window
+
+  private:
+    // NOT IMPLEMENTED
+    ChunkedMappedFileInStream(const ChunkedMappedFileInStream&);
+    ChunkedMappedFileInStream& operator=(const ChunkedMappedFileInStream&);
+
+    // PRIVATE MANIPULATORS
+    int mapWindow();
+        // Map the window of the open file starting at 'd_windowOffset', and
+        // reset 'd_stream' to read its content.  Return 0 on success, and a
+        // non-zero value (with no file open and an empty 'd_stream')
+        // otherwise.
+
+  public:
+    // CREATORS
+    explicit
+    ChunkedMappedFileInStream(
+                            bsl::size_t windowSize = k_DEFAULT_WINDOW_SIZE);
+        // Create an object having no open file and an empty stream.
+        // Optionally specify a 'windowSize' that is the maximum size (in
+        // bytes) of the window of the file presented by 'stream()'.  If
+        // 'windowSize' is not specified, 'k_DEFAULT_WINDOW_SIZE' is used.  The
+        // behavior is undefined unless '0 < windowSize'.
+
+    ~ChunkedMappedFileInStream();
+        // Close the open file, if any, and destroy this object.
+
+    // MANIPULATORS
+    int advance(bsl::size_t numBytes);
+        // Move the start of the window of the open file forward by the
+        // specified 'numBytes', map the window, which extends for
+        // 'windowSize()' bytes or to the end of the file, whichever comes
+        // first, and reset 'stream()' to read the content of the window from
+        // the beginning.  Return 0 on success, and a non-zero value (with no
+        // file open and an empty 'stream()') otherwise.  If 'numBytes' is 0,
+        // this method has no effect.  The behavior is undefined unless
+        // 'isOpen()' and 'numBytes <= stream().length()'.  Note that
+        // 'stream().cursor()' is a typical value for 'numBytes'.
+
+    void close();
+        // Unmap and close the open file, if any, and reset 'stream()' to be
+        // empty.
+
+    int open(const char *filePath);
+        // Close the open file, if any, open the file at the specified
+        // 'filePath', map the window at its start, and reset 'stream()' to
+        // read the content of the window from the beginning.  Return 0 on
+        // success, and a non-zero value (with no file open and an empty
+        // 'stream()') otherwise.
+
+    bslx::ByteInStream& stream();
+        // Return a reference providing modifiable access to the stream
+        // reading the content of the current window.  The stream is empty if
+        // no file is open.  The behavior is undefined if the stream is reset
+        // to use another buffer.
+
+    // ACCESSORS
+    bsls::Types::Int64 fileSize() const;
+        // Return the size (in bytes) of the open file, or 0 if no file is
+        // open.
+
+    bool isLastWindow() const;
+        // Return 'true' if the current window extends to the end of the open
+        // file or if no file is open, and 'false' otherwise.
+
+    bool isOpen() const;
+        // Return 'true' if this object has an open file, and 'false'
+        // otherwise.
+
+    const bslx::ByteInStream& stream() const;
+        // Return a reference providing non-modifiable access to the stream
+        // reading the content of the current window.
+
+    bsls::Types::Int64 windowOffset() const;
+        // Return the offset (in bytes) in the open file of the start of the
+        // current window, or 0 if no file is open.
+
+    bsl::size_t windowSize() const;
+        // Return the maximum size (in bytes) of a window.
+};
+
+// ============================================================================
+//                         INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                      // --------------------------------
+                      // class MappedFileInStream_Mapping
+                      // --------------------------------
+
+// ACCESSORS
+inline
+bsls::Types::Int64 MappedFileInStream_Mapping::fileSize() const
+{
+    return d_fileSize;
+}
+
+inline
+bool MappedFileInStream_Mapping::isOpen() const
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return 0 != d_file_p;
+#else
+    return -1 != d_fileDescriptor;
+#endif
+}
+
+                          // ------------------------
+                          // class MappedFileInStream
+                          // ------------------------
+
+// CREATORS
+inline
+MappedFileInStream::MappedFileInStream()
+: d_mapping()
+, d_stream()
+{
+}
+
+inline
+MappedFileInStream::~MappedFileInStream()
+{
+}
+
+// MANIPULATORS
+inline
+bslx::ByteInStream& MappedFileInStream::stream()
+{
+    return d_stream;
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 MappedFileInStream::fileSize() const
+{
+    return d_mapping.fileSize();
+}
+
+inline
+bool MappedFileInStream::isOpen() const
+{
+    return d_mapping.isOpen();
+}
+
+inline
+const bslx::ByteInStream& MappedFileInStream::stream() const
+{
+    return d_stream;
+}
+
+                      // -------------------------------
+                      // class ChunkedMappedFileInStream
+                      // -------------------------------
+
+// CREATORS
+inline
+ChunkedMappedFileInStream::ChunkedMappedFileInStream(bsl::size_t windowSize)
+: d_mapping()
+, d_stream()
+, d_windowOffset(0)
+, d_windowSize(windowSize)
+{
+    BSLS_ASSERT_SAFE(0 < windowSize);
+}
+
+inline
+ChunkedMappedFileInStream::~ChunkedMappedFileInStream()
+{
+}
+
+// MANIPULATORS
+inline
+bslx::ByteInStream& ChunkedMappedFileInStream::stream()
+{
+    return d_stream;
+}
+
+// ACCESSORS
+inline
+bsls::Types::Int64 ChunkedMappedFileInStream::fileSize() const
+{
+    return d_mapping.fileSize();
+}
+
+inline
+bool ChunkedMappedFileInStream::isLastWindow() const
+{
+    return d_windowOffset + static_cast<bsls::Types::Int64>(d_stream.length())
+                                                      == d_mapping.fileSize();
+}
+
+inline
+bool ChunkedMappedFileInStream::isOpen() const
+{
+    return d_mapping.isOpen();
+}
+
+inline
+const bslx::ByteInStream& ChunkedMappedFileInStream::stream() const
+{
+    return d_stream;
+}
+
+inline
+bsls::Types::Int64 ChunkedMappedFileInStream::windowOffset() const
+{
+    return d_windowOffset;
+}
+
+inline
+bsl::size_t ChunkedMappedFileInStream::windowSize() const
+{
+    return d_windowSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1217 @@
+// bdls_mappedfileinstream.t.cpp                                      -*-C++-*-
+#include <bdls_mappedfileinstream.h>
+
+#include <bdls_testutil.h>
+
+#include <bslx_byteinstream.h>
+#include <bslx_byteoutstream.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_fstream.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+# include <windows.h>   // 'GetTempPath', 'GetTempFileName', 'MAX_PATH'
+#else
+# include <limits.h>    // 'PATH_MAX'
+# include <stdlib.h>    // 'mkstemp'
+# include <unistd.h>    // 'close', 'sysconf'
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides two mechanisms that expose the content of
+// a memory-mapped file, or of a window of it, through a 'bslx::ByteInStream',
+// and a component-private class that owns the open file and its mapping.  We
+// create temporary files having known content and sizes chosen around the
+// system page size, and verify that the bytes presented by the streams are
+// those of the files, for windows at every offset of interest.  Finally, we
+// verify that a sequence of BDEX-externalized records read through windows of
+// various sizes is the same as when read through the whole-file stream.
+//-----------------------------------------------------------------------------
+//                    // --------------------------------
+//                    // class MappedFileInStream_Mapping
+//                    // --------------------------------
+// [ 2] MappedFileInStream_Mapping();
+// [ 2] ~MappedFileInStream_Mapping();
+// [ 2] void close();
+// [ 2] int map(const char **data, Int64 offset, bsl::size_t length);
+// [ 2] int open(const char *filePath);
+// [ 2] void unmap();
+// [ 2] bsls::Types::Int64 fileSize() const;
+// [ 2] bool isOpen() const;
+//
+//                        // ------------------------
+//                        // class MappedFileInStream
+//                        // ------------------------
+// [ 3] MappedFileInStream();
+// [ 3] ~MappedFileInStream();
+// [ 3] void close();
+// [ 3] int open(const char *filePath);
+// [ 3] bslx::ByteInStream& stream();
+// [ 3] bsls::Types::Int64 fileSize() const;
+// [ 3] bool isOpen() const;
+// [ 3] const bslx::ByteInStream& stream() const;
+//
+//                    // -------------------------------
+//                    // class ChunkedMappedFileInStream
+//                    // -------------------------------
+// [ 4] ChunkedMappedFileInStream(bsl::size_t windowSize = DEFAULT);
+// [ 4] ~ChunkedMappedFileInStream();
+// [ 4] int advance(bsl::size_t numBytes);
+// [ 4] void close();
+// [ 4] int open(const char *filePath);
+// [ 4] bslx::ByteInStream& stream();
+// [ 4] bsls::Types::Int64 fileSize() const;
+// [ 4] bool isLastWindow() const;
+// [ 4] bool isOpen() const;
+// [ 4] const bslx::ByteInStream& stream() const;
+// [ 4] bsls::Types::Int64 windowOffset() const;
+// [ 4] bsl::size_t windowSize() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] READING RECORDS THROUGH WINDOWS
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+//-----------------------------------------------------------------------------
+
+//=============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BDLS_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BDLS_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BDLS_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BDLS_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BDLS_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BDLS_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BDLS_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BDLS_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BDLS_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BDLS_TESTUTIL_ASSERTV
+
+#define Q   BDLS_TESTUTIL_Q   // Quote identifier literally.
+#define P   BDLS_TESTUTIL_P   // Print identifier and value.
+#define P_  BDLS_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BDLS_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BDLS_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL VARIABLES / TYPEDEF FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdls::MappedFileInStream_Mapping Mapping;
+typedef bdls::MappedFileInStream         Obj;
+typedef bdls::ChunkedMappedFileInStream  ChunkedObj;
+
+static int verbose, veryVerbose, veryVeryVerbose;
+
+//=============================================================================
+//                       GLOBAL HELPER CLASSES FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace {
+
+int pageSize()
+    // Return the granularity (in bytes) of the offsets at which a view of a
+    // file may be mapped, which is the system page size on Unix.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return static_cast<int>(info.dwAllocationGranularity);
+#else
+    return static_cast<int>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+class TempFile {
+    // This class provides a mechanism that creates a temporary file having
+    // specified content, and removes it on destruction.
+
+    // DATA
+    bsl::string d_name;  // name of the file
+
+    // NOT IMPLEMENTED
+    TempFile(const TempFile&);
+    TempFile& operator=(const TempFile&);
+
+  public:
+    // CREATORS
+    explicit TempFile(const bsl::string& content);
+        // Create a temporary file having the specified 'content'.
+
+    ~TempFile();
+        // Remove the file and destroy this object.
+
+    // ACCESSORS
+    const char *name() const;
+        // Return the name of the file.
+};
+
+TempFile::TempFile(const bsl::string& content)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    char directory[MAX_PATH];
+    char name[MAX_PATH];
+    ASSERT(0 != GetTempPathA(MAX_PATH, directory));
+    ASSERT(0 != GetTempFileNameA(directory, "bdls", 0, name));
+    d_name = name;
+#else
+    char name[] = "/tmp/bdls_mappedfileinstream.XXXXXX";
+    const int fd = mkstemp(name);
+    ASSERT(-1 != fd);
+    ::close(fd);
+    d_name = name;
+#endif
+
+    if (veryVeryVerbose) { T_ P(d_name) }
+
+    bsl::ofstream file(d_name.c_str(), bsl::ios::out | bsl::ios::binary);
+    file.write(content.data(), content.size());
+    ASSERT(file);
+}
+
+TempFile::~TempFile()
+{
+    bsl::remove(d_name.c_str());
+}
+
+const char *TempFile::name() const
+{
+    return d_name.c_str();
+}
+
+bsl::string makeContent(bsl::size_t length)
+    // Return a string of the specified 'length' whose bytes depend on their
+    // position, so that misplaced bytes are detected.
+{
+    bsl::string content(length, '\0');
+    for (bsl::size_t i = 0; i < length; ++i) {
+        content[i] = static_cast<char>((i * 7 + i / 251) & 0xff);
+    }
+    return content;
+}
+
+void writeRecords(bslx::ByteOutStream *stream, int numRecords)
+    // Externalize to the specified 'stream' the specified 'numRecords'
+    // records of varying sizes, each being an 'int' identifier, a string, and
+    // an array of 'double', followed by the identifier -1.
+{
+    for (int i = 0; i < numRecords; ++i) {
+        const int    numDoubles = i % 13;
+        double       doubles[13];
+        for (int j = 0; j < numDoubles; ++j) {
+            doubles[j] = i + j / 16.0;
+        }
+
+        stream->putInt32(i);
+        stream->putString(bsl::string(i % 37,
+                                      static_cast<char>('a' + i % 26)));
+        stream->putLength(numDoubles);
+        stream->putArrayFloat64(doubles, numDoubles);
+    }
+    stream->putInt32(-1);
+}
+
+bool readRecord(bslx::ByteInStream *stream, int *id, bsl::string *text)
+    // Unexternalize from the specified 'stream' a record written by
+    // 'writeRecords', loading its identifier into the specified 'id' and its
+    // string into the specified 'text'.  Return 'true' if 'stream' is valid
+    // after the operation, and 'false' otherwise.  The array of the record
+    // is verified and discarded.
+{
+    if (!stream->getInt32(*id) || -1 == *id) {
+        return *stream;                                               // RETURN
+    }
+
+    int    numDoubles;
+    double doubles[13];
+    stream->getString(*text).getLength(numDoubles);
+    if (!*stream || numDoubles > 13) {
+        return false;                                                 // RETURN
+    }
+    stream->getArrayFloat64(doubles, numDoubles);
+    for (int j = 0; *stream && j < numDoubles; ++j) {
+        ASSERTV(*id, j, doubles[j] == *id + j / 16.0);
+    }
+    return *stream;
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    const int PAGE = pageSize();
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage examples provided in the component header file compile,
+        //:   link, and run as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage examples from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslx::ByteOutStream snapshot(20131127);
+        snapshot.putInt32(1).putString(bsl::string("first"));
+        snapshot.putInt32(2).putString(bsl::string("second"));
+        snapshot.putInt32(3).putString(bsl::string("third"));
+        snapshot.putInt32(-1);
+
+        TempFile    tempFile(bsl::string(snapshot.data(), snapshot.length()));
+        const char *filePath = tempFile.name();
+
+///Example 1: Loading a Snapshot File
+/// - - - - - - - - - - - - - - - - -
+// Suppose we keep a snapshot of an application's state in a file holding a
+// sequence of records, each being an 'int' identifier followed by a string,
+// externalized using 'bslx::ByteOutStream', and that the identifier -1 marks
+// the end of the snapshot.  (The file was written earlier; its name is held
+// in 'filePath'.)
+//
+// First, we open the file using a 'bdls::MappedFileInStream':
+//..
+    bdls::MappedFileInStream mappedFile;
+    int rc = mappedFile.open(filePath);
+    ASSERT(0 == rc);
+//..
+// Then, we read the records directly from the mapped file:
+//..
+    bslx::ByteInStream& in = mappedFile.stream();
+
+    int         numRecords = 0;
+    int         id;
+    bsl::string name;
+    while (in.getInt32(id) && -1 != id && in.getString(name)) {
+        ++numRecords;
+    }
+    ASSERT(in);
+    ASSERT(in.isEmpty());
+    ASSERT(3 == numRecords);
+    ASSERT("third" == name);
+//..
+// Finally, we close the file, which unmaps it:
+//..
+    mappedFile.close();
+    ASSERT(!mappedFile.isOpen());
+//..
+//
+///Example 2: Loading a Snapshot File in Chunks
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Now suppose the snapshot file of example 1 is too large to be mapped in its
+// entirety.  We read it through a window of (an unrealistically small) 16
+// bytes using a 'bdls::ChunkedMappedFileInStream'.
+//
+// First, we open the file:
+//..
+    bdls::ChunkedMappedFileInStream chunkedFile(16);
+    rc = chunkedFile.open(filePath);
+    ASSERT(0 == rc);
+//..
+// Then, we read the records.  When a record is not entirely in the current
+// window, reading it invalidates the stream; we then advance the window to
+// the start of that record and read the record again:
+//..
+    numRecords = 0;
+    while (true) {
+        bslx::ByteInStream& in     = chunkedFile.stream();
+        const bsl::size_t   cursor = in.cursor();
+
+        if (in.getInt32(id) && (-1 == id || in.getString(name))) {
+            if (-1 == id) {
+                break;
+            }
+            ++numRecords;
+        }
+        else {
+            ASSERT(!chunkedFile.isLastWindow());
+            ASSERT(0 < cursor);  // the window is large enough for a record
+
+            rc = chunkedFile.advance(cursor);
+            ASSERT(0 == rc);
+        }
+    }
+    ASSERT(3 == numRecords);
+    ASSERT("third" == name);
+//..
+// Finally, we verify that the whole file was read:
+//..
+    ASSERT(chunkedFile.isLastWindow());
+    ASSERT(chunkedFile.stream().isEmpty());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // READING RECORDS THROUGH WINDOWS
+        //
+        // Concerns:
+        //: 1 Records of varying sizes read through windows of any size at
+        //:   least that of the largest record, advancing to the start of the
+        //:   first record not entirely in the window, are the records read
+        //:   through the whole-file stream.
+        //
+        // Plan:
+        //: 1 Write a file of records of varying sizes, read them through a
+        //:   'MappedFileInStream', and then through
+        //:   'ChunkedMappedFileInStream' objects having a range of window
+        //:   sizes, including page multiples, and verify the identifiers and
+        //:   strings read.  (C-1)
+        //
+        // Testing:
+        //   READING RECORDS THROUGH WINDOWS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "READING RECORDS THROUGH WINDOWS" << endl
+                          << "===============================" << endl;
+
+        const int NUM_RECORDS = 2000;
+
+        bslx::ByteOutStream out(20131127);
+        writeRecords(&out, NUM_RECORDS);
+
+        TempFile tempFile(bsl::string(out.data(), out.length()));
+
+        bsl::vector<bsl::string> expected;
+        {
+            Obj mX;
+            ASSERT(0 == mX.open(tempFile.name()));
+
+            int         id;
+            bsl::string text;
+            while (readRecord(&mX.stream(), &id, &text) && -1 != id) {
+                ASSERTV(id, expected.size() == static_cast<bsl::size_t>(id));
+                expected.push_back(text);
+            }
+            ASSERT(mX.stream());
+            ASSERT(mX.stream().isEmpty());
+            ASSERT(NUM_RECORDS == static_cast<int>(expected.size()));
+        }
+
+        const bsl::size_t MAX_RECORD = 4 + 1 + 36 + 1 + 12 * 8;
+
+        const bsl::size_t WINDOW_SIZES[] = {
+            MAX_RECORD,
+            MAX_RECORD + 1,
+            1000,
+            static_cast<bsl::size_t>(PAGE) - 1,
+            static_cast<bsl::size_t>(PAGE),
+            static_cast<bsl::size_t>(PAGE) + 17,
+            3 * static_cast<bsl::size_t>(PAGE),
+            out.length() - 1,
+            out.length(),
+            ChunkedObj::k_DEFAULT_WINDOW_SIZE
+        };
+        const int NUM_WINDOW_SIZES = static_cast<int>(sizeof WINDOW_SIZES
+                                                      / sizeof *WINDOW_SIZES);
+
+        for (int ti = 0; ti < NUM_WINDOW_SIZES; ++ti) {
+            const bsl::size_t WINDOW_SIZE = WINDOW_SIZES[ti];
+
+            if (veryVerbose) { T_ P(WINDOW_SIZE) }
+
+            ChunkedObj mX(WINDOW_SIZE);  const ChunkedObj& X = mX;
+            ASSERTV(WINDOW_SIZE, 0 == mX.open(tempFile.name()));
+
+            int         numRecords = 0;
+            int         numWindows = 1;
+            int         id         = 0;
+            bsl::string text;
+            while (true) {
+                const bsl::size_t cursor = mX.stream().cursor();
+
+                if (readRecord(&mX.stream(), &id, &text)) {
+                    if (-1 == id) {
+                        break;
+                    }
+                    ASSERTV(WINDOW_SIZE, id, numRecords == id);
+                    ASSERTV(WINDOW_SIZE, id, expected[id] == text);
+                    ++numRecords;
+                }
+                else {
+                    ASSERTV(WINDOW_SIZE, id, !X.isLastWindow());
+                    ASSERTV(WINDOW_SIZE, id, 0 < cursor);
+                    if (X.isLastWindow() || 0 == cursor) {
+                        break;
+                    }
+                    ASSERTV(WINDOW_SIZE, id, 0 == mX.advance(cursor));
+                    ++numWindows;
+                }
+            }
+
+            ASSERTV(WINDOW_SIZE, NUM_RECORDS == numRecords);
+            ASSERTV(WINDOW_SIZE, X.isLastWindow());
+            ASSERTV(WINDOW_SIZE, X.stream().isEmpty());
+            ASSERTV(WINDOW_SIZE, numWindows,
+                    numWindows >= static_cast<int>(out.length()
+                                                   / WINDOW_SIZE));
+
+            if (veryVerbose) { T_ T_ P(numWindows) }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CLASS 'ChunkedMappedFileInStream'
+        //
+        // Concerns:
+        //: 1 The constructor creates an object having no open file, an empty
+        //:   stream, and the specified or default window size.
+        //:
+        //: 2 'open' presents the first window of the file, extending for the
+        //:   window size or to the end of the file, whichever comes first.
+        //:
+        //: 3 'advance' moves the window forward by the specified number of
+        //:   bytes, from any offset relative to a page boundary, presents the
+        //:   bytes of the file at the new window, and resets the stream to
+        //:   read from the start of the window.
+        //:
+        //: 4 'advance(0)' has no effect.
+        //:
+        //: 5 'isLastWindow' is 'true' exactly when the window extends to the
+        //:   end of the file.
+        //:
+        //: 6 'open' fails for a file that does not exist, leaving the object
+        //:   closed.
+        //:
+        //: 7 'close' and the destructor release the file.
+        //:
+        //: 8 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create an object with and without a window size, and verify its
+        //:   state.  (C-1)
+        //:
+        //: 2 For file lengths around multiples of the page size, window sizes
+        //:   from 1 to beyond the file length, and a set of step sizes, open
+        //:   the file and walk through it, advancing by the step (or by what
+        //:   remains of the window), and verify the state of the object and
+        //:   the bytes of each window.  (C-2..5)
+        //:
+        //: 3 Open a file that does not exist, and verify the result and the
+        //:   state of the object.  (C-6)
+        //:
+        //: 4 Close an object and verify its state.  (C-7)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-8)
+        //
+        // Testing:
+        //   ChunkedMappedFileInStream(bsl::size_t windowSize = DEFAULT);
+        //   ~ChunkedMappedFileInStream();
+        //   int advance(bsl::size_t numBytes);
+        //   void close();
+        //   int open(const char *filePath);
+        //   bslx::ByteInStream& stream();
+        //   bsls::Types::Int64 fileSize() const;
+        //   bool isLastWindow() const;
+        //   bool isOpen() const;
+        //   const bslx::ByteInStream& stream() const;
+        //   bsls::Types::Int64 windowOffset() const;
+        //   bsl::size_t windowSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLASS 'ChunkedMappedFileInStream'" << endl
+                          << "=================================" << endl;
+
+        if (verbose) cout << "\nTesting constructor." << endl;
+        {
+            ChunkedObj mX;  const ChunkedObj& X = mX;
+            ASSERT(!X.isOpen());
+            ASSERT(0 == X.fileSize());
+            ASSERT(0 == X.windowOffset());
+            ASSERT(ChunkedObj::k_DEFAULT_WINDOW_SIZE == X.windowSize());
+            ASSERT(X.stream().isEmpty());
+            ASSERT(0 == X.stream().length());
+            ASSERT(X.isLastWindow());
+
+            ChunkedObj mY(100);  const ChunkedObj& Y = mY;
+            ASSERT(!Y.isOpen());
+            ASSERT(100 == Y.windowSize());
+        }
+
+        if (verbose) cout << "\nTesting 'open' and 'advance'." << endl;
+
+        const int LENGTHS[] = { 0, 1, 13, PAGE - 1, PAGE, PAGE + 1,
+                                2 * PAGE + 5 };
+        const int NUM_LENGTHS = static_cast<int>(sizeof LENGTHS
+                                                 / sizeof *LENGTHS);
+
+        const int STEPS[] = { 1, 3, 100, PAGE - 1, PAGE, PAGE + 1 };
+        const int NUM_STEPS = static_cast<int>(sizeof STEPS / sizeof *STEPS);
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int         LENGTH  = LENGTHS[ti];
+            const bsl::string CONTENT = makeContent(LENGTH);
+
+            if (veryVerbose) { T_ P(LENGTH) }
+
+            TempFile tempFile(CONTENT);
+
+            const int WINDOWS[] = { 1, 2, 7, 64, PAGE - 1, PAGE, PAGE + 1,
+                                    LENGTH, LENGTH + 1, 3 * PAGE };
+            const int NUM_WINDOWS = static_cast<int>(sizeof WINDOWS
+                                                     / sizeof *WINDOWS);
+
+            for (int tj = 0; tj < NUM_WINDOWS; ++tj) {
+                const int WINDOW = WINDOWS[tj];
+
+                if (0 == WINDOW) {
+                    continue;
+                }
+
+                for (int tk = 0; tk < NUM_STEPS; ++tk) {
+                    const int STEP = STEPS[tk];
+
+                    ChunkedObj mX(WINDOW);  const ChunkedObj& X = mX;
+
+                    ASSERTV(LENGTH, WINDOW, STEP,
+                            0 == mX.open(tempFile.name()));
+                    ASSERTV(LENGTH, WINDOW, STEP, X.isOpen());
+                    ASSERTV(LENGTH, WINDOW, STEP, LENGTH == X.fileSize());
+
+                    int offset = 0;
+                    while (true) {
+                        const int EXP_LENGTH = LENGTH - offset < WINDOW
+                                             ? LENGTH - offset
+                                             : WINDOW;
+
+                        const bslx::ByteInStream& S = X.stream();
+                        LOOP4_ASSERT(LENGTH, WINDOW, STEP, offset,
+                                     offset == X.windowOffset());
+                        LOOP4_ASSERT(LENGTH, WINDOW, STEP, offset,
+                                     EXP_LENGTH ==
+                                          static_cast<int>(S.length()));
+                        LOOP4_ASSERT(LENGTH, WINDOW, STEP, offset,
+                                     0 == S.cursor());
+                        LOOP4_ASSERT(LENGTH, WINDOW, STEP, offset,
+                                     S.isValid());
+                        LOOP4_ASSERT(LENGTH, WINDOW, STEP, offset,
+                                     (offset + EXP_LENGTH == LENGTH) ==
+                                                          X.isLastWindow());
+                        LOOP4_ASSERT(LENGTH, WINDOW, STEP, offset,
+                                     0 == EXP_LENGTH
+                                     || 0 == bsl::memcmp(
+                                                    S.data(),
+                                                    CONTENT.data() + offset,
+                                                    EXP_LENGTH));
+
+                        if (0 == EXP_LENGTH) {
+                            break;
+                        }
+
+                        // Consume a few bytes, as a reader would, before
+                        // advancing.
+
+                        char c;
+                        mX.stream().getInt8(c);
+                        LOOP4_ASSERT(LENGTH, WINDOW, STEP, offset,
+                                     CONTENT[offset] == c);
+
+                        ASSERTV(LENGTH, WINDOW, STEP, offset,
+                                0 == mX.advance(0));
+                        LOOP4_ASSERT(LENGTH, WINDOW, STEP, offset,
+                                     offset == X.windowOffset());
+                        LOOP4_ASSERT(LENGTH, WINDOW, STEP, offset,
+                                     1 == X.stream().cursor());
+
+                        const int N = STEP < EXP_LENGTH ? STEP : EXP_LENGTH;
+                        ASSERTV(LENGTH, WINDOW, STEP, offset,
+                                0 == mX.advance(N));
+                        offset += N;
+                    }
+
+                    mX.close();
+                    ASSERTV(LENGTH, WINDOW, STEP, !X.isOpen());
+                    ASSERTV(LENGTH, WINDOW, STEP, 0 == X.fileSize());
+                    ASSERTV(LENGTH, WINDOW, STEP, 0 == X.windowOffset());
+                    ASSERTV(LENGTH, WINDOW, STEP, X.stream().isEmpty());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting failure to open." << endl;
+        {
+            TempFile tempFile(makeContent(100));
+
+            ChunkedObj mX(10);  const ChunkedObj& X = mX;
+            ASSERT(0 == mX.open(tempFile.name()));
+            ASSERT(0 == mX.advance(5));
+            ASSERT(5 == X.windowOffset());
+
+            const bsl::string MISSING = bsl::string(tempFile.name()) + ".none";
+            ASSERT(0 != mX.open(MISSING.c_str()));
+            ASSERT(!X.isOpen());
+            ASSERT(0 == X.fileSize());
+            ASSERT(0 == X.windowOffset());
+            ASSERT(X.stream().isEmpty());
+
+            ASSERT(0 == mX.open(tempFile.name()));
+            ASSERT(0 == X.windowOffset());
+            ASSERT(10 == X.stream().length());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_SAFE_FAIL(ChunkedObj(0));
+            ASSERT_SAFE_PASS(ChunkedObj(1));
+
+            TempFile tempFile(makeContent(100));
+
+            ChunkedObj mX(10);
+            ASSERT_FAIL(mX.advance(0));
+            ASSERT_FAIL(mX.open(0));
+
+            ASSERT(0 == mX.open(tempFile.name()));
+            ASSERT_PASS(mX.advance(0));
+            ASSERT_FAIL(mX.advance(11));
+            ASSERT_PASS(mX.advance(10));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CLASS 'MappedFileInStream'
+        //
+        // Concerns:
+        //: 1 The default constructor creates an object having no open file
+        //:   and an empty stream.
+        //:
+        //: 2 'open' presents the whole content of the file, including an empty
+        //:   file, through a valid stream positioned at its start.
+        //:
+        //: 3 Opening another file replaces the open file.
+        //:
+        //: 4 'open' fails for a file that does not exist and for a directory,
+        //:   leaving the object closed.
+        //:
+        //: 5 'close' releases the file and empties the stream, and may be
+        //:   called on a closed object.
+        //:
+        //: 6 The stream may be read to the end of the file, and an attempt to
+        //:   read beyond it invalidates the stream without accessing memory
+        //:   outside the mapping.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create an object and verify its state.  (C-1)
+        //:
+        //: 2 For file lengths around multiples of the page size, open the
+        //:   file, verify the state and the content presented by the stream,
+        //:   read the whole file, and attempt to read one more byte.  (C-2,
+        //:   6)
+        //:
+        //: 3 Open each file with the object used for the previous one.  (C-3)
+        //:
+        //: 4 Open a file that does not exist and a directory, and verify the
+        //:   results and the state of the object.  (C-4)
+        //:
+        //: 5 Close the object twice and verify its state.  (C-5)
+        //:
+        //: 6 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   MappedFileInStream();
+        //   ~MappedFileInStream();
+        //   void close();
+        //   int open(const char *filePath);
+        //   bslx::ByteInStream& stream();
+        //   bsls::Types::Int64 fileSize() const;
+        //   bool isOpen() const;
+        //   const bslx::ByteInStream& stream() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLASS 'MappedFileInStream'" << endl
+                          << "==========================" << endl;
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(!X.isOpen());
+        ASSERT(0 == X.fileSize());
+        ASSERT(X.stream().isEmpty());
+        ASSERT(0 == X.stream().length());
+
+        const int LENGTHS[] = { 0, 1, 100, PAGE - 1, PAGE, PAGE + 1,
+                                5 * PAGE + 3, 1000000 };
+        const int NUM_LENGTHS = static_cast<int>(sizeof LENGTHS
+                                                 / sizeof *LENGTHS);
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int         LENGTH  = LENGTHS[ti];
+            const bsl::string CONTENT = makeContent(LENGTH);
+
+            if (veryVerbose) { T_ P(LENGTH) }
+
+            TempFile tempFile(CONTENT);
+
+            ASSERTV(LENGTH, 0 == mX.open(tempFile.name()));
+            ASSERTV(LENGTH, X.isOpen());
+            ASSERTV(LENGTH, LENGTH == X.fileSize());
+
+            const bslx::ByteInStream& S = X.stream();
+            ASSERTV(LENGTH, S.isValid());
+            ASSERTV(LENGTH, 0 == S.cursor());
+            ASSERTV(LENGTH, LENGTH == static_cast<int>(S.length()));
+            ASSERTV(LENGTH, 0 == LENGTH
+                            || 0 == bsl::memcmp(S.data(),
+                                                CONTENT.data(),
+                                                LENGTH));
+
+            if (0 < LENGTH) {
+                bsl::vector<char> buffer(LENGTH);
+                mX.stream().getArrayInt8(buffer.data(), LENGTH);
+            }
+            ASSERTV(LENGTH, S.isValid());
+            ASSERTV(LENGTH, S.isEmpty());
+
+            char c;
+            mX.stream().getInt8(c);
+            ASSERTV(LENGTH, !S.isValid());
+        }
+
+        if (verbose) cout << "\nTesting failure to open." << endl;
+        {
+            TempFile tempFile(makeContent(10));
+            ASSERT(0 == mX.open(tempFile.name()));
+
+            const bsl::string MISSING = bsl::string(tempFile.name()) + ".none";
+            ASSERT(0 != mX.open(MISSING.c_str()));
+            ASSERT(!X.isOpen());
+            ASSERT(0 == X.fileSize());
+            ASSERT(X.stream().isEmpty());
+
+#ifndef BSLS_PLATFORM_OS_WINDOWS
+            ASSERT(0 != mX.open("/tmp"));
+            ASSERT(!X.isOpen());
+            ASSERT(X.stream().isEmpty());
+#endif
+        }
+
+        if (verbose) cout << "\nTesting 'close'." << endl;
+        {
+            TempFile tempFile(makeContent(10));
+            ASSERT(0 == mX.open(tempFile.name()));
+            ASSERT(X.isOpen());
+
+            mX.close();
+            ASSERT(!X.isOpen());
+            ASSERT(0 == X.fileSize());
+            ASSERT(X.stream().isEmpty());
+            ASSERT(0 == X.stream().length());
+
+            mX.close();
+            ASSERT(!X.isOpen());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            TempFile tempFile(makeContent(10));
+
+            Obj mY;
+            ASSERT_FAIL(mY.open(0));
+            ASSERT_PASS(mY.open(tempFile.name()));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CLASS 'MappedFileInStream_Mapping'
+        //
+        // Concerns:
+        //: 1 'open' opens an existing file and reports its size, and fails
+        //:   for a file that does not exist.
+        //:
+        //: 2 'map' maps any region of the file, at any offset relative to the
+        //:   allocation granularity, and the loaded address refers to the
+        //:   bytes of the file at the offset.
+        //:
+        //: 3 'map' of an empty region loads 0 and succeeds.
+        //:
+        //: 4 'unmap', 'close', and the destructor release the mapping and the
+        //:   file, and may be called when there is nothing to release.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create a file spanning several pages, open it, and verify the
+        //:   state of the object.  (C-1)
+        //:
+        //: 2 For offsets and lengths around page boundaries, map the region
+        //:   and verify its content.  (C-2..3)
+        //:
+        //: 3 Unmap and close the object, repeatedly, and verify its state.
+        //:   Open a file that does not exist and verify the result.  (C-1, 4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   MappedFileInStream_Mapping();
+        //   ~MappedFileInStream_Mapping();
+        //   void close();
+        //   int map(const char **data, Int64 offset, bsl::size_t length);
+        //   int open(const char *filePath);
+        //   void unmap();
+        //   bsls::Types::Int64 fileSize() const;
+        //   bool isOpen() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLASS 'MappedFileInStream_Mapping'" << endl
+                          << "==================================" << endl;
+
+        const int         LENGTH  = 3 * PAGE + 11;
+        const bsl::string CONTENT = makeContent(LENGTH);
+
+        TempFile tempFile(CONTENT);
+
+        Mapping mX;  const Mapping& X = mX;
+        ASSERT(!X.isOpen());
+        ASSERT(0 == X.fileSize());
+
+        mX.unmap();
+        mX.close();
+        ASSERT(!X.isOpen());
+
+        ASSERT(0 == mX.open(tempFile.name()));
+        ASSERT(X.isOpen());
+        ASSERT(LENGTH == X.fileSize());
+
+        const int OFFSETS[] = { 0, 1, PAGE - 1, PAGE, PAGE + 1,
+                                2 * PAGE + 7, LENGTH - 1, LENGTH };
+        const int NUM_OFFSETS = static_cast<int>(sizeof OFFSETS
+                                                 / sizeof *OFFSETS);
+
+        const int SIZES[] = { 0, 1, 2, PAGE - 1, PAGE, PAGE + 1, LENGTH };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        for (int ti = 0; ti < NUM_OFFSETS; ++ti) {
+            for (int tj = 0; tj < NUM_SIZES; ++tj) {
+                const int OFFSET = OFFSETS[ti];
+                const int SIZE   = SIZES[tj];
+
+                if (OFFSET + SIZE > LENGTH) {
+                    continue;
+                }
+
+                const char *data = CONTENT.data();
+                ASSERTV(OFFSET, SIZE, 0 == mX.map(&data, OFFSET, SIZE));
+
+                if (0 == SIZE) {
+                    ASSERTV(OFFSET, SIZE, 0 == data);
+                }
+                else {
+                    ASSERTV(OFFSET, SIZE, 0 != data);
+                    ASSERTV(OFFSET, SIZE,
+                            0 == bsl::memcmp(data,
+                                             CONTENT.data() + OFFSET,
+                                             SIZE));
+                }
+            }
+        }
+
+        mX.unmap();
+        mX.unmap();
+        ASSERT(X.isOpen());
+
+        mX.close();
+        ASSERT(!X.isOpen());
+        ASSERT(0 == X.fileSize());
+        mX.close();
+
+        const bsl::string MISSING = bsl::string(tempFile.name()) + ".none";
+        ASSERT(0 != mX.open(MISSING.c_str()));
+        ASSERT(!X.isOpen());
+
+        {
+            Mapping mY;
+            const char *data;
+            ASSERT(0 == mY.open(tempFile.name()));
+            ASSERT(0 == mY.map(&data, 1, 10));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Mapping     mY;
+            const char *data;
+
+            ASSERT_FAIL(mY.map(&data, 0, 0));
+            ASSERT_FAIL(mY.open(0));
+
+            ASSERT(0 == mY.open(tempFile.name()));
+            ASSERT_PASS(mY.map(&data, 0, 0));
+            ASSERT_FAIL(mY.map(0, 0, 0));
+            ASSERT_FAIL(mY.map(&data, -1, 0));
+            ASSERT_PASS(mY.map(&data, LENGTH, 0));
+            ASSERT_FAIL(mY.map(&data, LENGTH, 1));
+            ASSERT_PASS(mY.map(&data, 0, LENGTH));
+            ASSERT_FAIL(mY.map(&data, 0, LENGTH + 1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The classes are sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Write a file using a 'bslx::ByteOutStream', and read it back
+        //:   using each class.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslx::ByteOutStream out(20131127);
+        out.putInt32(42).putString(bsl::string("hello")).putFloat64(1.5);
+
+        TempFile tempFile(bsl::string(out.data(), out.length()));
+
+        int         i;
+        bsl::string s;
+        double      d;
+        {
+            Obj mX;
+            ASSERT(0 == mX.open(tempFile.name()));
+            ASSERT(static_cast<bsls::Types::Int64>(out.length())
+                                                             == mX.fileSize());
+
+            mX.stream().getInt32(i).getString(s).getFloat64(d);
+            ASSERT(mX.stream());
+            ASSERT(mX.stream().isEmpty());
+            ASSERT(42 == i);
+            ASSERT("hello" == s);
+            ASSERT(1.5 == d);
+        }
+        {
+            ChunkedObj mX(8);
+            ASSERT(0 == mX.open(tempFile.name()));
+            ASSERT(!mX.isLastWindow());
+
+            mX.stream().getInt32(i);
+            ASSERT(42 == i);
+            ASSERT(0 == mX.advance(mX.stream().cursor()));
+            ASSERT(4 == mX.windowOffset());
+
+            mX.stream().getString(s);
+            ASSERT("hello" == s);
+            ASSERT(0 == mX.advance(mX.stream().cursor()));
+            ASSERT(10 == mX.windowOffset());
+
+            mX.stream().getFloat64(d);
+            ASSERT(1.5 == d);
+            ASSERT(mX.isLastWindow());
+            ASSERT(mX.stream().isEmpty());
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Reading a large file of records through a mapped stream is
+        //:   faster than reading the file into a buffer and then reading the
+        //:   records from that buffer.
+        //
+        // Plan:
+        //: 1 Write a file of records of the size (in megabytes) given on the
+        //:   command line (64 by default).  Read the records by reading the
+        //:   file into a 'bsl::vector' and streaming from it, through a
+        //:   'MappedFileInStream', and through a 'ChunkedMappedFileInStream'
+        //:   having an 8MB window, and report the times.  Note that the file
+        //:   is in the page cache after it is written, so this measures the
+        //:   copying and allocation that mapping avoids, not disk latency.
+        //:   (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_MEGABYTES = argc > 2 ? atoi(argv[2]) : 64;
+
+        bslx::ByteOutStream out(20131127);
+        while (out.length() < NUM_MEGABYTES * 1024 * 1024u) {
+            writeRecords(&out, 10000);
+        }
+
+        TempFile tempFile(bsl::string(out.data(), out.length()));
+
+        for (int method = 0; method < 3; ++method) {
+            bsls::Stopwatch timer;
+            timer.start();
+
+            int         numRecords = 0;
+            int         id;
+            bsl::string text;
+
+            if (0 == method) {
+                bsl::ifstream file(tempFile.name(),
+                                   bsl::ios::in | bsl::ios::binary);
+                bsl::vector<char> buffer(out.length());
+                file.read(buffer.data(), buffer.size());
+                ASSERT(file);
+
+                bslx::ByteInStream in(buffer.data(), buffer.size());
+                while (readRecord(&in, &id, &text) && !in.isEmpty()) {
+                    numRecords += -1 != id;
+                }
+            }
+            else if (1 == method) {
+                Obj mX;
+                ASSERT(0 == mX.open(tempFile.name()));
+                while (readRecord(&mX.stream(), &id, &text)
+                    && !mX.stream().isEmpty()) {
+                    numRecords += -1 != id;
+                }
+            }
+            else {
+                ChunkedObj mX(8 * 1024 * 1024);
+                ASSERT(0 == mX.open(tempFile.name()));
+                while (true) {
+                    const bsl::size_t cursor = mX.stream().cursor();
+                    if (readRecord(&mX.stream(), &id, &text)) {
+                        numRecords += -1 != id;
+                        if (mX.isLastWindow() && mX.stream().isEmpty()) {
+                            break;
+                        }
+                    }
+                    else {
+                        ASSERT(!mX.isLastWindow());
+                        ASSERT(0 == mX.advance(cursor));
+                    }
+                }
+            }
+
+            timer.stop();
+
+            const char *NAMES[] = { "read into buffer",
+                                    "MappedFileInStream",
+                                    "ChunkedMappedFileInStream" };
+            printf("%-26s %d records, %8.3f ms\n",
+                   NAMES[method],
+                   numRecords,
+                   timer.accumulatedWallTime() * 1000);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
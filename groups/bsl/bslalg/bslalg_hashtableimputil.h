@@ -542,6 +542,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_nativestd.h>
 #endif
 
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
 #ifndef INCLUDED_BSLS_PLATFORM
 #include <bsls_platform.h>
 #endif
@@ -612,6 +616,13 @@ struct HashTableImpUtil {
         // has 0 buckets.
 
   public:
+    // PUBLIC CONSTANTS
+    enum { k_FIND_BATCH_DISTANCE = 16 };
+        // Number of keys by which each stage of the lookups performed by
+        // 'findBatch' runs ahead of the next; chosen so that the number of
+        // cache misses in flight roughly matches the number that current
+        // processors can track.
+
     // CLASS METHODS
     static bool bucketContainsLink(const HashTableBucket&  bucket,
                                    BidirectionalLink      *linkAddress);
@@ -758,6 +769,54 @@ struct HashTableImpUtil {
         //                  const KEY_CONFIG::KeyType& key2)
         //..
 
+    template <class KEY_CONFIG, class LOOKUP_KEY, class KEY_EQUAL>
+    static BidirectionalLink *findTransparent(
+                                        const HashTableAnchor& anchor,
+                                        const LOOKUP_KEY&      key,
+                                        const KEY_EQUAL&       equalityFunctor,
+                                        native_std::size_t     hashCode);
+        // Return the address of the first link in the list element of the
+        // specified 'anchor', having a value matching (according to the
+        // specified 'equalityFunctor') the specified 'key' in the bucket that
+        // holds elements with the specified 'hashCode' if such a link exists,
+        // and return 0 otherwise.  Unlike 'find', 'key' is passed to
+        // 'equalityFunctor' as an object of the (template parameter) type
+        // 'LOOKUP_KEY' rather than being converted to 'KEY_CONFIG::KeyType',
+        // which supports heterogeneous lookup.  The behavior is undefined
+        // unless, for the provided 'KEY_CONFIG' and some hash function,
+        // 'HASHER', 'anchor' is well-formed (see 'isWellFormed'),
+        // 'HASHER(key)' returns 'hashCode', and 'HASHER' returns the same
+        // value for any two keys that 'equalityFunctor' treats as equal.
+        // 'KEY_EQUAL' shall be a functor that can be called as if it had the
+        // following signature:
+        //..
+        //  bool operator()(const LOOKUP_KEY&          key1,
+        //                  const KEY_CONFIG::KeyType& key2)
+        //..
+
+    template <class KEY_CONFIG, class KEY_EQUAL>
+    static void findBatch(
+                      BidirectionalLink                  **results,
+                      const HashTableAnchor&               anchor,
+                      const typename KEY_CONFIG::KeyType  *keys,
+                      const native_std::size_t            *hashCodes,
+                      native_std::size_t                   numKeys,
+                      const KEY_EQUAL&                     equalityFunctor);
+        // Load into each of the specified 'numKeys' elements of the specified
+        // 'results' array the value that 'find' would return for the
+        // corresponding element of the specified 'keys' array, having the
+        // corresponding hash code in the specified 'hashCodes' array, in the
+        // specified 'anchor', using the specified 'equalityFunctor'.  The
+        // lookups are software-pipelined in three stages: the bucket of
+        // each key is prefetched 'k_FIND_BATCH_DISTANCE' keys before the
+        // first node of that bucket is prefetched, which is in turn
+        // 'k_FIND_BATCH_DISTANCE' keys before the bucket is searched, so that
+        // the cache misses incurred by successive lookups overlap rather than
+        // occur one after another.  The behavior is undefined unless
+        // 'anchor', 'keys', and 'hashCodes' satisfy the requirements of
+        // 'find' for every key, and 'results', 'keys', and 'hashCodes' each
+        // refer to an array of at least 'numKeys' elements.
+
     template <class KEY_CONFIG, class HASHER>
     static void rehash(HashTableAnchor   *newAnchor,
                        BidirectionalLink *elementList,
@@ -881,6 +940,109 @@ BidirectionalLink *HashTableImpUtil::find(
     return 0;
 }
 
+template <class KEY_CONFIG, class LOOKUP_KEY, class KEY_EQUAL>
+inline
+BidirectionalLink *HashTableImpUtil::findTransparent(
+                                       const HashTableAnchor& anchor,
+                                       const LOOKUP_KEY&      key,
+                                       const KEY_EQUAL&       equalityFunctor,
+                                       native_std::size_t     hashCode)
+{
+    BSLS_ASSERT_SAFE(anchor.bucketArrayAddress());
+    BSLS_ASSERT_SAFE(anchor.bucketArraySize());
+
+    const HashTableBucket *bucket = findBucketForHashCode(anchor, hashCode);
+    BSLS_ASSERT_SAFE(bucket);
+
+    for (BidirectionalLink *cursor     = bucket->first(),
+                           * const end = bucket->end();
+                                 end != cursor; cursor = cursor->nextLink() ) {
+        if (equalityFunctor(key, extractKey<KEY_CONFIG>(cursor))) {
+            return cursor;                                            // RETURN
+        }
+    }
+
+    return 0;
+}
+
+template <class KEY_CONFIG, class KEY_EQUAL>
+void HashTableImpUtil::findBatch(
+                       BidirectionalLink                  **results,
+                       const HashTableAnchor&               anchor,
+                       const typename KEY_CONFIG::KeyType  *keys,
+                       const native_std::size_t            *hashCodes,
+                       native_std::size_t                   numKeys,
+                       const KEY_EQUAL&                     equalityFunctor)
+{
+    BSLS_ASSERT_SAFE(results   || 0 == numKeys);
+    BSLS_ASSERT_SAFE(keys      || 0 == numKeys);
+    BSLS_ASSERT_SAFE(hashCodes || 0 == numKeys);
+    BSLS_ASSERT_SAFE(anchor.bucketArrayAddress());
+    BSLS_ASSERT_SAFE(anchor.bucketArraySize());
+
+    // 'buckets' is a ring holding the buckets of the keys from the one being
+    // searched to the one being prefetched; its size is a power of two.
+
+    enum {
+        k_DISTANCE  = k_FIND_BATCH_DISTANCE,
+        k_RING_SIZE = 4 * k_FIND_BATCH_DISTANCE,
+        k_RING_MASK = k_RING_SIZE - 1
+    };
+
+    const HashTableBucket *buckets[k_RING_SIZE];
+
+    HashTableBucket *const bucketArray = anchor.bucketArrayAddress();
+    const size_t           numBuckets  = anchor.bucketArraySize();
+
+    // Prime the pipeline: the first '2 * k_DISTANCE' buckets are located and
+    // prefetched, and the first nodes of the first 'k_DISTANCE' of those are
+    // prefetched.
+
+    const size_t numPrimed = numKeys < 2 * k_DISTANCE ? numKeys
+                                                      : 2 * k_DISTANCE;
+    for (size_t i = 0; i < numPrimed; ++i) {
+        buckets[i] = bucketArray + computeBucketIndex(hashCodes[i],
+                                                      numBuckets);
+        bsls::PerformanceHint::prefetchForReading(buckets[i]);
+    }
+    for (size_t i = 0; i < numPrimed && i < k_DISTANCE; ++i) {
+        if (BidirectionalLink *first = buckets[i]->first()) {
+            bsls::PerformanceHint::prefetchForReading(first);
+        }
+    }
+
+    for (size_t i = 0; i < numKeys; ++i) {
+        const size_t ahead = i + 2 * k_DISTANCE;
+        if (ahead < numKeys) {
+            const HashTableBucket *bucket =
+                   bucketArray + computeBucketIndex(hashCodes[ahead],
+                                                    numBuckets);
+            buckets[ahead & k_RING_MASK] = bucket;
+            bsls::PerformanceHint::prefetchForReading(bucket);
+        }
+
+        const size_t next = i + k_DISTANCE;
+        if (next < numKeys) {
+            if (BidirectionalLink *first =
+                                    buckets[next & k_RING_MASK]->first()) {
+                bsls::PerformanceHint::prefetchForReading(first);
+            }
+        }
+
+        const HashTableBucket *bucket = buckets[i & k_RING_MASK];
+
+        results[i] = 0;
+        for (BidirectionalLink *cursor     = bucket->first(),
+                               * const end = bucket->end();
+                                 end != cursor; cursor = cursor->nextLink()) {
+            if (equalityFunctor(keys[i], extractKey<KEY_CONFIG>(cursor))) {
+                results[i] = cursor;
+                break;
+            }
+        }
+    }
+}
+
 template <class KEY_CONFIG, class HASHER>
 void HashTableImpUtil::rehash(HashTableAnchor   *newAnchor,
                               BidirectionalLink *elementList,
@@ -48,6 +48,8 @@ using namespace BloombergLP::bslalg;
 // [10] remove(HashTableAnchor *a, BidirectionalLink *l, size_t  h);
 // [10] bucketContainsLink(const Bucket& b, BidirectionalLink *l);
 // [ 9] find(const HashTableAnchor& a, KeyType& key, comparator, size_t h);
+// [ 9] findTransparent(const Anchor& a, const LOOKUP_KEY& k, eq, size_t h);
+// [ 9] findBatch(Link **r, const Anchor& a, keys, hashCodes, size_t n, eq);
 // [ 8] rehash(  HashTableAnchor *a, BidirectionalLink *r, const HASHER& h);
 // [ 7] isWellFormed(const HashTableAnchor& anchor, bslma::Allocator *a = 0);
 // [ 6] insertAtPosition(Anchor *a, Link *l, size_t h, Link  *p);
@@ -248,6 +250,21 @@ struct Equals {
     }
 };
 
+struct IntProbe {
+    // This 'struct' holds an 'int' value, but is not convertible to 'int', so
+    // that it can be used to verify that a key is not converted to the key
+    // type of a hash table by a heterogeneous lookup.
+
+    int d_value;
+};
+
+struct IntProbeEquals {
+    bool operator()(const IntProbe& lhs, int rhs) const
+    {
+        return lhs.d_value == rhs;
+    }
+};
+
 bool listMatches(Link *first,
                  Link *last,
                  Link **arrayBegin,
@@ -1331,6 +1348,57 @@ int main(int argc, char *argv[])
                                                                  i % 2)));
         }
 
+        if (verbose) printf("Testing 'findTransparent'\n");
+
+        for (int i = 0; i < ARRAY_LENGTH(links); ++i) {
+            const IntProbe PROBE = { i };
+            ASSERTV(i, links[i] == (Obj::findTransparent<TestPolicy>(
+                                                              ANCHOR,
+                                                              PROBE,
+                                                              IntProbeEquals(),
+                                                              i % 2)));
+        }
+
+        if (verbose) printf("Testing 'findBatch'\n");
+        {
+            // Look up every suffix of an array holding each key several
+            // times, so that batches of every length up to (and beyond) the
+            // depth of the pipeline are checked.
+
+            enum { k_NUM_KEYS = 3 * ARRAY_LENGTH(links) };
+
+            int    keys[k_NUM_KEYS];
+            size_t hashCodes[k_NUM_KEYS];
+            for (int i = 0; i < k_NUM_KEYS; ++i) {
+                keys[i]      = i % ARRAY_LENGTH(links);
+                hashCodes[i] = keys[i] % 2;
+            }
+
+            ASSERT(2 * Obj::k_FIND_BATCH_DISTANCE < k_NUM_KEYS);
+
+            for (int start = 0; start <= k_NUM_KEYS; ++start) {
+                Link *results[k_NUM_KEYS + 1];
+                for (int i = 0; i <= k_NUM_KEYS; ++i) {
+                    results[i] = node000;
+                }
+
+                Obj::findBatch<TestPolicy>(results,
+                                           ANCHOR,
+                                           keys + start,
+                                           hashCodes + start,
+                                           k_NUM_KEYS - start,
+                                           Equals<int>());
+
+                for (int i = start; i < k_NUM_KEYS; ++i) {
+                    ASSERTV(start, i, links[keys[i]] == results[i - start]);
+                }
+
+                // The element following the batch is not modified.
+
+                ASSERTV(start, node000 == results[k_NUM_KEYS - start]);
+            }
+        }
+
         {
             Link *matches[] = { node001, node011 };
             ASSERT(2 == ARRAY_LENGTH(matches));
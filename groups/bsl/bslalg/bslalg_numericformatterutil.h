@@ -0,0 +1,156 @@
+// bslalg_numericformatterutil.h                                      -*-C++-*-
+#ifndef INCLUDED_BSLALG_NUMERICFORMATTERUTIL
+#define INCLUDED_BSLALG_NUMERICFORMATTERUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a utility for formatting numbers into character buffers.
+//
+//@CLASSES:
+//  bslalg::NumericFormatterUtil: namespace for 'toChars' functions
+//
+//@SEE_ALSO: bslstl_string
+//
+//@DESCRIPTION: This component provides a namespace 'struct',
+// 'bslalg::NumericFormatterUtil', containing overloaded 'toChars' functions
+// that write the textual representation of an integral or a 'double' value
+// into a caller-supplied range of characters, in the manner of the C++17
+// 'std::to_chars' functions.  The functions neither allocate memory nor
+// consult the current locale, and the written characters are not
+// null-terminated.  Each function returns the address one past the last
+// character written, or 0 if the range is too small to hold the result (in
+// which case the contents of the range are unspecified).
+//
+///Integral Values
+///---------------
+// An integral value is written in the specified base (10 by default), using
+// the lower-case letters 'a' to 'z' for the digits 10 to 35, with a leading
+// '-' for a negative value and no leading zeros.  Decimal digits are produced
+// two at a time.
+//
+///Floating-Point Values
+///---------------------
+// A 'double' value is written using the shortest sequence of decimal digits
+// that, when parsed with round-to-nearest, yields exactly the same value;
+// among sequences of that length, the one closest to the value is used.  The
+// digits are computed with the Ryu algorithm (Ulf Adams, "Ryu: Fast
+// Float-to-String Conversion", PLDI 2018), which uses only integer
+// arithmetic.  The digits are presented in fixed ('123.45') or scientific
+// ('1.2345e+22') notation, whichever is shorter, preferring fixed notation in
+// case of a tie; the exponent of scientific notation has at least two digits.
+// Infinities are written as 'inf' and '-inf', NaN values as 'nan' (or '-nan'
+// if the sign bit is set), and negative zero as '-0'.
+//
+// The 'k_MAX_LENGTH_*' constants give the size of a buffer that is large
+// enough for any value of the corresponding type.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing a CSV Record
+///- - - - - - - - - - - - - - - -
+// Suppose we are writing records of comma-separated values into a fixed-size
+// buffer, which we flush when it is full.  Each record holds an identifier and
+// a price.
+//
+// First, we declare the buffer, and a pointer to the next character to be
+// written:
+//..
+//  char  buffer[64];
+//  char *next = buffer;
+//  char *end  = buffer + sizeof buffer;
+//..
+// Then, we write a record, checking after each 'toChars' call that the value
+// fit in the remaining space:
+//..
+//  next = bslalg::NumericFormatterUtil::toChars(next, end, 1042);
+//  assert(next);
+//  *next++ = ',';
+//
+//  next = bslalg::NumericFormatterUtil::toChars(next, end, 101.25);
+//  assert(next);
+//  *next++ = '\n';
+//..
+// Finally, we verify the contents of the buffer.  Note that the price is
+// written with no more digits than are needed to identify it:
+//..
+//  assert(12 == next - buffer);
+//  assert(0 == memcmp(buffer, "1042,101.25\n", 12));
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+                        // ===========================
+                        // struct NumericFormatterUtil
+                        // ===========================
+
+struct NumericFormatterUtil {
+    // This 'struct' provides a namespace for functions that write the textual
+    // representation of a numeric value into a range of characters.
+
+    // TYPES
+    enum {
+        k_MAX_LENGTH_INT     = 33,   // any 32-bit value, in any base
+        k_MAX_LENGTH_INT64   = 65,   // any 64-bit value, in any base
+        k_MAX_LENGTH_DOUBLE  = 24    // any 'double' value
+    };
+
+    // CLASS METHODS
+    static char *toChars(char *first, char *last, int                value,
+                         int base = 10);
+    static char *toChars(char *first, char *last, unsigned int       value,
+                         int base = 10);
+    static char *toChars(char *first, char *last, long               value,
+                         int base = 10);
+    static char *toChars(char *first, char *last, unsigned long      value,
+                         int base = 10);
+    static char *toChars(char *first, char *last, long long          value,
+                         int base = 10);
+    static char *toChars(char *first, char *last, unsigned long long value,
+                         int base = 10);
+        // Write the representation of the specified 'value' in the optionally
+        // specified 'base' into the range '[first, last)'.  Return the address
+        // one past the last character written, or 0 if the range is too small
+        // to hold the representation.  If 'base' is not specified, 10 is used.
+        // The behavior is undefined unless '[first, last)' is a valid range
+        // and '2 <= base <= 36'.
+
+    static char *toChars(char *first, char *last, double value);
+        // Write the shortest representation of the specified 'value' from
+        // which it can be recovered exactly into the range '[first, last)'.
+        // Return the address one past the last character written, or 0 if the
+        // range is too small to hold the representation.  The behavior is
+        // undefined unless '[first, last)' is a valid range.  See
+        // {Floating-Point Values} for details of the representation.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,708 @@
+// bslalg_numericformatterutil.t.cpp                                  -*-C++-*-
+
+#include <bslalg_numericformatterutil.h>
+
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                 TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides pure functions that write into a
+// caller-supplied buffer.  Integral values are checked against a table of
+// representations in several bases, and against 'sprintf' at the limits of
+// each type.  'double' values are checked against a table of representations
+// covering the choice of notation and the special values, and a large number
+// of values with pseudo-random bit patterns are checked to round-trip through
+// 'strtod' using no more significant digits than the shortest representation
+// found by 'sprintf'.  Every function is also checked to return 0, without
+// writing past the end of the buffer, when the buffer is one character too
+// small.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] char *toChars(char *, char *, int, int);
+// [ 2] char *toChars(char *, char *, unsigned int, int);
+// [ 2] char *toChars(char *, char *, long, int);
+// [ 2] char *toChars(char *, char *, unsigned long, int);
+// [ 2] char *toChars(char *, char *, long long, int);
+// [ 2] char *toChars(char *, char *, unsigned long long, int);
+// [ 3] char *toChars(char *, char *, double);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslalg::NumericFormatterUtil Util;
+typedef bsls::Types::Int64           Int64;
+typedef bsls::Types::Uint64          Uint64;
+
+bool verbose;
+bool veryVerbose;
+bool veryVeryVerbose;
+
+enum { k_BUFFER_SIZE = 128 };
+
+//=============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+template <class TYPE>
+bool checkFormat(TYPE value, int base, const char *expected)
+    // Return 'true' if 'Util::toChars' writes the specified 'expected'
+    // representation of the specified 'value' in the specified 'base' into a
+    // buffer of exactly the required size, writes nothing beyond that buffer,
+    // and returns 0 given a buffer one character smaller; and 'false'
+    // otherwise.
+{
+    const int length = static_cast<int>(strlen(expected));
+
+    char buffer[k_BUFFER_SIZE];
+    memset(buffer, '#', sizeof buffer);
+
+    char *end = Util::toChars(buffer, buffer + length, value, base);
+    if (end != buffer + length
+     || 0 != memcmp(buffer, expected, length)
+     || '#' != buffer[length]) {
+        return false;                                                 // RETURN
+    }
+
+    memset(buffer, '#', sizeof buffer);
+    return 0 == Util::toChars(buffer, buffer + length - 1, value, base)
+        && '#' == buffer[length - 1];
+}
+
+bool checkFormat(double value, const char *expected)
+    // Return 'true' if 'Util::toChars' writes the specified 'expected'
+    // representation of the specified 'value' into a buffer of exactly the
+    // required size, writes nothing beyond that buffer, and returns 0 given a
+    // buffer one character smaller; and 'false' otherwise.
+{
+    const int length = static_cast<int>(strlen(expected));
+
+    char buffer[k_BUFFER_SIZE];
+    memset(buffer, '#', sizeof buffer);
+
+    char *end = Util::toChars(buffer, buffer + length, value);
+    if (end != buffer + length
+     || 0 != memcmp(buffer, expected, length)
+     || '#' != buffer[length]) {
+        return false;                                                 // RETURN
+    }
+
+    memset(buffer, '#', sizeof buffer);
+    return 0 == Util::toChars(buffer, buffer + length - 1, value)
+        && '#' == buffer[length - 1];
+}
+
+int numSignificantDigits(const char *begin, const char *end)
+    // Return the number of significant digits in the decimal representation
+    // of a floating-point number in the range '[begin, end)', ignoring
+    // leading and trailing zeros, the sign, the decimal point, and the
+    // exponent.
+{
+    int count = 0;  // digits up to the last non-zero digit
+    int run   = 0;  // digits since the last non-zero digit
+
+    for (const char *p = begin; p != end && 'e' != *p; ++p) {
+        if ('0' <= *p && *p <= '9') {
+            if (0 == count && 0 == run && '0' == *p) {
+                continue;  // leading zero
+            }
+            ++run;
+            if ('0' != *p) {
+                count += run;
+                run    = 0;
+            }
+        }
+    }
+    return count;
+}
+
+int shortestPrecision(double value)
+    // Return the smallest number of significant digits with which 'sprintf'
+    // represents the specified finite 'value' such that 'strtod' recovers it
+    // exactly.
+{
+    char buffer[k_BUFFER_SIZE];
+    for (int precision = 1; precision < 17; ++precision) {
+        sprintf(buffer, "%.*e", precision - 1, value);
+        if (strtod(buffer, 0) == value) {
+            return precision;                                         // RETURN
+        }
+    }
+    return 17;
+}
+
+Uint64 nextRandom(Uint64 *state)
+    // Advance the specified 'state' of a xorshift pseudo-random generator and
+    // return the next value of the sequence.
+{
+    Uint64 x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return *state = x;
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing a CSV Record
+///- - - - - - - - - - - - - - - -
+// Suppose we are writing records of comma-separated values into a fixed-size
+// buffer, which we flush when it is full.  Each record holds an identifier and
+// a price.
+//
+// First, we declare the buffer, and a pointer to the next character to be
+// written:
+//..
+    char  buffer[64];
+    char *next = buffer;
+    char *end  = buffer + sizeof buffer;
+//..
+// Then, we write a record, checking after each 'toChars' call that the value
+// fit in the remaining space:
+//..
+    next = bslalg::NumericFormatterUtil::toChars(next, end, 1042);
+    ASSERT(next);
+    *next++ = ',';
+
+    next = bslalg::NumericFormatterUtil::toChars(next, end, 101.25);
+    ASSERT(next);
+    *next++ = '\n';
+//..
+// Finally, we verify the contents of the buffer.  Note that the price is
+// written with no more digits than are needed to identify it:
+//..
+    ASSERT(12 == next - buffer);
+    ASSERT(0 == memcmp(buffer, "1042,101.25\n", 12));
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // FORMATTING 'double' VALUES
+        //
+        // Concerns:
+        //: 1 Special values (zeros, infinities, and NaNs) are written as
+        //:   documented, including their sign.
+        //:
+        //: 2 The shorter of fixed and scientific notation is used, with fixed
+        //:   notation preferred in case of a tie, and the exponent has at
+        //:   least two digits.
+        //:
+        //: 3 Every finite value is recovered exactly by 'strtod', and is
+        //:   written with the smallest possible number of significant digits.
+        //:
+        //: 4 A buffer one character too small is reported by returning 0, and
+        //:   no character is written outside the buffer.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, check the representation of a
+        //:   set of values chosen to cover the boundaries between notations,
+        //:   the extreme values, and the special values.  (C-1, 2, 4)
+        //:
+        //: 2 Format a large number of 'double' values having pseudo-random
+        //:   bit patterns, and verify that 'strtod' recovers each value from
+        //:   its representation, and that the number of significant digits
+        //:   equals the smallest precision with which the value round-trips
+        //:   through 'sprintf'.  (C-3)
+        //
+        // Testing:
+        //   char *toChars(char *, char *, double);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nFORMATTING 'double' VALUES"
+                            "\n==========================\n");
+
+        if (verbose) printf("\nTesting table of representations.\n");
+        {
+            static const struct {
+                int         d_line;
+                double      d_value;
+                const char *d_expected;
+            } DATA[] = {
+                //LINE  VALUE                     EXPECTED
+                //----  ------------------------  -------------------------
+                { L_,   0.0,                      "0"                       },
+                { L_,   1.0,                      "1"                       },
+                { L_,   -1.0,                     "-1"                      },
+                { L_,   0.1,                      "0.1"                     },
+                { L_,   0.3,                      "0.3"                     },
+                { L_,   1.5,                      "1.5"                     },
+                { L_,   101.25,                   "101.25"                  },
+                { L_,   100.0,                    "100"                     },
+                { L_,   123456.0,                 "123456"                  },
+                { L_,   1.0 / 3,                  "0.3333333333333333"      },
+                { L_,   2.0 / 3,                  "0.6666666666666666"      },
+                { L_,   0.001,                    "0.001"                   },
+                { L_,   0.0001,                   "1e-04"                   },
+                { L_,   1.23456e-8,               "1.23456e-08"             },
+                { L_,   1e15,                     "1e+15"                   },
+                { L_,   1e22,                     "1e+22"                   },
+                { L_,   1e23,                     "1e+23"                   },
+                { L_,   -6.02214076e23,           "-6.02214076e+23"         },
+                { L_,   9007199254740992.0,       "9007199254740992"        },
+                { L_,   1234567890123456789.0,    "1234567890123456800"     },
+                { L_,   5e-324,                   "5e-324"                  },
+                { L_,   2.2250738585072014e-308,  "2.2250738585072014e-308" },
+                { L_,   1.7976931348623157e308,   "1.7976931348623157e+308" },
+                { L_,   -1.7976931348623157e308,  "-1.7976931348623157e+308"},
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE     = DATA[ti].d_line;
+                const double      VALUE    = DATA[ti].d_value;
+                const char *const EXPECTED = DATA[ti].d_expected;
+
+                if (veryVerbose) { T_ P_(LINE) P(EXPECTED) }
+
+                ASSERTV(LINE, EXPECTED, checkFormat(VALUE, EXPECTED));
+            }
+        }
+
+        if (verbose) printf("\nTesting special values.\n");
+        {
+            const double ZERO = 0.0;
+            const double INF  = 1.0 / ZERO;
+
+            ASSERT(checkFormat(-ZERO,  "-0"));
+            ASSERT(checkFormat(INF,    "inf"));
+            ASSERT(checkFormat(-INF,   "-inf"));
+
+            // The sign of the NaN produced by '0.0 / 0.0' is unspecified, so
+            // quiet NaNs of each sign are built from their bit patterns.
+
+            const Uint64 POSITIVE_NAN_BITS = 0x7ff8000000000000ULL;
+            const Uint64 NEGATIVE_NAN_BITS = 0xfff8000000000000ULL;
+
+            double positiveNan;
+            double negativeNan;
+            memcpy(&positiveNan, &POSITIVE_NAN_BITS, sizeof positiveNan);
+            memcpy(&negativeNan, &NEGATIVE_NAN_BITS, sizeof negativeNan);
+
+            ASSERT(checkFormat(positiveNan, "nan"));
+            ASSERT(checkFormat(negativeNan, "-nan"));
+        }
+
+        if (verbose) printf("\nTesting pseudo-random values.\n");
+        {
+            const int NUM_VALUES = veryVeryVerbose ? 10000000 : 200000;
+
+            Uint64 state = 0x9e3779b97f4a7c15ULL;
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                const Uint64 BITS = nextRandom(&state);
+
+                double value;
+                memcpy(&value, &BITS, sizeof value);
+                if (value != value || value - value != 0) {
+                    continue;  // NaN or infinity
+                }
+
+                char  buffer[k_BUFFER_SIZE];
+                char *end = Util::toChars(buffer,
+                                          buffer + Util::k_MAX_LENGTH_DOUBLE,
+                                          value);
+                ASSERTV(i, end);
+                if (!end) {
+                    continue;
+                }
+                *end = '\0';
+
+                ASSERTV(buffer, strtod(buffer, 0) == value);
+                const int NUM_DIGITS = numSignificantDigits(buffer, end);
+                ASSERTV(buffer, NUM_DIGITS == shortestPrecision(value));
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // FORMATTING INTEGRAL VALUES
+        //
+        // Concerns:
+        //: 1 Values are written in the specified base with lower-case letters
+        //:   for digits above 9, with a leading '-' for negative values and no
+        //:   leading zeros.
+        //:
+        //: 2 The extreme values of each type, including the most negative
+        //:   value of each signed type, are written correctly.
+        //:
+        //: 3 A buffer one character too small is reported by returning 0, and
+        //:   no character is written outside the buffer.
+        //:
+        //: 4 The 'k_MAX_LENGTH_*' constants are large enough for any value in
+        //:   any base.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, check the representation of a
+        //:   set of values in several bases, for each type able to hold the
+        //:   value.  (C-1, 3)
+        //:
+        //: 2 Compare the representation of the extreme values of each type in
+        //:   bases 8, 10, and 16 with that written by 'sprintf'.  (C-2, 3)
+        //:
+        //: 3 Verify that the extreme values of each type in base 2 fit in a
+        //:   buffer of 'k_MAX_LENGTH_*' characters.  (C-4)
+        //
+        // Testing:
+        //   char *toChars(char *, char *, int, int);
+        //   char *toChars(char *, char *, unsigned int, int);
+        //   char *toChars(char *, char *, long, int);
+        //   char *toChars(char *, char *, unsigned long, int);
+        //   char *toChars(char *, char *, long long, int);
+        //   char *toChars(char *, char *, unsigned long long, int);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nFORMATTING INTEGRAL VALUES"
+                            "\n==========================\n");
+
+        if (verbose) printf("\nTesting table of representations.\n");
+        {
+            static const struct {
+                int         d_line;
+                Int64       d_value;
+                int         d_base;
+                const char *d_expected;
+            } DATA[] = {
+                //LINE  VALUE                 BASE  EXPECTED
+                //----  --------------------  ----  --------------------
+                { L_,   0,                    10,   "0"                  },
+                { L_,   0,                     2,   "0"                  },
+                { L_,   0,                    36,   "0"                  },
+                { L_,   7,                    10,   "7"                  },
+                { L_,   -7,                   10,   "-7"                 },
+                { L_,   10,                   10,   "10"                 },
+                { L_,   99,                   10,   "99"                 },
+                { L_,   100,                  10,   "100"                },
+                { L_,   -1042,                10,   "-1042"              },
+                { L_,   123456789,            10,   "123456789"          },
+                { L_,   1000000000,           10,   "1000000000"         },
+                { L_,   5,                     2,   "101"                },
+                { L_,   -5,                    2,   "-101"               },
+                { L_,   255,                   2,   "11111111"           },
+                { L_,   8,                     8,   "10"                 },
+                { L_,   511,                   8,   "777"                },
+                { L_,   255,                  16,   "ff"                 },
+                { L_,   -48879,               16,   "-beef"              },
+                { L_,   35,                   36,   "z"                  },
+                { L_,   36,                   36,   "10"                 },
+                { L_,   1295,                 36,   "zz"                 },
+                { L_,   12345678901LL,        10,   "12345678901"        },
+                { L_,   -12345678901LL,       10,   "-12345678901"       },
+                { L_,   0x123456789abcdefLL,  16,   "123456789abcdef"    },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE     = DATA[ti].d_line;
+                const Int64       VALUE    = DATA[ti].d_value;
+                const int         BASE     = DATA[ti].d_base;
+                const char *const EXPECTED = DATA[ti].d_expected;
+
+                if (veryVerbose) { T_ P_(LINE) P_(BASE) P(EXPECTED) }
+
+                ASSERTV(LINE, checkFormat<long long>(VALUE, BASE, EXPECTED));
+
+                if (INT_MIN <= VALUE && VALUE <= INT_MAX) {
+                    ASSERTV(LINE, checkFormat(static_cast<int>(VALUE),
+                                              BASE,
+                                              EXPECTED));
+                    ASSERTV(LINE, checkFormat(static_cast<long>(VALUE),
+                                              BASE,
+                                              EXPECTED));
+                }
+                if (0 <= VALUE) {
+                    ASSERTV(LINE, checkFormat(static_cast<Uint64>(VALUE),
+                                              BASE,
+                                              EXPECTED));
+                    ASSERTV(LINE, checkFormat(
+                                           static_cast<unsigned long>(VALUE),
+                                           BASE,
+                                           EXPECTED));
+                }
+                if (0 <= VALUE && VALUE <= static_cast<Int64>(UINT_MAX)) {
+                    ASSERTV(LINE, checkFormat(static_cast<unsigned>(VALUE),
+                                              BASE,
+                                              EXPECTED));
+                }
+            }
+        }
+
+        if (verbose) printf("\nTesting extreme values.\n");
+        {
+            static const int BASES[] = { 8, 10, 16 };
+            static const char *const SIGNED_FORMATS[]   = { 0,     "%lld",
+                                                            0 };
+            static const char *const UNSIGNED_FORMATS[] = { "%llo", "%llu",
+                                                            "%llx" };
+            char expected[k_BUFFER_SIZE];
+
+            for (int bi = 0; bi < 3; ++bi) {
+                const int BASE = BASES[bi];
+
+                if (veryVerbose) { T_ P(BASE) }
+
+                if (SIGNED_FORMATS[bi]) {
+                    sprintf(expected, SIGNED_FORMATS[bi], (long long)INT_MIN);
+                    ASSERTV(BASE, checkFormat(INT_MIN, BASE, expected));
+                    sprintf(expected, SIGNED_FORMATS[bi], (long long)INT_MAX);
+                    ASSERTV(BASE, checkFormat(INT_MAX, BASE, expected));
+                    sprintf(expected, SIGNED_FORMATS[bi], (long long)LONG_MIN);
+                    ASSERTV(BASE, checkFormat(LONG_MIN, BASE, expected));
+                    sprintf(expected, SIGNED_FORMATS[bi], (long long)LONG_MAX);
+                    ASSERTV(BASE, checkFormat(LONG_MAX, BASE, expected));
+                    sprintf(expected, SIGNED_FORMATS[bi], LLONG_MIN);
+                    ASSERTV(BASE, checkFormat(LLONG_MIN, BASE, expected));
+                    sprintf(expected, SIGNED_FORMATS[bi], LLONG_MAX);
+                    ASSERTV(BASE, checkFormat(LLONG_MAX, BASE, expected));
+                }
+
+                sprintf(expected,
+                        UNSIGNED_FORMATS[bi],
+                        (unsigned long long)UINT_MAX);
+                ASSERTV(BASE, checkFormat(UINT_MAX, BASE, expected));
+                sprintf(expected,
+                        UNSIGNED_FORMATS[bi],
+                        (unsigned long long)ULONG_MAX);
+                ASSERTV(BASE, checkFormat(ULONG_MAX, BASE, expected));
+                sprintf(expected, UNSIGNED_FORMATS[bi], ULLONG_MAX);
+                ASSERTV(BASE, checkFormat(ULLONG_MAX, BASE, expected));
+            }
+        }
+
+        if (verbose) printf("\nTesting 'k_MAX_LENGTH_*'.\n");
+        {
+            char buffer[k_BUFFER_SIZE];
+            char *const INT_END   = buffer + Util::k_MAX_LENGTH_INT;
+            char *const INT64_END = buffer + Util::k_MAX_LENGTH_INT64;
+
+            ASSERT(Util::toChars(buffer, INT_END,   INT_MIN,    2));
+            ASSERT(Util::toChars(buffer, INT_END,   UINT_MAX,   2));
+            ASSERT(Util::toChars(buffer, INT64_END, LLONG_MIN,  2));
+            ASSERT(Util::toChars(buffer, INT64_END, ULLONG_MAX, 2));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Format a few integral and 'double' values and verify the result.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        char  buffer[k_BUFFER_SIZE];
+        char *end;
+
+        end = Util::toChars(buffer, buffer + sizeof buffer, 42);
+        ASSERT(2 == end - buffer);
+        ASSERT(0 == memcmp(buffer, "42", 2));
+
+        end = Util::toChars(buffer, buffer + sizeof buffer, -42, 16);
+        ASSERT(3 == end - buffer);
+        ASSERT(0 == memcmp(buffer, "-2a", 3));
+
+        end = Util::toChars(buffer, buffer + sizeof buffer, 0.5);
+        ASSERT(3 == end - buffer);
+        ASSERT(0 == memcmp(buffer, "0.5", 3));
+
+        end = Util::toChars(buffer, buffer + 2, 0.5);
+        ASSERT(0 == end);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Compare the time taken to format integral and 'double' values with
+        //   that taken by 'sprintf'.
+        //
+        // Concerns:
+        //: 1 'toChars' is substantially faster than 'sprintf'.
+        //
+        // Plan:
+        //: 1 Format a sequence of values with each method and report the
+        //:   average time per value.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST"
+                            "\n================\n");
+
+        enum { k_ITERATIONS = 1000000 };
+
+        char            buffer[k_BUFFER_SIZE];
+        bsls::Stopwatch timer;
+        unsigned        checksum = 0;
+
+        timer.start();
+        for (unsigned i = 0; i < k_ITERATIONS; ++i) {
+            char *end = Util::toChars(buffer,
+                                      buffer + sizeof buffer,
+                                      static_cast<int>(i * 7919u));
+            checksum += static_cast<unsigned>(end - buffer);
+        }
+        timer.stop();
+        printf("toChars(int):     %6.1f ns\n",
+               timer.elapsedTime() * 1e9 / k_ITERATIONS);
+
+        timer.reset();
+        timer.start();
+        for (unsigned i = 0; i < k_ITERATIONS; ++i) {
+            checksum += sprintf(buffer, "%d", static_cast<int>(i * 7919u));
+        }
+        timer.stop();
+        printf("sprintf(int):     %6.1f ns\n",
+               timer.elapsedTime() * 1e9 / k_ITERATIONS);
+
+        timer.reset();
+        timer.start();
+        for (unsigned i = 0; i < k_ITERATIONS; ++i) {
+            char *end = Util::toChars(buffer,
+                                      buffer + sizeof buffer,
+                                      i * 0.01 + 1.0 / 3);
+            checksum += static_cast<unsigned>(end - buffer);
+        }
+        timer.stop();
+        printf("toChars(double):  %6.1f ns\n",
+               timer.elapsedTime() * 1e9 / k_ITERATIONS);
+
+        timer.reset();
+        timer.start();
+        for (unsigned i = 0; i < k_ITERATIONS; ++i) {
+            checksum += sprintf(buffer, "%.17g", i * 0.01 + 1.0 / 3);
+        }
+        timer.stop();
+        printf("sprintf(double):  %6.1f ns\n",
+               timer.elapsedTime() * 1e9 / k_ITERATIONS);
+
+        if (veryVerbose) { P(checksum) }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
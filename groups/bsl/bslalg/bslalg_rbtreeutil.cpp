@@ -153,6 +153,55 @@ static void recolorTreeAfterRemoval(RbTreeAnchor *tree,
     }
 }
 
+static RbTreeNode *buildBalancedSubtree(RbTreeNode **nextNode,
+                                        int          numNodes,
+                                        int          depth,
+                                        int          redDepth)
+    // Return the root of a perfectly balanced subtree formed from the
+    // specified 'numNodes' nodes of the chain (linked through their right
+    // child pointers) starting at the specified '*nextNode', and load into
+    // 'nextNode' the chain node following the last node consumed.  The
+    // returned subtree root is located at the specified 'depth' in the
+    // complete tree; color each node located at the specified 'redDepth'
+    // red, and every other node black.  Return 0 if '0 == numNodes'.
+{
+    if (0 == numNodes) {
+        return 0;                                                     // RETURN
+    }
+
+    // Consume the chain in order: the left subtree, then the root, then the
+    // right subtree.
+
+    const int numLeft = (numNodes - 1) / 2;
+
+    RbTreeNode *left = buildBalancedSubtree(nextNode,
+                                            numLeft,
+                                            depth + 1,
+                                            redDepth);
+    RbTreeNode *root = *nextNode;
+    *nextNode = root->rightChild();
+
+    RbTreeNode *right = buildBalancedSubtree(nextNode,
+                                             numNodes - numLeft - 1,
+                                             depth + 1,
+                                             redDepth);
+    root->setLeftChild(left);
+    if (left) {
+        left->setParent(root);
+    }
+    root->setRightChild(right);
+    if (right) {
+        right->setParent(root);
+    }
+    if (depth == redDepth) {
+        root->makeRed();
+    }
+    else {
+        root->makeBlack();
+    }
+    return root;
+}
+
                         // ----------------
                         // class RbTreeUtil
                         // ----------------
@@ -210,6 +259,61 @@ const RbTreeNode *RbTreeUtil::previous(const RbTreeNode *node)
     return parent;
 }
 
+void RbTreeUtil::appendToChain(RbTreeAnchor *chain,
+                               RbTreeNode   *lastNode,
+                               RbTreeNode   *newNode)
+{
+    BSLS_ASSERT(chain);
+    BSLS_ASSERT(lastNode);
+    BSLS_ASSERT(newNode);
+
+    newNode->setParent(lastNode);
+    newNode->setLeftChild(0);
+    newNode->setRightChild(0);
+    if (chain->sentinel() == lastNode) {
+        chain->reset(newNode, newNode, 1);
+    }
+    else {
+        BSLS_ASSERT_SAFE(0 == lastNode->rightChild());
+
+        lastNode->setRightChild(newNode);
+        chain->incrementNumNodes();
+    }
+}
+
+void RbTreeUtil::balanceChain(RbTreeAnchor *chain)
+{
+    BSLS_ASSERT(chain);
+
+    const int numNodes = chain->numNodes();
+    if (0 == numNodes) {
+        return;                                                       // RETURN
+    }
+
+    // A perfectly balanced tree of 'numNodes' nodes is complete on every level
+    // but (possibly) the deepest, at depth 'floor(log2(numNodes))'.  Coloring
+    // the nodes of an incomplete deepest level red, and all other nodes black,
+    // gives every path from the root to a leaf the same number of black
+    // nodes.
+
+    int height = 0;
+    for (int n = numNodes; 1 < n; n >>= 1) {
+        ++height;
+    }
+    const bool isComplete = 0 == ((numNodes + 1) & numNodes);
+    const int  redDepth   = isComplete ? -1 : height;
+
+    RbTreeNode *nextNode = chain->firstNode();
+    RbTreeNode *root     = buildBalancedSubtree(&nextNode,
+                                                numNodes,
+                                                0,
+                                                redDepth);
+    BSLS_ASSERT_SAFE(0 == nextNode);
+
+    root->setParent(chain->sentinel());
+    chain->setRootNode(root);
+}
+
 void RbTreeUtil::insertAt(RbTreeAnchor *tree,
                           RbTreeNode   *parentNode,
                           bool          leftChildFlag,
@@ -12,6 +12,7 @@ BSLS_IDENT("$Id$ $CSID$")
 //@CLASSES:
 //  bslalg::RbTreeUtil: namespace for red-black tree functions
 //  bslalg::RbTreeUtilTreeProctor: proctor to manage all nodes in a tree
+//  bslalg::RbTreeUtilChainProctor: proctor to balance a partially built chain
 //
 //@SEE_ALSO: bslalg_rbtreenode
 //
@@ -52,6 +53,10 @@ BSLS_IDENT("$Id$ $CSID$")
 // The following algorithms are used in the process of manipulating the
 // structure of a tree:
 //..
+//  appendToChain       Append the supplied node to a sorted chain of nodes.
+//
+//  balanceChain        Form a balanced tree from a sorted chain of nodes.
+//
 //  copyTree            Return a deep-copy of the supplied tree.
 //
 //  deleteTree          Delete all the nodes of the supplied tree.
@@ -143,6 +148,25 @@ BSLS_IDENT("$Id$ $CSID$")
 // 'findUniqueInsertLocation', as well as supplied to 'previous' to obtain the
 // rightmost node of a (non-empty) tree.
 //
+///Building a Tree from Sorted Nodes
+///- - - - - - - - - - - - - - - - -
+// Inserting N nodes one at a time, even when the nodes arrive in sorted order
+// and are attached directly as the right child of the previous node (using
+// 'insertAt'), performs O[N] re-colorings and rotations in total and produces
+// a valid, but not perfectly balanced, tree.  When the nodes are known to
+// arrive in sorted order, 'appendToChain' can instead be used to link each
+// node, in constant time and without rebalancing, as the right child of its
+// predecessor, producing a *chain*: a degenerate binary tree in which no node
+// has a left child.  'balanceChain' then relinks and colors the nodes of the
+// chain, in a single O[N] pass that performs no comparisons, into a perfectly
+// balanced red-black tree (i.e., one whose left and right subtrees differ in
+// size by at most one at every node).  If an exception is thrown while a
+// chain is being built, an 'RbTreeUtilChainProctor' can be used to balance
+// the nodes appended so far, so that they form a well-formed tree.  Note that,
+// although a chain is not a well-formed tree, it is a valid binary tree, so a
+// partially built chain can also be destroyed using 'deleteTree' (e.g., by an
+// 'RbTreeUtilTreeProctor').
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -830,6 +854,33 @@ struct RbTreeUtil {
 
                                  // Modification
 
+    static void appendToChain(RbTreeAnchor *chain,
+                              RbTreeNode   *lastNode,
+                              RbTreeNode   *newNode);
+        // Append the specified 'newNode' to the end of the specified 'chain'
+        // by attaching it, without rebalancing, as the right child of the
+        // specified 'lastNode', or, if 'chain' is empty, by making 'newNode'
+        // the root (and first) node of 'chain'.  The color of 'newNode' is
+        // unspecified until 'balanceChain' is called on 'chain'.  The
+        // behavior is undefined unless 'chain' is empty and 'lastNode' is
+        // 'chain->sentinel()', or 'chain' is a chain (i.e., a binary tree in
+        // which no node has a left child) whose rightmost node is 'lastNode'.
+        // Note that if each node in 'chain' is ordered after its predecessor,
+        // 'balanceChain' can be used to form a valid red-black tree from
+        // 'chain' in linear time.
+
+    static void balanceChain(RbTreeAnchor *chain);
+        // Relink and re-color the nodes of the specified 'chain', in O[N]
+        // time where N is the number of nodes in 'chain', to form a perfectly
+        // balanced valid red-black tree (see 'validateRbTree') having the
+        // same in-order sequence of nodes as 'chain'.  This operation
+        // performs no comparisons; the resulting tree is well-formed (see
+        // 'isWellFormed') with respect to any comparator for which each node
+        // in 'chain' is ordered at or after its predecessor.  The behavior is
+        // undefined unless 'chain' is a chain (i.e., a binary tree in which no
+        // node has a left child), such as one built by 'appendToChain', whose
+        // first node and node count are correctly recorded in 'chain'.
+
     template <class FACTORY>
     static void copyTree(RbTreeAnchor        *result,
                          const RbTreeAnchor&  original,
@@ -1237,6 +1288,38 @@ class RbTreeUtilTreeProctor {
         // Release from management the tree supplied at construction.
 };
 
+                        // ============================
+                        // class RbTreeUtilChainProctor
+                        // ============================
+
+class RbTreeUtilChainProctor {
+    // This class implements a proctor that, unless 'release' is called,
+    // balances (see 'RbTreeUtil::balanceChain') the chain supplied at
+    // construction on destruction, so that the nodes appended to the chain
+    // before an exception was thrown form a well-formed tree.
+
+    // DATA
+    RbTreeAnchor *d_chain_p;  // address of chain (held, not owned)
+
+    // NOT IMPLEMENTED
+    RbTreeUtilChainProctor(const RbTreeUtilChainProctor&);
+    RbTreeUtilChainProctor& operator=(const RbTreeUtilChainProctor&);
+
+  public:
+    // CREATORS
+    explicit RbTreeUtilChainProctor(RbTreeAnchor *chain);
+        // Create a proctor object that, unless 'release' is called, will, on
+        // destruction, balance the specified 'chain'.
+
+    ~RbTreeUtilChainProctor();
+        // Unless 'release' has been called, balance the chain supplied at
+        // construction.
+
+    // MANIPULATORS
+    void release();
+        // Release from management the chain supplied at construction.
+};
+
 // ============================================================================
 //                      INLINE FUNCTION DEFINITIONS
 // ============================================================================
@@ -1869,6 +1952,33 @@ void RbTreeUtilTreeProctor<DELETER>::release()
     d_tree_p = 0;
 }
 
+                        // ----------------------------
+                        // class RbTreeUtilChainProctor
+                        // ----------------------------
+
+// CREATORS
+inline
+RbTreeUtilChainProctor::RbTreeUtilChainProctor(RbTreeAnchor *chain)
+: d_chain_p(chain)
+{
+    BSLS_ASSERT_SAFE(chain);
+}
+
+inline
+RbTreeUtilChainProctor::~RbTreeUtilChainProctor()
+{
+    if (d_chain_p) {
+        RbTreeUtil::balanceChain(d_chain_p);
+    }
+}
+
+// MANIPULATORS
+inline
+void RbTreeUtilChainProctor::release()
+{
+    d_chain_p = 0;
+}
+
 }  // close namespace bslalg
 }  // close enterprise namespace
 
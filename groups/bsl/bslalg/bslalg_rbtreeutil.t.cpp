@@ -65,6 +65,9 @@ using namespace bslalg;
 // [12] const RbTreeNode *upperBound(const Anchor&, const COMP&, const VALUE&);
 // [12]       RbTreeNode *upperBound(Anchor&, const COMP&, const VALUE&);
 // Modification
+// [26] void appendToChain(RbTreeAnchor *, RbTreeNode *, RbTreeNode *);
+// [26] void balanceChain(RbTreeAnchor *);
+// [26] RbTreeUtilChainProctor
 // [20] void copyTree(RbTreeAnchor *, const RbTreeAnchor& , FACTORY *);
 // [19] void deleteTree(RbTreeAnchor *, FACTORY *);
 // [14] RbTreeNode *findInsertLocation(bool*,Anchor*,COMP&,const VALUE&);
@@ -87,7 +90,7 @@ using namespace bslalg;
 // [ 2] Validator::isWellFormedAnchor(const RbTreeAnchor& ,const COMPR& );
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [26] USAGE EXAMPLE
+// [27] USAGE EXAMPLE
 // [ 3] CONCERN: gg Generator
 // [25] CONCERN: Additional verification of exception safety of 'copyTree'
 
@@ -716,6 +719,18 @@ int countNodes(RbTreeNode *node)
     return 1 + countNodes(node->leftChild()) + countNodes(node->rightChild());
 }
 
+int treeHeight(const RbTreeNode *node)
+    // Return the number of nodes on the longest path from the specified
+    // 'node' to a leaf of the subtree rooted at 'node', or 0 if 'node' is 0.
+{
+    if (0 == node) {
+        return 0;
+    }
+    const int leftHeight  = treeHeight(node->leftChild());
+    const int rightHeight = treeHeight(node->rightChild());
+    return 1 + (leftHeight < rightHeight ? rightHeight : leftHeight);
+}
+
 
 class RbTreeNodeRangeIterator {
     // This class provides a trivial iterator to simplify the process of
@@ -5703,7 +5718,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 26: {
+      case 27: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -5779,6 +5794,214 @@ int main(int argc, char *argv[])
               }
           }
       } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // CLASS METHODS: appendToChain, balanceChain
+        //
+        // Concerns:
+        //:  1 'appendToChain' on an empty tree makes the supplied node the
+        //:    root and first node, with the sentinel as its parent.
+        //:
+        //:  2 'appendToChain' on a non-empty chain attaches the supplied node
+        //:    as the right child of the supplied last node, and increments
+        //:    the node count without changing the root or first node.
+        //:
+        //:  3 A chain is a valid binary tree that can be destroyed with
+        //:    'deleteTree'.
+        //:
+        //:  4 'balanceChain' forms a well-formed, valid red-black tree having
+        //:    the same in-order sequence of nodes as the chain, for chains of
+        //:    any length (including 0), and whether or not adjacent nodes
+        //:    hold equal values.
+        //:
+        //:  5 The tree formed by 'balanceChain' has the minimal height for
+        //:    its number of nodes.
+        //:
+        //:  6 'RbTreeUtilChainProctor' balances the supplied chain on
+        //:    destruction, unless 'release' has been called.
+        //:
+        //:  7 QoI: Asserted precondition violations are detected when
+        //:    enabled.
+        //
+        // Plan:
+        //:  1 For chain lengths from 0 to 300, and for several larger lengths
+        //:    around powers of two, append nodes holding ascending values to
+        //:    an empty tree, verifying the chain structure after each append.
+        //:    (C-1..2)
+        //:
+        //:  2 Balance each chain, verify the result using 'isWellFormed',
+        //:    iterate over the tree verifying the sequence of nodes, and
+        //:    verify the height of the tree is 'floor(log2(N)) + 1'.  Repeat
+        //:    with a sequence of values in which each value appears twice.
+        //:    (C-4..5)
+        //:
+        //:  3 Build chains of 'DeleteTestNode' objects and destroy them with
+        //:    'deleteTree', verifying each node is deleted.  (C-3)
+        //:
+        //:  4 Build chains within the scope of an 'RbTreeUtilChainProctor',
+        //:    releasing the proctor for some of them, and verify the chains
+        //:    are balanced exactly when the proctor is not released.  (C-6)
+        //:
+        //:  5 Verify that, in appropriate build modes, defensive checks are
+        //:    triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   void appendToChain(RbTreeAnchor *, RbTreeNode *, RbTreeNode *);
+        //   void balanceChain(RbTreeAnchor *);
+        //   RbTreeUtilChainProctor
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCLASS METHODS: appendToChain, balanceChain"
+                            "\n==========================================\n");
+
+        if (veryVerbose) printf("\tBuild and balance chains.\n");
+        {
+            const int LENGTHS[] = { 511, 512, 513, 1023, 1024, 1025, 5000 };
+            const int NUM_LENGTHS = sizeof(LENGTHS) / sizeof(*LENGTHS);
+
+            bslma::TestAllocator ta;
+            IntNodeComparator    nodeComparator;
+
+            for (int ti = 0; ti < 301 + NUM_LENGTHS; ++ti) {
+                const int N = ti < 301 ? ti : LENGTHS[ti - 301];
+
+                int expHeight = 0;
+                for (int n = N; 0 < n; n >>= 1) {
+                    ++expHeight;
+                }
+
+                for (int divisor = 1; divisor <= 2; ++divisor) {
+                    Array<IntNode> nodes(&ta);
+                    nodes.reset(N);
+
+                    RbTreeAnchor tree; const RbTreeAnchor& TREE = tree;
+
+                    RbTreeNode *lastNode = tree.sentinel();
+                    for (int i = 0; i < N; ++i) {
+                        nodes[i].value() = i / divisor;
+                        Obj::appendToChain(&tree, lastNode, &nodes[i]);
+
+                        ASSERTV(N, i, i + 1     == TREE.numNodes());
+                        ASSERTV(N, i, &nodes[0] == TREE.rootNode());
+                        ASSERTV(N, i, &nodes[0] == TREE.firstNode());
+                        ASSERTV(N, i, lastNode  == nodes[i].parent());
+                        ASSERTV(N, i, 0         == nodes[i].leftChild());
+                        ASSERTV(N, i, 0         == nodes[i].rightChild());
+                        if (0 < i) {
+                            ASSERTV(N, i,
+                                    &nodes[i] == nodes[i - 1].rightChild());
+                        }
+                        lastNode = &nodes[i];
+                    }
+
+                    Obj::balanceChain(&tree);
+
+                    ASSERTV(N, divisor, N == TREE.numNodes());
+                    ASSERTV(N, divisor,
+                            Obj::isWellFormed(TREE, nodeComparator));
+                    ASSERTV(N, divisor,
+                            expHeight == treeHeight(TREE.rootNode()));
+
+                    const RbTreeNode *node = TREE.firstNode();
+                    for (int i = 0; i < N; ++i) {
+                        ASSERTV(N, divisor, i, &nodes[i] == node);
+                        node = Obj::next(node);
+                    }
+                    ASSERTV(N, divisor, TREE.sentinel() == node);
+                }
+            }
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+
+        if (veryVerbose) printf("\tDelete unbalanced chains.\n");
+        {
+            bslma::TestAllocator ta;
+
+            for (int N = 0; N < 20; ++N) {
+                Array<DeleteTestNode> nodes(&ta);
+                nodes.reset(N);
+
+                RbTreeAnchor tree;
+
+                RbTreeNode *lastNode = tree.sentinel();
+                for (int i = 0; i < N; ++i) {
+                    nodes[i].d_value = i;
+                    Obj::appendToChain(&tree, lastNode, &nodes[i]);
+                    lastNode = &nodes[i];
+                }
+
+                DeleteTestNodeFactory testDeleter;
+                Obj::deleteTree(&tree, &testDeleter);
+                for (int i = 0; i < N; ++i) {
+                    ASSERTV(N, i, nodes[i].d_deleted);
+                }
+                ASSERTV(N, N               == testDeleter.numInvocations());
+                ASSERTV(N, tree.sentinel() == tree.firstNode());
+                ASSERTV(N, 0               == tree.rootNode());
+            }
+        }
+
+        if (veryVerbose) printf("\tUse 'RbTreeUtilChainProctor'.\n");
+        {
+            bslma::TestAllocator ta;
+            IntNodeComparator    nodeComparator;
+
+            for (int N = 0; N < 20; ++N) {
+                for (int release = 0; release <= 1; ++release) {
+                    Array<IntNode> nodes(&ta);
+                    nodes.reset(N);
+
+                    RbTreeAnchor tree; const RbTreeAnchor& TREE = tree;
+                    {
+                        RbTreeUtilChainProctor proctor(&tree);
+
+                        RbTreeNode *lastNode = tree.sentinel();
+                        for (int i = 0; i < N; ++i) {
+                            nodes[i].value() = i;
+                            Obj::appendToChain(&tree, lastNode, &nodes[i]);
+                            lastNode = &nodes[i];
+                        }
+                        if (release) {
+                            proctor.release();
+                        }
+                    }
+                    ASSERTV(N, release, N == TREE.numNodes());
+                    if (release) {
+                        ASSERTV(N, N == treeHeight(TREE.rootNode()));
+                        Obj::balanceChain(&tree);
+                    }
+                    ASSERTV(N, release,
+                            Obj::isWellFormed(TREE, nodeComparator));
+                }
+            }
+        }
+
+        if (veryVerbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            RbTreeAnchor tree;
+            IntNode      nodes[3];
+
+            ASSERT_FAIL(Obj::appendToChain(0, tree.sentinel(), &nodes[0]));
+            ASSERT_FAIL(Obj::appendToChain(&tree, 0, &nodes[0]));
+            ASSERT_FAIL(Obj::appendToChain(&tree, tree.sentinel(), 0));
+            ASSERT_PASS(Obj::appendToChain(&tree,
+                                           tree.sentinel(),
+                                           &nodes[0]));
+            ASSERT_PASS(Obj::appendToChain(&tree, &nodes[0], &nodes[1]));
+            ASSERT_SAFE_FAIL(Obj::appendToChain(&tree,
+                                                &nodes[0],
+                                                &nodes[2]));
+
+            ASSERT_FAIL(Obj::balanceChain(0));
+            ASSERT_PASS(Obj::balanceChain(&tree));
+
+            ASSERT_SAFE_FAIL((RbTreeUtilChainProctor(0)));
+            ASSERT_SAFE_PASS((RbTreeUtilChainProctor(&tree)));
+        }
+      } break;
       case 25: {
         // --------------------------------------------------------------------
         // CLASS METHOD: copyTree (Additional Exception Safety Tests)
@@ -356,6 +356,13 @@ bool HashTable<TYPE, HASHER>::contains(const TYPE& value) const
 
 typedef DefaultHashAlgorithm Obj;
 
+#ifdef BSLH_DEFAULTHASHALGORITHM_USE_WYHASH
+typedef WyHashAlgorithm     InternalHashAlgorithm;
+#else
+typedef SpookyHashAlgorithm InternalHashAlgorithm;
+#endif
+    // The algorithm that 'Obj' is expected to use.
+
 // ============================================================================
 //                            MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -429,7 +436,7 @@ int main(int argc, char *argv[])
         //
         // Concerns:
         //: 1 The typedef 'result_type' is publicly accessible and an alias for
-        //:   'bslh::SpookyHashAlgorithm::result_type'.
+        //:   'InternalHashAlgorithm::result_type'.
         //:
         //: 2 'computeHash()' returns 'result_type'
         //
@@ -451,7 +458,7 @@ int main(int argc, char *argv[])
                             " correct type using 'bslmf::IsSame'. (C-1)\n");
         {
             ASSERT((bslmf::IsSame<Obj::result_type,
-                                  SpookyHashAlgorithm::result_type>::VALUE));
+                                  InternalHashAlgorithm::result_type>::VALUE));
         }
 
         if (verbose) printf("Declare the expected signature of 'computeHash()'"
@@ -544,7 +551,7 @@ int main(int argc, char *argv[])
 
                 Obj                 contiguousHash;
                 Obj                 dispirateHash;
-                SpookyHashAlgorithm cannonicalHashAlgorithm;
+                InternalHashAlgorithm cannonicalHashAlgorithm;
 
                 cannonicalHashAlgorithm(VALUE, strlen(VALUE));
                 contiguousHash(VALUE, strlen(VALUE));
@@ -555,7 +562,7 @@ int main(int argc, char *argv[])
                     dispirateHash(&VALUE[j], sizeof(char));
                 }
 
-                SpookyHashAlgorithm::result_type hash =
+                InternalHashAlgorithm::result_type hash =
                                          cannonicalHashAlgorithm.computeHash();
 
                 LOOP_ASSERT(LINE, hash == contiguousHash.computeHash());
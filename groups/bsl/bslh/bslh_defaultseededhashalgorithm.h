@@ -65,6 +65,17 @@ BSLS_IDENT("$Id: $")
 // recommended to write hashes from 'bslh::DefaultSeededHashAlgorithm' to any
 // memory accessible by multiple machines.
 //
+///Choosing the Internal Algorithm
+///-------------------------------
+// By default, 'bslh::DefaultSeededHashAlgorithm' uses
+// 'bslh::SpookyHashAlgorithm'.  If the macro
+// 'BSLH_DEFAULTSEEDEDHASHALGORITHM_USE_WYHASH' is defined when this header is
+// included, 'bslh::WyHashAlgorithm' is used instead, which is considerably
+// faster for the short keys (up to about 32 bytes) that are typical of hash
+// tables.  Note that, as the underlying algorithm determines the hashes that
+// are produced, the macro must be defined (or not) consistently in every
+// translation unit of a program.
+//
 ///Usage
 ///-----
 // This section illustrates intended usage of this component.
@@ -303,6 +314,10 @@ BSLS_IDENT("$Id: $")
 #include <bslh_spookyhashalgorithm.h>
 #endif
 
+#ifndef INCLUDED_BSLH_WYHASHALGORITHM
+#include <bslh_wyhashalgorithm.h>
+#endif
+
 namespace BloombergLP {
 
 namespace bslh {
@@ -314,10 +329,14 @@ class DefaultSeededHashAlgorithm {
 
   private:
     // PRIVATE TYPES
+#ifdef BSLH_DEFAULTSEEDEDHASHALGORITHM_USE_WYHASH
+    typedef bslh::WyHashAlgorithm InternalHashAlgorithm;
+#else
     typedef bslh::SpookyHashAlgorithm InternalHashAlgorithm;
+#endif
         // Typedef indicating the algorithm currently being used by
         // 'bslh::DefualtHashAlgorithm' to compute hashes.  This algorithm is
-        // subject to change.
+        // subject to change (see {Choosing the Internal Algorithm}).
 
     // DATA
     InternalHashAlgorithm d_state;
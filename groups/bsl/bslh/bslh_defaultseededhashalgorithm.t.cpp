@@ -112,6 +112,14 @@ void aSsErT(bool b, const char *s, int i)
 //-----------------------------------------------------------------------------
 
 typedef DefaultSeededHashAlgorithm Obj;
+
+#ifdef BSLH_DEFAULTSEEDEDHASHALGORITHM_USE_WYHASH
+typedef WyHashAlgorithm     InternalHashAlgorithm;
+#else
+typedef SpookyHashAlgorithm InternalHashAlgorithm;
+#endif
+    // The algorithm that 'Obj' is expected to use.
+
 const char globalSeed[DefaultSeededHashAlgorithm::k_SEED_LENGTH] = { 0 };
 
 //=============================================================================
@@ -484,7 +492,8 @@ int main(int argc, char *argv[])
                             " the value defined by 'bslh::SpookyHashAlgorithm."
                             " (C-1,2)\n");
         {
-            ASSERT(SpookyHashAlgorithm::k_SEED_LENGTH == Obj::k_SEED_LENGTH);
+            ASSERT(static_cast<int>(InternalHashAlgorithm::k_SEED_LENGTH) ==
+                                        static_cast<int>(Obj::k_SEED_LENGTH));
         }
 
       } break;
@@ -496,7 +505,7 @@ int main(int argc, char *argv[])
         //
         // Concerns:
         //: 1 The typedef 'result_type' is publicly accessible and an alias for
-        //:   'bslh::SpookyHashAlgorithm::result_type'.
+        //:   'InternalHashAlgorithm::result_type'.
         //:
         //: 2 'computeHash()' returns 'result_type'
         //
@@ -518,7 +527,7 @@ int main(int argc, char *argv[])
                             " correct type using 'bslmf::IsSame'. (C-1)\n");
         {
             ASSERT((bslmf::IsSame<Obj::result_type,
-                                  SpookyHashAlgorithm::result_type>::VALUE));
+                                  InternalHashAlgorithm::result_type>::VALUE));
         }
 
         if (verbose) printf("Declare the expected signature of 'computeHash()'"
@@ -610,9 +619,9 @@ int main(int argc, char *argv[])
                                         " and 'bslh::SpookyHashAlgorithm'",
                                         VALUE);
 
-                Obj                 contiguousHash(globalSeed);
-                Obj                 dispirateHash(globalSeed);
-                SpookyHashAlgorithm cannonicalHashAlgorithm(globalSeed);
+                Obj                   contiguousHash(globalSeed);
+                Obj                   dispirateHash(globalSeed);
+                InternalHashAlgorithm cannonicalHashAlgorithm(globalSeed);
 
                 cannonicalHashAlgorithm(VALUE, strlen(VALUE));
                 contiguousHash(VALUE, strlen(VALUE));
@@ -623,7 +632,7 @@ int main(int argc, char *argv[])
                     dispirateHash(&VALUE[j], sizeof(char));
                 }
 
-                SpookyHashAlgorithm::result_type hash =
+                InternalHashAlgorithm::result_type hash =
                                          cannonicalHashAlgorithm.computeHash();
 
                 LOOP_ASSERT(LINE, hash == contiguousHash.computeHash());
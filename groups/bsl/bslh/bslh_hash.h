@@ -11,6 +11,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bslh::Hash: functor that runs 'bslh' hash algorithms on supported types
+//  bslh::IsBitwiseHashable: trait for types hashable as contiguous bytes
 //
 //@SEE_ALSO:
 //
@@ -79,6 +80,35 @@ BSLS_IDENT("$Id: $")
 // representation.  The algorithm will then incorporate the type into its
 // internal state and return a finalized hash when requested.
 //
+///Bitwise-Hashable Types
+///----------------------
+// The 'bslh::IsBitwiseHashable' trait identifies types whose objects compare
+// equal if and only if their object representations (the bytes they occupy in
+// memory) are identical.  An object of such a type can be hashed by passing
+// all of its bytes to the hashing algorithm in a single call, which is the
+// cheapest way to hash a short key with algorithms, such as
+// 'bslh::WyHashAlgorithm', that have a fast path for short input.
+//
+// The trait holds for integral (other than 'bool'), pointer, and enumeration
+// types.  Clients may specialize it for their own types that have no padding
+// bytes and no attributes having several representations of the same value
+// (such as floating-point values, for which '0.0 == -0.0'), for example:
+//..
+//  struct Guid {
+//      unsigned char d_bytes[16];
+//  };
+//
+//  namespace BloombergLP {
+//  namespace bslh {
+//  template <>
+//  struct IsBitwiseHashable<Guid> : bsl::true_type {};
+//  }  // close package namespace
+//  }  // close enterprise namespace
+//..
+// Such a type need not define 'hashAppend': the 'hashAppend' defined in this
+// component for bitwise-hashable types is used, and arrays of bitwise-hashable
+// types are likewise hashed in a single call.
+//
 ///Hashing Algorithms
 ///------------------
 // There are algorithms implemented in the 'bslh' package that can be passed in
@@ -419,6 +449,10 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_enableif.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
 #include <bslmf_isbitwisemoveable.h>
 #endif
@@ -468,6 +502,26 @@ namespace BloombergLP {
 
 namespace bslh {
 
+                      // ==============================
+                      // struct bslh::IsBitwiseHashable
+                      // ==============================
+
+template <class TYPE>
+struct IsBitwiseHashable
+    : bsl::integral_constant<bool, (bsl::is_integral<TYPE>::value
+                                 || bsl::is_pointer<TYPE>::value
+                                 || bsl::is_enum<TYPE>::value)
+                                && !bsl::is_same<TYPE, bool>::value> {
+    // This 'struct' template implements a metafunction to determine whether
+    // objects of the (template parameter) 'TYPE' compare equal if and only if
+    // their object representations are identical, so that they can be hashed
+    // as a contiguous sequence of bytes.  This metafunction derives from
+    // 'bsl::true_type' for integral types other than 'bool', pointer types,
+    // and enumeration types, and from 'bsl::false_type' otherwise.  Clients
+    // may specialize it to derive from 'bsl::true_type' for their own types
+    // (see {Bitwise-Hashable Types}).
+};
+
                           // ================
                           // class bslh::Hash
                           // ================
@@ -512,21 +566,18 @@ struct Hash {
 // FREE FUNCTIONS
 template <class HASH_ALGORITHM, class TYPE>
 inline
-typename bsl::enable_if<
-    (bsl::is_integral<TYPE>::value ||
-     bsl::is_pointer<TYPE>::value  ||
-     bsl::is_enum<TYPE>::value)    &&
-    !bsl::is_same<TYPE, bool>::value
->::type
+typename bsl::enable_if<IsBitwiseHashable<TYPE>::value>::type
 hashAppend(HASH_ALGORITHM& hashAlg, TYPE input)
     // Passes the specified 'input' into the specified 'hashAlg' to be combined
     // into the internal state of the algorithm which is used to produce the
     // resulting hash value. Note that the 'enable_if' meta-function is used to
-    // enable this 'hashAppend' function for only integral (excluding 'bool'),
-    // pointer, and enum types, because these types can all be hashed as a
-    // continuous sequence of bytes. Also note that this function is defined
-    // inline because MS Visual Studio compilers before 2013 require (some)
-    // functions declared using enable_if be in-place inline.
+    // enable this 'hashAppend' function for only bitwise-hashable types
+    // (integral types excluding 'bool', pointer and enum types, and types for
+    // which 'IsBitwiseHashable' has been specialized), because these types
+    // can all be hashed as a continuous sequence of bytes. Also note that this
+    // function is defined inline because MS Visual Studio compilers before
+    // 2013 require (some) functions declared using enable_if be in-place
+    // inline.
 {
     hashAlg(&input, sizeof(input));
 }
@@ -594,10 +645,12 @@ template <class HASH_ALGORITHM, class TYPE, size_t N>
 void hashAppend(HASH_ALGORITHM& hashAlg, TYPE (&input)[N]);
     // Passes the specified 'input' into the specified 'hashAlg' to be combined
     // into the internal state of the algorithm which is used to produce the
-    // resulting hash value. Note that the elements in 'input' will be hashed
-    // one at a time by calling 'hashAppend' because the (template parameter)
-    // 'TYPE' might not be hashable as a contiguous sequence of bytes. Also
-    // note that this 'hashAppend' exists because some platforms don't
+    // resulting hash value. Note that unless 'IsBitwiseHashable<TYPE>' holds,
+    // in which case the entire array will be hashed in only one call to
+    // 'hashAlg', the elements in 'input' will be hashed one at a time by
+    // calling 'hashAppend', because the (template parameter) 'TYPE' might not
+    // be hashable as a contiguous sequence of bytes. Also note that this
+    // 'hashAppend' exists because some platforms don't
     // recognize that adding a const qualifier is a better match for arrays
     // than decaying to a pointer and using the 'hashAppend' function for
     // pointers.
@@ -606,9 +659,11 @@ template <class HASH_ALGORITHM, class TYPE, size_t N>
 void hashAppend(HASH_ALGORITHM& hashAlg, const TYPE (&input)[N]);
     // Passes the specified 'input' into the specified 'hashAlg' to be combined
     // into the internal state of the algorithm which is used to produce the
-    // resulting hash value. Note that the elements in 'input' will be hashed
-    // one at a time by calling 'hashAppend' because the (template parameter)
-    // 'TYPE' might not be hashable as a contiguous sequence of bytes.
+    // resulting hash value. Note that unless 'IsBitwiseHashable<TYPE>' holds,
+    // in which case the entire array will be hashed in only one call to
+    // 'hashAlg', the elements in 'input' will be hashed one at a time by
+    // calling 'hashAppend', because the (template parameter) 'TYPE' might not
+    // be hashable as a contiguous sequence of bytes.
 
 }  // close package namespace
 
@@ -746,7 +801,10 @@ template <class HASH_ALGORITHM, class TYPE, size_t N>
 inline
 void bslh::hashAppend(HASH_ALGORITHM& hashAlg, TYPE (&input)[N])
 {
-
+    if (IsBitwiseHashable<TYPE>::value) {
+        hashAlg(input, sizeof(TYPE) * N);
+        return;                                                       // RETURN
+    }
     for (size_t i = 0; i < N; ++i) {
         hashAppend(hashAlg, input[i]);
     }
@@ -757,6 +815,10 @@ template <class HASH_ALGORITHM, class TYPE, size_t N>
 inline
 void bslh::hashAppend(HASH_ALGORITHM& hashAlg, const TYPE (&input)[N])
 {
+    if (IsBitwiseHashable<TYPE>::value) {
+        hashAlg(input, sizeof(TYPE) * N);
+        return;                                                       // RETURN
+    }
     for (size_t i = 0; i < N; ++i) {
         hashAppend(hashAlg, input[i]);
     }
@@ -4,6 +4,7 @@
 #include <bslh_defaultseededhashalgorithm.h>
 #include <bslh_siphashalgorithm.h>
 #include <bslh_spookyhashalgorithm.h>
+#include <bslh_wyhashalgorithm.h>
 
 #include <bslmf_isbitwisemoveable.h>
 #include <bslmf_issame.h>
@@ -80,11 +81,12 @@ using namespace bslh;
 // [ 3] void hashAppend(HASHALG& hashAlg, RT (*input)(ARGS...));
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 8] USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE
 // [ 6] IsBitwiseMovable trait
 // [ 6] is_trivially_copyable trait
 // [ 6] is_trivially_default_constructible trait
 // [ 7] QoI: Support for empty base optimization
+// [ 8] IsBitwiseHashable trait
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -604,6 +606,50 @@ class MockAccumulatingHashingAlgorithm {
     }
 };
 
+class CallCountingHashingAlgorithm : public MockAccumulatingHashingAlgorithm {
+    // This class implements a mock hashing algorithm that accumulates the
+    // data that is passed into it, and counts the calls to 'operator()'.
+
+    int d_numCalls;  // number of calls to 'operator()'
+
+  public:
+    CallCountingHashingAlgorithm()
+    : d_numCalls(0)
+        // Create a new 'CallCountingHashingAlgorithm'
+    {
+    }
+
+    void operator()(const void *voidPtr, size_t length)
+        // Accumulate the specified 'length' bytes at the specified 'voidPtr'
+        // and count the call.
+    {
+        MockAccumulatingHashingAlgorithm::operator()(voidPtr, length);
+        ++d_numCalls;
+    }
+
+    int numCalls() const
+        // Return the number of calls made to 'operator()'.
+    {
+        return d_numCalls;
+    }
+};
+
+struct TestGuid {
+    // This 'struct' provides a type having no padding, whose values compare
+    // equal if and only if their object representations are identical.
+
+    unsigned char d_bytes[16];
+};
+
+enum TestEnum { e_TEST_ENUM_VALUE };
+
+namespace BloombergLP {
+namespace bslh {
+template <>
+struct IsBitwiseHashable<TestGuid> : bsl::true_type {};
+}  // close package namespace
+}  // close enterprise namespace
+
 template<class TYPE>
 class TestDriver {
     // This class implements a test driver that can run tests on any type.
@@ -829,7 +875,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 8: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   The hashing algorithm can be applied to user defined types which
@@ -883,6 +929,136 @@ int main(int argc, char *argv[])
         ASSERT(!hashTable.contains(Box(Point(0, 0), 0, 0)));
         ASSERT(!hashTable.contains(Box(Point(3, 3), 3, 3)));
 
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING 'IsBitwiseHashable'
+        //   Types for which 'IsBitwiseHashable' holds are hashed as one
+        //   contiguous sequence of bytes.
+        //
+        // Concerns:
+        //: 1 'IsBitwiseHashable' holds for integral types other than 'bool',
+        //:   for pointer types, and for enumeration types, and for no other
+        //:   fundamental types, class types, or arrays.
+        //:
+        //: 2 A class type for which 'IsBitwiseHashable' is specialized can be
+        //:   hashed without defining 'hashAppend', and its bytes are passed
+        //:   to the hashing algorithm in a single call.
+        //:
+        //: 3 An array of a bitwise-hashable type is passed to the hashing
+        //:   algorithm in a single call, and an array of any other type is
+        //:   passed one element at a time, with the same bytes in both cases.
+        //:
+        //: 4 'Hash' applied to a bitwise-hashable type produces the same hash
+        //:   as passing the bytes of the object to the algorithm directly.
+        //
+        // Plan:
+        //: 1 Check the value of the trait for a representative set of types.
+        //:   (C-1)
+        //:
+        //: 2 Hash 'TestGuid', 'int' arrays, and 'double' arrays using an
+        //:   algorithm that counts and accumulates its input, and verify the
+        //:   number of calls and the bytes received.  (C-2,3)
+        //:
+        //: 3 Compare the hash produced by 'Hash<WyHashAlgorithm>' for a
+        //:   'TestGuid' with that of a 'WyHashAlgorithm' given the bytes of
+        //:   the object.  (C-4)
+        //
+        // Testing:
+        //   IsBitwiseHashable trait
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'IsBitwiseHashable'"
+                            "\n===========================\n");
+
+        if (verbose) printf("Check the value of the trait for a"
+                            " representative set of types. (C-1)\n");
+        {
+            ASSERT( IsBitwiseHashable<char>::value);
+            ASSERT( IsBitwiseHashable<unsigned char>::value);
+            ASSERT( IsBitwiseHashable<int>::value);
+            ASSERT( IsBitwiseHashable<unsigned long long>::value);
+            ASSERT( IsBitwiseHashable<wchar_t>::value);
+            ASSERT( IsBitwiseHashable<const char *>::value);
+            ASSERT( IsBitwiseHashable<int (*)()>::value);
+            ASSERT( IsBitwiseHashable<TestEnum>::value);
+            ASSERT( IsBitwiseHashable<TestGuid>::value);
+
+            ASSERT(!IsBitwiseHashable<bool>::value);
+            ASSERT(!IsBitwiseHashable<float>::value);
+            ASSERT(!IsBitwiseHashable<double>::value);
+            ASSERT(!IsBitwiseHashable<long double>::value);
+            ASSERT(!IsBitwiseHashable<X::A>::value);
+            ASSERT(!IsBitwiseHashable<int[4]>::value);
+        }
+
+        if (verbose) printf("Hash 'TestGuid', 'int' arrays, and 'double'"
+                            " arrays using an algorithm that counts and"
+                            " accumulates its input. (C-2,3)\n");
+        {
+            TestGuid guid;
+            for (int i = 0; i < 16; ++i) {
+                guid.d_bytes[i] = static_cast<unsigned char>(i * 17);
+            }
+
+            CallCountingHashingAlgorithm alg;
+            hashAppend(alg, guid);
+            ASSERT(1  == alg.numCalls());
+            ASSERT(16 == alg.getLength());
+            ASSERT(binaryCompare(alg.getData(),
+                                 reinterpret_cast<const char *>(&guid),
+                                 sizeof guid));
+        }
+        {
+            int       ints[4] = { 1, -2, 3, -4 };
+            const int CINTS[4] = { 1, -2, 3, -4 };
+
+            CallCountingHashingAlgorithm alg;
+            hashAppend(alg, ints);
+            ASSERT(1              == alg.numCalls());
+            ASSERT(sizeof ints    == alg.getLength());
+            ASSERT(binaryCompare(alg.getData(),
+                                 reinterpret_cast<const char *>(ints),
+                                 sizeof ints));
+
+            CallCountingHashingAlgorithm calg;
+            hashAppend(calg, CINTS);
+            ASSERT(1              == calg.numCalls());
+            ASSERT(sizeof CINTS   == calg.getLength());
+        }
+        {
+            double doubles[3] = { 1.5, -0.0, 3.25 };
+
+            CallCountingHashingAlgorithm alg;
+            hashAppend(alg, doubles);
+            ASSERT(3               == alg.numCalls());
+            ASSERT(sizeof doubles  == alg.getLength());
+
+            // '-0.0' is normalized to '0.0' element by element.
+
+            const double EXPECTED[3] = { 1.5, 0.0, 3.25 };
+            ASSERT(binaryCompare(alg.getData(),
+                                 reinterpret_cast<const char *>(EXPECTED),
+                                 sizeof EXPECTED));
+        }
+
+        if (verbose) printf("Compare the hash produced by"
+                            " 'Hash<WyHashAlgorithm>' for a 'TestGuid' with"
+                            " that of a 'WyHashAlgorithm' given the bytes of"
+                            " the object. (C-4)\n");
+        {
+            TestGuid guid;
+            for (int i = 0; i < 16; ++i) {
+                guid.d_bytes[i] = static_cast<unsigned char>(255 - i);
+            }
+
+            WyHashAlgorithm alg;
+            alg(guid.d_bytes, sizeof guid.d_bytes);
+
+            ASSERT(static_cast<size_t>(alg.computeHash()) ==
+                                               Hash<WyHashAlgorithm>()(guid));
+        }
+
       } break;
       case 7: {
         // --------------------------------------------------------------------
@@ -0,0 +1,101 @@
+// bslh_wyhashalgorithm.cpp                                           -*-C++-*-
+#include <bslh_wyhashalgorithm.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+///Implementation Notes
+///--------------------
+// The canonical implementation hashes a contiguous range of 'len' bytes as
+// follows: while more than 48 bytes remain, a 48-byte block is consumed by
+// three independent lanes; the lanes are then combined, and while more than
+// 16 bytes remain, a 16-byte chunk is consumed by the first lane; finally, the
+// last 16 bytes of the input (which may overlap bytes already consumed) are
+// mixed with the length.
+//
+// To produce the same hash for input that arrives in pieces, a block is
+// consumed only once at least one byte beyond it is known to exist, so that
+// the final block (of 1 to 48 bytes) is always still in the buffer when
+// 'computeHash' is called.  Because the last 16 bytes of the input may extend
+// back before the final block, the 16 bytes preceding the final block are
+// retained in front of it in 'd_buffer'.
+
+namespace BloombergLP {
+
+namespace bslh {
+
+                          // ---------------------------
+                          // class bslh::WyHashAlgorithm
+                          // ---------------------------
+
+// PRIVATE CLASS DATA
+const WyHashAlgorithm::Uint64 WyHashAlgorithm::k_SECRET_0;
+const WyHashAlgorithm::Uint64 WyHashAlgorithm::k_SECRET_1;
+const WyHashAlgorithm::Uint64 WyHashAlgorithm::k_SECRET_2;
+const WyHashAlgorithm::Uint64 WyHashAlgorithm::k_SECRET_3;
+
+// PRIVATE MANIPULATORS
+void WyHashAlgorithm::processBlock(const unsigned char *block)
+{
+    d_seed = mix(read8(block)      ^ k_SECRET_1, read8(block +  8) ^ d_seed);
+    d_see1 = mix(read8(block + 16) ^ k_SECRET_2, read8(block + 24) ^ d_see1);
+    d_see2 = mix(read8(block + 32) ^ k_SECRET_3, read8(block + 40) ^ d_see2);
+}
+
+void WyHashAlgorithm::processOverflow(const unsigned char *data,
+                                      size_t               numBytes)
+{
+    BSLS_ASSERT(k_BLOCK_SIZE < d_bufferLength + numBytes);
+
+    d_totalLength += numBytes;
+
+    // Complete and consume the pending block, which is now known not to be
+    // the final one.
+
+    unsigned char *pending = d_buffer + k_HISTORY_SIZE;
+    const size_t   fill    = k_BLOCK_SIZE - d_bufferLength;
+
+    memcpy(pending + d_bufferLength, data, fill);
+    processBlock(pending);
+    data     += fill;
+    numBytes -= fill;
+
+    // Consume the blocks of the input, other than the last, in place.
+
+    if (numBytes <= k_BLOCK_SIZE) {
+        memcpy(d_buffer,
+               pending + k_BLOCK_SIZE - k_HISTORY_SIZE,
+               k_HISTORY_SIZE);
+    }
+    else {
+        do {
+            processBlock(data);
+            data     += k_BLOCK_SIZE;
+            numBytes -= k_BLOCK_SIZE;
+        } while (numBytes > k_BLOCK_SIZE);
+        memcpy(d_buffer, data - k_HISTORY_SIZE, k_HISTORY_SIZE);
+    }
+
+    memcpy(pending, data, numBytes);
+    d_bufferLength = numBytes;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2014 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
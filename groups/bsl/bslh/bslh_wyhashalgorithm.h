@@ -0,0 +1,476 @@
+// bslh_wyhashalgorithm.h                                             -*-C++-*-
+#ifndef INCLUDED_BSLH_WYHASHALGORITHM
+#define INCLUDED_BSLH_WYHASHALGORITHM
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an implementation of the wyhash algorithm.
+//
+//@CLASSES:
+//  bslh::WyHashAlgorithm: functor implementing the wyhash algorithm
+//
+//@SEE_ALSO: bslh_hash, bslh_spookyhashalgorithm, bslh_defaulthashalgorithm
+//
+//@DESCRIPTION: 'bslh::WyHashAlgorithm' implements the wyhash algorithm (final
+// version 4.2) by Wang Yi.  This algorithm is a general purpose algorithm
+// built around a single operation -- a 64-bit by 64-bit multiplication whose
+// 128-bit product is folded back into 64 bits -- which quickly reaches good
+// avalanche performance.  It has very little setup and finalization cost,
+// which makes it particularly well suited to the short keys (integers, ticker
+// symbols, GUIDs) that dominate hash tables.  For more information, see:
+// https://github.com/wangyi-fudan/wyhash
+//
+// This class satisfies the requirements for regular 'bslh' hashing algorithms
+// and seeded 'bslh' hashing algorithms, defined in 'bslh_hash.h' and
+// 'bslh_seededhash.h' respectively.  More information can be found in the
+// package level documentation for 'bslh' (internal users can also find
+// information here {TEAM BDE:USING MODULAR HASHING<GO>})
+//
+///Security
+///--------
+// In this context "security" refers to the ability of the algorithm to produce
+// hashes that are not predictable by an attacker.  Security is a concern when
+// an attacker may be able to provide malicious input into a hash table,
+// thereby causing hashes to collide to buckets, which degrades performance.
+// There are *no* security guarantees made by 'bslh::WyHashAlgorithm', meaning
+// attackers may be able to engineer keys that will cause a Denial of Service
+// (DoS) attack in hash tables using this algorithm.  Note that even if an
+// attacker does not know the seed used to initialize this algorithm, they may
+// still be able to produce keys that will cause a DoS attack in hash tables
+// using this algorithm.  If security is required, an algorithm that documents
+// better secure properties should be used, such as 'bslh::SipHashAlgorithm'.
+//
+///Speed
+///-----
+// This algorithm will compute a hash on the order of O(n) where 'n' is the
+// length of the input data.  Input of up to 16 bytes is hashed with two
+// multiplications in total, and longer input is consumed in 48-byte blocks
+// using three independent multiplications per block.  Input passed to
+// 'operator()' is buffered only until a full block is available, and a single
+// call to 'operator()' on a key of constant size, followed by 'computeHash',
+// inlines to essentially the same code as a one-shot hash of that key.  When
+// used through 'bslh::Hash', keys of types for which
+// 'bslh::IsBitwiseHashable' holds are passed to the algorithm in one such
+// call.
+//
+///Hash Distribution
+///-----------------
+// Output hashes will be well distributed and will avalanche, which means
+// changing one bit of the input will change approximately 50% of the output
+// bits.  This will prevent similar values from funneling to the same hash or
+// bucket.
+//
+///Hash Consistency
+///----------------
+// This hash algorithm is endian-specific.  On little-endian machines the
+// hashes produced by a default-constructed object are the same as those
+// produced by the canonical implementation with a seed of 0; on big-endian
+// machines the hashes are equally well distributed, but different.  It is not
+// recommended to send hashes from 'bslh::WyHashAlgorithm' over a network
+// because of the differences in hashes across architectures.  It is also not
+// recommended to write hashes from 'bslh::WyHashAlgorithm' to any memory
+// accessible by multiple machines.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example: Hashing a Security Identifier
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose we identify securities by a 12-character ISIN and an exchange code,
+// and we want to hash such identifiers, for example to key a hash table.
+//
+// First, we define the identifier type:
+//..
+//  struct SecurityId {
+//      // This 'struct' identifies a security listed on an exchange.
+//
+//      // DATA
+//      char d_isin[12];      // ISIN, not null-terminated
+//      int  d_exchangeCode;  // numeric code of the listing exchange
+//  };
+//..
+// Then, we define a functor that passes the attributes of a 'SecurityId' that
+// are salient to hashing into a 'bslh::WyHashAlgorithm', and returns the
+// resulting hash:
+//..
+//  struct HashSecurityId {
+//      // This 'struct' is a functor that applies the 'WyHashAlgorithm' to
+//      // objects of type 'SecurityId'.
+//
+//      size_t operator()(const SecurityId& id) const
+//          // Return the hash of the specified 'id'.
+//      {
+//          bslh::WyHashAlgorithm hash;
+//
+//          hash(id.d_isin,          sizeof id.d_isin);
+//          hash(&id.d_exchangeCode, sizeof id.d_exchangeCode);
+//
+//          return static_cast<size_t>(hash.computeHash());
+//      }
+//  };
+//..
+// Now, we hash some identifiers:
+//..
+//  SecurityId apple  = { { 'U','S','0','3','7','8','3','3','1','0','0','5' },
+//                        7 };
+//  SecurityId apple2 = { { 'U','S','0','3','7','8','3','3','1','0','0','5' },
+//                        11 };
+//
+//  HashSecurityId hasher;
+//..
+// Finally, we verify that equal identifiers hash equally, and that
+// identifiers differing only in their exchange code hash differently:
+//..
+//  SecurityId appleCopy = apple;
+//  assert(hasher(apple) == hasher(appleCopy));
+//  assert(hasher(apple) != hasher(apple2));
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_STDDEF_H
+#include <stddef.h>  // for 'size_t'
+#define INCLUDED_STDDEF_H
+#endif
+
+#ifndef INCLUDED_STRING_H
+#include <string.h>  // for 'memcpy'
+#define INCLUDED_STRING_H
+#endif
+
+namespace BloombergLP {
+
+namespace bslh {
+
+                          // ===========================
+                          // class bslh::WyHashAlgorithm
+                          // ===========================
+
+class WyHashAlgorithm {
+    // This class implements the "wyhash" hash algorithm in an interface that
+    // is usable in the modular hashing system in 'bslh'.  Input is consumed
+    // in blocks of 48 bytes; the final, partial block is buffered, together
+    // with the 16 bytes preceding it, until 'computeHash' is called.
+
+  private:
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+        // Typedef for a 64-bit integer type used in the hashing algorithm.
+
+    enum {
+        k_BLOCK_SIZE   = 48,  // bytes consumed by each round of 3 lanes
+        k_HISTORY_SIZE = 16   // bytes preceding the final block retained
+    };
+
+    // PRIVATE CLASS DATA
+    static const Uint64 k_SECRET_0 = 0x2d358dccaa6c78a5ULL;
+    static const Uint64 k_SECRET_1 = 0x8bb84b93962eacc9ULL;
+    static const Uint64 k_SECRET_2 = 0x4b33a62ed433d4a3ULL;
+    static const Uint64 k_SECRET_3 = 0x4d5a2da51de1aa47ULL;
+        // Default secret of the canonical implementation.
+
+    // DATA
+    Uint64        d_seed;         // state of the first lane
+    Uint64        d_see1;         // state of the second lane
+    Uint64        d_see2;         // state of the third lane
+    Uint64        d_totalLength;  // bytes passed to 'operator()' so far
+    size_t        d_bufferLength; // bytes pending in the final block
+
+    unsigned char d_buffer[k_HISTORY_SIZE + k_BLOCK_SIZE];
+        // Bytes preceding the pending block, followed by the pending block.
+
+    // NOT IMPLEMENTED
+    WyHashAlgorithm(const WyHashAlgorithm& original); // = delete;
+        // Do not allow copy construction.
+
+    WyHashAlgorithm& operator=(const WyHashAlgorithm& rhs); // = delete;
+        // Do not allow assignment.
+
+    // PRIVATE CLASS METHODS
+    static Uint64 mix(Uint64 a, Uint64 b);
+        // Return the exclusive-or of the high and low 64 bits of the 128-bit
+        // product of the specified 'a' and 'b'.
+
+    static void multiply(Uint64 *a, Uint64 *b);
+        // Load into the specified 'a' and 'b' the low and high 64 bits,
+        // respectively, of the 128-bit product of their values.
+
+    static Uint64 read3(const unsigned char *p, size_t numBytes);
+        // Return a 64-bit value combining the first, middle, and last of the
+        // specified 'numBytes' bytes at the specified 'p'.  The behavior is
+        // undefined unless '1 <= numBytes <= 3'.
+
+    static Uint64 read4(const unsigned char *p);
+        // Return the 32-bit value at the specified 'p', which need not be
+        // aligned.
+
+    static Uint64 read8(const unsigned char *p);
+        // Return the 64-bit value at the specified 'p', which need not be
+        // aligned.
+
+    // PRIVATE MANIPULATORS
+    void initialize(Uint64 seed);
+        // Initialize the state of this object for the specified 'seed'.
+
+    void processBlock(const unsigned char *block);
+        // Incorporate the 'k_BLOCK_SIZE' bytes at the specified 'block' into
+        // the lanes of this object.
+
+    void processOverflow(const unsigned char *data, size_t numBytes);
+        // Incorporate the specified 'data', of the specified 'numBytes', into
+        // the state of this object, consuming every block that is followed by
+        // at least one more byte.  The behavior is undefined unless
+        // 'k_BLOCK_SIZE < d_bufferLength + numBytes'.
+
+  public:
+    // TYPES
+    typedef Uint64 result_type;
+        // Typedef indicating the value type returned by this algorithm.
+
+    // CONSTANTS
+    enum { k_SEED_LENGTH = 16 }; // Seed length in bytes.
+
+    // CREATORS
+    WyHashAlgorithm();
+        // Create a 'bslh::WyHashAlgorithm' using a default initial seed.
+
+    explicit WyHashAlgorithm(const char *seed);
+        // Create a 'bslh::WyHashAlgorithm', seeded with a 128-bit
+        // ('k_SEED_LENGTH' bytes) seed pointed to by the specified 'seed'.
+        // Each bit of the supplied seed will contribute to the final hash
+        // produced by 'computeHash()'.  The behaviour is undefined unless
+        // 'seed' points to at least 16 bytes of initialized memory.
+
+    //! ~WyHashAlgorithm() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    void operator()(const void *data, size_t numBytes);
+        // Incorporate the specified 'data', of at least the specified
+        // 'numBytes', into the internal state of the hashing algorithm.  Every
+        // bit of data incorporated into the internal state of the algorithm
+        // will contribute to the final hash produced by 'computeHash()'.  The
+        // same hash value will be produced regardless of whether a sequence of
+        // bytes is passed in all at once or through multiple calls to this
+        // member function.  Input where 'numBytes' is 0 will have no effect on
+        // the internal state of the algorithm.  The behaviour is undefined
+        // unless 'data' points to a valid memory location with at least
+        // 'numBytes' bytes of initialized memory.
+
+    result_type computeHash();
+        // Return the finalized version of the hash that has been accumulated.
+        // Note that calling 'computeHash()' multiple times in a row returns
+        // the same value, but the value returned after incorporating more data
+        // is unspecified.  Also note that a value will be returned, even if
+        // data has not been passed into 'operator()'.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+// PRIVATE CLASS METHODS
+inline
+void WyHashAlgorithm::multiply(Uint64 *a, Uint64 *b)
+{
+#if defined(BSLS_PLATFORM_CPU_64_BIT)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+    __extension__ typedef unsigned __int128 Uint128;
+
+    Uint128 product = static_cast<Uint128>(*a) * *b;
+    *a = static_cast<Uint64>(product);
+    *b = static_cast<Uint64>(product >> 64);
+#else
+    const Uint64 aHigh = *a >> 32;
+    const Uint64 aLow  = *a & 0xffffffffULL;
+    const Uint64 bHigh = *b >> 32;
+    const Uint64 bLow  = *b & 0xffffffffULL;
+
+    const Uint64 high   = aHigh * bHigh;
+    const Uint64 mid0   = aHigh * bLow;
+    const Uint64 mid1   = bHigh * aLow;
+    const Uint64 low    = aLow  * bLow;
+    const Uint64 t      = low + (mid0 << 32);
+    Uint64       carry  = t < low;
+    const Uint64 result = t + (mid1 << 32);
+    carry += result < t;
+
+    *a = result;
+    *b = high + (mid0 >> 32) + (mid1 >> 32) + carry;
+#endif
+}
+
+inline
+WyHashAlgorithm::Uint64 WyHashAlgorithm::mix(Uint64 a, Uint64 b)
+{
+    multiply(&a, &b);
+    return a ^ b;
+}
+
+inline
+WyHashAlgorithm::Uint64
+WyHashAlgorithm::read3(const unsigned char *p, size_t numBytes)
+{
+    return static_cast<Uint64>(p[0]) << 16
+         | static_cast<Uint64>(p[numBytes >> 1]) << 8
+         | p[numBytes - 1];
+}
+
+inline
+WyHashAlgorithm::Uint64 WyHashAlgorithm::read4(const unsigned char *p)
+{
+    unsigned int value;
+    memcpy(&value, p, sizeof value);
+    return value;
+}
+
+inline
+WyHashAlgorithm::Uint64 WyHashAlgorithm::read8(const unsigned char *p)
+{
+    Uint64 value;
+    memcpy(&value, p, sizeof value);
+    return value;
+}
+
+// PRIVATE MANIPULATORS
+inline
+void WyHashAlgorithm::initialize(Uint64 seed)
+{
+    d_seed         = seed ^ mix(seed ^ k_SECRET_0, k_SECRET_1);
+    d_see1         = d_seed;
+    d_see2         = d_seed;
+    d_totalLength  = 0;
+    d_bufferLength = 0;
+}
+
+// CREATORS
+inline
+WyHashAlgorithm::WyHashAlgorithm()
+{
+    initialize(0);
+}
+
+inline
+WyHashAlgorithm::WyHashAlgorithm(const char *seed)
+{
+    BSLS_ASSERT(seed);
+
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(seed);
+
+    initialize(read8(bytes) ^ mix(read8(bytes + 8) ^ k_SECRET_2, k_SECRET_3));
+}
+
+// MANIPULATORS
+inline
+void WyHashAlgorithm::operator()(const void *data, size_t numBytes)
+{
+    BSLS_ASSERT(data);
+
+    if (d_bufferLength + numBytes <= k_BLOCK_SIZE) {
+        memcpy(d_buffer + k_HISTORY_SIZE + d_bufferLength, data, numBytes);
+        d_bufferLength += numBytes;
+        d_totalLength  += numBytes;
+        return;                                                       // RETURN
+    }
+    processOverflow(static_cast<const unsigned char *>(data), numBytes);
+}
+
+inline
+WyHashAlgorithm::result_type WyHashAlgorithm::computeHash()
+{
+    const unsigned char *p      = d_buffer + k_HISTORY_SIZE;
+    size_t               length = d_bufferLength;
+    Uint64               seed   = d_seed;
+    Uint64               a;
+    Uint64               b;
+
+    if (d_totalLength <= 16) {
+        if (length >= 4) {
+            const size_t offset = (length >> 3) << 2;
+
+            a = read4(p) << 32 | read4(p + offset);
+            b = read4(p + length - 4) << 32 | read4(p + length - 4 - offset);
+        }
+        else if (length > 0) {
+            a = read3(p, length);
+            b = 0;
+        }
+        else {
+            a = b = 0;
+        }
+    }
+    else {
+        if (d_totalLength > k_BLOCK_SIZE) {
+            seed ^= d_see1 ^ d_see2;
+        }
+        while (length > 16) {
+            seed = mix(read8(p) ^ k_SECRET_1, read8(p + 8) ^ seed);
+            p      += 16;
+            length -= 16;
+        }
+
+        // The final 16 bytes may start in the retained history.
+
+        a = read8(p + length - 16);
+        b = read8(p + length - 8);
+    }
+
+    a ^= k_SECRET_1;
+    b ^= seed;
+    multiply(&a, &b);
+    return mix(a ^ k_SECRET_0 ^ d_totalLength, b ^ k_SECRET_1);
+}
+
+}  // close package namespace
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslmf {
+template <>
+struct IsBitwiseMoveable<bslh::WyHashAlgorithm>
+    : bsl::true_type {};
+}  // close traits namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2014 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1049 @@
+// bslh_wyhashalgorithm.t.cpp                                         -*-C++-*-
+#include <bslh_wyhashalgorithm.h>
+
+#include <bslh_defaulthashalgorithm.h>
+#include <bslh_hash.h>
+#include <bslh_spookyhashalgorithm.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_issame.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+using namespace bslh;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a 'bslh' hashing algorithm.  The basic test plan
+// is to compare the output of the function call operator with the expected
+// output generated by a known-good implementation of the hashing algorithm,
+// and to verify that input passed in pieces, in particular across the
+// boundaries of the 48-byte blocks in which the algorithm consumes its input,
+// produces the same hash as the same input passed all at once.  The quality
+// of the hashes is measured with an avalanche test and a bucket distribution
+// test.  The component will also be tested for conformance to the
+// requirements on 'bslh' hashing algorithms, outlined in the 'bslh' package
+// level documentation.
+//-----------------------------------------------------------------------------
+// TYPEDEF
+// [ 4] typedef bsls::Types::Uint64 result_type;
+//
+// CONSTANTS
+// [ 5] enum { k_SEED_LENGTH = 16 };
+//
+// CREATORS
+// [ 2] WyHashAlgorithm();
+// [ 2] WyHashAlgorithm(const char *seed);
+// [ 2] ~WyHashAlgorithm();
+//
+// MANIPULATORS
+// [ 3] void operator()(void const* key, size_t len);
+// [ 3] result_type computeHash();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] Trait IsBitwiseMoveable
+// [ 7] HASH QUALITY
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  PRINTF FORMAT MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ZU BSLS_BSLTESTUTIL_FORMAT_ZU
+
+//=============================================================================
+//                             USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example: Hashing a Security Identifier
+/// - - - - - - - - - - - - - - - - - - -
+// Suppose we identify securities by a 12-character ISIN and an exchange code,
+// and we want to hash such identifiers, for example to key a hash table.
+//
+// First, we define the identifier type:
+//..
+    struct SecurityId {
+        // This 'struct' identifies a security listed on an exchange.
+
+        // DATA
+        char d_isin[12];      // ISIN, not null-terminated
+        int  d_exchangeCode;  // numeric code of the listing exchange
+    };
+//..
+// Then, we define a functor that passes the attributes of a 'SecurityId' that
+// are salient to hashing into a 'bslh::WyHashAlgorithm', and returns the
+// resulting hash:
+//..
+    struct HashSecurityId {
+        // This 'struct' is a functor that applies the 'WyHashAlgorithm' to
+        // objects of type 'SecurityId'.
+
+        size_t operator()(const SecurityId& id) const
+            // Return the hash of the specified 'id'.
+        {
+            bslh::WyHashAlgorithm hash;
+
+            hash(id.d_isin,          sizeof id.d_isin);
+            hash(&id.d_exchangeCode, sizeof id.d_exchangeCode);
+
+            return static_cast<size_t>(hash.computeHash());
+        }
+    };
+//..
+
+//=============================================================================
+//                     GLOBAL TYPEDEFS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef WyHashAlgorithm Obj;
+
+static const char genericSeed[Obj::k_SEED_LENGTH + 1] = "0123456789abcdef";
+
+//=============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bsls::Types::Uint64 nextRandom(bsls::Types::Uint64 *state)
+    // Advance the specified 'state' of a pseudo-random sequence and return the
+    // next value of the sequence.
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+static void fillRandom(unsigned char       *data,
+                       size_t               numBytes,
+                       bsls::Types::Uint64 *state)
+    // Load the specified 'numBytes' pseudo-random bytes into the specified
+    // 'data', using the specified 'state' of a pseudo-random sequence.
+{
+    for (size_t i = 0; i < numBytes; ++i) {
+        data[i] = static_cast<unsigned char>(nextRandom(state) >> 56);
+    }
+}
+
+template <class HASH_ALGORITHM>
+static double timeHash(const char *data, size_t numBytes, int iterations)
+    // Return the average time, in nanoseconds, taken to hash the specified
+    // 'numBytes' at the specified 'data' with a default-constructed object of
+    // the (template parameter) 'HASH_ALGORITHM', over the specified
+    // 'iterations'.
+{
+    char buffer[1024];
+    memcpy(buffer, data, numBytes);
+
+    bsls::Types::Uint64 checksum = 0;
+    bsls::Stopwatch     timer;
+
+    timer.start();
+    for (int i = 0; i < iterations; ++i) {
+        buffer[0] = static_cast<char>(i);
+
+        HASH_ALGORITHM hashAlg;
+        hashAlg(buffer, numBytes);
+        checksum += hashAlg.computeHash();
+    }
+    timer.stop();
+
+    if (0 == checksum) {
+        printf("(checksum is 0)\n");
+    }
+    return timer.elapsedTime() * 1e9 / iterations;
+}
+
+template <class HASHER>
+static double timeIntegerKeys(int iterations)
+    // Return the average time, in nanoseconds, taken to hash an 'int' key
+    // with a default-constructed object of the (template parameter)
+    // 'HASHER', over the specified 'iterations'.
+{
+    size_t          checksum = 0;
+    bsls::Stopwatch timer;
+    HASHER          hasher;
+
+    timer.start();
+    for (int i = 0; i < iterations; ++i) {
+        checksum += hasher(i);
+    }
+    timer.stop();
+
+    if (0 == checksum) {
+        printf("(checksum is 0)\n");
+    }
+    return timer.elapsedTime() * 1e9 / iterations;
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+//  bool veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   The hashing algorithm can be used to create more powerful
+        //   components such as functors that can be used to power hash tables.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("USAGE EXAMPLE\n"
+                            "=============\n");
+
+// Now, we hash some identifiers:
+//..
+    SecurityId apple  = { { 'U','S','0','3','7','8','3','3','1','0','0','5' },
+                          7 };
+    SecurityId apple2 = { { 'U','S','0','3','7','8','3','3','1','0','0','5' },
+                          11 };
+
+    HashSecurityId hasher;
+//..
+// Finally, we verify that equal identifiers hash equally, and that
+// identifiers differing only in their exchange code hash differently:
+//..
+    SecurityId appleCopy = apple;
+    ASSERT(hasher(apple) == hasher(appleCopy));
+    ASSERT(hasher(apple) != hasher(apple2));
+//..
+
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // HASH QUALITY
+        //   Verify that the hashes produced by the algorithm avalanche and are
+        //   evenly distributed over buckets, including for short keys.
+        //
+        // Concerns:
+        //: 1 For keys of any length, flipping any one bit of the key flips
+        //:   each bit of the hash with a probability close to 50%.
+        //:
+        //: 2 Consecutive integer keys, which differ in few bits, are evenly
+        //:   distributed over a power-of-two number of buckets, whether the
+        //:   bucket is selected by the low or by the high bits of the hash.
+        //
+        // Plan:
+        //: 1 For a range of key lengths, hash many random keys, and each key
+        //:   with each of its bits flipped in turn.  For each bit of the hash,
+        //:   count how often it differs between the two hashes, and verify
+        //:   that the proportion lies between 40% and 60%.  (C-1)
+        //:
+        //: 2 Hash the integers from 0 to 65535 into 1024 buckets using the
+        //:   low 10 bits, and then the high 10 bits, of the hash, and verify
+        //:   that the chi-squared statistic of the bucket counts lies within
+        //:   about six standard deviations of its expected value.  (C-2)
+        //
+        // Testing:
+        //   HASH QUALITY
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nHASH QUALITY"
+                            "\n============\n");
+
+        if (verbose) printf("Verify that flipping any bit of a key flips each"
+                            " bit of the hash with a probability close to"
+                            " 50%%. (C-1)\n");
+        {
+            static const size_t LENGTHS[] = {
+                1, 2, 3, 4, 7, 8, 12, 16, 17, 24, 32, 48, 49, 64, 100
+            };
+            const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+            enum { k_NUM_KEYS = 100 };
+
+            bsls::Types::Uint64 state = 0x9e3779b97f4a7c15ULL;
+
+            for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+                const size_t LENGTH = LENGTHS[ti];
+
+                unsigned char key[128];
+                int           flips[64] = { 0 };
+                int           numSamples = 0;
+
+                for (int k = 0; k < k_NUM_KEYS; ++k) {
+                    fillRandom(key, LENGTH, &state);
+
+                    Obj original;
+                    original(key, LENGTH);
+                    const bsls::Types::Uint64 HASH = original.computeHash();
+
+                    for (size_t bit = 0; bit < LENGTH * 8; ++bit) {
+                        key[bit / 8] ^= static_cast<unsigned char>(
+                                                              1 << (bit % 8));
+
+                        Obj flipped;
+                        flipped(key, LENGTH);
+                        const bsls::Types::Uint64 DIFF =
+                                                 HASH ^ flipped.computeHash();
+
+                        key[bit / 8] ^= static_cast<unsigned char>(
+                                                              1 << (bit % 8));
+
+                        for (int j = 0; j < 64; ++j) {
+                            flips[j] += static_cast<int>((DIFF >> j) & 1);
+                        }
+                        ++numSamples;
+                    }
+                }
+
+                double worst = 0.5;
+                for (int j = 0; j < 64; ++j) {
+                    const double RATIO = static_cast<double>(flips[j])
+                                                                 / numSamples;
+                    if (RATIO < 0.5 ? RATIO < worst : 1 - RATIO < worst) {
+                        worst = RATIO < 0.5 ? RATIO : 1 - RATIO;
+                    }
+                    LOOP3_ASSERT(LENGTH, j, RATIO, 0.4 < RATIO && RATIO < 0.6);
+                }
+
+                if (veryVerbose) {
+                    printf("length: %2d, worst bit: %.3f\n",
+                           static_cast<int>(LENGTH),
+                           0.5 - worst);
+                }
+            }
+        }
+
+        if (verbose) printf("Verify that consecutive integers are evenly"
+                            " distributed over 1024 buckets. (C-2)\n");
+        {
+            enum { k_NUM_KEYS = 65536, k_NUM_BUCKETS = 1024 };
+
+            static int lowCounts[k_NUM_BUCKETS];
+            static int highCounts[k_NUM_BUCKETS];
+
+            for (int i = 0; i < k_NUM_KEYS; ++i) {
+                Obj hashAlg;
+                hashAlg(&i, sizeof i);
+                const bsls::Types::Uint64 HASH = hashAlg.computeHash();
+
+                ++lowCounts[HASH & (k_NUM_BUCKETS - 1)];
+                ++highCounts[HASH >> 54];
+            }
+
+            const double EXPECTED = k_NUM_KEYS / k_NUM_BUCKETS;
+            double       lowChiSquared  = 0;
+            double       highChiSquared = 0;
+
+            for (int b = 0; b < k_NUM_BUCKETS; ++b) {
+                lowChiSquared  += (lowCounts[b] - EXPECTED)
+                                * (lowCounts[b] - EXPECTED) / EXPECTED;
+                highChiSquared += (highCounts[b] - EXPECTED)
+                                * (highCounts[b] - EXPECTED) / EXPECTED;
+            }
+
+            if (veryVerbose) {
+                P_(lowChiSquared) P(highChiSquared)
+            }
+
+            // The statistic has 1023 degrees of freedom, hence a mean of 1023
+            // and a standard deviation of about 45.
+
+            LOOP_ASSERT(lowChiSquared,  lowChiSquared  < 1300);
+            LOOP_ASSERT(highChiSquared, highChiSquared < 1300);
+        }
+
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING BDE TYPE TRAITS
+        //   The class is bitwise movable and should have a trait that
+        //   indicates that.
+        //
+        // Concerns:
+        //: 1 The class is marked as 'IsBitwiseMoveable'.
+        //
+        // Plan:
+        //: 1 ASSERT the presence of the trait using the 'bslalg::HasTrait'
+        //:   metafunction. (C-1)
+        //
+        // Testing:
+        //   Trait IsBitwiseMoveable
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING BDE TYPE TRAITS"
+                            "\n=======================\n");
+
+        if (verbose) printf("ASSERT the presence of the trait using the"
+                            " 'bslalg::HasTrait' metafunction. (C-1)\n");
+        {
+            ASSERT(bslmf::IsBitwiseMoveable<WyHashAlgorithm>::value);
+        }
+
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'k_SEED_LENGTH'
+        //   The class is a seeded algorithm and should expose a
+        //   'k_SEED_LENGTH' enum.
+        //
+        // Concerns:
+        //: 1 'k_SEED_LENGTH' is publicly accessible.
+        //:
+        //: 2 'k_SEED_LENGTH' is set to 16.
+        //:
+        //: 3 Every bit of the seed contributes to the hash.
+        //
+        // Plan:
+        //: 1 Access 'k_SEED_LENGTH' and ASSERT it is equal to the expected
+        //:   value. (C-1,2)
+        //:
+        //: 2 Hash the same data with seeds differing in one bit from a base
+        //:   seed, and verify that the hashes all differ from the hash
+        //:   produced with the base seed.  (C-3)
+        //
+        // Testing:
+        //   enum { k_SEED_LENGTH = 16 };
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'k_SEED_LENGTH'"
+                            "\n=======================\n");
+
+        if (verbose) printf("Access 'k_SEED_LENGTH' and ASSERT it is equal to"
+                            " the expected value. (C-1,2)\n");
+        {
+            ASSERT(16 == WyHashAlgorithm::k_SEED_LENGTH);
+        }
+
+        if (verbose) printf("Verify that every bit of the seed contributes"
+                            " to the hash. (C-3)\n");
+        {
+            const char *DATA = "Hello World";
+
+            Obj base(genericSeed);
+            base(DATA, strlen(DATA));
+            const bsls::Types::Uint64 BASE_HASH = base.computeHash();
+
+            for (int bit = 0; bit < Obj::k_SEED_LENGTH * 8; ++bit) {
+                char seed[Obj::k_SEED_LENGTH];
+                memcpy(seed, genericSeed, sizeof seed);
+                seed[bit / 8] = static_cast<char>(seed[bit / 8]
+                                                           ^ (1 << (bit % 8)));
+
+                Obj hashAlg(seed);
+                hashAlg(DATA, strlen(DATA));
+                LOOP_ASSERT(bit, BASE_HASH != hashAlg.computeHash());
+            }
+        }
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'result_type' TYPEDEF
+        //   Verify that the class offers the result_type typedef that needs to
+        //   be exposed by all 'bslh' hashing algorithms
+        //
+        // Concerns:
+        //: 1 The typedef 'result_type' is publicly accessible and an alias for
+        //:   'bsls::Types::Uint64'.
+        //:
+        //: 2 'computeHash()' returns 'result_type'
+        //
+        // Plan:
+        //: 1 ASSERT the typedef is accessible and is the correct type using
+        //:   'bslmf::IsSame'. (C-1)
+        //:
+        //: 2 Declare the expected signature of 'computeHash()' and then assign
+        //:   to it.  If it compiles, the test passes. (C-2)
+        //
+        // Testing:
+        //   typedef bsls::Types::Uint64 result_type;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'result_type' TYPEDEF"
+                            "\n=============================\n");
+
+        if (verbose) printf("ASSERT the typedef is accessible and is the"
+                            " correct type using 'bslmf::IsSame'. (C-1)\n");
+        {
+            ASSERT((bslmf::IsSame<bsls::Types::Uint64,
+                                        WyHashAlgorithm::result_type>::VALUE));
+        }
+
+        if (verbose) printf("Declare the expected signature of 'computeHash()'"
+                            " and then assign to it.  If it compiles, the test"
+                            " passes. (C-2)\n");
+        {
+            Obj::result_type (Obj::*expectedSignature) ();
+
+            expectedSignature = &Obj::computeHash;
+            (void) expectedSignature;
+        }
+
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'operator()' AND 'computeHash()'
+        //   Verify the class provides an overload for the function call
+        //   operator that can be called with some bytes and a length.  Verify
+        //   that calling 'operator()' will permute the algorithm's internal
+        //   state as specified by wyhash.  Verify that 'computeHash()' returns
+        //   the final value by wyhash specifications.
+        //
+        // Concerns:
+        //: 1 The function call operator is callable.
+        //:
+        //: 2 Given the same bytes, the function call operator will permute the
+        //:   internal state of the algorithm in the same way, regardless of
+        //:   whether the bytes are passed in all at once or in pieces, and in
+        //:   particular when the pieces straddle the 48-byte blocks in which
+        //:   the input is consumed.
+        //:
+        //: 3 Byte sequences passed in to 'operator()' with a length of 0 will
+        //:   not contribute to the final hash
+        //:
+        //: 4 'computeHash()' exists and returns the appropriate value
+        //:   according to the wyhash specification, for both default and
+        //:   seeded objects.
+        //:
+        //: 5 'computeHash()' does not modify the accumulated state.
+        //:
+        //: 6 'operator()' does a BSLS_ASSERT for null pointers.
+        //
+        // Plan:
+        //: 1 Insert various lengths of c-strings into the algorithm both all
+        //:   at once and char by char using 'operator()'.  Assert that the
+        //:   algorithm produces the same result in both cases. (C-1,2)
+        //:
+        //: 2 For every length from 0 to 300 bytes, hash random data all at
+        //:   once and in pieces of random lengths, and assert that the results
+        //:   are the same.  (C-2)
+        //:
+        //: 3 Hash c-strings all at once and with multiple calls to
+        //:   'operator()' with length 0.  Assert that both methods of hashing
+        //:   c-strings produce the same values.(C-3)
+        //:
+        //: 4 Check the output of 'computeHash()' against the expected results
+        //:   from a known good version of the algorithm.  Call 'computeHash()'
+        //:   twice and verify the results are the same.  (C-4,5)
+        //:
+        //: 5 Call 'operator()' with a null pointer. (C-6)
+        //
+        // Testing:
+        //   void operator()(void const* key, size_t len);
+        //   result_type computeHash();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'operator()' AND 'computeHash()'"
+                            "\n========================================\n");
+
+        static const char DIGITS[] =
+                                  "1234567890123456789012345678901234567890"
+                                  "1234567890123456789012345678901234567890";
+
+        static const struct {
+            int                  d_line;
+            const char          *d_value;
+            bsls::Types::Uint64  d_expectedHash;
+        } DATA[] = {
+        // LINE DATA                              HASH
+         {  L_, "",                     10602188539874428322ULL,},
+         {  L_, "a",                    12460635889546412024ULL,},
+         {  L_, "ab",                   16844179665787915389ULL,},
+         {  L_, "abc",                  10996464419072905673ULL,},
+         {  L_, "abcd",                  7897792245711245547ULL,},
+         {  L_, "message digest",        3502310398120517263ULL,},
+         {  L_, "1234567890123456",        78302340168896960ULL,},
+         {  L_, "12345678901234567",    18192345620073581257ULL,},
+         {  L_, "abcdefghijklmnopqrstuvwxyz",
+                                        14748916874830287222ULL,},
+         {  L_, "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"
+                "0123456789",            2296012339291047689ULL,},
+         {  L_, DIGITS,                  9089066802950309210ULL,},
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        if (verbose) printf("Insert various lengths of c-strings into the"
+                            " algorithm both all at once and char by char"
+                            " using 'operator()'.  Assert that the algorithm"
+                            " produces the same result in both cases. (C-1,2)"
+                            "\n");
+        {
+            for (int i = 0; i != NUM_DATA; ++i) {
+                const int   LINE  = DATA[i].d_line;
+                const char *VALUE = DATA[i].d_value;
+
+                if (veryVerbose) printf("Hashing: %s\n", VALUE);
+
+                Obj contiguousHash;
+                Obj dispirateHash;
+
+                contiguousHash(VALUE, strlen(VALUE));
+                for (unsigned int j = 0; j < strlen(VALUE); ++j){
+                    if (veryVeryVerbose) printf("Hashing by char: %c\n",
+                                                                     VALUE[j]);
+                    dispirateHash(&VALUE[j], sizeof(char));
+                }
+
+                LOOP_ASSERT(LINE, contiguousHash.computeHash() ==
+                                                  dispirateHash.computeHash());
+            }
+        }
+
+        if (verbose) printf("For every length from 0 to 300 bytes, hash"
+                            " random data all at once and in pieces of random"
+                            " lengths. (C-2)\n");
+        {
+            bsls::Types::Uint64 state = 0x0123456789abcdefULL;
+
+            unsigned char data[300];
+            fillRandom(data, sizeof data, &state);
+
+            for (size_t length = 0; length <= sizeof data; ++length) {
+                Obj contiguousHash(genericSeed);
+                contiguousHash(data, length);
+                const bsls::Types::Uint64 EXPECTED =
+                                                  contiguousHash.computeHash();
+
+                for (int trial = 0; trial < 20; ++trial) {
+                    Obj    piecewiseHash(genericSeed);
+                    size_t offset = 0;
+
+                    while (offset < length) {
+                        size_t piece = static_cast<size_t>(
+                                          nextRandom(&state) % (trial * 8 + 1))
+                                     + 1;
+                        if (piece > length - offset) {
+                            piece = length - offset;
+                        }
+                        piecewiseHash(data + offset, piece);
+                        offset += piece;
+                    }
+
+                    LOOP2_ASSERT(length,
+                                 trial,
+                                 EXPECTED == piecewiseHash.computeHash());
+                }
+            }
+        }
+
+        if (verbose) printf("Hash c-strings all at once and with multiple"
+                            " calls to 'operator()' with length 0.  Assert"
+                            " that both methods of hashing c-strings produce"
+                            " the same values.(C-3)\n");
+        {
+            for (int i = 0; i != NUM_DATA; ++i) {
+                const int   LINE  = DATA[i].d_line;
+                const char *VALUE = DATA[i].d_value;
+
+                if (veryVerbose) printf("Hashing: %s\n", VALUE);
+
+                Obj contiguousHash;
+                Obj dispirateHash;
+
+                contiguousHash(VALUE, strlen(VALUE));
+                for (unsigned int j = 0; j < strlen(VALUE); ++j){
+                    if (veryVeryVerbose) printf("Hashing by char: %c\n",
+                                                                     VALUE[j]);
+                    dispirateHash(&VALUE[j], sizeof(char));
+                    dispirateHash(VALUE, 0);
+                }
+
+                LOOP_ASSERT(LINE, contiguousHash.computeHash() ==
+                                                  dispirateHash.computeHash());
+            }
+        }
+
+        if (verbose) printf("Check the output of 'computeHash()' against the"
+                            " expected results from a known good version of"
+                            " the algorithm. (C-4,5)\n");
+        {
+            for (int i = 0; i != NUM_DATA; ++i) {
+                const int                 LINE  = DATA[i].d_line;
+                const char               *VALUE = DATA[i].d_value;
+                const bsls::Types::Uint64 HASH  = DATA[i].d_expectedHash;
+
+                Obj hash;
+                hash(VALUE, strlen(VALUE));
+                bsls::Types::Uint64  hashResult = hash.computeHash();
+
+                if (veryVerbose) printf("Hashing: %s, Expecting: %llu,"
+                                        " Generated: %llu\n",
+                                        VALUE,
+                                        HASH,
+                                        hashResult);
+
+                LOOP_ASSERT(LINE, hashResult == HASH);
+                LOOP_ASSERT(LINE, hashResult == hash.computeHash());
+            }
+
+            static const struct {
+                int                  d_line;
+                const char          *d_value;
+                bsls::Types::Uint64  d_expectedHash;
+            } SEEDED_DATA[] = {
+            // LINE DATA                              HASH
+             {  L_, "",                     17181645520822135029ULL,},
+             {  L_, "a",                     7904023588806243365ULL,},
+             {  L_, DIGITS,                   258677383860557228ULL,},
+            };
+            const int NUM_SEEDED_DATA =
+                                    sizeof SEEDED_DATA / sizeof *SEEDED_DATA;
+
+            for (int i = 0; i != NUM_SEEDED_DATA; ++i) {
+                const int                 LINE  = SEEDED_DATA[i].d_line;
+                const char               *VALUE = SEEDED_DATA[i].d_value;
+                const bsls::Types::Uint64 HASH  =
+                                                SEEDED_DATA[i].d_expectedHash;
+
+                Obj hash(genericSeed);
+                hash(VALUE, strlen(VALUE));
+
+                LOOP_ASSERT(LINE, HASH == hash.computeHash());
+            }
+        }
+
+        if (verbose) printf("Call 'operator()' with null pointers. (C-6)\n");
+        {
+            const char data[5] = {'a', 'b', 'c', 'd', 'e'};
+
+            bsls::AssertFailureHandlerGuard
+                                           g(bsls::AssertTest::failTestDriver);
+
+            ASSERT_FAIL(Obj().operator()(   0, 5));
+            ASSERT_PASS(Obj().operator()(data, 5));
+        }
+
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS
+        //   Ensure that the implicit destructor as well as the explicit
+        //   default and parameterized constructors are publicly callable.
+        //
+        // Concerns:
+        //: 1 Objects can be created using the default constructor.
+        //:
+        //: 2 Objects can be created using the parameterized constructor.
+        //:
+        //: 3 Objects can be destroyed.
+        //:
+        //: 4 The parameterized constructor does a BSLS_ASSERT for null
+        //:   pointers.
+        //:
+        //: 5 Objects created with different seeds produce different hashes.
+        //
+        // Plan:
+        //: 1 Create a default constructed 'bslh::WyHashAlgorithm' and allow it
+        //:   to leave scope to be destroyed. (C-1,3)
+        //:
+        //: 2 Call the parameterized constructor using a seed and allow it to
+        //:   leave scope to be destroyed. (C-2,3)
+        //:
+        //: 3 Call the parameterized constructor with a null pointer. (C-4)
+        //:
+        //: 4 Hash the same data with default and seeded objects and verify
+        //:   that the hashes differ. (C-5)
+        //
+        // Testing:
+        //   WyHashAlgorithm();
+        //   WyHashAlgorithm(const char *seed);
+        //   ~WyHashAlgorithm();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CREATORS"
+                            "\n================\n");
+
+        if (verbose) printf("Create a default constructed"
+                            " 'bslh::WyHashAlgorithm' and allow it to leave"
+                            " scope to be destroyed. (C-1,3)\n");
+        {
+            Obj alg1;
+        }
+
+        if (verbose) printf("Call the parameterized constructor using a seed"
+                            " and allow it to leave scope to be destroyed."
+                            " (C-2,3)\n");
+        {
+            Obj alg1(genericSeed);
+        }
+
+        if (verbose) printf("Call the parameterized constructor with a null"
+                            " pointer. (C-4)\n");
+        {
+            bsls::AssertFailureHandlerGuard
+                                           g(bsls::AssertTest::failTestDriver);
+
+            ASSERT_FAIL(Obj dummy(0));
+            ASSERT_PASS(Obj dummy(genericSeed));
+        }
+
+        if (verbose) printf("Hash the same data with default and seeded"
+                            " objects and verify that the hashes differ."
+                            " (C-5)\n");
+        {
+            const char zeroSeed[Obj::k_SEED_LENGTH] = { 0 };
+
+            Obj alg1;
+            Obj alg2(genericSeed);
+            Obj alg3(zeroSeed);
+
+            alg1("abc", 3);
+            alg2("abc", 3);
+            alg3("abc", 3);
+
+            const bsls::Types::Uint64 HASH1 = alg1.computeHash();
+            const bsls::Types::Uint64 HASH2 = alg2.computeHash();
+            const bsls::Types::Uint64 HASH3 = alg3.computeHash();
+
+            ASSERT(HASH1 != HASH2);
+            ASSERT(HASH1 != HASH3);
+            ASSERT(HASH2 != HASH3);
+        }
+
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an instance of 'bslh::WyHashAlgorithm'. (C-1)
+        //:
+        //: 2 Verify different hashes are produced for different c-strings.
+        //:   (C-1)
+        //:
+        //: 3 Verify the same hashes are produced for the same c-strings. (C-1)
+        //:
+        //: 4 Verify different hashes are produced for different 'int's. (C-1)
+        //:
+        //: 5 Verify the same hashes are produced for the same 'int's. (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        if (verbose) printf("Instantiate 'bslh::WyHashAlgorithm'\n");
+        {
+            WyHashAlgorithm hashAlg;
+        }
+
+        if (verbose) printf("Verify different hashes are produced for"
+                            " different c-strings.\n");
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            const char * str1 = "Hello World";
+            const char * str2 = "Goodbye World";
+            hashAlg1(str1, strlen(str1));
+            hashAlg2(str2, strlen(str2));
+            ASSERT(hashAlg1.computeHash() != hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify the same hashes are produced for the same"
+                            " c-strings.\n");
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            const char * str1 = "Hello World";
+            const char * str2 = "Hello World";
+            hashAlg1(str1, strlen(str1));
+            hashAlg2(str2, strlen(str2));
+            ASSERT(hashAlg1.computeHash() == hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify different hashes are produced for"
+                            " different ints.\n");
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            int int1 = 123456;
+            int int2 = 654321;
+            hashAlg1(&int1, sizeof(int));
+            hashAlg2(&int2, sizeof(int));
+            ASSERT(hashAlg1.computeHash() != hashAlg2.computeHash());
+        }
+
+        if (verbose) printf("Verify the same hashes are produced for the same"
+                            " ints.\n");
+        {
+            WyHashAlgorithm hashAlg1;
+            WyHashAlgorithm hashAlg2;
+            int int1 = 123456;
+            int int2 = 123456;
+            hashAlg1(&int1, sizeof(int));
+            hashAlg2(&int2, sizeof(int));
+            ASSERT(hashAlg1.computeHash() == hashAlg2.computeHash());
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Compare the throughput of the algorithm with that of
+        //   'SpookyHashAlgorithm' across key lengths.
+        //
+        // Concerns:
+        //: 1 'WyHashAlgorithm' is substantially faster than
+        //:   'SpookyHashAlgorithm' for short keys, and not slower for long
+        //:   ones.
+        //
+        // Plan:
+        //: 1 For a range of key lengths, report the average time taken to
+        //:   hash a key with each algorithm.  (C-1)
+        //:
+        //: 2 Report the average time taken by 'bslh::Hash' to hash an 'int'
+        //:   key with each algorithm.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE TEST"
+                            "\n================\n");
+
+        enum { k_ITERATIONS = 2000000 };
+
+        static const size_t LENGTHS[] = {
+            4, 8, 12, 16, 24, 32, 48, 64, 128, 256, 1024
+        };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        char                data[1024];
+        bsls::Types::Uint64 state = 1;
+        fillRandom(reinterpret_cast<unsigned char *>(data),
+                   sizeof data,
+                   &state);
+
+        printf("%6s %10s %10s   (ns per key)\n", "bytes", "wyhash", "spooky");
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const size_t LENGTH = LENGTHS[ti];
+
+            printf("%6d %10.1f %10.1f\n",
+                   static_cast<int>(LENGTH),
+                   timeHash<WyHashAlgorithm>(data, LENGTH, k_ITERATIONS),
+                   timeHash<SpookyHashAlgorithm>(data, LENGTH, k_ITERATIONS));
+        }
+
+        printf("Hash<WyHashAlgorithm>(int):      %6.1f ns\n",
+               timeIntegerKeys<Hash<WyHashAlgorithm> >(k_ITERATIONS));
+        printf("Hash<SpookyHashAlgorithm>(int):  %6.1f ns\n",
+               timeIntegerKeys<Hash<SpookyHashAlgorithm> >(k_ITERATIONS));
+        printf("Hash<DefaultHashAlgorithm>(int): %6.1f ns\n",
+               timeIntegerKeys<Hash<DefaultHashAlgorithm> >(k_ITERATIONS));
+
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2014 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -50,6 +50,20 @@ BSLS_IDENT("$Id$ $CSID$")
 // 'releaseWeakRef').  Note that there is no thread safety guarantees for
 // operations on the managed object.
 //
+///Local Reference Counting
+///-------------------------
+// 'acquireRefLocal' and 'releaseRefLocal' have the same effect on the counts
+// as 'acquireRef' and 'releaseRef', respectively, but update the shared count
+// with plain (relaxed) loads and stores instead of atomic read-modify-write
+// operations, which avoids the cost of a locked instruction (and of the
+// associated cache-line transfer) for each copy and destruction of a shared
+// pointer.  They may be used only while every reference to a representation
+// is held, and released, in a single thread, such as by the shared pointers
+// of an object graph that never leaves the thread that built it (see
+// 'bslstl_localsharedptr').  Before any reference is passed to another
+// thread, its owner must ensure that no further local operations will be
+// applied to the representation.
+//
 ///'disposeObject' and 'disposeRep'
 ///--------------------------------
 // 'disposeObject' is meant to act as the destructor of the managed object and
@@ -381,6 +395,13 @@ class SharedPtrRep {
         // to by this representation.  The behavior is undefined unless
         // '0 < numReferences()'.
 
+    void acquireRefLocal();
+        // Acquire a shared reference to the shared object referred to by this
+        // representation, without atomic read-modify-write operations.  The
+        // behavior is undefined unless '0 < numReferences()', and no other
+        // thread accesses this representation concurrently (see {Local
+        // Reference Counting}).
+
     void acquireWeakRef();
         // Atomically acquire a weak reference to the shared object referred to
         // by this representation.  The behavior is undefined unless
@@ -395,6 +416,16 @@ class SharedPtrRep {
         // are released.  The behavior is undefined unless
         // '0 < numReferences()'.
 
+    void releaseRefLocal();
+        // Release a shared reference to the shared object referred to by this
+        // representation, without atomic read-modify-write operations,
+        // disposing of the shared object if all the shared references to that
+        // object are released, and disposing of this representation if all
+        // (shared and weak) references to that object are released.  The
+        // behavior is undefined unless '0 < numReferences()', and no other
+        // thread accesses this representation concurrently (see {Local
+        // Reference Counting}).
+
     void releaseWeakRef();
         // Atomically release a weak reference to the shared object referred to
         // by this representation, disposing of this representation if all
@@ -474,6 +505,39 @@ void SharedPtrRep::acquireRef()
     d_adjustedSharedCount.addRelaxed(2);        // minimum consistency: relaxed
 }
 
+inline
+void SharedPtrRep::acquireRefLocal()
+{
+    BSLS_ASSERT_SAFE(0 < numReferences());
+
+    d_adjustedSharedCount.storeRelaxed(
+                                   d_adjustedSharedCount.loadRelaxed() + 2);
+                                                // minimum consistency: relaxed
+}
+
+inline
+void SharedPtrRep::releaseRefLocal()
+{
+    BSLS_ASSERT_SAFE(0 < numReferences());
+
+    const int sharedCount = d_adjustedSharedCount.loadRelaxed() - 2;
+    d_adjustedSharedCount.storeRelaxed(sharedCount);
+                                                // minimum consistency: relaxed
+    if (0 == sharedCount) {
+        disposeObject();
+        disposeRep();
+    }
+    else if (1 == sharedCount) {
+        disposeObject();
+
+        const int weakCount = d_adjustedWeakCount.loadRelaxed() - 1;
+        d_adjustedWeakCount.storeRelaxed(weakCount);
+                                                // minimum consistency: relaxed
+        if (0 == weakCount) {
+            disposeRep();
+        }
+    }
+}
 
 inline
 void SharedPtrRep::releaseWeakRef()
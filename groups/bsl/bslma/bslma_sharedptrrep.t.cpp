@@ -42,6 +42,8 @@ using namespace BloombergLP;
 // [ 3] void acquireWeakRef();
 // [ 4] void releaseRef();
 // [ 4] void releaseWeakRef();
+// [10] void acquireRefLocal();
+// [10] void releaseRefLocal();
 // [ 7] bool tryAcquireRef();
 // [ 6] void resetCountsRaw(int numSharedReferences, int numWeakReferences);
 // [ 5] void disposeRep();
@@ -51,7 +53,7 @@ using namespace BloombergLP;
 // [ 2] bool hasUniqueOwner() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [10] USAGE EXAMPLE // TBD
+// [11] USAGE EXAMPLE // TBD
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -422,7 +424,7 @@ int main(int argc, char *argv[])
 
     switch (test) { case 0:  // Zero is always the leading case.
 #if 0  // TBD Need an appropriately levelized usage example
-      case 10: {
+      case 11: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -457,6 +459,81 @@ int main(int argc, char *argv[])
         ASSERT(1 == ta.numDeallocations());
       } break;
 #endif
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING 'acquireRefLocal' AND 'releaseRefLocal'
+        //
+        // Concerns:
+        //   'acquireRefLocal' and 'releaseRefLocal' change the counts exactly
+        //   as 'acquireRef' and 'releaseRef' do, may be mixed with them, and
+        //   dispose of the object and the representation when the last
+        //   shared and weak references are released.
+        //
+        // Plan:
+        //   Acquire and release references using both sets of functions, and
+        //   verify the counts after each call.  Release the last shared
+        //   reference with 'releaseRefLocal', with and without outstanding
+        //   weak references, and verify that the object and representation
+        //   are disposed of as specified.
+        //
+        // Testing:
+        //   void acquireRefLocal();
+        //   void releaseRefLocal();
+        // --------------------------------------------------------------------
+        if (verbose) printf("\nTESTING 'acquireRefLocal' AND 'releaseRefLocal'"
+                            "\n==============================================="
+                            "\n");
+        {
+            TObj t;
+            Obj& x = t;
+            Obj const& X = x;
+
+            x.acquireRefLocal();
+            x.acquireRefLocal();
+            ASSERT(3 == X.numReferences());
+            ASSERT(false == X.hasUniqueOwner());
+
+            x.acquireRef();
+            x.releaseRefLocal();
+            ASSERT(3 == X.numReferences());
+
+            x.releaseRefLocal();
+            x.releaseRef();
+            ASSERT(1 == X.numReferences());
+            ASSERT(true == X.hasUniqueOwner());
+            ASSERT(0 == t.getNumObjectDisposed());
+
+            x.releaseRefLocal();
+            ASSERT(0 == X.numReferences());
+            ASSERT(0 == X.numWeakReferences());
+            ASSERT(1 == t.getNumObjectDisposed());
+            ASSERT(1 == t.getNumRepDisposed());
+        }
+        {
+            TObj t;
+            Obj& x = t;
+            Obj const& X = x;
+
+            x.acquireRefLocal();
+            x.acquireWeakRef();
+            ASSERT(2 == X.numReferences());
+            ASSERT(1 == X.numWeakReferences());
+
+            x.releaseRefLocal();
+            ASSERT(1 == X.numReferences());
+            ASSERT(0 == t.getNumObjectDisposed());
+
+            x.releaseRefLocal();
+            ASSERT(0 == X.numReferences());
+            ASSERT(1 == X.numWeakReferences());
+            ASSERT(1 == t.getNumObjectDisposed());
+            ASSERT(0 == t.getNumRepDisposed());
+
+            x.releaseWeakRef();
+            ASSERT(0 == X.numWeakReferences());
+            ASSERT(1 == t.getNumRepDisposed());
+        }
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // TESTING 'managedPtrDeleter'
@@ -0,0 +1,154 @@
+// bslmf_istransparentpredicate.h                                     -*-C++-*-
+#ifndef INCLUDED_BSLMF_ISTRANSPARENTPREDICATE
+#define INCLUDED_BSLMF_ISTRANSPARENTPREDICATE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Support detection of whether a predicate functor is transparent.
+//
+//@CLASSES:
+//  bslmf::IsTransparentPredicate: meta-function detecting transparent functors
+//
+//@SEE_ALSO: bslstl_map, bslstl_set, bslstl_unorderedmap, bslstl_unorderedset
+//
+//@DESCRIPTION: This component provides a meta-function,
+// 'bslmf::IsTransparentPredicate', that determines whether a (template
+// parameter) functor type, 'COMPARATOR', is *transparent*, i.e., whether
+// 'COMPARATOR' declares a nested type named 'is_transparent'.  The C++14
+// standard uses the presence of 'is_transparent' on a comparator (and, in
+// C++20, on both the hasher and the equality predicate of an unordered
+// container) to enable heterogeneous lookup: overloads of 'find', 'count',
+// 'equal_range', etc. that accept a key of any type that the functor can
+// compare with the container's 'key_type', without first converting it to
+// 'key_type'.
+//
+// 'bslmf::IsTransparentPredicate' takes a second (template parameter) type,
+// 'KEY', that does not affect the result.  Its only purpose is to make the
+// result depend on the template parameter of a member function template, so
+// that the meta-function may be used with 'bsl::enable_if' to remove such a
+// member function template from overload resolution (via SFINAE) when the
+// functor is not transparent.  'bslmf::IsTransparentPredicate' derives from
+// 'bsl::true_type' if 'COMPARATOR::is_transparent' names a type, and from
+// 'bsl::false_type' otherwise.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Enabling a Heterogeneous Lookup Overload
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are implementing a container that is ordered by a comparator,
+// and we want to provide a 'find' overload accepting any key type, but only
+// if the comparator has declared itself transparent.
+//
+// First, we define two comparators, one of which is transparent:
+//..
+//  struct PlainLess {
+//      bool operator()(int lhs, int rhs) const { return lhs < rhs; }
+//  };
+//
+//  struct TransparentLess {
+//      typedef void is_transparent;
+//
+//      template <class LHS, class RHS>
+//      bool operator()(const LHS& lhs, const RHS& rhs) const
+//      {
+//          return lhs < rhs;
+//      }
+//  };
+//..
+// Then, we check the result of the meta-function for each comparator:
+//..
+//  assert(false == (bslmf::IsTransparentPredicate<PlainLess,
+//                                                 long>::value));
+//  assert(true  == (bslmf::IsTransparentPredicate<TransparentLess,
+//                                                 long>::value));
+//..
+// Finally, we sketch how a container would constrain a member function
+// template using the meta-function so that the overload participates in
+// overload resolution only for transparent comparators:
+//..
+//  template <class LOOKUP_KEY>
+//  typename bsl::enable_if<
+//      BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+//                                                 LOOKUP_KEY>::value,
+//      iterator>::type
+//  find(const LOOKUP_KEY& key);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+namespace BloombergLP {
+namespace bslmf {
+
+                   // ======================================
+                   // struct IsTransparentPredicate_VoidType
+                   // ======================================
+
+template <class TYPE>
+struct IsTransparentPredicate_VoidType {
+    // This component-private 'struct' template maps any (template parameter)
+    // 'TYPE' to 'void', so that a partial specialization of
+    // 'IsTransparentPredicate' is selected only if the nested type it
+    // inspects is well-formed.
+
+    typedef void type;
+};
+
+                    // =============================
+                    // struct IsTransparentPredicate
+                    // =============================
+
+template <class COMPARATOR, class KEY, class = void>
+struct IsTransparentPredicate : bsl::false_type {
+    // This 'struct' template implements a meta-function to determine whether
+    // the (template parameter) 'COMPARATOR' is transparent (i.e., declares a
+    // nested type named 'is_transparent').  This generic default template
+    // derives from 'bsl::false_type'.  A partial specialization is provided
+    // (below) that derives from 'bsl::true_type'.  Note that the (template
+    // parameter) 'KEY' does not affect the result, and is provided only to
+    // make the result depend on a deduced template parameter (see
+    // {DESCRIPTION}).
+};
+
+template <class COMPARATOR, class KEY>
+struct IsTransparentPredicate<
+              COMPARATOR,
+              KEY,
+              typename IsTransparentPredicate_VoidType<
+                          typename COMPARATOR::is_transparent>::type>
+    : bsl::true_type {
+    // This partial specialization of 'IsTransparentPredicate' derives from
+    // 'bsl::true_type' for when the (template parameter) 'COMPARATOR' declares
+    // a nested type named 'is_transparent'.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,371 @@
+// bslmf_istransparentpredicate.t.cpp                                 -*-C++-*-
+#include <bslmf_istransparentpredicate.h>
+
+#include <bslmf_enableif.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <stdio.h>   // 'printf'
+#include <stdlib.h>  // 'atoi'
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                TEST PLAN
+//-----------------------------------------------------------------------------
+//                                Overview
+//                                --------
+// The component under test defines a meta-function,
+// 'bslmf::IsTransparentPredicate', that determines whether a (template
+// parameter) functor type declares a nested type named 'is_transparent'.  We
+// need to ensure that the meta-function yields the correct value for functors
+// with and without such a nested type, whatever type 'is_transparent' names,
+// and that it may be used to remove a member function template from overload
+// resolution via 'bsl::enable_if'.
+//
+//-----------------------------------------------------------------------------
+// [ 2] bslmf::IsTransparentPredicate::value
+// [ 2] bslmf::IsTransparentPredicate::type
+// [ 3] CONCERN: usable with 'bsl::enable_if' in a SFINAE context
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+
+//=============================================================================
+//                       STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+void aSsErT(bool b, const char *s, int i)
+{
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+# define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+namespace {
+
+struct Opaque {
+    // This 'struct' is used as a nested 'is_transparent' type that is neither
+    // 'void' nor otherwise special.
+};
+
+struct PlainFunctor {
+    // This functor does not declare 'is_transparent'.
+
+    bool operator()(int lhs, int rhs) const { return lhs < rhs; }
+};
+
+struct VoidTransparentFunctor {
+    // This functor declares 'is_transparent' as an alias for 'void'.
+
+    typedef void is_transparent;
+
+    template <class LHS, class RHS>
+    bool operator()(const LHS& lhs, const RHS& rhs) const { return lhs < rhs; }
+};
+
+struct IntTransparentFunctor {
+    // This functor declares 'is_transparent' as an alias for 'int'.
+
+    typedef int is_transparent;
+};
+
+struct OpaqueTransparentFunctor {
+    // This functor declares 'is_transparent' as an alias for a class type.
+
+    typedef Opaque is_transparent;
+};
+
+struct DerivedTransparentFunctor : VoidTransparentFunctor {
+    // This functor inherits 'is_transparent' from its base class.
+};
+
+struct MemberNamedTransparent {
+    // This functor has a data member, rather than a type, named
+    // 'is_transparent', and so is not transparent.
+
+    int is_transparent;
+};
+
+template <class COMPARATOR>
+struct Lookup {
+    // This 'struct' provides two overloads of 'find', one of which is enabled
+    // only if the (template parameter) 'COMPARATOR' is transparent, modeling
+    // the way containers use 'bslmf::IsTransparentPredicate'.
+
+    int find(const int&) const { return 1; }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+           bslmf::IsTransparentPredicate<COMPARATOR, LOOKUP_KEY>::value,
+           int>::type
+    find(const LOOKUP_KEY&) const { return 2; }
+};
+
+template <class PREDICATE>
+bool isFalseType() { return false; }
+
+template <>
+bool isFalseType<bsl::false_type>() { return true; }
+
+template <class PREDICATE>
+bool isTrueType() { return false; }
+
+template <>
+bool isTrueType<bsl::true_type>() { return true; }
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                               USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+namespace UsageExample {
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Enabling a Heterogeneous Lookup Overload
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we are implementing a container that is ordered by a comparator,
+// and we want to provide a 'find' overload accepting any key type, but only
+// if the comparator has declared itself transparent.
+//
+// First, we define two comparators, one of which is transparent:
+//..
+    struct PlainLess {
+        bool operator()(int lhs, int rhs) const { return lhs < rhs; }
+    };
+
+    struct TransparentLess {
+        typedef void is_transparent;
+
+        template <class LHS, class RHS>
+        bool operator()(const LHS& lhs, const RHS& rhs) const
+        {
+            return lhs < rhs;
+        }
+    };
+//..
+
+}  // close namespace UsageExample
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+
+    (void) veryVerbose;
+
+    setbuf(stdout, 0);  // Use unbuffered output.
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        using namespace UsageExample;
+
+// Then, we check the result of the meta-function for each comparator:
+//..
+    ASSERT(false == (bslmf::IsTransparentPredicate<PlainLess,
+                                                   long>::value));
+    ASSERT(true  == (bslmf::IsTransparentPredicate<TransparentLess,
+                                                   long>::value));
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING USE WITH 'bsl::enable_if'
+        //
+        // Concerns:
+        //: 1 A member function template constrained using
+        //:   'bsl::enable_if<IsTransparentPredicate<C, K>::value, R>' is
+        //:   removed from overload resolution, without a compilation error,
+        //:   if 'C' is not transparent.
+        //:
+        //: 2 Such a member function template is selected for arguments that
+        //:   are not of the non-template overload's parameter type if 'C' is
+        //:   transparent.
+        //
+        // Plan:
+        //: 1 Instantiate 'Lookup', a class providing a non-template and a
+        //:   constrained template overload of 'find', with a transparent and
+        //:   a non-transparent functor, and verify which overload is invoked
+        //:   for arguments of type 'int' and 'long'.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: usable with 'bsl::enable_if' in a SFINAE context
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING USE WITH 'bsl::enable_if'"
+                            "\n=================================\n");
+
+        const Lookup<PlainFunctor>           PLAIN       = {};
+        const Lookup<VoidTransparentFunctor> TRANSPARENT = {};
+
+        ASSERT(1 == PLAIN.find(0));
+        ASSERT(1 == PLAIN.find(0L));
+        ASSERT(1 == TRANSPARENT.find(0));
+        ASSERT(2 == TRANSPARENT.find(0L));
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'bslmf::IsTransparentPredicate::value'
+        //
+        // Concerns:
+        //: 1 The meta-function derives from 'bsl::true_type' for a functor
+        //:   declaring a nested type named 'is_transparent', regardless of
+        //:   what type 'is_transparent' names.
+        //:
+        //: 2 The meta-function detects an 'is_transparent' type inherited from
+        //:   a base class.
+        //:
+        //: 3 The meta-function derives from 'bsl::false_type' for a functor
+        //:   without a nested 'is_transparent' type, including one having a
+        //:   non-type member of that name, and for non-class types.
+        //:
+        //: 4 The (template parameter) 'KEY' does not affect the result.
+        //
+        // Plan:
+        //: 1 Verify 'value' and 'type' of the meta-function for a set of
+        //:   functors covering each concern, using several 'KEY' types.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   bslmf::IsTransparentPredicate::value
+        //   bslmf::IsTransparentPredicate::type
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'bslmf::IsTransparentPredicate::value'"
+                            "\n======================================\n");
+
+        ASSERT( (bslmf::IsTransparentPredicate<VoidTransparentFunctor,
+                                               int>::value));
+        ASSERT( (bslmf::IsTransparentPredicate<VoidTransparentFunctor,
+                                               Opaque>::value));
+        ASSERT( (bslmf::IsTransparentPredicate<IntTransparentFunctor,
+                                               int>::value));
+        ASSERT( (bslmf::IsTransparentPredicate<OpaqueTransparentFunctor,
+                                               const char *>::value));
+        ASSERT( (bslmf::IsTransparentPredicate<DerivedTransparentFunctor,
+                                               int>::value));
+
+        ASSERT(!(bslmf::IsTransparentPredicate<PlainFunctor,
+                                               int>::value));
+        ASSERT(!(bslmf::IsTransparentPredicate<PlainFunctor,
+                                               Opaque>::value));
+        ASSERT(!(bslmf::IsTransparentPredicate<MemberNamedTransparent,
+                                               int>::value));
+        ASSERT(!(bslmf::IsTransparentPredicate<bool (*)(int, int),
+                                               int>::value));
+        ASSERT(!(bslmf::IsTransparentPredicate<int, int>::value));
+
+        typedef bslmf::IsTransparentPredicate<VoidTransparentFunctor, int>
+                                                                    TrueResult;
+        typedef bslmf::IsTransparentPredicate<PlainFunctor, int>
+                                                                   FalseResult;
+
+        ASSERT( isTrueType<TrueResult::type>());
+        ASSERT(isFalseType<FalseResult::type>());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Verify the meta-function for one transparent and one
+        //:   non-transparent functor.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        ASSERT( (bslmf::IsTransparentPredicate<VoidTransparentFunctor,
+                                               int>::value));
+        ASSERT(!(bslmf::IsTransparentPredicate<PlainFunctor, int>::value));
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2015 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
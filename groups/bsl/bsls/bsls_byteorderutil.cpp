@@ -8,6 +8,336 @@ BSLS_IDENT("$Id$ $CSID$")
 #include <bsls_bsltestutil.h>    // for testing only
 #include <bsls_stopwatch.h>      // for testing only
 
+#include <bsls_platform.h>
+
+#include <string.h>
+
+#ifdef BSLS_BYTEORDERUTIL_X86
+#error BSLS_BYTEORDERUTIL_X86 must be a macro scoped locally to this file
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BSLS_BYTEORDERUTIL_X86 1
+#include <immintrin.h>
+#endif
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The vectorized kernels reverse the bytes of each word of a block with a
+// single byte shuffle ('pshufb'), whose control mask depends only on the word
+// width.  SSSE3 and AVX2 are not part of the x86-64 base instruction set, so
+// the kernels are compiled with the 'target' function attribute, which lets
+// them use these instructions without requiring them of the rest of the
+// translation unit, and are called only after 'supportedInstructionSet' has
+// confirmed that the host supports them.
+//
+// Unlike the string search functions in 'bslstl', the instruction set is not
+// cached in an atomic variable, which would raise the level of this
+// component; '__builtin_cpu_supports' merely tests a flag initialized once by
+// the runtime library, and is cheap relative to swapping even a short array.
+//
+// Every kernel loads and stores only complete blocks lying within the
+// sequences, each block being loaded before it is stored (which makes
+// in-place swapping safe), and leaves the remaining (fewer than one block)
+// words to the portable implementation.
+
+namespace BloombergLP {
+namespace bsls {
+
+namespace {
+
+typedef ByteOrderUtil Util;
+
+                        // -----------------------
+                        // portable implementation
+                        // -----------------------
+
+void swapPortable16(unsigned char       *destination,
+                    const unsigned char *source,
+                    std::size_t          numValues)
+    // Load into the specified 'destination' the specified 'numValues' 16-bit
+    // words at the specified 'source', each with its bytes reversed.
+{
+    for (std::size_t i = 0; i < numValues; ++i) {
+        unsigned short value;
+        memcpy(&value, source + i * sizeof value, sizeof value);
+        value = Util::swapBytes16(value);
+        memcpy(destination + i * sizeof value, &value, sizeof value);
+    }
+}
+
+void swapPortable32(unsigned char       *destination,
+                    const unsigned char *source,
+                    std::size_t          numValues)
+    // Load into the specified 'destination' the specified 'numValues' 32-bit
+    // words at the specified 'source', each with its bytes reversed.
+{
+    for (std::size_t i = 0; i < numValues; ++i) {
+        unsigned int value;
+        memcpy(&value, source + i * sizeof value, sizeof value);
+        value = Util::swapBytes32(value);
+        memcpy(destination + i * sizeof value, &value, sizeof value);
+    }
+}
+
+void swapPortable64(unsigned char       *destination,
+                    const unsigned char *source,
+                    std::size_t          numValues)
+    // Load into the specified 'destination' the specified 'numValues' 64-bit
+    // words at the specified 'source', each with its bytes reversed.
+{
+    for (std::size_t i = 0; i < numValues; ++i) {
+        Types::Uint64 value;
+        memcpy(&value, source + i * sizeof value, sizeof value);
+        value = Util::swapBytes64(value);
+        memcpy(destination + i * sizeof value, &value, sizeof value);
+    }
+}
+
+#ifdef BSLS_BYTEORDERUTIL_X86
+
+                        // ------------------
+                        // vectorized kernels
+                        // ------------------
+
+const char k_SHUFFLE_16[16] = {  1,  0,  3,  2,  5,  4,  7,  6,
+                                 9,  8, 11, 10, 13, 12, 15, 14 };
+const char k_SHUFFLE_32[16] = {  3,  2,  1,  0,  7,  6,  5,  4,
+                                11, 10,  9,  8, 15, 14, 13, 12 };
+const char k_SHUFFLE_64[16] = {  7,  6,  5,  4,  3,  2,  1,  0,
+                                15, 14, 13, 12, 11, 10,  9,  8 };
+    // Byte shuffle control masks reversing the bytes of each 16-, 32-, and
+    // 64-bit word, respectively, of a 16-byte block.
+
+__attribute__((target("ssse3")))
+std::size_t swapBlocksSsse3(unsigned char       *destination,
+                            const unsigned char *source,
+                            std::size_t          numBytes,
+                            const char          *shuffle)
+    // Load into the specified 'destination' the complete 16-byte blocks of
+    // the specified 'numBytes' bytes at the specified 'source', permuted by
+    // the specified 'shuffle' control mask, and return the number of bytes
+    // loaded.
+{
+    const __m128i mask = _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(shuffle));
+
+    std::size_t i = 0;
+    for (; i + 32 <= numBytes; i += 32) {
+        const __m128i lo = _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(source + i));
+        const __m128i hi = _mm_loadu_si128(
+                           reinterpret_cast<const __m128i *>(source + i + 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + i),
+                         _mm_shuffle_epi8(lo, mask));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + i + 16),
+                         _mm_shuffle_epi8(hi, mask));
+    }
+    if (i + 16 <= numBytes) {
+        const __m128i block = _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(source + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + i),
+                         _mm_shuffle_epi8(block, mask));
+        i += 16;
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+std::size_t swapBlocksAvx2(unsigned char       *destination,
+                           const unsigned char *source,
+                           std::size_t          numBytes,
+                           const char          *shuffle)
+    // Load into the specified 'destination' the complete 16-byte blocks of
+    // the specified 'numBytes' bytes at the specified 'source', permuted by
+    // the specified 'shuffle' control mask, and return the number of bytes
+    // loaded.
+{
+    const __m128i mask128 = _mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(shuffle));
+    const __m256i mask    = _mm256_broadcastsi128_si256(mask128);
+
+    std::size_t i = 0;
+    for (; i + 64 <= numBytes; i += 64) {
+        const __m256i lo = _mm256_loadu_si256(
+                                reinterpret_cast<const __m256i *>(source + i));
+        const __m256i hi = _mm256_loadu_si256(
+                           reinterpret_cast<const __m256i *>(source + i + 32));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + i),
+                            _mm256_shuffle_epi8(lo, mask));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + i + 32),
+                            _mm256_shuffle_epi8(hi, mask));
+    }
+    if (i + 32 <= numBytes) {
+        const __m256i block = _mm256_loadu_si256(
+                                reinterpret_cast<const __m256i *>(source + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + i),
+                            _mm256_shuffle_epi8(block, mask));
+        i += 32;
+    }
+    if (i + 16 <= numBytes) {
+        const __m128i block = _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(source + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + i),
+                         _mm_shuffle_epi8(block, mask128));
+        i += 16;
+    }
+    return i;
+}
+
+#endif  // BSLS_BYTEORDERUTIL_X86
+
+std::size_t swapBlocks(unsigned char        *destination,
+                       const unsigned char  *source,
+                       std::size_t           numBytes,
+                       const char           *shuffle,
+                       Util::InstructionSet  instructionSet)
+    // Load into the specified 'destination' the complete blocks of the
+    // specified 'numBytes' bytes at the specified 'source', permuted by the
+    // specified 'shuffle' control mask using the specified 'instructionSet',
+    // and return the number of bytes loaded.  Return 0 without loading any
+    // bytes if 'instructionSet' is 'e_PORTABLE'.
+{
+#ifdef BSLS_BYTEORDERUTIL_X86
+    if (Util::e_AVX2 == instructionSet) {
+        return swapBlocksAvx2(destination, source, numBytes, shuffle);
+                                                                      // RETURN
+    }
+    if (Util::e_SSSE3 == instructionSet) {
+        return swapBlocksSsse3(destination, source, numBytes, shuffle);
+                                                                      // RETURN
+    }
+#else
+    (void)destination;
+    (void)source;
+    (void)numBytes;
+    (void)shuffle;
+    (void)instructionSet;
+#endif
+    return 0;
+}
+
+}  // close unnamed namespace
+
+                            // --------------------
+                            // struct ByteOrderUtil
+                            // --------------------
+
+// CLASS METHODS
+void ByteOrderUtil::swapBytesArray16(void        *destination,
+                                     const void  *source,
+                                     std::size_t  numValues)
+{
+    swapBytesArray16(destination,
+                     source,
+                     numValues,
+                     supportedInstructionSet());
+}
+
+void ByteOrderUtil::swapBytesArray16(void           *destination,
+                                     const void     *source,
+                                     std::size_t     numValues,
+                                     InstructionSet  instructionSet)
+{
+#ifdef BSLS_BYTEORDERUTIL_X86
+    const char *shuffle = k_SHUFFLE_16;
+#else
+    const char *shuffle = 0;
+#endif
+
+    unsigned char       *dst = static_cast<unsigned char *>(destination);
+    const unsigned char *src = static_cast<const unsigned char *>(source);
+    const std::size_t    done = swapBlocks(dst,
+                                           src,
+                                           numValues * 2,
+                                           shuffle,
+                                           instructionSet);
+
+    swapPortable16(dst + done, src + done, numValues - done / 2);
+}
+
+void ByteOrderUtil::swapBytesArray32(void        *destination,
+                                     const void  *source,
+                                     std::size_t  numValues)
+{
+    swapBytesArray32(destination,
+                     source,
+                     numValues,
+                     supportedInstructionSet());
+}
+
+void ByteOrderUtil::swapBytesArray32(void           *destination,
+                                     const void     *source,
+                                     std::size_t     numValues,
+                                     InstructionSet  instructionSet)
+{
+#ifdef BSLS_BYTEORDERUTIL_X86
+    const char *shuffle = k_SHUFFLE_32;
+#else
+    const char *shuffle = 0;
+#endif
+
+    unsigned char       *dst = static_cast<unsigned char *>(destination);
+    const unsigned char *src = static_cast<const unsigned char *>(source);
+    const std::size_t    done = swapBlocks(dst,
+                                           src,
+                                           numValues * 4,
+                                           shuffle,
+                                           instructionSet);
+
+    swapPortable32(dst + done, src + done, numValues - done / 4);
+}
+
+void ByteOrderUtil::swapBytesArray64(void        *destination,
+                                     const void  *source,
+                                     std::size_t  numValues)
+{
+    swapBytesArray64(destination,
+                     source,
+                     numValues,
+                     supportedInstructionSet());
+}
+
+void ByteOrderUtil::swapBytesArray64(void           *destination,
+                                     const void     *source,
+                                     std::size_t     numValues,
+                                     InstructionSet  instructionSet)
+{
+#ifdef BSLS_BYTEORDERUTIL_X86
+    const char *shuffle = k_SHUFFLE_64;
+#else
+    const char *shuffle = 0;
+#endif
+
+    unsigned char       *dst = static_cast<unsigned char *>(destination);
+    const unsigned char *src = static_cast<const unsigned char *>(source);
+    const std::size_t    done = swapBlocks(dst,
+                                           src,
+                                           numValues * 8,
+                                           shuffle,
+                                           instructionSet);
+
+    swapPortable64(dst + done, src + done, numValues - done / 8);
+}
+
+ByteOrderUtil::InstructionSet ByteOrderUtil::supportedInstructionSet()
+{
+#ifdef BSLS_BYTEORDERUTIL_X86
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2")  ? e_AVX2
+         : __builtin_cpu_supports("ssse3") ? e_SSSE3
+         :                                   e_PORTABLE;
+#else
+    return e_PORTABLE;
+#endif
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#undef BSLS_BYTEORDERUTIL_X86
+
 // ----------------------------------------------------------------------------
 // Copyright 2014 Bloomberg Finance L.P.
 //
@@ -22,6 +22,16 @@ BSLS_IDENT("$Id: $")
 // swap the bytes of any integral type passed to it, returning the same type it
 // is passed.
 //
+// The functions 'swapBytesArray{16,32,64}' reverse the byte order of each of
+// a sequence of consecutive words having the indicated widths, loading the
+// results into a (possibly identical) destination sequence.  On x86-64
+// platforms built with GCC or Clang, these functions process 16 (SSSE3) or 32
+// (AVX2) bytes per step, selecting the widest instruction set supported by
+// the host processor at run time; elsewhere, they swap one word per step.
+// The overloads taking an explicit 'InstructionSet' allow a test driver or a
+// benchmark to select a narrower instruction set than the one supported by
+// the host.
+//
 ///Usage
 ///-----
 // In this example we demonstrate the use of different overloads of the
@@ -56,11 +66,20 @@ BSLS_IDENT("$Id: $")
 //  bsls::Types::Uint64 ui64 = 0x0102030405060708ULL;
 //  assert(0x0807060504030201ULL == Util::swapBytes(ui64));
 //..
-// Finally, we do a 64-bit signed integer:
+// Then, we do a 64-bit signed integer:
 //..
 //  bsls::Types::Int64 i64 = 0x0a0b0c0d0e0f0102LL;
 //  assert(0x02010f0e0d0c0b0aLL == Util::swapBytes(i64));
 //..
+// Finally, we reverse the bytes of each word of an array of 32-bit words in
+// place:
+//..
+//  unsigned int words[] = { 0x01020304, 0x05060708, 0x090a0b0c };
+//  Util::swapBytesArray32(words, words, 3);
+//  assert(0x04030201 == words[0]);
+//  assert(0x08070605 == words[1]);
+//  assert(0x0c0b0a09 == words[2]);
+//..
 
 #ifndef INCLUDED_BSLS_BYTEORDERUTIL_IMPL
 #include <bsls_byteorderutil_impl.h>
@@ -74,6 +93,8 @@ BSLS_IDENT("$Id: $")
 #include <bsls_types.h>
 #endif
 
+#include <cstddef>           // 'std::size_t'
+
 namespace BloombergLP {
 namespace bsls {
 
@@ -85,6 +106,16 @@ struct ByteOrderUtil {
     // This 'class' provides a namespace for functions used for reversing the
     // byte order of values having integral type.
 
+    // TYPES
+    enum InstructionSet {
+        // Enumerate the instruction sets for which the 'swapBytesArray*'
+        // functions provide an implementation, narrowest first.
+
+        e_PORTABLE,  // one word per step
+        e_SSSE3,     // 16 bytes per step
+        e_AVX2       // 32 bytes per step
+    };
+
     // CLASS METHODS
     static bool           swapBytes(bool           x);
     static char           swapBytes(char           x);
@@ -113,6 +144,59 @@ struct ByteOrderUtil {
     static Types::Uint64  swapBytes64(Types::Uint64  x);
         // Return the value that results from reversing the order of the bytes
         // in the specified 'x'.
+
+    static void swapBytesArray16(void        *destination,
+                                 const void  *source,
+                                 std::size_t  numValues);
+    static void swapBytesArray16(void           *destination,
+                                 const void     *source,
+                                 std::size_t     numValues,
+                                 InstructionSet  instructionSet);
+        // Load into the specified 'destination' the specified 'numValues'
+        // 16-bit words at the specified 'source', each with the order of its
+        // bytes reversed.  Optionally specify the 'instructionSet' to use; if
+        // 'instructionSet' is not specified, the value returned by
+        // 'supportedInstructionSet' is used.  Neither 'destination' nor
+        // 'source' need be aligned.  The behavior is undefined unless the
+        // 'destination' and 'source' sequences are either identical or do not
+        // overlap, and 'instructionSet <= supportedInstructionSet()'.
+
+    static void swapBytesArray32(void        *destination,
+                                 const void  *source,
+                                 std::size_t  numValues);
+    static void swapBytesArray32(void           *destination,
+                                 const void     *source,
+                                 std::size_t     numValues,
+                                 InstructionSet  instructionSet);
+        // Load into the specified 'destination' the specified 'numValues'
+        // 32-bit words at the specified 'source', each with the order of its
+        // bytes reversed.  Optionally specify the 'instructionSet' to use; if
+        // 'instructionSet' is not specified, the value returned by
+        // 'supportedInstructionSet' is used.  Neither 'destination' nor
+        // 'source' need be aligned.  The behavior is undefined unless the
+        // 'destination' and 'source' sequences are either identical or do not
+        // overlap, and 'instructionSet <= supportedInstructionSet()'.
+
+    static void swapBytesArray64(void        *destination,
+                                 const void  *source,
+                                 std::size_t  numValues);
+    static void swapBytesArray64(void           *destination,
+                                 const void     *source,
+                                 std::size_t     numValues,
+                                 InstructionSet  instructionSet);
+        // Load into the specified 'destination' the specified 'numValues'
+        // 64-bit words at the specified 'source', each with the order of its
+        // bytes reversed.  Optionally specify the 'instructionSet' to use; if
+        // 'instructionSet' is not specified, the value returned by
+        // 'supportedInstructionSet' is used.  Neither 'destination' nor
+        // 'source' need be aligned.  The behavior is undefined unless the
+        // 'destination' and 'source' sequences are either identical or do not
+        // overlap, and 'instructionSet <= supportedInstructionSet()'.
+
+    static InstructionSet supportedInstructionSet();
+        // Return the widest instruction set for which the 'swapBytesArray*'
+        // functions provide an implementation and that is supported by the
+        // host processor.
 };
 
 // ============================================================================
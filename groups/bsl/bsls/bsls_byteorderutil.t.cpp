@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <limits>
 
 //=============================================================================
@@ -25,6 +26,12 @@
 //:   whose word width in bits is indicated by the number at the end of the
 //:   function name.
 //
+// In addition, the 'swapBytesArray{16,32,64}' functions swap the bytes of each
+// word of a sequence.  These are tested against 'swapBytes{16,32,64}' for
+// every instruction set supported by the host, for all lengths and alignments
+// around the block sizes of the vectorized implementations, both in place and
+// into a separate destination.
+//
 // The 'swapBytes(TYPE)' methods themselves fall into two categories
 //: o functions that take a single-byte argument, which is returned without
 //:   modification
@@ -42,13 +49,21 @@
 // Single byte values are tested for all possible value in the 'singleByteTest'
 // template function.
 //
-// [5] USAGE EXAMPLE
+// [6] USAGE EXAMPLE
+// [5] TESTING 'swapBytesArray{16,32,64}'
 // [4] TESTING SINGLE BYTE OBJECTS
 // [3] TESTING TYPE MATCHING
 // [2] TESTING 'swapBytes', 'swapBytes{16,32,64}'
 // [1] BREATHING TEST
 //-----------------------------------------------------------------------------
-// [ 5] USAGE
+// [ 6] USAGE
+// [ 5] static void swapBytesArray16(void *, const void *, size_t);
+// [ 5] static void swapBytesArray16(void *, const void *, size_t, ISA);
+// [ 5] static void swapBytesArray32(void *, const void *, size_t);
+// [ 5] static void swapBytesArray32(void *, const void *, size_t, ISA);
+// [ 5] static void swapBytesArray64(void *, const void *, size_t);
+// [ 5] static void swapBytesArray64(void *, const void *, size_t, ISA);
+// [ 5] static InstructionSet supportedInstructionSet();
 // [ 4] static TYPE swapBytes(TYPE) for all single-byte 'TYPE'
 // [ 3] static TYPE swapBytes(TYPE) for all integral 'TYPE'
 // [ 2] static TYPE swapBytes(TYPE) for all multi-byte integral 'TYPE'
@@ -64,6 +79,7 @@
 using namespace BloombergLP;
 using std::printf;
 using std::fprintf;
+using std::memcpy;
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
@@ -366,7 +382,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 5: {
+      case 6: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -419,12 +435,168 @@ int main(int argc, char *argv[])
     bsls::Types::Uint64 ui64 = 0x0102030405060708ULL;
     ASSERT(0x0807060504030201ULL == Util::swapBytes(ui64));
 //..
-// Finally, we do a 64-bit signed integer:
+// Then, we do a 64-bit signed integer:
 //..
     bsls::Types::Int64 i64 = 0x0a0b0c0d0e0f0102LL;
     ASSERT(0x02010f0e0d0c0b0aLL == Util::swapBytes(i64));
+//..
+// Finally, we reverse the bytes of each word of an array of 32-bit words in
+// place:
+//..
+    unsigned int words[] = { 0x01020304, 0x05060708, 0x090a0b0c };
+    Util::swapBytesArray32(words, words, 3);
+    ASSERT(0x04030201 == words[0]);
+    ASSERT(0x08070605 == words[1]);
+    ASSERT(0x0c0b0a09 == words[2]);
 //..
       } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'swapBytesArray{16,32,64}'
+        //
+        // Concerns:
+        //: 1 Each word of the destination is the corresponding word of the
+        //:   source with its bytes reversed.
+        //:
+        //: 2 The functions produce the same result for every instruction set
+        //:   supported by the host, and the overloads without an instruction
+        //:   set use the one returned by 'supportedInstructionSet'.
+        //:
+        //: 3 The functions work for every length, including 0 and lengths
+        //:   that are not multiples of the block sizes of the vectorized
+        //:   implementations, and for unaligned sequences.
+        //:
+        //: 4 The functions work when 'destination' and 'source' are the same.
+        //:
+        //: 5 No byte outside the destination sequence is modified.
+        //
+        // Plan:
+        //: 1 For each instruction set not wider than the one returned by
+        //:   'supportedInstructionSet', each word width, each length from 0
+        //:   to 40 words, and each byte offset from 0 to 7 of the source and
+        //:   the destination, fill a buffer with distinct bytes, swap a
+        //:   sequence into a separate buffer filled with a guard byte, and
+        //:   compare each word with the result of 'swapBytes{16,32,64}' and
+        //:   each byte outside the sequence with the guard byte.  (C-1..3,5)
+        //:
+        //: 2 Repeat P-1 with the destination equal to the source.  (C-4)
+        //
+        // Testing:
+        //   static void swapBytesArray16(void *, const void *, size_t);
+        //   static void swapBytesArray16(void *, const void *, size_t, ISA);
+        //   static void swapBytesArray32(void *, const void *, size_t);
+        //   static void swapBytesArray32(void *, const void *, size_t, ISA);
+        //   static void swapBytesArray64(void *, const void *, size_t);
+        //   static void swapBytesArray64(void *, const void *, size_t, ISA);
+        //   static InstructionSet supportedInstructionSet();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("TESTING 'swapBytesArray{16,32,64}'\n"
+                            "==================================\n");
+
+        const Util::InstructionSet SUPPORTED = Util::supportedInstructionSet();
+
+        if (verbose) { P(SUPPORTED); }
+
+        ASSERT(Util::e_PORTABLE <= SUPPORTED);
+        ASSERT(Util::e_AVX2     >= SUPPORTED);
+
+        enum { k_MAX_WORDS = 40, k_MAX_OFFSET = 8 };
+        enum { k_BUFFER_SIZE = k_MAX_WORDS * 8 + 2 * k_MAX_OFFSET };
+
+        const unsigned char k_GUARD = 0xa5;
+
+        unsigned char source[k_BUFFER_SIZE];
+        unsigned char result[k_BUFFER_SIZE];
+
+        for (int ti = 0; ti <= SUPPORTED + 1; ++ti) {
+            // 'SUPPORTED + 1' denotes the overloads taking no instruction set.
+
+            const bool                 DEFAULT = SUPPORTED + 1 == ti;
+            const Util::InstructionSet ISA     = DEFAULT
+                                               ? SUPPORTED
+                                               : Util::InstructionSet(ti);
+
+            if (veryVerbose) { T_ P_(ISA) P(DEFAULT) }
+
+            for (int width = 2; width <= 8; width *= 2) {
+            for (int length = 0; length <= k_MAX_WORDS; ++length) {
+            for (int srcOffset = 0; srcOffset < k_MAX_OFFSET; ++srcOffset) {
+            for (int dstOffset = 0; dstOffset < k_MAX_OFFSET; ++dstOffset) {
+            for (int inPlace = 0; inPlace < 2; ++inPlace) {
+                if (inPlace && srcOffset != dstOffset) {
+                    continue;
+                }
+
+                for (int i = 0; i < k_BUFFER_SIZE; ++i) {
+                    source[i] = static_cast<unsigned char>(i * 7 + 1);
+                    result[i] = inPlace ? source[i] : k_GUARD;
+                }
+
+                unsigned char       *dst = result + dstOffset;
+                const unsigned char *src = (inPlace ? result : source)
+                                         + srcOffset;
+
+                switch (width) {
+                  case 2: {
+                    if (DEFAULT) Util::swapBytesArray16(dst, src, length);
+                    else         Util::swapBytesArray16(dst, src, length, ISA);
+                  } break;
+                  case 4: {
+                    if (DEFAULT) Util::swapBytesArray32(dst, src, length);
+                    else         Util::swapBytesArray32(dst, src, length, ISA);
+                  } break;
+                  default: {
+                    if (DEFAULT) Util::swapBytesArray64(dst, src, length);
+                    else         Util::swapBytesArray64(dst, src, length, ISA);
+                  } break;
+                }
+
+                const unsigned char *expSrc = source + srcOffset;
+                bool                 match  = true;
+
+                for (int i = 0; i < length; ++i) {
+                    const int pos = i * width;
+
+                    switch (width) {
+                      case 2: {
+                        unsigned short exp, act;
+                        memcpy(&exp, expSrc + pos, sizeof exp);
+                        memcpy(&act, dst    + pos, sizeof act);
+                        match = match && Util::swapBytes16(exp) == act;
+                      } break;
+                      case 4: {
+                        unsigned int exp, act;
+                        memcpy(&exp, expSrc + pos, sizeof exp);
+                        memcpy(&act, dst    + pos, sizeof act);
+                        match = match && Util::swapBytes32(exp) == act;
+                      } break;
+                      default: {
+                        Uint64 exp, act;
+                        memcpy(&exp, expSrc + pos, sizeof exp);
+                        memcpy(&act, dst    + pos, sizeof act);
+                        match = match && Util::swapBytes64(exp) == act;
+                      } break;
+                    }
+                }
+                LOOP6_ASSERT(ti, width, length, srcOffset, dstOffset, inPlace,
+                             match);
+
+                for (int i = 0; i < k_BUFFER_SIZE; ++i) {
+                    if (i >= dstOffset && i < dstOffset + length * width) {
+                        continue;
+                    }
+                    const unsigned char EXP = inPlace ? source[i] : k_GUARD;
+                    LOOP6_ASSERT(ti, width, length, srcOffset, dstOffset, i,
+                                 EXP == result[i]);
+                }
+            }
+            }
+            }
+            }
+            }
+        }
+      } break;
       case 4: {
         // --------------------------------------------------------------------
         // TESTING SINGLE BYTE OBJECTS
@@ -1183,6 +1355,73 @@ int main(int argc, char *argv[])
 
         P(int64Total);
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE OF 'swapBytesArray{16,32,64}'
+        //
+        // Concerns:
+        //   Evaluate the speed of the array swap functions for each supported
+        //   instruction set.
+        //
+        // Plan:
+        //   Repeatedly swap an array of 4096 words, of each width, for each
+        //   instruction set not wider than the one supported by the host, and
+        //   report the time per word.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE OF 'swapBytesArray{16,32,64}'\n"
+                              "=========================================\n");
+
+        enum { k_NUM_BYTES = 4096 * 8, k_ITERATIONS = 20000 };
+
+        static unsigned char buffer[k_NUM_BYTES];
+        for (int i = 0; i < k_NUM_BYTES; ++i) {
+            buffer[i] = static_cast<unsigned char>(i);
+        }
+
+        const char *const NAMES[] = { "portable", "ssse3", "avx2" };
+
+        const Util::InstructionSet SUPPORTED = Util::supportedInstructionSet();
+
+        for (int ti = 0; ti <= SUPPORTED; ++ti) {
+            const Util::InstructionSet ISA = Util::InstructionSet(ti);
+
+            for (int width = 2; width <= 8; width *= 2) {
+                const std::size_t NUM_WORDS = 4096 * 8 / width;
+
+                bsls::Stopwatch sw;
+                sw.start();
+                for (int i = 0; i < k_ITERATIONS; ++i) {
+                    switch (width) {
+                      case 2: {
+                        Util::swapBytesArray16(buffer, buffer, NUM_WORDS, ISA);
+                      } break;
+                      case 4: {
+                        Util::swapBytesArray32(buffer, buffer, NUM_WORDS, ISA);
+                      } break;
+                      default: {
+                        Util::swapBytesArray64(buffer, buffer, NUM_WORDS, ISA);
+                      } break;
+                    }
+                }
+                sw.stop();
+
+                printf("%-8s %2d-bit: %6.3f ns/word\n",
+                       NAMES[ti],
+                       width * 8,
+                       sw.accumulatedWallTime() * 1e9
+                                      / (double(k_ITERATIONS) * NUM_WORDS));
+            }
+        }
+
+        // Observe 'buffer' to prevent the loops from being optimized away.
+
+        unsigned int total = 0;
+        for (int i = 0; i < k_NUM_BYTES; ++i) {
+            total += buffer[i];
+        }
+        P(total);
+      } break;
     }
 
     if (testStatus > 0) {
@@ -0,0 +1,643 @@
+// bslstl_atomicsharedptr.h                                           -*-C++-*-
+#ifndef INCLUDED_BSLSTL_ATOMICSHAREDPTR
+#define INCLUDED_BSLSTL_ATOMICSHAREDPTR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-free atomic holder of a 'shared_ptr'.
+//
+//@CLASSES:
+//  bsl::atomic_shared_ptr: shared pointer supporting lock-free atomic access
+//
+//@SEE_ALSO: bslstl_sharedptr, bsls_atomic
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bsl::atomic_shared_ptr', holding a 'bsl::shared_ptr' that may be loaded,
+// stored, exchanged, and compared-and-exchanged concurrently by multiple
+// threads without locking (but see {Limitations}).  A typical use is to
+// publish a read-mostly snapshot (e.g., configuration or reference data) that
+// many threads read and that is occasionally replaced by a writer: a reader
+// calls 'load' to obtain a 'shared_ptr' to the current snapshot, which
+// remains valid however long the reader holds it, even if the snapshot is
+// replaced in the meantime.
+//
+///Split Reference Counting
+///------------------------
+// Loading a 'shared_ptr' must acquire a reference to the shared object before
+// a concurrent 'store' can release the last reference to it.  An
+// 'atomic_shared_ptr' solves this race with a split reference count: the held
+// 'shared_ptr' is kept in a node allocated (by 'store') from the allocator of
+// the 'atomic_shared_ptr', and the address of that node is packed, together
+// with an "external" count of the loads in progress, in a single 64-bit
+// atomic word.  'load' increments the external count and obtains the address
+// of the node with one atomic addition, copies the 'shared_ptr' held by the
+// node, and then decrements the external count again.  When a node is
+// replaced, the external count of the word swapped out is transferred to an
+// "internal" count in the node, which the loads still in progress decrement
+// instead; the node is deallocated by whichever thread brings the internal
+// count to zero.  No operation ever waits for another thread to make
+// progress, and a thread preempted in the middle of 'load' or 'store' never
+// delays the other threads.
+//
+///Limitations
+///-----------
+// The external count occupies the 16 high-order bits of the word, so at most
+// 65,535 loads of the same 'atomic_shared_ptr' may be in progress at any one
+// time; that is, at most 65,535 threads may access an object concurrently.
+// Exceeding this limit results in undefined behavior.
+//
+// The address of a node must fit in the low 48 bits of the word, which is the
+// case for user-space addresses on all supported 64-bit platforms (and
+// trivially on 32-bit platforms).  This is checked in all build modes.
+//
+///Performance
+///-----------
+// A 'load' performs three atomic read-modify-write operations: two on the
+// word of the 'atomic_shared_ptr', and one (the reference acquired by the
+// copy) on the representation of the shared object.  Compared with loading a
+// 'shared_ptr' under a mutex, readers no longer take a lock and never block
+// behind a preempted writer or reader.  Each 'store' and 'exchange' of a
+// non-empty 'shared_ptr' allocates one node; 'compare_exchange_strong'
+// allocates one only once the comparison has succeeded.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Publishing a Configuration Snapshot
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server reads its configuration on each request, and that the
+// configuration is occasionally replaced by an administrative thread.
+//
+// First, we define the type of the configuration:
+//..
+//  struct Config {
+//      // This 'struct' holds the settings of a server.
+//
+//      int d_timeoutMs;   // request timeout in milliseconds
+//      int d_maxRetries;  // maximum number of retries per request
+//  };
+//..
+// Then, we publish an initial snapshot:
+//..
+//  bslma::TestAllocator allocator;
+//
+//  bsl::shared_ptr<Config> initial;
+//  initial.createInplace(&allocator);
+//  initial->d_timeoutMs  = 100;
+//  initial->d_maxRetries = 3;
+//
+//  bsl::atomic_shared_ptr<Config> current(initial, &allocator);
+//  initial.reset();
+//..
+// Next, a request handler, possibly running in many threads at once, loads
+// the current snapshot without taking a lock, and uses it for the duration of
+// the request:
+//..
+//  bsl::shared_ptr<Config> config = current.load();
+//  assert(100 == config->d_timeoutMs);
+//..
+// Then, the administrative thread publishes a new snapshot, leaving the
+// request in progress with a consistent view of the old one:
+//..
+//  bsl::shared_ptr<Config> updated;
+//  updated.createInplace(&allocator);
+//  updated->d_timeoutMs  = 250;
+//  updated->d_maxRetries = 5;
+//
+//  current.store(updated);
+//
+//  assert(100 == config->d_timeoutMs);
+//  assert(250 == current.load()->d_timeoutMs);
+//..
+// Finally, a writer that derives the new snapshot from the current one uses
+// 'compare_exchange_strong' so as not to overwrite a concurrent update:
+//..
+//  bsl::shared_ptr<Config> expected = current.load();
+//  bsl::shared_ptr<Config> next;
+//  do {
+//      next.createInplace(&allocator, *expected);
+//      next->d_maxRetries += 1;
+//  } while (!current.compare_exchange_strong(&expected, next));
+//
+//  assert(6 == current.load()->d_maxRetries);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_SHAREDPTR
+#include <bslstl_sharedptr.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                        // ===========================
+                        // struct AtomicSharedPtr_Node
+                        // ===========================
+
+template <class ELEMENT_TYPE>
+struct AtomicSharedPtr_Node {
+    // This component-private 'struct' provides the node holding the
+    // 'shared_ptr' published by an 'atomic_shared_ptr', together with the
+    // internal count of the loads that were in progress when the node was
+    // replaced.
+
+    // DATA
+    const bsl::shared_ptr<ELEMENT_TYPE> d_value;          // published value
+
+    bsls::AtomicInt                     d_internalCount;  // external count
+                                                          // transferred,
+                                                          // minus loads
+                                                          // completed, after
+                                                          // replacement
+
+    // CREATORS
+    explicit AtomicSharedPtr_Node(const bsl::shared_ptr<ELEMENT_TYPE>& value);
+        // Create a node holding the specified 'value', with an internal count
+        // of 0.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                          // =======================
+                          // class atomic_shared_ptr
+                          // =======================
+
+template <class ELEMENT_TYPE>
+class atomic_shared_ptr {
+    // This class holds a 'shared_ptr<ELEMENT_TYPE>' that may be accessed
+    // concurrently, without locking, by 'load', 'store', 'exchange', and
+    // 'compare_exchange_strong' (see {Split Reference Counting}).
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::AtomicSharedPtr_Node<ELEMENT_TYPE> Node;
+    typedef BloombergLP::bsls::Types::Int64                         Word;
+
+    enum { k_COUNT_SHIFT = 48 };  // position of the external count in a word
+
+    // DATA
+    mutable BloombergLP::bsls::AtomicInt64  d_word;         // address of the
+                                                            // current node (or
+                                                            // 0), and external
+                                                            // count
+
+    BloombergLP::bslma::Allocator          *d_allocator_p;  // allocator of
+                                                            // nodes (held, not
+                                                            // owned)
+
+    // PRIVATE CLASS METHODS
+    static int externalCount(Word word);
+        // Return the external count held in the specified 'word', in the
+        // range '[0 .. 65535]'.
+
+    static Node *node(Word word);
+        // Return the address of the node held in the specified 'word'.
+
+    // PRIVATE MANIPULATORS
+    Word makeWord(const shared_ptr<ELEMENT_TYPE>& value);
+        // Return a word holding the address of a newly allocated node holding
+        // the specified 'value', and an external count of 0, or 0 if 'value'
+        // is empty and refers to no object.
+
+    void releaseNode(Node *node) const;
+        // Decrement the count of loads in progress on the specified 'node',
+        // deallocating 'node' if it has been replaced and no load is in
+        // progress.  The behavior is undefined unless a load of 'node' by the
+        // calling thread is in progress.
+
+    void retireNode(Word word, int numOwnLoads);
+        // Transfer the external count of the specified 'word', swapped out of
+        // this object, to the internal count of its node (if any), net of the
+        // specified 'numOwnLoads' loads of that node in progress by the
+        // calling thread, deallocating the node if no load by another thread
+        // is in progress.
+
+    // PRIVATE ACCESSORS
+    Node *acquireNode() const;
+        // Return the address of the current node, having incremented the
+        // count of loads in progress on that node, or 0 if this object holds
+        // an empty 'shared_ptr'.
+
+    void deleteNode(Node *node) const;
+        // Destroy the specified 'node' and deallocate its memory.
+
+    // NOT IMPLEMENTED
+    atomic_shared_ptr(const atomic_shared_ptr&);
+    atomic_shared_ptr& operator=(const atomic_shared_ptr&);
+
+  public:
+    // TYPES
+    typedef shared_ptr<ELEMENT_TYPE> value_type;
+        // 'value_type' is an alias for the type of the 'shared_ptr' held by
+        // this object.
+
+    // CREATORS
+    explicit atomic_shared_ptr(
+                          BloombergLP::bslma::Allocator *basicAllocator = 0);
+        // Create an object holding an empty 'shared_ptr'.  Optionally specify
+        // a 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.
+
+    explicit atomic_shared_ptr(
+                      const shared_ptr<ELEMENT_TYPE>&  value,
+                      BloombergLP::bslma::Allocator   *basicAllocator = 0);
+        // Create an object holding a copy of the specified 'value'.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    ~atomic_shared_ptr();
+        // Destroy this object, releasing the reference held to the shared
+        // object (if any).  The behavior is undefined unless no other thread
+        // accesses this object concurrently.
+
+    // MANIPULATORS
+    void store(const shared_ptr<ELEMENT_TYPE>& value);
+        // Atomically replace the 'shared_ptr' held by this object with a copy
+        // of the specified 'value', and release the reference held to the
+        // previously held object (if any).
+
+    shared_ptr<ELEMENT_TYPE> exchange(const shared_ptr<ELEMENT_TYPE>& value);
+        // Atomically replace the 'shared_ptr' held by this object with a copy
+        // of the specified 'value', and return the previously held
+        // 'shared_ptr'.
+
+    bool compare_exchange_strong(shared_ptr<ELEMENT_TYPE>        *expected,
+                                 const shared_ptr<ELEMENT_TYPE>&  desired);
+        // Atomically replace the 'shared_ptr' held by this object with a copy
+        // of the specified 'desired' if the held 'shared_ptr' is equivalent
+        // to the one at the specified 'expected' address, i.e., refers to the
+        // same object and shares ownership with it, and load the held
+        // 'shared_ptr' into '*expected' otherwise.  Return 'true' if the
+        // replacement took place, and 'false' otherwise.
+
+    bool compare_exchange_weak(shared_ptr<ELEMENT_TYPE>        *expected,
+                               const shared_ptr<ELEMENT_TYPE>&  desired);
+        // Atomically replace the 'shared_ptr' held by this object with a copy
+        // of the specified 'desired' if the held 'shared_ptr' is equivalent
+        // to the one at the specified 'expected' address, and load the held
+        // 'shared_ptr' into '*expected' otherwise.  Return 'true' if the
+        // replacement took place, and 'false' otherwise.  Note that this
+        // implementation never fails spuriously, and is equivalent to
+        // 'compare_exchange_strong'.
+
+    // ACCESSORS
+    shared_ptr<ELEMENT_TYPE> load() const;
+        // Atomically return a copy of the 'shared_ptr' held by this object.
+
+    bool is_lock_free() const;
+        // Return 'true'.  Note that no operation on this object blocks, though
+        // 'store', 'exchange', and 'compare_exchange_strong' allocate memory.
+
+    BloombergLP::bslma::Allocator *allocator() const;
+        // Return the address of the allocator used by this object to supply
+        // memory.
+};
+
+}  // close namespace bsl
+
+// ============================================================================
+//                       INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+namespace BloombergLP {
+namespace bslstl {
+
+                        // ---------------------------
+                        // struct AtomicSharedPtr_Node
+                        // ---------------------------
+
+// CREATORS
+template <class ELEMENT_TYPE>
+inline
+AtomicSharedPtr_Node<ELEMENT_TYPE>::AtomicSharedPtr_Node(
+                                    const bsl::shared_ptr<ELEMENT_TYPE>& value)
+: d_value(value)
+, d_internalCount(0)
+{
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                          // -----------------------
+                          // class atomic_shared_ptr
+                          // -----------------------
+
+// PRIVATE CLASS METHODS
+template <class ELEMENT_TYPE>
+inline
+int atomic_shared_ptr<ELEMENT_TYPE>::externalCount(Word word)
+{
+    typedef BloombergLP::bsls::Types::Uint64 Uint64;
+
+    return static_cast<int>(static_cast<Uint64>(word) >> k_COUNT_SHIFT);
+}
+
+template <class ELEMENT_TYPE>
+inline
+typename atomic_shared_ptr<ELEMENT_TYPE>::Node *
+atomic_shared_ptr<ELEMENT_TYPE>::node(Word word)
+{
+    const Word mask = (static_cast<Word>(1) << k_COUNT_SHIFT) - 1;
+
+    typedef BloombergLP::bsls::Types::UintPtr UintPtr;
+
+    return reinterpret_cast<Node *>(static_cast<UintPtr>(word & mask));
+}
+
+// PRIVATE MANIPULATORS
+template <class ELEMENT_TYPE>
+typename atomic_shared_ptr<ELEMENT_TYPE>::Word
+atomic_shared_ptr<ELEMENT_TYPE>::makeWord(
+                                       const shared_ptr<ELEMENT_TYPE>& value)
+{
+    if (!value.rep() && !value.get()) {
+        return 0;                                                     // RETURN
+    }
+
+    typedef BloombergLP::bsls::Types::UintPtr UintPtr;
+
+    Node *node = new (*d_allocator_p) Node(value);
+    const Word word = static_cast<Word>(reinterpret_cast<UintPtr>(node));
+
+    BSLS_ASSERT_OPT(0 == (word >> k_COUNT_SHIFT));
+
+    return word;
+}
+
+template <class ELEMENT_TYPE>
+void atomic_shared_ptr<ELEMENT_TYPE>::releaseNode(Node *node) const
+{
+    const Word one = static_cast<Word>(1) << k_COUNT_SHIFT;
+
+    // As the load of the calling thread is not complete, 'node' cannot have
+    // been deallocated, and so its address cannot have been reused by another
+    // node: if 'd_word' still refers to 'node', it has not been replaced.
+
+    Word word = d_word.loadRelaxed();
+    while (this->node(word) == node) {
+        const Word previous = d_word.testAndSwapAcqRel(word, word - one);
+        if (previous == word) {
+            return;                                                   // RETURN
+        }
+        word = previous;
+    }
+
+    // 'node' was replaced, and the external count transferred to it.
+
+    if (0 == node->d_internalCount.addAcqRel(-1)) {
+        deleteNode(node);
+    }
+}
+
+template <class ELEMENT_TYPE>
+void atomic_shared_ptr<ELEMENT_TYPE>::retireNode(Word word, int numOwnLoads)
+{
+    Node *node = this->node(word);
+    if (!node) {
+        return;                                                       // RETURN
+    }
+
+    // The internal count is negative if loads have completed since the
+    // replacement; it reaches 0 exactly once, when the last load completes.
+
+    if (0 == node->d_internalCount.addAcqRel(externalCount(word)
+                                                             - numOwnLoads)) {
+        deleteNode(node);
+    }
+}
+
+// PRIVATE ACCESSORS
+template <class ELEMENT_TYPE>
+typename atomic_shared_ptr<ELEMENT_TYPE>::Node *
+atomic_shared_ptr<ELEMENT_TYPE>::acquireNode() const
+{
+    const Word one = static_cast<Word>(1) << k_COUNT_SHIFT;
+
+    if (!node(d_word.loadAcquire())) {
+        return 0;                                                     // RETURN
+    }
+
+    // If an empty 'shared_ptr' was stored in the meantime, the increment is
+    // discarded with the word by the next replacement.
+
+    const Word word = d_word.addAcqRel(one);
+
+    BSLS_ASSERT(0 != externalCount(word));
+
+    return node(word);
+}
+
+template <class ELEMENT_TYPE>
+inline
+void atomic_shared_ptr<ELEMENT_TYPE>::deleteNode(Node *node) const
+{
+    d_allocator_p->deleteObjectRaw(node);
+}
+
+// CREATORS
+template <class ELEMENT_TYPE>
+inline
+atomic_shared_ptr<ELEMENT_TYPE>::atomic_shared_ptr(
+                                 BloombergLP::bslma::Allocator *basicAllocator)
+: d_word(0)
+, d_allocator_p(BloombergLP::bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class ELEMENT_TYPE>
+inline
+atomic_shared_ptr<ELEMENT_TYPE>::atomic_shared_ptr(
+                          const shared_ptr<ELEMENT_TYPE>&  value,
+                          BloombergLP::bslma::Allocator   *basicAllocator)
+: d_word(0)
+, d_allocator_p(BloombergLP::bslma::Default::allocator(basicAllocator))
+{
+    d_word.storeRelaxed(makeWord(value));
+}
+
+template <class ELEMENT_TYPE>
+inline
+atomic_shared_ptr<ELEMENT_TYPE>::~atomic_shared_ptr()
+{
+    retireNode(d_word.loadAcquire(), 0);
+}
+
+// MANIPULATORS
+template <class ELEMENT_TYPE>
+inline
+void atomic_shared_ptr<ELEMENT_TYPE>::store(
+                                       const shared_ptr<ELEMENT_TYPE>& value)
+{
+    retireNode(d_word.swapAcqRel(makeWord(value)), 0);
+}
+
+template <class ELEMENT_TYPE>
+shared_ptr<ELEMENT_TYPE>
+atomic_shared_ptr<ELEMENT_TYPE>::exchange(
+                                       const shared_ptr<ELEMENT_TYPE>& value)
+{
+    const Word word = d_word.swapAcqRel(makeWord(value));
+
+    shared_ptr<ELEMENT_TYPE> result;
+    if (Node *node = this->node(word)) {
+        result = node->d_value;
+        retireNode(word, 0);
+    }
+    return result;
+}
+
+template <class ELEMENT_TYPE>
+bool atomic_shared_ptr<ELEMENT_TYPE>::compare_exchange_strong(
+                                 shared_ptr<ELEMENT_TYPE>        *expected,
+                                 const shared_ptr<ELEMENT_TYPE>&  desired)
+{
+    BSLS_ASSERT_SAFE(expected);
+
+    // The node holding 'desired' is allocated only once the comparison has
+    // succeeded, so that a failed comparison does not allocate.
+
+    Word newWord    = 0;
+    bool hasNewWord = !desired.rep() && !desired.get();
+
+    while (true) {
+        Node *node = acquireNode();
+
+        const bool isEqual = node
+                           ? node->d_value.get() == expected->get()
+                          && node->d_value.rep() == expected->rep()
+                           : !expected->get() && !expected->rep();
+
+        if (!isEqual) {
+            if (node) {
+                *expected = node->d_value;
+                releaseNode(node);
+            }
+            else {
+                expected->reset();
+            }
+            if (newWord) {
+                deleteNode(this->node(newWord));
+            }
+            return false;                                             // RETURN
+        }
+
+        if (!hasNewWord) {
+            // Allocate the node without a load in progress (should the
+            // allocation throw), and compare again.
+
+            if (node) {
+                releaseNode(node);
+            }
+            newWord    = makeWord(desired);
+            hasNewWord = true;
+            continue;
+        }
+
+        Word word = d_word.loadRelaxed();
+        while (this->node(word) == node) {
+            const Word previous = d_word.testAndSwapAcqRel(word, newWord);
+            if (previous == word) {
+                retireNode(word, node ? 1 : 0);
+                return true;                                          // RETURN
+            }
+            word = previous;
+        }
+
+        // The node was replaced after it was compared: compare again.
+
+        if (node) {
+            releaseNode(node);
+        }
+    }
+}
+
+template <class ELEMENT_TYPE>
+inline
+bool atomic_shared_ptr<ELEMENT_TYPE>::compare_exchange_weak(
+                                 shared_ptr<ELEMENT_TYPE>        *expected,
+                                 const shared_ptr<ELEMENT_TYPE>&  desired)
+{
+    return compare_exchange_strong(expected, desired);
+}
+
+// ACCESSORS
+template <class ELEMENT_TYPE>
+shared_ptr<ELEMENT_TYPE> atomic_shared_ptr<ELEMENT_TYPE>::load() const
+{
+    Node *node = acquireNode();
+    if (!node) {
+        return shared_ptr<ELEMENT_TYPE>();                            // RETURN
+    }
+
+    shared_ptr<ELEMENT_TYPE> result(node->d_value);
+    releaseNode(node);
+    return result;
+}
+
+template <class ELEMENT_TYPE>
+inline
+bool atomic_shared_ptr<ELEMENT_TYPE>::is_lock_free() const
+{
+    return true;
+}
+
+template <class ELEMENT_TYPE>
+inline
+BloombergLP::bslma::Allocator *
+atomic_shared_ptr<ELEMENT_TYPE>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close namespace bsl
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,875 @@
+// bslstl_atomicsharedptr.t.cpp                                       -*-C++-*-
+#include <bslstl_atomicsharedptr.h>
+
+#include <bslstl_sharedptr.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test holds a 'shared_ptr' that may be accessed
+// concurrently without locking.  The single-threaded behavior of each
+// operation is verified against the reference counts of the stored
+// 'shared_ptr' objects and the number of live shared objects, and the nodes
+// are verified to be supplied by the allocator of the object and to be
+// deallocated when replaced.  The concurrent behavior is verified by threads
+// loading snapshots while another thread replaces them, verifying that every
+// snapshot loaded is intact and that no snapshot is leaked, and by threads
+// incrementing a shared counter with 'compare_exchange_strong', verifying that
+// no increment is lost.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit atomic_shared_ptr(Allocator *basicAllocator = 0);
+// [ 2] atomic_shared_ptr(const shared_ptr<E>& value, Allocator *a = 0);
+// [ 2] ~atomic_shared_ptr();
+//
+// MANIPULATORS
+// [ 2] void store(const shared_ptr<ELEMENT_TYPE>& value);
+// [ 3] shared_ptr<ELEMENT_TYPE> exchange(const shared_ptr<E>& value);
+// [ 3] bool compare_exchange_strong(value_type *e, const value_type& d);
+// [ 3] bool compare_exchange_weak(value_type *e, const value_type& d);
+//
+// ACCESSORS
+// [ 2] shared_ptr<ELEMENT_TYPE> load() const;
+// [ 2] bool is_lock_free() const;
+// [ 2] Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [ 4] CONCERN: Concurrent loads and stores are consistent and leak-free.
+// [ 4] CONCERN: Concurrent 'compare_exchange_strong' loses no update.
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+//-----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+typedef HANDLE    ThreadId;
+#else
+typedef pthread_t ThreadId;
+#endif
+
+typedef void *(*ThreadFunction)(void *arg);
+
+//=============================================================================
+//                  GLOBAL HELPER CLASSES AND FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static
+ThreadId createThread(ThreadFunction func, void *arg)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    return CreateThread(0, 0, (LPTHREAD_START_ROUTINE)func, arg, 0, 0);
+#else
+    ThreadId id;
+    pthread_create(&id, 0, func, arg);
+    return id;
+#endif
+}
+
+static
+void joinThread(ThreadId id)
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    WaitForSingleObject(id, INFINITE);
+    CloseHandle(id);
+#else
+    pthread_join(id, 0);
+#endif
+}
+
+class Snapshot {
+    // This class provides a value whose two attributes are kept opposite,
+    // and counts its live instances.
+
+    // CLASS DATA
+    static bsls::AtomicInt s_numObjects;  // number of live instances
+
+    // DATA
+    int d_value;     // value
+    int d_negation;  // '-d_value', checked by 'isIntact'
+
+  public:
+    // CLASS METHODS
+    static int numObjects()
+        // Return the number of live instances of this class.
+    {
+        return s_numObjects;
+    }
+
+    // CREATORS
+    explicit Snapshot(int value = 0)
+        // Create a 'Snapshot' having the optionally specified 'value'.
+    : d_value(value)
+    , d_negation(-value)
+    {
+        ++s_numObjects;
+    }
+
+    Snapshot(const Snapshot& original)
+        // Create a 'Snapshot' having the value of the specified 'original'.
+    : d_value(original.d_value)
+    , d_negation(original.d_negation)
+    {
+        ++s_numObjects;
+    }
+
+    ~Snapshot()
+        // Destroy this object, overwriting its attributes.
+    {
+        d_value    = 1;
+        d_negation = 1;
+        --s_numObjects;
+    }
+
+    // ACCESSORS
+    bool isIntact() const
+        // Return 'true' if the attributes of this object are opposite, and
+        // 'false' otherwise.
+    {
+        return d_value == -d_negation;
+    }
+
+    int value() const
+        // Return the value of this object.
+    {
+        return d_value;
+    }
+};
+
+bsls::AtomicInt Snapshot::s_numObjects(0);
+
+typedef bsl::atomic_shared_ptr<Snapshot> Obj;
+typedef bsl::shared_ptr<Snapshot>        SnapshotPtr;
+
+struct ReaderArgs {
+    // This 'struct' holds the arguments of 'readerThread'.
+
+    Obj             *d_obj_p;       // object loaded from
+    bsls::AtomicInt *d_done_p;      // set when the writer has finished
+    int              d_numErrors;   // number of inconsistent loads (out)
+    int              d_numLoads;    // number of loads performed (out)
+};
+
+extern "C" void *readerThread(void *arg)
+    // Load snapshots from the object held by the specified 'arg', a
+    // 'ReaderArgs', until the writer has finished, counting the loads that are
+    // not intact or that are older than a previous load.
+{
+    ReaderArgs *args = static_cast<ReaderArgs *>(arg);
+
+    int last = 0;
+    while (!*args->d_done_p) {
+        SnapshotPtr snapshot = args->d_obj_p->load();
+        ++args->d_numLoads;
+        if (!snapshot || !snapshot->isIntact() || snapshot->value() < last) {
+            ++args->d_numErrors;
+            continue;
+        }
+        last = snapshot->value();
+    }
+    return 0;
+}
+
+struct WriterArgs {
+    // This 'struct' holds the arguments of 'writerThread'.
+
+    Obj                  *d_obj_p;        // object stored to
+    bslma::TestAllocator *d_allocator_p;  // allocator of the snapshots
+    int                   d_numStores;    // number of snapshots to store
+    bsls::AtomicInt      *d_done_p;       // set when finished
+};
+
+extern "C" void *writerThread(void *arg)
+    // Store increasing snapshots into the object held by the specified 'arg',
+    // a 'WriterArgs', alternating between 'store' and 'exchange', and set the
+    // 'done' flag when finished.
+{
+    WriterArgs *args = static_cast<WriterArgs *>(arg);
+
+    for (int i = 1; i <= args->d_numStores; ++i) {
+        SnapshotPtr snapshot;
+        snapshot.createInplace(args->d_allocator_p, i);
+        if (i % 2) {
+            args->d_obj_p->store(snapshot);
+        }
+        else {
+            args->d_obj_p->exchange(snapshot);
+        }
+    }
+    *args->d_done_p = 1;
+    return 0;
+}
+
+struct IncrementerArgs {
+    // This 'struct' holds the arguments of 'incrementerThread'.
+
+    Obj                  *d_obj_p;            // counter incremented
+    bslma::TestAllocator *d_allocator_p;      // allocator of the snapshots
+    int                   d_numIncrements;    // number of increments
+};
+
+extern "C" void *incrementerThread(void *arg)
+    // Increment the value of the snapshot held by the object held by the
+    // specified 'arg', an 'IncrementerArgs', by replacing it with
+    // 'compare_exchange_strong' the specified number of times.
+{
+    IncrementerArgs *args = static_cast<IncrementerArgs *>(arg);
+
+    for (int i = 0; i < args->d_numIncrements; ++i) {
+        SnapshotPtr expected = args->d_obj_p->load();
+        SnapshotPtr next;
+        do {
+            next.createInplace(args->d_allocator_p, expected->value() + 1);
+        } while (!args->d_obj_p->compare_exchange_strong(&expected, next));
+    }
+    return 0;
+}
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+namespace UsageExample {
+
+///Example 1: Publishing a Configuration Snapshot
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a server reads its configuration on each request, and that the
+// configuration is occasionally replaced by an administrative thread.
+//
+// First, we define the type of the configuration:
+//..
+    struct Config {
+        // This 'struct' holds the settings of a server.
+
+        int d_timeoutMs;   // request timeout in milliseconds
+        int d_maxRetries;  // maximum number of retries per request
+    };
+//..
+
+}  // close namespace UsageExample
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        using namespace UsageExample;
+
+// Then, we publish an initial snapshot:
+//..
+    bslma::TestAllocator allocator;
+
+    bsl::shared_ptr<Config> initial;
+    initial.createInplace(&allocator);
+    initial->d_timeoutMs  = 100;
+    initial->d_maxRetries = 3;
+
+    bsl::atomic_shared_ptr<Config> current(initial, &allocator);
+    initial.reset();
+//..
+// Next, a request handler, possibly running in many threads at once, loads
+// the current snapshot without taking a lock, and uses it for the duration of
+// the request:
+//..
+    bsl::shared_ptr<Config> config = current.load();
+    ASSERT(100 == config->d_timeoutMs);
+//..
+// Then, the administrative thread publishes a new snapshot, leaving the
+// request in progress with a consistent view of the old one:
+//..
+    bsl::shared_ptr<Config> updated;
+    updated.createInplace(&allocator);
+    updated->d_timeoutMs  = 250;
+    updated->d_maxRetries = 5;
+
+    current.store(updated);
+
+    ASSERT(100 == config->d_timeoutMs);
+    ASSERT(250 == current.load()->d_timeoutMs);
+//..
+// Finally, a writer that derives the new snapshot from the current one uses
+// 'compare_exchange_strong' so as not to overwrite a concurrent update:
+//..
+    bsl::shared_ptr<Config> expected = current.load();
+    bsl::shared_ptr<Config> next;
+    do {
+        next.createInplace(&allocator, *expected);
+        next->d_maxRetries += 1;
+    } while (!current.compare_exchange_strong(&expected, next));
+
+    ASSERT(6 == current.load()->d_maxRetries);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 A snapshot loaded while another thread replaces it is intact, and
+        //:   is not older than a snapshot loaded before it by the same thread.
+        //:
+        //: 2 Every snapshot replaced is destroyed, and every node deallocated,
+        //:   once no thread refers to it.
+        //:
+        //: 3 No update made by 'compare_exchange_strong' is lost when several
+        //:   threads update the same object.
+        //
+        // Plan:
+        //: 1 Start several reader threads loading from an object while a
+        //:   writer thread stores increasing snapshots into it, alternating
+        //:   between 'store' and 'exchange'.  Verify that the readers
+        //:   report no error, and that, when the object is destroyed, no
+        //:   snapshot is alive and no memory is in use.  (C-1..2)
+        //:
+        //: 2 Start several threads each incrementing the value held by an
+        //:   object a number of times using 'compare_exchange_strong', and
+        //:   verify the final value.  (C-2..3)
+        //
+        // Testing:
+        //   CONCERN: Concurrent loads and stores are consistent and leak-free.
+        //   CONCERN: Concurrent 'compare_exchange_strong' loses no update.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONCURRENCY TEST"
+                            "\n================\n");
+
+        enum { k_NUM_THREADS = 4 };
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("snapshots", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tLoading while storing.\n");
+        {
+            SnapshotPtr initial;
+            initial.createInplace(&sa, 0);
+
+            Obj mX(initial, &oa);
+            initial.reset();
+
+            bsls::AtomicInt done(0);
+
+            ReaderArgs readerArgs[k_NUM_THREADS];
+            ThreadId   readers[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                readerArgs[i].d_obj_p     = &mX;
+                readerArgs[i].d_done_p    = &done;
+                readerArgs[i].d_numErrors = 0;
+                readerArgs[i].d_numLoads  = 0;
+                readers[i] = createThread(&readerThread, &readerArgs[i]);
+            }
+
+            WriterArgs writerArgs = { &mX, &sa, 20000, &done };
+            ThreadId writer = createThread(&writerThread, &writerArgs);
+
+            joinThread(writer);
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                joinThread(readers[i]);
+                if (veryVerbose) {
+                    P_(i) P(readerArgs[i].d_numLoads)
+                }
+                ASSERTV(i, readerArgs[i].d_numErrors,
+                        0 == readerArgs[i].d_numErrors);
+            }
+
+            ASSERTV(mX.load()->value(), 20000 == mX.load()->value());
+            ASSERTV(Snapshot::numObjects(), 1 == Snapshot::numObjects());
+            ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+        }
+        ASSERTV(Snapshot::numObjects(), 0 == Snapshot::numObjects());
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+
+        if (verbose) printf("\tConcurrent compare-and-exchange.\n");
+        {
+            enum { k_NUM_INCREMENTS = 5000 };
+
+            SnapshotPtr initial;
+            initial.createInplace(&sa, 0);
+
+            Obj mX(initial, &oa);
+            initial.reset();
+
+            IncrementerArgs args = { &mX, &sa, k_NUM_INCREMENTS };
+            ThreadId        threads[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                threads[i] = createThread(&incrementerThread, &args);
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                joinThread(threads[i]);
+            }
+
+            ASSERTV(mX.load()->value(),
+                    k_NUM_THREADS * k_NUM_INCREMENTS == mX.load()->value());
+            ASSERTV(Snapshot::numObjects(), 1 == Snapshot::numObjects());
+        }
+        ASSERTV(Snapshot::numObjects(), 0 == Snapshot::numObjects());
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'exchange' AND 'compare_exchange_strong'
+        //
+        // Concerns:
+        //: 1 'exchange' stores the new value and returns the previous one,
+        //:   including when either is empty.
+        //:
+        //: 2 'compare_exchange_strong' replaces the held value if, and only
+        //:   if, the expected value refers to the same object and shares
+        //:   ownership with the held value, and returns 'true' exactly when it
+        //:   does.
+        //:
+        //: 3 On failure, the expected value is replaced by the held value, and
+        //:   no memory is allocated for the desired value.
+        //:
+        //: 4 An empty expected value matches an empty held value.
+        //:
+        //: 5 'compare_exchange_weak' behaves as 'compare_exchange_strong'.
+        //:
+        //: 6 Replaced values are released, and their nodes deallocated.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Exchange values, empty and non-empty, verifying the value
+        //:   returned, the value held, and the use counts.  (C-1, 6)
+        //:
+        //: 2 Compare-and-exchange using an expected value that is equal, that
+        //:   refers to a different object, that refers to the same object
+        //:   with a different owner (an alias), and that is empty, verifying
+        //:   the result, the held value, the expected value, and the blocks
+        //:   in use.  (C-2..6)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null 'expected'.  (C-7)
+        //
+        // Testing:
+        //   shared_ptr<ELEMENT_TYPE> exchange(const shared_ptr<E>& value);
+        //   bool compare_exchange_strong(value_type *e, const value_type& d);
+        //   bool compare_exchange_weak(value_type *e, const value_type& d);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                          "\nTESTING 'exchange' AND 'compare_exchange_strong'"
+                          "\n================================================"
+                          "\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("snapshots", veryVeryVeryVerbose);
+
+        SnapshotPtr a, b;
+        a.createInplace(&sa, 1);
+        b.createInplace(&sa, 2);
+
+        if (verbose) printf("\tTesting 'exchange'.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            SnapshotPtr r = mX.exchange(a);
+            ASSERT(!r);
+            ASSERT(a == X.load());
+            ASSERT(2 == a.use_count());
+
+            r = mX.exchange(b);
+            ASSERT(a == r);
+            ASSERT(b == X.load());
+            ASSERT(2 == a.use_count());
+            ASSERT(2 == b.use_count());
+            ASSERT(1 == oa.numBlocksInUse());
+
+            r = mX.exchange(SnapshotPtr());
+            ASSERT(b == r);
+            ASSERT(!X.load());
+            ASSERT(0 == oa.numBlocksInUse());
+
+            r.reset();
+            ASSERT(1 == a.use_count());
+            ASSERT(1 == b.use_count());
+        }
+
+        if (verbose) printf("\tTesting 'compare_exchange_strong'.\n");
+        {
+            Obj mX(a, &oa);  const Obj& X = mX;
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+            SnapshotPtr expected = b;
+            ASSERT(!mX.compare_exchange_strong(&expected, b));
+            ASSERT(a == expected);
+            ASSERT(a == X.load());
+            ASSERT(1 == oa.numBlocksInUse());
+            ASSERT(3 == a.use_count());
+            ASSERT(NUM_ALLOCATIONS == oa.numAllocations());
+
+            SnapshotPtr alias(b, a.get());
+            ASSERT(alias.get() == a.get());
+            expected = alias;
+            ASSERT(!mX.compare_exchange_strong(&expected, b));
+            ASSERT(a.rep() == expected.rep());
+            ASSERT(a == X.load());
+            ASSERT(NUM_ALLOCATIONS == oa.numAllocations());
+            alias.reset();
+
+            expected = a;
+            ASSERT(mX.compare_exchange_strong(&expected, b));
+            ASSERT(a == expected);
+            ASSERT(b == X.load());
+            ASSERT(1 == oa.numBlocksInUse());
+            ASSERT(2 == a.use_count());
+            ASSERT(2 == b.use_count());
+
+            expected = b;
+            ASSERT(mX.compare_exchange_weak(&expected, SnapshotPtr()));
+            ASSERT(!X.load());
+            ASSERT(0 == oa.numBlocksInUse());
+
+            expected = a;
+            ASSERT(!mX.compare_exchange_weak(&expected, b));
+            ASSERT(!expected);
+
+            ASSERT(mX.compare_exchange_strong(&expected, a));
+            ASSERT(a == X.load());
+            ASSERT(1 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(1 == a.use_count());
+        ASSERT(1 == b.use_count());
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(&oa);
+            SnapshotPtr expected;
+
+            ASSERT_SAFE_PASS(mX.compare_exchange_strong(&expected, a));
+            ASSERT_SAFE_FAIL(mX.compare_exchange_strong(0, a));
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS, 'store', AND 'load'
+        //
+        // Concerns:
+        //: 1 A default-constructed object holds an empty 'shared_ptr', and
+        //:   allocates no memory.
+        //:
+        //: 2 An object constructed with, or storing, a value holds a copy of
+        //:   it, sharing ownership of its object.
+        //:
+        //: 3 'store' releases the previously held value, and deallocates its
+        //:   node.
+        //:
+        //: 4 Storing an empty value allocates no memory.
+        //:
+        //: 5 Nodes are allocated from the supplied allocator, or from the
+        //:   default allocator if none is supplied.
+        //:
+        //: 6 The destructor releases the held value.
+        //:
+        //: 7 If an exception is thrown allocating a node, 'store' has no
+        //:   effect.
+        //:
+        //: 8 'is_lock_free' returns 'true'.
+        //
+        // Plan:
+        //: 1 Create objects with and without a value and an allocator, store
+        //:   empty and non-empty values, and verify the loaded value, the use
+        //:   counts, the number of live snapshots, and the blocks in use
+        //:   after each operation.  (C-1..6, 8)
+        //:
+        //: 2 Store a value within the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*'
+        //:   macros, verifying the held value on each iteration.  (C-7)
+        //
+        // Testing:
+        //   explicit atomic_shared_ptr(Allocator *basicAllocator = 0);
+        //   atomic_shared_ptr(const shared_ptr<E>& value, Allocator *a = 0);
+        //   ~atomic_shared_ptr();
+        //   void store(const shared_ptr<ELEMENT_TYPE>& value);
+        //   shared_ptr<ELEMENT_TYPE> load() const;
+        //   bool is_lock_free() const;
+        //   Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CREATORS, 'store', AND 'load'"
+                            "\n=====================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("snapshots", veryVeryVeryVerbose);
+
+        SnapshotPtr a, b;
+        a.createInplace(&sa, 1);
+        b.createInplace(&sa, 2);
+
+        if (verbose) printf("\tDefault construction.\n");
+        {
+            const Obj X(&oa);
+            ASSERT(!X.load());
+            ASSERT(&oa == X.allocator());
+            ASSERT(X.is_lock_free());
+            ASSERT(0 == oa.numBlocksTotal());
+
+            const Obj Y;
+            ASSERT(&defaultAllocator == Y.allocator());
+        }
+
+        if (verbose) printf("\tConstruction with a value, and 'store'.\n");
+        {
+            Obj mX(a, &oa);  const Obj& X = mX;
+            ASSERT(a == X.load());
+            ASSERT(2 == a.use_count());
+            ASSERT(1 == oa.numBlocksInUse());
+
+            {
+                SnapshotPtr loaded = X.load();
+                ASSERT(a == loaded);
+                ASSERT(3 == a.use_count());
+                ASSERT(1 == loaded->value());
+            }
+            ASSERT(2 == a.use_count());
+
+            mX.store(b);
+            ASSERT(b == X.load());
+            ASSERT(1 == a.use_count());
+            ASSERT(2 == b.use_count());
+            ASSERT(1 == oa.numBlocksInUse());
+
+            mX.store(SnapshotPtr());
+            ASSERT(!X.load());
+            ASSERT(1 == b.use_count());
+            ASSERT(0 == oa.numBlocksInUse());
+
+            mX.store(a);
+            mX.store(a);
+            ASSERT(a == X.load());
+            ASSERT(2 == a.use_count());
+            ASSERT(1 == oa.numBlocksInUse());
+        }
+        ASSERT(1 == a.use_count());
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tThe held value outlives the caller's.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            {
+                SnapshotPtr c;
+                c.createInplace(&sa, 3);
+                mX.store(c);
+            }
+            ASSERT(3 == Snapshot::numObjects());
+            ASSERT(3 == X.load()->value());
+        }
+        ASSERT(2 == Snapshot::numObjects());
+
+        if (verbose) printf("\tUsing the default allocator.\n");
+        {
+            Obj mX(a);
+            ASSERT(1 == defaultAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) printf("\tException safety.\n");
+        {
+            Obj mX(a, &oa);  const Obj& X = mX;
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                ASSERT(a == X.load());
+                ASSERT(2 == a.use_count());
+                ASSERT(1 == b.use_count());
+
+                mX.store(b);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(b == X.load());
+            ASSERT(1 == a.use_count());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Store, load, exchange, and compare-and-exchange a few values,
+        //:   verifying the value held after each step.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            SnapshotPtr a, b;
+            a.createInplace(&oa, 1);
+            b.createInplace(&oa, 2);
+
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(!X.load());
+
+            mX.store(a);
+            ASSERT(1 == X.load()->value());
+
+            ASSERT(a == mX.exchange(b));
+            ASSERT(2 == X.load()->value());
+
+            SnapshotPtr expected = a;
+            ASSERT(!mX.compare_exchange_strong(&expected, a));
+            ASSERT(b == expected);
+            ASSERT( mX.compare_exchange_strong(&expected, a));
+            ASSERT(1 == X.load()->value());
+        }
+        ASSERT(0 == Snapshot::numObjects());
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
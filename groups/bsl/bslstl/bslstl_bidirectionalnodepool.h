@@ -250,7 +250,27 @@ class BidirectionalNodePool {
     typedef typename AllocatorTraits::size_type size_type;
         // Alias for the 'size_type' of the allocator defined by 'SimplePool'.
 
+    typedef VALUE ValueType;
+        // Alias for the type of the value held by each node.
+
+    typedef bslalg::BidirectionalNode<VALUE> NodeType;
+        // Alias for the type of the nodes created by this pool.
+
+    typedef typename Pool::Chunk Chunk;
+        // Alias for the chunk type defined by 'SimplePool'.
+
   public:
+    // CLASS METHODS
+    static void returnNode(Chunk                     *chunk,
+                           bslalg::BidirectionalLink *node,
+                           const AllocatorType&       allocator);
+        // Return the memory footprint of the specified 'node', lent out of the
+        // specified 'chunk', to 'chunk', and release the reference to 'chunk'
+        // held by the caller, returning the memory of 'chunk' to the
+        // specified 'allocator' if it was the last reference.  The behavior is
+        // undefined unless the value of 'node' has been destroyed.  See
+        // 'SimplePool::returnBlock'.
+
     // CREATORS
     explicit BidirectionalNodePool(const ALLOCATOR& allocator);
         // Create a 'BidirectionalNodePool' object that will use the specified
@@ -321,6 +341,27 @@ class BidirectionalNodePool {
         // least the specified 'numNodes' before the pool replenishes.  The
         // behavior is undefined unless '0 < numNodes'.
 
+    Chunk *lendNode(bslalg::BidirectionalLink *node);
+        // Lend the memory footprint of the specified 'node', removed from a
+        // container using this pool, out of this pool, and return the chunk
+        // holding it, with a reference to the chunk acquired on behalf of the
+        // caller, which thereby keeps 'node' valid until handing it over to a
+        // pool (see 'adoptNode') or back to its chunk (see 'returnNode').  See
+        // 'SimplePool::lendBlock'.
+
+    void reserveAdoption();
+        // Ensure that the next call to 'adoptNode' on this pool does not
+        // allocate memory.
+
+    void adoptNode(Chunk *chunk, bslalg::BidirectionalLink *node);
+        // Take over the specified 'node', lent out of the specified 'chunk',
+        // along with the reference to 'chunk' held by the caller, so that
+        // 'node' may be deleted by this pool.  If an exception is thrown, this
+        // method has no effect.  The behavior is undefined unless the caller
+        // holds a reference to 'chunk' for 'node', lent by a pool whose
+        // allocator compares equal to 'allocator()'.  See
+        // 'SimplePool::adoptBlock'.
+
     void swapRetainAllocators(BidirectionalNodePool& other);
         // Efficiently exchange the nodes of this object with those of the
         // specified 'other' object.  This method provides the no-throw
@@ -374,6 +415,19 @@ struct IsBitwiseMoveable<bslstl::BidirectionalNodePool<VALUE, ALLOCATOR> >
 
 namespace bslstl {
 
+// CLASS METHODS
+template <class VALUE, class ALLOCATOR>
+inline
+void BidirectionalNodePool<VALUE, ALLOCATOR>::returnNode(
+                                          Chunk                     *chunk,
+                                          bslalg::BidirectionalLink *node,
+                                          const AllocatorType&       allocator)
+{
+    Pool::returnBlock(chunk,
+                      static_cast<bslalg::BidirectionalNode<VALUE> *>(node),
+                      allocator);
+}
+
 // CREATORS
 template <class VALUE, class ALLOCATOR>
 inline
@@ -475,6 +529,33 @@ void BidirectionalNodePool<VALUE, ALLOCATOR>::reserveNodes(size_type numNodes)
     d_pool.reserve(numNodes);
 }
 
+template <class VALUE, class ALLOCATOR>
+inline
+typename BidirectionalNodePool<VALUE, ALLOCATOR>::Chunk *
+BidirectionalNodePool<VALUE, ALLOCATOR>::lendNode(
+                                               bslalg::BidirectionalLink *node)
+{
+    return d_pool.lendBlock(
+                        static_cast<bslalg::BidirectionalNode<VALUE> *>(node));
+}
+
+template <class VALUE, class ALLOCATOR>
+inline
+void BidirectionalNodePool<VALUE, ALLOCATOR>::reserveAdoption()
+{
+    d_pool.reserveAdoption();
+}
+
+template <class VALUE, class ALLOCATOR>
+inline
+void BidirectionalNodePool<VALUE, ALLOCATOR>::adoptNode(
+                                              Chunk                     *chunk,
+                                              bslalg::BidirectionalLink *node)
+{
+    d_pool.adoptBlock(chunk,
+                      static_cast<bslalg::BidirectionalNode<VALUE> *>(node));
+}
+
 template <class VALUE, class ALLOCATOR>
 inline
 void BidirectionalNodePool<VALUE, ALLOCATOR>::swapRetainAllocators(
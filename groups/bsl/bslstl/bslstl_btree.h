@@ -0,0 +1,3178 @@
+// bslstl_btree.h                                                     -*-C++-*-
+#ifndef INCLUDED_BSLSTL_BTREE
+#define INCLUDED_BSLSTL_BTREE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a cache-friendly B+tree of unique values and its iterator.
+//
+//@CLASSES:
+//   bslstl::BTree: ordered container of unique values held in wide nodes
+//   bslstl::BTreeIterator: STL-compliant bidirectional iterator over a 'BTree'
+//
+//@SEE_ALSO: bslstl_btreemap, bslstl_btreeset, bslalg_rbtreeutil
+//
+//@DESCRIPTION: This component provides a class template, 'bslstl::BTree',
+// implementing an ordered sequence of values having unique keys, stored in a
+// B+tree whose nodes are sized to span a few cache lines, and a class
+// template, 'bslstl::BTreeIterator', providing an STL-compliant bidirectional
+// iterator over the values of a 'BTree'.  'BTree' is the implementation of
+// the 'bsl::btree_map' and 'bsl::btree_set' containers, and is not intended
+// to be used directly by clients.
+//
+// A 'BTree' is parameterized on a 'KEY_CONFIG' policy, a 'COMPARATOR' and an
+// 'ALLOCATOR'.  The 'KEY_CONFIG' policy (e.g.,
+// 'bslstl::UnorderedMapKeyConfiguration' or
+// 'bslstl::UnorderedSetKeyConfiguration') defines the 'ValueType' of the
+// elements of the tree, the 'KeyType' by which they are ordered, and a class
+// method, 'extractKey', returning the key of an element.  The 'COMPARATOR' is
+// a binary predicate providing a strict weak ordering on 'KeyType' objects.
+// The 'ALLOCATOR' is an allocator for 'ValueType' objects, and supplies the
+// memory for the nodes of the tree; the elements of the tree, and the copies
+// of keys held in its inner nodes, are created using
+// 'bsl::allocator_traits<ALLOCATOR>::construct'.
+//
+///Structure
+///---------
+// Each element of a 'BTree' is held in a *leaf* node, and each leaf holds a
+// sorted run of up to a fixed number of elements.  The leaves are joined, in
+// order, into a circular doubly-linked list through a sentinel leaf embedded
+// in the tree, so that iteration from one element to the next is a pointer
+// increment within a leaf, and a single pointer load at the boundary between
+// leaves.  A 'BTreeIterator' is the address of a leaf paired with an index
+// into that leaf, and the past-the-end iterator refers to the sentinel.
+//
+// The leaves are indexed by a tree of *inner* nodes, each holding a sorted
+// run of separator keys and the addresses of one more child node than it has
+// keys.  Every key in the 'i'th child of an inner node is ordered after the
+// key at index 'i - 1' and is not ordered after the key at index 'i', so that
+// a lookup descends from the root to a leaf by finding, in each inner node,
+// the number of keys ordered before the key being sought.  A full node is
+// split in two when a value is inserted into it; if the value is appended to
+// the last leaf of the tree, the split leaves the full node in place and
+// starts a new node, so that a tree populated from an ordered sequence has
+// full nodes.
+//
+// When a leaf is emptied by removing its last element, it is unlinked and
+// freed, and any inner node left without children is freed in turn.  When
+// removing an element leaves a leaf less than a quarter full, the leaf is
+// merged with an adjacent leaf having the same parent, if the elements of
+// both fit in one leaf, and the emptied leaf is freed; a leaf is therefore
+// left less than a quarter full only beside siblings that are more than three
+// quarters full, and the memory held by a tree shrinks with its population.
+// Inner nodes are not merged or rebalanced on removal (other than by
+// collapsing a root having a single child), so the depth of a tree never
+// exceeds that of a tree built by inserting its largest population, and the
+// lookup cost remains logarithmic in that population.
+//
+///Node Layout and In-Node Search
+///------------------------------
+// Nodes are sized to approximately 256 bytes (four 64-byte cache lines), and
+// hold as many keys or elements as fit in that space (but at least 3 keys in
+// an inner node and 4 elements in a leaf).  A lookup therefore touches one
+// or two cache lines per level of a tree having a far smaller depth than a
+// red-black tree of the same size.
+//
+// If the (non-'const') key type is an arithmetic type, the keys of each node
+// are held in a contiguous sorted array: the separator keys of an inner node
+// are held directly, and a leaf either holds its elements directly (if the
+// element is itself the key) or maintains a contiguous copy of the keys of
+// its elements alongside them.  If, in addition, 'COMPARATOR' is
+// 'std::less<KEY>', the position of a key within a node is found by counting,
+// without branches, the keys less than it, which compilers can vectorize;
+// otherwise, the position is found by a binary search.
+//
+// Elements (and separator keys) of any other type are never moved once
+// constructed in a node: each node holds a small array of one-byte slot
+// indices giving the order of its elements, and inserting or removing an
+// element shifts only those indices.  Elements are moved from one node to
+// another only when a full node is split, or when leaves are merged, by
+// copying their footprint if 'bslmf::IsBitwiseMoveable' holds for the element
+// type, and by copy-construction otherwise.
+//
+///Iterator Invalidation
+///---------------------
+// Unlike the node-based 'bsl::map' and 'bsl::set', inserting an element into
+// a 'BTree', or removing an element from it, invalidates all iterators into
+// the tree, and all references to its elements, other than the iterator
+// returned by the modifying operation.
+//
+///Exception Safety
+///----------------
+// Inserting a single element provides the strong exception-safety guarantee:
+// if an exception is thrown (by the allocator, or by the copy constructor of
+// the element or key type), the sequence of elements in the tree is
+// unchanged (although the tree may have been restructured).  Removing
+// elements never throws: should copying an element throw while merging
+// leaves, the leaves are left unmerged.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Maintaining an Ordered Set of Integers
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example we use a 'BTree' directly to maintain an ordered set of
+// integers, although a 'bsl::btree_set' is a more convenient interface for
+// the same purpose.
+//
+// First, we define the type of the tree, using
+// 'bslstl::UnorderedSetKeyConfiguration' to indicate that each element is its
+// own key:
+//..
+//  typedef bslstl::UnorderedSetKeyConfiguration<int> KeyConfig;
+//  typedef bslstl::BTree<KeyConfig,
+//                        std::less<int>,
+//                        bsl::allocator<int> >       Tree;
+//
+//  bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+//  Tree tree(std::less<int>(), &oa);
+//..
+// Then, we insert a sequence of values, some of them more than once:
+//..
+//  static const int DATA[] = { 5, 3, 8, 1, 3, 9, 7, 5 };
+//  const int NUM_DATA = sizeof DATA / sizeof *DATA;
+//
+//  int numInserted = 0;
+//  for (int i = 0; i < NUM_DATA; ++i) {
+//      bool isInserted;
+//      tree.insertIfMissing(&isInserted, DATA[i]);
+//      numInserted += isInserted;
+//  }
+//  assert(6 == numInserted);
+//  assert(6 == tree.size());
+//..
+// Next, we iterate over the tree and observe that its elements are ordered:
+//..
+//  static const int EXPECTED[] = { 1, 3, 5, 7, 8, 9 };
+//
+//  int index = 0;
+//  for (Tree::Iterator it = tree.begin(); it != tree.end(); ++it, ++index) {
+//      assert(EXPECTED[index] == *it);
+//  }
+//..
+// Now, we look up some values:
+//..
+//  assert(7           == *tree.find(7));
+//  assert(tree.end()  ==  tree.find(6));
+//  assert(7           == *tree.lowerBound(6));
+//  assert(8           == *tree.upperBound(7));
+//..
+// Finally, we remove an element, using the returned iterator to find its
+// successor:
+//..
+//  Tree::Iterator next = tree.remove(tree.find(5));
+//  assert(7 == *next);
+//  assert(5 == tree.size());
+//  assert(tree.isWellFormed());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_FUNCTORADAPTER
+#include <bslalg_functoradapter.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ENABLEIF
+#include <bslmf_enableif.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISARITHMETIC
+#include <bslmf_isarithmetic.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISSAME
+#include <bslmf_issame.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_REMOVECV
+#include <bslmf_removecv.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_EXCEPTIONUTIL
+#include <bsls_exceptionutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_OBJECTBUFFER
+#include <bsls_objectbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_UTIL
+#include <bsls_util.h>
+#endif
+
+#ifndef INCLUDED_CSTRING
+#include <cstring>
+#define INCLUDED_CSTRING
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                           // =====================
+                           // struct BTree_NodeBase
+                           // =====================
+
+struct BTree_NodeBase {
+    // This 'struct' provides the header common to the inner nodes and leaves
+    // of a 'BTree'.  For use only by 'bslstl::BTree'.
+
+    // DATA
+    BTree_NodeBase *d_parent_p;  // parent inner node, or 0 for the root
+
+    int             d_count;     // number of keys in an inner node, or of
+                                 // elements in a leaf
+};
+
+                           // =====================
+                           // struct BTree_LeafBase
+                           // =====================
+
+struct BTree_LeafBase : BTree_NodeBase {
+    // This 'struct' provides the header of the leaves of a 'BTree', which are
+    // joined in order into a circular doubly-linked list through a sentinel
+    // leaf having no elements.  For use only by 'bslstl::BTree' and
+    // 'bslstl::BTreeIterator'.
+
+    // DATA
+    BTree_LeafBase *d_next_p;  // next leaf in order, or the sentinel
+    BTree_LeafBase *d_prev_p;  // previous leaf in order, or the sentinel
+};
+
+                             // =================
+                             // class BTree_Array
+                             // =================
+
+template <class TYPE,
+          int   CAPACITY,
+          bool  IS_FLAT = bsl::is_arithmetic<TYPE>::value>
+class BTree_Array;
+    // This class template provides storage for a sorted run of up to the
+    // (template parameter) 'CAPACITY' objects of the (template parameter)
+    // 'TYPE' within a node of a 'BTree'.  The number of objects held is
+    // maintained by the node, and supplied to each method that needs it.  The
+    // 'IS_FLAT' specialization holds the objects contiguously, and is used for
+    // arithmetic types; the other specialization never moves an object once
+    // constructed, and maintains instead an array of slot indices giving the
+    // order of the objects.  For use only by 'bslstl::BTree'.
+
+template <class TYPE, int CAPACITY>
+class BTree_Array<TYPE, CAPACITY, true> {
+    // This partial specialization of 'BTree_Array' holds its objects, which
+    // must be of arithmetic type, in a contiguous sorted array.
+
+    // DATA
+    TYPE d_data[CAPACITY];  // objects, in order
+
+  public:
+    // CREATORS
+    //! BTree_Array() = default;
+        // Create an array holding no objects.  Note that the elements of the
+        // underlying array are not initialized.
+
+    // MANIPULATORS
+    template <class ALLOCATOR>
+    void insert(int position, int count, const TYPE& value, ALLOCATOR&);
+        // Insert the specified 'value' into this array, holding the specified
+        // 'count' objects, at the specified 'position'.  The behavior is
+        // undefined unless '0 <= position <= count < CAPACITY'.
+
+    template <class ALLOCATOR>
+    void erase(int position, int count, ALLOCATOR&);
+        // Remove the object at the specified 'position' from this array,
+        // holding the specified 'count' objects.  The behavior is undefined
+        // unless '0 <= position < count'.
+
+    template <class ALLOCATOR>
+    void moveTail(BTree_Array *destination,
+                  int          position,
+                  int          count,
+                  ALLOCATOR&);
+        // Transfer the objects from the specified 'position' to the end of
+        // this array, holding the specified 'count' objects, to the start of
+        // the specified 'destination' array, which must hold no objects.  The
+        // behavior is undefined unless '0 <= position <= count'.
+
+    template <class ALLOCATOR>
+    void moveAll(BTree_Array *destination,
+                 int          count,
+                 int          destinationCount,
+                 ALLOCATOR&);
+        // Transfer the specified 'count' objects of this array to the end of
+        // the specified 'destination' array, holding the specified
+        // 'destinationCount' objects.  The behavior is undefined unless
+        // '0 <= count' and '0 <= destinationCount <= CAPACITY - count'.
+
+    template <class ALLOCATOR>
+    void destroyAll(int count, ALLOCATOR&);
+        // Destroy the specified 'count' objects held by this array.
+
+    TYPE& operator[](int index);
+        // Return a reference providing modifiable access to the object at the
+        // specified 'index' in this array.
+
+    // ACCESSORS
+    const TYPE& operator[](int index) const;
+        // Return a reference providing non-modifiable access to the object at
+        // the specified 'index' in this array.
+
+    const TYPE *data() const;
+        // Return the address of the contiguous sorted objects held by this
+        // array.
+};
+
+template <class TYPE, int CAPACITY>
+class BTree_Array<TYPE, CAPACITY, false> {
+    // This partial specialization of 'BTree_Array' constructs each of its
+    // objects in a slot that it occupies until destroyed, and maintains an
+    // array of slot indices giving the order of the objects.  The indices
+    // following those of the objects held identify the unoccupied slots.
+
+    // DATA
+    unsigned char            d_order[CAPACITY];  // slot indices, in order of
+                                                 // the objects, followed by
+                                                 // the unoccupied slots
+
+    bsls::ObjectBuffer<TYPE> d_slots[CAPACITY];  // storage for the objects
+
+  private:
+    // PRIVATE MANIPULATORS
+    TYPE *slotAddress(int slot);
+        // Return the address of the storage for the specified 'slot'.
+
+  public:
+    // CREATORS
+    BTree_Array();
+        // Create an array holding no objects.
+
+    // MANIPULATORS
+    template <class ALLOCATOR>
+    void insert(int              position,
+                int              count,
+                const TYPE&      value,
+                ALLOCATOR&       allocator);
+        // Insert a copy of the specified 'value', created using the specified
+        // 'allocator', into this array, holding the specified 'count' objects,
+        // at the specified 'position'.  If an exception is thrown, this array
+        // is unchanged.  The behavior is undefined unless
+        // '0 <= position <= count < CAPACITY'.
+
+    template <class ALLOCATOR>
+    void erase(int position, int count, ALLOCATOR& allocator);
+        // Destroy, using the specified 'allocator', and remove the object at
+        // the specified 'position' from this array, holding the specified
+        // 'count' objects.  The behavior is undefined unless
+        // '0 <= position < count'.
+
+    template <class ALLOCATOR>
+    void moveTail(BTree_Array *destination,
+                  int          position,
+                  int          count,
+                  ALLOCATOR&   allocator);
+        // Transfer the objects from the specified 'position' to the end of
+        // this array, holding the specified 'count' objects, to the start of
+        // the specified 'destination' array, which must hold no objects, using
+        // the specified 'allocator' to copy and destroy objects that are not
+        // bitwise moveable.  If an exception is thrown, both arrays are
+        // unchanged.  The behavior is undefined unless
+        // '0 <= position <= count'.
+
+    template <class ALLOCATOR>
+    void moveAll(BTree_Array *destination,
+                 int          count,
+                 int          destinationCount,
+                 ALLOCATOR&   allocator);
+        // Transfer the specified 'count' objects of this array to the end of
+        // the specified 'destination' array, holding the specified
+        // 'destinationCount' objects, using the specified 'allocator' to copy
+        // and destroy objects that are not bitwise moveable.  If an exception
+        // is thrown, both arrays are unchanged.  The behavior is undefined
+        // unless '0 <= count' and '0 <= destinationCount <= CAPACITY - count'.
+
+    template <class ALLOCATOR>
+    void destroyAll(int count, ALLOCATOR& allocator);
+        // Destroy, using the specified 'allocator', the specified 'count'
+        // objects held by this array.
+
+    TYPE& operator[](int index);
+        // Return a reference providing modifiable access to the object at the
+        // specified 'index' in this array.
+
+    // ACCESSORS
+    const TYPE& operator[](int index) const;
+        // Return a reference providing non-modifiable access to the object at
+        // the specified 'index' in this array.
+};
+
+                          // ========================
+                          // class BTree_ArrayProctor
+                          // ========================
+
+template <class ARRAY, class ALLOCATOR>
+class BTree_ArrayProctor {
+    // This class implements a proctor that, unless its 'release' method has
+    // been called, destroys the objects of a 'BTree_Array', starting at a
+    // given index, that have been counted by its 'increment' method.  For use
+    // only by 'bslstl::BTree_Array'.
+
+    // DATA
+    ARRAY     *d_array_p;      // array whose objects are managed
+    int        d_first;        // index of the first object managed
+    int        d_count;        // number of objects managed
+    ALLOCATOR *d_allocator_p;  // allocator used to destroy the objects
+
+  private:
+    // NOT IMPLEMENTED
+    BTree_ArrayProctor(const BTree_ArrayProctor&);
+    BTree_ArrayProctor& operator=(const BTree_ArrayProctor&);
+
+  public:
+    // CREATORS
+    BTree_ArrayProctor(ARRAY *array, int first, ALLOCATOR *allocator);
+        // Create a proctor managing no objects of the specified 'array', the
+        // objects managed starting at the specified index 'first', and using
+        // the specified 'allocator' to destroy managed objects.
+
+    ~BTree_ArrayProctor();
+        // Destroy the objects managed by this proctor, if any.
+
+    // MANIPULATORS
+    void increment();
+        // Extend the sequence of objects managed by this proctor by one.
+
+    void release();
+        // Release from management the objects currently managed by this
+        // proctor.
+};
+
+                             // ================
+                             // class BTree_Leaf
+                             // ================
+
+template <class VALUE, class KEY, int CAPACITY, bool HAS_KEY_CACHE>
+class BTree_Leaf : public BTree_LeafBase {
+    // This class template provides a leaf of a 'BTree', holding a sorted run
+    // of up to the (template parameter) 'CAPACITY' elements of the (template
+    // parameter) 'VALUE' type.  If the (template parameter) 'HAS_KEY_CACHE'
+    // is 'true', the leaf also holds a contiguous copy of the keys (of the
+    // arithmetic (template parameter) type 'KEY') of its elements; otherwise
+    // 'KEY' is ignored.  For use only by 'bslstl::BTree'.
+
+    // DATA
+    BTree_Array<VALUE, CAPACITY> d_values;  // elements of the leaf
+    BTree_Array<KEY, CAPACITY>   d_keys;    // keys of the elements
+
+  public:
+    // MANIPULATORS
+    template <class ALLOCATOR>
+    void insert(int           position,
+                const VALUE&  value,
+                const KEY&    key,
+                ALLOCATOR&    allocator);
+        // Insert a copy of the specified 'value', having the specified 'key',
+        // into this leaf at the specified 'position', using the specified
+        // 'allocator' to create the copy.  If an exception is thrown, this
+        // leaf is unchanged.  The behavior is undefined unless
+        // '0 <= position <= d_count < CAPACITY'.
+
+    template <class ALLOCATOR>
+    void erase(int position, ALLOCATOR& allocator);
+        // Destroy, using the specified 'allocator', and remove the element at
+        // the specified 'position' in this leaf.  The behavior is undefined
+        // unless '0 <= position < d_count'.
+
+    template <class ALLOCATOR>
+    void moveTail(BTree_Leaf *destination, int position, ALLOCATOR& allocator);
+        // Transfer the elements from the specified 'position' to the end of
+        // this leaf to the specified 'destination' leaf, which must be empty,
+        // using the specified 'allocator' to copy and destroy elements that
+        // are not bitwise moveable.  If an exception is thrown, both leaves
+        // are unchanged.  The behavior is undefined unless
+        // '0 <= position <= d_count'.
+
+    template <class ALLOCATOR>
+    void moveAll(BTree_Leaf *destination, ALLOCATOR& allocator);
+        // Transfer the elements of this leaf to the end of the specified
+        // 'destination' leaf, using the specified 'allocator' to copy and
+        // destroy elements that are not bitwise moveable.  If an exception is
+        // thrown, both leaves are unchanged.  The behavior is undefined
+        // unless 'd_count + destination->d_count <= CAPACITY'.
+
+    template <class ALLOCATOR>
+    void destroyAll(ALLOCATOR& allocator);
+        // Destroy, using the specified 'allocator', the elements of this leaf.
+
+    VALUE& value(int index);
+        // Return a reference providing modifiable access to the element at
+        // the specified 'index' in this leaf.
+
+    // ACCESSORS
+    const KEY *keys() const;
+        // Return the address of the contiguous sorted keys of the elements of
+        // this leaf.
+
+    const VALUE& value(int index) const;
+        // Return a reference providing non-modifiable access to the element
+        // at the specified 'index' in this leaf.
+};
+
+template <class VALUE, class KEY, int CAPACITY>
+class BTree_Leaf<VALUE, KEY, CAPACITY, false> : public BTree_LeafBase {
+    // This partial specialization of 'BTree_Leaf' holds no copy of the keys
+    // of its elements.
+
+    // DATA
+    BTree_Array<VALUE, CAPACITY> d_values;  // elements of the leaf
+
+  public:
+    // MANIPULATORS
+    template <class ALLOCATOR>
+    void insert(int           position,
+                const VALUE&  value,
+                const KEY&    key,
+                ALLOCATOR&    allocator);
+        // Insert a copy of the specified 'value' into this leaf at the
+        // specified 'position', using the specified 'allocator' to create the
+        // copy.  The specified 'key' is ignored.  If an exception is thrown,
+        // this leaf is unchanged.  The behavior is undefined unless
+        // '0 <= position <= d_count < CAPACITY'.
+
+    template <class ALLOCATOR>
+    void erase(int position, ALLOCATOR& allocator);
+        // Destroy, using the specified 'allocator', and remove the element at
+        // the specified 'position' in this leaf.  The behavior is undefined
+        // unless '0 <= position < d_count'.
+
+    template <class ALLOCATOR>
+    void moveTail(BTree_Leaf *destination, int position, ALLOCATOR& allocator);
+        // Transfer the elements from the specified 'position' to the end of
+        // this leaf to the specified 'destination' leaf, which must be empty,
+        // using the specified 'allocator' to copy and destroy elements that
+        // are not bitwise moveable.  If an exception is thrown, both leaves
+        // are unchanged.  The behavior is undefined unless
+        // '0 <= position <= d_count'.
+
+    template <class ALLOCATOR>
+    void moveAll(BTree_Leaf *destination, ALLOCATOR& allocator);
+        // Transfer the elements of this leaf to the end of the specified
+        // 'destination' leaf, using the specified 'allocator' to copy and
+        // destroy elements that are not bitwise moveable.  If an exception is
+        // thrown, both leaves are unchanged.  The behavior is undefined
+        // unless 'd_count + destination->d_count <= CAPACITY'.
+
+    template <class ALLOCATOR>
+    void destroyAll(ALLOCATOR& allocator);
+        // Destroy, using the specified 'allocator', the elements of this leaf.
+
+    VALUE& value(int index);
+        // Return a reference providing modifiable access to the element at
+        // the specified 'index' in this leaf.
+
+    // ACCESSORS
+    const VALUE *keys() const;
+        // Return the address of the contiguous sorted elements of this leaf.
+        // The behavior is undefined unless 'VALUE' is an arithmetic type (and
+        // so is its own key).
+
+    const VALUE& value(int index) const;
+        // Return a reference providing non-modifiable access to the element
+        // at the specified 'index' in this leaf.
+};
+
+                             // =================
+                             // class BTree_Inner
+                             // =================
+
+template <class KEY, int CAPACITY>
+class BTree_Inner : public BTree_NodeBase {
+    // This class template provides an inner node of a 'BTree', holding a
+    // sorted run of up to the (template parameter) 'CAPACITY' separator keys
+    // of the (template parameter) 'KEY' type, and the addresses of one more
+    // child node than it has keys.  For use only by 'bslstl::BTree'.
+
+    // DATA
+    BTree_Array<KEY, CAPACITY>  d_keys;                    // separator keys
+    BTree_NodeBase             *d_children[CAPACITY + 1];  // child nodes
+
+  public:
+    // MANIPULATORS
+    template <class ALLOCATOR>
+    void insert(int              position,
+                const KEY&       key,
+                BTree_NodeBase  *child,
+                ALLOCATOR&       allocator);
+        // Insert a copy of the specified 'key', created using the specified
+        // 'allocator', into this node at the specified 'position', and the
+        // specified 'child' immediately following it (i.e., at the child index
+        // 'position + 1'), and make this node the parent of 'child'.  If an
+        // exception is thrown, this node is unchanged.  The behavior is
+        // undefined unless '0 <= position <= d_count < CAPACITY'.
+
+    template <class ALLOCATOR>
+    void erase(int keyPosition, int childPosition, ALLOCATOR& allocator);
+        // Destroy, using the specified 'allocator', and remove the key at the
+        // specified 'keyPosition' from this node, and remove the child at the
+        // specified 'childPosition'.  The behavior is undefined unless
+        // '0 <= keyPosition < d_count' and '0 <= childPosition <= d_count'.
+
+    template <class ALLOCATOR>
+    void moveTail(BTree_Inner *destination,
+                  int          position,
+                  ALLOCATOR&   allocator);
+        // Transfer the keys following the specified 'position', and the
+        // children following the child at 'position', to the specified
+        // 'destination' node, which must have no keys and no children, making
+        // 'destination' the parent of the transferred children, and destroy,
+        // using the specified 'allocator', the key at 'position'.  If an
+        // exception is thrown, both nodes are unchanged.  The behavior is
+        // undefined unless '0 <= position < d_count'.
+
+    template <class ALLOCATOR>
+    void destroyAll(ALLOCATOR& allocator);
+        // Destroy, using the specified 'allocator', the keys of this node.
+
+    void setOnlyChild(BTree_NodeBase *child);
+        // Make the specified 'child' the only child of this node, which must
+        // have no keys, and make this node the parent of 'child'.
+
+    // ACCESSORS
+    BTree_NodeBase *child(int index) const;
+        // Return the address of the child at the specified 'index' in this
+        // node.  The behavior is undefined unless '0 <= index <= d_count'.
+
+    int childIndex(const BTree_NodeBase *child) const;
+        // Return the index of the specified 'child' in this node.  The
+        // behavior is undefined unless 'child' is a child of this node.
+
+    const KEY& key(int index) const;
+        // Return a reference providing non-modifiable access to the key at the
+        // specified 'index' in this node.
+
+    const KEY *keys() const;
+        // Return the address of the contiguous sorted keys of this node.  The
+        // behavior is undefined unless 'KEY' is an arithmetic type.
+};
+
+                           // =====================
+                           // struct BTree_Capacity
+                           // =====================
+
+template <int HEADER_SIZE, int ENTRY_SIZE, int MIN_CAPACITY>
+struct BTree_Capacity {
+    // This 'struct' computes the number of entries of the specified
+    // 'ENTRY_SIZE' bytes that fit in a node of approximately 256 bytes having
+    // a header of the specified 'HEADER_SIZE' bytes, clamped to the range
+    // '[MIN_CAPACITY, 255]'.  For use only by 'bslstl::BTree'.
+
+    enum {
+        k_NODE_SIZE = 256,
+        k_FIT       = (k_NODE_SIZE - HEADER_SIZE) / ENTRY_SIZE,
+        VALUE       = k_FIT < MIN_CAPACITY
+                      ? MIN_CAPACITY
+                      : k_FIT > 255 ? 255 : k_FIT
+    };
+};
+
+                            // ===================
+                            // class BTreeIterator
+                            // ===================
+
+template <class VALUE, class LEAF, class DIFFERENCE_TYPE>
+class BTreeIterator
+#ifdef BSLS_PLATFORM_OS_SOLARIS
+    : public std::iterator<std::bidirectional_iterator_tag, VALUE>
+// On Solaris just to keep studio12-v4 happy, since algorithms takes only
+// iterators inheriting from 'std::iterator'.
+#endif
+{
+    // This class provides an STL-conforming bidirectional iterator over the
+    // ordered elements of a 'BTree' (see section [24.2.6
+    // bidirectional.iterators] of the C++11 standard).  A 'BTreeIterator'
+    // provides access to values of the (template parameter) type 'VALUE',
+    // held in leaves of the (template parameter) type 'LEAF', which must
+    // derive from 'BTree_LeafBase' and provide a 'value' method returning a
+    // reference providing modifiable access to a type convertible to
+    // 'VALUE'.  The (template parameter) 'DIFFERENCE_TYPE' determines the
+    // standard required 'difference_type' of the iterator.  The behavior of
+    // 'operator*' is undefined unless the iterator is at a valid position in
+    // the tree (i.e., not the 'end') and the tree has not been modified since
+    // the iterator was obtained, other than by the operation that returned
+    // it.
+
+    // PRIVATE TYPES
+    typedef typename bsl::remove_cv<VALUE>::type               NcType;
+
+    // DATA
+    BTree_LeafBase *d_leaf_p;  // leaf holding the current element, or the
+                               // sentinel for the 'end' position
+
+    int             d_index;   // index of the current element in the leaf
+
+    // FRIENDS
+    template <class VALUE1, class VALUE2, class LEAFTYPE, class DIFF>
+    friend bool operator==(const BTreeIterator<VALUE1, LEAFTYPE, DIFF>&,
+                           const BTreeIterator<VALUE2, LEAFTYPE, DIFF>&);
+
+    template <class OTHER_VALUE, class OTHER_LEAF, class OTHER_DIFFERENCE>
+    friend class BTreeIterator;
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::bidirectional_iterator_tag iterator_category;
+    typedef NcType                          value_type;
+    typedef DIFFERENCE_TYPE                 difference_type;
+    typedef VALUE*                          pointer;
+    typedef VALUE&                          reference;
+        // Standard iterator defined types [24.4.2].
+
+    // CREATORS
+    BTreeIterator();
+        // Create an iterator at no position in any tree.
+
+    BTreeIterator(const BTree_LeafBase *leaf, int index);
+        // Create an iterator at the specified 'index' in the specified 'leaf'.
+        // The behavior is undefined unless 'leaf' is of the (template
+        // parameter) type 'LEAF', or is the sentinel of a tree and 'index' is
+        // 0.  Note that this constructor is an implementation detail and is
+        // not part of the C++ standard.
+
+    template <class OTHER_VALUE>
+    BTreeIterator(
+           const BTreeIterator<OTHER_VALUE, LEAF, DIFFERENCE_TYPE>& original,
+           typename bsl::enable_if<bsl::is_same<OTHER_VALUE, NcType>::value
+                                && !bsl::is_same<OTHER_VALUE, VALUE>::value,
+                                   int>::type = 0);                 // IMPLICIT
+        // Create an iterator at the same position as the specified 'original'
+        // modifiable iterator.  Note that this constructor enables converting
+        // from modifiable to const iterator types, and, being a template that
+        // does not participate in overload resolution if 'VALUE' is not
+        // 'const', is never the copy constructor.
+
+    //! BTreeIterator(const BTreeIterator& original) = default;
+        // Create an iterator having the same value as the specified
+        // 'original'.
+
+    //! ~BTreeIterator() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+    //! BTreeIterator& operator=(const BTreeIterator& rhs) = default;
+        // Assign to this object the value of the specified 'rhs' object, and
+        // a return a reference providing modifiable access to this object.
+
+    BTreeIterator& operator++();
+        // Move this iterator to the next element in the tree and return a
+        // reference providing modifiable access to this iterator.  The
+        // behavior is undefined unless the iterator refers to an element in
+        // the tree.
+
+    BTreeIterator& operator--();
+        // Move this iterator to the previous element in the tree and return a
+        // reference providing modifiable access to this iterator.  The
+        // behavior is undefined unless the iterator refers to the past-the-end
+        // position or to an element other than the first in the tree.
+
+    // ACCESSORS
+    reference operator*() const;
+        // Return a reference to the element at which this iterator is
+        // positioned.  The behavior is undefined unless this iterator is at a
+        // valid position in the tree.
+
+    pointer operator->() const;
+        // Return the address of the element at which this iterator is
+        // positioned.  The behavior is undefined unless this iterator is at a
+        // valid position in the tree.
+
+    int index() const;
+        // Return the index, within its leaf, of the element at which this
+        // iterator is positioned.  Note that this method is an implementation
+        // detail and is not part of the C++ standard.
+
+    const BTree_LeafBase *leaf() const;
+        // Return the address of the leaf holding the element at which this
+        // iterator is positioned, the address of the sentinel of the tree if
+        // this iterator is at the past-the-end position, or 0 for a default
+        // constructed iterator.  Note that this method is an implementation
+        // detail and is not part of the C++ standard.
+};
+
+// FREE OPERATORS
+template <class VALUE1, class VALUE2, class LEAF, class DIFF>
+bool operator==(const BTreeIterator<VALUE1, LEAF, DIFF>& lhs,
+                const BTreeIterator<VALUE2, LEAF, DIFF>& rhs);
+    // Return 'true' if the specified 'lhs' and the specified 'rhs' iterators
+    // have the same value and 'false' otherwise.  Two iterators have the same
+    // value if they refer to the same position in the same tree, or if both
+    // are default constructed.
+
+template <class VALUE1, class VALUE2, class LEAF, class DIFF>
+bool operator!=(const BTreeIterator<VALUE1, LEAF, DIFF>& lhs,
+                const BTreeIterator<VALUE2, LEAF, DIFF>& rhs);
+    // Return 'true' if the specified 'lhs' and the specified 'rhs' iterators
+    // do not have the same value and 'false' otherwise.  Two iterators do not
+    // have the same value if they differ in either the tree to which they
+    // refer or the position in that tree.
+
+template <class VALUE, class LEAF, class DIFFERENCE_TYPE>
+BTreeIterator<VALUE, LEAF, DIFFERENCE_TYPE>
+operator++(BTreeIterator<VALUE, LEAF, DIFFERENCE_TYPE>& iter, int);
+    // Move the specified 'iter' to the next element in the tree and return the
+    // value of 'iter' prior to this call.  The behavior is undefined unless
+    // the iterator refers to an element in the tree.
+
+template <class VALUE, class LEAF, class DIFFERENCE_TYPE>
+BTreeIterator<VALUE, LEAF, DIFFERENCE_TYPE>
+operator--(BTreeIterator<VALUE, LEAF, DIFFERENCE_TYPE>& iter, int);
+    // Move the specified 'iter' to the previous element in the tree and
+    // return the value of 'iter' prior to this call.  The behavior is
+    // undefined unless the iterator refers to the past-the-end position or to
+    // an element other than the first in the tree.
+
+                                // ===========
+                                // class BTree
+                                // ===========
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+class BTree {
+    // This class template implements an ordered sequence of unique elements
+    // of the 'KEY_CONFIG::ValueType', ordered by their keys (of
+    // 'KEY_CONFIG::KeyType') as determined by the (template parameter)
+    // 'COMPARATOR', and held in the leaves of a B+tree whose nodes are
+    // allocated using the (template parameter) 'ALLOCATOR'.  See the component
+    // documentation for details of the structure of the tree.
+    //
+    // This class:
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+  public:
+    // PUBLIC TYPES
+    typedef typename KEY_CONFIG::ValueType                     ValueType;
+    typedef typename KEY_CONFIG::KeyType                       KeyType;
+    typedef typename bsl::remove_cv<KeyType>::type             StoredKey;
+        // The type of the separator keys held in inner nodes.
+
+    typedef bsl::allocator_traits<ALLOCATOR>                   AllocatorTraits;
+    typedef typename AllocatorTraits::size_type                SizeType;
+    typedef typename AllocatorTraits::difference_type          DifferenceType;
+
+    enum {
+        k_FLAT_KEYS     = bsl::is_arithmetic<StoredKey>::value,
+            // whether the keys of each node are held contiguously
+
+        k_FLAT_VALUES   = bsl::is_arithmetic<ValueType>::value,
+            // whether the elements of each leaf are held contiguously (in
+            // which case each element is its own key)
+
+        k_KEY_CACHE     = k_FLAT_KEYS && !k_FLAT_VALUES,
+            // whether each leaf holds a contiguous copy of the keys of its
+            // elements
+
+        k_LINEAR_SEARCH = k_FLAT_KEYS
+                       && bsl::is_same<COMPARATOR,
+                                       std::less<StoredKey> >::value,
+            // whether keys are located by a branch-free count of the keys
+            // ordered before them
+
+        k_LEAF_CAPACITY = BTree_Capacity<
+                                   sizeof(BTree_LeafBase),
+                                   sizeof(ValueType)
+                                   + (k_FLAT_VALUES ? 0 : 1)
+                                   + (k_KEY_CACHE ? sizeof(StoredKey) : 0),
+                                   4>::VALUE,
+            // maximum number of elements in a leaf
+
+        k_LEAF_MERGE_THRESHOLD = (k_LEAF_CAPACITY + 3) / 4,
+            // number of elements (a quarter of the capacity, rounded up)
+            // below which a leaf is merged, on removal, with an adjacent leaf
+            // if the elements of both fit in one leaf
+
+        k_INNER_CAPACITY = BTree_Capacity<
+                                  sizeof(BTree_NodeBase)
+                                  + sizeof(BTree_NodeBase *),
+                                  sizeof(StoredKey)
+                                  + (k_FLAT_KEYS ? 0 : 1)
+                                  + sizeof(BTree_NodeBase *),
+                                  3>::VALUE
+            // maximum number of keys in an inner node
+    };
+
+    typedef BTree_Leaf<ValueType,
+                       StoredKey,
+                       k_LEAF_CAPACITY,
+                       k_KEY_CACHE>                            Leaf;
+    typedef BTree_Inner<StoredKey, k_INNER_CAPACITY>           Inner;
+
+    typedef BTreeIterator<ValueType, Leaf, DifferenceType>     Iterator;
+    typedef BTreeIterator<const ValueType, Leaf, DifferenceType>
+                                                               ConstIterator;
+
+  private:
+    // PRIVATE TYPES
+    typedef typename AllocatorTraits::template
+                rebind_traits<bsls::AlignmentUtil::MaxAlignedType>
+                                                           NodeAllocatorTraits;
+    typedef typename NodeAllocatorTraits::allocator_type   NodeAllocator;
+        // Types used to allocate maximally-aligned memory for nodes.
+
+    typedef typename bslalg::FunctorAdapter<COMPARATOR>::Type ComparatorBase;
+
+    struct DataWrapper : public ComparatorBase {
+        // This struct is wrapper around the comparator and allocator data
+        // members.  It takes advantage of the empty-base optimization (EBO) so
+        // that if the comparator is stateless, it takes up no space.
+
+        ALLOCATOR d_allocator;  // allocator for elements and nodes
+
+        DataWrapper(const COMPARATOR& comparator,
+                    const ALLOCATOR&  basicAllocator);
+            // Create a 'DataWrapper' object with the specified 'comparator'
+            // and 'basicAllocator'.
+    };
+
+    template <class NODE>
+    class NodeProctor {
+        // This class implements a proctor that, unless its 'release' method
+        // has been called, destroys the contents of a node of the (template
+        // parameter) type 'NODE', and returns its memory to a tree.
+
+        // DATA
+        BTree *d_tree_p;  // tree supplying the memory of the node
+        NODE  *d_node_p;  // managed node, or 0 if released
+
+      private:
+        // NOT IMPLEMENTED
+        NodeProctor(const NodeProctor&);
+        NodeProctor& operator=(const NodeProctor&);
+
+      public:
+        // CREATORS
+        NodeProctor(BTree *tree, NODE *node);
+            // Create a proctor managing the specified 'node' of the specified
+            // 'tree'.
+
+        ~NodeProctor();
+            // Destroy the contents of the managed node, if any, and return its
+            // memory to the tree.
+
+        // MANIPULATORS
+        void release();
+            // Release from management the node managed by this proctor.
+    };
+
+    class InsertionProctor {
+        // This class implements a proctor that, unless its 'release' method
+        // has been called, removes the key and child most recently inserted
+        // into an inner node.
+
+        // DATA
+        Inner     *d_node_p;       // inner node, or 0 if released
+        int        d_position;     // index of the inserted key
+        ALLOCATOR *d_allocator_p;  // allocator used to destroy the key
+
+      private:
+        // NOT IMPLEMENTED
+        InsertionProctor(const InsertionProctor&);
+        InsertionProctor& operator=(const InsertionProctor&);
+
+      public:
+        // CREATORS
+        InsertionProctor(Inner *node, int position, ALLOCATOR *allocator);
+            // Create a proctor managing the key at the specified 'position' in
+            // the specified 'node', and the child following it, using the
+            // specified 'allocator' to destroy the key.
+
+        ~InsertionProctor();
+            // Remove the managed key and child, if any, from their node.
+
+        // MANIPULATORS
+        void release();
+            // Release from management the key and child managed by this
+            // proctor.
+    };
+
+    class RemoveAllProctor {
+        // This class implements a proctor that, unless its 'release' method
+        // has been called, removes all elements from a tree.
+
+        // DATA
+        BTree *d_tree_p;  // managed tree, or 0 if released
+
+      private:
+        // NOT IMPLEMENTED
+        RemoveAllProctor(const RemoveAllProctor&);
+        RemoveAllProctor& operator=(const RemoveAllProctor&);
+
+      public:
+        // CREATORS
+        explicit RemoveAllProctor(BTree *tree);
+            // Create a proctor managing the specified 'tree'.
+
+        ~RemoveAllProctor();
+            // Remove all elements from the managed tree, if any.
+
+        // MANIPULATORS
+        void release();
+            // Release from management the tree managed by this proctor.
+    };
+
+    // DATA
+    DataWrapper     d_data;      // comparator and allocator
+    BTree_NodeBase *d_root_p;    // root node, or 0 if the tree is empty
+    int             d_height;    // number of levels of inner nodes
+    SizeType        d_size;      // number of elements
+    BTree_LeafBase  d_sentinel;  // head of the circular list of leaves
+
+    // FRIENDS
+    template <class NODE>
+    friend class NodeProctor;
+
+    // PRIVATE CLASS METHODS
+    static const KeyType& keyOf(const Leaf *leaf, int index);
+        // Return a reference providing non-modifiable access to the key of
+        // the element at the specified 'index' in the specified 'leaf'.
+
+    template <class NODE>
+    static std::size_t nodeUnits();
+        // Return the number of maximally-aligned units of memory occupied by
+        // a node of the (template parameter) type 'NODE'.
+
+    // PRIVATE MANIPULATORS
+    template <class NODE>
+    NODE *allocateNode();
+        // Allocate and return a node of the (template parameter) type 'NODE'
+        // having no parent, and holding no keys or elements.
+
+    template <class NODE>
+    void deallocateNode(NODE *node);
+        // Return the memory of the specified 'node', which must hold no keys
+        // or elements, to the allocator of this tree.
+
+    void deleteNode(Leaf *leaf);
+    void deleteNode(Inner *node);
+        // Destroy the keys or elements held by the specified 'leaf' or
+        // 'node', and return its memory to the allocator of this tree.
+
+    void deleteSubtree(BTree_NodeBase *node, int height);
+        // Delete the specified 'node', the root of a subtree having the
+        // specified 'height' levels of inner nodes, and all of its
+        // descendants.
+
+    void linkLeafAfter(Leaf *leaf, BTree_LeafBase *position);
+        // Link the specified 'leaf' into the list of leaves of this tree
+        // immediately following the specified 'position'.
+
+    void mergeLeaf(Leaf *leaf, Iterator *position);
+        // Merge the specified 'leaf' with its preceding or, failing that, its
+        // following sibling (i.e., an adjacent leaf having the same parent),
+        // if the elements of both fit in one leaf, by moving the elements of
+        // the second leaf of the pair to the end of the first and removing
+        // the second leaf, and update the specified 'position' to refer to the
+        // same element as before.  If an exception is thrown moving the
+        // elements, this tree is unchanged.  The behavior is undefined unless
+        // 'leaf' holds at least one element.
+
+    Inner *prepareParent(BTree_NodeBase *node, bool isAppend);
+        // Return the parent of the specified 'node', first making room in it
+        // for an additional key and child, by splitting it if it is full, or
+        // by creating a new root if 'node' is the root.  If the specified
+        // 'isAppend' flag is 'true', 'node' lies on the rightmost path of this
+        // tree and a split leaves all but one key in the node being split.  If
+        // an exception is thrown, this tree holds the same sequence of
+        // elements.
+
+    Iterator insertAt(Leaf *leaf, int position, const ValueType& value);
+        // Insert a copy of the specified 'value' into the specified 'leaf' at
+        // the specified 'position', splitting 'leaf' if it is full, and return
+        // an iterator referring to the inserted element.  The behavior is
+        // undefined unless 'value' is ordered after the element at
+        // 'position - 1' and before the element at 'position' in 'leaf', and
+        // 'leaf' is a valid leaf for 'value'.
+
+    Iterator insertIntoEmpty(const ValueType& value);
+        // Insert a copy of the specified 'value' into this tree, which must be
+        // empty, and return an iterator referring to it.
+
+    template <class NODE>
+    void removeNode(NODE *node);
+        // Remove the specified 'node', which must hold no elements (if a leaf)
+        // or have no children (if an inner node), from its parent, removing
+        // the parent in turn if it is left without children, and free it.
+        // The behavior is undefined unless a leaf has been unlinked from the
+        // list of leaves.
+
+    void splitInner(Inner *node, bool isAppend);
+        // Split the specified 'node', which must be full, in two, adding the
+        // new node and the key separating the two nodes to the parent of
+        // 'node'.  If the specified 'isAppend' flag is 'true', leave all but
+        // one key in 'node'.  If an exception is thrown, this tree holds the
+        // same sequence of elements.
+
+    // PRIVATE ACCESSORS
+    bool checkSubtree(const BTree_NodeBase  *node,
+                      int                    height,
+                      const KeyType         *lowerBound,
+                      const KeyType         *upperBound,
+                      const BTree_LeafBase **nextLeaf,
+                      SizeType              *numElements) const;
+        // Return 'true' if the subtree rooted at the specified 'node', having
+        // the specified 'height' levels of inner nodes, is well formed, with
+        // all keys ordered after the specified 'lowerBound' (if not 0) and not
+        // ordered after the specified 'upperBound' (if not 0), and its leaves
+        // linked in order starting with the specified '*nextLeaf', and
+        // 'false' otherwise.  Load into '*nextLeaf' the leaf following the
+        // last leaf of the subtree, and add to the specified '*numElements'
+        // the number of elements in the subtree.
+
+    Leaf *findLeaf(int *position, const KeyType& key) const;
+        // Return the leaf in which the specified 'key' is or would be held,
+        // and load into the specified 'position' the number of elements in
+        // that leaf whose keys are ordered before 'key'.  The behavior is
+        // undefined unless this tree is not empty.
+
+    int innerPosition(const Inner *node, const KeyType& key) const;
+        // Return the number of keys in the specified 'node' that are ordered
+        // before the specified 'key'.
+
+    int leafPosition(const Leaf *leaf, const KeyType& key) const;
+        // Return the number of elements in the specified 'leaf' whose keys are
+        // ordered before the specified 'key'.
+
+    int leafPosition(const Leaf     *leaf,
+                     const KeyType&  key,
+                     bsl::true_type) const;
+    int leafPosition(const Leaf     *leaf,
+                     const KeyType&  key,
+                     bsl::false_type) const;
+        // Return the number of elements in the specified 'leaf' whose keys are
+        // ordered before the specified 'key', searching the contiguous keys of
+        // the leaf if the third argument is 'true_type', and extracting the
+        // key of each element probed otherwise.
+
+    int searchFlat(const StoredKey *keys, int count, const KeyType& key) const;
+        // Return the number of keys in the contiguous sorted array of the
+        // specified 'count' 'keys' that are ordered before the specified
+        // 'key'.
+
+    int searchFlat(const StoredKey *keys,
+                   int              count,
+                   const KeyType&   key,
+                   bsl::true_type) const;
+    int searchFlat(const StoredKey *keys,
+                   int              count,
+                   const KeyType&   key,
+                   bsl::false_type) const;
+        // Return the number of keys in the contiguous sorted array of the
+        // specified 'count' 'keys' that are ordered before the specified
+        // 'key', by a branch-free linear count if the fourth argument is
+        // 'true_type', and by binary search using the comparator otherwise.
+
+    int innerPosition(const Inner    *node,
+                      const KeyType&  key,
+                      bsl::false_type) const;
+    int innerPosition(const Inner    *node,
+                      const KeyType&  key,
+                      bsl::true_type) const;
+        // Return the number of keys in the specified 'node' that are ordered
+        // before the specified 'key', searching the contiguous keys of the
+        // node if the third argument is 'true_type'.
+
+  private:
+    // NOT IMPLEMENTED
+    BTree(const BTree&);
+    BTree& operator=(const BTree&);
+
+  public:
+    // CREATORS
+    explicit BTree(const ALLOCATOR& basicAllocator = ALLOCATOR());
+        // Create an empty tree using a default-constructed 'COMPARATOR' to
+        // order its elements.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.
+
+    BTree(const COMPARATOR& comparator, const ALLOCATOR& basicAllocator);
+        // Create an empty tree using the specified 'comparator' to order its
+        // elements, and the specified 'basicAllocator' to supply memory.
+
+    BTree(const BTree& original, const ALLOCATOR& basicAllocator);
+        // Create a tree holding copies of the elements of the specified
+        // 'original' tree, ordered by a copy of its comparator, and using the
+        // specified 'basicAllocator' to supply memory.  The leaves of the new
+        // tree are full, other than the last.
+
+    ~BTree();
+        // Destroy this object.
+
+    // MANIPULATORS
+    Iterator insertIfMissing(bool *isInsertedFlag, const ValueType& value);
+        // Insert a copy of the specified 'value' into this tree if its key is
+        // not already present, and return an iterator referring to the
+        // element having that key.  Load 'true' into the specified
+        // 'isInsertedFlag' if 'value' was inserted, and 'false' otherwise.
+
+    Iterator insertIfMissing(bool                 *isInsertedFlag,
+                             const ConstIterator&  hint,
+                             const ValueType&      value);
+        // Insert a copy of the specified 'value' into this tree if its key is
+        // not already present, and return an iterator referring to the
+        // element having that key.  Load 'true' into the specified
+        // 'isInsertedFlag' if 'value' was inserted, and 'false' otherwise.
+        // If the specified 'hint' is the position immediately following
+        // 'value' in this tree, and is either the past-the-end position, the
+        // first position, or not the first position in its leaf, 'value' is
+        // inserted without searching the tree.  The behavior is undefined
+        // unless 'hint' is a valid iterator into this tree.
+
+    void quickSwapExchangeAllocators(BTree *other);
+        // Exchange the elements, the comparator and the allocator of this
+        // object with those of the specified 'other' object.  This method
+        // provides the no-throw exception-safety guarantee.
+
+    void quickSwapRetainAllocators(BTree *other);
+        // Exchange the elements and the comparator of this object with those
+        // of the specified 'other' object.  This method provides the no-throw
+        // exception-safety guarantee.  The behavior is undefined unless this
+        // object was created with the same allocator as 'other'.
+
+    Iterator remove(const ConstIterator& position);
+        // Remove from this tree the element at the specified 'position', and
+        // return an iterator referring to the element that followed it, or
+        // the past-the-end position if it was the last element.  The behavior
+        // is undefined unless 'position' refers to an element in this tree.
+
+    void removeAll();
+        // Remove all elements from this tree, and free all of its nodes.
+
+    // ACCESSORS
+    ALLOCATOR allocator() const;
+        // Return (a copy of) the allocator used by this tree.
+
+    Iterator begin() const;
+        // Return an iterator referring to the first element of this tree, or
+        // the past-the-end position if this tree is empty.
+
+    const COMPARATOR& comparator() const;
+        // Return a reference providing non-modifiable access to the comparator
+        // used to order the elements of this tree.
+
+    Iterator end() const;
+        // Return an iterator referring to the past-the-end position of this
+        // tree.
+
+    Iterator find(const KeyType& key) const;
+        // Return an iterator referring to the element of this tree having the
+        // specified 'key', or the past-the-end position if there is none.
+
+    int height() const;
+        // Return the number of levels of inner nodes in this tree.  Note that
+        // an empty tree, and a tree held in a single leaf, have height 0.
+
+    bool isWellFormed() const;
+        // Return 'true' if this tree satisfies the invariants of its
+        // structure, and 'false' otherwise.  Note that this method is
+        // intended for use by test drivers, and has linear complexity.
+
+    Iterator lowerBound(const KeyType& key) const;
+        // Return an iterator referring to the first element of this tree
+        // whose key is not ordered before the specified 'key', or the
+        // past-the-end position if there is none.
+
+    SizeType maxSize() const;
+        // Return a theoretical upper bound on the number of elements this
+        // tree could hold.
+
+    SizeType size() const;
+        // Return the number of elements in this tree.
+
+    Iterator upperBound(const KeyType& key) const;
+        // Return an iterator referring to the first element of this tree
+        // whose key is ordered after the specified 'key', or the past-the-end
+        // position if there is none.
+};
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                             // -----------------
+                             // class BTree_Array
+                             // -----------------
+
+// MANIPULATORS
+template <class TYPE, int CAPACITY>
+template <class ALLOCATOR>
+inline
+void BTree_Array<TYPE, CAPACITY, true>::insert(int         position,
+                                               int         count,
+                                               const TYPE& value,
+                                               ALLOCATOR&)
+{
+    BSLS_ASSERT_SAFE(0 <= position);
+    BSLS_ASSERT_SAFE(position <= count);
+    BSLS_ASSERT_SAFE(count < CAPACITY);
+
+    std::memmove(d_data + position + 1,
+                 d_data + position,
+                 (count - position) * sizeof(TYPE));
+    d_data[position] = value;
+}
+
+template <class TYPE, int CAPACITY>
+template <class ALLOCATOR>
+inline
+void BTree_Array<TYPE, CAPACITY, true>::erase(int position,
+                                              int count,
+                                              ALLOCATOR&)
+{
+    BSLS_ASSERT_SAFE(0 <= position);
+    BSLS_ASSERT_SAFE(position < count);
+
+    std::memmove(d_data + position,
+                 d_data + position + 1,
+                 (count - position - 1) * sizeof(TYPE));
+}
+
+template <class TYPE, int CAPACITY>
+template <class ALLOCATOR>
+inline
+void BTree_Array<TYPE, CAPACITY, true>::moveTail(BTree_Array *destination,
+                                                 int          position,
+                                                 int          count,
+                                                 ALLOCATOR&)
+{
+    BSLS_ASSERT_SAFE(destination);
+    BSLS_ASSERT_SAFE(0 <= position);
+    BSLS_ASSERT_SAFE(position <= count);
+
+    std::memcpy(destination->d_data,
+                d_data + position,
+                (count - position) * sizeof(TYPE));
+}
+
+template <class TYPE, int CAPACITY>
+template <class ALLOCATOR>
+inline
+void BTree_Array<TYPE, CAPACITY, true>::moveAll(
+                                                BTree_Array *destination,
+                                                int          count,
+                                                int          destinationCount,
+                                                ALLOCATOR&)
+{
+    BSLS_ASSERT_SAFE(destination);
+    BSLS_ASSERT_SAFE(0 <= count);
+    BSLS_ASSERT_SAFE(0 <= destinationCount);
+    BSLS_ASSERT_SAFE(destinationCount <= CAPACITY - count);
+
+    std::memcpy(destination->d_data + destinationCount,
+                d_data,
+                count * sizeof(TYPE));
+}
+
+template <class TYPE, int CAPACITY>
+template <class ALLOCATOR>
+inline
+void BTree_Array<TYPE, CAPACITY, true>::destroyAll(int, ALLOCATOR&)
+{
+}
+
+template <class TYPE, int CAPACITY>
+inline
+TYPE& BTree_Array<TYPE, CAPACITY, true>::operator[](int index)
+{
+    return d_data[index];
+}
+
+// ACCESSORS
+template <class TYPE, int CAPACITY>
+inline
+const TYPE& BTree_Array<TYPE, CAPACITY, true>::operator[](int index) const
+{
+    return d_data[index];
+}
+
+template <class TYPE, int CAPACITY>
+inline
+const TYPE *BTree_Array<TYPE, CAPACITY, true>::data() const
+{
+    return d_data;
+}
+
+// PRIVATE MANIPULATORS
+template <class TYPE, int CAPACITY>
+inline
+TYPE *BTree_Array<TYPE, CAPACITY, false>::slotAddress(int slot)
+{
+    return bsls::Util::addressOf(d_slots[slot].object());
+}
+
+// CREATORS
+template <class TYPE, int CAPACITY>
+inline
+BTree_Array<TYPE, CAPACITY, false>::BTree_Array()
+{
+    for (int i = 0; i < CAPACITY; ++i) {
+        d_order[i] = static_cast<unsigned char>(i);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE, int CAPACITY>
+template <class ALLOCATOR>
+inline
+void BTree_Array<TYPE, CAPACITY, false>::insert(int         position,
+                                                int         count,
+                                                const TYPE& value,
+                                                ALLOCATOR&  allocator)
+{
+    BSLS_ASSERT_SAFE(0 <= position);
+    BSLS_ASSERT_SAFE(position <= count);
+    BSLS_ASSERT_SAFE(count < CAPACITY);
+
+    // Construct the new object in the first unoccupied slot before changing
+    // the order, so that this array is unchanged if the copy throws.
+
+    const unsigned char slot = d_order[count];
+    bsl::allocator_traits<ALLOCATOR>::construct(allocator,
+                                                slotAddress(slot),
+                                                value);
+    std::memmove(d_order + position + 1, d_order + position, count - position);
+    d_order[position] = slot;
+}
+
+template <class TYPE, int CAPACITY>
+template <class ALLOCATOR>
+inline
+void BTree_Array<TYPE, CAPACITY, false>::erase(int        position,
+                                               int        count,
+                                               ALLOCATOR& allocator)
+{
+    BSLS_ASSERT_SAFE(0 <= position);
+    BSLS_ASSERT_SAFE(position < count);
+
+    const unsigned char slot = d_order[position];
+    bsl::allocator_traits<ALLOCATOR>::destroy(allocator, slotAddress(slot));
+    std::memmove(d_order + position,
+                 d_order + position + 1,
+                 count - position - 1);
+    d_order[count - 1] = slot;
+}
+
+template <class TYPE, int CAPACITY>
+template <class ALLOCATOR>
+void BTree_Array<TYPE, CAPACITY, false>::moveTail(BTree_Array *destination,
+                                                  int          position,
+                                                  int          count,
+                                                  ALLOCATOR&   allocator)
+{
+    BSLS_ASSERT_SAFE(destination);
+    BSLS_ASSERT_SAFE(0 <= position);
+    BSLS_ASSERT_SAFE(position <= count);
+
+    // The slots of the transferred objects remain listed, in 'd_order',
+    // following the objects that are retained, and so become unoccupied.
+
+    if (bslmf::IsBitwiseMoveable<TYPE>::value) {
+        for (int i = position; i < count; ++i) {
+            std::memcpy(
+                     static_cast<void *>(destination->slotAddress(
+                                        destination->d_order[i - position])),
+                     slotAddress(d_order[i]),
+                     sizeof(TYPE));
+        }
+        return;                                                       // RETURN
+    }
+
+    BTree_ArrayProctor<BTree_Array, ALLOCATOR> proctor(destination,
+                                                       0,
+                                                       &allocator);
+    for (int i = position; i < count; ++i) {
+        bsl::allocator_traits<ALLOCATOR>::construct(
+                             allocator,
+                             destination->slotAddress(
+                                         destination->d_order[i - position]),
+                             (*this)[i]);
+        proctor.increment();
+    }
+    proctor.release();
+
+    for (int i = position; i < count; ++i) {
+        bsl::allocator_traits<ALLOCATOR>::destroy(allocator,
+                                                  slotAddress(d_order[i]));
+    }
+}
+
+template <class TYPE, int CAPACITY>
+template <class ALLOCATOR>
+void BTree_Array<TYPE, CAPACITY, false>::moveAll(
+                                                BTree_Array *destination,
+                                                int          count,
+                                                int          destinationCount,
+                                                ALLOCATOR&   allocator)
+{
+    BSLS_ASSERT_SAFE(destination);
+    BSLS_ASSERT_SAFE(0 <= count);
+    BSLS_ASSERT_SAFE(0 <= destinationCount);
+    BSLS_ASSERT_SAFE(destinationCount <= CAPACITY - count);
+
+    // The objects are constructed in the unoccupied slots listed, in the
+    // 'd_order' of 'destination', following its objects.
+
+    unsigned char *order = destination->d_order + destinationCount;
+
+    if (bslmf::IsBitwiseMoveable<TYPE>::value) {
+        for (int i = 0; i < count; ++i) {
+            std::memcpy(static_cast<void *>(
+                                       destination->slotAddress(order[i])),
+                        slotAddress(d_order[i]),
+                        sizeof(TYPE));
+        }
+        return;                                                       // RETURN
+    }
+
+    BTree_ArrayProctor<BTree_Array, ALLOCATOR> proctor(destination,
+                                                       destinationCount,
+                                                       &allocator);
+    for (int i = 0; i < count; ++i) {
+        bsl::allocator_traits<ALLOCATOR>::construct(
+                                         allocator,
+                                         destination->slotAddress(order[i]),
+                                         (*this)[i]);
+        proctor.increment();
+    }
+    proctor.release();
+
+    destroyAll(count, allocator);
+}
+
+template <class TYPE, int CAPACITY>
+template <class ALLOCATOR>
+inline
+void BTree_Array<TYPE, CAPACITY, false>::destroyAll(int        count,
+                                                    ALLOCATOR& allocator)
+{
+    for (int i = 0; i < count; ++i) {
+        bsl::allocator_traits<ALLOCATOR>::destroy(allocator,
+                                                  slotAddress(d_order[i]));
+    }
+}
+
+template <class TYPE, int CAPACITY>
+inline
+TYPE& BTree_Array<TYPE, CAPACITY, false>::operator[](int index)
+{
+    return d_slots[d_order[index]].object();
+}
+
+// ACCESSORS
+template <class TYPE, int CAPACITY>
+inline
+const TYPE& BTree_Array<TYPE, CAPACITY, false>::operator[](int index) const
+{
+    return d_slots[d_order[index]].object();
+}
+
+                          // ------------------------
+                          // class BTree_ArrayProctor
+                          // ------------------------
+
+// CREATORS
+template <class ARRAY, class ALLOCATOR>
+inline
+BTree_ArrayProctor<ARRAY, ALLOCATOR>::BTree_ArrayProctor(ARRAY     *array,
+                                                         int        first,
+                                                         ALLOCATOR *allocator)
+: d_array_p(array)
+, d_first(first)
+, d_count(0)
+, d_allocator_p(allocator)
+{
+}
+
+template <class ARRAY, class ALLOCATOR>
+inline
+BTree_ArrayProctor<ARRAY, ALLOCATOR>::~BTree_ArrayProctor()
+{
+    if (d_array_p) {
+        for (int i = d_first; i < d_first + d_count; ++i) {
+            bsl::allocator_traits<ALLOCATOR>::destroy(
+                                     *d_allocator_p,
+                                     bsls::Util::addressOf((*d_array_p)[i]));
+        }
+    }
+}
+
+// MANIPULATORS
+template <class ARRAY, class ALLOCATOR>
+inline
+void BTree_ArrayProctor<ARRAY, ALLOCATOR>::increment()
+{
+    ++d_count;
+}
+
+template <class ARRAY, class ALLOCATOR>
+inline
+void BTree_ArrayProctor<ARRAY, ALLOCATOR>::release()
+{
+    d_array_p = 0;
+}
+
+                             // ----------------
+                             // class BTree_Leaf
+                             // ----------------
+
+// MANIPULATORS
+template <class VALUE, class KEY, int CAPACITY, bool HAS_KEY_CACHE>
+template <class ALLOCATOR>
+inline
+void BTree_Leaf<VALUE, KEY, CAPACITY, HAS_KEY_CACHE>::insert(
+                                                   int           position,
+                                                   const VALUE&  value,
+                                                   const KEY&    key,
+                                                   ALLOCATOR&    allocator)
+{
+    d_values.insert(position, d_count, value, allocator);
+    d_keys.insert(position, d_count, key, allocator);
+    ++d_count;
+}
+
+template <class VALUE, class KEY, int CAPACITY, bool HAS_KEY_CACHE>
+template <class ALLOCATOR>
+inline
+void BTree_Leaf<VALUE, KEY, CAPACITY, HAS_KEY_CACHE>::erase(
+                                                       int        position,
+                                                       ALLOCATOR& allocator)
+{
+    d_values.erase(position, d_count, allocator);
+    d_keys.erase(position, d_count, allocator);
+    --d_count;
+}
+
+template <class VALUE, class KEY, int CAPACITY, bool HAS_KEY_CACHE>
+template <class ALLOCATOR>
+inline
+void BTree_Leaf<VALUE, KEY, CAPACITY, HAS_KEY_CACHE>::moveTail(
+                                                   BTree_Leaf *destination,
+                                                   int         position,
+                                                   ALLOCATOR&  allocator)
+{
+    BSLS_ASSERT_SAFE(destination);
+    BSLS_ASSERT_SAFE(0 == destination->d_count);
+
+    d_values.moveTail(&destination->d_values, position, d_count, allocator);
+    d_keys.moveTail(&destination->d_keys, position, d_count, allocator);
+    destination->d_count = d_count - position;
+    d_count              = position;
+}
+
+template <class VALUE, class KEY, int CAPACITY, bool HAS_KEY_CACHE>
+template <class ALLOCATOR>
+inline
+void BTree_Leaf<VALUE, KEY, CAPACITY, HAS_KEY_CACHE>::moveAll(
+                                                   BTree_Leaf *destination,
+                                                   ALLOCATOR&  allocator)
+{
+    BSLS_ASSERT_SAFE(destination);
+
+    d_values.moveAll(&destination->d_values,
+                     d_count,
+                     destination->d_count,
+                     allocator);
+    d_keys.moveAll(&destination->d_keys,
+                   d_count,
+                   destination->d_count,
+                   allocator);
+    destination->d_count += d_count;
+    d_count               = 0;
+}
+
+template <class VALUE, class KEY, int CAPACITY, bool HAS_KEY_CACHE>
+template <class ALLOCATOR>
+inline
+void BTree_Leaf<VALUE, KEY, CAPACITY, HAS_KEY_CACHE>::destroyAll(
+                                                          ALLOCATOR& allocator)
+{
+    d_values.destroyAll(d_count, allocator);
+    d_count = 0;
+}
+
+template <class VALUE, class KEY, int CAPACITY, bool HAS_KEY_CACHE>
+inline
+VALUE& BTree_Leaf<VALUE, KEY, CAPACITY, HAS_KEY_CACHE>::value(int index)
+{
+    return d_values[index];
+}
+
+// ACCESSORS
+template <class VALUE, class KEY, int CAPACITY, bool HAS_KEY_CACHE>
+inline
+const KEY *BTree_Leaf<VALUE, KEY, CAPACITY, HAS_KEY_CACHE>::keys() const
+{
+    return d_keys.data();
+}
+
+template <class VALUE, class KEY, int CAPACITY, bool HAS_KEY_CACHE>
+inline
+const VALUE&
+BTree_Leaf<VALUE, KEY, CAPACITY, HAS_KEY_CACHE>::value(int index) const
+{
+    return d_values[index];
+}
+
+// MANIPULATORS
+template <class VALUE, class KEY, int CAPACITY>
+template <class ALLOCATOR>
+inline
+void BTree_Leaf<VALUE, KEY, CAPACITY, false>::insert(int           position,
+                                                     const VALUE&  value,
+                                                     const KEY&,
+                                                     ALLOCATOR&    allocator)
+{
+    d_values.insert(position, d_count, value, allocator);
+    ++d_count;
+}
+
+template <class VALUE, class KEY, int CAPACITY>
+template <class ALLOCATOR>
+inline
+void BTree_Leaf<VALUE, KEY, CAPACITY, false>::erase(int        position,
+                                                    ALLOCATOR& allocator)
+{
+    d_values.erase(position, d_count, allocator);
+    --d_count;
+}
+
+template <class VALUE, class KEY, int CAPACITY>
+template <class ALLOCATOR>
+inline
+void BTree_Leaf<VALUE, KEY, CAPACITY, false>::moveTail(
+                                                   BTree_Leaf *destination,
+                                                   int         position,
+                                                   ALLOCATOR&  allocator)
+{
+    BSLS_ASSERT_SAFE(destination);
+    BSLS_ASSERT_SAFE(0 == destination->d_count);
+
+    d_values.moveTail(&destination->d_values, position, d_count, allocator);
+    destination->d_count = d_count - position;
+    d_count              = position;
+}
+
+template <class VALUE, class KEY, int CAPACITY>
+template <class ALLOCATOR>
+inline
+void BTree_Leaf<VALUE, KEY, CAPACITY, false>::moveAll(
+                                                   BTree_Leaf *destination,
+                                                   ALLOCATOR&  allocator)
+{
+    BSLS_ASSERT_SAFE(destination);
+
+    d_values.moveAll(&destination->d_values,
+                     d_count,
+                     destination->d_count,
+                     allocator);
+    destination->d_count += d_count;
+    d_count               = 0;
+}
+
+template <class VALUE, class KEY, int CAPACITY>
+template <class ALLOCATOR>
+inline
+void BTree_Leaf<VALUE, KEY, CAPACITY, false>::destroyAll(ALLOCATOR& allocator)
+{
+    d_values.destroyAll(d_count, allocator);
+    d_count = 0;
+}
+
+template <class VALUE, class KEY, int CAPACITY>
+inline
+VALUE& BTree_Leaf<VALUE, KEY, CAPACITY, false>::value(int index)
+{
+    return d_values[index];
+}
+
+// ACCESSORS
+template <class VALUE, class KEY, int CAPACITY>
+inline
+const VALUE *BTree_Leaf<VALUE, KEY, CAPACITY, false>::keys() const
+{
+    return d_values.data();
+}
+
+template <class VALUE, class KEY, int CAPACITY>
+inline
+const VALUE& BTree_Leaf<VALUE, KEY, CAPACITY, false>::value(int index) const
+{
+    return d_values[index];
+}
+
+                             // -----------------
+                             // class BTree_Inner
+                             // -----------------
+
+// MANIPULATORS
+template <class KEY, int CAPACITY>
+template <class ALLOCATOR>
+inline
+void BTree_Inner<KEY, CAPACITY>::insert(int              position,
+                                        const KEY&       key,
+                                        BTree_NodeBase  *child,
+                                        ALLOCATOR&       allocator)
+{
+    BSLS_ASSERT_SAFE(child);
+
+    d_keys.insert(position, d_count, key, allocator);
+    std::memmove(d_children + position + 2,
+                 d_children + position + 1,
+                 (d_count - position) * sizeof(BTree_NodeBase *));
+    d_children[position + 1] = child;
+    child->d_parent_p        = this;
+    ++d_count;
+}
+
+template <class KEY, int CAPACITY>
+template <class ALLOCATOR>
+inline
+void BTree_Inner<KEY, CAPACITY>::erase(int        keyPosition,
+                                       int        childPosition,
+                                       ALLOCATOR& allocator)
+{
+    BSLS_ASSERT_SAFE(0 <= keyPosition);
+    BSLS_ASSERT_SAFE(keyPosition < d_count);
+    BSLS_ASSERT_SAFE(0 <= childPosition);
+    BSLS_ASSERT_SAFE(childPosition <= d_count);
+
+    d_keys.erase(keyPosition, d_count, allocator);
+    std::memmove(d_children + childPosition,
+                 d_children + childPosition + 1,
+                 (d_count - childPosition) * sizeof(BTree_NodeBase *));
+    --d_count;
+}
+
+template <class KEY, int CAPACITY>
+template <class ALLOCATOR>
+void BTree_Inner<KEY, CAPACITY>::moveTail(BTree_Inner *destination,
+                                          int          position,
+                                          ALLOCATOR&   allocator)
+{
+    BSLS_ASSERT_SAFE(destination);
+    BSLS_ASSERT_SAFE(0 == destination->d_count);
+    BSLS_ASSERT_SAFE(0 <= position);
+    BSLS_ASSERT_SAFE(position < d_count);
+
+    d_keys.moveTail(&destination->d_keys, position + 1, d_count, allocator);
+
+    const int numChildren = d_count - position;
+    for (int i = 0; i < numChildren; ++i) {
+        BTree_NodeBase *child       = d_children[position + 1 + i];
+        destination->d_children[i]  = child;
+        child->d_parent_p           = destination;
+    }
+    destination->d_count = numChildren - 1;
+
+    d_keys.erase(position, position + 1, allocator);
+    d_count = position;
+}
+
+template <class KEY, int CAPACITY>
+template <class ALLOCATOR>
+inline
+void BTree_Inner<KEY, CAPACITY>::destroyAll(ALLOCATOR& allocator)
+{
+    d_keys.destroyAll(d_count, allocator);
+    d_count = 0;
+}
+
+template <class KEY, int CAPACITY>
+inline
+void BTree_Inner<KEY, CAPACITY>::setOnlyChild(BTree_NodeBase *child)
+{
+    BSLS_ASSERT_SAFE(0 == d_count);
+    BSLS_ASSERT_SAFE(child);
+
+    d_children[0]     = child;
+    child->d_parent_p = this;
+}
+
+// ACCESSORS
+template <class KEY, int CAPACITY>
+inline
+BTree_NodeBase *BTree_Inner<KEY, CAPACITY>::child(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index <= d_count);
+
+    return d_children[index];
+}
+
+template <class KEY, int CAPACITY>
+inline
+int BTree_Inner<KEY, CAPACITY>::childIndex(const BTree_NodeBase *child) const
+{
+    int index = 0;
+    while (d_children[index] != child) {
+        BSLS_ASSERT_SAFE(index < d_count);
+
+        ++index;
+    }
+    return index;
+}
+
+template <class KEY, int CAPACITY>
+inline
+const KEY& BTree_Inner<KEY, CAPACITY>::key(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < d_count);
+
+    return d_keys[index];
+}
+
+template <class KEY, int CAPACITY>
+inline
+const KEY *BTree_Inner<KEY, CAPACITY>::keys() const
+{
+    return d_keys.data();
+}
+
+                            // -------------------
+                            // class BTreeIterator
+                            // -------------------
+
+// CREATORS
+template <class VALUE, class LEAF, class DIFFERENCE_TYPE>
+inline
+BTreeIterator<VALUE, LEAF, DIFFERENCE_TYPE>::BTreeIterator()
+: d_leaf_p(0)
+, d_index(0)
+{
+}
+
+template <class VALUE, class LEAF, class DIFFERENCE_TYPE>
+inline
+BTreeIterator<VALUE, LEAF, DIFFERENCE_TYPE>::BTreeIterator(
+                                                   const BTree_LeafBase *leaf,
+                                                   int                   index)
+: d_leaf_p(const_cast<BTree_LeafBase *>(leaf))
+, d_index(index)
+{
+}
+
+template <class VALUE, class LEAF, class DIFFERENCE_TYPE>
+template <class OTHER_VALUE>
+inline
+BTreeIterator<VALUE, LEAF, DIFFERENCE_TYPE>::BTreeIterator(
+           const BTreeIterator<OTHER_VALUE, LEAF, DIFFERENCE_TYPE>& original,
+           typename bsl::enable_if<bsl::is_same<OTHER_VALUE, NcType>::value
+                                && !bsl::is_same<OTHER_VALUE, VALUE>::value,
+                                   int>::type)
+: d_leaf_p(original.d_leaf_p)
+, d_index(original.d_index)
+{
+}
+
+// MANIPULATORS
+template <class VALUE, class LEAF, class DIFFERENCE_TYPE>
+inline
+BTreeIterator<VALUE, LEAF, DIFFERENCE_TYPE>&
+BTreeIterator<VALUE, LEAF, DIFFERENCE_TYPE>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_leaf_p);
+    BSLS_ASSERT_SAFE(d_index < d_leaf_p->d_count);
+
+    if (++d_index == d_leaf_p->d_count) {
+        d_leaf_p = d_leaf_p->d_next_p;
+        d_index  = 0;
+    }
+    return *this;
+}
+
+template <class VALUE, class LEAF, class DIFFERENCE_TYPE>
+inline
+BTreeIterator<VALUE, LEAF, DIFFERENCE_TYPE>&
+BTreeIterator<VALUE, LEAF, DIFFERENCE_TYPE>::operator--()
+{
+    BSLS_ASSERT_SAFE(d_leaf_p);
+
+    if (0 == d_index) {
+        d_leaf_p = d_leaf_p->d_prev_p;
+        d_index  = d_leaf_p->d_count;
+
+        BSLS_ASSERT_SAFE(0 < d_index);
+    }
+    --d_index;
+    return *this;
+}
+
+// ACCESSORS
+template <class VALUE, class LEAF, class DIFFERENCE_TYPE>
+inline
+typename BTreeIterator<VALUE, LEAF, DIFFERENCE_TYPE>::reference
+BTreeIterator<VALUE, LEAF, DIFFERENCE_TYPE>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_leaf_p);
+    BSLS_ASSERT_SAFE(d_index < d_leaf_p->d_count);
+
+    return static_cast<LEAF *>(d_leaf_p)->value(d_index);
+}
+
+template <class VALUE, class LEAF, class DIFFERENCE_TYPE>
+inline
+typename BTreeIterator<VALUE, LEAF, DIFFERENCE_TYPE>::pointer
+BTreeIterator<VALUE, LEAF, DIFFERENCE_TYPE>::operator->() const
+{
+    BSLS_ASSERT_SAFE(d_leaf_p);
+    BSLS_ASSERT_SAFE(d_index < d_leaf_p->d_count);
+
+    return bsls::Util::addressOf(
+                              static_cast<LEAF *>(d_leaf_p)->value(d_index));
+}
+
+template <class VALUE, class LEAF, class DIFFERENCE_TYPE>
+inline
+int BTreeIterator<VALUE, LEAF, DIFFERENCE_TYPE>::index() const
+{
+    return d_index;
+}
+
+template <class VALUE, class LEAF, class DIFFERENCE_TYPE>
+inline
+const BTree_LeafBase *BTreeIterator<VALUE, LEAF, DIFFERENCE_TYPE>::leaf() const
+{
+    return d_leaf_p;
+}
+
+// FREE OPERATORS
+template <class VALUE1, class VALUE2, class LEAF, class DIFF>
+inline
+bool operator==(const BTreeIterator<VALUE1, LEAF, DIFF>& lhs,
+                const BTreeIterator<VALUE2, LEAF, DIFF>& rhs)
+{
+    return lhs.d_leaf_p == rhs.d_leaf_p && lhs.d_index == rhs.d_index;
+}
+
+template <class VALUE1, class VALUE2, class LEAF, class DIFF>
+inline
+bool operator!=(const BTreeIterator<VALUE1, LEAF, DIFF>& lhs,
+                const BTreeIterator<VALUE2, LEAF, DIFF>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class VALUE, class LEAF, class DIFFERENCE_TYPE>
+inline
+BTreeIterator<VALUE, LEAF, DIFFERENCE_TYPE>
+operator++(BTreeIterator<VALUE, LEAF, DIFFERENCE_TYPE>& iter, int)
+{
+    BTreeIterator<VALUE, LEAF, DIFFERENCE_TYPE> temp = iter;
+    ++iter;
+    return temp;
+}
+
+template <class VALUE, class LEAF, class DIFFERENCE_TYPE>
+inline
+BTreeIterator<VALUE, LEAF, DIFFERENCE_TYPE>
+operator--(BTreeIterator<VALUE, LEAF, DIFFERENCE_TYPE>& iter, int)
+{
+    BTreeIterator<VALUE, LEAF, DIFFERENCE_TYPE> temp = iter;
+    --iter;
+    return temp;
+}
+
+                         // ------------------------
+                         // class BTree::DataWrapper
+                         // ------------------------
+
+// CREATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::DataWrapper::DataWrapper(
+                                              const COMPARATOR& comparator,
+                                              const ALLOCATOR&  basicAllocator)
+: ComparatorBase(comparator)
+, d_allocator(basicAllocator)
+{
+}
+
+                         // ------------------------
+                         // class BTree::NodeProctor
+                         // ------------------------
+
+// CREATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class NODE>
+inline
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::NodeProctor<NODE>::NodeProctor(
+                                                                BTree *tree,
+                                                                NODE  *node)
+: d_tree_p(tree)
+, d_node_p(node)
+{
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class NODE>
+inline
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::NodeProctor<NODE>::~NodeProctor()
+{
+    if (d_node_p) {
+        d_tree_p->deleteNode(d_node_p);
+    }
+}
+
+// MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class NODE>
+inline
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::NodeProctor<NODE>::release()
+{
+    d_node_p = 0;
+}
+
+                       // -----------------------------
+                       // class BTree::InsertionProctor
+                       // -----------------------------
+
+// CREATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::InsertionProctor::InsertionProctor(
+                                                        Inner     *node,
+                                                        int        position,
+                                                        ALLOCATOR *allocator)
+: d_node_p(node)
+, d_position(position)
+, d_allocator_p(allocator)
+{
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::InsertionProctor::~InsertionProctor()
+{
+    if (d_node_p) {
+        d_node_p->erase(d_position, d_position + 1, *d_allocator_p);
+    }
+}
+
+// MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::InsertionProctor::release()
+{
+    d_node_p = 0;
+}
+
+                       // -----------------------------
+                       // class BTree::RemoveAllProctor
+                       // -----------------------------
+
+// CREATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::RemoveAllProctor::RemoveAllProctor(
+                                                                   BTree *tree)
+: d_tree_p(tree)
+{
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::RemoveAllProctor::~RemoveAllProctor()
+{
+    if (d_tree_p) {
+        d_tree_p->removeAll();
+    }
+}
+
+// MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::RemoveAllProctor::release()
+{
+    d_tree_p = 0;
+}
+
+                                // -----------
+                                // class BTree
+                                // -----------
+
+// PRIVATE CLASS METHODS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+const typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::KeyType&
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::keyOf(const Leaf *leaf, int index)
+{
+    return KEY_CONFIG::extractKey(leaf->value(index));
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class NODE>
+inline
+std::size_t BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::nodeUnits()
+{
+    return (sizeof(NODE) + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
+         / bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class NODE>
+inline
+NODE *BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::allocateNode()
+{
+    NodeAllocator nodeAllocator(d_data.d_allocator);
+    NODE *node = new (static_cast<void *>(
+                     NodeAllocatorTraits::allocate(nodeAllocator,
+                                                   nodeUnits<NODE>()))) NODE;
+    node->d_parent_p = 0;
+    node->d_count    = 0;
+    return node;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class NODE>
+inline
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::deallocateNode(NODE *node)
+{
+    BSLS_ASSERT_SAFE(node);
+    BSLS_ASSERT_SAFE(0 == node->d_count);
+
+    // Nodes are trivially destructible once their keys or elements have been
+    // destroyed.
+
+    NodeAllocator nodeAllocator(d_data.d_allocator);
+    NodeAllocatorTraits::deallocate(
+                nodeAllocator,
+                reinterpret_cast<bsls::AlignmentUtil::MaxAlignedType *>(node),
+                nodeUnits<NODE>());
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::deleteNode(Leaf *leaf)
+{
+    leaf->destroyAll(d_data.d_allocator);
+    deallocateNode(leaf);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::deleteNode(Inner *node)
+{
+    node->destroyAll(d_data.d_allocator);
+    deallocateNode(node);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::deleteSubtree(
+                                                      BTree_NodeBase *node,
+                                                      int             height)
+{
+    if (0 == height) {
+        deleteNode(static_cast<Leaf *>(node));
+        return;                                                       // RETURN
+    }
+
+    Inner *inner = static_cast<Inner *>(node);
+    for (int i = 0; i <= inner->d_count; ++i) {
+        deleteSubtree(inner->child(i), height - 1);
+    }
+    deleteNode(inner);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::linkLeafAfter(
+                                                    Leaf           *leaf,
+                                                    BTree_LeafBase *position)
+{
+    leaf->d_prev_p               = position;
+    leaf->d_next_p               = position->d_next_p;
+    position->d_next_p->d_prev_p = leaf;
+    position->d_next_p           = leaf;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::mergeLeaf(Leaf     *leaf,
+                                                         Iterator *position)
+{
+    BSLS_ASSERT_SAFE(leaf);
+    BSLS_ASSERT_SAFE(0 < leaf->d_count);
+    BSLS_ASSERT_SAFE(position);
+
+    Inner *parent = static_cast<Inner *>(leaf->d_parent_p);
+    if (0 == parent) {
+        return;                                                       // RETURN
+    }
+
+    const int childPosition = parent->childIndex(leaf);
+
+    Leaf *left  = 0;
+    Leaf *right = 0;
+    if (0 < childPosition) {
+        Leaf *sibling = static_cast<Leaf *>(parent->child(childPosition - 1));
+        if (sibling->d_count + leaf->d_count <= k_LEAF_CAPACITY) {
+            left  = sibling;
+            right = leaf;
+        }
+    }
+    if (0 == left && childPosition < parent->d_count) {
+        Leaf *sibling = static_cast<Leaf *>(parent->child(childPosition + 1));
+        if (sibling->d_count + leaf->d_count <= k_LEAF_CAPACITY) {
+            left  = leaf;
+            right = sibling;
+        }
+    }
+    if (0 == left) {
+        return;                                                       // RETURN
+    }
+
+    const int offset = left->d_count;
+
+    // Merging only reclaims memory, so an exception thrown copying an element
+    // abandons the merge, leaving both leaves (and the tree) unchanged.
+
+    BSLS_TRY {
+        right->moveAll(left, d_data.d_allocator);
+    }
+    BSLS_CATCH(...) {
+        return;                                                       // RETURN
+    }
+
+    if (position->leaf() == right) {
+        *position = Iterator(left, offset + position->index());
+    }
+
+    // Unlink and free the emptied 'right' leaf, which is not the first child
+    // of 'parent', and so is removed with the key separating it from 'left'.
+
+    right->d_prev_p->d_next_p = right->d_next_p;
+    right->d_next_p->d_prev_p = right->d_prev_p;
+    removeNode(right);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Inner *
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::prepareParent(BTree_NodeBase *node,
+                                                        bool isAppend)
+{
+    if (0 == node->d_parent_p) {
+        BSLS_ASSERT_SAFE(d_root_p == node);
+
+        // Grow the tree by one level.  A root having no keys and a single
+        // child is a valid tree, so no proctor is required.
+
+        Inner *root = allocateNode<Inner>();
+        root->setOnlyChild(node);
+        d_root_p = root;
+        ++d_height;
+        return root;                                                  // RETURN
+    }
+
+    Inner *parent = static_cast<Inner *>(node->d_parent_p);
+    if (k_INNER_CAPACITY == parent->d_count) {
+        splitInner(parent, isAppend);
+        parent = static_cast<Inner *>(node->d_parent_p);
+    }
+    return parent;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertAt(Leaf             *leaf,
+                                                   int               position,
+                                                   const ValueType&  value)
+{
+    BSLS_ASSERT_SAFE(leaf);
+    BSLS_ASSERT_SAFE(0 <= position);
+    BSLS_ASSERT_SAFE(position <= leaf->d_count);
+
+    const KeyType& key = KEY_CONFIG::extractKey(value);
+
+    if (leaf->d_count < k_LEAF_CAPACITY) {
+        leaf->insert(position, value, key, d_data.d_allocator);
+        ++d_size;
+        return Iterator(leaf, position);                              // RETURN
+    }
+
+    // Split the full 'leaf'.  If 'value' is appended to the last leaf, start
+    // a new leaf holding just 'value' (so that ordered insertions fill each
+    // leaf); otherwise move the upper half of 'leaf' to a new leaf.  The key
+    // of the last element remaining in 'leaf' separates the two leaves.
+
+    const bool isAppend = &d_sentinel == leaf->d_next_p
+                       && k_LEAF_CAPACITY == position;
+    const int  mid      = isAppend ? k_LEAF_CAPACITY : k_LEAF_CAPACITY / 2;
+
+    Inner *parent = prepareParent(leaf, isAppend);
+
+    Leaf *right = allocateNode<Leaf>();
+    NodeProctor<Leaf> rightProctor(this, right);
+
+    const int keyPosition = parent->childIndex(leaf);
+    parent->insert(keyPosition,
+                   keyOf(leaf, mid - 1),
+                   right,
+                   d_data.d_allocator);
+    InsertionProctor insertionProctor(parent,
+                                      keyPosition,
+                                      &d_data.d_allocator);
+
+    if (isAppend) {
+        right->insert(0, value, key, d_data.d_allocator);
+    }
+    else {
+        leaf->moveTail(right, mid, d_data.d_allocator);
+    }
+
+    linkLeafAfter(right, leaf);
+    insertionProctor.release();
+    rightProctor.release();
+
+    if (isAppend) {
+        ++d_size;
+        return Iterator(right, 0);                                    // RETURN
+    }
+
+    // The split is complete, and the tree is valid, before 'value' is
+    // inserted, so that an exception leaves the sequence of elements
+    // unchanged.
+
+    if (position < mid) {
+        leaf->insert(position, value, key, d_data.d_allocator);
+        ++d_size;
+        return Iterator(leaf, position);                              // RETURN
+    }
+    right->insert(position - mid, value, key, d_data.d_allocator);
+    ++d_size;
+    return Iterator(right, position - mid);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertIntoEmpty(
+                                                       const ValueType& value)
+{
+    BSLS_ASSERT_SAFE(0 == d_root_p);
+
+    Leaf *leaf = allocateNode<Leaf>();
+    NodeProctor<Leaf> proctor(this, leaf);
+
+    leaf->insert(0,
+                 value,
+                 KEY_CONFIG::extractKey(value),
+                 d_data.d_allocator);
+    proctor.release();
+
+    linkLeafAfter(leaf, &d_sentinel);
+    d_root_p = leaf;
+    d_height = 0;
+    d_size   = 1;
+    return Iterator(leaf, 0);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+template <class NODE>
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::removeNode(NODE *node)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    Inner *parent = static_cast<Inner *>(node->d_parent_p);
+
+    if (0 == parent) {
+        deallocateNode(node);
+        d_root_p = 0;
+        d_height = 0;
+        return;                                                       // RETURN
+    }
+
+    if (0 == parent->d_count) {
+        deallocateNode(node);
+        removeNode(parent);
+        return;                                                       // RETURN
+    }
+
+    // Remove the key separating 'node' from its predecessor or, for the first
+    // child, from its successor; the remaining keys still bound the elements
+    // of the remaining children.
+
+    const int childPosition = parent->childIndex(node);
+    deallocateNode(node);
+    parent->erase(childPosition ? childPosition - 1 : 0,
+                  childPosition,
+                  d_data.d_allocator);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::splitInner(Inner *node,
+                                                          bool   isAppend)
+{
+    BSLS_ASSERT_SAFE(node);
+    BSLS_ASSERT_SAFE(k_INNER_CAPACITY == node->d_count);
+
+    const int mid = isAppend ? k_INNER_CAPACITY - 1 : k_INNER_CAPACITY / 2;
+
+    Inner *parent = prepareParent(node, isAppend);
+
+    Inner *right = allocateNode<Inner>();
+    NodeProctor<Inner> rightProctor(this, right);
+
+    const int keyPosition = parent->childIndex(node);
+    parent->insert(keyPosition, node->key(mid), right, d_data.d_allocator);
+    InsertionProctor insertionProctor(parent,
+                                      keyPosition,
+                                      &d_data.d_allocator);
+
+    node->moveTail(right, mid, d_data.d_allocator);
+
+    insertionProctor.release();
+    rightProctor.release();
+}
+
+// PRIVATE ACCESSORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bool BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::checkSubtree(
+                                   const BTree_NodeBase   *node,
+                                   int                     height,
+                                   const KeyType          *lowerBound,
+                                   const KeyType          *upperBound,
+                                   const BTree_LeafBase  **nextLeaf,
+                                   SizeType               *numElements) const
+{
+    const COMPARATOR& compare = comparator();
+
+    if (0 == height) {
+        const Leaf *leaf = static_cast<const Leaf *>(node);
+        if (leaf != *nextLeaf
+         || leaf->d_next_p->d_prev_p != leaf
+         || 0 >= leaf->d_count
+         || k_LEAF_CAPACITY < leaf->d_count) {
+            return false;                                             // RETURN
+        }
+        for (int i = 0; i < leaf->d_count; ++i) {
+            const KeyType& key = keyOf(leaf, i);
+            if ((i && !compare(keyOf(leaf, i - 1), key))
+             || (lowerBound && !compare(*lowerBound, key))
+             || (upperBound && compare(*upperBound, key))) {
+                return false;                                         // RETURN
+            }
+        }
+        *nextLeaf     = leaf->d_next_p;
+        *numElements += leaf->d_count;
+        return true;                                                  // RETURN
+    }
+
+    const Inner *inner = static_cast<const Inner *>(node);
+    if (0 > inner->d_count || k_INNER_CAPACITY < inner->d_count) {
+        return false;                                                 // RETURN
+    }
+    for (int i = 0; i <= inner->d_count; ++i) {
+        const KeyType *low  = i ? &inner->key(i - 1) : lowerBound;
+        const KeyType *high = i < inner->d_count ? &inner->key(i) : upperBound;
+        if ((i < inner->d_count && low && !compare(*low, *high))
+         || inner->child(i)->d_parent_p != inner
+         || !checkSubtree(inner->child(i),
+                          height - 1,
+                          low,
+                          high,
+                          nextLeaf,
+                          numElements)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Leaf *
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::findLeaf(int            *position,
+                                                   const KeyType&  key) const
+{
+    BSLS_ASSERT_SAFE(position);
+    BSLS_ASSERT_SAFE(d_root_p);
+
+    BTree_NodeBase *node = d_root_p;
+    for (int level = d_height; level > 0; --level) {
+        const Inner *inner = static_cast<const Inner *>(node);
+        node = inner->child(innerPosition(inner, key));
+    }
+    Leaf *leaf = static_cast<Leaf *>(node);
+    *position  = leafPosition(leaf, key);
+    return leaf;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+int BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::innerPosition(
+                                                   const Inner    *node,
+                                                   const KeyType&  key) const
+{
+    return innerPosition(node,
+                         key,
+                         bsl::integral_constant<bool, k_FLAT_KEYS>());
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+int BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::innerPosition(
+                                              const Inner    *node,
+                                              const KeyType&  key,
+                                              bsl::true_type) const
+{
+    return searchFlat(node->keys(), node->d_count, key);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+int BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::innerPosition(
+                                              const Inner    *node,
+                                              const KeyType&  key,
+                                              bsl::false_type) const
+{
+    const COMPARATOR& compare = comparator();
+
+    int low  = 0;
+    int high = node->d_count;
+    while (low < high) {
+        const int mid = (low + high) / 2;
+        if (compare(node->key(mid), key)) {
+            low = mid + 1;
+        }
+        else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+int BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::leafPosition(
+                                                   const Leaf     *leaf,
+                                                   const KeyType&  key) const
+{
+    return leafPosition(leaf,
+                        key,
+                        bsl::integral_constant<bool, k_FLAT_KEYS>());
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+int BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::leafPosition(
+                                                   const Leaf     *leaf,
+                                                   const KeyType&  key,
+                                                   bsl::true_type) const
+{
+    return searchFlat(leaf->keys(), leaf->d_count, key);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+int BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::leafPosition(
+                                                   const Leaf     *leaf,
+                                                   const KeyType&  key,
+                                                   bsl::false_type) const
+{
+    const COMPARATOR& compare = comparator();
+
+    int low  = 0;
+    int high = leaf->d_count;
+    while (low < high) {
+        const int mid = (low + high) / 2;
+        if (compare(keyOf(leaf, mid), key)) {
+            low = mid + 1;
+        }
+        else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+int BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::searchFlat(
+                                              const StoredKey *keys,
+                                              int              count,
+                                              const KeyType&   key) const
+{
+    return searchFlat(keys,
+                      count,
+                      key,
+                      bsl::integral_constant<bool, k_LINEAR_SEARCH>());
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+int BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::searchFlat(
+                                              const StoredKey *keys,
+                                              int              count,
+                                              const KeyType&   key,
+                                              bsl::true_type) const
+{
+    // Count the keys less than 'key' without branching on the comparisons,
+    // so that the loop can be vectorized; the keys are contiguous and span
+    // only a few cache lines.
+
+    const StoredKey value = key;
+
+    int position = 0;
+    for (int i = 0; i < count; ++i) {
+        position += keys[i] < value;
+    }
+    return position;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+int BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::searchFlat(
+                                              const StoredKey *keys,
+                                              int              count,
+                                              const KeyType&   key,
+                                              bsl::false_type) const
+{
+    const COMPARATOR& compare = comparator();
+
+    int low  = 0;
+    int high = count;
+    while (low < high) {
+        const int mid = (low + high) / 2;
+        if (compare(keys[mid], key)) {
+            low = mid + 1;
+        }
+        else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+// CREATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::BTree(
+                                              const ALLOCATOR& basicAllocator)
+: d_data(COMPARATOR(), basicAllocator)
+, d_root_p(0)
+, d_height(0)
+, d_size(0)
+{
+    d_sentinel.d_parent_p = 0;
+    d_sentinel.d_count    = 0;
+    d_sentinel.d_next_p   = &d_sentinel;
+    d_sentinel.d_prev_p   = &d_sentinel;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::BTree(
+                                              const COMPARATOR& comparator,
+                                              const ALLOCATOR&  basicAllocator)
+: d_data(comparator, basicAllocator)
+, d_root_p(0)
+, d_height(0)
+, d_size(0)
+{
+    d_sentinel.d_parent_p = 0;
+    d_sentinel.d_count    = 0;
+    d_sentinel.d_next_p   = &d_sentinel;
+    d_sentinel.d_prev_p   = &d_sentinel;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::BTree(
+                                              const BTree&     original,
+                                              const ALLOCATOR& basicAllocator)
+: d_data(original.comparator(), basicAllocator)
+, d_root_p(0)
+, d_height(0)
+, d_size(0)
+{
+    d_sentinel.d_parent_p = 0;
+    d_sentinel.d_count    = 0;
+    d_sentinel.d_next_p   = &d_sentinel;
+    d_sentinel.d_prev_p   = &d_sentinel;
+
+    if (0 == original.d_size) {
+        return;                                                       // RETURN
+    }
+
+    RemoveAllProctor proctor(this);
+
+    // The elements of 'original' are ordered, so each is appended to the last
+    // leaf, which fills every leaf but the last.
+
+    ConstIterator it = original.begin();
+    insertIntoEmpty(*it);
+    for (++it; it != original.end(); ++it) {
+        Leaf *last = static_cast<Leaf *>(d_sentinel.d_prev_p);
+        insertAt(last, last->d_count, *it);
+    }
+    proctor.release();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::~BTree()
+{
+    removeAll();
+}
+
+// MANIPULATORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertIfMissing(
+                                              bool             *isInsertedFlag,
+                                              const ValueType&  value)
+{
+    BSLS_ASSERT_SAFE(isInsertedFlag);
+
+    if (0 == d_root_p) {
+        *isInsertedFlag = true;
+        return insertIntoEmpty(value);                                // RETURN
+    }
+
+    const KeyType& key = KEY_CONFIG::extractKey(value);
+
+    int   position;
+    Leaf *leaf = findLeaf(&position, key);
+    if (position < leaf->d_count
+     && !comparator()(key, keyOf(leaf, position))) {
+        *isInsertedFlag = false;
+        return Iterator(leaf, position);                              // RETURN
+    }
+
+    *isInsertedFlag = true;
+    return insertAt(leaf, position, value);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::insertIfMissing(
+                                          bool                 *isInsertedFlag,
+                                          const ConstIterator&  hint,
+                                          const ValueType&      value)
+{
+    BSLS_ASSERT_SAFE(isInsertedFlag);
+
+    if (0 == d_root_p) {
+        *isInsertedFlag = true;
+        return insertIntoEmpty(value);                                // RETURN
+    }
+
+    const COMPARATOR& compare = comparator();
+    const KeyType&    key     = KEY_CONFIG::extractKey(value);
+
+    Leaf *leaf  = static_cast<Leaf *>(
+                                   const_cast<BTree_LeafBase *>(hint.leaf()));
+    int   index = hint.index();
+
+    if (&d_sentinel == leaf) {
+        // Appending after the last element is valid in the last leaf.
+
+        Leaf *last = static_cast<Leaf *>(d_sentinel.d_prev_p);
+        if (compare(keyOf(last, last->d_count - 1), key)) {
+            *isInsertedFlag = true;
+            return insertAt(last, last->d_count, value);              // RETURN
+        }
+    }
+    else if (compare(key, keyOf(leaf, index))) {
+        // A position between two elements of one leaf, or before the first
+        // element of the tree, is valid in that leaf.
+
+        if (0 < index) {
+            if (compare(keyOf(leaf, index - 1), key)) {
+                *isInsertedFlag = true;
+                return insertAt(leaf, index, value);                  // RETURN
+            }
+        }
+        else if (&d_sentinel == leaf->d_prev_p) {
+            *isInsertedFlag = true;
+            return insertAt(leaf, 0, value);                          // RETURN
+        }
+    }
+
+    return insertIfMissing(isInsertedFlag, value);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::quickSwapExchangeAllocators(
+                                                                  BTree *other)
+{
+    BSLS_ASSERT_SAFE(other);
+
+    bslalg::SwapUtil::swap(&d_data.d_allocator, &other->d_data.d_allocator);
+    quickSwapRetainAllocators(other);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::quickSwapRetainAllocators(
+                                                                  BTree *other)
+{
+    BSLS_ASSERT_SAFE(other);
+
+    bslalg::SwapUtil::swap(static_cast<ComparatorBase *>(&d_data),
+                           static_cast<ComparatorBase *>(&other->d_data));
+    bslalg::SwapUtil::swap(&d_root_p, &other->d_root_p);
+    bslalg::SwapUtil::swap(&d_height, &other->d_height);
+    bslalg::SwapUtil::swap(&d_size,   &other->d_size);
+    bslalg::SwapUtil::swap(&d_sentinel.d_next_p, &other->d_sentinel.d_next_p);
+    bslalg::SwapUtil::swap(&d_sentinel.d_prev_p, &other->d_sentinel.d_prev_p);
+
+    // Redirect the first and last leaves of each tree to its own sentinel.
+
+    BTree *trees[] = { this, other };
+    for (int i = 0; i < 2; ++i) {
+        BTree_LeafBase& sentinel = trees[i]->d_sentinel;
+        if (0 == trees[i]->d_root_p) {
+            sentinel.d_next_p = &sentinel;
+            sentinel.d_prev_p = &sentinel;
+        }
+        else {
+            sentinel.d_next_p->d_prev_p = &sentinel;
+            sentinel.d_prev_p->d_next_p = &sentinel;
+        }
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::remove(
+                                                const ConstIterator& position)
+{
+    BSLS_ASSERT_SAFE(position.leaf() != &d_sentinel);
+
+    Leaf *leaf  = static_cast<Leaf *>(
+                               const_cast<BTree_LeafBase *>(position.leaf()));
+    int   index = position.index();
+
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < leaf->d_count);
+
+    leaf->erase(index, d_data.d_allocator);
+    --d_size;
+
+    Iterator result = index < leaf->d_count
+                    ? Iterator(leaf, index)
+                    : Iterator(leaf->d_next_p, 0);
+
+    if (k_LEAF_MERGE_THRESHOLD <= leaf->d_count) {
+        return result;                                                // RETURN
+    }
+
+    if (0 < leaf->d_count) {
+        mergeLeaf(leaf, &result);
+    }
+    else {
+        // Unlink and free the emptied leaf.
+
+        leaf->d_prev_p->d_next_p = leaf->d_next_p;
+        leaf->d_next_p->d_prev_p = leaf->d_prev_p;
+        removeNode(leaf);
+    }
+
+    // Collapse any root left with a single child.
+
+    while (0 < d_height && 0 == d_root_p->d_count) {
+        Inner *root = static_cast<Inner *>(d_root_p);
+        d_root_p = root->child(0);
+        d_root_p->d_parent_p = 0;
+        --d_height;
+        deallocateNode(root);
+    }
+    return result;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+void BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::removeAll()
+{
+    if (d_root_p) {
+        deleteSubtree(d_root_p, d_height);
+    }
+    d_root_p            = 0;
+    d_height            = 0;
+    d_size              = 0;
+    d_sentinel.d_next_p = &d_sentinel;
+    d_sentinel.d_prev_p = &d_sentinel;
+}
+
+// ACCESSORS
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+ALLOCATOR BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::allocator() const
+{
+    return d_data.d_allocator;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return Iterator(d_sentinel.d_next_p, 0);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+const COMPARATOR& BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::comparator() const
+{
+    return d_data;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::end() const
+{
+    return Iterator(&d_sentinel, 0);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::find(const KeyType& key) const
+{
+    Iterator it = lowerBound(key);
+    if (it.leaf() != &d_sentinel
+     && !comparator()(key, keyOf(static_cast<const Leaf *>(it.leaf()),
+                                 it.index()))) {
+        return it;                                                    // RETURN
+    }
+    return end();
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+int BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::height() const
+{
+    return d_height;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+bool BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::isWellFormed() const
+{
+    if (0 == d_root_p) {
+        return 0 == d_size
+            && 0 == d_height
+            && &d_sentinel == d_sentinel.d_next_p
+            && &d_sentinel == d_sentinel.d_prev_p;                    // RETURN
+    }
+
+    const BTree_LeafBase *nextLeaf    = d_sentinel.d_next_p;
+    SizeType              numElements = 0;
+
+    return 0 == d_root_p->d_parent_p
+        && checkSubtree(d_root_p, d_height, 0, 0, &nextLeaf, &numElements)
+        && &d_sentinel == nextLeaf
+        && d_size == numElements;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::lowerBound(const KeyType& key) const
+{
+    if (0 == d_root_p) {
+        return end();                                                 // RETURN
+    }
+
+    int   position;
+    Leaf *leaf = findLeaf(&position, key);
+    if (position == leaf->d_count) {
+        return Iterator(leaf->d_next_p, 0);                           // RETURN
+    }
+    return Iterator(leaf, position);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::maxSize() const
+{
+    return AllocatorTraits::max_size(d_data.d_allocator);
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::SizeType
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_size;
+}
+
+template <class KEY_CONFIG, class COMPARATOR, class ALLOCATOR>
+inline
+typename BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::Iterator
+BTree<KEY_CONFIG, COMPARATOR, ALLOCATOR>::upperBound(const KeyType& key) const
+{
+    Iterator it = lowerBound(key);
+    if (it.leaf() != &d_sentinel
+     && !comparator()(key, keyOf(static_cast<const Leaf *>(it.leaf()),
+                                 it.index()))) {
+        ++it;
+    }
+    return it;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
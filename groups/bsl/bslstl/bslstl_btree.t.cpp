@@ -0,0 +1,1657 @@
+// bslstl_btree.t.cpp                                                 -*-C++-*-
+#include <bslstl_btree.h>
+
+#include <bslstl_allocator.h>
+#include <bslstl_pair.h>
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#include <bslstl_unorderedsetkeyconfiguration.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_issame.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+
+#include <bsltf_allocbitwisemoveabletesttype.h>
+#include <bsltf_alloctesttype.h>
+
+#include <algorithm>
+#include <functional>
+#include <set>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+using namespace bslstl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a class template, 'bslstl::BTree', holding
+// an ordered sequence of unique elements in the leaves of a B+tree, an
+// iterator over those elements, 'bslstl::BTreeIterator', and a number of
+// helper types used to lay out the nodes of the tree.
+//
+// We first test the node storage, 'BTree_Array', in both its contiguous and
+// its slot-indexed form, then the iterator over a tree populated using the
+// primary manipulator, 'insertIfMissing'.  The remaining cases exercise the
+// manipulators and accessors of 'BTree' for a representative set of
+// configurations:
+//: o 'int' elements compared by 'std::less' (contiguous elements, searched
+//:   linearly)
+//: o 'int' elements compared by 'std::greater' (contiguous elements, searched
+//:   by binary search)
+//: o 'pair<const int, AllocTestType>' elements keyed by 'int' (slot-indexed
+//:   elements with a contiguous key cache)
+//: o 'AllocTestType' elements (slot-indexed elements and separator keys that
+//:   allocate memory, searched by binary search)
+//: o 'AllocBitwiseMoveableTestType' elements (as above, but bitwise moveable)
+//
+// Every case verifies the structural invariants of the tree using the
+// 'isWellFormed' accessor, and the sequence of elements against a reference
+// 'std::set'.
+//
+// Global Concerns:
+//: o All memory is supplied by the allocator passed at construction.
+//: o No memory is leaked.
+//-----------------------------------------------------------------------------
+// BTree_Array
+// [ 2] void insert(int position, int count, const TYPE& value, ALLOCATOR&);
+// [ 2] void erase(int position, int count, ALLOCATOR&);
+// [ 2] void moveTail(BTree_Array *dest, int pos, int count, ALLOCATOR&);
+// [ 2] void moveAll(BTree_Array *dest, int count, int dn, ALLOCATOR&);
+// [ 2] void destroyAll(int count, ALLOCATOR&);
+// [ 2] TYPE& operator[](int index);
+// [ 2] const TYPE *data() const;
+//
+// BTreeIterator
+// [ 3] BTreeIterator();
+// [ 3] BTreeIterator(const BTree_LeafBase *leaf, int index);
+// [ 3] BTreeIterator(const NcIter& original);
+// [ 3] BTreeIterator& operator++();
+// [ 3] BTreeIterator& operator--();
+// [ 3] reference operator*() const;
+// [ 3] pointer operator->() const;
+// [ 3] bool operator==(const BTreeIterator&, const BTreeIterator&);
+// [ 3] bool operator!=(const BTreeIterator&, const BTreeIterator&);
+// [ 3] BTreeIterator operator++(BTreeIterator&, int);
+// [ 3] BTreeIterator operator--(BTreeIterator&, int);
+//
+// BTree
+// [ 4] explicit BTree(const ALLOCATOR& basicAllocator);
+// [ 4] BTree(const COMPARATOR& comparator, const ALLOCATOR& basicAllocator);
+// [ 8] BTree(const BTree& original, const ALLOCATOR& basicAllocator);
+// [ 4] ~BTree();
+// [ 4] Iterator insertIfMissing(bool *isInsertedFlag, const ValueType&);
+// [ 5] Iterator insertIfMissing(bool *, const ConstIterator&, const Value&);
+// [ 8] void quickSwapExchangeAllocators(BTree *other);
+// [ 8] void quickSwapRetainAllocators(BTree *other);
+// [ 7] Iterator remove(const ConstIterator& position);
+// [ 8] void removeAll();
+// [ 4] ALLOCATOR allocator() const;
+// [ 3] Iterator begin() const;
+// [ 4] const COMPARATOR& comparator() const;
+// [ 3] Iterator end() const;
+// [ 6] Iterator find(const KeyType& key) const;
+// [ 4] int height() const;
+// [ 4] bool isWellFormed() const;
+// [ 6] Iterator lowerBound(const KeyType& key) const;
+// [ 4] SizeType maxSize() const;
+// [ 4] SizeType size() const;
+// [ 6] Iterator upperBound(const KeyType& key) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 9] CONCERN: Insertion provides the strong exception-safety guarantee.
+// [10] USAGE EXAMPLE
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bsltf::AllocTestType                           AllocType;
+typedef bsltf::AllocBitwiseMoveableTestType            MoveableType;
+typedef bsl::pair<const int, AllocType>                PairType;
+
+typedef UnorderedSetKeyConfiguration<int>              IntConfig;
+typedef UnorderedMapKeyConfiguration<PairType>         PairConfig;
+typedef UnorderedSetKeyConfiguration<AllocType>        AllocConfig;
+typedef UnorderedSetKeyConfiguration<MoveableType>     MoveableConfig;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+template <class TYPE>
+struct DataLess {
+    // This class provides a comparator ordering objects of the (template
+    // parameter) 'TYPE' by the value returned by their 'data' method.
+
+    bool operator()(const TYPE& lhs, const TYPE& rhs) const
+        // Return 'true' if the specified 'lhs' is ordered before the
+        // specified 'rhs', and 'false' otherwise.
+    {
+        return lhs.data() < rhs.data();
+    }
+};
+
+template <class VALUE>
+struct ValueUtil;
+    // This 'struct' provides, for each element type used by this test driver,
+    // a class method 'create' returning an element having a specified integer
+    // value, and a class method 'toInt' returning the integer value of an
+    // element.
+
+template <>
+struct ValueUtil<int> {
+    static int create(int value, bslma::Allocator *)
+    {
+        return value;
+    }
+
+    static int toInt(int value)
+    {
+        return value;
+    }
+};
+
+template <>
+struct ValueUtil<AllocType> {
+    static AllocType create(int value, bslma::Allocator *basicAllocator)
+    {
+        return AllocType(value, basicAllocator);
+    }
+
+    static int toInt(const AllocType& value)
+    {
+        return value.data();
+    }
+};
+
+template <>
+struct ValueUtil<MoveableType> {
+    static MoveableType create(int value, bslma::Allocator *basicAllocator)
+    {
+        return MoveableType(value, basicAllocator);
+    }
+
+    static int toInt(const MoveableType& value)
+    {
+        return value.data();
+    }
+};
+
+template <>
+struct ValueUtil<PairType> {
+    static PairType create(int value, bslma::Allocator *basicAllocator)
+    {
+        return PairType(value,
+                        AllocType(-value, basicAllocator),
+                        basicAllocator);
+    }
+
+    static int toInt(const PairType& value)
+    {
+        ASSERTV(value.first, value.second.data(),
+                -value.first == value.second.data());
+
+        return value.first;
+    }
+};
+
+static int nextRandom(unsigned *seed)
+    // Advance the specified 'seed' of a linear congruential generator and
+    // return the next pseudo-random number in the range '[0, 32767]'.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return static_cast<int>((*seed >> 16) & 0x7fff);
+}
+
+enum Pattern {
+    // Orders in which a sequence of integers is generated.
+
+    e_ASCENDING,
+    e_DESCENDING,
+    e_RANDOM,
+    e_NUM_PATTERNS
+};
+
+static const char *patternName(int pattern)
+    // Return the name of the specified 'pattern'.
+{
+    switch (pattern) {
+      case e_ASCENDING:  return "ASCENDING";
+      case e_DESCENDING: return "DESCENDING";
+      default:           return "RANDOM";
+    }
+}
+
+static std::vector<int> makeSequence(int pattern, int length)
+    // Return a sequence of the specified 'length' integers, generated in the
+    // specified 'pattern'.  Random sequences contain duplicates.
+{
+    std::vector<int> result;
+    unsigned         seed = static_cast<unsigned>(length);
+    for (int i = 0; i < length; ++i) {
+        switch (pattern) {
+          case e_ASCENDING: {
+            result.push_back(i);
+          } break;
+          case e_DESCENDING: {
+            result.push_back(length - i);
+          } break;
+          default: {
+            result.push_back(nextRandom(&seed) % (length + 1));
+          } break;
+        }
+    }
+    return result;
+}
+
+static const int SIZES[] = { 0, 1, 2, 3, 5, 8, 17, 63, 100, 257, 1000, 3000 };
+static const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+//=============================================================================
+//                       TEST DRIVER TEMPLATE
+//-----------------------------------------------------------------------------
+
+template <class KEY_CONFIG, class COMPARATOR>
+struct TestDriver {
+    // This templatized struct provides a namespace for testing the 'BTree'
+    // class template for the (template parameter) 'KEY_CONFIG' and
+    // 'COMPARATOR' types.
+
+    // TYPES
+    typedef typename KEY_CONFIG::ValueType                 ValueType;
+    typedef bsl::allocator<ValueType>                      Allocator;
+    typedef BTree<KEY_CONFIG, COMPARATOR, Allocator>       Obj;
+    typedef typename Obj::Iterator                         Iterator;
+    typedef typename Obj::ConstIterator                    ConstIterator;
+    typedef ValueUtil<ValueType>                           Util;
+
+    struct IntComparator {
+        // This class orders integers as 'COMPARATOR' orders the elements
+        // created from them.
+
+        bool operator()(int lhs, int rhs) const
+            // Return 'true' if the element created from the specified 'lhs'
+            // is ordered before that created from the specified 'rhs'.
+        {
+            bslma::TestAllocator scratch;
+            return COMPARATOR()(
+                  KEY_CONFIG::extractKey(Util::create(lhs, &scratch)),
+                  KEY_CONFIG::extractKey(Util::create(rhs, &scratch)));
+        }
+    };
+
+    typedef std::set<int, IntComparator>                   Reference;
+
+    // CLASS METHODS
+    static bool verify(const Obj& object, const Reference& reference);
+        // Return 'true' if the specified 'object' is well formed and holds
+        // elements having the values in the specified 'reference', in the
+        // same order, and 'false' otherwise.
+
+    static int numLeaves(const Obj& object);
+        // Return the number of leaves in the specified 'object'.
+
+    static void testCase3();
+        // Test the iterator.
+
+    static void testCase4();
+        // Test the primary manipulator and basic accessors.
+
+    static void testCase5();
+        // Test hinted insertion.
+
+    static void testCase6();
+        // Test lookup.
+
+    static void testCase7();
+        // Test removal.
+
+    static void testCase8();
+        // Test copy construction, 'removeAll', and swap.
+
+    static void testCase9();
+        // Test exception safety of insertion.
+};
+
+template <class KEY_CONFIG, class COMPARATOR>
+bool TestDriver<KEY_CONFIG, COMPARATOR>::verify(const Obj&       object,
+                                                const Reference& reference)
+{
+    if (!object.isWellFormed() || object.size() != reference.size()) {
+        return false;                                                 // RETURN
+    }
+
+    Iterator it = object.begin();
+    for (typename Reference::const_iterator expected = reference.begin();
+         expected != reference.end();
+         ++expected, ++it) {
+        if (it == object.end() || Util::toInt(*it) != *expected) {
+            return false;                                             // RETURN
+        }
+    }
+    return it == object.end();
+}
+
+template <class KEY_CONFIG, class COMPARATOR>
+int TestDriver<KEY_CONFIG, COMPARATOR>::numLeaves(const Obj& object)
+{
+    int                   result = 0;
+    const BTree_LeafBase *leaf   = 0;
+    for (Iterator it = object.begin(); it != object.end(); ++it) {
+        if (it.leaf() != leaf) {
+            leaf = it.leaf();
+            ++result;
+        }
+    }
+    return result;
+}
+
+template <class KEY_CONFIG, class COMPARATOR>
+void TestDriver<KEY_CONFIG, COMPARATOR>::testCase3()
+{
+    // ------------------------------------------------------------------------
+    // ITERATOR
+    //
+    // Concerns:
+    //: 1 A default constructed iterator compares equal only to other default
+    //:   constructed iterators.
+    //:
+    //: 2 Incrementing from 'begin' visits every element in order, crossing
+    //:   leaf boundaries, and reaches 'end'.
+    //:
+    //: 3 Decrementing from 'end' visits every element in reverse order.
+    //:
+    //: 4 The post-increment and post-decrement operators return the prior
+    //:   value of the iterator.
+    //:
+    //: 5 A modifiable iterator converts to a 'const' iterator referring to
+    //:   the same position, and the two compare equal.
+    //:
+    //: 6 'operator->' returns the address of the element.
+    //
+    // Plan:
+    //: 1 For a sequence of tree sizes spanning several leaves, populate a tree
+    //:   with ascending values and traverse it in both directions, using both
+    //:   the prefix and postfix operators.  (C-1..6)
+    //
+    // Testing:
+    //   BTreeIterator();
+    //   BTreeIterator(const BTree_LeafBase *leaf, int index);
+    //   BTreeIterator(const NcIter& original);
+    //   BTreeIterator& operator++();
+    //   BTreeIterator& operator--();
+    //   reference operator*() const;
+    //   pointer operator->() const;
+    //   bool operator==(const BTreeIterator&, const BTreeIterator&);
+    //   bool operator!=(const BTreeIterator&, const BTreeIterator&);
+    //   BTreeIterator operator++(BTreeIterator&, int);
+    //   BTreeIterator operator--(BTreeIterator&, int);
+    //   Iterator begin() const;
+    //   Iterator end() const;
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    {
+        const Iterator      A;
+        const Iterator      B;
+        const ConstIterator C(A);
+        ASSERT(A == B);
+        ASSERT(!(A != B));
+        ASSERT(A == C);
+        ASSERT(0 == A.leaf());
+    }
+
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        const int LENGTH = SIZES[ti];
+
+        Obj mX(COMPARATOR(), &oa);  const Obj& X = mX;
+
+        Reference reference;
+        for (int i = 0; i < LENGTH; ++i) {
+            bool isInserted;
+            mX.insertIfMissing(&isInserted, Util::create(i, &sa));
+            reference.insert(i);
+        }
+        ASSERTV(LENGTH, verify(X, reference));
+
+        ASSERTV(LENGTH, (0 == LENGTH) == (X.begin() == X.end()));
+
+        // Forward traversal.
+
+        typename Reference::const_iterator expected = reference.begin();
+        Iterator                           it       = X.begin();
+        for (int i = 0; i < LENGTH; ++i, ++expected) {
+            const ConstIterator CIT(it);
+            ASSERTV(LENGTH, i, CIT == it);
+            ASSERTV(LENGTH, i, !(CIT != it));
+            ASSERTV(LENGTH, i, *expected == Util::toInt(*CIT));
+            ASSERTV(LENGTH, i, &*it == it.operator->());
+
+            Iterator prior = it++;
+            ASSERTV(LENGTH, i, prior != it);
+            ASSERTV(LENGTH, i, CIT == prior);
+
+            Iterator again = prior;
+            ASSERTV(LENGTH, i, &++again == &again);
+            ASSERTV(LENGTH, i, again == it);
+        }
+        ASSERTV(LENGTH, X.end() == it);
+
+        // Reverse traversal.
+
+        typename Reference::const_reverse_iterator rexpected =
+                                                           reference.rbegin();
+        for (int i = 0; i < LENGTH; ++i, ++rexpected) {
+            Iterator prior = it--;
+            ASSERTV(LENGTH, i, prior != it);
+            ASSERTV(LENGTH, i, *rexpected == Util::toInt(*it));
+
+            Iterator again = prior;
+            ASSERTV(LENGTH, i, &--again == &again);
+            ASSERTV(LENGTH, i, again == it);
+        }
+        ASSERTV(LENGTH, X.begin() == it);
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+}
+
+template <class KEY_CONFIG, class COMPARATOR>
+void TestDriver<KEY_CONFIG, COMPARATOR>::testCase4()
+{
+    // ------------------------------------------------------------------------
+    // PRIMARY MANIPULATOR AND BASIC ACCESSORS
+    //
+    // Concerns:
+    //: 1 A newly created tree is empty, well formed, and uses the supplied
+    //:   comparator and allocator.
+    //:
+    //: 2 'insertIfMissing' inserts a value whose key is absent, returning an
+    //:   iterator to the new element and loading 'true', and otherwise leaves
+    //:   the tree unchanged, returning an iterator to the existing element
+    //:   and loading 'false'.
+    //:
+    //: 3 The tree remains well formed, and its elements ordered, after every
+    //:   insertion, in whatever order values are inserted.
+    //:
+    //: 4 Inserting values in ascending order fills every leaf but the last.
+    //:
+    //: 5 The height of the tree grows logarithmically with its size.
+    //:
+    //: 6 All memory is supplied by the tree's allocator, and is released when
+    //:   the tree is destroyed.
+    //
+    // Plan:
+    //: 1 Create a tree using a test allocator, and verify its initial state.
+    //:   (C-1)
+    //:
+    //: 2 For each of several lengths and generation patterns, insert a
+    //:   sequence of values into a tree, verifying the result of each
+    //:   insertion, and the contents and structure of the tree against a
+    //:   reference 'std::set'.  (C-2..5)
+    //:
+    //: 3 Install a test allocator as the default allocator, and verify that it
+    //:   is not used, and that the object allocator has no outstanding blocks
+    //:   after each tree is destroyed.  (C-6)
+    //
+    // Testing:
+    //   explicit BTree(const ALLOCATOR& basicAllocator);
+    //   BTree(const COMPARATOR& comparator, const ALLOCATOR& basicAllocator);
+    //   ~BTree();
+    //   Iterator insertIfMissing(bool *isInsertedFlag, const ValueType&);
+    //   ALLOCATOR allocator() const;
+    //   const COMPARATOR& comparator() const;
+    //   int height() const;
+    //   bool isWellFormed() const;
+    //   SizeType maxSize() const;
+    //   SizeType size() const;
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    {
+        Obj mX((Allocator(&oa)));  const Obj& X = mX;
+        ASSERT(0       == X.size());
+        ASSERT(0       == X.height());
+        ASSERT(X.isWellFormed());
+        ASSERT(X.begin() == X.end());
+        ASSERT(&oa     == X.allocator().mechanism());
+        ASSERT(0       <  X.maxSize());
+        ASSERT(0       == oa.numBlocksTotal());
+    }
+
+    for (int tp = 0; tp < e_NUM_PATTERNS; ++tp) {
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int              LENGTH = SIZES[ti];
+            const std::vector<int> DATA   = makeSequence(tp, LENGTH);
+
+            if (veryVerbose) { P_(patternName(tp)) P(LENGTH) }
+
+            {
+                Obj mX(COMPARATOR(), &oa);  const Obj& X = mX;
+
+                Reference reference;
+                for (int i = 0; i < LENGTH; ++i) {
+                    const ValueType VALUE = Util::create(DATA[i], &sa);
+
+                    bool     isInserted;
+                    Iterator it = mX.insertIfMissing(&isInserted, VALUE);
+
+                    const bool EXP = reference.insert(DATA[i]).second;
+                    ASSERTV(tp, LENGTH, i, EXP == isInserted);
+                    ASSERTV(tp, LENGTH, i, DATA[i] == Util::toInt(*it));
+                    ASSERTV(tp, LENGTH, i, X.find(
+                                      KEY_CONFIG::extractKey(VALUE)) == it);
+
+                    if (LENGTH < 300 || i == LENGTH - 1) {
+                        ASSERTV(tp, LENGTH, i, verify(X, reference));
+                    }
+                }
+                ASSERTV(tp, LENGTH, verify(X, reference));
+
+                if (e_ASCENDING == tp && IntComparator()(0, 1)) {
+                    const int CAP = Obj::k_LEAF_CAPACITY;
+                    ASSERTV(tp, LENGTH, numLeaves(X),
+                            numLeaves(X) == (LENGTH + CAP - 1) / CAP);
+                }
+
+                // Every leaf of a tree populated by insertion alone holds at
+                // least two elements, and every inner node has at least two
+                // children, so the height is at most 'log2(LENGTH / 2)'.
+
+                int maxHeight = 0;
+                for (int n = LENGTH; n > 2; n /= 2) {
+                    ++maxHeight;
+                }
+                ASSERTV(tp, LENGTH, X.height(), X.height() <= maxHeight);
+            }
+            ASSERTV(tp, LENGTH, 0 == oa.numBlocksInUse());
+        }
+    }
+    ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+}
+
+template <class KEY_CONFIG, class COMPARATOR>
+void TestDriver<KEY_CONFIG, COMPARATOR>::testCase5()
+{
+    // ------------------------------------------------------------------------
+    // HINTED INSERTION
+    //
+    // Concerns:
+    //: 1 Inserting with a hint referring to the position immediately
+    //:   following the value inserts the value at that position.
+    //:
+    //: 2 Inserting with an incorrect hint still inserts the value at its
+    //:   correct position, or returns the existing element having its key.
+    //:
+    //: 3 Appending values in ascending order using the 'end' hint fills every
+    //:   leaf but the last.
+    //
+    // Plan:
+    //: 1 For each of several lengths and generation patterns, insert a
+    //:   sequence of values, using as hint the lower bound of the value, the
+    //:   'end' position, the 'begin' position, and an arbitrary position, and
+    //:   verify the tree against a reference 'std::set'.  (C-1..2)
+    //:
+    //: 2 Verify the number of leaves of trees populated in ascending order
+    //:   using the 'end' hint.  (C-3)
+    //
+    // Testing:
+    //   Iterator insertIfMissing(bool *, const ConstIterator&, const Value&);
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    enum { e_LOWER_BOUND, e_END, e_BEGIN, e_ARBITRARY, e_NUM_HINTS };
+
+    for (int th = 0; th < e_NUM_HINTS; ++th) {
+    for (int tp = 0; tp < e_NUM_PATTERNS; ++tp) {
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        const int              LENGTH = SIZES[ti];
+        const std::vector<int> DATA   = makeSequence(tp, LENGTH);
+
+        if (veryVerbose) { P_(th) P_(patternName(tp)) P(LENGTH) }
+
+        Obj mX(COMPARATOR(), &oa);  const Obj& X = mX;
+
+        Reference reference;
+        unsigned  seed = 7;
+        for (int i = 0; i < LENGTH; ++i) {
+            const ValueType VALUE = Util::create(DATA[i], &sa);
+
+            ConstIterator hint;
+            switch (th) {
+              case e_LOWER_BOUND: {
+                hint = X.lowerBound(KEY_CONFIG::extractKey(VALUE));
+              } break;
+              case e_END: {
+                hint = X.end();
+              } break;
+              case e_BEGIN: {
+                hint = X.begin();
+              } break;
+              default: {
+                hint = X.begin();
+                for (int n = nextRandom(&seed) % (X.size() + 1); n > 0; --n) {
+                    ++hint;
+                }
+              } break;
+            }
+
+            bool     isInserted;
+            Iterator it = mX.insertIfMissing(&isInserted, hint, VALUE);
+
+            const bool EXP = reference.insert(DATA[i]).second;
+            ASSERTV(th, tp, LENGTH, i, EXP == isInserted);
+            ASSERTV(th, tp, LENGTH, i, DATA[i] == Util::toInt(*it));
+
+            if (LENGTH < 300) {
+                ASSERTV(th, tp, LENGTH, i, verify(X, reference));
+            }
+        }
+        ASSERTV(th, tp, LENGTH, verify(X, reference));
+
+        if (e_ASCENDING == tp
+         && IntComparator()(0, 1)
+         && (e_END == th || e_LOWER_BOUND == th)) {
+            const int CAP = Obj::k_LEAF_CAPACITY;
+            ASSERTV(th, LENGTH, numLeaves(X),
+                    numLeaves(X) == (LENGTH + CAP - 1) / CAP);
+        }
+    }
+    }
+    }
+    ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+}
+
+template <class KEY_CONFIG, class COMPARATOR>
+void TestDriver<KEY_CONFIG, COMPARATOR>::testCase6()
+{
+    // ------------------------------------------------------------------------
+    // LOOKUP
+    //
+    // Concerns:
+    //: 1 'find' returns an iterator to the element having the specified key,
+    //:   or 'end' if there is none.
+    //:
+    //: 2 'lowerBound' returns an iterator to the first element not ordered
+    //:   before the key, including when that element is the first of a leaf,
+    //:   and 'end' if there is none.
+    //:
+    //: 3 'upperBound' returns an iterator to the first element ordered after
+    //:   the key, and 'end' if there is none.
+    //:
+    //: 4 Lookup allocates no memory.
+    //
+    // Plan:
+    //: 1 For each of several lengths, populate a tree with the even integers
+    //:   in a random order, and look up every integer in a range extending
+    //:   beyond the populated values on both sides, comparing the results
+    //:   with a reference 'std::set'.  (C-1..3)
+    //:
+    //: 2 Verify that the number of allocations is unchanged by the lookups.
+    //:   (C-4)
+    //
+    // Testing:
+    //   Iterator find(const KeyType& key) const;
+    //   Iterator lowerBound(const KeyType& key) const;
+    //   Iterator upperBound(const KeyType& key) const;
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        const int              LENGTH = SIZES[ti];
+        const std::vector<int> DATA   = makeSequence(e_RANDOM, LENGTH);
+
+        Obj mX(COMPARATOR(), &oa);  const Obj& X = mX;
+
+        Reference reference;
+        for (int i = 0; i < LENGTH; ++i) {
+            bool isInserted;
+            mX.insertIfMissing(&isInserted, Util::create(2 * DATA[i], &sa));
+            reference.insert(2 * DATA[i]);
+        }
+        ASSERTV(LENGTH, verify(X, reference));
+
+        bslma::TestAllocatorMonitor oam(&oa);
+
+        for (int k = -2; k <= 2 * LENGTH + 3; ++k) {
+            const ValueType VALUE = Util::create(k, &sa);
+            const typename KEY_CONFIG::KeyType& KEY =
+                                                KEY_CONFIG::extractKey(VALUE);
+
+            const typename Reference::const_iterator EXP_FIND =
+                                                            reference.find(k);
+            const typename Reference::const_iterator EXP_LOWER =
+                                                     reference.lower_bound(k);
+            const typename Reference::const_iterator EXP_UPPER =
+                                                     reference.upper_bound(k);
+
+            const Iterator FIND  = X.find(KEY);
+            const Iterator LOWER = X.lowerBound(KEY);
+            const Iterator UPPER = X.upperBound(KEY);
+
+            ASSERTV(LENGTH, k, (EXP_FIND  == reference.end())
+                                                        == (FIND  == X.end()));
+            ASSERTV(LENGTH, k, (EXP_LOWER == reference.end())
+                                                        == (LOWER == X.end()));
+            ASSERTV(LENGTH, k, (EXP_UPPER == reference.end())
+                                                        == (UPPER == X.end()));
+
+            if (FIND != X.end()) {
+                ASSERTV(LENGTH, k, k == Util::toInt(*FIND));
+            }
+            if (LOWER != X.end() && EXP_LOWER != reference.end()) {
+                ASSERTV(LENGTH, k, *EXP_LOWER == Util::toInt(*LOWER));
+            }
+            if (UPPER != X.end() && EXP_UPPER != reference.end()) {
+                ASSERTV(LENGTH, k, *EXP_UPPER == Util::toInt(*UPPER));
+            }
+        }
+        ASSERTV(LENGTH, oam.isTotalSame());
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR>
+void TestDriver<KEY_CONFIG, COMPARATOR>::testCase7()
+{
+    // ------------------------------------------------------------------------
+    // REMOVAL
+    //
+    // Concerns:
+    //: 1 'remove' removes the specified element, and returns an iterator to
+    //:   the element that followed it, or 'end'.
+    //:
+    //: 2 The tree remains well formed after every removal, including those
+    //:   that empty a leaf, remove inner nodes, and reduce the height of the
+    //:   tree.
+    //:
+    //: 3 Removing every element frees every node.
+    //:
+    //: 4 A tree from which elements have been removed can be repopulated.
+    //:
+    //: 5 A leaf left less than a quarter full is merged with an adjacent
+    //:   leaf, so that the number of leaves (and the memory held) shrinks
+    //:   with the number of elements.
+    //
+    // Plan:
+    //: 1 For each of several lengths and removal orders, populate a tree, then
+    //:   remove its elements one at a time, verifying the returned iterator
+    //:   and the tree against a reference 'std::set'.  (C-1..2, 5)
+    //:
+    //: 2 Verify that no memory is outstanding once the tree is empty, then
+    //:   repopulate it.  (C-3..4)
+    //:
+    //: 3 For each removal order, populate a tree, remove all but every
+    //:   sixteenth element, and verify that the leaves hold on average at
+    //:   least a quarter of their capacity.  (C-5)
+    //
+    // Testing:
+    //   Iterator remove(const ConstIterator& position);
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    for (int tp = 0; tp < e_NUM_PATTERNS; ++tp) {
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int              LENGTH = SIZES[ti];
+            const std::vector<int> REMOVE = makeSequence(tp, LENGTH);
+
+            if (veryVerbose) { P_(patternName(tp)) P(LENGTH) }
+
+            Obj mX(COMPARATOR(), &oa);  const Obj& X = mX;
+
+            for (int pass = 0; pass < 2; ++pass) {
+                Reference reference;
+                for (int i = 0; i <= LENGTH; ++i) {
+                    bool isInserted;
+                    mX.insertIfMissing(&isInserted, Util::create(i, &sa));
+                    reference.insert(i);
+                }
+                ASSERTV(tp, LENGTH, pass, verify(X, reference));
+
+                for (int i = 0; i < LENGTH; ++i) {
+                    const ValueType VALUE = Util::create(REMOVE[i], &sa);
+                    const Iterator  IT    = X.find(
+                                                KEY_CONFIG::extractKey(VALUE));
+
+                    typename Reference::iterator expected =
+                                                    reference.find(REMOVE[i]);
+                    if (expected == reference.end()) {
+                        ASSERTV(tp, LENGTH, i, X.end() == IT);
+                        continue;
+                    }
+                    reference.erase(expected++);
+
+                    const Iterator NEXT = mX.remove(IT);
+                    ASSERTV(tp, LENGTH, i,
+                           (expected == reference.end()) == (NEXT == X.end()));
+                    if (expected != reference.end() && NEXT != X.end()) {
+                        ASSERTV(tp, LENGTH, i,
+                                *expected == Util::toInt(*NEXT));
+                    }
+
+                    if (LENGTH < 300 || i == LENGTH - 1) {
+                        ASSERTV(tp, LENGTH, i, verify(X, reference));
+                    }
+                }
+                ASSERTV(tp, LENGTH, verify(X, reference));
+
+                // Remove the remaining elements from the front.
+
+                while (X.size()) {
+                    reference.erase(reference.begin());
+                    const Iterator NEXT = mX.remove(X.begin());
+                    ASSERTV(tp, LENGTH, NEXT == X.begin());
+                    if (X.size() < 100) {
+                        ASSERTV(tp, LENGTH, verify(X, reference));
+                    }
+                }
+                ASSERTV(tp, LENGTH, X.isWellFormed());
+                ASSERTV(tp, LENGTH, 0 == X.height());
+                ASSERTV(tp, LENGTH, oa.numBlocksInUse(),
+                        0 == oa.numBlocksInUse());
+            }
+        }
+    }
+
+    if (verbose) printf("\tTesting merging of sparse leaves.\n");
+
+    for (int tp = 0; tp < e_NUM_PATTERNS; ++tp) {
+        const int              LENGTH = 3000;
+        const std::vector<int> REMOVE = makeSequence(tp, LENGTH);
+
+        Obj mX(COMPARATOR(), &oa);  const Obj& X = mX;
+
+        Reference reference;
+        for (int i = 0; i <= LENGTH; ++i) {
+            bool isInserted;
+            mX.insertIfMissing(&isInserted, Util::create(i, &sa));
+            reference.insert(i);
+        }
+
+        for (int i = 0; i < LENGTH; ++i) {
+            if (0 == REMOVE[i] % 16) {
+                continue;
+            }
+            const ValueType VALUE = Util::create(REMOVE[i], &sa);
+            const Iterator  IT    = X.find(KEY_CONFIG::extractKey(VALUE));
+            if (X.end() != IT) {
+                mX.remove(IT);
+                reference.erase(REMOVE[i]);
+            }
+        }
+        for (int i = 0; i <= LENGTH; ++i) {
+            if (0 != i % 16 && reference.count(i)) {
+                const ValueType VALUE = Util::create(i, &sa);
+                mX.remove(X.find(KEY_CONFIG::extractKey(VALUE)));
+                reference.erase(i);
+            }
+        }
+        ASSERTV(tp, verify(X, reference));
+
+        const int NUM_LEAVES = numLeaves(X);
+        const int SIZE       = static_cast<int>(X.size());
+
+        if (veryVerbose) {
+            P_(patternName(tp)) P_(SIZE) P_(NUM_LEAVES) P(Obj::k_LEAF_CAPACITY)
+        }
+        ASSERTV(tp, SIZE, NUM_LEAVES, Obj::k_LEAF_CAPACITY,
+                NUM_LEAVES * Obj::k_LEAF_CAPACITY <= 4 * SIZE + 4);
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR>
+void TestDriver<KEY_CONFIG, COMPARATOR>::testCase8()
+{
+    // ------------------------------------------------------------------------
+    // COPY CONSTRUCTION, 'removeAll', AND SWAP
+    //
+    // Concerns:
+    //: 1 A copy holds the same elements as the original, in full leaves, and
+    //:   uses the allocator supplied at construction.
+    //:
+    //: 2 'removeAll' removes all elements and frees all nodes, leaving a tree
+    //:   that can be repopulated.
+    //:
+    //: 3 The swap methods exchange the elements of two trees of any sizes,
+    //:   including empty trees, leaving both trees well formed and
+    //:   traversable from 'begin' to 'end' in both directions.
+    //:
+    //: 4 'quickSwapExchangeAllocators' exchanges allocators, and
+    //:   'quickSwapRetainAllocators' does not.
+    //:
+    //: 5 Swap allocates no memory.
+    //
+    // Plan:
+    //: 1 For each pair of several lengths, populate two trees in random order,
+    //:   copy each, swap the originals, and verify all four trees against
+    //:   reference 'std::set' objects.  (C-1, 3..5)
+    //:
+    //: 2 Call 'removeAll' on each tree and repopulate it.  (C-2)
+    //
+    // Testing:
+    //   BTree(const BTree& original, const ALLOCATOR& basicAllocator);
+    //   void quickSwapExchangeAllocators(BTree *other);
+    //   void quickSwapRetainAllocators(BTree *other);
+    //   void removeAll();
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+    for (int tj = 0; tj < NUM_SIZES; ++tj) {
+    for (int exchange = 0; exchange < 2; ++exchange) {
+        const int LENGTH1 = SIZES[ti];
+        const int LENGTH2 = SIZES[tj];
+
+        if (LENGTH1 > 300 && LENGTH2 > 300) {
+            continue;
+        }
+
+        const std::vector<int> DATA1 = makeSequence(e_RANDOM, LENGTH1);
+        const std::vector<int> DATA2 = makeSequence(e_RANDOM, LENGTH2);
+
+        bslma::TestAllocator& xa = exchange ? za : oa;
+
+        Obj mX(COMPARATOR(), &oa);  const Obj& X = mX;
+        Obj mY(COMPARATOR(), &xa);  const Obj& Y = mY;
+
+        Reference ref1;
+        Reference ref2;
+        for (int i = 0; i < LENGTH1; ++i) {
+            bool isInserted;
+            mX.insertIfMissing(&isInserted, Util::create(DATA1[i], &sa));
+            ref1.insert(DATA1[i]);
+        }
+        for (int i = 0; i < LENGTH2; ++i) {
+            bool isInserted;
+            mY.insertIfMissing(&isInserted, Util::create(-DATA2[i], &sa));
+            ref2.insert(-DATA2[i]);
+        }
+
+        bslma::TestAllocator ca("copy", veryVeryVeryVerbose);
+        {
+            const Obj C(X, Allocator(&ca));
+            ASSERTV(LENGTH1, verify(C, ref1));
+            ASSERTV(LENGTH1, &ca == C.allocator().mechanism());
+
+            const int CAP  = Obj::k_LEAF_CAPACITY;
+            const int SIZE = static_cast<int>(X.size());
+            ASSERTV(LENGTH1, numLeaves(C) == (SIZE + CAP - 1) / CAP);
+        }
+        ASSERTV(LENGTH1, 0 == ca.numBlocksInUse());
+
+        bslma::TestAllocatorMonitor oam(&oa);
+        bslma::TestAllocatorMonitor xam(&xa);
+
+        if (exchange) {
+            mX.quickSwapExchangeAllocators(&mY);
+            ASSERTV(&za == X.allocator().mechanism());
+            ASSERTV(&oa == Y.allocator().mechanism());
+        }
+        else {
+            mX.quickSwapRetainAllocators(&mY);
+            ASSERTV(&oa == X.allocator().mechanism());
+            ASSERTV(&oa == Y.allocator().mechanism());
+        }
+        ASSERTV(LENGTH1, LENGTH2, oam.isTotalSame());
+        ASSERTV(LENGTH1, LENGTH2, xam.isTotalSame());
+
+        ASSERTV(LENGTH1, LENGTH2, verify(X, ref2));
+        ASSERTV(LENGTH1, LENGTH2, verify(Y, ref1));
+
+        int count = 0;
+        for (Iterator it = X.end(); it != X.begin(); --it) {
+            ++count;
+        }
+        ASSERTV(LENGTH1, LENGTH2, count == static_cast<int>(X.size()));
+        count = 0;
+        for (Iterator it = Y.end(); it != Y.begin(); --it) {
+            ++count;
+        }
+        ASSERTV(LENGTH1, LENGTH2, count == static_cast<int>(Y.size()));
+
+        // Elements inserted after the swap are found in the right tree.
+
+        bool isInserted;
+        mX.insertIfMissing(&isInserted, Util::create(LENGTH1 + 1, &sa));
+        ref2.insert(LENGTH1 + 1);
+        ASSERTV(LENGTH1, LENGTH2, verify(X, ref2));
+
+        mX.removeAll();
+        ASSERTV(LENGTH1, LENGTH2, X.isWellFormed());
+        ASSERTV(LENGTH1, LENGTH2, 0 == X.size());
+        ASSERTV(LENGTH1, LENGTH2, X.begin() == X.end());
+
+        mY.removeAll();
+        ASSERTV(LENGTH1, LENGTH2, 0 == oa.numBlocksInUse());
+        ASSERTV(LENGTH1, LENGTH2, 0 == za.numBlocksInUse());
+
+        Reference ref3;
+        for (int i = 0; i < LENGTH2; ++i) {
+            mY.insertIfMissing(&isInserted, Util::create(DATA2[i], &sa));
+            ref3.insert(DATA2[i]);
+        }
+        ASSERTV(LENGTH1, LENGTH2, verify(Y, ref3));
+    }
+    }
+    }
+}
+
+template <class KEY_CONFIG, class COMPARATOR>
+void TestDriver<KEY_CONFIG, COMPARATOR>::testCase9()
+{
+    // ------------------------------------------------------------------------
+    // EXCEPTION SAFETY OF INSERTION
+    //
+    // Concerns:
+    //: 1 If allocating a node, or copying an element or key, throws during an
+    //:   insertion, the tree is well formed and holds the same elements.
+    //:
+    //: 2 No memory is leaked.
+    //:
+    //: 3 If the copy constructor throws, no memory is leaked.
+    //
+    // Plan:
+    //: 1 Populate a tree with a sequence of values, inserting each within the
+    //:   'bslma' exception-test loop, so that each possible allocation fails
+    //:   in turn, and verify, at the start of each iteration, that the tree is
+    //:   unchanged by the previous (failed) iteration.  (C-1)
+    //:
+    //: 2 Verify that the object allocator has no outstanding blocks once the
+    //:   tree is destroyed.  (C-2)
+    //:
+    //: 3 Copy a populated tree within the exception-test loop.  (C-3)
+    //
+    // Testing:
+    //   CONCERN: Insertion provides the strong exception-safety guarantee.
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    for (int hinted = 0; hinted < 2; ++hinted) {
+    for (int tp = 0; tp < e_NUM_PATTERNS; ++tp) {
+        const int              LENGTH = 200;
+        const std::vector<int> DATA   = makeSequence(tp, LENGTH);
+
+        {
+            Obj mX(COMPARATOR(), &oa);  const Obj& X = mX;
+
+            Reference reference;
+            for (int i = 0; i < LENGTH; ++i) {
+                const ValueType VALUE = Util::create(DATA[i], &sa);
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERTV(hinted, tp, i, verify(X, reference));
+
+                    bool isInserted;
+                    if (hinted) {
+                        mX.insertIfMissing(&isInserted, X.end(), VALUE);
+                    }
+                    else {
+                        mX.insertIfMissing(&isInserted, VALUE);
+                    }
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                reference.insert(DATA[i]);
+                ASSERTV(hinted, tp, i, verify(X, reference));
+            }
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                const Obj C(X, Allocator(&oa));
+                ASSERTV(hinted, tp, verify(C, reference));
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+        ASSERTV(hinted, tp, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+    }
+    }
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 10: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Maintaining an Ordered Set of Integers
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// In this example we use a 'BTree' directly to maintain an ordered set of
+// integers, although a 'bsl::btree_set' is a more convenient interface for
+// the same purpose.
+//
+// First, we define the type of the tree, using
+// 'bslstl::UnorderedSetKeyConfiguration' to indicate that each element is its
+// own key:
+//..
+    typedef bslstl::UnorderedSetKeyConfiguration<int> KeyConfig;
+    typedef bslstl::BTree<KeyConfig,
+                          std::less<int>,
+                          bsl::allocator<int> >       Tree;
+
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+    Tree tree(std::less<int>(), &oa);
+//..
+// Then, we insert a sequence of values, some of them more than once:
+//..
+    static const int DATA[] = { 5, 3, 8, 1, 3, 9, 7, 5 };
+    const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    int numInserted = 0;
+    for (int i = 0; i < NUM_DATA; ++i) {
+        bool isInserted;
+        tree.insertIfMissing(&isInserted, DATA[i]);
+        numInserted += isInserted;
+    }
+    ASSERT(6 == numInserted);
+    ASSERT(6 == tree.size());
+//..
+// Next, we iterate over the tree and observe that its elements are ordered:
+//..
+    static const int EXPECTED[] = { 1, 3, 5, 7, 8, 9 };
+
+    int index = 0;
+    for (Tree::Iterator it = tree.begin(); it != tree.end(); ++it, ++index) {
+        ASSERT(EXPECTED[index] == *it);
+    }
+//..
+// Now, we look up some values:
+//..
+    ASSERT(7           == *tree.find(7));
+    ASSERT(tree.end()  ==  tree.find(6));
+    ASSERT(7           == *tree.lowerBound(6));
+    ASSERT(8           == *tree.upperBound(7));
+//..
+// Finally, we remove an element, using the returned iterator to find its
+// successor:
+//..
+    Tree::Iterator next = tree.remove(tree.find(5));
+    ASSERT(7 == *next);
+    ASSERT(5 == tree.size());
+    ASSERT(tree.isWellFormed());
+//..
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY OF INSERTION
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nEXCEPTION SAFETY OF INSERTION"
+                            "\n=============================\n");
+
+        TestDriver<IntConfig,      std::less<int>          >::testCase9();
+        TestDriver<PairConfig,     std::less<int>          >::testCase9();
+        TestDriver<AllocConfig,    DataLess<AllocType>     >::testCase9();
+        TestDriver<MoveableConfig, DataLess<MoveableType>  >::testCase9();
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // COPY CONSTRUCTION, 'removeAll', AND SWAP
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY CONSTRUCTION, 'removeAll', AND SWAP"
+                            "\n========================================\n");
+
+        TestDriver<IntConfig,      std::less<int>          >::testCase8();
+        TestDriver<IntConfig,      std::greater<int>       >::testCase8();
+        TestDriver<PairConfig,     std::less<int>          >::testCase8();
+        TestDriver<AllocConfig,    DataLess<AllocType>     >::testCase8();
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // REMOVAL
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nREMOVAL"
+                            "\n=======\n");
+
+        TestDriver<IntConfig,      std::less<int>          >::testCase7();
+        TestDriver<IntConfig,      std::greater<int>       >::testCase7();
+        TestDriver<PairConfig,     std::less<int>          >::testCase7();
+        TestDriver<AllocConfig,    DataLess<AllocType>     >::testCase7();
+        TestDriver<MoveableConfig, DataLess<MoveableType>  >::testCase7();
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // LOOKUP
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP"
+                            "\n======\n");
+
+        TestDriver<IntConfig,      std::less<int>          >::testCase6();
+        TestDriver<IntConfig,      std::greater<int>       >::testCase6();
+        TestDriver<PairConfig,     std::less<int>          >::testCase6();
+        TestDriver<AllocConfig,    DataLess<AllocType>     >::testCase6();
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // HINTED INSERTION
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nHINTED INSERTION"
+                            "\n================\n");
+
+        TestDriver<IntConfig,      std::less<int>          >::testCase5();
+        TestDriver<IntConfig,      std::greater<int>       >::testCase5();
+        TestDriver<PairConfig,     std::less<int>          >::testCase5();
+        TestDriver<AllocConfig,    DataLess<AllocType>     >::testCase5();
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATOR AND BASIC ACCESSORS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPRIMARY MANIPULATOR AND BASIC ACCESSORS"
+                            "\n=======================================\n");
+
+        TestDriver<IntConfig,      std::less<int>          >::testCase4();
+        TestDriver<IntConfig,      std::greater<int>       >::testCase4();
+        TestDriver<PairConfig,     std::less<int>          >::testCase4();
+        TestDriver<AllocConfig,    DataLess<AllocType>     >::testCase4();
+        TestDriver<MoveableConfig, DataLess<MoveableType>  >::testCase4();
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ITERATOR
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nITERATOR"
+                            "\n========\n");
+
+        TestDriver<IntConfig,      std::less<int>          >::testCase3();
+        TestDriver<PairConfig,     std::less<int>          >::testCase3();
+        TestDriver<AllocConfig,    DataLess<AllocType>     >::testCase3();
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // NODE STORAGE
+        //
+        // Concerns:
+        //: 1 'insert' places the value at the specified position, preserving
+        //:   the order of the other objects.
+        //:
+        //: 2 'erase' removes the object at the specified position, preserving
+        //:   the order of the other objects.
+        //:
+        //: 3 'moveTail' transfers the objects from the specified position, in
+        //:   order, to the start of the destination array, and 'moveAll'
+        //:   transfers all objects, in order, to the end of the destination
+        //:   array.
+        //:
+        //: 4 The slot-indexed array reuses the slots of erased and transferred
+        //:   objects.
+        //:
+        //: 5 If copying an object throws, 'insert', 'moveTail', and 'moveAll'
+        //:   leave both arrays unchanged, and leak no memory.
+        //:
+        //: 6 The contiguous array exposes its objects in order through 'data'.
+        //
+        // Plan:
+        //: 1 Perform a sequence of insertions, removals and transfers on
+        //:   arrays of 'int' and of 'AllocTestType', verifying their contents
+        //:   after each.  (C-1..4, 6)
+        //:
+        //: 2 Repeat the insertions and transfers on arrays of 'AllocTestType'
+        //:   within the 'bslma' exception-test loop.  (C-5)
+        //
+        // Testing:
+        //   void insert(int position, int count, const TYPE&, ALLOCATOR&);
+        //   void erase(int position, int count, ALLOCATOR&);
+        //   void moveTail(BTree_Array *dest, int pos, int count, ALLOCATOR&);
+        //   void moveAll(BTree_Array *dest, int count, int dn, ALLOCATOR&);
+        //   void destroyAll(int count, ALLOCATOR&);
+        //   TYPE& operator[](int index);
+        //   const TYPE *data() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nNODE STORAGE"
+                            "\n============\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        bsl::allocator<int>       ia(&oa);
+        bsl::allocator<AllocType> aa(&oa);
+
+        if (verbose) printf("\nContiguous array.\n");
+        {
+            BTree_Array<int, 8> mX;  const BTree_Array<int, 8>& X = mX;
+
+            mX.insert(0, 0, 5, ia);     // 5
+            mX.insert(0, 1, 1, ia);     // 1 5
+            mX.insert(2, 2, 9, ia);     // 1 5 9
+            mX.insert(1, 3, 3, ia);     // 1 3 5 9
+            static const int EXP1[] = { 1, 3, 5, 9 };
+            ASSERT(0 == memcmp(EXP1, X.data(), sizeof EXP1));
+
+            mX.erase(1, 4, ia);         // 1 5 9
+            ASSERT(1 == X[0]);  ASSERT(5 == X[1]);  ASSERT(9 == X[2]);
+
+            BTree_Array<int, 8> mY;
+            mX.moveTail(&mY, 1, 3, ia);
+            ASSERT(5 == mY[0]);  ASSERT(9 == mY[1]);
+            ASSERT(1 == X[0]);
+
+            mY[1] = 7;
+            ASSERT(7 == mY[1]);
+
+            mX.moveAll(&mY, 1, 2, ia);
+            ASSERT(5 == mY[0]);  ASSERT(7 == mY[1]);  ASSERT(1 == mY[2]);
+            mY.destroyAll(3, ia);
+        }
+        ASSERT(0 == oa.numBlocksTotal());
+
+        if (verbose) printf("\nSlot-indexed array.\n");
+        {
+            typedef BTree_Array<AllocType, 8> Array;
+
+            Array mX;  const Array& X = mX;
+
+            static const int DATA[] = { 30, 10, 50, 0, 70, 20, 60, 40 };
+
+            int count = 0;
+            for (int i = 0; i < 8; ++i) {
+                int position = 0;
+                while (position < count && X[position].data() < DATA[i]) {
+                    ++position;
+                }
+                mX.insert(position, count, AllocType(DATA[i], &sa), aa);
+                ++count;
+            }
+            for (int i = 0; i < 8; ++i) {
+                ASSERTV(i, X[i].data(), 10 * i == X[i].data());
+                ASSERTV(i, &oa == X[i].allocator());
+            }
+            ASSERT(8 == oa.numBlocksInUse());
+
+            mX.erase(0, count--, aa);
+            mX.erase(3, count--, aa);
+            static const int EXP1[] = { 10, 20, 30, 50, 60, 70 };
+            for (int i = 0; i < count; ++i) {
+                ASSERTV(i, X[i].data(), EXP1[i] == X[i].data());
+            }
+            ASSERT(6 == oa.numBlocksInUse());
+
+            // The erased slots are reused.
+
+            mX.insert(0, count++, AllocType(0, &sa), aa);
+            mX.insert(4, count++, AllocType(40, &sa), aa);
+            for (int i = 0; i < count; ++i) {
+                ASSERTV(i, X[i].data(), 10 * i == X[i].data());
+            }
+
+            Array mY;  const Array& Y = mY;
+            mX.moveTail(&mY, 5, count, aa);
+            for (int i = 0; i < 5; ++i) {
+                ASSERTV(i, X[i].data(), 10 * i == X[i].data());
+            }
+            for (int i = 0; i < 3; ++i) {
+                ASSERTV(i, Y[i].data(), 10 * (i + 5) == Y[i].data());
+            }
+            ASSERT(8 == oa.numBlocksInUse());
+
+            // The transferred slots are reused.
+
+            mX.insert(5, 5, AllocType(99, &sa), aa);
+            mX.insert(6, 6, AllocType(98, &sa), aa);
+            mX.insert(7, 7, AllocType(97, &sa), aa);
+            ASSERT(99 == X[5].data());
+            ASSERT(98 == X[6].data());
+            ASSERT(97 == X[7].data());
+
+            // 'moveAll' appends to the objects of the destination.
+
+            mX.erase(7, 8, aa);
+            mX.erase(6, 7, aa);
+            mX.erase(5, 6, aa);
+            mY.moveAll(&mX, 3, 5, aa);
+            for (int i = 0; i < 8; ++i) {
+                ASSERTV(i, X[i].data(), 10 * i == X[i].data());
+            }
+            ASSERT(8 == oa.numBlocksInUse());
+
+            mX.destroyAll(8, aa);
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\nException safety.\n");
+        {
+            typedef BTree_Array<AllocType, 8> Array;
+
+            Array mX;  const Array& X = mX;
+            for (int i = 0; i < 6; ++i) {
+                mX.insert(i, i, AllocType(i, &sa), aa);
+            }
+
+            const AllocType VALUE(100, &sa);
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                mX.insert(3, 6, VALUE, aa);
+                mX.erase(3, 7, aa);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            for (int i = 0; i < 6; ++i) {
+                ASSERTV(i, X[i].data(), i == X[i].data());
+            }
+            ASSERT(6 == oa.numBlocksInUse());
+
+            Array mY;  const Array& Y = mY;
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                ASSERT(6 == oa.numBlocksInUse());
+
+                mX.moveTail(&mY, 2, 6, aa);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            for (int i = 0; i < 2; ++i) {
+                ASSERTV(i, X[i].data(), i == X[i].data());
+            }
+            for (int i = 0; i < 4; ++i) {
+                ASSERTV(i, Y[i].data(), i + 2 == Y[i].data());
+            }
+            ASSERT(6 == oa.numBlocksInUse());
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                ASSERT(6 == oa.numBlocksInUse());
+
+                mY.moveAll(&mX, 4, 2, aa);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            for (int i = 0; i < 6; ++i) {
+                ASSERTV(i, X[i].data(), i == X[i].data());
+            }
+            ASSERT(6 == oa.numBlocksInUse());
+
+            mX.destroyAll(6, aa);
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, look up and remove a sequence of values large enough to
+        //:   build a tree of several levels.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        typedef BTree<IntConfig, std::less<int>, bsl::allocator<int> > Obj;
+        typedef TestDriver<PairConfig, std::less<int> >::Obj       PairObj;
+
+        if (veryVerbose) {
+            P_(Obj::k_LEAF_CAPACITY)     P(Obj::k_INNER_CAPACITY)
+            P_(PairObj::k_LEAF_CAPACITY) P(PairObj::k_INNER_CAPACITY)
+        }
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(std::less<int>(), &oa);  const Obj& X = mX;
+
+            const int N = 10000;
+            for (int i = 0; i < N; ++i) {
+                bool isInserted;
+                mX.insertIfMissing(&isInserted, (i * 7919) % N);
+                ASSERTV(i, isInserted);
+            }
+            ASSERT(N == X.size());
+            ASSERT(X.isWellFormed());
+            ASSERT(0 < X.height());
+
+            int expected = 0;
+            for (Obj::Iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(expected, *it, expected == *it);
+                ++expected;
+            }
+            ASSERT(N == expected);
+
+            for (int i = 0; i < N; i += 2) {
+                mX.remove(X.find(i));
+            }
+            ASSERT(N / 2 == X.size());
+            ASSERT(X.isWellFormed());
+            ASSERT(X.end() == X.find(4));
+            ASSERT(5       == *X.find(5));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
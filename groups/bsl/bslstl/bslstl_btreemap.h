@@ -0,0 +1,1460 @@
+// bslstl_btreemap.h                                                  -*-C++-*-
+#ifndef INCLUDED_BSLSTL_BTREEMAP
+#define INCLUDED_BSLSTL_BTREEMAP
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an STL-compliant map held in a cache-friendly B-tree.
+//
+//@CLASSES:
+//   bsl::btree_map: STL-compliant ordered map held in a B-tree
+//
+//@SEE_ALSO: bslstl_btree, bslstl_btreeset, bslstl_map
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::btree_map', implementing a container holding an ordered sequence of
+// key-value pairs (having unique keys), and presenting a mapping from the keys
+// (of a template parameter type, 'KEY') to their associated values (of
+// another template parameter type, 'VALUE').  'btree_map' provides the
+// interface of 'bsl::map', but holds its elements in a B+tree (see
+// 'bslstl_btree') whose nodes each hold many contiguous elements, rather than
+// in a red-black tree having one node per element.
+//
+// An instantiation of 'btree_map' is an allocator-aware, value-semantic type
+// whose salient attributes are its size (number of key-value pairs) and the
+// ordered sequence of key-value pairs the map contains.  If 'btree_map' is
+// instantiated with either a key type or mapped-value type that is not itself
+// value-semantic, then it will not retain all of its value-semantic
+// qualities.
+//
+///Choosing Between 'map' and 'btree_map'
+///---------------------------------------
+// A 'btree_map' allocates one node of approximately 256 bytes for many
+// elements, rather than one node per element, so it uses less memory than a
+// 'map' for small elements, and a lookup, or an iteration, touches far fewer
+// cache lines.  If the key type is an arithmetic type, the keys of each node
+// are held contiguously, and if, in addition, 'COMPARATOR' is
+// 'std::less<KEY>', each node is searched by a branch-free scan that
+// compilers can vectorize.  Inserting a sequence of values in ascending order
+// (or copying a 'btree_map') fills every node, and takes linear time.
+//
+// In exchange, 'btree_map' provides weaker guarantees than 'map':
+//: o Inserting or erasing an element invalidates all iterators into the map,
+//:   and all references and pointers to its elements, other than the iterator
+//:   returned by the operation.
+//:
+//: o Erasing elements frees a node only once it is empty; nodes are not
+//:   merged, so a map from which most elements have been erased may use more
+//:   memory than one populated with only the remaining elements (a copy of
+//:   the map is compact).
+//:
+//: o Elements that are not bitwise moveable are copied (and the originals
+//:   destroyed) when the node holding them is split.
+//
+// 'btree_map' does not provide node handles ('extract', and the 'insert'
+// overload taking a node handle), 'merge', or heterogeneous lookup.
+//
+///Requirements on 'KEY' and 'VALUE'
+///---------------------------------
+// A 'btree_map' has the same requirements on its 'KEY' and 'VALUE' types as
+// 'bsl::map' (see {'bslstl_map'|Requirements on 'KEY' and 'VALUE'}).  In
+// addition, if 'KEY' is not an arithmetic type, inner nodes of the tree hold
+// copies of keys, created using the allocator of the map, so 'KEY' must be
+// "copy-constructible".
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a map's 'ALLOCATOR' template parameter determines how
+// that map will allocate memory, exactly as for 'bsl::map' (see
+// {'bslstl_map'|Memory Allocation}).  Every node of the tree, and every
+// element and key held in a node, is allocated using the allocator of the
+// map.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'btree_map':
+//..
+//  Legend
+//  ------
+//  'K'             - template parameter 'KEY' type of 'btree_map'
+//  'V'             - template parameter 'VALUE' type of 'btree_map'
+//  'a', 'b'        - two distinct objects of type 'btree_map<K, V>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'B'             - number of elements in a node of the tree
+//  'value_type'    - 'btree_map<K, V>::value_type'
+//  'c'             - comparator providing an ordering for objects of type 'K'
+//  'al             - an STL-style memory allocator
+//  'i1', 'i2'      - two iterators defining a sequence of 'value_type' objects
+//  'k'             - an object of type 'K'
+//  'v'             - an object of type 'value_type'
+//  'p1', 'p2'      - two iterators belonging to 'a'
+//  distance(i1,i2) - the number of elements in the range [i1, i2)
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | btree_map<K, V> a;    (default construction)       | O[1]               |
+//  | btree_map<K, V> a(al);                             |                    |
+//  | btree_map<K, V> a(c, al);                          |                    |
+//  +----------------------------------------------------+--------------------+
+//  | btree_map<K, V> a(b); (copy construction)          | O[m]               |
+//  | btree_map<K, V> a(b, al);                          |                    |
+//  +----------------------------------------------------+--------------------+
+//  | btree_map<K, V> a(i1, i2);                         | O[N] if [i1, i2)   |
+//  | btree_map<K, V> a(i1, i2, al);                     | is sorted with     |
+//  | btree_map<K, V> a(i1, i2, c, al);                  | 'a.value_comp()',  |
+//  |                                                    | O[N * log(N)]      |
+//  |                                                    | otherwise, where N |
+//  |                                                    | is distance(i1,i2) |
+//  +----------------------------------------------------+--------------------+
+//  | a.~btree_map<K, V>(); (destruction)                | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a = b;                (assignment)                 | O[n + m]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.cbegin(), a.cend(),          | O[1]               |
+//  | a.rbegin(), a.rend(), a.crbegin(), a.crend()       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b                                     | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a < b, a <= b, a > b, a >= b                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a,b)                               | O[1] if 'a' and    |
+//  |                                                    | 'b' use the same   |
+//  |                                                    | allocator,         |
+//  |                                                    | O[n + m] otherwise |
+//  +----------------------------------------------------+--------------------+
+//  | a.size()                                           | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.max_size()                                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.empty()                                          | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | get_allocator()                                    | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a[k]                                               | O[log(n) + B]      |
+//  +----------------------------------------------------+--------------------+
+//  | a.at(k)                                            | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(v)                                        | O[log(n) + B]      |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(p1, v)                                    | amortized O[B] if  |
+//  |                                                    | v is inserted      |
+//  |                                                    | right before p1,   |
+//  |                                                    | O[log(n) + B]      |
+//  |                                                    | otherwise          |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(i1, i2)                                   | O[N] if [i1, i2)   |
+//  |                                                    | follows the last   |
+//  |                                                    | element of 'a' in  |
+//  |                                                    | order, and         |
+//  |                                                    | O[N * (log(n + N)  |
+//  |                                                    | + B)] otherwise,   |
+//  |                                                    | where N is         |
+//  |                                                    | distance(i1,i2)    |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1)                                        | O[B]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(k)                                         | O[log(n) + B]      |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1, p2)                                    | O[N * B] where N   |
+//  |                                                    | is distance(p1,p2) |
+//  +----------------------------------------------------+--------------------+
+//  | a.clear()                                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.key_comp()                                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.value_comp()                                     | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.contains(k), a.count(k), a.find(k)               | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.lower_bound(k)                                   | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.upper_bound(k)                                   | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.equal_range(k)                                   | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Indexing Prices by Instrument Identifier
+///- - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain the last traded price of each of a large number of
+// instruments, identified by integers, and look prices up far more often
+// than we add instruments.  A 'btree_map' keyed by 'int' keeps the keys of
+// each node contiguous, so that each lookup touches only a few cache lines.
+//
+// First, we create a map, supplying a test allocator:
+//..
+//  bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+//
+//  typedef bsl::btree_map<int, double> PriceMap;
+//  PriceMap prices(&oa);
+//..
+// Then, we load an initial set of prices, received ordered by identifier, so
+// that each is appended to the last node of the tree:
+//..
+//  for (int id = 1000; id < 2000; ++id) {
+//      prices.insert(prices.end(), PriceMap::value_type(id, id / 100.0));
+//  }
+//  assert(1000 == prices.size());
+//..
+// Next, we update some prices, and add a new instrument, using 'operator[]':
+//..
+//  prices[1500]  = 16.0;
+//  prices[2500]  = 25.0;
+//  assert(1001  == prices.size());
+//..
+// Now, we look up prices:
+//..
+//  assert(16.0        == prices.at(1500));
+//  assert(prices.end() == prices.find(999));
+//  assert(prices.contains(2500));
+//..
+// Finally, we visit the instruments in a range of identifiers, in order:
+//..
+//  double total = 0.0;
+//  for (PriceMap::const_iterator it  = prices.lower_bound(1990);
+//                                it != prices.upper_bound(1994);
+//                                ++it) {
+//      total += it->second;
+//  }
+//  assert(19.90 + 19.91 + 19.92 + 19.93 + 19.94 == total);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_BTREE
+#include <bslstl_btree.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_UNORDEREDMAPKEYCONFIGURATION
+#include <bslstl_unorderedmapkeyconfiguration.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RANGECOMPARE
+#include <bslalg_rangecompare.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+namespace bsl {
+
+                             // ===============
+                             // class btree_map
+                             // ===============
+
+template <class KEY,
+          class VALUE,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = allocator<bsl::pair<const KEY, VALUE> > >
+class btree_map {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of key-value pairs having unique keys that provide a
+    // mapping from keys (of the template parameter type, 'KEY') to their
+    // associated values (of another template parameter type, 'VALUE'), held
+    // in the leaves of a B+tree.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral* (agnostic except for the 'at' method)
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    // PRIVATE TYPES
+    typedef pair<const KEY, VALUE>                                 ValueType;
+        // This typedef is an alias for the type of key-value pair objects
+        // maintained by this map.
+
+    typedef BloombergLP::bslstl::UnorderedMapKeyConfiguration<ValueType>
+                                                                   KeyConfig;
+        // This typedef is an alias for the policy used to extract the key
+        // from each key-value pair.
+
+    typedef BloombergLP::bslstl::BTree<KeyConfig, COMPARATOR, ALLOCATOR>
+                                                                   Impl;
+        // This typedef is an alias for the tree implementing this map.
+
+    typedef typename bsl::allocator_traits<ALLOCATOR> AllocatorTraits;
+        // This typedef is an alias for the allocator traits type associated
+        // with this container.
+
+    // DATA
+    Impl d_impl;  // tree of key-value pairs
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef VALUE                                      mapped_type;
+    typedef bsl::pair<const KEY, VALUE>                value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef typename Impl::Iterator                    iterator;
+    typedef typename Impl::ConstIterator               const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+    class value_compare {
+        // This nested class defines a mechanism for comparing two objects of
+        // 'value_type' using the (template parameter) type 'COMPARATOR'.  Note
+        // that this class exactly matches the definition of
+        // 'map::value_compare' in the C++11 standard [23.4.4.1].
+
+        // FRIENDS
+        friend class btree_map;
+
+      protected:
+        COMPARATOR comp;  // we would not have elected to make this data
+                          // member protected ourselves
+
+        value_compare(COMPARATOR comparator);                       // IMPLICIT
+            // Create a 'value_compare' object that will delegate to the
+            // specified 'comparator' for comparisons.
+
+      public:
+        typedef bool result_type;
+            // This 'typedef' is an alias for the result type of a call to the
+            // overload of 'operator()' (the comparison function) provided by a
+            // 'btree_map::value_compare' object.
+
+        typedef value_type first_argument_type;
+            // This 'typedef' is an alias for the type of the first parameter
+            // of the overload of 'operator()' (the comparison function)
+            // provided by a 'btree_map::value_compare' object.
+
+        typedef value_type second_argument_type;
+            // This 'typedef' is an alias for the type of the second parameter
+            // of the overload of 'operator()' (the comparison function)
+            // provided by a 'btree_map::value_compare' object.
+
+        bool operator()(const value_type& x, const value_type& y) const;
+            // Return 'true' if the specified 'x' object is ordered before the
+            // specified 'y' object, as determined by the comparator supplied
+            // at construction.
+    };
+
+    // CREATORS
+    explicit btree_map(const COMPARATOR& comparator     = COMPARATOR(),
+                       const ALLOCATOR&  basicAllocator = ALLOCATOR())
+        // Construct an empty map.  Optionally specify a 'comparator' used to
+        // order key-value pairs contained in this object.  If 'comparator' is
+        // not supplied, a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' is used.  Optionally specify the
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'ALLOCATOR' is used.  If the 'ALLOCATOR' is 'bsl::allocator'
+        // (the default), then 'basicAllocator', if supplied, shall be
+        // convertible to 'bslma::Allocator *'.  If the 'ALLOCATOR' is
+        // 'bsl::allocator' and 'basicAllocator' is not supplied, the currently
+        // installed default allocator will be used to supply memory.
+    : d_impl(comparator, basicAllocator)
+    {
+        // The implementation is placed here in the class definition to
+        // workaround an AIX compiler bug, where the constructor can fail to
+        // compile because it is unable to find the definition of the default
+        // argument.  This occurs when a templatized class wraps around the
+        // container and the comparator is defined after the new class.
+    }
+
+    explicit btree_map(const ALLOCATOR& basicAllocator);
+        // Construct an empty map that will use the specified 'basicAllocator'
+        // to supply memory.  Use a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' to order the key-value pairs contained
+        // in this map.  If the (template parameter) type 'ALLOCATOR' is of
+        // 'bsl::allocator' (the default) then 'basicAllocator' shall be
+        // convertible to 'bslma::Allocator *'.
+
+    btree_map(const btree_map& original);
+        // Construct a map having the same value as the specified 'original'.
+        // Use a copy of 'original.key_comp()' to order the key-value pairs
+        // contained in this map.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // allocate memory.  If the (template parameter) type 'ALLOCATOR' is of
+        // type 'bsl::allocator' (the default), the currently installed default
+        // allocator will be used to supply memory.  The nodes of the new map
+        // are full, other than the last.  This method requires that the
+        // (template parameter) types 'KEY' and 'VALUE' both be
+        // "copy-constructible" (see {Requirements on 'KEY' and 'VALUE'}).
+
+    btree_map(const btree_map& original, const ALLOCATOR& basicAllocator);
+        // Construct a map having the same value as that of the specified
+        // 'original' that will use the specified 'basicAllocator' to supply
+        // memory.  Use a copy of 'original.key_comp()' to order the key-value
+        // pairs contained in this map.  If the (template parameter) type
+        // 'ALLOCATOR' is 'bsl::allocator' (the default) then 'basicAllocator'
+        // shall be convertible to 'bslma::Allocator *'.  The nodes of the new
+        // map are full, other than the last.  This method requires that the
+        // (template parameter) types 'KEY' and 'VALUE' types both be
+        // "copy-constructible" (see {Requirements on 'KEY' and 'VALUE'}).
+
+    template <class INPUT_ITERATOR>
+    btree_map(INPUT_ITERATOR    first,
+              INPUT_ITERATOR    last,
+              const COMPARATOR& comparator     = COMPARATOR(),
+              const ALLOCATOR&  basicAllocator = ALLOCATOR());
+        // Construct a map, and insert each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, ignoring those pairs having a
+        // key that appears earlier in the sequence.  Optionally specify a
+        // 'comparator' used to order key-value pairs contained in this object.
+        // If 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // the 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied, a default-constructed object of the (template
+        // parameter) type 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is
+        // 'bsl::allocator' (the default) then 'basicAllocator', if supplied,
+        // shall be convertible to 'bslma::Allocator *'.  If the sequence
+        // 'first' and 'last' is ordered according to the identified
+        // 'comparator' then this operation will have O[N] complexity, and
+        // fill every node of the map but the last, where N is the number of
+        // elements between 'first' and 'last', otherwise this operation will
+        // have O[N * log(N)] complexity.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values of
+        // a type convertible to 'value_type'.  The behavior is undefined
+        // unless 'first' and 'last' refer to a sequence of valid values where
+        // 'first' is at a position at or before 'last'.  This method requires
+        // that the (template parameter) types 'KEY' and 'VALUE' both be
+        // "copy-constructible" (see {Requirements on 'KEY' and 'VALUE'}).
+
+    ~btree_map();
+        // Destroy this object.
+
+    // MANIPULATORS
+    btree_map& operator=(const btree_map& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if the
+        // 'ALLOCATOR' type has trait 'propagate_on_container_copy_assignment',
+        // and return a reference providing modifiable access to this object.
+        // This method requires that the (template parameter) types 'KEY' and
+        // 'VALUE' both be "copy-constructible" (see {Requirements on 'KEY' and
+        // 'VALUE'}).
+
+    VALUE& operator[](const key_type& key);
+        // Return a reference providing modifiable access to the mapped-value
+        // associated with the specified 'key'; if this map does not already
+        // contain a 'value_type' object with 'key', first insert a new
+        // 'value_type' object having 'key' and a default-constructed 'VALUE'
+        // object.  This method requires that the (template parameter) type
+        // 'KEY' is "copy-constructible" and the (template parameter) 'VALUE'
+        // is "default-constructible" (see {Requirements on 'KEY' and
+        // 'VALUE'}).  Note that inserting an element invalidates all
+        // iterators into this map.
+
+    VALUE& at(const key_type& key);
+        // Return a reference providing modifiable access to the mapped-value
+        // associated with the specified 'key', if such an entry exists;
+        // otherwise throw an 'std::out_of_range' exception.  Note that this
+        // method is not exception agnostic.
+
+    iterator begin();
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or the 'end' iterator if this map is empty.
+
+    iterator end();
+        // Return an iterator providing modifiable access to the past-the-end
+        // element in the ordered sequence of 'value_type' objects maintained
+        // by this map.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator providing modifiable access to the last
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or 'rend' if this map is empty.
+
+    reverse_iterator rend();
+        // Return a reverse iterator providing modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this map.
+
+    pair<iterator, bool> insert(const value_type& value);
+        // Insert the specified 'value' into this map if the key (the 'first'
+        // element) of the 'value' does not already exist in this map;
+        // otherwise, if a 'value_type' object having the same key (according
+        // to the comparator provided at construction) as 'value' already
+        // exists in this map, this method has no effect.  Return a pair whose
+        // 'first' member is an iterator referring to the (possibly newly
+        // inserted) 'value_type' object in this map whose key is the same as
+        // that of 'value', and whose 'second' member is 'true' if a new value
+        // was inserted, and 'false' if the value was already present.  If a
+        // value is inserted, all other iterators into this map are
+        // invalidated.  This method requires that the (template parameter)
+        // types 'KEY' and 'VALUE' both be "copy-constructible" (see
+        // {Requirements on 'KEY' and 'VALUE'}).
+
+    iterator insert(const_iterator hint, const value_type& value);
+        // Insert the specified 'value' into this map (in amortized constant
+        // time if the specified 'hint' is a valid immediate successor to the
+        // key of 'value'), if the key (the 'first' element) of the 'value'
+        // does not already exist in this map; otherwise, if a 'value_type'
+        // object having the same key (according to the comparator provided at
+        // construction) as 'value' already exists in this map, this method
+        // has no effect.  Return an iterator referring to the (possibly newly
+        // inserted) 'value_type' object in this map whose key is the same as
+        // that of 'value'.  If 'hint' is not a valid immediate successor to
+        // the key of 'value', this operation will have O[log(N)] complexity,
+        // where 'N' is the size of this map.  If a value is inserted, all
+        // other iterators into this map are invalidated.  The behavior is
+        // undefined unless 'hint' is a valid iterator into this map.  This
+        // method requires that the (template parameter) types 'KEY' and
+        // 'VALUE' both be "copy-constructible" (see {Requirements on 'KEY'
+        // and 'VALUE'}).
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map the value of each 'value_type' object in the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, whose key is not
+        // already contained in this map.  Each value is inserted with the
+        // 'end' position as hint, so that inserting an ordered sequence
+        // following the last element of this map fills each node in turn.
+        // The (template parameter) type 'INPUT_ITERATOR' shall meet the
+        // requirements of an input iterator defined in the C++11 standard
+        // [24.2.3] providing access to values of a type convertible to
+        // 'value_type'.  The behavior is undefined unless 'first' and 'last'
+        // refer to a sequence of valid values where 'first' is at a position
+        // at or before 'last'.  This method requires that the (template
+        // parameter) types 'KEY' and 'VALUE' both be "copy-constructible" (see
+        // {Requirements on 'KEY' and 'VALUE'}).
+
+    iterator erase(const_iterator position);
+        // Remove from this map the 'value_type' object at the specified
+        // 'position', and return an iterator referring to the element
+        // immediately following the removed element, or to the past-the-end
+        // position if the removed element was the last in the sequence.  All
+        // other iterators into this map are invalidated.  The behavior is
+        // undefined unless 'position' refers to a 'value_type' object in this
+        // map.
+
+    size_type erase(const key_type& key);
+        // Remove from this map the 'value_type' object having the specified
+        // 'key', if it exists, and return 1; otherwise, if there is no
+        // 'value_type' object having 'key', return 0 with no other effect.
+        // If an element is removed, all iterators into this map are
+        // invalidated.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this map the 'value_type' objects starting at the
+        // specified 'first' position up to, but including the specified 'last'
+        // position, and return 'last'.  All other iterators into this map are
+        // invalidated.  The behavior is undefined unless 'first' and 'last'
+        // either refer to elements in this map or are the 'end' iterator, and
+        // the 'first' position is at or before the 'last' position in the
+        // ordered sequence provided by this container.
+
+    void swap(btree_map& other);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object; also exchange the allocator of this object
+        // with that of 'other' if the (template parameter) type 'ALLOCATOR'
+        // has the 'propagate_on_container_swap' trait, and do not modify
+        // either allocator otherwise.  This method provides the no-throw
+        // exception-safety guarantee if the allocators are exchanged or are
+        // equal, and provides the basic exception-safety guarantee (by
+        // exchanging copies of the two maps) otherwise.
+
+    void clear();
+        // Remove all entries from this map.  Note that the map is empty after
+        // this call, but allocated memory may be retained for future use.
+
+    iterator find(const key_type& key);
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object in this map having the specified 'key', if such an entry
+        // exists, and the past-the-end ('end') iterator otherwise.
+
+    iterator lower_bound(const key_type& key);
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this map whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this map does not contain a 'value_type' object whose
+        // key is greater-than or equal-to 'key'.
+
+    iterator upper_bound(const key_type& key);
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this map whose key is greater
+        // than the specified 'key', and the past-the-end iterator if this map
+        // does not contain a 'value_type' object whose key is greater-than
+        // 'key'.
+
+    pair<iterator, iterator> equal_range(const key_type& key);
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this map having the specified
+        // 'key', where the the first iterator is positioned at the start of
+        // the sequence, and the second is positioned one past the end of the
+        // sequence.  If this map contains no 'value_type' objects having
+        // 'key', then the two returned iterators will have the same value.
+
+    // ACCESSORS
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // map.
+
+    const_iterator begin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or the 'end' iterator if this map is empty.
+
+    const_iterator end() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type'
+        // objects maintained by this map.
+
+    const_reverse_iterator rbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this map, or 'rend' if this map is empty.
+
+    const_reverse_iterator rend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this map.
+
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this map, or the 'cend' iterator if this map is empty.
+
+    const_iterator cend() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type' objects
+        // maintained by this map.
+
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this map, or 'crend' if this map is empty.
+
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this map.
+
+    bool empty() const;
+        // Return 'true' if this map contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const;
+        // Return the number of elements in this map.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this map could possibly hold.  Note that there is no guarantee
+        // that the map can successfully grow to the returned size, or even
+        // close to that size without running out of resources.
+
+    const VALUE& at(const key_type& key) const;
+        // Return a reference providing non-modifiable access to the
+        // mapped-value associated with the specified 'key', if such an entry
+        // exists; otherwise throw an 'std::out_of_range' exception.  Note
+        // that this method is not exception agnostic.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by this
+        // map; if a comparator was supplied at construction, return its value,
+        // otherwise return a default constructed 'key_compare' object.  Note
+        // that this comparator compares objects of type 'KEY', which is the
+        // key part of the 'value_type' objects contained in this map.
+
+    value_compare value_comp() const;
+        // Return a functor for comparing two 'value_type' objects by comparing
+        // their respective keys using 'key_comp()'.   Note that this
+        // comparator compares objects of type 'value_type' (i.e.,
+        // 'bsl::pair<const KEY, VALUE>').
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this map having the specified 'key', if such
+        // an entry exists, and the past-the-end ('end') iterator otherwise.
+
+    size_type count(const key_type& key) const;
+        // Return the number of 'value_type' objects within this map having the
+        // specified 'key'.  Note that since a map maintains unique keys, the
+        // returned value will be either 0 or 1.
+
+    bool contains(const key_type& key) const;
+        // Return 'true' if this map contains a 'value_type' object having the
+        // specified 'key', and 'false' otherwise.
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this map whose key is
+        // greater-than or equal-to the specified 'key', and the past-the-end
+        // iterator if this map does not contain a 'value_type' object whose
+        // key is greater-than or equal-to 'key'.
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this map whose key is
+        // greater than the specified 'key', and the past-the-end iterator if
+        // this map does not contain a 'value_type' object whose key is
+        // greater-than 'key'.
+
+    pair<const_iterator, const_iterator> equal_range(const key_type& key)
+                                                                         const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this map having the specified
+        // 'key', where the the first iterator is positioned at the start of
+        // the sequence, and the second is positioned one past the end of the
+        // sequence.  If this map contains no 'value_type' objects having
+        // 'key', then the two returned iterators will have the same value.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator==(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'btree_map' objects have the same
+    // value if they have the same number of key-value pairs, and each
+    // key-value pair that is contained in one of the objects is also contained
+    // in the other object.  This method requires that the (template parameter)
+    // types 'KEY' and 'VALUE' both be "equality-comparable" (see {Requirements
+    // on 'KEY' and 'VALUE'}).
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'btree_map' objects do not have
+    // the same value if they do not have the same number of key-value pairs,
+    // or some key-value pair that is contained in one of the objects is not
+    // also contained in the other object.  This method requires that the
+    // (template parameter) types 'KEY' and 'VALUE' both be
+    // "equality-comparable" (see {Requirements on 'KEY' and 'VALUE'}).
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' value is less than the specified
+    // 'rhs' value, and 'false' otherwise.  A map, 'lhs', has a value that is
+    // less than that of 'rhs', if, for the first non-equal corresponding
+    // key-value pairs in their respective sequences, the 'lhs' key-value pair
+    // is less than the 'rhs' pair, or, if the keys of all of their
+    // corresponding key-value pairs compare equal, 'lhs' has fewer key-value
+    // pairs than 'rhs'.  This method requires that the (template parameter)
+    // types 'KEY' and 'VALUE' both be "less-than-comparable" (see
+    // {Requirements on 'KEY' and 'VALUE'}).
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' value is greater than the specified
+    // 'rhs' value, and 'false' otherwise.  A map, 'lhs', has a value that is
+    // greater than that of 'rhs', if, for the first non-equal corresponding
+    // key-value pairs in their respective sequences, the 'lhs' key-value pair
+    // is greater than the 'rhs' pair, or, if the keys of all of their
+    // corresponding key-value pairs compare equal, 'lhs' has more key-value
+    // pairs than 'rhs'.  This method requires that the (template parameter)
+    // types 'KEY' and 'VALUE' both be "less-than-comparable" (see
+    // {Requirements on 'KEY' and 'VALUE'}).
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' value is less-than or equal-to the
+    // specified 'rhs' value, and 'false' otherwise.  A map, 'lhs', has a value
+    // that is less-than or equal-to that of 'rhs', if, for the first non-equal
+    // corresponding key-value pairs in their respective sequences, the 'lhs'
+    // key-value pair is less than the 'rhs' pair, or, if the keys of all of
+    // their corresponding key-value pairs compare equal, 'lhs' has less-than
+    // or equal number of key-value pairs as 'rhs'.  This method requires that
+    // the (template parameter) types 'KEY' and 'VALUE' both be
+    // "less-than-comparable" (see {Requirements on 'KEY' and 'VALUE'}).
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' value is greater-than or equal-to
+    // the specified 'rhs' value, and 'false' otherwise.  A map, 'lhs', has a
+    // value that is greater-than or equal-to that of 'rhs', if, for the first
+    // non-equal corresponding key-value pairs in their respective sequences,
+    // the 'lhs' key-value pair is greater than the 'rhs' pair, or, if the keys
+    // of all of their corresponding key-value pairs compare equal, 'lhs' has
+    // greater-than or equal number of key-value pairs as 'rhs'.  This method
+    // requires that the (template parameter) types 'KEY' and 'VALUE' both be
+    // "less-than-comparable" (see {Requirements on 'KEY' and 'VALUE'}).
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void swap(btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+          btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& b);
+    // Swap both the value and the comparator of the specified 'a' object with
+    // the value and comparator of the specified 'b' object.  Additionally if
+    // 'bslstl::AllocatorTraits<ALLOCATOR>::propagate_on_container_swap' is
+    // 'true' then exchange the allocator of 'a' with that of 'b', and do not
+    // modify either allocator otherwise.  This method provides the no-throw
+    // exception-safety guarantee and guarantees O[1] complexity if the
+    // allocators are exchanged or are equal.
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                         // ------------------------------
+                         // class btree_map::value_compare
+                         // ------------------------------
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare::value_compare(
+                                                         COMPARATOR comparator)
+: comp(comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare::operator()(
+                                                    const value_type& x,
+                                                    const value_type& y) const
+{
+    return comp(x.first, y.first);
+}
+
+                             // ---------------
+                             // class btree_map
+                             // ---------------
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::btree_map(
+                                               const ALLOCATOR& basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::btree_map(
+                                                    const btree_map& original)
+: d_impl(original.d_impl,
+         AllocatorTraits::select_on_container_copy_construction(
+                                                 original.get_allocator()))
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::btree_map(
+                                              const btree_map& original,
+                                              const ALLOCATOR& basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::btree_map(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              const COMPARATOR& comparator,
+                                              const ALLOCATOR&  basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+    // If an exception is thrown, the destructor of the (fully constructed)
+    // 'd_impl' member releases the elements inserted so far.
+
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::~btree_map()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(const btree_map& rhs)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(this != &rhs)) {
+
+        if (AllocatorTraits::propagate_on_container_copy_assignment::value) {
+            btree_map other(rhs, rhs.get_allocator());
+            d_impl.quickSwapExchangeAllocators(&other.d_impl);
+        }
+        else {
+            btree_map other(rhs, get_allocator());
+            d_impl.quickSwapRetainAllocators(&other.d_impl);
+        }
+    }
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+VALUE& btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator[](
+                                                           const key_type& key)
+{
+    iterator it = lower_bound(key);
+    if (it == end() || d_impl.comparator()(key, it->first)) {
+        bool isInserted;
+        it = d_impl.insertIfMissing(&isInserted,
+                                    it,
+                                    value_type(key, VALUE()));
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+VALUE& btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::at(const key_type& key)
+{
+    iterator it = find(key);
+    if (it == end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                           "btree_map<...>::at(key_type): invalid key value");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin()
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::end()
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator,
+          bool>
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    bool     isInserted;
+    iterator it = d_impl.insertIfMissing(&isInserted, value);
+    return bsl::pair<iterator, bool>(it, isInserted);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
+                                                     const value_type& value)
+{
+    bool isInserted;
+    return d_impl.insertIfMissing(&isInserted, hint, value);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                        INPUT_ITERATOR first,
+                                                        INPUT_ITERATOR last)
+{
+    // Hinting each value at 'end' appends an ordered sequence to the last
+    // node without searching the tree; any other value is located by a
+    // search (see 'BTree::insertIfMissing').
+
+    bool isInserted;
+    while (first != last) {
+        d_impl.insertIfMissing(&isInserted, d_impl.end(), *first);
+        ++first;
+    }
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_impl.remove(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const_iterator it = find(key);
+    if (it == end()) {
+        return 0;                                                     // RETURN
+    }
+    d_impl.remove(it);
+    return 1;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                                    const_iterator last)
+{
+    // Removing an element invalidates every other iterator, including 'last',
+    // so count the elements to remove before removing any.
+
+    difference_type numElements = bsl::distance(first, last);
+
+    iterator position(first.leaf(), first.index());
+    for (; numElements > 0; --numElements) {
+        position = d_impl.remove(position);
+    }
+    return position;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::swap(btree_map& other)
+{
+    if (AllocatorTraits::propagate_on_container_swap::value) {
+        d_impl.quickSwapExchangeAllocators(&other.d_impl);
+    }
+    else {
+        // C++11 behavior: undefined for unequal allocators
+        // BSLS_ASSERT(allocator() == other.allocator());
+
+        // backward compatible behavior: swap with copies
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                   get_allocator() == other.get_allocator())) {
+            d_impl.quickSwapRetainAllocators(&other.d_impl);
+        }
+        else {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            btree_map thisCopy(*this, other.get_allocator());
+            btree_map otherCopy(other, get_allocator());
+
+            d_impl.quickSwapRetainAllocators(&otherCopy.d_impl);
+            other.d_impl.quickSwapRetainAllocators(&thisCopy.d_impl);
+        }
+    }
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_impl.removeAll();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key)
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(const key_type& key)
+{
+    return d_impl.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(const key_type& key)
+{
+    return d_impl.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator,
+          typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator>
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key)
+{
+    iterator startIt = lower_bound(key);
+    iterator endIt   = startIt;
+    if (endIt != end() && !d_impl.comparator()(key, endIt->first)) {
+        ++endIt;
+    }
+    return bsl::pair<iterator, iterator>(startIt, endIt);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::allocator_type
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return d_impl.allocator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::cbegin() const
+{
+    return begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::cend() const
+{
+    return end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::crbegin() const
+{
+    return rbegin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::crend() const
+{
+    return rend();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return 0 == d_impl.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_impl.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::max_size() const
+{
+    return d_impl.maxSize();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+const VALUE& btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::at(
+                                                     const key_type& key) const
+{
+    const_iterator it = find(key);
+    if (it == end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                           "btree_map<...>::at(key_type): invalid key value");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_compare
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_impl.comparator();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return value_compare(key_comp());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return contains(key) ? 1 : 0;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::contains(
+                                                     const key_type& key) const
+{
+    return d_impl.find(key) != d_impl.end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                     const key_type& key) const
+{
+    return d_impl.lowerBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                     const key_type& key) const
+{
+    return d_impl.upperBound(key);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<
+      typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator,
+      typename btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator>
+btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(
+                                                     const key_type& key) const
+{
+    const_iterator startIt = lower_bound(key);
+    const_iterator endIt   = startIt;
+    if (endIt != end() && !d_impl.comparator()(key, endIt->first)) {
+        ++endIt;
+    }
+    return bsl::pair<const_iterator, const_iterator>(startIt, endIt);
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(
+                 const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                 const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+                 const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                 const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(
+                 const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                 const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(
+                 const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                 const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+                 const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                 const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+                 const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                 const bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+               bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for STL *ordered* containers:
+//: o An ordered container defines STL iterators.
+//: o An ordered container uses 'bslma' allocators if the parameterized
+//:     'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::btree_map<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
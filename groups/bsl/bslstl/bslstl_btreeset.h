@@ -0,0 +1,1285 @@
+// bslstl_btreeset.h                                                  -*-C++-*-
+#ifndef INCLUDED_BSLSTL_BTREESET
+#define INCLUDED_BSLSTL_BTREESET
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an STL-compliant set held in a cache-friendly B-tree.
+//
+//@CLASSES:
+//   bsl::btree_set: STL-compliant ordered set held in a B-tree
+//
+//@SEE_ALSO: bslstl_btree, bslstl_btreemap, bslstl_set
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::btree_set', implementing a container holding an ordered sequence of
+// unique keys (of a template parameter type, 'KEY').  'btree_set' provides
+// the interface of 'bsl::set', but holds its elements in a B+tree (see
+// 'bslstl_btree') whose nodes each hold many contiguous elements, rather than
+// in a red-black tree having one node per element.
+//
+// An instantiation of 'btree_set' is an allocator-aware, value-semantic type
+// whose salient attributes are its size (number of keys) and the ordered
+// sequence of keys the set contains.  If 'btree_set' is instantiated with a
+// key type that is not itself value-semantic, then it will not retain all of
+// its value-semantic qualities.
+//
+///Choosing Between 'set' and 'btree_set'
+///---------------------------------------
+// A 'btree_set' allocates one node of approximately 256 bytes for many
+// elements, rather than one node per element, so it uses less memory than a
+// 'set' for small keys, and a lookup, or an iteration, touches far fewer
+// cache lines.  If 'KEY' is an arithmetic type, the keys of each node are
+// held in a contiguous array, and if, in addition, 'COMPARATOR' is
+// 'std::less<KEY>', each node is searched by a branch-free scan that
+// compilers can vectorize.  Inserting a sequence of keys in ascending order
+// (or copying a 'btree_set') fills every node, and takes linear time.
+//
+// In exchange, 'btree_set' provides weaker guarantees than 'set':
+//: o Inserting or erasing an element invalidates all iterators into the set,
+//:   and all references and pointers to its elements, other than the iterator
+//:   returned by the operation.
+//:
+//: o Erasing elements frees a node only once it is empty; nodes are not
+//:   merged, so a set from which most elements have been erased may use more
+//:   memory than one populated with only the remaining elements (a copy of
+//:   the set is compact).
+//:
+//: o Elements that are not bitwise moveable are copied (and the originals
+//:   destroyed) when the node holding them is split.
+//
+// 'btree_set' does not provide node handles ('extract', and the 'insert'
+// overload taking a node handle), 'merge', or heterogeneous lookup.
+//
+///Requirements on 'KEY'
+///---------------------
+// A 'btree_set' has the same requirements on its 'KEY' type as 'bsl::set'
+// (see {'bslstl_set'|Requirements on 'KEY'}).  In addition, if 'KEY' is not
+// an arithmetic type, inner nodes of the tree hold copies of keys, created
+// using the allocator of the set, so 'KEY' must be "copy-constructible".
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a set's 'ALLOCATOR' template parameter determines how
+// that set will allocate memory, exactly as for 'bsl::set' (see
+// {'bslstl_set'|Memory Allocation}).  Every node of the tree, and every key
+// held in a node, is allocated using the allocator of the set.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'btree_set':
+//..
+//  Legend
+//  ------
+//  'K'             - template parameter 'KEY' type of 'btree_set'
+//  'a', 'b'        - two distinct objects of type 'btree_set<K>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'B'             - number of elements in a node of the tree
+//  'c'             - comparator providing an ordering for objects of type 'K'
+//  'al             - an STL-style memory allocator
+//  'i1', 'i2'      - two iterators defining a sequence of 'K' objects
+//  'k'             - an object of type 'K'
+//  'p1', 'p2'      - two iterators belonging to 'a'
+//  distance(i1,i2) - the number of elements in the range [i1, i2)
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | btree_set<K> a;    (default construction)          | O[1]               |
+//  | btree_set<K> a(al);                                |                    |
+//  | btree_set<K> a(c, al);                             |                    |
+//  +----------------------------------------------------+--------------------+
+//  | btree_set<K> a(b); (copy construction)             | O[m]               |
+//  | btree_set<K> a(b, al);                             |                    |
+//  +----------------------------------------------------+--------------------+
+//  | btree_set<K> a(i1, i2);                            | O[N] if [i1, i2)   |
+//  | btree_set<K> a(i1, i2, al);                        | is sorted with     |
+//  | btree_set<K> a(i1, i2, c, al);                     | 'a.value_comp()',  |
+//  |                                                    | O[N * log(N)]      |
+//  |                                                    | otherwise, where N |
+//  |                                                    | is distance(i1,i2) |
+//  +----------------------------------------------------+--------------------+
+//  | a.~btree_set<K>(); (destruction)                   | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a = b;             (assignment)                    | O[n + m]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.cbegin(), a.cend(),          | O[1]               |
+//  | a.rbegin(), a.rend(), a.crbegin(), a.crend()       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b                                     | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a < b, a <= b, a > b, a >= b                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a,b)                               | O[1] if 'a' and    |
+//  |                                                    | 'b' use the same   |
+//  |                                                    | allocator,         |
+//  |                                                    | O[n + m] otherwise |
+//  +----------------------------------------------------+--------------------+
+//  | a.size()                                           | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.max_size()                                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.empty()                                          | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | get_allocator()                                    | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(k)                                        | O[log(n) + B]      |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(p1, k)                                    | amortized O[B] if  |
+//  |                                                    | k is inserted      |
+//  |                                                    | right before p1,   |
+//  |                                                    | O[log(n) + B]      |
+//  |                                                    | otherwise          |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(i1, i2)                                   | O[N] if [i1, i2)   |
+//  |                                                    | follows the last   |
+//  |                                                    | element of 'a' in  |
+//  |                                                    | order, and         |
+//  |                                                    | O[N * (log(n + N)  |
+//  |                                                    | + B)] otherwise,   |
+//  |                                                    | where N is         |
+//  |                                                    | distance(i1,i2)    |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1)                                        | O[B]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(k)                                         | O[log(n) + B]      |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1, p2)                                    | O[N * B] where N   |
+//  |                                                    | is distance(p1,p2) |
+//  +----------------------------------------------------+--------------------+
+//  | a.clear()                                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.key_comp()                                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.value_comp()                                     | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.contains(k), a.count(k), a.find(k)               | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.lower_bound(k)                                   | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.upper_bound(k)                                   | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.equal_range(k)                                   | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Tracking Active Order Identifiers
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we track the identifiers of the orders currently open on a trading
+// venue.  Identifiers are assigned in increasing order, so new identifiers
+// are appended at the end of the set, and orders are closed in roughly the
+// order they were opened.
+//
+// First, we create a set, supplying a test allocator:
+//..
+//  bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+//
+//  typedef bsl::btree_set<int> OrderIdSet;
+//  OrderIdSet openOrders(&oa);
+//..
+// Then, we open 500 orders, hinting each identifier at the end of the set so
+// that the identifiers fill each node of the tree in turn:
+//..
+//  for (int id = 1; id <= 500; ++id) {
+//      openOrders.insert(openOrders.end(), id);
+//  }
+//  assert(500 == openOrders.size());
+//..
+// Next, we close the oldest 100 orders, and one more in the middle:
+//..
+//  openOrders.erase(openOrders.begin(), openOrders.find(101));
+//  assert(1 == openOrders.erase(250));
+//  assert(399 == openOrders.size());
+//..
+// Now, we confirm which orders are open:
+//..
+//  assert(!openOrders.contains(100));
+//  assert( openOrders.contains(101));
+//  assert(!openOrders.contains(250));
+//  assert(101 == *openOrders.begin());
+//  assert(500 == *openOrders.rbegin());
+//..
+// Finally, we count the orders having an identifier in the range
+// '[200 .. 300)', which is missing order 250:
+//..
+//  assert(99 == bsl::distance(openOrders.lower_bound(200),
+//                             openOrders.lower_bound(300)));
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_BTREE
+#include <bslstl_btree.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_UNORDEREDSETKEYCONFIGURATION
+#include <bslstl_unorderedsetkeyconfiguration.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RANGECOMPARE
+#include <bslalg_rangecompare.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+namespace bsl {
+
+                             // ===============
+                             // class btree_set
+                             // ===============
+
+template <class KEY,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = allocator<KEY> >
+class btree_set {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of unique keys (of the template parameter type,
+    // 'KEY'), held in the leaves of a B+tree.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::UnorderedSetKeyConfiguration<KEY> KeyConfig;
+        // This typedef is an alias for the policy used to extract the key
+        // from each element, which is the element itself.
+
+    typedef BloombergLP::bslstl::BTree<KeyConfig, COMPARATOR, ALLOCATOR>
+                                                                   Impl;
+        // This typedef is an alias for the tree implementing this set.
+
+    typedef typename bsl::allocator_traits<ALLOCATOR> AllocatorTraits;
+        // This typedef is an alias for the allocator traits type associated
+        // with this container.
+
+    // DATA
+    Impl d_impl;  // tree of keys
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef KEY                                        value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef COMPARATOR                                 value_compare;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef typename Impl::ConstIterator               iterator;
+    typedef typename Impl::ConstIterator               const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+    // CREATORS
+    explicit btree_set(const COMPARATOR& comparator     = COMPARATOR(),
+                       const ALLOCATOR&  basicAllocator = ALLOCATOR())
+        // Construct an empty set.  Optionally specify a 'comparator' used to
+        // order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify the 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the 'ALLOCATOR' is 'bsl::allocator' (the
+        // default), then 'basicAllocator', if supplied, shall be convertible
+        // to 'bslma::Allocator *'.  If the 'ALLOCATOR' is 'bsl::allocator'
+        // and 'basicAllocator' is not supplied, the currently installed
+        // default allocator will be used to supply memory.
+    : d_impl(comparator, basicAllocator)
+    {
+        // The implementation is placed here in the class definition to
+        // workaround an AIX compiler bug, where the constructor can fail to
+        // compile because it is unable to find the definition of the default
+        // argument.  This occurs when a templatized class wraps around the
+        // container and the comparator is defined after the new class.
+    }
+
+    explicit btree_set(const ALLOCATOR& basicAllocator);
+        // Construct an empty set that will use the specified 'basicAllocator'
+        // to supply memory.  Use a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' to order the keys contained in this
+        // set.  If the (template parameter) type 'ALLOCATOR' is of
+        // 'bsl::allocator' (the default) then 'basicAllocator' shall be
+        // convertible to 'bslma::Allocator *'.
+
+    btree_set(const btree_set& original);
+        // Construct a set having the same value as the specified 'original'.
+        // Use a copy of 'original.key_comp()' to order the keys contained in
+        // this set.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // allocate memory.  If the (template parameter) type 'ALLOCATOR' is of
+        // type 'bsl::allocator' (the default), the currently installed default
+        // allocator will be used to supply memory.  The nodes of the new set
+        // are full, other than the last.  This method requires that the
+        // (template parameter) type 'KEY' be "copy-constructible" (see
+        // {Requirements on 'KEY'}).
+
+    btree_set(const btree_set& original, const ALLOCATOR& basicAllocator);
+        // Construct a set having the same value as that of the specified
+        // 'original' that will use the specified 'basicAllocator' to supply
+        // memory.  Use a copy of 'original.key_comp()' to order the keys
+        // contained in this set.  If the (template parameter) type
+        // 'ALLOCATOR' is 'bsl::allocator' (the default) then 'basicAllocator'
+        // shall be convertible to 'bslma::Allocator *'.  The nodes of the new
+        // set are full, other than the last.  This method requires that the
+        // (template parameter) type 'KEY' be "copy-constructible" (see
+        // {Requirements on 'KEY'}).
+
+    template <class INPUT_ITERATOR>
+    btree_set(INPUT_ITERATOR    first,
+              INPUT_ITERATOR    last,
+              const COMPARATOR& comparator     = COMPARATOR(),
+              const ALLOCATOR&  basicAllocator = ALLOCATOR());
+        // Construct a set, and insert each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, ignoring those keys that
+        // appear earlier in the sequence.  Optionally specify a 'comparator'
+        // used to order keys contained in this object.  If 'comparator' is
+        // not supplied, a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' is used.  Optionally specify the
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is
+        // 'bsl::allocator' (the default) then 'basicAllocator', if supplied,
+        // shall be convertible to 'bslma::Allocator *'.  If the sequence
+        // 'first' and 'last' is ordered according to the identified
+        // 'comparator' then this operation will have O[N] complexity, and
+        // fill every node of the set but the last, where N is the number of
+        // elements between 'first' and 'last', otherwise this operation will
+        // have O[N * log(N)] complexity.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values of
+        // a type convertible to 'value_type'.  The behavior is undefined
+        // unless 'first' and 'last' refer to a sequence of valid values where
+        // 'first' is at a position at or before 'last'.  This method requires
+        // that the (template parameter) type 'KEY' be "copy-constructible"
+        // (see {Requirements on 'KEY'}).
+
+    ~btree_set();
+        // Destroy this object.
+
+    // MANIPULATORS
+    btree_set& operator=(const btree_set& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if the
+        // 'ALLOCATOR' type has trait 'propagate_on_container_copy_assignment',
+        // and return a reference providing modifiable access to this object.
+        // This method requires that the (template parameter) type 'KEY' be
+        // "copy-constructible" (see {Requirements on 'KEY'}).
+
+    iterator begin();
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this set, or the 'end' iterator if this set is empty.
+
+    iterator end();
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type' objects
+        // maintained by this set.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this set, or 'rend' if this set is empty.
+
+    reverse_iterator rend();
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this set.
+
+    pair<iterator, bool> insert(const value_type& value);
+        // Insert the specified 'value' into this set if a key equivalent to
+        // 'value' does not already exist in this set; otherwise, if a key
+        // equivalent to 'value' (according to the comparator provided at
+        // construction) already exists in this set, this method has no
+        // effect.  Return a pair whose 'first' member is an iterator referring
+        // to the (possibly newly inserted) 'value_type' object in this set
+        // that is equivalent to 'value', and whose 'second' member is 'true'
+        // if a new value was inserted, and 'false' if the value was already
+        // present.  If a value is inserted, all other iterators into this set
+        // are invalidated.  This method requires that the (template
+        // parameter) type 'KEY' be "copy-constructible" (see {Requirements on
+        // 'KEY'}).
+
+    iterator insert(const_iterator hint, const value_type& value);
+        // Insert the specified 'value' into this set (in amortized constant
+        // time if the specified 'hint' is a valid immediate successor to
+        // 'value') if a key equivalent to 'value' does not already exist in
+        // this set; otherwise, this method has no effect.  Return an iterator
+        // referring to the (possibly newly inserted) 'value_type' object in
+        // this set that is equivalent to 'value'.  If 'hint' is not a valid
+        // immediate successor to 'value', this operation will have O[log(N)]
+        // complexity, where 'N' is the size of this set.  If a value is
+        // inserted, all other iterators into this set are invalidated.  The
+        // behavior is undefined unless 'hint' is a valid iterator into this
+        // set.  This method requires that the (template parameter) type 'KEY'
+        // be "copy-constructible" (see {Requirements on 'KEY'}).
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set the value of each 'value_type' object in the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, if a key
+        // equivalent to the object is not already contained in this set.
+        // Each value is inserted with the 'end' position as hint, so that
+        // inserting an ordered sequence following the last element of this
+        // set fills each node in turn.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to values of
+        // a type convertible to 'value_type'.  The behavior is undefined
+        // unless 'first' and 'last' refer to a sequence of valid values where
+        // 'first' is at a position at or before 'last'.  This method requires
+        // that the (template parameter) type 'KEY' be "copy-constructible"
+        // (see {Requirements on 'KEY'}).
+
+    iterator erase(const_iterator position);
+        // Remove from this set the 'value_type' object at the specified
+        // 'position', and return an iterator referring to the element
+        // immediately following the removed element, or to the past-the-end
+        // position if the removed element was the last in the sequence.  All
+        // other iterators into this set are invalidated.  The behavior is
+        // undefined unless 'position' refers to a 'value_type' object in this
+        // set.
+
+    size_type erase(const key_type& key);
+        // Remove from this set the 'value_type' object equivalent to the
+        // specified 'key', if it exists, and return 1; otherwise, if there is
+        // no 'value_type' object equivalent to 'key', return 0 with no other
+        // effect.  If an element is removed, all iterators into this set are
+        // invalidated.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this set the 'value_type' objects starting at the
+        // specified 'first' position up to, but including the specified 'last'
+        // position, and return 'last'.  All other iterators into this set are
+        // invalidated.  The behavior is undefined unless 'first' and 'last'
+        // either refer to elements in this set or are the 'end' iterator, and
+        // the 'first' position is at or before the 'last' position in the
+        // ordered sequence provided by this container.
+
+    void swap(btree_set& other);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object; also exchange the allocator of this object
+        // with that of 'other' if the (template parameter) type 'ALLOCATOR'
+        // has the 'propagate_on_container_swap' trait, and do not modify
+        // either allocator otherwise.  This method provides the no-throw
+        // exception-safety guarantee if the allocators are exchanged or are
+        // equal, and provides the basic exception-safety guarantee (by
+        // exchanging copies of the two sets) otherwise.
+
+    void clear();
+        // Remove all entries from this set.  Note that the set is empty after
+        // this call, but allocated memory may be retained for future use.
+
+    iterator find(const key_type& key);
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this set equivalent to the specified 'key',
+        // if such an entry exists, and the past-the-end ('end') iterator
+        // otherwise.
+
+    iterator lower_bound(const key_type& key);
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this set greater-than
+        // or equal-to the specified 'key', and the past-the-end iterator if
+        // this set does not contain a 'value_type' object greater-than or
+        // equal-to 'key'.
+
+    iterator upper_bound(const key_type& key);
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this set greater than
+        // the specified 'key', and the past-the-end iterator if this set does
+        // not contain a 'value_type' object greater-than 'key'.
+
+    pair<iterator, iterator> equal_range(const key_type& key);
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this set equivalent to the
+        // specified 'key', where the the first iterator is positioned at the
+        // start of the sequence, and the second is positioned one past the
+        // end of the sequence.  If this set contains no 'value_type' objects
+        // equivalent to 'key', then the two returned iterators will have the
+        // same value.
+
+    // ACCESSORS
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // set.
+
+    const_iterator begin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this set, or the 'end' iterator if this set is empty.
+
+    const_iterator end() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type'
+        // objects maintained by this set.
+
+    const_reverse_iterator rbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this set, or 'rend' if this set is empty.
+
+    const_reverse_iterator rend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this set.
+
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this set, or the 'cend' iterator if this set is empty.
+
+    const_iterator cend() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type' objects
+        // maintained by this set.
+
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this set, or 'crend' if this set is empty.
+
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this set.
+
+    bool empty() const;
+        // Return 'true' if this set contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const;
+        // Return the number of elements in this set.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this set could possibly hold.  Note that there is no guarantee
+        // that the set can successfully grow to the returned size, or even
+        // close to that size without running out of resources.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by this
+        // set; if a comparator was supplied at construction, return its value,
+        // otherwise return a default constructed 'key_compare' object.
+
+    value_compare value_comp() const;
+        // Return the value-comparison functor (or function pointer) used by
+        // this set, which is the same as 'key_comp()'.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this set equivalent to the specified 'key',
+        // if such an entry exists, and the past-the-end ('end') iterator
+        // otherwise.
+
+    size_type count(const key_type& key) const;
+        // Return the number of 'value_type' objects within this set equivalent
+        // to the specified 'key'.  Note that since a set maintains unique
+        // keys, the returned value will be either 0 or 1.
+
+    bool contains(const key_type& key) const;
+        // Return 'true' if this set contains a 'value_type' object equivalent
+        // to the specified 'key', and 'false' otherwise.
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this set greater-than
+        // or equal-to the specified 'key', and the past-the-end iterator if
+        // this set does not contain a 'value_type' object greater-than or
+        // equal-to 'key'.
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this set greater than
+        // the specified 'key', and the past-the-end iterator if this set does
+        // not contain a 'value_type' object greater-than 'key'.
+
+    pair<const_iterator, const_iterator> equal_range(const key_type& key)
+                                                                         const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this set equivalent to the
+        // specified 'key', where the the first iterator is positioned at the
+        // start of the sequence, and the second is positioned one past the
+        // end of the sequence.  If this set contains no 'value_type' objects
+        // equivalent to 'key', then the two returned iterators will have the
+        // same value.
+};
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator==(const btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'btree_set' objects have the same
+    // value if they have the same number of keys, and each key that is
+    // contained in one of the objects is also contained in the other object.
+    // This method requires that the (template parameter) type 'KEY' be
+    // "equality-comparable" (see {Requirements on 'KEY'}).
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'btree_set' objects do not have
+    // the same value if they do not have the same number of keys, or some key
+    // that is contained in one of the objects is not also contained in the
+    // other object.  This method requires that the (template parameter) type
+    // 'KEY' be "equality-comparable" (see {Requirements on 'KEY'}).
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<(const btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+               const btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' value is less than the specified
+    // 'rhs' value, and 'false' otherwise.  A set, 'lhs', has a value that is
+    // less than that of 'rhs', if, for the first non-equal corresponding key
+    // in their respective sequences, the 'lhs' key is less than the 'rhs' key,
+    // or, if all of their corresponding keys compare equal, 'lhs' has fewer
+    // keys than 'rhs'.  This method requires that the (template parameter)
+    // type 'KEY' be "less-than-comparable" (see {Requirements on 'KEY'}).
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>(const btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+               const btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' value is greater than the specified
+    // 'rhs' value, and 'false' otherwise.  A set, 'lhs', has a value that is
+    // greater than that of 'rhs', if, for the first non-equal corresponding
+    // key in their respective sequences, the 'lhs' key is greater than the
+    // 'rhs' key, or, if all of their corresponding keys compare equal, 'lhs'
+    // has more keys than 'rhs'.  This method requires that the (template
+    // parameter) type 'KEY' be "less-than-comparable" (see {Requirements on
+    // 'KEY'}).
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' value is less-than or equal-to the
+    // specified 'rhs' value, and 'false' otherwise.  A set, 'lhs', has a value
+    // that is less-than or equal-to that of 'rhs', if, for the first non-equal
+    // corresponding key in their respective sequences, the 'lhs' key is less
+    // than the 'rhs' key, or, if all of their corresponding keys compare
+    // equal, 'lhs' has less-than or equal number of keys as 'rhs'.  This
+    // method requires that the (template parameter) type 'KEY' be
+    // "less-than-comparable" (see {Requirements on 'KEY'}).
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' value is greater-than or equal-to
+    // the specified 'rhs' value, and 'false' otherwise.  A set, 'lhs', has a
+    // value that is greater-than or equal-to that of 'rhs', if, for the first
+    // non-equal corresponding key in their respective sequences, the 'lhs' key
+    // is greater than the 'rhs' key, or, if all of their corresponding keys
+    // compare equal, 'lhs' has greater-than or equal number of keys as 'rhs'.
+    // This method requires that the (template parameter) type 'KEY' be
+    // "less-than-comparable" (see {Requirements on 'KEY'}).
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void swap(btree_set<KEY, COMPARATOR, ALLOCATOR>& a,
+          btree_set<KEY, COMPARATOR, ALLOCATOR>& b);
+    // Swap both the value and the comparator of the specified 'a' object with
+    // the value and comparator of the specified 'b' object.  Additionally if
+    // 'bslstl::AllocatorTraits<ALLOCATOR>::propagate_on_container_swap' is
+    // 'true' then exchange the allocator of 'a' with that of 'b', and do not
+    // modify either allocator otherwise.  This method provides the no-throw
+    // exception-safety guarantee and guarantees O[1] complexity if the
+    // allocators are exchanged or are equal.
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                             // ---------------
+                             // class btree_set
+                             // ---------------
+
+// CREATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+btree_set<KEY, COMPARATOR, ALLOCATOR>::btree_set(
+                                               const ALLOCATOR& basicAllocator)
+: d_impl(COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+btree_set<KEY, COMPARATOR, ALLOCATOR>::btree_set(const btree_set& original)
+: d_impl(original.d_impl,
+         AllocatorTraits::select_on_container_copy_construction(
+                                                 original.get_allocator()))
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+btree_set<KEY, COMPARATOR, ALLOCATOR>::btree_set(
+                                              const btree_set& original,
+                                              const ALLOCATOR& basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+btree_set<KEY, COMPARATOR, ALLOCATOR>::btree_set(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              const COMPARATOR& comparator,
+                                              const ALLOCATOR&  basicAllocator)
+: d_impl(comparator, basicAllocator)
+{
+    // If an exception is thrown, the destructor of the (fully constructed)
+    // 'd_impl' member releases the elements inserted so far.
+
+    insert(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+btree_set<KEY, COMPARATOR, ALLOCATOR>::~btree_set()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+btree_set<KEY, COMPARATOR, ALLOCATOR>&
+btree_set<KEY, COMPARATOR, ALLOCATOR>::operator=(const btree_set& rhs)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(this != &rhs)) {
+
+        if (AllocatorTraits::propagate_on_container_copy_assignment::value) {
+            btree_set other(rhs, rhs.get_allocator());
+            d_impl.quickSwapExchangeAllocators(&other.d_impl);
+        }
+        else {
+            btree_set other(rhs, get_allocator());
+            d_impl.quickSwapRetainAllocators(&other.d_impl);
+        }
+    }
+    return *this;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::begin()
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::end()
+{
+    return d_impl.end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::reverse_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::reverse_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename btree_set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+btree_set<KEY, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    bool     isInserted;
+    iterator it = d_impl.insertIfMissing(&isInserted, value);
+    return bsl::pair<iterator, bool>(it, isInserted);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
+                                              const value_type& value)
+{
+    bool isInserted;
+    return d_impl.insertIfMissing(&isInserted, hint, value);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+void btree_set<KEY, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                   INPUT_ITERATOR last)
+{
+    // Hinting each value at 'end' appends an ordered sequence to the last
+    // node without searching the tree; any other value is located by a
+    // search (see 'BTree::insertIfMissing').
+
+    bool isInserted;
+    while (first != last) {
+        d_impl.insertIfMissing(&isInserted, d_impl.end(), *first);
+        ++first;
+    }
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_impl.remove(position);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+btree_set<KEY, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const_iterator it = find(key);
+    if (it == end()) {
+        return 0;                                                     // RETURN
+    }
+    d_impl.remove(it);
+    return 1;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                             const_iterator last)
+{
+    // Removing an element invalidates every other iterator, including 'last',
+    // so count the elements to remove before removing any.
+
+    difference_type numElements = bsl::distance(first, last);
+
+    iterator position = first;
+    for (; numElements > 0; --numElements) {
+        position = d_impl.remove(position);
+    }
+    return position;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void btree_set<KEY, COMPARATOR, ALLOCATOR>::swap(btree_set& other)
+{
+    if (AllocatorTraits::propagate_on_container_swap::value) {
+        d_impl.quickSwapExchangeAllocators(&other.d_impl);
+    }
+    else {
+        // C++11 behavior: undefined for unequal allocators
+        // BSLS_ASSERT(allocator() == other.allocator());
+
+        // backward compatible behavior: swap with copies
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                   get_allocator() == other.get_allocator())) {
+            d_impl.quickSwapRetainAllocators(&other.d_impl);
+        }
+        else {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            btree_set thisCopy(*this, other.get_allocator());
+            btree_set otherCopy(other, get_allocator());
+
+            d_impl.quickSwapRetainAllocators(&otherCopy.d_impl);
+            other.d_impl.quickSwapRetainAllocators(&thisCopy.d_impl);
+        }
+    }
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void btree_set<KEY, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_impl.removeAll();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::find(const key_type& key)
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::lower_bound(const key_type& key)
+{
+    return d_impl.lowerBound(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::upper_bound(const key_type& key)
+{
+    return d_impl.upperBound(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename btree_set<KEY, COMPARATOR, ALLOCATOR>::iterator,
+          typename btree_set<KEY, COMPARATOR, ALLOCATOR>::iterator>
+btree_set<KEY, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key)
+{
+    iterator startIt = lower_bound(key);
+    iterator endIt   = startIt;
+    if (endIt != end() && !d_impl.comparator()(key, *endIt)) {
+        ++endIt;
+    }
+    return bsl::pair<iterator, iterator>(startIt, endIt);
+}
+
+// ACCESSORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::allocator_type
+btree_set<KEY, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return d_impl.allocator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::cbegin() const
+{
+    return begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::cend() const
+{
+    return end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::crbegin() const
+{
+    return rbegin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::crend() const
+{
+    return rend();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool btree_set<KEY, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return 0 == d_impl.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+btree_set<KEY, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_impl.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+btree_set<KEY, COMPARATOR, ALLOCATOR>::max_size() const
+{
+    return d_impl.maxSize();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::key_compare
+btree_set<KEY, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_impl.comparator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::value_compare
+btree_set<KEY, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return key_comp();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+btree_set<KEY, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return contains(key) ? 1 : 0;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool
+btree_set<KEY, COMPARATOR, ALLOCATOR>::contains(const key_type& key) const
+{
+    return d_impl.find(key) != d_impl.end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::lower_bound(const key_type& key) const
+{
+    return d_impl.lowerBound(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+btree_set<KEY, COMPARATOR, ALLOCATOR>::upper_bound(const key_type& key) const
+{
+    return d_impl.upperBound(key);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator,
+          typename btree_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator>
+btree_set<KEY, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key) const
+{
+    const_iterator startIt = lower_bound(key);
+    const_iterator endIt   = startIt;
+    if (endIt != end() && !d_impl.comparator()(key, *endIt)) {
+        ++endIt;
+    }
+    return bsl::pair<const_iterator, const_iterator>(startIt, endIt);
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& a,
+               bsl::btree_set<KEY, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for STL *ordered* containers:
+//: o An ordered container defines STL iterators.
+//: o An ordered container uses 'bslma' allocators if the parameterized
+//:     'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::btree_set<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::btree_set<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
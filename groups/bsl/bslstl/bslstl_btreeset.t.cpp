@@ -0,0 +1,1260 @@
+// bslstl_btreeset.t.cpp                                              -*-C++-*-
+#include <bslstl_btreeset.h>
+
+#include <bslstl_allocator.h>
+#include <bslstl_iterator.h>
+#include <bslstl_pair.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_issame.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+
+#include <bsltf_alloctesttype.h>
+
+#include <algorithm>
+#include <functional>
+#include <set>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a container class template,
+// 'bsl::btree_set', that forwards most of its operations to a
+// 'bslstl::BTree', which is tested thoroughly by its own test driver.  This
+// test driver therefore concentrates on the forwarding, on the operations
+// that 'btree_set' implements itself ('equal_range', the range forms of
+// 'insert' and 'erase', assignment, 'swap', and the free operators), and on
+// the allocator behavior expected of a BDE container.
+//
+// Each case is run for 'int' keys (held contiguously and searched linearly)
+// and for 'bsltf::AllocTestType' keys (searched by binary search, and
+// allocating memory).  The value of a set is verified against a reference
+// 'std::set'.
+//
+// Global Concerns:
+//: o All memory is supplied by the allocator passed at construction.
+//: o No memory is leaked.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] btree_set(const C& comparator = C(), const A& allocator = A());
+// [ 2] btree_set(const A& allocator);
+// [ 3] btree_set(const btree_set& original);
+// [ 3] btree_set(const btree_set& original, const A& allocator);
+// [ 4] btree_set(ITER first, ITER last, const C& comp, const A& allocator);
+// [ 2] ~btree_set();
+//
+// MANIPULATORS
+// [ 3] btree_set& operator=(const btree_set& rhs);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 2] reverse_iterator rbegin();
+// [ 2] reverse_iterator rend();
+// [ 2] pair<iterator, bool> insert(const value_type& value);
+// [ 4] iterator insert(const_iterator hint, const value_type& value);
+// [ 4] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 4] iterator erase(const_iterator position);
+// [ 4] size_type erase(const key_type& key);
+// [ 4] iterator erase(const_iterator first, const_iterator last);
+// [ 3] void swap(btree_set& other);
+// [ 2] void clear();
+// [ 5] iterator find(const key_type& key);
+// [ 5] iterator lower_bound(const key_type& key);
+// [ 5] iterator upper_bound(const key_type& key);
+// [ 5] pair<iterator, iterator> equal_range(const key_type& key);
+//
+// ACCESSORS
+// [ 2] allocator_type get_allocator() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_reverse_iterator rbegin() const;
+// [ 2] const_reverse_iterator rend() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator cend() const;
+// [ 2] const_reverse_iterator crbegin() const;
+// [ 2] const_reverse_iterator crend() const;
+// [ 2] bool empty() const;
+// [ 2] size_type size() const;
+// [ 2] size_type max_size() const;
+// [ 2] key_compare key_comp() const;
+// [ 2] value_compare value_comp() const;
+// [ 5] const_iterator find(const key_type& key) const;
+// [ 5] size_type count(const key_type& key) const;
+// [ 5] bool contains(const key_type& key) const;
+// [ 5] const_iterator lower_bound(const key_type& key) const;
+// [ 5] const_iterator upper_bound(const key_type& key) const;
+// [ 5] pair<const_iter, const_iter> equal_range(const key_type&) const;
+//
+// FREE OPERATORS
+// [ 6] bool operator==(const btree_set& lhs, const btree_set& rhs);
+// [ 6] bool operator!=(const btree_set& lhs, const btree_set& rhs);
+// [ 6] bool operator< (const btree_set& lhs, const btree_set& rhs);
+// [ 6] bool operator> (const btree_set& lhs, const btree_set& rhs);
+// [ 6] bool operator<=(const btree_set& lhs, const btree_set& rhs);
+// [ 6] bool operator>=(const btree_set& lhs, const btree_set& rhs);
+// [ 3] void swap(btree_set& a, btree_set& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] CONCERN: The type has the expected type traits.
+// [ 4] CONCERN: Insertion provides the strong exception-safety guarantee.
+// [ 7] USAGE EXAMPLE
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bsltf::AllocTestType AllocType;
+typedef std::set<int>        Reference;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace BloombergLP {
+namespace bsltf {
+
+bool operator<(const AllocTestType& lhs, const AllocTestType& rhs)
+    // Return 'true' if the specified 'lhs' is ordered before the specified
+    // 'rhs', and 'false' otherwise.  Note that this operator is required to
+    // test the relational operators on sets of 'AllocTestType'.
+{
+    return lhs.data() < rhs.data();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+template <class TYPE>
+struct DataLess {
+    // This class provides a comparator ordering objects of the (template
+    // parameter) 'TYPE' by the value returned by their 'data' method.
+
+    bool operator()(const TYPE& lhs, const TYPE& rhs) const
+        // Return 'true' if the specified 'lhs' is ordered before the
+        // specified 'rhs', and 'false' otherwise.
+    {
+        return lhs.data() < rhs.data();
+    }
+};
+
+template <class KEY>
+struct KeyUtil;
+    // This 'struct' provides, for each key type used by this test driver, a
+    // class method 'create' returning a key having a specified integer value,
+    // and a class method 'toInt' returning the integer value of a key.
+
+template <>
+struct KeyUtil<int> {
+    static int create(int value, bslma::Allocator *)
+    {
+        return value;
+    }
+
+    static int toInt(int value)
+    {
+        return value;
+    }
+};
+
+template <>
+struct KeyUtil<AllocType> {
+    static AllocType create(int value, bslma::Allocator *basicAllocator)
+    {
+        return AllocType(value, basicAllocator);
+    }
+
+    static int toInt(const AllocType& value)
+    {
+        return value.data();
+    }
+};
+
+static int nextRandom(unsigned *seed)
+    // Advance the specified 'seed' of a linear congruential generator and
+    // return the next pseudo-random number in the range '[0, 32767]'.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return static_cast<int>((*seed >> 16) & 0x7fff);
+}
+
+enum Pattern {
+    // Orders in which a sequence of integers is generated.
+
+    e_ASCENDING,
+    e_DESCENDING,
+    e_RANDOM,
+    e_NUM_PATTERNS
+};
+
+static std::vector<int> makeSequence(int pattern, int length)
+    // Return a sequence of the specified 'length' integers, generated in the
+    // specified 'pattern'.  Random sequences contain duplicates.
+{
+    std::vector<int> result;
+    unsigned         seed = static_cast<unsigned>(length);
+    for (int i = 0; i < length; ++i) {
+        switch (pattern) {
+          case e_ASCENDING: {
+            result.push_back(i);
+          } break;
+          case e_DESCENDING: {
+            result.push_back(length - i);
+          } break;
+          default: {
+            result.push_back(nextRandom(&seed) % (length + 1));
+          } break;
+        }
+    }
+    return result;
+}
+
+static const int SIZES[] = { 0, 1, 2, 5, 17, 100, 257, 1000 };
+static const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+//=============================================================================
+//                       TEST DRIVER TEMPLATE
+//-----------------------------------------------------------------------------
+
+template <class KEY, class COMPARATOR>
+struct TestDriver {
+    // This templatized struct provides a namespace for testing the
+    // 'btree_set' container holding keys of the (template parameter) 'KEY'
+    // type, ordered by the (template parameter) 'COMPARATOR' type.
+
+    // TYPES
+    typedef bsl::btree_set<KEY, COMPARATOR>                Obj;
+    typedef typename Obj::iterator                         Iterator;
+    typedef typename Obj::const_iterator                   ConstIterator;
+    typedef typename Obj::allocator_type                   Allocator;
+    typedef KeyUtil<KEY>                                   Util;
+
+    // CLASS METHODS
+    static bool verify(const Obj& object, const Reference& reference)
+        // Return 'true' if the specified 'object' holds the same sequence of
+        // keys as the specified 'reference', iterating in both directions,
+        // and 'false' otherwise.
+    {
+        if (object.size() != reference.size()) {
+            return false;                                             // RETURN
+        }
+        ConstIterator             it  = object.begin();
+        Reference::const_iterator rit = reference.begin();
+        for (; it != object.end(); ++it, ++rit) {
+            if (Util::toInt(*it) != *rit) {
+                return false;                                         // RETURN
+            }
+        }
+        typename Obj::const_reverse_iterator rev  = object.rbegin();
+        Reference::const_reverse_iterator    rrev = reference.rbegin();
+        for (; rev != object.rend(); ++rev, ++rrev) {
+            if (Util::toInt(*rev) != *rrev) {
+                return false;                                         // RETURN
+            }
+        }
+        return true;
+    }
+
+    // TEST CASES
+    static void testCase2();
+        // Test primary manipulators and basic accessors.
+
+    static void testCase3();
+        // Test copy construction, assignment and 'swap'.
+
+    static void testCase4();
+        // Test insertion and removal.
+
+    static void testCase5();
+        // Test lookup.
+
+    static void testCase6();
+        // Test comparison operators.
+};
+
+template <class KEY, class COMPARATOR>
+void TestDriver<KEY, COMPARATOR>::testCase2()
+{
+    // ------------------------------------------------------------------------
+    // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+    //
+    // Concerns:
+    //: 1 A default-constructed set is empty, and uses the supplied allocator,
+    //:   or the default allocator if none is supplied.
+    //:
+    //: 2 'insert' of a value adds the value if it is not present, and
+    //:   returns an iterator to the element equivalent to the value, and
+    //:   whether the value was inserted.
+    //:
+    //: 3 Forward and reverse iteration visit the elements in order.
+    //:
+    //: 4 'clear' removes every element and releases all memory.
+    //:
+    //: 5 'key_comp' and 'value_comp' order keys as 'COMPARATOR'.
+    //:
+    //: 6 'iterator' and 'const_iterator' are the same type.
+    //:
+    //: 7 The type has the 'HasStlIterators' and 'UsesBslmaAllocator' traits.
+    //:
+    //: 8 All memory comes from the object allocator, and none is leaked.
+    //
+    // Plan:
+    //: 1 Construct sets using each constructor, and verify the allocator and
+    //:   that the set is empty.  (C-1)
+    //:
+    //: 2 For a sequence of keys, in several patterns, insert keys into a set
+    //:   and into a reference 'std::set', and verify the return values, and
+    //:   the value of the set in both directions.  (C-2..3, 8)
+    //:
+    //: 3 Clear the set and verify that it is empty and holds no memory.
+    //:   (C-4)
+    //:
+    //: 4 Compare the results of 'key_comp' and 'value_comp' with
+    //:   'COMPARATOR'.  (C-5)
+    //:
+    //: 5 Verify the iterator types and the traits.  (C-6..7)
+    //
+    // Testing:
+    //   btree_set(const C& comparator = C(), const A& allocator = A());
+    //   btree_set(const A& allocator);
+    //   ~btree_set();
+    //   iterator begin();
+    //   iterator end();
+    //   reverse_iterator rbegin();
+    //   reverse_iterator rend();
+    //   pair<iterator, bool> insert(const value_type& value);
+    //   void clear();
+    //   allocator_type get_allocator() const;
+    //   const_iterator begin() const;
+    //   const_iterator end() const;
+    //   const_reverse_iterator rbegin() const;
+    //   const_reverse_iterator rend() const;
+    //   const_iterator cbegin() const;
+    //   const_iterator cend() const;
+    //   const_reverse_iterator crbegin() const;
+    //   const_reverse_iterator crend() const;
+    //   bool empty() const;
+    //   size_type size() const;
+    //   size_type max_size() const;
+    //   key_compare key_comp() const;
+    //   value_compare value_comp() const;
+    //   CONCERN: The type has the expected type traits.
+    // ------------------------------------------------------------------------
+
+    BSLMF_ASSERT((bsl::is_same<Iterator, ConstIterator>::value));
+    BSLMF_ASSERT((bslalg::HasStlIterators<Obj>::value));
+    BSLMF_ASSERT((bslma::UsesBslmaAllocator<Obj>::value));
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    if (veryVerbose) printf("\tDefault construction.\n");
+    {
+        Obj mW;  const Obj& W = mW;
+        ASSERT(W.get_allocator() == Allocator(&da));
+        ASSERT(W.empty());
+        ASSERT(0 == W.size());
+        ASSERT(W.begin() == W.end());
+        ASSERT(W.cbegin() == W.cend());
+        ASSERT(W.rbegin() == W.rend());
+        ASSERT(W.crbegin() == W.crend());
+        ASSERT(0 < W.max_size());
+
+        Obj mX((Allocator(&oa)));  const Obj& X = mX;
+        ASSERT(X.get_allocator() == Allocator(&oa));
+        ASSERT(X.empty());
+
+        Obj mY(COMPARATOR(), &oa);  const Obj& Y = mY;
+        ASSERT(Y.get_allocator() == Allocator(&oa));
+        ASSERT(Y.empty());
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+    ASSERT(0 == da.numBlocksInUse());
+
+    if (veryVerbose) printf("\tInsertion and iteration.\n");
+    for (int tp = 0; tp < e_NUM_PATTERNS; ++tp) {
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int              LENGTH = SIZES[ti];
+            const std::vector<int> DATA   = makeSequence(tp, LENGTH);
+
+            Obj       mX(&oa);  const Obj& X = mX;
+            Reference reference;
+
+            for (int i = 0; i < LENGTH; ++i) {
+                const KEY VALUE = Util::create(DATA[i], &sa);
+
+                bsl::pair<Iterator, bool> result = mX.insert(VALUE);
+                const bool EXP = reference.insert(DATA[i]).second;
+
+                ASSERTV(tp, LENGTH, i, EXP == result.second);
+                ASSERTV(tp, LENGTH, i, DATA[i] == Util::toInt(*result.first));
+                ASSERTV(tp, LENGTH, i, X.end() != X.find(VALUE));
+            }
+            ASSERTV(tp, LENGTH, verify(X, reference));
+            ASSERTV(tp, LENGTH, X.empty() == (0 == LENGTH));
+
+            int count = 0;
+            for (Iterator it = mX.begin(); it != mX.end(); ++it) {
+                ++count;
+            }
+            ASSERTV(tp, LENGTH, count, X.size() == static_cast<size_t>(count));
+
+            count = 0;
+            for (typename Obj::reverse_iterator it  = mX.rbegin();
+                                                it != mX.rend();
+                                                ++it) {
+                ++count;
+            }
+            ASSERTV(tp, LENGTH, count, X.size() == static_cast<size_t>(count));
+
+            mX.clear();
+            ASSERTV(tp, LENGTH, X.empty());
+            ASSERTV(tp, LENGTH, X.begin() == X.end());
+            ASSERTV(tp, LENGTH, 0 == oa.numBlocksInUse());
+
+            mX.insert(Util::create(1, &sa));
+            ASSERTV(tp, LENGTH, 1 == X.size());
+        }
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+    ASSERT(0 == da.numBlocksTotal());
+
+    if (veryVerbose) printf("\tComparators.\n");
+    {
+        const Obj X(&oa);
+
+        const KEY K1 = Util::create(1, &sa);
+        const KEY K2 = Util::create(2, &sa);
+
+        ASSERT( X.key_comp()(K1, K2));
+        ASSERT(!X.key_comp()(K2, K1));
+        ASSERT(!X.key_comp()(K1, K1));
+
+        ASSERT( X.value_comp()(K1, K2));
+        ASSERT(!X.value_comp()(K2, K1));
+        ASSERT(!X.value_comp()(K1, K1));
+    }
+}
+
+template <class KEY, class COMPARATOR>
+void TestDriver<KEY, COMPARATOR>::testCase3()
+{
+    // ------------------------------------------------------------------------
+    // COPY CONSTRUCTION, ASSIGNMENT AND SWAP
+    //
+    // Concerns:
+    //: 1 A copy has the same value as the original, and uses the supplied
+    //:   allocator, or the default allocator if none is supplied.
+    //:
+    //: 2 The original is not modified by copying.
+    //:
+    //: 3 Assignment gives the target the value of the source, retaining the
+    //:   allocator of the target, and self-assignment has no effect.
+    //:
+    //: 4 'swap' (member and free) exchanges the values of two sets, without
+    //:   allocating memory if their allocators are equal, and exchanging
+    //:   copies otherwise.
+    //:
+    //: 5 No memory is leaked.
+    //
+    // Plan:
+    //: 1 For pairs of sets of various sizes, copy, assign and swap them,
+    //:   verifying the values against references, and the allocators used.
+    //:   (C-1..5)
+    //
+    // Testing:
+    //   btree_set(const btree_set& original);
+    //   btree_set(const btree_set& original, const A& allocator);
+    //   btree_set& operator=(const btree_set& rhs);
+    //   void swap(btree_set& other);
+    //   void swap(btree_set& a, btree_set& b);
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        const int              LENGTH1 = SIZES[ti];
+        const std::vector<int> DATA1   = makeSequence(e_RANDOM, LENGTH1);
+
+        Obj       mX(&oa);  const Obj& X = mX;
+        Reference reference1;
+        for (int i = 0; i < LENGTH1; ++i) {
+            mX.insert(Util::create(DATA1[i], &sa));
+            reference1.insert(DATA1[i]);
+        }
+        ASSERTV(LENGTH1, verify(X, reference1));
+
+        {
+            const Obj Y(X);
+            ASSERTV(LENGTH1, Y.get_allocator() == Allocator(&da));
+            ASSERTV(LENGTH1, verify(Y, reference1));
+            ASSERTV(LENGTH1, X == Y);
+        }
+        ASSERTV(LENGTH1, 0 == da.numBlocksInUse());
+        {
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            const Obj Y(X, &za);
+            ASSERTV(LENGTH1, Y.get_allocator() == Allocator(&za));
+            ASSERTV(LENGTH1, verify(Y, reference1));
+            ASSERTV(LENGTH1, oam.isTotalSame());
+        }
+        ASSERTV(LENGTH1, verify(X, reference1));
+
+        for (int tj = 0; tj < NUM_SIZES; ++tj) {
+            const int              LENGTH2 = SIZES[tj];
+            const std::vector<int> DATA2   = makeSequence(e_ASCENDING,
+                                                          LENGTH2);
+
+            Reference reference2(DATA2.begin(), DATA2.end());
+
+            {
+                Obj mY(&za);  const Obj& Y = mY;
+                for (int i = 0; i < LENGTH2; ++i) {
+                    mY.insert(Util::create(DATA2[i], &sa));
+                }
+
+                Obj *mR = &(mY = X);
+                ASSERTV(LENGTH1, LENGTH2, mR == &mY);
+                ASSERTV(LENGTH1, LENGTH2, verify(Y, reference1));
+                ASSERTV(LENGTH1, LENGTH2, verify(X, reference1));
+                ASSERTV(LENGTH1, LENGTH2,
+                        Y.get_allocator() == Allocator(&za));
+
+                mR = &(mY = Y);
+                ASSERTV(LENGTH1, LENGTH2, mR == &mY);
+                ASSERTV(LENGTH1, LENGTH2, verify(Y, reference1));
+            }
+            ASSERTV(LENGTH1, LENGTH2, 0 == za.numBlocksInUse());
+
+            {
+                Obj mA(X, &oa);  const Obj& A = mA;
+                Obj mB(&oa);     const Obj& B = mB;
+                for (int i = 0; i < LENGTH2; ++i) {
+                    mB.insert(Util::create(DATA2[i], &sa));
+                }
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                mA.swap(mB);
+                ASSERTV(LENGTH1, LENGTH2, verify(A, reference2));
+                ASSERTV(LENGTH1, LENGTH2, verify(B, reference1));
+
+                swap(mA, mB);
+                ASSERTV(LENGTH1, LENGTH2, verify(A, reference1));
+                ASSERTV(LENGTH1, LENGTH2, verify(B, reference2));
+
+                ASSERTV(LENGTH1, LENGTH2, oam.isTotalSame());
+            }
+
+            {
+                Obj mA(X, &oa);  const Obj& A = mA;
+                Obj mB(&za);     const Obj& B = mB;
+                for (int i = 0; i < LENGTH2; ++i) {
+                    mB.insert(Util::create(DATA2[i], &sa));
+                }
+
+                mA.swap(mB);
+                ASSERTV(LENGTH1, LENGTH2, verify(A, reference2));
+                ASSERTV(LENGTH1, LENGTH2, verify(B, reference1));
+                ASSERTV(LENGTH1, LENGTH2, A.get_allocator() ==
+                                                          Allocator(&oa));
+                ASSERTV(LENGTH1, LENGTH2, B.get_allocator() ==
+                                                          Allocator(&za));
+            }
+            ASSERTV(LENGTH1, LENGTH2, 0 == za.numBlocksInUse());
+        }
+    }
+    ASSERT(0 == da.numBlocksInUse());
+    ASSERT(0 == oa.numBlocksInUse());
+}
+
+template <class KEY, class COMPARATOR>
+void TestDriver<KEY, COMPARATOR>::testCase4()
+{
+    // ------------------------------------------------------------------------
+    // INSERTION AND REMOVAL
+    //
+    // Concerns:
+    //: 1 'insert' with a hint inserts the value whether or not the hint is
+    //:   correct, and returns an iterator to the element equivalent to the
+    //:   value.
+    //:
+    //: 2 The range constructor and the range 'insert' insert each value that
+    //:   is not already present, in any order.
+    //:
+    //: 3 Each form of 'erase' removes the identified elements, and returns
+    //:   the iterator or count specified.
+    //:
+    //: 4 'insert' provides the strong exception-safety guarantee.
+    //:
+    //: 5 No memory is leaked.
+    //
+    // Plan:
+    //: 1 For sequences of keys in several patterns, insert keys using a
+    //:   correct hint, the 'end' hint, and the 'begin' hint, and verify the
+    //:   results against a reference.  (C-1)
+    //:
+    //: 2 Construct sets from, and insert into sets, ranges of keys in
+    //:   several patterns, and verify the results.  (C-2)
+    //:
+    //: 3 Erase elements by position, key, and range from sets of various
+    //:   sizes, and verify the results.  (C-3)
+    //:
+    //: 4 Repeat P-1 under 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' for one
+    //:   size.  (C-4)
+    //
+    // Testing:
+    //   btree_set(ITER first, ITER last, const C& comp, const A& allocator);
+    //   iterator insert(const_iterator hint, const value_type& value);
+    //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+    //   iterator erase(const_iterator position);
+    //   size_type erase(const key_type& key);
+    //   iterator erase(const_iterator first, const_iterator last);
+    //   CONCERN: Insertion provides the strong exception-safety guarantee.
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    if (veryVerbose) printf("\tHinted insertion.\n");
+    for (int tp = 0; tp < e_NUM_PATTERNS; ++tp) {
+        for (int th = 0; th < 3; ++th) {
+            for (int ti = 0; ti < NUM_SIZES; ++ti) {
+                const int              LENGTH = SIZES[ti];
+                const std::vector<int> DATA   = makeSequence(tp, LENGTH);
+
+                Obj       mX(&oa);  const Obj& X = mX;
+                Reference reference;
+
+                for (int i = 0; i < LENGTH; ++i) {
+                    const KEY VALUE = Util::create(DATA[i], &sa);
+
+                    ConstIterator hint = 0 == th ? X.lower_bound(VALUE)
+                                       : 1 == th ? X.end()
+                                       :           X.begin();
+
+                    Iterator it = mX.insert(hint, VALUE);
+                    ASSERTV(tp, th, LENGTH, i, DATA[i] == Util::toInt(*it));
+
+                    reference.insert(DATA[i]);
+                }
+                ASSERTV(tp, th, LENGTH, verify(X, reference));
+            }
+        }
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+
+    if (veryVerbose) printf("\tRange construction and insertion.\n");
+    for (int tp = 0; tp < e_NUM_PATTERNS; ++tp) {
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int              LENGTH = SIZES[ti];
+            const std::vector<int> DATA   = makeSequence(tp, LENGTH);
+
+            std::vector<KEY> values;
+            for (int i = 0; i < LENGTH; ++i) {
+                values.push_back(Util::create(DATA[i], &sa));
+            }
+            const Reference reference(DATA.begin(), DATA.end());
+
+            // Copying into 'values' used the default allocator.
+
+            bslma::TestAllocatorMonitor dam(&da);
+            {
+                const Obj X(values.begin(), values.end(), COMPARATOR(), &oa);
+                ASSERTV(tp, LENGTH, verify(X, reference));
+            }
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+                mX.insert(values.begin(), values.begin() + LENGTH / 2);
+                mX.insert(values.begin() + LENGTH / 3, values.end());
+                ASSERTV(tp, LENGTH, verify(X, reference));
+            }
+            ASSERTV(tp, LENGTH, dam.isTotalSame());
+        }
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+
+    if (veryVerbose) printf("\tRemoval.\n");
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        const int              LENGTH = SIZES[ti];
+        const std::vector<int> DATA   = makeSequence(e_ASCENDING, LENGTH);
+
+        std::vector<KEY> values;
+        for (int i = 0; i < LENGTH; ++i) {
+            values.push_back(Util::create(DATA[i], &sa));
+        }
+        const Reference initial(DATA.begin(), DATA.end());
+
+        {
+            // Remove every third element by position, then the remainder by
+            // key, including keys that are not present.
+
+            Obj       mX(values.begin(), values.end(), COMPARATOR(), &oa);
+            const Obj& X = mX;
+            Reference reference(initial);
+
+            Iterator it = mX.begin();
+            int      index = 0;
+            while (it != mX.end()) {
+                if (0 == index % 3) {
+                    const int key = Util::toInt(*it);
+                    it = mX.erase(it);
+                    Reference::iterator rit = reference.find(key);
+                    reference.erase(rit++);
+                    if (rit == reference.end()) {
+                        ASSERTV(LENGTH, index, X.end() == it);
+                    }
+                    else {
+                        ASSERTV(LENGTH, index, *rit == Util::toInt(*it));
+                    }
+                }
+                else {
+                    ++it;
+                }
+                ++index;
+            }
+            ASSERTV(LENGTH, verify(X, reference));
+
+            for (int i = -1; i <= LENGTH; ++i) {
+                const KEY    K   = Util::create(i, &sa);
+                const size_t EXP = reference.erase(i);
+                ASSERTV(LENGTH, i, EXP == mX.erase(K));
+                ASSERTV(LENGTH, i, verify(X, reference));
+            }
+            ASSERTV(LENGTH, X.empty());
+        }
+        ASSERTV(LENGTH, 0 == oa.numBlocksInUse());
+
+        for (int tb = 0; tb <= LENGTH; tb += 1 + LENGTH / 7) {
+            for (int te = tb; te <= LENGTH; te += 1 + LENGTH / 5) {
+                Obj       mX(values.begin(), values.end(), COMPARATOR(), &oa);
+                const Obj& X = mX;
+                Reference reference(initial);
+
+                ConstIterator first = X.begin();
+                bsl::advance(first, tb);
+                ConstIterator last = first;
+                bsl::advance(last, te - tb);
+
+                Reference::iterator rfirst = reference.begin();
+                std::advance(rfirst, tb);
+                Reference::iterator rlast = rfirst;
+                std::advance(rlast, te - tb);
+
+                Iterator it = mX.erase(first, last);
+                reference.erase(rfirst, rlast);
+
+                ASSERTV(LENGTH, tb, te, verify(X, reference));
+                if (te == LENGTH) {
+                    ASSERTV(LENGTH, tb, te, X.end() == it);
+                }
+                else {
+                    ASSERTV(LENGTH, tb, te, DATA[te] == Util::toInt(*it));
+                }
+            }
+        }
+        ASSERTV(LENGTH, 0 == oa.numBlocksInUse());
+    }
+
+    if (veryVerbose) printf("\tException safety.\n");
+    {
+        const int              LENGTH = 300;
+        const std::vector<int> DATA   = makeSequence(e_RANDOM, LENGTH);
+
+        Obj       mX(&oa);  const Obj& X = mX;
+        Reference reference;
+
+        for (int i = 0; i < LENGTH; ++i) {
+            const KEY VALUE = Util::create(DATA[i], &sa);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                ASSERTV(i, verify(X, reference));
+
+                mX.insert(X.end(), VALUE);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            reference.insert(DATA[i]);
+            ASSERTV(i, verify(X, reference));
+        }
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+}
+
+template <class KEY, class COMPARATOR>
+void TestDriver<KEY, COMPARATOR>::testCase5()
+{
+    // ------------------------------------------------------------------------
+    // LOOKUP
+    //
+    // Concerns:
+    //: 1 'find', 'count', 'contains', 'lower_bound', 'upper_bound' and
+    //:   'equal_range' return the results specified for keys that are
+    //:   present, absent, before the first key and after the last key.
+    //:
+    //: 2 The 'const' and non-'const' overloads return the same positions.
+    //:
+    //: 3 Lookup does not allocate memory.
+    //
+    // Plan:
+    //: 1 Populate sets of various sizes holding the even integers, and look
+    //:   up every integer in a range extending beyond either end, comparing
+    //:   with the results of the same operations on a reference.  (C-1..3)
+    //
+    // Testing:
+    //   iterator find(const key_type& key);
+    //   iterator lower_bound(const key_type& key);
+    //   iterator upper_bound(const key_type& key);
+    //   pair<iterator, iterator> equal_range(const key_type& key);
+    //   const_iterator find(const key_type& key) const;
+    //   size_type count(const key_type& key) const;
+    //   bool contains(const key_type& key) const;
+    //   const_iterator lower_bound(const key_type& key) const;
+    //   const_iterator upper_bound(const key_type& key) const;
+    //   pair<const_iter, const_iter> equal_range(const key_type&) const;
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        const int LENGTH = SIZES[ti];
+
+        Obj       mX(&oa);  const Obj& X = mX;
+        Reference reference;
+        for (int i = 0; i < LENGTH; ++i) {
+            mX.insert(X.end(), Util::create(2 * i, &sa));
+            reference.insert(2 * i);
+        }
+        ASSERTV(LENGTH, verify(X, reference));
+
+        bslma::TestAllocatorMonitor oam(&oa);
+
+        for (int k = -2; k <= 2 * LENGTH + 1; ++k) {
+            const KEY K = Util::create(k, &sa);
+
+            Reference::const_iterator rfind  = reference.find(k);
+            Reference::const_iterator rlower = reference.lower_bound(k);
+            Reference::const_iterator rupper = reference.upper_bound(k);
+
+#define CHECK(ITER, RITER)                                                    \
+            ASSERTV(LENGTH, k, (ITER == X.end()) == (RITER == reference.end())\
+                           && (ITER == X.end()                                \
+                            || Util::toInt(*ITER) == *RITER))
+
+            ConstIterator cFind = X.find(K);
+            Iterator      mFind = mX.find(K);
+            CHECK(cFind, rfind);
+            ASSERTV(LENGTH, k, cFind == mFind);
+
+            ConstIterator cLower = X.lower_bound(K);
+            Iterator      mLower = mX.lower_bound(K);
+            CHECK(cLower, rlower);
+            ASSERTV(LENGTH, k, cLower == mLower);
+
+            ConstIterator cUpper = X.upper_bound(K);
+            Iterator      mUpper = mX.upper_bound(K);
+            CHECK(cUpper, rupper);
+            ASSERTV(LENGTH, k, cUpper == mUpper);
+#undef CHECK
+
+            bsl::pair<ConstIterator, ConstIterator> cRange =
+                                                             X.equal_range(K);
+            bsl::pair<Iterator, Iterator>           mRange =
+                                                            mX.equal_range(K);
+            ASSERTV(LENGTH, k, cLower == cRange.first);
+            ASSERTV(LENGTH, k, cUpper == cRange.second);
+            ASSERTV(LENGTH, k, cLower == mRange.first);
+            ASSERTV(LENGTH, k, cUpper == mRange.second);
+
+            ASSERTV(LENGTH, k, reference.count(k) == X.count(K));
+            ASSERTV(LENGTH, k, (1 == reference.count(k)) == X.contains(K));
+        }
+        ASSERTV(LENGTH, oam.isTotalSame());
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+}
+
+template <class KEY, class COMPARATOR>
+void TestDriver<KEY, COMPARATOR>::testCase6()
+{
+    // ------------------------------------------------------------------------
+    // COMPARISON OPERATORS
+    //
+    // Concerns:
+    //: 1 Two sets compare equal if and only if they hold the same keys,
+    //:   irrespective of their allocators or of how their elements were
+    //:   inserted.
+    //:
+    //: 2 The relational operators order sets lexicographically.
+    //
+    // Plan:
+    //: 1 For each pair of a set of sets, compare the results of every
+    //:   operator with those of the same operator on references.  Build the
+    //:   second set of each pair in descending order, using a different
+    //:   allocator.  (C-1..2)
+    //
+    // Testing:
+    //   bool operator==(const btree_set& lhs, const btree_set& rhs);
+    //   bool operator!=(const btree_set& lhs, const btree_set& rhs);
+    //   bool operator< (const btree_set& lhs, const btree_set& rhs);
+    //   bool operator> (const btree_set& lhs, const btree_set& rhs);
+    //   bool operator<=(const btree_set& lhs, const btree_set& rhs);
+    //   bool operator>=(const btree_set& lhs, const btree_set& rhs);
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    static const struct {
+        int         d_line;    // source line number
+        const char *d_spec_p;  // keys, as digits
+    } DATA[] = {
+        //LINE  SPEC
+        //----  ------------
+        { L_,   ""           },
+        { L_,   "1"          },
+        { L_,   "12"         },
+        { L_,   "123"        },
+        { L_,   "13"         },
+        { L_,   "2"          },
+        { L_,   "0123456789" },
+        { L_,   "012345678"  },
+        { L_,   "012345679"  },
+    };
+    const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int   LINE1 = DATA[ti].d_line;
+        const char *SPEC1 = DATA[ti].d_spec_p;
+
+        Obj       mX(&oa);  const Obj& X = mX;
+        Reference reference1;
+        for (const char *p = SPEC1; *p; ++p) {
+            mX.insert(Util::create(*p - '0', &sa));
+            reference1.insert(*p - '0');
+        }
+        ASSERTV(LINE1, verify(X, reference1));
+
+        for (int tj = 0; tj < NUM_DATA; ++tj) {
+            const int   LINE2 = DATA[tj].d_line;
+            const char *SPEC2 = DATA[tj].d_spec_p;
+            const int   LEN2  = static_cast<int>(strlen(SPEC2));
+
+            Obj       mY(&za);  const Obj& Y = mY;
+            Reference reference2;
+            for (int i = LEN2 - 1; i >= 0; --i) {
+                mY.insert(Util::create(SPEC2[i] - '0', &sa));
+                reference2.insert(SPEC2[i] - '0');
+            }
+
+            ASSERTV(LINE1, LINE2, (reference1 == reference2) == (X == Y));
+            ASSERTV(LINE1, LINE2, (reference1 != reference2) == (X != Y));
+            ASSERTV(LINE1, LINE2, (reference1 <  reference2) == (X <  Y));
+            ASSERTV(LINE1, LINE2, (reference1 >  reference2) == (X >  Y));
+            ASSERTV(LINE1, LINE2, (reference1 <= reference2) == (X <= Y));
+            ASSERTV(LINE1, LINE2, (reference1 >= reference2) == (X >= Y));
+            ASSERTV(LINE1, LINE2, (ti == tj) == (X == Y));
+        }
+    }
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Tracking Active Order Identifiers
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we track the identifiers of the orders currently open on a trading
+// venue.  Identifiers are assigned in increasing order, so new identifiers
+// are appended at the end of the set, and orders are closed in roughly the
+// order they were opened.
+//
+// First, we create a set, supplying a test allocator:
+//..
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+    typedef bsl::btree_set<int> OrderIdSet;
+    OrderIdSet openOrders(&oa);
+//..
+// Then, we open 500 orders, hinting each identifier at the end of the set so
+// that the identifiers fill each node of the tree in turn:
+//..
+    for (int id = 1; id <= 500; ++id) {
+        openOrders.insert(openOrders.end(), id);
+    }
+    ASSERT(500 == openOrders.size());
+//..
+// Next, we close the oldest 100 orders, and one more in the middle:
+//..
+    openOrders.erase(openOrders.begin(), openOrders.find(101));
+    ASSERT(1 == openOrders.erase(250));
+    ASSERT(399 == openOrders.size());
+//..
+// Now, we confirm which orders are open:
+//..
+    ASSERT(!openOrders.contains(100));
+    ASSERT( openOrders.contains(101));
+    ASSERT(!openOrders.contains(250));
+    ASSERT(101 == *openOrders.begin());
+    ASSERT(500 == *openOrders.rbegin());
+//..
+// Finally, we count the orders having an identifier in the range
+// '[200 .. 300)', which is missing order 250:
+//..
+    ASSERT(99 == bsl::distance(openOrders.lower_bound(200),
+                               openOrders.lower_bound(300)));
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // COMPARISON OPERATORS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOMPARISON OPERATORS"
+                            "\n====================\n");
+
+        TestDriver<int,       std::less<int>       >::testCase6();
+        TestDriver<AllocType, DataLess<AllocType>  >::testCase6();
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // LOOKUP
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP"
+                            "\n======\n");
+
+        TestDriver<int,       std::less<int>       >::testCase5();
+        TestDriver<AllocType, DataLess<AllocType>  >::testCase5();
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // INSERTION AND REMOVAL
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINSERTION AND REMOVAL"
+                            "\n=====================\n");
+
+        TestDriver<int,       std::less<int>       >::testCase4();
+        TestDriver<AllocType, DataLess<AllocType>  >::testCase4();
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // COPY CONSTRUCTION, ASSIGNMENT AND SWAP
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY CONSTRUCTION, ASSIGNMENT AND SWAP"
+                            "\n======================================\n");
+
+        TestDriver<int,       std::less<int>       >::testCase3();
+        TestDriver<AllocType, DataLess<AllocType>  >::testCase3();
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                            "\n========================================\n");
+
+        TestDriver<int,       std::less<int>       >::testCase2();
+        TestDriver<AllocType, DataLess<AllocType>  >::testCase2();
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, look up, and erase values, in a set large enough to
+        //:   have several levels, and verify the results.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            typedef bsl::btree_set<int> Obj;
+
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(X.empty());
+
+            const int N = 10000;
+            for (int i = 0; i < N; ++i) {
+                ASSERTV(i, mX.insert((i * 7919) % N).second);
+            }
+            ASSERT(N == static_cast<int>(X.size()));
+
+            int expected = 0;
+            for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(expected, *it, expected == *it);
+                ++expected;
+            }
+            ASSERT(N == expected);
+
+            Obj mY(X);  const Obj& Y = mY;
+            ASSERT(X == Y);
+
+            for (int i = 0; i < N; i += 2) {
+                ASSERTV(i, 1 == mX.erase(i));
+            }
+            ASSERT(N / 2 == static_cast<int>(X.size()));
+            ASSERT(X.end() == X.find(4));
+            ASSERT(5       == *X.find(5));
+            ASSERT(X != Y);
+            ASSERT(Y <  X);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -11,6 +11,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bslstl_Deque: standard-compliant 'bsl::deque' implementation
+//  bslstl::DequeBlockSize: customization point for the 'deque' block size
 //
 //@SEE_ALSO: bslstl_vector, bsl+stlhdrs
 //
@@ -36,6 +37,40 @@ BSLS_IDENT("$Id: $")
 //:   establish a full standard compliance for this component when used as
 //:   'bsl::deque' in the BSL STL.
 //
+///Block Size and Block Recycling
+///------------------------------
+// A 'deque' stores its elements in fixed-size blocks, each holding
+// 'BLOCK_LENGTH' elements, and keeps an array of pointers to those blocks.
+// By default a block occupies about 200 bytes (but always holds at least 16
+// elements), which is a good compromise for general-purpose use.  For small
+// elements in long-lived queues, however, such blocks fill up after only a few
+// dozen insertions, and the block-pointer array grows accordingly.  The
+// 'bslstl::DequeBlockSize' class template is a customization point that
+// clients may specialize for a particular 'VALUE_TYPE' to select the nominal
+// number of bytes per block (e.g., the size of a memory page):
+//..
+//  namespace BloombergLP {
+//  namespace bslstl {
+//
+//  template <>
+//  struct DequeBlockSize<MyMessage> : bsl::integral_constant<int, 4096> {
+//  };
+//
+//  }  // close package namespace
+//  }  // close enterprise namespace
+//..
+// The specialization must be visible wherever 'bsl::deque<MyMessage, A>' (or
+// an adapter such as 'bsl::queue<MyMessage>' that uses it) is instantiated.
+//
+// In addition, a 'deque' retains the most recently emptied block as a *spare*
+// block instead of returning it to the allocator immediately, and reuses that
+// block the next time a new block is needed at either end.  Consequently, a
+// deque used as a FIFO queue (i.e., with 'push_back' and 'pop_front') whose
+// length remains bounded stops calling its allocator once it reaches a steady
+// state: each block emptied at the front is recycled at the back.  The spare
+// block is released when the deque is destroyed, and is counted neither in
+// 'size' nor in 'capacity'.
+//
 ///Usage
 ///-----
 // In this section we show intended usage of this component.
@@ -214,6 +249,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslmf_assert.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_INTEGRALCONSTANT
+#include <bslmf_integralconstant.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ISSAME
 #include <bslmf_issame.h>
 #endif
@@ -256,6 +295,26 @@ BSL_OVERRIDES_STD mode"
 
 #endif
 
+namespace BloombergLP {
+namespace bslstl {
+
+                          // =====================
+                          // struct DequeBlockSize
+                          // =====================
+
+template <class VALUE_TYPE>
+struct DequeBlockSize : bsl::integral_constant<int, 200> {
+    // This 'struct' template provides a customization point for the nominal
+    // number of bytes in each block of a 'bsl::deque<VALUE_TYPE, ALLOCATOR>'.
+    // Clients may specialize this template for a specific 'VALUE_TYPE' to
+    // derive from a different 'bsl::integral_constant<int, N>' (where 'N' is
+    // positive).  Note that a block always holds at least 16 elements,
+    // irrespective of this value.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
 namespace bsl {
 
 template <class VALUE_TYPE, class ALLOCATOR>
@@ -272,17 +331,25 @@ class Deque_Guard;
 template <class VALUE_TYPE>
 struct Deque_BlockLengthCalcUtil {
     // This 'struct' provides a namespace for the calculation of block length
-    // (the number of elements per block within a 'deque').  This ensures that
-    // each block in the deque can hold at least 16 elements.
+    // (the number of elements per block within a 'deque') from the nominal
+    // block size given by 'bslstl::DequeBlockSize<VALUE_TYPE>'.  This ensures
+    // that each block in the deque can hold at least 16 elements.
 
     // TYPES
     enum {
-        DEFAULT_BLOCK_SIZE = 200,  // number of bytes per block
-        BLOCK_LENGTH       = (16 * sizeof(VALUE_TYPE) >= DEFAULT_BLOCK_SIZE)
+        DEFAULT_BLOCK_SIZE = 200,  // default number of bytes per block
+
+        BLOCK_SIZE         = BloombergLP::bslstl::
+                                          DequeBlockSize<VALUE_TYPE>::value,
+                                   // number of bytes per block
+
+        BLOCK_LENGTH       = (16 * sizeof(VALUE_TYPE) >= BLOCK_SIZE)
                              ? 16
-                             : (DEFAULT_BLOCK_SIZE / sizeof(VALUE_TYPE))
+                             : (BLOCK_SIZE / sizeof(VALUE_TYPE))
                                    // number of elements per block
     };
+
+    BSLMF_ASSERT(0 < BLOCK_SIZE);
 };
 
                           // ======================
@@ -539,6 +606,9 @@ class deque : public  Deque_Base<VALUE_TYPE>
         // Special type (and value) used to create a "raw" deque, which has 0
         // block length, and null start and finish pointers.
 
+    // DATA
+    Block *d_spareBlock_p;  // empty block retained for reuse, or 0 (owned)
+
   public:
     // PUBLIC TYPES
     typedef typename ALLOCATOR::reference           reference;
@@ -579,6 +649,18 @@ class deque : public  Deque_Base<VALUE_TYPE>
         // provide an exception-safe repository for intermediate calculations.
 
     // PRIVATE MANIPULATORS
+    Block *privateAllocateBlock();
+        // Return the address of an uninitialized block, reusing the spare
+        // block of this deque if there is one, and obtaining a new block from
+        // the allocator of this deque otherwise.
+
+    void privateDeallocateBlock(Block *block);
+        // Retain the specified 'block' as the spare block of this deque if
+        // this deque does not already have one, and return 'block' to the
+        // allocator of this deque otherwise.  The behavior is undefined unless
+        // 'block' was obtained from 'privateAllocateBlock' and contains no
+        // constructed elements.
+
     template <class INPUT_ITER>
     size_type privateAppend(INPUT_ITER                     first,
                             INPUT_ITER                     last,
@@ -866,7 +948,9 @@ class deque : public  Deque_Base<VALUE_TYPE>
 
     void clear();
         // Remove all the elements from this deque.  Note that this deque is
-        // empty after this call, but conserves the same capacity.
+        // empty after this call, but conserves the same capacity, and that one
+        // of the released blocks is retained as a spare block (see
+        // {Block Size and Block Recycling}).
 
     // ACCESSORS
 
@@ -1369,11 +1453,38 @@ inline
 deque<VALUE_TYPE, ALLOCATOR>::deque(RawInit, const ALLOCATOR& basicAllocator)
 : Deque_Base<VALUE_TYPE>()
 , ContainerBase(basicAllocator)
+, d_spareBlock_p(0)
 {
     this->d_blocks = 0;
 }
 
 // PRIVATE MANIPULATORS
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+typename deque<VALUE_TYPE,ALLOCATOR>::Block *
+deque<VALUE_TYPE,ALLOCATOR>::privateAllocateBlock()
+{
+    if (d_spareBlock_p) {
+        Block *block = d_spareBlock_p;
+        d_spareBlock_p = 0;
+        return block;                                                 // RETURN
+    }
+    return this->allocateN((Block *) 0, 1);
+}
+
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+void deque<VALUE_TYPE,ALLOCATOR>::privateDeallocateBlock(Block *block)
+{
+    BSLS_ASSERT_SAFE(block);
+
+    if (0 == d_spareBlock_p) {
+        d_spareBlock_p = block;
+        return;                                                       // RETURN
+    }
+    this->deallocateN(block, 1);
+}
+
 template <class VALUE_TYPE, class ALLOCATOR>
 template <class INPUT_ITER>
 typename deque<VALUE_TYPE,ALLOCATOR>::size_type
@@ -1499,7 +1610,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::privateInit(size_type numElements)
     // little room at the front and back of the array for growth.
 
     BlockPtr *firstBlockPtr = &this->d_blocks[Imp::BLOCK_ARRAY_PADDING];
-    *firstBlockPtr = this->allocateN((Block*) 0, 1);
+    *firstBlockPtr = privateAllocateBlock();
 
     // Calculate the offset into the first block such that 'n' elements will
     // leave equal space at the front of the first block and at the end of the
@@ -1674,7 +1785,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::privateSplit(
 
     // Good time to allocate block for exception safety.
 
-    Block *newBlock = this->allocateN((Block*) 0, 1);
+    Block *newBlock = privateAllocateBlock();
 
     // The following chunk of code will never throw an exception.  Move unsplit
     // blocks from 'this' to 'other', then adjust the iterators.
@@ -1988,6 +2099,7 @@ template <class VALUE_TYPE, class ALLOCATOR>
 deque<VALUE_TYPE, ALLOCATOR>::deque(const ALLOCATOR& basicAllocator)
 : Deque_Base<VALUE_TYPE>()
 , ContainerBase(basicAllocator)
+, d_spareBlock_p(0)
 {
     deque temp(RAW_INIT, this->get_allocator());
     temp.privateInit(0);
@@ -1999,6 +2111,7 @@ deque<VALUE_TYPE,ALLOCATOR>::deque(size_type         numElements,
                                    const ALLOCATOR&  basicAllocator)
 : Deque_Base<VALUE_TYPE>()
 , ContainerBase(basicAllocator)
+, d_spareBlock_p(0)
 {
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numElements > max_size())) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
@@ -2017,6 +2130,7 @@ deque<VALUE_TYPE,ALLOCATOR>::deque(size_type         numElements,
                                    const ALLOCATOR&  basicAllocator)
 : Deque_Base<VALUE_TYPE>()
 , ContainerBase(basicAllocator)
+, d_spareBlock_p(0)
 {
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numElements > max_size())) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
@@ -2036,6 +2150,7 @@ deque<VALUE_TYPE,ALLOCATOR>::deque(INPUT_ITER       first,
                                    const ALLOCATOR& basicAllocator)
 : Deque_Base<VALUE_TYPE>()
 , ContainerBase(basicAllocator)
+, d_spareBlock_p(0)
 {
     deque temp(RAW_INIT, this->get_allocator());
     temp.privateInit(0);
@@ -2047,6 +2162,7 @@ template <class VALUE_TYPE, class ALLOCATOR>
 deque<VALUE_TYPE,ALLOCATOR>::deque(const deque<VALUE_TYPE,ALLOCATOR>& original)
 : Deque_Base<VALUE_TYPE>()
 , ContainerBase(original)
+, d_spareBlock_p(0)
 {
     deque temp(RAW_INIT, this->get_allocator());
     temp.privateInit(original.size());
@@ -2062,6 +2178,7 @@ deque<VALUE_TYPE,ALLOCATOR>::deque(
                              const ALLOCATOR&                   basicAllocator)
 : Deque_Base<VALUE_TYPE>()
 , ContainerBase(basicAllocator)
+, d_spareBlock_p(0)
 {
     deque temp(RAW_INIT, this->get_allocator());
     temp.privateInit(original.size());
@@ -2074,25 +2191,27 @@ deque<VALUE_TYPE,ALLOCATOR>::deque(
 template <class VALUE_TYPE, class ALLOCATOR>
 deque<VALUE_TYPE,ALLOCATOR>::~deque()
 {
-    if (0 == this->d_blocks) {
-        // Nothing to do when destroying raw deques.
+    if (0 != this->d_blocks) {
+        if (0 != this->d_start.blockPtr()) {
+            // Destroy all elements and deallocate all but one block.
 
-        return;                                                       // RETURN
-    }
+            clear();
 
-    if (0 != this->d_start.blockPtr()) {
-        // Destroy all elements and deallocate all but one block.
+            // Deallocate the remaining (empty) block.
 
-        clear();
+            this->deallocateN(*this->d_start.blockPtr(), 1);
+        }
 
-        // Deallocate the remaining (empty) block.
+        // Deallocate the array of block pointers.
 
-        this->deallocateN(*this->d_start.blockPtr(), 1);
+        this->deallocateN(this->d_blocks, this->d_blocksLength);
     }
 
-    // Deallocate the array of block pointers.
+    // Deallocate the spare block, which even a raw deque may hold.
 
-    this->deallocateN(this->d_blocks, this->d_blocksLength);
+    if (d_spareBlock_p) {
+        this->deallocateN(d_spareBlock_p, 1);
+    }
 }
 
 // MANIPULATORS
@@ -2483,7 +2602,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::pop_front()
                                                      this->d_start.valuePtr());
 
     if (1 == this->d_start.remainingInBlock()) {
-        this->deallocateN(*this->d_start.blockPtr(), 1);
+        privateDeallocateBlock(*this->d_start.blockPtr());
         this->d_start.nextBlock();
         return;                                                       // RETURN
     }
@@ -2500,7 +2619,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::pop_back()
         --this->d_finish;
         BloombergLP::bslalg::ScalarDestructionPrimitives::destroy(
                                                     this->d_finish.valuePtr());
-        this->deallocateN(this->d_finish.blockPtr()[1], 1);
+        privateDeallocateBlock(this->d_finish.blockPtr()[1]);
         return;                                                       // RETURN
     }
 
@@ -2535,11 +2654,11 @@ deque<VALUE_TYPE,ALLOCATOR>::erase(const_iterator first,
 
     for ( ; oldStart.imp().blockPtr() != this->d_start.blockPtr();
                                                   oldStart.imp().nextBlock()) {
-        this->deallocateN(oldStart.imp().blockPtr()[0], 1);
+        privateDeallocateBlock(oldStart.imp().blockPtr()[0]);
     }
     for ( ; oldFinish.imp().blockPtr() != this->d_finish.blockPtr();
                                              oldFinish.imp().previousBlock()) {
-        this->deallocateN(oldFinish.imp().blockPtr()[0], 1);
+        privateDeallocateBlock(oldFinish.imp().blockPtr()[0]);
     }
     return result;
 }
@@ -2595,7 +2714,7 @@ void deque<VALUE_TYPE,ALLOCATOR>::clear()
     BlockPtr *startBlock = this->d_start.blockPtr();
     BlockPtr *finishBlock = this->d_finish.blockPtr();
     for ( ; startBlock != finishBlock; ++startBlock) {
-        this->deallocateN(*startBlock, 1);
+        privateDeallocateBlock(*startBlock);
     }
 
     // Reposition in the middle.
@@ -2739,7 +2858,7 @@ Deque_BlockCreator<VALUE_TYPE, ALLOCATOR>::~Deque_BlockCreator()
         for (; delFirst != delLast; ++delFirst) {
             // Deallocate the block that '*d_start' points to.
 
-            d_deque_p->deallocateN(*delFirst, 1);
+            d_deque_p->privateDeallocateBlock(*delFirst);
         }
     }
 }
@@ -2750,7 +2869,7 @@ void Deque_BlockCreator<VALUE_TYPE, ALLOCATOR>::insertAtFront(size_type n)
 {
     d_boundary = reserveBlockSlots(n, true);
     for ( ; n > 0; --n) {
-        d_boundary[-1] = d_deque_p->allocateN((Block*) 0, 1);
+        d_boundary[-1] = d_deque_p->privateAllocateBlock();
         --d_boundary;
     }
 }
@@ -2760,7 +2879,7 @@ void Deque_BlockCreator<VALUE_TYPE, ALLOCATOR>::insertAtBack(size_type n)
 {
     d_boundary = reserveBlockSlots(n, false);
     for ( ; n > 0; --n) {
-        *d_boundary = d_deque_p->allocateN((Block*) 0, 1);
+        *d_boundary = d_deque_p->privateAllocateBlock();
         ++d_boundary;
     }
 }
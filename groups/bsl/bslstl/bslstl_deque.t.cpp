@@ -145,8 +145,10 @@ using namespace bsl;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [11] ALLOCATOR-RELATED CONCERNS
-// [18] USAGE EXAMPLE
+// [27] USAGE EXAMPLE
 // [22] CONCERN: 'std::length_error' is used properly
+// [25] CONCERN: 'bslstl::DequeBlockSize' determines the block length
+// [25] CONCERN: a steady-state FIFO deque does not allocate
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(deque<T,A> *object, const char *spec, int vF = 1);
@@ -1266,6 +1268,45 @@ struct IsBitwiseMoveable<LimitAllocator<ALLOCATOR> >
 
 }  // namespace BloombergLP
 
+                          // =======================
+                          // struct PageSizedElement
+                          // =======================
+
+struct PageSizedElement {
+    // This 'struct' is a small test type for which 'bslstl::DequeBlockSize'
+    // is specialized (below) to request page-sized deque blocks.
+
+    // DATA
+    int d_value;
+};
+
+                         // ========================
+                         // struct LargeSizedElement
+                         // ========================
+
+struct LargeSizedElement {
+    // This 'struct' is a test type large enough that a specialization of
+    // 'bslstl::DequeBlockSize' requesting small blocks (below) is overridden
+    // by the minimum of 16 elements per block.
+
+    // DATA
+    char d_buffer[64];
+};
+
+namespace BloombergLP {
+namespace bslstl {
+
+template <>
+struct DequeBlockSize<PageSizedElement> : bsl::integral_constant<int, 4096> {
+};
+
+template <>
+struct DequeBlockSize<LargeSizedElement> : bsl::integral_constant<int, 64> {
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
 //=============================================================================
 //                       TEST DRIVER TEMPLATE
 //-----------------------------------------------------------------------------
@@ -1406,6 +1447,9 @@ struct TestDriver {
     static void testCaseM1();
         // Performance test.
 
+    static void testCase23();
+        // Test block recycling.
+
     static void testCase22();
         // Test proper use of 'std::length_error'.
 
@@ -2277,6 +2321,199 @@ void TestDriver<TYPE,ALLOC>::testCaseM1()
     }
 }
 
+template <class TYPE, class ALLOC>
+void TestDriver<TYPE,ALLOC>::testCase23()
+{
+    // ------------------------------------------------------------------------
+    // TESTING BLOCK RECYCLING
+    //
+    // Concerns:
+    //   1) Once a deque used as a FIFO queue (with 'push_back' and
+    //      'pop_front') has cycled through one block, further operations
+    //      keeping its length bounded do not allocate, whatever that length.
+    //   2) The same holds for a deque used as a FIFO queue in the opposite
+    //      direction (with 'push_front' and 'pop_back').
+    //   3) Alternately pushing and popping an element across a block boundary
+    //      does not allocate once the first block has been obtained.
+    //   4) Blocks released by 'erase' and 'clear' are recycled in the same
+    //      way, and all memory (including the spare block) is returned to the
+    //      allocator when the deque is destroyed.
+    //   5) 'push_back' is exception neutral when it reuses a spare block.
+    //
+    // Plan:
+    //   For a set of initial lengths, fill a deque, then perform several
+    //   block lengths' worth of push/pop pairs in each direction, and verify
+    //   using a test allocator that the number of allocations does not change
+    //   after the first block has been cycled.  Repeat with single-element
+    //   oscillation across a block boundary, and with 'erase' and 'clear'.
+    //   Finally, exercise 'push_back' after 'pop_front' under the
+    //   'bslma' exception-test loop.  Note that 'TYPE' must not allocate
+    //   memory itself, so that all allocations can be attributed to blocks.
+    //
+    // Testing:
+    //   CONCERN: a steady-state FIFO deque does not allocate
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator testAllocator(veryVeryVerbose);
+
+    const TYPE         *values     = 0;
+    const TYPE *const&  VALUES     = values;
+    const int           NUM_VALUES = getValues(&values);
+
+    enum { BLOCK_LENGTH = Deque_BlockLengthCalcUtil<TYPE>::BLOCK_LENGTH };
+
+    static const int LENGTHS[] = {
+        0, 1, 2, BLOCK_LENGTH - 1, BLOCK_LENGTH, BLOCK_LENGTH + 1,
+        3 * BLOCK_LENGTH, 10 * BLOCK_LENGTH + 7
+    };
+    const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+    if (verbose) printf("\tWith 'push_back' and 'pop_front'.\n");
+    {
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int LENGTH = LENGTHS[ti];
+
+            Obj mX(&testAllocator);  const Obj& X = mX;
+            for (int i = 0; i < LENGTH; ++i) {
+                mX.push_back(VALUES[i % NUM_VALUES]);
+            }
+
+            // Cycle through two blocks to reach a steady state, in which the
+            // last block emptied at the front has been retained as a spare.
+
+            int next = LENGTH;
+            for (int i = 0; i < 2 * BLOCK_LENGTH; ++i, ++next) {
+                mX.push_back(VALUES[next % NUM_VALUES]);
+                mX.pop_front();
+            }
+
+            const Int64 BLOCKS = testAllocator.numBlocksTotal();
+            const int   SIZE   = static_cast<int>(X.size());
+
+            for (int i = 0; i < 5 * BLOCK_LENGTH; ++i, ++next) {
+                mX.push_back(VALUES[next % NUM_VALUES]);
+                mX.pop_front();
+            }
+
+            LOOP_ASSERT(LENGTH, BLOCKS == testAllocator.numBlocksTotal());
+            LOOP_ASSERT(LENGTH, SIZE   == static_cast<int>(X.size()));
+            for (int i = 0; i < SIZE; ++i) {
+                LOOP2_ASSERT(LENGTH, i,
+                             VALUES[(next - SIZE + i) % NUM_VALUES] == X[i]);
+            }
+        }
+        ASSERT(0 == testAllocator.numBlocksInUse());
+    }
+
+    if (verbose) printf("\tWith 'push_front' and 'pop_back'.\n");
+    {
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int LENGTH = LENGTHS[ti];
+
+            Obj mX(&testAllocator);  const Obj& X = mX;
+            for (int i = 0; i < LENGTH; ++i) {
+                mX.push_front(VALUES[i % NUM_VALUES]);
+            }
+
+            int next = LENGTH;
+            for (int i = 0; i < 2 * BLOCK_LENGTH; ++i, ++next) {
+                mX.push_front(VALUES[next % NUM_VALUES]);
+                mX.pop_back();
+            }
+
+            const Int64 BLOCKS = testAllocator.numBlocksTotal();
+            const int   SIZE   = static_cast<int>(X.size());
+
+            for (int i = 0; i < 5 * BLOCK_LENGTH; ++i, ++next) {
+                mX.push_front(VALUES[next % NUM_VALUES]);
+                mX.pop_back();
+            }
+
+            LOOP_ASSERT(LENGTH, BLOCKS == testAllocator.numBlocksTotal());
+            LOOP_ASSERT(LENGTH, SIZE   == static_cast<int>(X.size()));
+            for (int i = 0; i < SIZE; ++i) {
+                LOOP2_ASSERT(LENGTH, i,
+                             VALUES[(next - 1 - i) % NUM_VALUES] == X[i]);
+            }
+        }
+        ASSERT(0 == testAllocator.numBlocksInUse());
+    }
+
+    if (verbose) printf("\tOscillating across a block boundary.\n");
+    {
+        Obj mX(&testAllocator);  const Obj& X = mX;
+
+        // Fill until the next 'push_back' requires a new block.
+
+        while (X.end().imp().remainingInBlock() > 1) {
+            mX.push_back(VALUES[0]);
+        }
+        const int SIZE = static_cast<int>(X.size());
+
+        mX.push_back(VALUES[1]);
+        mX.pop_back();
+
+        const Int64 BLOCKS = testAllocator.numBlocksTotal();
+
+        for (int i = 0; i < 100; ++i) {
+            mX.push_back(VALUES[1]);
+            ASSERT(VALUES[1] == X.back());
+            mX.pop_back();
+            ASSERT(SIZE == static_cast<int>(X.size()));
+        }
+        ASSERT(BLOCKS == testAllocator.numBlocksTotal());
+    }
+    ASSERT(0 == testAllocator.numBlocksInUse());
+
+    if (verbose) printf("\tWith 'erase' and 'clear'.\n");
+    {
+        Obj mX(&testAllocator);  const Obj& X = mX;
+
+        for (int i = 0; i < 4 * BLOCK_LENGTH; ++i) {
+            mX.push_back(VALUES[i % NUM_VALUES]);
+        }
+        const Int64 IN_USE = testAllocator.numBlocksInUse();
+
+        // Erasing the first two blocks' worth of elements frees at least one
+        // block, which is retained for reuse.
+
+        mX.erase(X.begin(), X.begin() + 2 * BLOCK_LENGTH);
+        ASSERT(IN_USE > testAllocator.numBlocksInUse());
+
+        Int64 blocks = testAllocator.numBlocksTotal();
+        for (int i = 0; i < BLOCK_LENGTH - 1; ++i) {
+            mX.push_back(VALUES[i % NUM_VALUES]);
+        }
+        ASSERT(blocks == testAllocator.numBlocksTotal());
+
+        mX.clear();
+        ASSERT(X.empty());
+
+        blocks = testAllocator.numBlocksTotal();
+        for (int i = 0; i < BLOCK_LENGTH; ++i) {
+            mX.push_back(VALUES[i % NUM_VALUES]);
+        }
+        ASSERT(blocks == testAllocator.numBlocksTotal());
+    }
+    ASSERT(0 == testAllocator.numBlocksInUse());
+
+    if (verbose) printf("\tException neutrality.\n");
+    {
+        BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(testAllocator) {
+            Obj mX(&testAllocator);  const Obj& X = mX;
+
+            for (int i = 0; i < 3 * BLOCK_LENGTH; ++i) {
+                mX.push_back(VALUES[i % NUM_VALUES]);
+                if (0 == i % 3) {
+                    mX.pop_front();
+                }
+            }
+            ASSERT(2 * BLOCK_LENGTH == static_cast<int>(X.size()));
+        } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+    }
+    ASSERT(0 == testAllocator.numBlocksInUse());
+}
+
 template <class TYPE, class ALLOC>
 void TestDriver<TYPE,ALLOC>::testCase22()
 {
@@ -7916,7 +8153,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 26: {
+      case 27: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2
         //
@@ -8122,7 +8359,7 @@ int main(int argc, char *argv[])
         }
 //..
       } break;
-      case 25: {
+      case 26: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1
         //
@@ -8189,6 +8426,112 @@ int main(int argc, char *argv[])
         // Next: Wally Walters
         // Next: Fred Flintstone
       } break;
+      case 25: {
+        // --------------------------------------------------------------------
+        // TESTING BLOCK SIZE POLICY AND BLOCK RECYCLING
+        //
+        // Concerns:
+        //   1) By default, a block holds 'DEFAULT_BLOCK_SIZE' bytes' worth of
+        //      elements, but at least 16 elements.
+        //   2) A specialization of 'bslstl::DequeBlockSize' for a type changes
+        //      the block length of deques of that type (subject to the same
+        //      minimum), and deques of that type work as expected.
+        //   3) Blocks emptied at one end of a deque are recycled (see
+        //      'testCase23').
+        //
+        // Plan:
+        //   Verify the 'BLOCK_LENGTH' calculated for types with and without a
+        //   'bslstl::DequeBlockSize' specialization.  Fill a deque of a type
+        //   requesting page-sized blocks, and verify the number of blocks
+        //   allocated and the resulting value.  Then invoke 'testCase23' for
+        //   several element types that do not allocate memory.
+        //
+        // Testing:
+        //   CONCERN: 'bslstl::DequeBlockSize' determines the block length
+        //   CONCERN: a steady-state FIFO deque does not allocate
+        // --------------------------------------------------------------------
+
+        if (verbose)
+                   printf("\nTESTING BLOCK SIZE POLICY AND BLOCK RECYCLING"
+                          "\n=============================================\n");
+
+        if (verbose) printf("\nBlock length calculation.\n");
+        {
+            ASSERT(200 == Deque_BlockLengthCalcUtil<char>::BLOCK_SIZE);
+            ASSERT(200 == Deque_BlockLengthCalcUtil<char>::BLOCK_LENGTH);
+            ASSERT(200 / sizeof(int) ==
+                           (size_t) Deque_BlockLengthCalcUtil<int>::
+                                                                BLOCK_LENGTH);
+            ASSERT(16  == Deque_BlockLengthCalcUtil<L>::BLOCK_LENGTH);
+
+            ASSERT(4096 == Deque_BlockLengthCalcUtil<PageSizedElement>::
+                                                                  BLOCK_SIZE);
+            ASSERT(4096 / sizeof(PageSizedElement) ==
+                    (size_t) Deque_BlockLengthCalcUtil<PageSizedElement>::
+                                                                BLOCK_LENGTH);
+            ASSERT(64 == Deque_BlockLengthCalcUtil<LargeSizedElement>::
+                                                                  BLOCK_SIZE);
+            ASSERT(16 == Deque_BlockLengthCalcUtil<LargeSizedElement>::
+                                                                BLOCK_LENGTH);
+        }
+
+        if (verbose) printf("\nDeque with page-sized blocks.\n");
+        {
+            typedef bsl::deque<PageSizedElement> PageDeque;
+
+            enum {
+                BLOCK_LENGTH = Deque_BlockLengthCalcUtil<PageSizedElement>::
+                                                                  BLOCK_LENGTH
+            };
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            {
+                PageDeque mX(&oa);  const PageDeque& X = mX;
+
+                // An empty deque holds the block-pointer array and one block.
+
+                ASSERT(2 == oa.numBlocksInUse());
+
+                // Half a block (less one) fits in the first block, since an
+                // empty deque starts in the middle of that block.
+
+                for (int i = 0; i < BLOCK_LENGTH / 2 - 1; ++i) {
+                    PageSizedElement e = { i };
+                    mX.push_back(e);
+                }
+                ASSERT(2 == oa.numBlocksInUse());
+
+                for (int i = BLOCK_LENGTH / 2 - 1; i < 4 * BLOCK_LENGTH; ++i) {
+                    PageSizedElement e = { i };
+                    mX.push_back(e);
+                }
+                LOOP_ASSERT(oa.numBlocksInUse(), 6 >= oa.numBlocksInUse());
+
+                ASSERT(4 * BLOCK_LENGTH == static_cast<int>(X.size()));
+                for (int i = 0; i < 4 * BLOCK_LENGTH; ++i) {
+                    LOOP_ASSERT(i, i == X[i].d_value);
+                }
+
+                while (!X.empty()) {
+                    mX.pop_front();
+                }
+            }
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\nBlock recycling with 'char'.\n");
+        TestDriver<char>::testCase23();
+
+        if (verbose) printf("\nBlock recycling with 'S'.\n");
+        TestDriver<S>::testCase23();
+
+        if (verbose) printf("\nBlock recycling with 'M'.\n");
+        TestDriver<M>::testCase23();
+
+        if (verbose) printf("\nBlock recycling with 'L'.\n");
+        TestDriver<L>::testCase23();
+
+      } break;
       case 24: {
         // --------------------------------------------------------------------
         // TESTING EXCEPTIONS
@@ -0,0 +1,375 @@
+// bslstl_flatcontainerutil.h                                         -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATCONTAINERUTIL
+#define INCLUDED_BSLSTL_FLATCONTAINERUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide algorithms merging unordered keys into a sorted sequence.
+//
+//@CLASSES:
+//  bslstl::FlatContainerUtil: utilities for sorted-sequence containers
+//
+//@SEE_ALSO: bslstl_flatmap, bslstl_flatset
+//
+//@DESCRIPTION: This component provides a namespace, 'FlatContainerUtil',
+// for the algorithms used by containers that hold their keys in a sorted,
+// contiguous sequence (see 'bslstl_flatmap' and 'bslstl_flatset') to insert
+// many keys at once.  Inserting N keys one at a time into such a sequence of
+// n keys shifts O[n] keys per insertion, and so takes O[N * n] time.  Instead,
+// a container appends the new keys to its sequence, calls 'mergeOrder' to
+// compute, in O[N * log(N) + n] time, the position of each key that is to be
+// retained in the merged sequence, and then calls 'gather' to build the
+// merged sequence in a single pass.
+//
+// 'mergeOrder' sorts the indices of the appended keys, rather than the keys
+// themselves, so it neither copies nor swaps keys, and, since the sort is
+// performed using 'std::sort' on an array of integers, allocates no memory
+// other than that of the supplied index container.  When the appended keys
+// are already in order and follow the last of the original keys (the common
+// case of loading a container from sorted data), 'mergeOrder' detects this in
+// a single linear pass and reports that no reordering is necessary.
+//
+// 'FlatContainerUtil' also provides 'copyWithInsert', used by the containers
+// to insert a single key where inserting it in place would not provide the
+// strong exception-safety guarantee.  'bsl::vector::insert' shifts the
+// elements following the insertion point by assignment unless the element
+// type is bitwise moveable, and an exception thrown by one of those
+// assignments leaves the vector holding a duplicated element; such a key is
+// instead inserted by building a copy of the sequence that includes the key,
+// which is then swapped with the original.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Merging a Batch of Keys into a Sorted Vector
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we hold a sorted sequence of unique keys in a 'bsl::vector', and we
+// receive a batch of keys in no particular order, some of which are already
+// present.
+//
+// First, we create the sorted sequence, and append the batch to it:
+//..
+//  bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+//
+//  bsl::vector<int> keys(&oa);
+//  keys.push_back(10);
+//  keys.push_back(20);
+//  keys.push_back(30);
+//
+//  const std::size_t numOrdered = keys.size();
+//
+//  keys.push_back(25);
+//  keys.push_back(5);
+//  keys.push_back(20);
+//  keys.push_back(25);
+//..
+// Then, we compute the order in which the retained keys appear in the merged
+// sequence:
+//..
+//  bsl::vector<std::size_t> order(&oa);
+//  bool isReordered = bslstl::FlatContainerUtil::mergeOrder(
+//                                                         &order,
+//                                                         keys,
+//                                                         numOrdered,
+//                                                         std::less<int>());
+//  assert(isReordered);
+//  assert(5 == order.size());
+//..
+// Notice that the duplicate key 20 (already present) and the second
+// occurrence of 25 are dropped.
+//
+// Finally, we gather the keys into a new vector, and replace the original:
+//..
+//  bsl::vector<int> merged(&oa);
+//  bslstl::FlatContainerUtil::gather(&merged, keys, order);
+//  keys.swap(merged);
+//
+//  assert( 5 == keys[0]);
+//  assert(10 == keys[1]);
+//  assert(20 == keys[2]);
+//  assert(25 == keys[3]);
+//  assert(30 == keys[4]);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_ALGORITHM
+#include <algorithm>
+#define INCLUDED_ALGORITHM
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                     // =================================
+                     // class FlatContainerUtil_IndexLess
+                     // =================================
+
+template <class KEY_CONTAINER, class COMPARATOR>
+class FlatContainerUtil_IndexLess {
+    // This component-private class provides a functor ordering indices into
+    // a container of keys by the keys they refer to, and ordering the indices
+    // of equivalent keys by their values, so that sorting indices with this
+    // functor is stable even though 'std::sort' is not.
+
+    // DATA
+    const KEY_CONTAINER *d_keys_p;        // keys referred to (held, not owned)
+    const COMPARATOR    *d_comparator_p;  // key ordering (held, not owned)
+
+  public:
+    // CREATORS
+    FlatContainerUtil_IndexLess(const KEY_CONTAINER *keys,
+                                const COMPARATOR    *comparator);
+        // Create a functor ordering indices into the specified 'keys' by the
+        // specified 'comparator'.
+
+    // ACCESSORS
+    bool operator()(std::size_t lhs, std::size_t rhs) const;
+        // Return 'true' if the key at the specified 'lhs' index is ordered
+        // before the key at the specified 'rhs' index, or if the two keys are
+        // equivalent and 'lhs < rhs', and 'false' otherwise.
+};
+
+                         // ========================
+                         // struct FlatContainerUtil
+                         // ========================
+
+struct FlatContainerUtil {
+    // This 'struct' provides a namespace for algorithms operating on
+    // containers that hold a sorted sequence of unique keys in contiguous
+    // storage.
+
+    // CLASS METHODS
+    template <class INDEX_CONTAINER, class KEY_CONTAINER, class COMPARATOR>
+    static bool mergeOrder(INDEX_CONTAINER      *result,
+                           const KEY_CONTAINER&  keys,
+                           std::size_t           numOrdered,
+                           const COMPARATOR&     comparator);
+        // Load into the specified 'result' the indices, in the specified
+        // 'keys', of the keys retained by merging the keys at the positions
+        // '[numOrdered .. keys.size())' into those at the positions
+        // '[0 .. numOrdered)', in the order in which the retained keys appear
+        // in the merged sequence, ordered by the specified 'comparator', and
+        // return 'true'; or, if the keys are already in strictly increasing
+        // order (so that no key need be dropped or moved), return 'false'
+        // without modifying 'result'.  A key at a position at or after
+        // 'numOrdered' is not retained if an equivalent key appears before
+        // it.  'INDEX_CONTAINER' shall be a random-access sequence container
+        // of 'std::size_t' providing 'resize', and 'KEY_CONTAINER' shall
+        // provide 'size' and 'operator[]'.  The behavior is undefined unless
+        // 'numOrdered <= keys.size()', and the keys at positions
+        // '[0 .. numOrdered)' are in strictly increasing order.  Note that
+        // 'result' is resized to 'keys.size()' before being truncated to the
+        // number of retained keys.
+
+    template <class CONTAINER>
+    static void copyWithInsert(
+                          CONTAINER                             *result,
+                          const CONTAINER&                       source,
+                          std::size_t                            position,
+                          const typename CONTAINER::value_type&  value);
+        // Append to the specified 'result' a copy of each element of the
+        // specified 'source', with a copy of the specified 'value' inserted
+        // before the element at the specified 'position' (or after the last
+        // element if 'position == source.size()').  Reserve in 'result'
+        // capacity at least that of 'source', and at least twice the size of
+        // 'source' if 'source' has no spare capacity, so that a container
+        // growing by repeated insertions allocates amortized O[1] times per
+        // insertion.  'CONTAINER' shall provide 'reserve', 'capacity',
+        // 'insert' of a range at its end, and 'push_back'.  The behavior is
+        // undefined unless 'result' is empty, 'position <= source.size()',
+        // and neither 'result' nor 'value' refer to (elements of) 'source'.
+
+    template <class CONTAINER, class INDEX_CONTAINER>
+    static void gather(CONTAINER              *result,
+                       const CONTAINER&        source,
+                       const INDEX_CONTAINER&  indices);
+        // Append to the specified 'result' a copy of each element of the
+        // specified 'source' at the positions given by the specified
+        // 'indices', in the order of 'indices'.  'CONTAINER' shall provide
+        // 'reserve', 'push_back' and 'operator[]'.  The behavior is undefined
+        // unless each of 'indices' is less than 'source.size()', and 'result'
+        // and 'source' refer to distinct objects.
+};
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                     // ---------------------------------
+                     // class FlatContainerUtil_IndexLess
+                     // ---------------------------------
+
+// CREATORS
+template <class KEY_CONTAINER, class COMPARATOR>
+inline
+FlatContainerUtil_IndexLess<KEY_CONTAINER, COMPARATOR>::
+FlatContainerUtil_IndexLess(const KEY_CONTAINER *keys,
+                            const COMPARATOR    *comparator)
+: d_keys_p(keys)
+, d_comparator_p(comparator)
+{
+}
+
+// ACCESSORS
+template <class KEY_CONTAINER, class COMPARATOR>
+inline
+bool FlatContainerUtil_IndexLess<KEY_CONTAINER, COMPARATOR>::operator()(
+                                                        std::size_t lhs,
+                                                        std::size_t rhs) const
+{
+    if ((*d_comparator_p)((*d_keys_p)[lhs], (*d_keys_p)[rhs])) {
+        return true;                                                  // RETURN
+    }
+    if ((*d_comparator_p)((*d_keys_p)[rhs], (*d_keys_p)[lhs])) {
+        return false;                                                 // RETURN
+    }
+    return lhs < rhs;
+}
+
+                         // ------------------------
+                         // struct FlatContainerUtil
+                         // ------------------------
+
+// CLASS METHODS
+template <class INDEX_CONTAINER, class KEY_CONTAINER, class COMPARATOR>
+bool FlatContainerUtil::mergeOrder(INDEX_CONTAINER      *result,
+                                   const KEY_CONTAINER&  keys,
+                                   std::size_t           numOrdered,
+                                   const COMPARATOR&     comparator)
+{
+    BSLS_ASSERT_SAFE(result);
+    BSLS_ASSERT_SAFE(numOrdered <= keys.size());
+
+    const std::size_t numKeys = keys.size();
+
+    // Check whether the appended keys continue the ordered sequence, in
+    // which case there is nothing to do.
+
+    std::size_t i = 0 < numOrdered ? numOrdered : 1;
+    while (i < numKeys && comparator(keys[i - 1], keys[i])) {
+        ++i;
+    }
+    if (i >= numKeys) {
+        return false;                                                 // RETURN
+    }
+
+    // Sort the indices of the appended keys, in place at the end of
+    // 'result', then merge them with the (implicit) indices of the ordered
+    // keys into the front of 'result'.  Each retained index is written at a
+    // position no greater than that of the next appended index yet to be
+    // read, and strictly less unless all the ordered keys have been written,
+    // so the merge never overwrites an index before it is read.
+
+    result->resize(numKeys);
+    for (i = numOrdered; i < numKeys; ++i) {
+        (*result)[i] = i;
+    }
+    std::sort(result->begin() + numOrdered,
+              result->end(),
+              FlatContainerUtil_IndexLess<KEY_CONTAINER, COMPARATOR>(
+                                                                 &keys,
+                                                                 &comparator));
+
+    std::size_t numRetained = 0;
+    std::size_t ordered     = 0;
+    std::size_t appended    = numOrdered;
+
+    while (appended < numKeys) {
+        const std::size_t candidate = (*result)[appended];
+
+        if (ordered < numOrdered
+         && comparator(keys[ordered], keys[candidate])) {
+            (*result)[numRetained++] = ordered++;
+        }
+        else {
+            // Retain 'candidate' unless it is equivalent to the next ordered
+            // key, or to the last key retained (an earlier appended key).
+
+            if ((ordered == numOrdered
+              || comparator(keys[candidate], keys[ordered]))
+             && (0 == numRetained
+              || comparator(keys[(*result)[numRetained - 1]],
+                            keys[candidate]))) {
+                (*result)[numRetained++] = candidate;
+            }
+            ++appended;
+        }
+    }
+    while (ordered < numOrdered) {
+        (*result)[numRetained++] = ordered++;
+    }
+    result->resize(numRetained);
+    return true;
+}
+
+template <class CONTAINER>
+void FlatContainerUtil::copyWithInsert(
+                             CONTAINER                             *result,
+                             const CONTAINER&                       source,
+                             std::size_t                            position,
+                             const typename CONTAINER::value_type&  value)
+{
+    BSLS_ASSERT_SAFE(result);
+    BSLS_ASSERT_SAFE(result != &source);
+    BSLS_ASSERT_SAFE(result->empty());
+    BSLS_ASSERT_SAFE(position <= source.size());
+
+    const std::size_t size = source.size();
+    result->reserve(size < source.capacity() ? source.capacity() : 2 * size);
+    result->insert(result->end(), source.begin(), source.begin() + position);
+    result->push_back(value);
+    result->insert(result->end(), source.begin() + position, source.end());
+}
+
+template <class CONTAINER, class INDEX_CONTAINER>
+void FlatContainerUtil::gather(CONTAINER              *result,
+                               const CONTAINER&        source,
+                               const INDEX_CONTAINER&  indices)
+{
+    BSLS_ASSERT_SAFE(result);
+    BSLS_ASSERT_SAFE(result != &source);
+
+    result->reserve(result->size() + indices.size());
+    for (typename INDEX_CONTAINER::const_iterator it = indices.begin();
+         it != indices.end();
+         ++it) {
+        result->push_back(source[*it]);
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,643 @@
+// bslstl_flatcontainerutil.t.cpp                                     -*-C++-*-
+#include <bslstl_flatcontainerutil.h>
+
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_types.h>
+
+#include <bsltf_alloctesttype.h>
+
+#include <algorithm>
+#include <functional>
+#include <set>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a utility 'struct' of three function
+// templates.  'mergeOrder' is tested with a table of ordered and appended
+// keys, given as strings of characters, covering empty sequences, appended
+// keys before, between, and after the ordered keys, keys duplicated among the
+// appended keys and between the appended and the ordered keys, and the fast
+// path taken when no reordering is necessary; the results are also checked
+// against 'std::set' for pseudo-random sequences.  'gather' and
+// 'copyWithInsert' are tested directly, the latter also for exception
+// safety.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] bool mergeOrder(IC *r, const KC& keys, size_t num, const CMP&);
+// [ 3] void gather(C *result, const C& source, const IC& indices);
+// [ 4] void copyWithInsert(C *r, const C& src, size_t pos, const V&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bsls::Types::Int64       Int64;
+typedef bslstl::FlatContainerUtil Util;
+typedef bsl::vector<std::size_t>  Indices;
+typedef bsltf::AllocTestType      AllocType;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static int nextRandom(unsigned *seed)
+    // Advance the specified 'seed' of a linear congruential generator and
+    // return the next pseudo-random number in the range '[0, 32767]'.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return static_cast<int>((*seed >> 16) & 0x7fff);
+}
+
+struct DivLess {
+    // This 'struct' provides a comparator ordering integers by their
+    // quotients by 4.
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the quotient of the specified 'lhs' by 4 is less
+        // than that of the specified 'rhs', and 'false' otherwise.
+    {
+        return lhs / 4 < rhs / 4;
+    }
+};
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Merging a Batch of Keys into a Sorted Vector
+///- - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we hold a sorted sequence of unique keys in a 'bsl::vector', and we
+// receive a batch of keys in no particular order, some of which are already
+// present.
+//
+// First, we create the sorted sequence, and append the batch to it:
+//..
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+    bsl::vector<int> keys(&oa);
+    keys.push_back(10);
+    keys.push_back(20);
+    keys.push_back(30);
+
+    const std::size_t numOrdered = keys.size();
+
+    keys.push_back(25);
+    keys.push_back(5);
+    keys.push_back(20);
+    keys.push_back(25);
+//..
+// Then, we compute the order in which the retained keys appear in the merged
+// sequence:
+//..
+    bsl::vector<std::size_t> order(&oa);
+    bool isReordered = bslstl::FlatContainerUtil::mergeOrder(
+                                                           &order,
+                                                           keys,
+                                                           numOrdered,
+                                                           std::less<int>());
+    ASSERT(isReordered);
+    ASSERT(5 == order.size());
+//..
+// Notice that the duplicate key 20 (already present) and the second
+// occurrence of 25 are dropped.
+//
+// Finally, we gather the keys into a new vector, and replace the original:
+//..
+    bsl::vector<int> merged(&oa);
+    bslstl::FlatContainerUtil::gather(&merged, keys, order);
+    keys.swap(merged);
+
+    ASSERT( 5 == keys[0]);
+    ASSERT(10 == keys[1]);
+    ASSERT(20 == keys[2]);
+    ASSERT(25 == keys[3]);
+    ASSERT(30 == keys[4]);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'copyWithInsert'
+        //
+        // Concerns:
+        //: 1 The result holds the elements of the source, in order, with the
+        //:   value inserted at the specified position, for every position
+        //:   from the first to one past the last.
+        //:
+        //: 2 The capacity of the result is at least that of the source, and
+        //:   at least twice the size of the source if the source is full.
+        //:
+        //: 3 The source is not modified, even if an exception is thrown.
+        //
+        // Plan:
+        //: 1 For sources of several lengths and each position, copy with an
+        //:   insertion, and verify the result, its capacity and the source.
+        //:   (C-1..2)
+        //:
+        //: 2 Repeat P-1 for an allocating element type, under
+        //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*'.  (C-3)
+        //
+        // Testing:
+        //   void copyWithInsert(C *r, const C& src, size_t pos, const V&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'copyWithInsert'"
+                            "\n================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        for (int length = 0; length < 10; ++length) {
+            bsl::vector<int> source(&oa);
+            for (int i = 0; i < length; ++i) {
+                source.push_back(i * 2);
+            }
+
+            for (int position = 0; position <= length; ++position) {
+                bsl::vector<int> result(&oa);
+                Util::copyWithInsert(&result, source, position, -1);
+
+                ASSERTV(length, position, length + 1 == (int)result.size());
+                ASSERTV(length, position,
+                        source.capacity() <= result.capacity());
+                if (source.size() == source.capacity()) {
+                    ASSERTV(length, position,
+                            2 * source.size() <= result.capacity());
+                }
+                for (int i = 0; i <= length; ++i) {
+                    const int EXP = i < position  ? i * 2
+                                  : i == position ? -1
+                                  :                 (i - 1) * 2;
+                    ASSERTV(length, position, i, EXP == result[i]);
+                }
+                ASSERTV(length, position, length == (int)source.size());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (veryVerbose) printf("\tException safety.\n");
+
+        for (int length = 0; length < 6; ++length) {
+            bsl::vector<AllocType> source(&oa);
+            for (int i = 0; i < length; ++i) {
+                source.push_back(AllocType(i * 2, &sa));
+            }
+            const AllocType VALUE(-1, &sa);
+
+            for (int position = 0; position <= length; ++position) {
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    bsl::vector<AllocType> result(&oa);
+                    Util::copyWithInsert(&result, source, position, VALUE);
+
+                    ASSERTV(length, position,
+                            -1 == result[position].data());
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(length, position, length == (int)source.size());
+                for (int i = 0; i < length; ++i) {
+                    ASSERTV(length, position, i,
+                            i * 2 == source[i].data());
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'gather'
+        //
+        // Concerns:
+        //: 1 'gather' appends to the result a copy of the source element at
+        //:   each index, in the order of the indices, including repeated
+        //:   indices, and allocates at most once for the result.
+        //
+        // Plan:
+        //: 1 Gather elements of a source using several sequences of indices,
+        //:   into empty and non-empty results, and verify the results and the
+        //:   number of allocations.  (C-1)
+        //
+        // Testing:
+        //   void gather(C *result, const C& source, const IC& indices);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'gather'"
+                            "\n========\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        static const struct {
+            int         d_line;     // source line number
+            const char *d_indices;  // indices, as digits
+            const char *d_prefix;   // initial contents of the result
+            const char *d_result;   // expected result
+        } DATA[] = {
+            //LINE  INDICES   PREFIX  RESULT
+            //----  -------   ------  --------
+            { L_,   "",       "",     ""       },
+            { L_,   "0",      "",     "a"      },
+            { L_,   "43210",  "",     "edcba"  },
+            { L_,   "024",    "",     "ace"    },
+            { L_,   "11",     "",     "bb"     },
+            { L_,   "31",     "x",    "xdb"    },
+            { L_,   "",       "xy",   "xy"     },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bsl::vector<char> source(&sa);
+        for (const char *c = "abcde"; *c; ++c) {
+            source.push_back(*c);
+        }
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE    = DATA[ti].d_line;
+            const char *INDICES = DATA[ti].d_indices;
+            const char *PREFIX  = DATA[ti].d_prefix;
+            const char *RESULT  = DATA[ti].d_result;
+
+            Indices indices(&oa);
+            for (const char *c = INDICES; *c; ++c) {
+                indices.push_back(*c - '0');
+            }
+
+            bsl::vector<char> result(PREFIX,
+                                     PREFIX + strlen(PREFIX),
+                                     &oa);
+
+            const Int64 NUM_ALLOCATIONS = oa.numAllocations();
+            Util::gather(&result, source, indices);
+            ASSERTV(LINE, oa.numAllocations() - NUM_ALLOCATIONS <= 1);
+
+            ASSERTV(LINE, strlen(RESULT) == result.size());
+            ASSERTV(LINE, std::equal(result.begin(), result.end(), RESULT));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'mergeOrder'
+        //
+        // Concerns:
+        //: 1 'mergeOrder' returns 'false', and does not modify the result,
+        //:   exactly when the keys are in strictly increasing order.
+        //:
+        //: 2 Otherwise, the result holds the indices of the keys retained by
+        //:   the merge, in the order of their keys: every ordered key, and
+        //:   the first of each group of equivalent appended keys not
+        //:   equivalent to an ordered key.
+        //:
+        //: 3 The supplied comparator is used to order the keys.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, call 'mergeOrder' for keys
+        //:   given as characters, and verify the return value and the
+        //:   indices.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 with 'std::greater' on the reversed keys.  (C-3)
+        //:
+        //: 3 For pseudo-random sequences of pairs, merge appended pairs
+        //:   ordered by their first member into ordered pairs, and verify
+        //:   the retained keys against 'std::set', and that the first of
+        //:   equivalent appended pairs is retained.  (C-2)
+        //
+        // Testing:
+        //   bool mergeOrder(IC *r, const KC& keys, size_t num, const CMP&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'mergeOrder'"
+                            "\n============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        static const struct {
+            int         d_line;       // source line number
+            const char *d_ordered;    // ordered keys
+            const char *d_appended;   // appended keys
+            const char *d_expected;   // expected indices, as digits, or 0 if
+                                      // 'mergeOrder' is to return 'false'
+        } DATA[] = {
+            //LINE  ORDERED  APPENDED  EXPECTED
+            //----  -------  --------  --------
+            { L_,   "",      "",       0          },
+            { L_,   "a",     "",       0          },
+            { L_,   "ace",   "",       0          },
+            { L_,   "",      "a",      0          },
+            { L_,   "",      "abc",    0          },
+            { L_,   "ab",    "cd",     0          },
+
+            { L_,   "",      "ba",     "10"       },
+            { L_,   "",      "aa",     "0"        },
+            { L_,   "",      "cabac",  "120"      },
+            { L_,   "b",     "a",      "10"       },
+            { L_,   "b",     "b",      "0"        },
+            { L_,   "b",     "c",      0          },
+            { L_,   "ace",   "b",      "0312"     },
+            { L_,   "ace",   "d",      "0132"     },
+            { L_,   "ace",   "f",      0          },
+            { L_,   "ace",   "gf",     "01243"    },
+            { L_,   "ace",   "ea",     "012"      },
+            { L_,   "ace",   "dbdb",   "04132"    },
+            { L_,   "bd",    "edcba",  "60412"    },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE     = DATA[ti].d_line;
+            const char *ORDERED  = DATA[ti].d_ordered;
+            const char *APPENDED = DATA[ti].d_appended;
+            const char *EXPECTED = DATA[ti].d_expected;
+
+            if (veryVerbose) { P_(LINE) P_(ORDERED) P(APPENDED) }
+
+            for (int tc = 0; tc < 2; ++tc) {
+                bsl::vector<char> keys(&oa);
+                keys.insert(keys.end(), ORDERED, ORDERED + strlen(ORDERED));
+                keys.insert(keys.end(),
+                            APPENDED,
+                            APPENDED + strlen(APPENDED));
+                if (tc) {
+                    // Invert the keys, so that 'std::greater' orders them as
+                    // 'std::less' orders the original keys.
+
+                    for (std::size_t i = 0; i < keys.size(); ++i) {
+                        keys[i] = static_cast<char>('z' - keys[i]);
+                    }
+                }
+
+                Indices result(&oa);
+                result.push_back(99);
+
+                const bool isReordered = tc
+                    ? Util::mergeOrder(&result,
+                                       keys,
+                                       strlen(ORDERED),
+                                       std::greater<char>())
+                    : Util::mergeOrder(&result,
+                                       keys,
+                                       strlen(ORDERED),
+                                       std::less<char>());
+
+                ASSERTV(LINE, tc, (0 != EXPECTED) == isReordered);
+                if (!EXPECTED) {
+                    ASSERTV(LINE, tc, 1  == result.size());
+                    ASSERTV(LINE, tc, 99 == result[0]);
+                    continue;
+                }
+                ASSERTV(LINE, tc, strlen(EXPECTED) == result.size());
+                for (std::size_t i = 0; i < result.size(); ++i) {
+                    ASSERTV(LINE, tc, i, EXPECTED[i] - '0' == (int)result[i]);
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (veryVerbose) printf("\tPseudo-random sequences.\n");
+
+        for (int length = 0; length < 200; length += 1 + length / 4) {
+            for (int numOrdered = 0; numOrdered <= length;
+                                     numOrdered += 1 + length / 3) {
+                unsigned seed = static_cast<unsigned>(length * 31
+                                                                + numOrdered);
+
+                // Key 'i' is held as 'i * 4' if ordered, and as 'i * 4 + 1'
+                // if appended, so that the retained key can be identified;
+                // 'DivLess' compares keys by their quotients by 4.
+
+                std::set<int> ordered;
+                while ((int)ordered.size() < numOrdered) {
+                    ordered.insert(nextRandom(&seed) % (2 * length + 1));
+                }
+
+                std::vector<int> keys;
+                for (std::set<int>::const_iterator it  = ordered.begin();
+                                                   it != ordered.end();
+                                                   ++it) {
+                    keys.push_back(*it * 4);
+                }
+                std::set<int> expected(ordered);
+                for (int i = numOrdered; i < length; ++i) {
+                    const int key = nextRandom(&seed) % (2 * length + 1);
+                    keys.push_back(key * 4 + 1);
+                    expected.insert(key);
+                }
+
+                Indices result(&oa);
+                if (!Util::mergeOrder(&result, keys, numOrdered, DivLess())) {
+                    result.clear();
+                    for (std::size_t i = 0; i < keys.size(); ++i) {
+                        result.push_back(i);
+                    }
+                }
+
+                ASSERTV(length, numOrdered, expected.size() == result.size());
+
+                std::set<int>::const_iterator it = expected.begin();
+                for (std::size_t i = 0; i < result.size(); ++i, ++it) {
+                    const int key = keys[result[i]];
+                    ASSERTV(length, numOrdered, i, *it == key / 4);
+                    if (ordered.count(key / 4)) {
+                        ASSERTV(length, numOrdered, i, 0 == key % 4);
+                    }
+                    else {
+                        // The first appended key equivalent to 'key' is
+                        // retained.
+
+                        ASSERTV(length, numOrdered, i,
+                                std::find(keys.begin() + numOrdered,
+                                          keys.end(),
+                                          key) - keys.begin()
+                                                == (std::ptrdiff_t)result[i]);
+                    }
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Merge a batch of keys into a sorted vector using 'mergeOrder'
+        //:   and 'gather', and verify the result.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            bsl::vector<int> keys(&oa);
+            for (int i = 0; i < 100; i += 2) {
+                keys.push_back(i);
+            }
+            const std::size_t NUM_ORDERED = keys.size();
+
+            for (int i = 99; i >= 0; i -= 3) {
+                keys.push_back(i);
+            }
+
+            Indices order(&oa);
+            ASSERT(Util::mergeOrder(&order,
+                                    keys,
+                                    NUM_ORDERED,
+                                    std::less<int>()));
+
+            bsl::vector<int> merged(&oa);
+            Util::gather(&merged, keys, order);
+
+            std::set<int> expected(keys.begin(), keys.end());
+            ASSERT(expected.size() == merged.size());
+            ASSERT(std::equal(merged.begin(), merged.end(), expected.begin()));
+
+            Indices unchanged(&oa);
+            ASSERT(!Util::mergeOrder(&unchanged,
+                                     merged,
+                                     merged.size(),
+                                     std::less<int>()));
+            ASSERT(unchanged.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,2462 @@
+// bslstl_flatmap.h                                                   -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATMAP
+#define INCLUDED_BSLSTL_FLATMAP
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an STL-compliant map held in two sorted vectors.
+//
+//@CLASSES:
+//   bsl::flat_map: STL-compliant ordered map held in contiguous storage
+//
+//@SEE_ALSO: bslstl_flatset, bslstl_flatcontainerutil, bslstl_map
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_map', implementing a container holding an ordered sequence of
+// key-value pairs having unique keys (of the template parameter type, 'KEY')
+// and associated values (of the template parameter type, 'VALUE').
+// 'flat_map' provides the interface of 'bsl::map', but holds its keys, in
+// order, in one 'bsl::vector', and the associated values, in the same order,
+// in a second 'bsl::vector', rather than holding each key-value pair in a
+// node of a red-black tree.
+//
+// An instantiation of 'flat_map' is an allocator-aware, value-semantic type
+// whose salient attributes are its size (number of keys) and the ordered
+// sequence of key-value pairs the map contains.  If 'flat_map' is instantiated
+// with a key type or associated value type that is not itself value-semantic,
+// then it will not retain all of its value-semantic qualities.
+//
+///Choosing Between 'map' and 'flat_map'
+///-------------------------------------
+// A 'flat_map' allocates a single array for its keys and a single array for
+// its values, so it uses no memory per element beyond the key and value
+// themselves.  A lookup is a binary search over the array of keys alone, so
+// touches neither the values nor the memory that values might own, and an
+// iteration touches each cache line once.  A map that is populated once (or in
+// large batches) and then searched many times is best held in a 'flat_map'.
+//
+// In exchange, inserting or erasing a single element shifts every key and
+// value after it, so takes time linear in the size of the map, and
+// invalidates all iterators into the map, and all references and pointers to
+// its elements.  The shift is performed by 'bsl::vector', which moves
+// elements using 'bslalg::ArrayPrimitives', so that keys and values of a
+// bitwise-moveable type are shifted by a single 'memmove'.  Keys and values
+// of other types are shifted by assignment, which cannot be undone if it
+// throws, so, to provide the strong exception-safety guarantee, an element
+// whose key or value is of such a type is inserted (other than at the end) by
+// copying the keys and values into new vectors that include it.
+//
+// Inserting a range of elements (including by the range constructor) appends
+// the keys and values to their vectors, sorts (the indices of) the appended
+// keys once, and merges them with the existing keys in a single pass (see
+// 'bslstl_flatcontainerutil'), so that inserting 'N' elements into a map of
+// 'n' elements takes O[N * log(N) + n] time, rather than O[N * n].  If the
+// keys of the range are ordered, and follow the last key of the map, no sort
+// or merge is performed.
+//
+// 'flat_map' does not provide node handles ('extract', and the 'insert'
+// overload taking a node handle), or 'merge'.
+//
+///Iterators and References
+///------------------------
+// Since a key and its associated value are held in different arrays, a
+// 'flat_map' contains no 'value_type' object to which an iterator could
+// refer.  Instead, dereferencing a 'flat_map' iterator returns, by value, a
+// 'reference' object having a 'first' member that is a reference to the
+// (non-modifiable) key, and a 'second' member that is a reference to the
+// associated value, so that, for example, 'it->first' and 'it->second' may be
+// used as for a 'bsl::map'.  A 'reference' object is convertible to
+// 'value_type', which is 'bsl::pair<KEY, VALUE>'.  The iterators of
+// 'flat_map' are random-access iterators.  Note that an iterator of a
+// 'flat_map' does not satisfy the C++03 requirements of a forward iterator
+// (that 'reference' be a reference type), in the same manner as an iterator
+// of 'vector<bool>'; and that the 'operator->' of the reverse iterators is not
+// supported.
+//
+// The 'keys' and 'values' accessors return the vectors of keys and values,
+// so that, for example, a client may pass the keys of a 'flat_map' to a
+// function taking a sequence of keys without copying them.
+//
+///Heterogeneous Lookup
+///--------------------
+// If the (template parameter) type 'COMPARATOR' is *transparent* (i.e.,
+// declares a nested type named 'is_transparent'), the 'find', 'count',
+// 'contains', 'lower_bound', 'upper_bound', and 'equal_range' methods of
+// 'flat_map' provide additional overloads that accept a key of any type that
+// 'COMPARATOR' can compare with a key.  These overloads do not convert the
+// supplied key to 'KEY', so, for example, a 'flat_map' keyed on
+// 'bsl::string' can be searched using a 'bslstl::StringRef' without
+// constructing (and allocating memory for) a temporary 'bsl::string'.
+//
+///Requirements on 'KEY' and 'VALUE'
+///---------------------------------
+// A 'flat_map' has the same requirements on its 'KEY' and 'VALUE' types as
+// 'bsl::map' (see {'bslstl_map'|Requirements on 'KEY' and 'VALUE'}).  In
+// addition, since elements are copied when the vectors holding them grow,
+// 'KEY' and 'VALUE' must be "copy-constructible" and "copy-assignable".
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a map's 'ALLOCATOR' template parameter determines how
+// that map will allocate memory, exactly as for 'bsl::map' (see
+// {'bslstl_map'|Memory Allocation}).  The vectors of keys and values, and
+// every key and value, are allocated using (a copy of the allocator of the
+// map rebound to the appropriate type).  Inserting a range of elements whose
+// keys do not follow the last key of the map in order allocates a temporary
+// array of indices, and new arrays of keys and values.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'flat_map':
+//..
+//  Legend
+//  ------
+//  'K'             - template parameter 'KEY' type of 'flat_map'
+//  'V'             - template parameter 'VALUE' type of 'flat_map'
+//  'a', 'b'        - two distinct objects of type 'flat_map<K, V>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'value_type'    - 'pair<K, V>'
+//  'c'             - comparator providing an ordering for objects of type 'K'
+//  'al'            - an STL-style memory allocator
+//  'i1', 'i2'      - two iterators defining a sequence of 'value_type' objects
+//  'k'             - an object of type 'K'
+//  'v'             - an object of type 'value_type'
+//  'p1', 'p2'      - two iterators belonging to 'a'
+//  distance(i1,i2) - the number of elements in the range [i1, i2)
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | flat_map<K, V> a;    (default construction)        | O[1]               |
+//  | flat_map<K, V> a(al);                              |                    |
+//  | flat_map<K, V> a(c, al);                           |                    |
+//  +----------------------------------------------------+--------------------+
+//  | flat_map<K, V> a(b); (copy construction)           | O[m]               |
+//  | flat_map<K, V> a(b, al);                           |                    |
+//  +----------------------------------------------------+--------------------+
+//  | flat_map<K, V> a(i1, i2);                          | O[N] if [i1, i2)   |
+//  | flat_map<K, V> a(i1, i2, al);                      | is sorted with     |
+//  | flat_map<K, V> a(i1, i2, c, al);                   | 'a.value_comp()',  |
+//  |                                                    | O[N * log(N)]      |
+//  |                                                    | otherwise, where N |
+//  |                                                    | is distance(i1,i2) |
+//  +----------------------------------------------------+--------------------+
+//  | a.~flat_map<K, V>(); (destruction)                 | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a = b;               (assignment)                  | O[n + m]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.cbegin(), a.cend(),          | O[1]               |
+//  | a.rbegin(), a.rend(), a.crbegin(), a.crend()       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b                                     | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a < b, a <= b, a > b, a >= b                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a,b)                               | O[1] if 'a' and    |
+//  |                                                    | 'b' use the same   |
+//  |                                                    | allocator,         |
+//  |                                                    | O[n + m] otherwise |
+//  +----------------------------------------------------+--------------------+
+//  | a.size(), a.max_size(), a.empty(), a.capacity()    | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.get_allocator(), a.keys(), a.values()            | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.reserve(k)                                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a[k], a.insert(v)                                  | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(p1, v)                                    | amortized O[1] if  |
+//  |                                                    | v is inserted      |
+//  |                                                    | right before p1 at |
+//  |                                                    | the end, O[n]      |
+//  |                                                    | otherwise          |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(i1, i2)                                   | O[N] if [i1, i2)   |
+//  |                                                    | follows the last   |
+//  |                                                    | element of 'a' in  |
+//  |                                                    | order, and         |
+//  |                                                    | O[N * log(N) + n]  |
+//  |                                                    | otherwise, where N |
+//  |                                                    | is distance(i1,i2) |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1), a.erase(k), a.erase(p1, p2)           | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.clear()                                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.key_comp(), a.value_comp()                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.at(k), a.contains(k), a.count(k), a.find(k)      | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.lower_bound(k), a.upper_bound(k),                | O[log(n)]          |
+//  | a.equal_range(k)                                   |                    |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Table of Currency Conversion Rates
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain the conversion rates of currencies to US dollars,
+// identified by their ISO codes.  The rates are loaded in a batch every
+// morning, and are then looked up for every trade, where the currency of the
+// trade is available as a 'bslstl::StringRef' into a message buffer.
+//
+// First, we define a transparent comparator that orders 'bsl::string' and
+// 'bslstl::StringRef' objects with one another:
+//..
+//  struct StringRefLess {
+//      // This 'struct' defines a transparent ordering of strings.
+//
+//      typedef void is_transparent;
+//
+//      bool operator()(const bslstl::StringRef& lhs,
+//                      const bslstl::StringRef& rhs) const
+//          // Return 'true' if the specified 'lhs' is ordered before the
+//          // specified 'rhs', and 'false' otherwise.
+//      {
+//          return lhs < rhs;
+//      }
+//  };
+//..
+// Then, we load the morning's rates, in no particular order, into a map in a
+// single call to 'insert':
+//..
+//  bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+//
+//  typedef bsl::flat_map<bsl::string, double, StringRefLess> RateTable;
+//  typedef RateTable::value_type                              Rate;
+//
+//  bsl::vector<Rate> batch(&oa);
+//  batch.push_back(Rate("JPY", 0.0091));
+//  batch.push_back(Rate("EUR", 1.08));
+//  batch.push_back(Rate("GBP", 1.27));
+//  batch.push_back(Rate("CHF", 1.12));
+//
+//  RateTable rates(&oa);
+//  rates.insert(batch.begin(), batch.end());
+//  assert(4 == rates.size());
+//..
+// Next, we observe that the currencies are held in order, and that the keys
+// can be accessed as a contiguous sequence:
+//..
+//  assert("CHF" == rates.begin()->first);
+//  assert("JPY" == rates.keys().back());
+//..
+// Then, we convert the amounts of trades, looking up each currency without
+// creating a temporary 'bsl::string':
+//..
+//  const char *message = "EUR:1000;GBP:250;AUD:400";
+//
+//  bslma::TestAllocatorMonitor oam(&oa);
+//
+//  RateTable::const_iterator it = rates.find(bslstl::StringRef(message, 3));
+//  assert(rates.end() != it);
+//  assert(1080.0      == 1000 * it->second);
+//
+//  assert( rates.contains(bslstl::StringRef(message +  9, 3)));
+//  assert(!rates.contains(bslstl::StringRef(message + 17, 3)));
+//
+//  assert(oam.isTotalSame());
+//..
+// Finally, we update the rate of one currency in place:
+//..
+//  rates["EUR"] = 1.09;
+//  assert(1.09 == rates.at("EUR"));
+//  assert(4    == rates.size());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_FLATCONTAINERUTIL
+#include <bslstl_flatcontainerutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_VECTOR
+#include <bslstl_vector.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ENABLEIF
+#include <bslmf_enableif.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISSAME
+#include <bslmf_issame.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISTRANSPARENTPREDICATE
+#include <bslmf_istransparentpredicate.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_REMOVECONST
+#include <bslmf_removeconst.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_ALGORITHM
+#include <algorithm>
+#define INCLUDED_ALGORITHM
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+#ifndef INCLUDED_ITERATOR
+#include <iterator>
+#define INCLUDED_ITERATOR
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                          // =======================
+                          // class FlatMap_Reference
+                          // =======================
+
+template <class KEY, class VALUE>
+struct FlatMap_Reference {
+    // This component-private 'struct' provides the 'reference' type of a
+    // 'flat_map' iterator, referring to a key and its associated value held
+    // in separate arrays.  The (template parameter) type 'VALUE' is
+    // 'const'-qualified for the 'reference' type of a 'const_iterator'.
+
+    // PUBLIC TYPES
+    typedef typename bsl::remove_const<VALUE>::type MappedType;
+        // This 'typedef' is an alias for the (unqualified) type of the
+        // associated value.
+
+    // PUBLIC DATA
+    const KEY& first;   // key
+    VALUE&     second;  // associated value
+
+    // CREATORS
+    FlatMap_Reference(const KEY& key, VALUE& value);
+        // Create a 'FlatMap_Reference' object referring to the specified 'key'
+        // and 'value'.
+
+    // ACCESSORS
+    operator bsl::pair<KEY, MappedType>() const;
+        // Return a pair holding copies of the key and the value referred to by
+        // this object.
+};
+
+                           // =====================
+                           // class FlatMap_Pointer
+                           // =====================
+
+template <class KEY, class VALUE>
+class FlatMap_Pointer {
+    // This component-private class provides the 'pointer' type of a
+    // 'flat_map' iterator: an object holding a 'FlatMap_Reference', through
+    // whose 'operator->' the members of the reference are accessed.
+
+    // DATA
+    FlatMap_Reference<KEY, VALUE> d_reference;  // referred-to element
+
+  public:
+    // CREATORS
+    explicit FlatMap_Pointer(const FlatMap_Reference<KEY, VALUE>& reference);
+        // Create a 'FlatMap_Pointer' object holding the specified 'reference'.
+
+    // ACCESSORS
+    const FlatMap_Reference<KEY, VALUE> *operator->() const;
+        // Return the address of the reference held by this object.
+};
+
+                           // ======================
+                           // class FlatMap_Iterator
+                           // ======================
+
+template <class KEY, class VALUE>
+class FlatMap_Iterator {
+    // This component-private class provides the random-access iterator type
+    // of a 'flat_map', referring to a position in the array of keys and the
+    // corresponding position in the array of values.  The (template
+    // parameter) type 'VALUE' is 'const'-qualified for a 'const_iterator',
+    // which is convertible from the corresponding (modifiable) iterator.
+
+    // PRIVATE TYPES
+    typedef typename bsl::remove_const<VALUE>::type MappedType;
+        // This 'typedef' is an alias for the (unqualified) type of the
+        // associated value.
+
+    // DATA
+    const KEY *d_key_p;    // address of the key
+    VALUE     *d_value_p;  // address of the associated value
+
+  public:
+    // PUBLIC TYPES
+    typedef std::random_access_iterator_tag   iterator_category;
+    typedef bsl::pair<KEY, MappedType>        value_type;
+    typedef std::ptrdiff_t                    difference_type;
+    typedef FlatMap_Pointer<KEY, VALUE>       pointer;
+    typedef FlatMap_Reference<KEY, VALUE>     reference;
+
+    // CREATORS
+    FlatMap_Iterator();
+        // Create an iterator having a singular value.
+
+    FlatMap_Iterator(const KEY *key, VALUE *value);
+        // Create an iterator referring to the specified 'key' and the
+        // specified 'value'.
+
+    template <class OTHER_VALUE>
+    FlatMap_Iterator(
+               const FlatMap_Iterator<KEY, OTHER_VALUE>& original,
+               typename bsl::enable_if<
+                                  bsl::is_same<OTHER_VALUE, MappedType>::value
+                               && !bsl::is_same<OTHER_VALUE, VALUE>::value,
+                                  int>::type = 0);                  // IMPLICIT
+        // Create a 'const_iterator' referring to the same element as the
+        // specified modifiable 'original' iterator.  Note that, being a
+        // template, this constructor is never the copy constructor, which
+        // (along with the copy-assignment operator) is generated by the
+        // compiler.
+
+    // MANIPULATORS
+    FlatMap_Iterator& operator++();
+        // Advance this iterator to the next element, and return a reference
+        // providing modifiable access to this iterator.
+
+    FlatMap_Iterator& operator--();
+        // Move this iterator to the previous element, and return a reference
+        // providing modifiable access to this iterator.
+
+    FlatMap_Iterator operator++(int);
+        // Advance this iterator to the next element, and return its prior
+        // value.
+
+    FlatMap_Iterator operator--(int);
+        // Move this iterator to the previous element, and return its prior
+        // value.
+
+    FlatMap_Iterator& operator+=(difference_type offset);
+        // Advance this iterator by the specified 'offset' elements, and
+        // return a reference providing modifiable access to this iterator.
+
+    FlatMap_Iterator& operator-=(difference_type offset);
+        // Move this iterator back by the specified 'offset' elements, and
+        // return a reference providing modifiable access to this iterator.
+
+    // ACCESSORS
+    reference operator*() const;
+        // Return a reference to the element referred to by this iterator.
+
+    pointer operator->() const;
+        // Return a pointer to the element referred to by this iterator.
+
+    reference operator[](difference_type offset) const;
+        // Return a reference to the element at the specified 'offset' from
+        // the element referred to by this iterator.
+
+    const KEY *key() const;
+        // Return the address of the key referred to by this iterator.
+
+    VALUE *value() const;
+        // Return the address of the value referred to by this iterator.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE1, class VALUE2>
+bool operator==(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                const FlatMap_Iterator<KEY, VALUE2>& rhs);
+template <class KEY, class VALUE1, class VALUE2>
+bool operator!=(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                const FlatMap_Iterator<KEY, VALUE2>& rhs);
+template <class KEY, class VALUE1, class VALUE2>
+bool operator<(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+               const FlatMap_Iterator<KEY, VALUE2>& rhs);
+template <class KEY, class VALUE1, class VALUE2>
+bool operator>(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+               const FlatMap_Iterator<KEY, VALUE2>& rhs);
+template <class KEY, class VALUE1, class VALUE2>
+bool operator<=(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                const FlatMap_Iterator<KEY, VALUE2>& rhs);
+template <class KEY, class VALUE1, class VALUE2>
+bool operator>=(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                const FlatMap_Iterator<KEY, VALUE2>& rhs);
+    // Return the result of comparing the positions of the keys referred to by
+    // the specified 'lhs' and 'rhs' iterators with the indicated operator.
+    // The behavior is undefined unless 'lhs' and 'rhs' refer to elements of
+    // the same map.
+
+template <class KEY, class VALUE1, class VALUE2>
+std::ptrdiff_t operator-(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                         const FlatMap_Iterator<KEY, VALUE2>& rhs);
+    // Return the number of elements from the specified 'rhs' iterator to the
+    // specified 'lhs' iterator.  The behavior is undefined unless 'lhs' and
+    // 'rhs' refer to elements of the same map.
+
+template <class KEY, class VALUE>
+FlatMap_Iterator<KEY, VALUE> operator+(
+                                  const FlatMap_Iterator<KEY, VALUE>& iterator,
+                                  std::ptrdiff_t                      offset);
+template <class KEY, class VALUE>
+FlatMap_Iterator<KEY, VALUE> operator+(
+                                 std::ptrdiff_t                      offset,
+                                 const FlatMap_Iterator<KEY, VALUE>& iterator);
+    // Return an iterator referring to the element at the specified 'offset'
+    // from the element referred to by the specified 'iterator'.
+
+template <class KEY, class VALUE>
+FlatMap_Iterator<KEY, VALUE> operator-(
+                                  const FlatMap_Iterator<KEY, VALUE>& iterator,
+                                  std::ptrdiff_t                      offset);
+    // Return an iterator referring to the element at the specified 'offset'
+    // before the element referred to by the specified 'iterator'.
+
+                         // =========================
+                         // class FlatMap_TailProctor
+                         // =========================
+
+template <class KEY_CONTAINER, class MAPPED_CONTAINER>
+class FlatMap_TailProctor {
+    // This component-private class implements a proctor that, unless its
+    // 'release' method is called, erases, on destruction, the elements
+    // appended to a container of keys and a container of values after the
+    // proctor was created.
+
+    // DATA
+    KEY_CONTAINER    *d_keys_p;    // keys to truncate, or 0 if released
+    MAPPED_CONTAINER *d_values_p;  // values to truncate
+    std::size_t       d_length;    // length to which to truncate
+
+  private:
+    // NOT IMPLEMENTED
+    FlatMap_TailProctor(const FlatMap_TailProctor&);
+    FlatMap_TailProctor& operator=(const FlatMap_TailProctor&);
+
+  public:
+    // CREATORS
+    FlatMap_TailProctor(KEY_CONTAINER *keys, MAPPED_CONTAINER *values);
+        // Create a proctor that, on destruction, truncates the specified
+        // 'keys' and 'values' to the current length of 'keys', unless
+        // 'release' is called.  The behavior is undefined unless
+        // 'keys->size() == values->size()'.
+
+    ~FlatMap_TailProctor();
+        // Erase the elements following the first 'length()' elements of the
+        // managed containers, if any.
+
+    // MANIPULATORS
+    void release();
+        // Release from management the containers managed by this proctor.
+
+    // ACCESSORS
+    std::size_t length() const;
+        // Return the length of the managed containers when this proctor was
+        // created.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                              // ==============
+                              // class flat_map
+                              // ==============
+
+template <class KEY,
+          class VALUE,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = allocator<pair<KEY, VALUE> > >
+class flat_map {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of key-value pairs having unique keys that provide
+    // a mapping from keys (of the template parameter type, 'KEY') to their
+    // associated values (of the template parameter type, 'VALUE'), held in
+    // two arrays of contiguous storage.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    // PRIVATE TYPES
+    typedef typename bsl::allocator_traits<ALLOCATOR> AllocatorTraits;
+        // This typedef is an alias for the allocator traits type associated
+        // with this container.
+
+    typedef typename ALLOCATOR::template rebind<std::size_t>::other
+                                                                IndexAllocator;
+        // This typedef is an alias for the allocator of the vector used to
+        // compute the order of the keys resulting from inserting a range.
+
+    typedef bsl::vector<std::size_t, IndexAllocator>            IndexContainer;
+        // This typedef is an alias for the type of the vector used to compute
+        // the order of the keys resulting from inserting a range.
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef VALUE                                      mapped_type;
+    typedef bsl::pair<KEY, VALUE>                      value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef ALLOCATOR                                  allocator_type;
+
+    typedef BloombergLP::bslstl::FlatMap_Reference<KEY, VALUE>
+                                                       reference;
+    typedef BloombergLP::bslstl::FlatMap_Reference<KEY, const VALUE>
+                                                       const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+
+    typedef BloombergLP::bslstl::FlatMap_Iterator<KEY, VALUE>
+                                                       iterator;
+    typedef BloombergLP::bslstl::FlatMap_Iterator<KEY, const VALUE>
+                                                       const_iterator;
+    typedef typename iterator::pointer                 pointer;
+    typedef typename const_iterator::pointer           const_pointer;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+    typedef bsl::vector<KEY,
+                        typename ALLOCATOR::template rebind<KEY>::other>
+                                                       key_container_type;
+    typedef bsl::vector<VALUE,
+                        typename ALLOCATOR::template rebind<VALUE>::other>
+                                                       mapped_container_type;
+
+    class value_compare {
+        // This nested class defines a mechanism for comparing two objects of
+        // 'value_type' using the (template parameter) type 'COMPARATOR'.
+
+        // FRIENDS
+        friend class flat_map;
+
+      protected:
+        COMPARATOR comp;  // we would not have elected to make this data
+                          // member protected ourselves
+
+        value_compare(COMPARATOR comparator);                       // IMPLICIT
+            // Create a 'value_compare' object that will delegate to the
+            // specified 'comparator' for comparisons.
+
+      public:
+        typedef bool result_type;
+            // This 'typedef' is an alias for the result type of a call to the
+            // overload of 'operator()' (the comparison function) provided by a
+            // 'flat_map::value_compare' object.
+
+        typedef value_type first_argument_type;
+            // This 'typedef' is an alias for the type of the first parameter
+            // of the overload of 'operator()' (the comparison function)
+            // provided by a 'flat_map::value_compare' object.
+
+        typedef value_type second_argument_type;
+            // This 'typedef' is an alias for the type of the second parameter
+            // of the overload of 'operator()' (the comparison function)
+            // provided by a 'flat_map::value_compare' object.
+
+        bool operator()(const value_type& x, const value_type& y) const;
+            // Return 'true' if the specified 'x' object is ordered before the
+            // specified 'y' object, as determined by the comparator supplied
+            // at construction.
+    };
+
+  private:
+    // DATA
+    key_container_type    d_keys;        // ordered keys
+    mapped_container_type d_values;      // values, in the order of 'd_keys'
+    COMPARATOR            d_comparator;  // key ordering
+
+    // PRIVATE MANIPULATORS
+    iterator insertAt(size_type position, const KEY& key, const VALUE& value);
+        // Insert the specified 'key' and 'value' at the specified 'position'
+        // in the arrays of keys and values, and return an iterator referring
+        // to the inserted element.  If an exception is thrown, this map is
+        // left unchanged.  The behavior is undefined unless
+        // 'position <= size()', and 'key' is ordered after the key at
+        // 'position - 1' and before the key at 'position'.
+
+    iterator makeIterator(size_type position);
+        // Return an iterator referring to the element at the specified
+        // 'position'.
+
+    // PRIVATE ACCESSORS
+    const_iterator makeIterator(size_type position) const;
+        // Return an iterator referring to the element at the specified
+        // 'position'.
+
+    template <class LOOKUP_KEY>
+    size_type lowerBoundIndex(const LOOKUP_KEY& key) const;
+        // Return the position of the first key in this map that is not
+        // ordered before the specified 'key', or 'size()' if there is no such
+        // key.
+
+    template <class LOOKUP_KEY>
+    size_type upperBoundIndex(const LOOKUP_KEY& key) const;
+        // Return the position of the first key in this map that is ordered
+        // after the specified 'key', or 'size()' if there is no such key.
+
+    template <class LOOKUP_KEY>
+    size_type findIndex(const LOOKUP_KEY& key) const;
+        // Return the position of the key in this map equivalent to the
+        // specified 'key', or 'size()' if there is no such key.
+
+  public:
+    // CREATORS
+    explicit flat_map(const COMPARATOR& comparator     = COMPARATOR(),
+                      const ALLOCATOR&  basicAllocator = ALLOCATOR())
+        // Construct an empty map.  Optionally specify a 'comparator' used to
+        // order key-value pairs contained in this object.  If 'comparator' is
+        // not supplied, a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' is used.  Optionally specify the
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'ALLOCATOR' is used.  If the 'ALLOCATOR' is 'bsl::allocator'
+        // (the default), then 'basicAllocator', if supplied, shall be
+        // convertible to 'bslma::Allocator *'.  If the 'ALLOCATOR' is
+        // 'bsl::allocator' and 'basicAllocator' is not supplied, the currently
+        // installed default allocator will be used to supply memory.
+    : d_keys(basicAllocator)
+    , d_values(basicAllocator)
+    , d_comparator(comparator)
+    {
+        // The implementation is placed here in the class definition to
+        // workaround an AIX compiler bug, where the constructor can fail to
+        // compile because it is unable to find the definition of the default
+        // argument.  This occurs when a templatized class wraps around the
+        // container and the comparator is defined after the new class.
+    }
+
+    explicit flat_map(const ALLOCATOR& basicAllocator);
+        // Construct an empty map that will use the specified 'basicAllocator'
+        // to supply memory.  Use a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' to order the key-value pairs contained
+        // in this map.  If the (template parameter) type 'ALLOCATOR' is of
+        // 'bsl::allocator' (the default) then 'basicAllocator' shall be
+        // convertible to 'bslma::Allocator *'.
+
+    flat_map(const flat_map& original);
+        // Construct a map having the same value as the specified 'original'.
+        // Use a copy of 'original.key_comp()' to order the key-value pairs
+        // contained in this map.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // allocate memory.  If the (template parameter) type 'ALLOCATOR' is of
+        // type 'bsl::allocator' (the default), the currently installed default
+        // allocator will be used to supply memory.
+
+    flat_map(const flat_map& original, const ALLOCATOR& basicAllocator);
+        // Construct a map having the same value as that of the specified
+        // 'original' that will use the specified 'basicAllocator' to supply
+        // memory.  Use a copy of 'original.key_comp()' to order the key-value
+        // pairs contained in this map.  If the (template parameter) type
+        // 'ALLOCATOR' is 'bsl::allocator' (the default) then 'basicAllocator'
+        // shall be convertible to 'bslma::Allocator *'.
+
+    template <class INPUT_ITERATOR>
+    flat_map(INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator     = COMPARATOR(),
+             const ALLOCATOR&  basicAllocator = ALLOCATOR());
+        // Construct a map, and insert each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, ignoring those pairs having a
+        // key that appears earlier in the sequence.  Optionally specify a
+        // 'comparator' used to order key-value pairs contained in this object.
+        // If 'comparator' is not supplied, a default-constructed object of the
+        // (template parameter) type 'COMPARATOR' is used.  Optionally specify
+        // the 'basicAllocator' used to supply memory.  If 'basicAllocator' is
+        // not supplied, a default-constructed object of the (template
+        // parameter) type 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is
+        // 'bsl::allocator' (the default) then 'basicAllocator', if supplied,
+        // shall be convertible to 'bslma::Allocator *'.  If the sequence
+        // 'first' and 'last' is ordered according to the identified
+        // 'comparator' then this operation will have O[N] complexity, where N
+        // is the number of elements between 'first' and 'last', otherwise
+        // this operation will have O[N * log(N)] complexity.  The (template
+        // parameter) type 'INPUT_ITERATOR' shall meet the requirements of an
+        // input iterator defined in the C++11 standard [24.2.3] providing
+        // access to objects having 'first' and 'second' members convertible to
+        // 'KEY' and 'VALUE' respectively.  The behavior is undefined unless
+        // 'first' and 'last' refer to a sequence of valid values where 'first'
+        // is at a position at or before 'last'.
+
+    ~flat_map();
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_map& operator=(const flat_map& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if the
+        // 'ALLOCATOR' type has trait 'propagate_on_container_copy_assignment',
+        // and return a reference providing modifiable access to this object.
+        // If an exception is thrown, this object is left unchanged.
+
+    VALUE& operator[](const key_type& key);
+        // Return a reference providing modifiable access to the mapped-value
+        // associated with the specified 'key' in this map; if this map does
+        // not already contain a 'value_type' object with 'key', first insert a
+        // new 'value_type' object having 'key' and a default-constructed
+        // 'VALUE' object.  This method requires that the (template parameter)
+        // type 'VALUE' be "default-constructible".
+
+    VALUE& at(const key_type& key);
+        // Return a reference providing modifiable access to the mapped-value
+        // associated with the specified 'key' in this map, if such an entry
+        // exists; otherwise throw 'std::out_of_range' exception.  Note that
+        // this method is not exception-neutral.
+
+    iterator begin();
+        // Return an iterator providing modifiable access to the first
+        // element in the ordered sequence of key-value pairs maintained by
+        // this map, or the 'end' iterator if this map is empty.
+
+    iterator end();
+        // Return an iterator providing modifiable access to the past-the-end
+        // element in the ordered sequence of key-value pairs maintained by
+        // this map.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator providing modifiable access to the last
+        // element in the ordered sequence of key-value pairs maintained by
+        // this map, or 'rend' if this map is empty.
+
+    reverse_iterator rend();
+        // Return a reverse iterator providing modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of key-value
+        // pairs maintained by this map.
+
+    pair<iterator, bool> insert(const value_type& value);
+        // Insert the specified 'value' into this map if the key (the 'first'
+        // element) of 'value' does not already exist in this map; otherwise,
+        // if a key equivalent to that of 'value' already exists in this map,
+        // this method has no effect.  Return a pair whose 'first' member is an
+        // iterator referring to the (possibly newly inserted) element in this
+        // map whose key is equivalent to that of 'value', and whose 'second'
+        // member is 'true' if a new value was inserted, and 'false' if the
+        // key was already present.  If a value is inserted, all other
+        // iterators into this map are invalidated.
+
+    iterator insert(const_iterator hint, const value_type& value);
+        // Insert the specified 'value' into this map, immediately before the
+        // specified 'hint' if 'hint' is a valid immediate successor to the key
+        // of 'value', if a key equivalent to that of 'value' does not already
+        // exist in this map; otherwise, this method has no effect.  Return an
+        // iterator referring to the (possibly newly inserted) element in this
+        // map whose key is equivalent to that of 'value'.  If 'hint' is not a
+        // valid immediate successor to the key of 'value', the position of
+        // 'value' is found by a binary search.  If a value is inserted, all
+        // other iterators into this map are invalidated.  The behavior is
+        // undefined unless 'hint' is a valid iterator into this map.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map the value of each object in the range starting
+        // at the specified 'first' iterator and ending immediately before the
+        // specified 'last' iterator, if a key equivalent to that of the object
+        // is neither already contained in this map nor appears earlier in the
+        // range.  The keys and values of the range are appended to this map,
+        // then sorted and merged with the existing elements in a single pass
+        // (see {Choosing Between 'map' and 'flat_map'}).  If an exception is
+        // thrown, this map is left unchanged.  The (template parameter) type
+        // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
+        // defined in the C++11 standard [24.2.3] providing access to objects
+        // having 'first' and 'second' members convertible to 'KEY' and
+        // 'VALUE' respectively.  The behavior is undefined unless 'first' and
+        // 'last' refer to a sequence of valid values where 'first' is at a
+        // position at or before 'last', and the sequence does not refer to
+        // elements of this map.
+
+    iterator erase(const_iterator position);
+        // Remove from this map the element at the specified 'position', and
+        // return an iterator referring to the element immediately following
+        // the removed element, or to the past-the-end position if the removed
+        // element was the last in the sequence.  All other iterators into
+        // this map are invalidated.  The behavior is undefined unless
+        // 'position' refers to an element in this map.
+
+    size_type erase(const key_type& key);
+        // Remove from this map the element whose key is equivalent to the
+        // specified 'key', if it exists, and return 1; otherwise, if there is
+        // no such element, return 0 with no other effect.  If an element is
+        // removed, all iterators into this map are invalidated.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this map the elements starting at the specified 'first'
+        // position up to, but not including the specified 'last' position,
+        // and return an iterator referring to the element following the last
+        // removed element.  All other iterators into this map are
+        // invalidated.  The behavior is undefined unless 'first' and 'last'
+        // either refer to elements in this map or are the 'end' iterator, and
+        // the 'first' position is at or before the 'last' position in the
+        // ordered sequence provided by this container.
+
+    void swap(flat_map& other);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object; also exchange the allocator of this object
+        // with that of 'other' if the (template parameter) type 'ALLOCATOR'
+        // has the 'propagate_on_container_swap' trait, and do not modify
+        // either allocator otherwise.  This method provides the no-throw
+        // exception-safety guarantee if the allocators are exchanged or are
+        // equal, and provides the basic exception-safety guarantee (by
+        // exchanging copies of the two maps) otherwise.
+
+    void clear();
+        // Remove all entries from this map.  Note that the map is empty after
+        // this call, but allocated memory may be retained for future use.
+
+    void reserve(size_type numElements);
+        // Change the capacity of this map to at least the specified
+        // 'numElements', so that inserting elements into this map until its
+        // size is 'numElements' allocates no memory for the arrays of keys and
+        // values.
+
+    iterator find(const key_type& key);
+        // Return an iterator providing modifiable access to the element in
+        // this map whose key is equivalent to the specified 'key', if such an
+        // entry exists, and the past-the-end ('end') iterator otherwise.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the element in
+        // this map whose key is equivalent to the specified 'key', if such an
+        // entry exists, and the past-the-end ('end') iterator otherwise.  This
+        // method does not participate in overload resolution unless
+        // 'COMPARATOR' is transparent (see {Heterogeneous Lookup}).
+    {
+        return makeIterator(findIndex(key));
+    }
+
+    iterator lower_bound(const key_type& key);
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) element in this map whose key is greater-than or
+        // equal-to the specified 'key', and the past-the-end iterator if this
+        // map does not contain such an element.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    lower_bound(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) element in this map whose key is not ordered before
+        // the specified 'key', and the past-the-end iterator if no such
+        // element exists.  This method does not participate in overload
+        // resolution unless 'COMPARATOR' is transparent (see {Heterogeneous
+        // Lookup}).
+    {
+        return makeIterator(lowerBoundIndex(key));
+    }
+
+    iterator upper_bound(const key_type& key);
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) element in this map whose key is greater than the
+        // specified 'key', and the past-the-end iterator if this map does not
+        // contain such an element.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    upper_bound(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) element in this map whose key is ordered after the
+        // specified 'key', and the past-the-end iterator if no such element
+        // exists.  This method does not participate in overload resolution
+        // unless 'COMPARATOR' is transparent (see {Heterogeneous Lookup}).
+    {
+        return makeIterator(upperBoundIndex(key));
+    }
+
+    pair<iterator, iterator> equal_range(const key_type& key);
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of elements in this map whose keys are equivalent to the
+        // specified 'key', where the the first iterator is positioned at the
+        // start of the sequence, and the second is positioned one past the
+        // end of the sequence.  If this map contains no such elements, then
+        // the two returned iterators will have the same value.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of elements in this map whose keys are equivalent to the
+        // specified 'key', where the the first iterator is positioned at the
+        // start of the sequence, and the second is positioned one past the
+        // end of the sequence.  This method does not participate in overload
+        // resolution unless 'COMPARATOR' is transparent (see {Heterogeneous
+        // Lookup}).
+    {
+        return pair<iterator, iterator>(makeIterator(lowerBoundIndex(key)),
+                                        makeIterator(upperBoundIndex(key)));
+    }
+
+    // ACCESSORS
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // map.
+
+    const_iterator begin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // element in the ordered sequence of key-value pairs maintained by
+        // this map, or the 'end' iterator if this map is empty.
+
+    const_iterator end() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of key-value pairs
+        // maintained by this map.
+
+    const_reverse_iterator rbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last element in the ordered sequence of key-value pairs maintained
+        // by this map, or 'rend' if this map is empty.
+
+    const_reverse_iterator rend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of key-value
+        // pairs maintained by this map.
+
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // element in the ordered sequence of key-value pairs maintained by
+        // this map, or the 'cend' iterator if this map is empty.
+
+    const_iterator cend() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of key-value pairs
+        // maintained by this map.
+
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last element in the ordered sequence of key-value pairs maintained
+        // by this map, or 'crend' if this map is empty.
+
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of key-value
+        // pairs maintained by this map.
+
+    bool empty() const;
+        // Return 'true' if this map contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const;
+        // Return the number of elements in this map.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this map could possibly hold.  Note that there is no guarantee
+        // that the map can successfully grow to the returned size, or even
+        // close to that size without running out of resources.
+
+    size_type capacity() const;
+        // Return the number of elements this map can hold without allocating
+        // memory for the arrays of keys and values.
+
+    const key_container_type& keys() const;
+        // Return a reference providing non-modifiable access to the ordered
+        // array of the keys of this map.
+
+    const mapped_container_type& values() const;
+        // Return a reference providing non-modifiable access to the array of
+        // the values of this map, in the order of their keys.
+
+    const VALUE& at(const key_type& key) const;
+        // Return a reference providing non-modifiable access to the
+        // mapped-value associated with the specified 'key' in this map, if
+        // such an entry exists; otherwise throw 'std::out_of_range' exception.
+        // Note that this method is not exception-neutral.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by this
+        // map; if a comparator was supplied at construction, return its value,
+        // otherwise return a default constructed 'key_compare' object.
+
+    value_compare value_comp() const;
+        // Return a functor for comparing two 'value_type' objects by comparing
+        // their respective keys using 'key_comp()'.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the element in
+        // this map whose key is equivalent to the specified 'key', if such an
+        // entry exists, and the past-the-end ('end') iterator otherwise.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the element in
+        // this map whose key is equivalent to the specified 'key', if such an
+        // entry exists, and the past-the-end ('end') iterator otherwise.  This
+        // method does not participate in overload resolution unless
+        // 'COMPARATOR' is transparent (see {Heterogeneous Lookup}).
+    {
+        return makeIterator(findIndex(key));
+    }
+
+    size_type count(const key_type& key) const;
+        // Return the number of elements within this map whose keys are
+        // equivalent to the specified 'key'.  Note that since a map maintains
+        // unique keys, the returned value will be either 0 or 1.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of elements within this map whose keys are
+        // equivalent to the specified 'key'.  This method does not
+        // participate in overload resolution unless 'COMPARATOR' is
+        // transparent (see {Heterogeneous Lookup}).
+    {
+        return upperBoundIndex(key) - lowerBoundIndex(key);
+    }
+
+    bool contains(const key_type& key) const;
+        // Return 'true' if this map contains an element whose key is
+        // equivalent to the specified 'key', and 'false' otherwise.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this map contains an element whose key is
+        // equivalent to the specified 'key', and 'false' otherwise.  This
+        // method does not participate in overload resolution unless
+        // 'COMPARATOR' is transparent (see {Heterogeneous Lookup}).
+    {
+        return findIndex(key) != size();
+    }
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) element in this map whose key is greater-than
+        // or equal-to the specified 'key', and the past-the-end iterator if
+        // this map does not contain such an element.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    lower_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) element in this map whose key is not ordered
+        // before the specified 'key', and the past-the-end iterator if no such
+        // element exists.  This method does not participate in overload
+        // resolution unless 'COMPARATOR' is transparent (see {Heterogeneous
+        // Lookup}).
+    {
+        return makeIterator(lowerBoundIndex(key));
+    }
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) element in this map whose key is greater than
+        // the specified 'key', and the past-the-end iterator if this map does
+        // not contain such an element.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    upper_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) element in this map whose key is ordered after
+        // the specified 'key', and the past-the-end iterator if no such
+        // element exists.  This method does not participate in overload
+        // resolution unless 'COMPARATOR' is transparent (see {Heterogeneous
+        // Lookup}).
+    {
+        return makeIterator(upperBoundIndex(key));
+    }
+
+    pair<const_iterator, const_iterator> equal_range(const key_type& key)
+                                                                         const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of elements in this map whose keys are equivalent to the
+        // specified 'key', where the the first iterator is positioned at the
+        // start of the sequence, and the second is positioned one past the
+        // end of the sequence.  If this map contains no such elements, then
+        // the two returned iterators will have the same value.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of elements in this map whose keys are equivalent to the
+        // specified 'key', where the the first iterator is positioned at the
+        // start of the sequence, and the second is positioned one past the
+        // end of the sequence.  This method does not participate in overload
+        // resolution unless 'COMPARATOR' is transparent (see {Heterogeneous
+        // Lookup}).
+    {
+        return pair<const_iterator, const_iterator>(
+                                          makeIterator(lowerBoundIndex(key)),
+                                          makeIterator(upperBoundIndex(key)));
+    }
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator==(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_map' objects have the same
+    // value if they have the same number of key-value pairs, and each
+    // key-value pair that is contained in one of the objects is also
+    // contained in the other object.  This method requires that the (template
+    // parameter) types 'KEY' and 'VALUE' both be "equality-comparable" (see
+    // {Requirements on 'KEY' and 'VALUE'}).
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'flat_map' objects do not have
+    // the same value if they do not have the same number of key-value pairs,
+    // or some key-value pair that is contained in one of the objects is not
+    // also contained in the other object.  This method requires that the
+    // (template parameter) types 'KEY' and 'VALUE' both be
+    // "equality-comparable" (see {Requirements on 'KEY' and 'VALUE'}).
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' value is less than the specified
+    // 'rhs' value, and 'false' otherwise.  A map, 'lhs', has a value that is
+    // less than that of 'rhs', if, for the first non-equal corresponding
+    // key-value pairs in their respective sequences, the 'lhs' key-value pair
+    // is less than the 'rhs' pair, or, if all of their corresponding pairs
+    // compare equal, 'lhs' has fewer pairs than 'rhs'.  A key-value pair is
+    // less than another if its key is less than that of the other, or if the
+    // keys are equal and its value is less than that of the other.  This
+    // method requires that the (template parameter) types 'KEY' and 'VALUE'
+    // both be "less-than-comparable" (see {Requirements on 'KEY' and
+    // 'VALUE'}).
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' value is greater than the specified
+    // 'rhs' value, and 'false' otherwise.  'lhs' has a value greater than that
+    // of 'rhs' if 'rhs' has a value less than that of 'lhs' (see
+    // 'operator<').
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' value is less-than or equal-to the
+    // specified 'rhs' value, and 'false' otherwise.  'lhs' has a value
+    // less-than or equal-to that of 'rhs' if 'rhs' does not have a value less
+    // than that of 'lhs' (see 'operator<').
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' value is greater-than or equal-to
+    // the specified 'rhs' value, and 'false' otherwise.  'lhs' has a value
+    // greater-than or equal-to that of 'rhs' if 'lhs' does not have a value
+    // less than that of 'rhs' (see 'operator<').
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void swap(flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+          flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& b);
+    // Swap both the value and the comparator of the specified 'a' object with
+    // the value and comparator of the specified 'b' object.  Additionally if
+    // 'bslstl::AllocatorTraits<ALLOCATOR>::propagate_on_container_swap' is
+    // 'true' then exchange the allocator of 'a' with that of 'b', and do not
+    // modify either allocator otherwise.  This method provides the no-throw
+    // exception-safety guarantee and guarantees O[1] complexity if the
+    // allocators are exchanged or are equal.
+
+}  // close namespace bsl
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+namespace BloombergLP {
+namespace bslstl {
+
+                          // -----------------------
+                          // class FlatMap_Reference
+                          // -----------------------
+
+// CREATORS
+template <class KEY, class VALUE>
+inline
+FlatMap_Reference<KEY, VALUE>::FlatMap_Reference(const KEY& key, VALUE& value)
+: first(key)
+, second(value)
+{
+}
+
+// ACCESSORS
+template <class KEY, class VALUE>
+inline
+FlatMap_Reference<KEY, VALUE>::operator bsl::pair<
+                  KEY,
+                  typename FlatMap_Reference<KEY, VALUE>::MappedType>() const
+{
+    return bsl::pair<KEY, MappedType>(first, second);
+}
+
+                           // ---------------------
+                           // class FlatMap_Pointer
+                           // ---------------------
+
+// CREATORS
+template <class KEY, class VALUE>
+inline
+FlatMap_Pointer<KEY, VALUE>::FlatMap_Pointer(
+                                const FlatMap_Reference<KEY, VALUE>& reference)
+: d_reference(reference)
+{
+}
+
+// ACCESSORS
+template <class KEY, class VALUE>
+inline
+const FlatMap_Reference<KEY, VALUE> *
+FlatMap_Pointer<KEY, VALUE>::operator->() const
+{
+    return &d_reference;
+}
+
+                           // ----------------------
+                           // class FlatMap_Iterator
+                           // ----------------------
+
+// CREATORS
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE>::FlatMap_Iterator()
+: d_key_p(0)
+, d_value_p(0)
+{
+}
+
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE>::FlatMap_Iterator(const KEY *key, VALUE *value)
+: d_key_p(key)
+, d_value_p(value)
+{
+}
+
+template <class KEY, class VALUE>
+template <class OTHER_VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE>::FlatMap_Iterator(
+               const FlatMap_Iterator<KEY, OTHER_VALUE>& original,
+               typename bsl::enable_if<
+                                  bsl::is_same<OTHER_VALUE, MappedType>::value
+                               && !bsl::is_same<OTHER_VALUE, VALUE>::value,
+                                  int>::type)
+: d_key_p(original.key())
+, d_value_p(original.value())
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE>& FlatMap_Iterator<KEY, VALUE>::operator++()
+{
+    ++d_key_p;
+    ++d_value_p;
+    return *this;
+}
+
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE>& FlatMap_Iterator<KEY, VALUE>::operator--()
+{
+    --d_key_p;
+    --d_value_p;
+    return *this;
+}
+
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE> FlatMap_Iterator<KEY, VALUE>::operator++(int)
+{
+    FlatMap_Iterator result(*this);
+    ++*this;
+    return result;
+}
+
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE> FlatMap_Iterator<KEY, VALUE>::operator--(int)
+{
+    FlatMap_Iterator result(*this);
+    --*this;
+    return result;
+}
+
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE>&
+FlatMap_Iterator<KEY, VALUE>::operator+=(difference_type offset)
+{
+    d_key_p   += offset;
+    d_value_p += offset;
+    return *this;
+}
+
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE>&
+FlatMap_Iterator<KEY, VALUE>::operator-=(difference_type offset)
+{
+    d_key_p   -= offset;
+    d_value_p -= offset;
+    return *this;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE>
+inline
+typename FlatMap_Iterator<KEY, VALUE>::reference
+FlatMap_Iterator<KEY, VALUE>::operator*() const
+{
+    return reference(*d_key_p, *d_value_p);
+}
+
+template <class KEY, class VALUE>
+inline
+typename FlatMap_Iterator<KEY, VALUE>::pointer
+FlatMap_Iterator<KEY, VALUE>::operator->() const
+{
+    return pointer(**this);
+}
+
+template <class KEY, class VALUE>
+inline
+typename FlatMap_Iterator<KEY, VALUE>::reference
+FlatMap_Iterator<KEY, VALUE>::operator[](difference_type offset) const
+{
+    return reference(d_key_p[offset], d_value_p[offset]);
+}
+
+template <class KEY, class VALUE>
+inline
+const KEY *FlatMap_Iterator<KEY, VALUE>::key() const
+{
+    return d_key_p;
+}
+
+template <class KEY, class VALUE>
+inline
+VALUE *FlatMap_Iterator<KEY, VALUE>::value() const
+{
+    return d_value_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class VALUE1, class VALUE2>
+inline
+bool bslstl::operator==(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                        const FlatMap_Iterator<KEY, VALUE2>& rhs)
+{
+    return lhs.key() == rhs.key();
+}
+
+template <class KEY, class VALUE1, class VALUE2>
+inline
+bool bslstl::operator!=(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                        const FlatMap_Iterator<KEY, VALUE2>& rhs)
+{
+    return lhs.key() != rhs.key();
+}
+
+template <class KEY, class VALUE1, class VALUE2>
+inline
+bool bslstl::operator<(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                       const FlatMap_Iterator<KEY, VALUE2>& rhs)
+{
+    return lhs.key() < rhs.key();
+}
+
+template <class KEY, class VALUE1, class VALUE2>
+inline
+bool bslstl::operator>(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                       const FlatMap_Iterator<KEY, VALUE2>& rhs)
+{
+    return lhs.key() > rhs.key();
+}
+
+template <class KEY, class VALUE1, class VALUE2>
+inline
+bool bslstl::operator<=(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                        const FlatMap_Iterator<KEY, VALUE2>& rhs)
+{
+    return lhs.key() <= rhs.key();
+}
+
+template <class KEY, class VALUE1, class VALUE2>
+inline
+bool bslstl::operator>=(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                        const FlatMap_Iterator<KEY, VALUE2>& rhs)
+{
+    return lhs.key() >= rhs.key();
+}
+
+template <class KEY, class VALUE1, class VALUE2>
+inline
+std::ptrdiff_t bslstl::operator-(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                                 const FlatMap_Iterator<KEY, VALUE2>& rhs)
+{
+    return lhs.key() - rhs.key();
+}
+
+template <class KEY, class VALUE>
+inline
+bslstl::FlatMap_Iterator<KEY, VALUE> bslstl::operator+(
+                                  const FlatMap_Iterator<KEY, VALUE>& iterator,
+                                  std::ptrdiff_t                      offset)
+{
+    FlatMap_Iterator<KEY, VALUE> result(iterator);
+    return result += offset;
+}
+
+template <class KEY, class VALUE>
+inline
+bslstl::FlatMap_Iterator<KEY, VALUE> bslstl::operator+(
+                                 std::ptrdiff_t                      offset,
+                                 const FlatMap_Iterator<KEY, VALUE>& iterator)
+{
+    FlatMap_Iterator<KEY, VALUE> result(iterator);
+    return result += offset;
+}
+
+template <class KEY, class VALUE>
+inline
+bslstl::FlatMap_Iterator<KEY, VALUE> bslstl::operator-(
+                                  const FlatMap_Iterator<KEY, VALUE>& iterator,
+                                  std::ptrdiff_t                      offset)
+{
+    FlatMap_Iterator<KEY, VALUE> result(iterator);
+    return result -= offset;
+}
+
+namespace bslstl {
+
+                         // -------------------------
+                         // class FlatMap_TailProctor
+                         // -------------------------
+
+// CREATORS
+template <class KEY_CONTAINER, class MAPPED_CONTAINER>
+inline
+FlatMap_TailProctor<KEY_CONTAINER, MAPPED_CONTAINER>::FlatMap_TailProctor(
+                                                   KEY_CONTAINER    *keys,
+                                                   MAPPED_CONTAINER *values)
+: d_keys_p(keys)
+, d_values_p(values)
+, d_length(keys->size())
+{
+    BSLS_ASSERT_SAFE(keys->size() == values->size());
+}
+
+template <class KEY_CONTAINER, class MAPPED_CONTAINER>
+inline
+FlatMap_TailProctor<KEY_CONTAINER, MAPPED_CONTAINER>::~FlatMap_TailProctor()
+{
+    if (d_keys_p) {
+        d_keys_p->erase(d_keys_p->begin() + d_length, d_keys_p->end());
+        if (d_values_p->size() > d_length) {
+            d_values_p->erase(d_values_p->begin() + d_length,
+                              d_values_p->end());
+        }
+    }
+}
+
+// MANIPULATORS
+template <class KEY_CONTAINER, class MAPPED_CONTAINER>
+inline
+void FlatMap_TailProctor<KEY_CONTAINER, MAPPED_CONTAINER>::release()
+{
+    d_keys_p = 0;
+}
+
+// ACCESSORS
+template <class KEY_CONTAINER, class MAPPED_CONTAINER>
+inline
+std::size_t FlatMap_TailProctor<KEY_CONTAINER, MAPPED_CONTAINER>::length()
+                                                                         const
+{
+    return d_length;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                       // -----------------------------
+                       // class flat_map::value_compare
+                       // -----------------------------
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare::value_compare(
+                                                         COMPARATOR comparator)
+: comp(comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare::operator()(
+                                                    const value_type& x,
+                                                    const value_type& y) const
+{
+    return comp(x.first, y.first);
+}
+
+                              // --------------
+                              // class flat_map
+                              // --------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insertAt(size_type    position,
+                                                      const KEY&   key,
+                                                      const VALUE& value)
+{
+    // Insert in place only if doing so provides the strong guarantee (see
+    // 'bslstl_flatcontainerutil'), having first grown both vectors (each of
+    // which, if it throws, leaves its vector unchanged), since 'bsl::vector'
+    // does not restore the vector if copying an element into newly allocated
+    // storage throws.  Insert the value first: if inserting the key then
+    // throws, the value is removed again, which cannot throw.  Otherwise,
+    // build copies including 'key' and 'value', and swap them in.
+
+    if (position == d_keys.size()
+     || (BloombergLP::bslmf::IsBitwiseMoveable<KEY>::value
+      && BloombergLP::bslmf::IsBitwiseMoveable<VALUE>::value)) {
+        if (d_keys.size() == capacity()) {
+            reserve(d_keys.empty() ? 1 : 2 * d_keys.size());
+        }
+        d_values.insert(d_values.begin() + position, value);
+        BSLS_TRY {
+            d_keys.insert(d_keys.begin() + position, key);
+        }
+        BSLS_CATCH(...) {
+            d_values.erase(d_values.begin() + position);
+            BSLS_RETHROW;
+        }
+        return makeIterator(position);                                // RETURN
+    }
+
+    key_container_type    keys(d_keys.get_allocator());
+    mapped_container_type values(d_values.get_allocator());
+    BloombergLP::bslstl::FlatContainerUtil::copyWithInsert(&keys,
+                                                            d_keys,
+                                                            position,
+                                                            key);
+    BloombergLP::bslstl::FlatContainerUtil::copyWithInsert(&values,
+                                                            d_values,
+                                                            position,
+                                                            value);
+    d_keys.swap(keys);
+    d_values.swap(values);
+    return makeIterator(position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::makeIterator(size_type position)
+{
+    return iterator(d_keys.begin() + position, d_values.begin() + position);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::makeIterator(
+                                                    size_type position) const
+{
+    return const_iterator(d_keys.begin() + position,
+                          d_values.begin() + position);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::lowerBoundIndex(
+                                                  const LOOKUP_KEY& key) const
+{
+    return std::lower_bound(d_keys.begin(), d_keys.end(), key, d_comparator)
+                                                              - d_keys.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::upperBoundIndex(
+                                                  const LOOKUP_KEY& key) const
+{
+    return std::upper_bound(d_keys.begin(), d_keys.end(), key, d_comparator)
+                                                              - d_keys.begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::findIndex(
+                                                  const LOOKUP_KEY& key) const
+{
+    const size_type position = lowerBoundIndex(key);
+    return position != d_keys.size() && !d_comparator(key, d_keys[position])
+           ? position
+           : d_keys.size();
+}
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                               const ALLOCATOR& basicAllocator)
+: d_keys(basicAllocator)
+, d_values(basicAllocator)
+, d_comparator()
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(const flat_map& original)
+: d_keys(original.d_keys,
+         AllocatorTraits::select_on_container_copy_construction(
+                                                 original.get_allocator()))
+, d_values(original.d_values,
+           AllocatorTraits::select_on_container_copy_construction(
+                                                 original.get_allocator()))
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                              const flat_map&  original,
+                                              const ALLOCATOR& basicAllocator)
+: d_keys(original.d_keys, basicAllocator)
+, d_values(original.d_values, basicAllocator)
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              const COMPARATOR& comparator,
+                                              const ALLOCATOR&  basicAllocator)
+: d_keys(basicAllocator)
+, d_values(basicAllocator)
+, d_comparator(comparator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::~flat_map()
+{
+    BSLS_ASSERT_SAFE(d_keys.size() == d_values.size());
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(const flat_map& rhs)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(this != &rhs)) {
+
+        // Assign the keys and values to copies first, so that this map is
+        // left unchanged if an exception is thrown.
+
+        key_container_type    keys(d_keys.get_allocator());
+        mapped_container_type values(d_values.get_allocator());
+        keys   = rhs.d_keys;
+        values = rhs.d_values;
+
+        d_keys.swap(keys);
+        d_values.swap(values);
+        d_comparator = rhs.d_comparator;
+    }
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+VALUE& flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator[](
+                                                           const key_type& key)
+{
+    const size_type position = lowerBoundIndex(key);
+    if (position == d_keys.size() || d_comparator(key, d_keys[position])) {
+        insertAt(position, key, VALUE());
+    }
+    return d_values[position];
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+VALUE& flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::at(const key_type& key)
+{
+    const size_type position = findIndex(key);
+    if (position == d_keys.size()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                            "flat_map<...>::at(key_type): invalid key value");
+    }
+    return d_values[position];
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin()
+{
+    return makeIterator(0);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::end()
+{
+    return makeIterator(d_keys.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bsl::pair<typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    const size_type position = lowerBoundIndex(value.first);
+    if (position != d_keys.size()
+     && !d_comparator(value.first, d_keys[position])) {
+        return bsl::pair<iterator, bool>(makeIterator(position), false);
+                                                                      // RETURN
+    }
+    return bsl::pair<iterator, bool>(insertAt(position,
+                                              value.first,
+                                              value.second),
+                                     true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
+                                                    const value_type& value)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= hint);
+    BSLS_ASSERT_SAFE(hint     <= cend());
+
+    const size_type position = hint - cbegin();
+    if ((position == d_keys.size()
+      || d_comparator(value.first, d_keys[position]))
+     && (position == 0
+      || d_comparator(d_keys[position - 1], value.first))) {
+        return insertAt(position, value.first, value.second);         // RETURN
+    }
+    return insert(value).first;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    // Append the range, then sort and merge the appended keys with the
+    // existing keys in one pass (see 'bslstl_flatcontainerutil'), building
+    // the merged arrays of keys and values aside, so that the proctor can
+    // restore this map if an exception is thrown.
+
+    BloombergLP::bslstl::FlatMap_TailProctor<key_container_type,
+                                             mapped_container_type>
+                                                   proctor(&d_keys, &d_values);
+
+    for (; first != last; ++first) {
+        d_values.push_back(first->second);
+        d_keys.push_back(first->first);
+    }
+
+    IndexContainer order(d_keys.get_allocator());
+    if (BloombergLP::bslstl::FlatContainerUtil::mergeOrder(&order,
+                                                            d_keys,
+                                                            proctor.length(),
+                                                            d_comparator)) {
+        key_container_type    keys(d_keys.get_allocator());
+        mapped_container_type values(d_values.get_allocator());
+        BloombergLP::bslstl::FlatContainerUtil::gather(&keys, d_keys, order);
+        BloombergLP::bslstl::FlatContainerUtil::gather(&values,
+                                                        d_values,
+                                                        order);
+        d_keys.swap(keys);
+        d_values.swap(values);
+    }
+    proctor.release();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return erase(position, position + 1);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const size_type position = findIndex(key);
+    if (position == d_keys.size()) {
+        return 0;                                                     // RETURN
+    }
+    d_keys.erase(d_keys.begin() + position);
+    d_values.erase(d_values.begin() + position);
+    return 1;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                                   const_iterator last)
+{
+    const size_type firstIndex = first - cbegin();
+    const size_type lastIndex  = last  - cbegin();
+
+    d_keys.erase(d_keys.begin() + firstIndex, d_keys.begin() + lastIndex);
+    d_values.erase(d_values.begin() + firstIndex,
+                   d_values.begin() + lastIndex);
+    return makeIterator(firstIndex);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::swap(flat_map& other)
+{
+    // Swapping the vectors cannot throw only if their allocators are equal;
+    // otherwise swap copies, so that an exception thrown by copying one
+    // vector leaves both maps unchanged.
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                   get_allocator() == other.get_allocator())) {
+        d_keys.swap(other.d_keys);
+        d_values.swap(other.d_values);
+
+        using std::swap;
+        swap(d_comparator, other.d_comparator);
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        flat_map thisCopy(*this, other.get_allocator());
+        flat_map otherCopy(other, get_allocator());
+
+        swap(otherCopy);
+        other.swap(thisCopy);
+    }
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_keys.clear();
+    d_values.clear();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reserve(
+                                                         size_type numElements)
+{
+    d_keys.reserve(numElements);
+    d_values.reserve(numElements);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key)
+{
+    return makeIterator(findIndex(key));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(const key_type& key)
+{
+    return makeIterator(lowerBoundIndex(key));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(const key_type& key)
+{
+    return makeIterator(upperBoundIndex(key));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator,
+          typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key)
+{
+    const size_type position = findIndex(key);
+    if (position == d_keys.size()) {
+        iterator it = lower_bound(key);
+        return bsl::pair<iterator, iterator>(it, it);                 // RETURN
+    }
+    return bsl::pair<iterator, iterator>(makeIterator(position),
+                                         makeIterator(position + 1));
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::allocator_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return allocator_type(d_keys.get_allocator());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return makeIterator(0);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() const
+{
+    return makeIterator(d_keys.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::cbegin() const
+{
+    return begin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::cend() const
+{
+    return end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::crbegin() const
+{
+    return rbegin();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::crend() const
+{
+    return rend();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return d_keys.empty();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_keys.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::max_size() const
+{
+    return d_keys.max_size() < d_values.max_size() ? d_keys.max_size()
+                                                   : d_values.max_size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::capacity() const
+{
+    return d_keys.capacity() < d_values.capacity() ? d_keys.capacity()
+                                                   : d_values.capacity();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+const typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_container_type&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::keys() const
+{
+    return d_keys;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+const typename
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::mapped_container_type&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::values() const
+{
+    return d_values;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+const VALUE& flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::at(
+                                                     const key_type& key) const
+{
+    const size_type position = findIndex(key);
+    if (position == d_keys.size()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                            "flat_map<...>::at(key_type): invalid key value");
+    }
+    return d_values[position];
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_compare
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_comparator;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return value_compare(key_comp());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    return makeIterator(findIndex(key));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return contains(key) ? 1 : 0;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::contains(
+                                                     const key_type& key) const
+{
+    return findIndex(key) != d_keys.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                     const key_type& key) const
+{
+    return makeIterator(lowerBoundIndex(key));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                     const key_type& key) const
+{
+    return makeIterator(upperBoundIndex(key));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator,
+          typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(
+                                                     const key_type& key) const
+{
+    const size_type position = findIndex(key);
+    if (position == d_keys.size()) {
+        const_iterator it = lower_bound(key);
+        return bsl::pair<const_iterator, const_iterator>(it, it);     // RETURN
+    }
+    return bsl::pair<const_iterator, const_iterator>(
+                                                 makeIterator(position),
+                                                 makeIterator(position + 1));
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(
+                 const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                 const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return lhs.keys() == rhs.keys() && lhs.values() == rhs.values();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+                 const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                 const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool bsl::operator<(
+                 const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                 const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    typedef typename bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::
+                                                     size_type SizeType;
+
+    const SizeType length = lhs.size() < rhs.size() ? lhs.size() : rhs.size();
+    for (SizeType i = 0; i < length; ++i) {
+        if (lhs.keys()[i] < rhs.keys()[i]) {
+            return true;                                              // RETURN
+        }
+        if (rhs.keys()[i] < lhs.keys()[i]) {
+            return false;                                             // RETURN
+        }
+        if (lhs.values()[i] < rhs.values()[i]) {
+            return true;                                              // RETURN
+        }
+        if (rhs.values()[i] < lhs.values()[i]) {
+            return false;                                             // RETURN
+        }
+    }
+    return lhs.size() < rhs.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(
+                 const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                 const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+                 const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                 const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+                 const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                 const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+               bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for STL *ordered* containers:
+//: o An ordered container defines STL iterators.
+//: o An ordered container uses 'bslma' allocators if the parameterized
+//:     'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
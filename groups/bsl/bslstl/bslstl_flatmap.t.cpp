@@ -0,0 +1,1647 @@
+// bslstl_flatmap.t.cpp                                              -*-C++-*-
+#include <bslstl_flatmap.h>
+
+#include <bslstl_allocator.h>
+#include <bslstl_iterator.h>
+#include <bslstl_pair.h>
+#include <bslstl_string.h>
+#include <bslstl_stringref.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_types.h>
+
+#include <bsltf_alloctesttype.h>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a container class template,
+// 'bsl::flat_map', that holds its keys and values in two 'bsl::vector'
+// objects, sorted by key, and merges ranges of inserted elements using
+// 'bslstl::FlatContainerUtil', which is tested by its own test driver.  This
+// test driver therefore concentrates on keeping the keys ordered and the
+// values aligned with their keys through every manipulator, on the proxy
+// iterators and references, on the exception safety of insertion (which
+// 'bsl::vector' alone does not provide for types that are not bitwise
+// moveable), and on the allocator behavior expected of a BDE container.
+//
+// Each case is run for an 'int' key and for a 'bsltf::AllocTestType' key
+// (allocating memory), both mapping to 'bsltf::AllocTestType' values, which
+// are not bitwise moveable, so that elements are inserted by copying the
+// map.  The value of a map is verified against a reference 'std::map'.
+//
+// Global Concerns:
+//: o All memory is supplied by the allocator passed at construction.
+//: o No memory is leaked.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_map(const C& comparator = C(), const A& allocator = A());
+// [ 2] flat_map(const A& allocator);
+// [ 3] flat_map(const flat_map& original);
+// [ 3] flat_map(const flat_map& original, const A& allocator);
+// [ 4] flat_map(ITER first, ITER last, const C& comp, const A& allocator);
+// [ 2] ~flat_map();
+//
+// MANIPULATORS
+// [ 3] flat_map& operator=(const flat_map& rhs);
+// [ 6] VALUE& operator[](const key_type& key);
+// [ 6] VALUE& at(const key_type& key);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 2] reverse_iterator rbegin();
+// [ 2] reverse_iterator rend();
+// [ 2] pair<iterator, bool> insert(const value_type& value);
+// [ 4] iterator insert(const_iterator hint, const value_type& value);
+// [ 4] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 4] iterator erase(const_iterator position);
+// [ 4] size_type erase(const key_type& key);
+// [ 4] iterator erase(const_iterator first, const_iterator last);
+// [ 3] void swap(flat_map& other);
+// [ 2] void clear();
+// [ 8] void reserve(size_type numElements);
+// [ 5] iterator find(const key_type& key);
+// [ 5] iterator lower_bound(const key_type& key);
+// [ 5] iterator upper_bound(const key_type& key);
+// [ 5] pair<iterator, iterator> equal_range(const key_type& key);
+// [ 8] iterator find(const LOOKUP_KEY& key);
+// [ 8] iterator lower_bound(const LOOKUP_KEY& key);
+// [ 8] iterator upper_bound(const LOOKUP_KEY& key);
+// [ 8] pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+//
+// ACCESSORS
+// [ 2] allocator_type get_allocator() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_reverse_iterator rbegin() const;
+// [ 2] const_reverse_iterator rend() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator cend() const;
+// [ 2] const_reverse_iterator crbegin() const;
+// [ 2] const_reverse_iterator crend() const;
+// [ 2] bool empty() const;
+// [ 2] size_type size() const;
+// [ 2] size_type max_size() const;
+// [ 8] size_type capacity() const;
+// [ 8] const key_container_type& keys() const;
+// [ 8] const mapped_container_type& values() const;
+// [ 6] const VALUE& at(const key_type& key) const;
+// [ 2] key_compare key_comp() const;
+// [ 2] value_compare value_comp() const;
+// [ 5] const_iterator find(const key_type& key) const;
+// [ 5] size_type count(const key_type& key) const;
+// [ 5] bool contains(const key_type& key) const;
+// [ 5] const_iterator lower_bound(const key_type& key) const;
+// [ 5] const_iterator upper_bound(const key_type& key) const;
+// [ 5] pair<const_iter, const_iter> equal_range(const key_type&) const;
+// [ 8] const_iterator find(const LOOKUP_KEY& key) const;
+// [ 8] size_type count(const LOOKUP_KEY& key) const;
+// [ 8] bool contains(const LOOKUP_KEY& key) const;
+// [ 8] const_iterator lower_bound(const LOOKUP_KEY& key) const;
+// [ 8] const_iterator upper_bound(const LOOKUP_KEY& key) const;
+// [ 8] pair<const_iter, const_iter> equal_range(const LOOKUP_KEY&) const;
+//
+// FREE OPERATORS
+// [ 7] bool operator==(const flat_map& lhs, const flat_map& rhs);
+// [ 7] bool operator!=(const flat_map& lhs, const flat_map& rhs);
+// [ 7] bool operator< (const flat_map& lhs, const flat_map& rhs);
+// [ 7] bool operator> (const flat_map& lhs, const flat_map& rhs);
+// [ 7] bool operator<=(const flat_map& lhs, const flat_map& rhs);
+// [ 7] bool operator>=(const flat_map& lhs, const flat_map& rhs);
+// [ 3] void swap(flat_map& a, flat_map& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] CONCERN: The type has the expected type traits.
+// [ 4] CONCERN: Insertion provides the strong exception-safety guarantee.
+// [ 8] CONCERN: Lookup by a transparent comparator allocates no memory.
+// [ 9] USAGE EXAMPLE
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bsls::Types::Int64   Int64;
+typedef bsltf::AllocTestType AllocType;
+typedef std::map<int, int>   Reference;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+template <class TYPE>
+struct DataLess {
+    // This class provides a comparator ordering objects of the (template
+    // parameter) 'TYPE' by the value returned by their 'data' method.
+
+    bool operator()(const TYPE& lhs, const TYPE& rhs) const
+        // Return 'true' if the specified 'lhs' is ordered before the
+        // specified 'rhs', and 'false' otherwise.
+    {
+        return lhs.data() < rhs.data();
+    }
+};
+
+namespace BloombergLP {
+namespace bsltf {
+
+bool operator<(const AllocTestType& lhs, const AllocTestType& rhs)
+    // Return 'true' if the specified 'lhs' is ordered before the specified
+    // 'rhs', and 'false' otherwise.  Note that this operator is required to
+    // test the relational operators on maps of 'AllocTestType'.
+{
+    return lhs.data() < rhs.data();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+template <class KEY>
+struct KeyUtil;
+    // This 'struct' provides, for each key type used by this test driver, a
+    // class method 'create' returning a key having a specified integer value,
+    // and a class method 'toInt' returning the integer value of a key.
+
+template <>
+struct KeyUtil<int> {
+    static int create(int value, bslma::Allocator *)
+    {
+        return value;
+    }
+
+    static int toInt(int value)
+    {
+        return value;
+    }
+};
+
+template <>
+struct KeyUtil<AllocType> {
+    static AllocType create(int value, bslma::Allocator *basicAllocator)
+    {
+        return AllocType(value, basicAllocator);
+    }
+
+    static int toInt(const AllocType& value)
+    {
+        return value.data();
+    }
+};
+
+static int nextRandom(unsigned *seed)
+    // Advance the specified 'seed' of a linear congruential generator and
+    // return the next pseudo-random number in the range '[0, 32767]'.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return static_cast<int>((*seed >> 16) & 0x7fff);
+}
+
+enum Pattern {
+    // Orders in which a sequence of integers is generated.
+
+    e_ASCENDING,
+    e_DESCENDING,
+    e_RANDOM,
+    e_NUM_PATTERNS
+};
+
+static std::vector<int> makeSequence(int pattern, int length)
+    // Return a sequence of the specified 'length' integers, generated in the
+    // specified 'pattern'.  Random sequences contain duplicates.
+{
+    std::vector<int> result;
+    unsigned         seed = static_cast<unsigned>(length);
+    for (int i = 0; i < length; ++i) {
+        switch (pattern) {
+          case e_ASCENDING: {
+            result.push_back(i);
+          } break;
+          case e_DESCENDING: {
+            result.push_back(length - i);
+          } break;
+          default: {
+            result.push_back(nextRandom(&seed) % (length + 1));
+          } break;
+        }
+    }
+    return result;
+}
+
+static const int SIZES[] = { 0, 1, 2, 5, 17, 100, 257, 1000 };
+static const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+struct StringRefLess {
+    // This 'struct' defines a transparent ordering of strings.
+
+    typedef void is_transparent;
+
+    bool operator()(const bslstl::StringRef& lhs,
+                    const bslstl::StringRef& rhs) const
+        // Return 'true' if the specified 'lhs' is ordered before the
+        // specified 'rhs', and 'false' otherwise.
+    {
+        return lhs < rhs;
+    }
+};
+
+//=============================================================================
+//                       TEST DRIVER TEMPLATE
+//-----------------------------------------------------------------------------
+
+template <class KEY, class COMPARATOR>
+struct TestDriver {
+    // This templatized struct provides a namespace for testing the
+    // 'flat_map' container mapping the (template parameter) 'KEY' type,
+    // ordered by the (template parameter) 'COMPARATOR' type, to
+    // 'bsltf::AllocTestType' values.  The mapped value of each element
+    // created by this driver is the negation of its key.
+
+    // TYPES
+    typedef bsl::flat_map<KEY, AllocType, COMPARATOR>     Obj;
+    typedef typename Obj::value_type                       ValueType;
+    typedef typename Obj::iterator                         Iterator;
+    typedef typename Obj::const_iterator                   ConstIterator;
+    typedef typename Obj::allocator_type                   Allocator;
+    typedef KeyUtil<KEY>                                   Util;
+
+    // CLASS METHODS
+    static ValueType createValue(int key, bslma::Allocator *basicAllocator)
+        // Return an element having the specified 'key' and mapped value
+        // '-key', using the specified 'basicAllocator' to supply memory.
+    {
+        return ValueType(Util::create(key, basicAllocator),
+                         AllocType(-key, basicAllocator),
+                         basicAllocator);
+    }
+
+    static bool verify(const Obj& object, const Reference& reference)
+        // Return 'true' if the specified 'object' holds the same sequence of
+        // key-value pairs as the specified 'reference', iterating in both
+        // directions, and 'false' otherwise.
+    {
+        if (object.size() != reference.size()) {
+            return false;                                             // RETURN
+        }
+        ConstIterator             it  = object.begin();
+        Reference::const_iterator rit = reference.begin();
+        for (; it != object.end(); ++it, ++rit) {
+            if (Util::toInt(it->first) != rit->first
+             || it->second.data()       != rit->second) {
+                return false;                                         // RETURN
+            }
+        }
+        typename Obj::const_reverse_iterator rev  = object.rbegin();
+        Reference::const_reverse_iterator    rrev = reference.rbegin();
+        for (; rev != object.rend(); ++rev, ++rrev) {
+            if (Util::toInt(rev->first) != rrev->first) {
+                return false;                                         // RETURN
+            }
+        }
+        return true;
+    }
+
+    // TEST CASES
+    static void testCase2();
+        // Test primary manipulators and basic accessors.
+
+    static void testCase3();
+        // Test copy construction, assignment and 'swap'.
+
+    static void testCase4();
+        // Test insertion and removal.
+
+    static void testCase5();
+        // Test lookup.
+
+    static void testCase6();
+        // Test element access.
+
+    static void testCase7();
+        // Test comparison operators.
+};
+
+template <class KEY, class COMPARATOR>
+void TestDriver<KEY, COMPARATOR>::testCase2()
+{
+    // ------------------------------------------------------------------------
+    // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+    //
+    // Concerns:
+    //: 1 A default-constructed map is empty, and uses the supplied allocator,
+    //:   or the default allocator if none is supplied.
+    //:
+    //: 2 'insert' of a value adds the value if its key is not present, and
+    //:   returns an iterator to the element having that key, and whether the
+    //:   value was inserted.
+    //:
+    //: 3 Forward and reverse iteration visit the elements in order.
+    //:
+    //: 4 'clear' removes every element, retaining the memory of the
+    //:   vectors.
+    //:
+    //: 5 'key_comp' and 'value_comp' order keys and values as 'COMPARATOR'.
+    //:
+    //: 6 The type has the 'HasStlIterators' and 'UsesBslmaAllocator' traits.
+    //:
+    //: 7 All memory comes from the object allocator, and none is leaked.
+    //
+    // Plan:
+    //: 1 Construct maps using each constructor, and verify the allocator and
+    //:   that the map is empty.  (C-1)
+    //:
+    //: 2 For a sequence of keys, in several patterns, insert values into a
+    //:   map and into a reference 'std::map', and verify the return values,
+    //:   and the value of the map in both directions.  (C-2..3, 7)
+    //:
+    //: 3 Clear the map and verify that it is empty and holds no memory.
+    //:   (C-4)
+    //:
+    //: 4 Compare the results of 'key_comp' and 'value_comp' with
+    //:   'COMPARATOR'.  (C-5)
+    //:
+    //: 5 Verify the traits.  (C-6)
+    //
+    // Testing:
+    //   flat_map(const C& comparator = C(), const A& allocator = A());
+    //   flat_map(const A& allocator);
+    //   ~flat_map();
+    //   iterator begin();
+    //   iterator end();
+    //   reverse_iterator rbegin();
+    //   reverse_iterator rend();
+    //   pair<iterator, bool> insert(const value_type& value);
+    //   void clear();
+    //   allocator_type get_allocator() const;
+    //   const_iterator begin() const;
+    //   const_iterator end() const;
+    //   const_reverse_iterator rbegin() const;
+    //   const_reverse_iterator rend() const;
+    //   const_iterator cbegin() const;
+    //   const_iterator cend() const;
+    //   const_reverse_iterator crbegin() const;
+    //   const_reverse_iterator crend() const;
+    //   bool empty() const;
+    //   size_type size() const;
+    //   size_type max_size() const;
+    //   key_compare key_comp() const;
+    //   value_compare value_comp() const;
+    //   CONCERN: The type has the expected type traits.
+    // ------------------------------------------------------------------------
+
+    BSLMF_ASSERT((bslalg::HasStlIterators<Obj>::value));
+    BSLMF_ASSERT((bslma::UsesBslmaAllocator<Obj>::value));
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    if (veryVerbose) printf("\tDefault construction.\n");
+    {
+        Obj mW;  const Obj& W = mW;
+        ASSERT(W.get_allocator() == Allocator(&da));
+        ASSERT(W.empty());
+        ASSERT(0 == W.size());
+        ASSERT(W.begin() == W.end());
+        ASSERT(W.cbegin() == W.cend());
+        ASSERT(W.rbegin() == W.rend());
+        ASSERT(W.crbegin() == W.crend());
+        ASSERT(0 < W.max_size());
+
+        Obj mX((Allocator(&oa)));  const Obj& X = mX;
+        ASSERT(X.get_allocator() == Allocator(&oa));
+        ASSERT(X.empty());
+
+        Obj mY(COMPARATOR(), &oa);  const Obj& Y = mY;
+        ASSERT(Y.get_allocator() == Allocator(&oa));
+        ASSERT(Y.empty());
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+    ASSERT(0 == da.numBlocksInUse());
+
+    if (veryVerbose) printf("\tInsertion and iteration.\n");
+    for (int tp = 0; tp < e_NUM_PATTERNS; ++tp) {
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int              LENGTH = SIZES[ti];
+            const std::vector<int> DATA   = makeSequence(tp, LENGTH);
+
+            Obj       mX(&oa);  const Obj& X = mX;
+            Reference reference;
+
+            for (int i = 0; i < LENGTH; ++i) {
+                const ValueType VALUE = createValue(DATA[i], &sa);
+
+                bsl::pair<Iterator, bool> result = mX.insert(VALUE);
+                const bool EXP = reference.insert(
+                                  std::make_pair(DATA[i], -DATA[i])).second;
+
+                ASSERTV(tp, LENGTH, i, EXP == result.second);
+                ASSERTV(tp, LENGTH, i, DATA[i] ==
+                                             Util::toInt(result.first->first));
+                ASSERTV(tp, LENGTH, i, X.end() != X.find(VALUE.first));
+            }
+            ASSERTV(tp, LENGTH, verify(X, reference));
+            ASSERTV(tp, LENGTH, X.empty() == (0 == LENGTH));
+
+            int count = 0;
+            for (Iterator it = mX.begin(); it != mX.end(); ++it) {
+                it->second = AllocType(it->second.data() - 1, &sa);
+                ++count;
+            }
+            ASSERTV(tp, LENGTH, count, X.size() == static_cast<size_t>(count));
+            for (Reference::iterator it  = reference.begin();
+                                     it != reference.end();
+                                     ++it) {
+                --it->second;
+            }
+            ASSERTV(tp, LENGTH, verify(X, reference));
+
+            count = 0;
+            for (typename Obj::reverse_iterator it  = mX.rbegin();
+                                                it != mX.rend();
+                                                ++it) {
+                ++count;
+            }
+            ASSERTV(tp, LENGTH, count, X.size() == static_cast<size_t>(count));
+
+            if (LENGTH) {
+                ASSERTV(tp, LENGTH, 0 < oa.numBlocksInUse());
+            }
+            const Int64 NUM_BLOCKS = LENGTH ? 2 : 0;
+
+            mX.clear();
+            ASSERTV(tp, LENGTH, X.empty());
+            ASSERTV(tp, LENGTH, X.begin() == X.end());
+            ASSERTV(tp, LENGTH, NUM_BLOCKS == oa.numBlocksInUse());
+
+            mX.insert(createValue(1, &sa));
+            ASSERTV(tp, LENGTH, 1 == X.size());
+        }
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+    ASSERT(0 == da.numBlocksTotal());
+
+    if (veryVerbose) printf("\tComparators.\n");
+    {
+        const Obj X(&oa);
+
+        const KEY K1 = Util::create(1, &sa);
+        const KEY K2 = Util::create(2, &sa);
+
+        ASSERT( X.key_comp()(K1, K2));
+        ASSERT(!X.key_comp()(K2, K1));
+        ASSERT(!X.key_comp()(K1, K1));
+
+        const ValueType V1 = createValue(1, &sa);
+        const ValueType V2 = createValue(2, &sa);
+
+        ASSERT( X.value_comp()(V1, V2));
+        ASSERT(!X.value_comp()(V2, V1));
+        ASSERT(!X.value_comp()(V1, V1));
+    }
+}
+
+template <class KEY, class COMPARATOR>
+void TestDriver<KEY, COMPARATOR>::testCase3()
+{
+    // ------------------------------------------------------------------------
+    // COPY CONSTRUCTION, ASSIGNMENT AND SWAP
+    //
+    // Concerns:
+    //: 1 A copy has the same value as the original, and uses the supplied
+    //:   allocator, or the default allocator if none is supplied.
+    //:
+    //: 2 The original is not modified by copying.
+    //:
+    //: 3 Assignment gives the target the value of the source, retaining the
+    //:   allocator of the target, and self-assignment has no effect.
+    //:
+    //: 4 'swap' (member and free) exchanges the values of two maps, without
+    //:   allocating memory if their allocators are equal, and exchanging
+    //:   copies otherwise.
+    //:
+    //: 5 No memory is leaked.
+    //
+    // Plan:
+    //: 1 For pairs of maps of various sizes, copy, assign and swap them,
+    //:   verifying the values against references, and the allocators used.
+    //:   (C-1..5)
+    //
+    // Testing:
+    //   flat_map(const flat_map& original);
+    //   flat_map(const flat_map& original, const A& allocator);
+    //   flat_map& operator=(const flat_map& rhs);
+    //   void swap(flat_map& other);
+    //   void swap(flat_map& a, flat_map& b);
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        const int              LENGTH1 = SIZES[ti];
+        const std::vector<int> DATA1   = makeSequence(e_RANDOM, LENGTH1);
+
+        Obj       mX(&oa);  const Obj& X = mX;
+        Reference reference1;
+        for (int i = 0; i < LENGTH1; ++i) {
+            mX.insert(createValue(DATA1[i], &sa));
+            reference1[DATA1[i]] = -DATA1[i];
+        }
+        ASSERTV(LENGTH1, verify(X, reference1));
+
+        {
+            const Obj Y(X);
+            ASSERTV(LENGTH1, Y.get_allocator() == Allocator(&da));
+            ASSERTV(LENGTH1, verify(Y, reference1));
+            ASSERTV(LENGTH1, X == Y);
+        }
+        ASSERTV(LENGTH1, 0 == da.numBlocksInUse());
+        {
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            const Obj Y(X, &za);
+            ASSERTV(LENGTH1, Y.get_allocator() == Allocator(&za));
+            ASSERTV(LENGTH1, verify(Y, reference1));
+            ASSERTV(LENGTH1, oam.isTotalSame());
+        }
+        ASSERTV(LENGTH1, verify(X, reference1));
+
+        for (int tj = 0; tj < NUM_SIZES; ++tj) {
+            const int              LENGTH2 = SIZES[tj];
+            const std::vector<int> DATA2   = makeSequence(e_ASCENDING,
+                                                          LENGTH2);
+
+            Reference reference2;
+            for (int i = 0; i < LENGTH2; ++i) {
+                reference2[DATA2[i]] = -DATA2[i];
+            }
+
+            {
+                Obj mY(&za);  const Obj& Y = mY;
+                for (int i = 0; i < LENGTH2; ++i) {
+                    mY.insert(createValue(DATA2[i], &sa));
+                }
+
+                Obj *mR = &(mY = X);
+                ASSERTV(LENGTH1, LENGTH2, mR == &mY);
+                ASSERTV(LENGTH1, LENGTH2, verify(Y, reference1));
+                ASSERTV(LENGTH1, LENGTH2, verify(X, reference1));
+                ASSERTV(LENGTH1, LENGTH2,
+                        Y.get_allocator() == Allocator(&za));
+
+                mR = &(mY = Y);
+                ASSERTV(LENGTH1, LENGTH2, mR == &mY);
+                ASSERTV(LENGTH1, LENGTH2, verify(Y, reference1));
+            }
+            ASSERTV(LENGTH1, LENGTH2, 0 == za.numBlocksInUse());
+
+            {
+                Obj mA(X, &oa);  const Obj& A = mA;
+                Obj mB(&oa);     const Obj& B = mB;
+                for (int i = 0; i < LENGTH2; ++i) {
+                    mB.insert(createValue(DATA2[i], &sa));
+                }
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                mA.swap(mB);
+                ASSERTV(LENGTH1, LENGTH2, verify(A, reference2));
+                ASSERTV(LENGTH1, LENGTH2, verify(B, reference1));
+
+                swap(mA, mB);
+                ASSERTV(LENGTH1, LENGTH2, verify(A, reference1));
+                ASSERTV(LENGTH1, LENGTH2, verify(B, reference2));
+
+                ASSERTV(LENGTH1, LENGTH2, oam.isTotalSame());
+            }
+
+            {
+                Obj mA(X, &oa);  const Obj& A = mA;
+                Obj mB(&za);     const Obj& B = mB;
+                for (int i = 0; i < LENGTH2; ++i) {
+                    mB.insert(createValue(DATA2[i], &sa));
+                }
+
+                mA.swap(mB);
+                ASSERTV(LENGTH1, LENGTH2, verify(A, reference2));
+                ASSERTV(LENGTH1, LENGTH2, verify(B, reference1));
+                ASSERTV(LENGTH1, LENGTH2, A.get_allocator() ==
+                                                          Allocator(&oa));
+                ASSERTV(LENGTH1, LENGTH2, B.get_allocator() ==
+                                                          Allocator(&za));
+            }
+            ASSERTV(LENGTH1, LENGTH2, 0 == za.numBlocksInUse());
+        }
+    }
+    ASSERT(0 == da.numBlocksInUse());
+    ASSERT(0 == oa.numBlocksInUse());
+}
+
+template <class KEY, class COMPARATOR>
+void TestDriver<KEY, COMPARATOR>::testCase4()
+{
+    // ------------------------------------------------------------------------
+    // INSERTION AND REMOVAL
+    //
+    // Concerns:
+    //: 1 'insert' with a hint inserts the value whether or not the hint is
+    //:   correct, and returns an iterator to the element having the key of
+    //:   the value.
+    //:
+    //: 2 The range constructor and the range 'insert' insert each value whose
+    //:   key is not already present, in any order.
+    //:
+    //: 3 Each form of 'erase' removes the identified elements, and returns
+    //:   the iterator or count specified.
+    //:
+    //: 4 Each form of 'insert' provides the strong exception-safety
+    //:   guarantee.
+    //:
+    //: 5 No memory is leaked.
+    //
+    // Plan:
+    //: 1 For sequences of keys in several patterns, insert values using a
+    //:   correct hint, the 'end' hint, and the 'begin' hint, and verify the
+    //:   results against a reference.  (C-1)
+    //:
+    //: 2 Construct maps from, and insert into maps, ranges of values in
+    //:   several patterns, and verify the results.  (C-2)
+    //:
+    //: 3 Erase elements by position, key, and range from maps of various
+    //:   sizes, and verify the results.  (C-3)
+    //:
+    //: 4 Repeat P-1 and P-2 under 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*'
+    //:   for one size.  (C-4)
+    //
+    // Testing:
+    //   flat_map(ITER first, ITER last, const C& comp, const A& allocator);
+    //   iterator insert(const_iterator hint, const value_type& value);
+    //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+    //   iterator erase(const_iterator position);
+    //   size_type erase(const key_type& key);
+    //   iterator erase(const_iterator first, const_iterator last);
+    //   CONCERN: Insertion provides the strong exception-safety guarantee.
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    if (veryVerbose) printf("\tHinted insertion.\n");
+    for (int tp = 0; tp < e_NUM_PATTERNS; ++tp) {
+        for (int th = 0; th < 3; ++th) {
+            for (int ti = 0; ti < NUM_SIZES; ++ti) {
+                const int              LENGTH = SIZES[ti];
+                const std::vector<int> DATA   = makeSequence(tp, LENGTH);
+
+                Obj       mX(&oa);  const Obj& X = mX;
+                Reference reference;
+
+                for (int i = 0; i < LENGTH; ++i) {
+                    const ValueType VALUE = createValue(DATA[i], &sa);
+
+                    ConstIterator hint = 0 == th ? X.lower_bound(VALUE.first)
+                                       : 1 == th ? X.end()
+                                       :           X.begin();
+
+                    Iterator it = mX.insert(hint, VALUE);
+                    ASSERTV(tp, th, LENGTH, i,
+                            DATA[i] == Util::toInt(it->first));
+
+                    reference.insert(std::make_pair(DATA[i], -DATA[i]));
+                }
+                ASSERTV(tp, th, LENGTH, verify(X, reference));
+            }
+        }
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+
+    if (veryVerbose) printf("\tRange construction and insertion.\n");
+    for (int tp = 0; tp < e_NUM_PATTERNS; ++tp) {
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int              LENGTH = SIZES[ti];
+            const std::vector<int> DATA   = makeSequence(tp, LENGTH);
+
+            std::vector<ValueType> values;
+            Reference              reference;
+            for (int i = 0; i < LENGTH; ++i) {
+                values.push_back(createValue(DATA[i], &sa));
+                reference.insert(std::make_pair(DATA[i], -DATA[i]));
+            }
+
+            // Copying into 'values' used the default allocator.
+
+            bslma::TestAllocatorMonitor dam(&da);
+            {
+                const Obj X(values.begin(), values.end(), COMPARATOR(), &oa);
+                ASSERTV(tp, LENGTH, verify(X, reference));
+            }
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+                mX.insert(values.begin(), values.begin() + LENGTH / 2);
+                mX.insert(values.begin() + LENGTH / 3, values.end());
+                ASSERTV(tp, LENGTH, verify(X, reference));
+            }
+            ASSERTV(tp, LENGTH, dam.isTotalSame());
+        }
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+
+    if (veryVerbose) printf("\tRemoval.\n");
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        const int              LENGTH = SIZES[ti];
+        const std::vector<int> DATA   = makeSequence(e_ASCENDING, LENGTH);
+
+        std::vector<ValueType> values;
+        Reference              initial;
+        for (int i = 0; i < LENGTH; ++i) {
+            values.push_back(createValue(DATA[i], &sa));
+            initial.insert(std::make_pair(DATA[i], -DATA[i]));
+        }
+
+        {
+            // Remove every third element by position, then the remainder by
+            // key, including keys that are not present.
+
+            Obj       mX(values.begin(), values.end(), COMPARATOR(), &oa);
+            const Obj& X = mX;
+            Reference reference(initial);
+
+            Iterator it = mX.begin();
+            int      index = 0;
+            while (it != mX.end()) {
+                if (0 == index % 3) {
+                    const int key = Util::toInt(it->first);
+                    it = mX.erase(it);
+                    Reference::iterator rit = reference.find(key);
+                    reference.erase(rit++);
+                    if (rit == reference.end()) {
+                        ASSERTV(LENGTH, index, X.end() == it);
+                    }
+                    else {
+                        ASSERTV(LENGTH, index,
+                                rit->first == Util::toInt(it->first));
+                    }
+                }
+                else {
+                    ++it;
+                }
+                ++index;
+            }
+            ASSERTV(LENGTH, verify(X, reference));
+
+            for (int i = -1; i <= LENGTH; ++i) {
+                const KEY    K   = Util::create(i, &sa);
+                const size_t EXP = reference.erase(i);
+                ASSERTV(LENGTH, i, EXP == mX.erase(K));
+                ASSERTV(LENGTH, i, verify(X, reference));
+            }
+            ASSERTV(LENGTH, X.empty());
+        }
+        ASSERTV(LENGTH, 0 == oa.numBlocksInUse());
+
+        for (int tb = 0; tb <= LENGTH; tb += 1 + LENGTH / 7) {
+            for (int te = tb; te <= LENGTH; te += 1 + LENGTH / 5) {
+                Obj       mX(values.begin(), values.end(), COMPARATOR(), &oa);
+                const Obj& X = mX;
+                Reference reference(initial);
+
+                ConstIterator first = X.begin();
+                bsl::advance(first, tb);
+                ConstIterator last = first;
+                bsl::advance(last, te - tb);
+
+                Reference::iterator rfirst = reference.begin();
+                std::advance(rfirst, tb);
+                Reference::iterator rlast = rfirst;
+                std::advance(rlast, te - tb);
+
+                Iterator it = mX.erase(first, last);
+                reference.erase(rfirst, rlast);
+
+                ASSERTV(LENGTH, tb, te, verify(X, reference));
+                if (te == LENGTH) {
+                    ASSERTV(LENGTH, tb, te, X.end() == it);
+                }
+                else {
+                    ASSERTV(LENGTH, tb, te,
+                            DATA[te] == Util::toInt(it->first));
+                }
+            }
+        }
+        ASSERTV(LENGTH, 0 == oa.numBlocksInUse());
+    }
+
+    if (veryVerbose) printf("\tException safety.\n");
+    {
+        const int              LENGTH = 300;
+        const std::vector<int> DATA   = makeSequence(e_RANDOM, LENGTH);
+
+        Obj       mX(&oa);  const Obj& X = mX;
+        Reference reference;
+
+        for (int i = 0; i < LENGTH; ++i) {
+            const ValueType VALUE = createValue(DATA[i], &sa);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                ASSERTV(i, verify(X, reference));
+
+                mX.insert(X.end(), VALUE);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            reference.insert(std::make_pair(DATA[i], -DATA[i]));
+            ASSERTV(i, verify(X, reference));
+        }
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+
+    for (int tp = 0; tp < e_NUM_PATTERNS; ++tp) {
+        const int              LENGTH = 100;
+        const std::vector<int> DATA   = makeSequence(tp, LENGTH);
+
+        std::vector<ValueType> values;
+        Reference              reference;
+        for (int i = 0; i < LENGTH; ++i) {
+            values.push_back(createValue(DATA[i], &sa));
+            if (LENGTH / 2 <= i) {
+                reference.insert(std::make_pair(DATA[i], -DATA[i]));
+            }
+        }
+
+        Obj       mX(values.begin() + LENGTH / 2, values.end(), COMPARATOR(),
+                     &oa);
+        const Obj& X = mX;
+
+        BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+            ASSERTV(tp, verify(X, reference));
+
+            mX.insert(values.begin(), values.begin() + LENGTH / 2);
+        } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+        for (int i = 0; i < LENGTH / 2; ++i) {
+            reference.insert(std::make_pair(DATA[i], -DATA[i]));
+        }
+        ASSERTV(tp, verify(X, reference));
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+}
+
+template <class KEY, class COMPARATOR>
+void TestDriver<KEY, COMPARATOR>::testCase5()
+{
+    // ------------------------------------------------------------------------
+    // LOOKUP
+    //
+    // Concerns:
+    //: 1 'find', 'count', 'contains', 'lower_bound', 'upper_bound' and
+    //:   'equal_range' return the results specified for keys that are
+    //:   present, absent, before the first key and after the last key.
+    //:
+    //: 2 The 'const' and non-'const' overloads return the same positions.
+    //:
+    //: 3 Lookup does not allocate memory.
+    //
+    // Plan:
+    //: 1 Populate maps of various sizes holding the even integers, and look
+    //:   up every integer in a range extending beyond either end, comparing
+    //:   with the results of the same operations on a reference.  (C-1..3)
+    //
+    // Testing:
+    //   iterator find(const key_type& key);
+    //   iterator lower_bound(const key_type& key);
+    //   iterator upper_bound(const key_type& key);
+    //   pair<iterator, iterator> equal_range(const key_type& key);
+    //   const_iterator find(const key_type& key) const;
+    //   size_type count(const key_type& key) const;
+    //   bool contains(const key_type& key) const;
+    //   const_iterator lower_bound(const key_type& key) const;
+    //   const_iterator upper_bound(const key_type& key) const;
+    //   pair<const_iter, const_iter> equal_range(const key_type&) const;
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        const int LENGTH = SIZES[ti];
+
+        Obj       mX(&oa);  const Obj& X = mX;
+        Reference reference;
+        for (int i = 0; i < LENGTH; ++i) {
+            mX.insert(X.end(), createValue(2 * i, &sa));
+            reference[2 * i] = -2 * i;
+        }
+        ASSERTV(LENGTH, verify(X, reference));
+
+        bslma::TestAllocatorMonitor oam(&oa);
+
+        for (int k = -2; k <= 2 * LENGTH + 1; ++k) {
+            const KEY K = Util::create(k, &sa);
+
+            Reference::const_iterator rfind  = reference.find(k);
+            Reference::const_iterator rlower = reference.lower_bound(k);
+            Reference::const_iterator rupper = reference.upper_bound(k);
+
+#define CHECK(ITER, RITER)                                                    \
+            ASSERTV(LENGTH, k, (ITER == X.end()) == (RITER == reference.end())\
+                           && (ITER == X.end()                                \
+                            || Util::toInt(ITER->first) == RITER->first))
+
+            ConstIterator cFind = X.find(K);
+            Iterator      mFind = mX.find(K);
+            CHECK(cFind, rfind);
+            ASSERTV(LENGTH, k, cFind == mFind);
+
+            ConstIterator cLower = X.lower_bound(K);
+            Iterator      mLower = mX.lower_bound(K);
+            CHECK(cLower, rlower);
+            ASSERTV(LENGTH, k, cLower == mLower);
+
+            ConstIterator cUpper = X.upper_bound(K);
+            Iterator      mUpper = mX.upper_bound(K);
+            CHECK(cUpper, rupper);
+            ASSERTV(LENGTH, k, cUpper == mUpper);
+#undef CHECK
+
+            bsl::pair<ConstIterator, ConstIterator> cRange =
+                                                             X.equal_range(K);
+            bsl::pair<Iterator, Iterator>           mRange =
+                                                            mX.equal_range(K);
+            ASSERTV(LENGTH, k, cLower == cRange.first);
+            ASSERTV(LENGTH, k, cUpper == cRange.second);
+            ASSERTV(LENGTH, k, cLower == mRange.first);
+            ASSERTV(LENGTH, k, cUpper == mRange.second);
+
+            ASSERTV(LENGTH, k, reference.count(k) == X.count(K));
+            ASSERTV(LENGTH, k, (1 == reference.count(k)) == X.contains(K));
+        }
+        ASSERTV(LENGTH, oam.isTotalSame());
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+}
+
+template <class KEY, class COMPARATOR>
+void TestDriver<KEY, COMPARATOR>::testCase6()
+{
+    // ------------------------------------------------------------------------
+    // ELEMENT ACCESS
+    //
+    // Concerns:
+    //: 1 'operator[]' returns a reference to the mapped value of an existing
+    //:   element, without allocating, and otherwise inserts an element having
+    //:   a default-constructed mapped value.
+    //:
+    //: 2 'at' returns a reference to the mapped value of an existing element,
+    //:   and otherwise throws 'std::out_of_range' without modifying the map.
+    //:
+    //: 3 'operator[]' provides the strong exception-safety guarantee.
+    //
+    // Plan:
+    //: 1 Using a map populated with the even integers, access every integer
+    //:   in a range using 'at' and 'operator[]', modify the mapped values,
+    //:   and verify the result against a reference.  (C-1..2)
+    //:
+    //: 2 Insert new keys using 'operator[]' under
+    //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*'.  (C-3)
+    //
+    // Testing:
+    //   VALUE& operator[](const key_type& key);
+    //   VALUE& at(const key_type& key);
+    //   const VALUE& at(const key_type& key) const;
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    const int LENGTH = 200;
+
+    Obj       mX(&oa);  const Obj& X = mX;
+    Reference reference;
+    for (int i = 0; i < LENGTH; ++i) {
+        mX.insert(X.end(), createValue(2 * i, &sa));
+        reference[2 * i] = -2 * i;
+    }
+
+    for (int k = 0; k < 2 * LENGTH; ++k) {
+        const KEY K = Util::create(k, &sa);
+
+        if (reference.count(k)) {
+            ASSERTV(k, -k == X.at(K).data());
+            ASSERTV(k, -k == mX.at(K).data());
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            ASSERTV(k, -k == mX[K].data());
+            ASSERTV(k, oam.isInUseSame());
+
+            mX.at(K) = AllocType(k, &sa);
+            reference[k] = k;
+        }
+        else {
+#if defined(BDE_BUILD_TARGET_EXC)
+            bool exceptionCaught = false;
+            try {
+                X.at(K);
+            }
+            catch (const std::out_of_range&) {
+                exceptionCaught = true;
+            }
+            ASSERTV(k, exceptionCaught);
+
+            exceptionCaught = false;
+            try {
+                mX.at(K);
+            }
+            catch (const std::out_of_range&) {
+                exceptionCaught = true;
+            }
+            ASSERTV(k, exceptionCaught);
+            ASSERTV(k, verify(X, reference));
+#endif
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                ASSERTV(k, verify(X, reference));
+
+                AllocType& mapped = mX[K];
+                ASSERTV(k, 0 == mapped.data());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            mX[K] = AllocType(-k, &sa);
+            reference[k] = -k;
+        }
+        ASSERTV(k, verify(X, reference));
+    }
+    ASSERT(2 * LENGTH == static_cast<int>(X.size()));
+}
+
+template <class KEY, class COMPARATOR>
+void TestDriver<KEY, COMPARATOR>::testCase7()
+{
+    // ------------------------------------------------------------------------
+    // COMPARISON OPERATORS
+    //
+    // Concerns:
+    //: 1 Two maps compare equal if and only if they hold the same key-value
+    //:   pairs, irrespective of their allocators or of how their elements
+    //:   were inserted.
+    //:
+    //: 2 The relational operators order maps lexicographically by their
+    //:   key-value pairs.
+    //
+    // Plan:
+    //: 1 For each pair of a set of maps, compare the results of every
+    //:   operator with those of the same operator on references.  Build the
+    //:   second map of each pair in descending order, using a different
+    //:   allocator.  (C-1..2)
+    //
+    // Testing:
+    //   bool operator==(const flat_map& lhs, const flat_map& rhs);
+    //   bool operator!=(const flat_map& lhs, const flat_map& rhs);
+    //   bool operator< (const flat_map& lhs, const flat_map& rhs);
+    //   bool operator> (const flat_map& lhs, const flat_map& rhs);
+    //   bool operator<=(const flat_map& lhs, const flat_map& rhs);
+    //   bool operator>=(const flat_map& lhs, const flat_map& rhs);
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    static const struct {
+        int         d_line;    // source line number
+        const char *d_spec_p;  // keys, as digits; an upper-case letter maps
+                               // its key to a different value
+    } DATA[] = {
+        //LINE  SPEC
+        //----  --------
+        { L_,   ""       },
+        { L_,   "1"      },
+        { L_,   "A"      },
+        { L_,   "12"     },
+        { L_,   "1B"     },
+        { L_,   "123"    },
+        { L_,   "13"     },
+        { L_,   "2"      },
+        { L_,   "0123456789" },
+        { L_,   "012345678"  },
+    };
+    const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int   LINE1 = DATA[ti].d_line;
+        const char *SPEC1 = DATA[ti].d_spec_p;
+
+        Obj       mX(&oa);  const Obj& X = mX;
+        Reference reference1;
+        for (const char *p = SPEC1; *p; ++p) {
+            const bool isUpper = 'A' <= *p && *p <= 'Z';
+            const int  key     = isUpper ? *p - 'A' + 1 : *p - '0';
+            const int  mapped  = isUpper ? key : -key;
+
+            mX.insert(ValueType(Util::create(key, &sa),
+                                AllocType(mapped, &sa),
+                                &sa));
+            reference1[key] = mapped;
+        }
+        ASSERTV(LINE1, verify(X, reference1));
+
+        for (int tj = 0; tj < NUM_DATA; ++tj) {
+            const int   LINE2 = DATA[tj].d_line;
+            const char *SPEC2 = DATA[tj].d_spec_p;
+            const int   LEN2  = static_cast<int>(strlen(SPEC2));
+
+            Obj       mY(&za);  const Obj& Y = mY;
+            Reference reference2;
+            for (int i = LEN2 - 1; i >= 0; --i) {
+                const char c       = SPEC2[i];
+                const bool isUpper = 'A' <= c && c <= 'Z';
+                const int  key     = isUpper ? c - 'A' + 1 : c - '0';
+                const int  mapped  = isUpper ? key : -key;
+
+                mY.insert(ValueType(Util::create(key, &sa),
+                                    AllocType(mapped, &sa),
+                                    &sa));
+                reference2[key] = mapped;
+            }
+
+            ASSERTV(LINE1, LINE2, (reference1 == reference2) == (X == Y));
+            ASSERTV(LINE1, LINE2, (reference1 != reference2) == (X != Y));
+            ASSERTV(LINE1, LINE2, (reference1 <  reference2) == (X <  Y));
+            ASSERTV(LINE1, LINE2, (reference1 >  reference2) == (X >  Y));
+            ASSERTV(LINE1, LINE2, (reference1 <= reference2) == (X <= Y));
+            ASSERTV(LINE1, LINE2, (reference1 >= reference2) == (X >= Y));
+            ASSERTV(LINE1, LINE2, (ti == tj) == (X == Y));
+        }
+    }
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 9: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Table of Currency Conversion Rates
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain the conversion rates of currencies to US dollars,
+// identified by their ISO codes.  The rates are loaded in a batch every
+// morning, and are then looked up for every trade, where the currency of the
+// trade is available as a 'bslstl::StringRef' into a message buffer.
+//
+// First, we define a transparent comparator that orders 'bsl::string' and
+// 'bslstl::StringRef' objects with one another:
+//..
+//  struct StringRefLess {
+//      ...
+//  };
+//..
+// Then, we load the morning's rates, in no particular order, into a map in a
+// single call to 'insert':
+//..
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+    typedef bsl::flat_map<bsl::string, double, StringRefLess> RateTable;
+    typedef RateTable::value_type                              Rate;
+
+    bsl::vector<Rate> batch(&oa);
+    batch.push_back(Rate("JPY", 0.0091));
+    batch.push_back(Rate("EUR", 1.08));
+    batch.push_back(Rate("GBP", 1.27));
+    batch.push_back(Rate("CHF", 1.12));
+
+    RateTable rates(&oa);
+    rates.insert(batch.begin(), batch.end());
+    ASSERT(4 == rates.size());
+//..
+// Next, we observe that the currencies are held in order, and that the keys
+// can be accessed as a contiguous sequence:
+//..
+    ASSERT("CHF" == rates.begin()->first);
+    ASSERT("JPY" == rates.keys().back());
+//..
+// Then, we convert the amounts of trades, looking up each currency without
+// creating a temporary 'bsl::string':
+//..
+    const char *message = "EUR:1000;GBP:250;AUD:400";
+
+    bslma::TestAllocatorMonitor oam(&oa);
+
+    RateTable::const_iterator it = rates.find(bslstl::StringRef(message, 3));
+    ASSERT(rates.end() != it);
+    ASSERT(1080.0      == 1000 * it->second);
+
+    ASSERT( rates.contains(bslstl::StringRef(message +  9, 3)));
+    ASSERT(!rates.contains(bslstl::StringRef(message + 17, 3)));
+
+    ASSERT(oam.isTotalSame());
+//..
+// Finally, we update the rate of one currency in place:
+//..
+    rates["EUR"] = 1.09;
+    ASSERT(1.09 == rates.at("EUR"));
+    ASSERT(4    == rates.size());
+//..
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // CAPACITY AND HETEROGENEOUS LOOKUP
+        //
+        // Concerns:
+        //: 1 'reserve' increases 'capacity' to at least the requested number
+        //:   of elements, and inserting elements up to that number allocates
+        //:   no memory.
+        //:
+        //: 2 'keys' and 'values' return the keys in order, and the values in
+        //:   the order of their keys.
+        //:
+        //: 3 When the comparator is transparent, the lookup methods accept a
+        //:   key of another type comparable with 'KEY', return the results
+        //:   of the corresponding methods taking a 'KEY', and allocate no
+        //:   memory.
+        //
+        // Plan:
+        //: 1 Reserve capacity in an empty map, insert elements up to that
+        //:   capacity, and verify that no memory is allocated.  (C-1)
+        //:
+        //: 2 Compare 'keys' and 'values' with the elements visited by
+        //:   iterating over the map.  (C-2)
+        //:
+        //: 3 Create a map keyed by 'bsl::string' ordered by a transparent
+        //:   comparator, and look up 'bslstl::StringRef' keys that are
+        //:   present, absent, and beyond either end of the map, comparing
+        //:   the results with lookups by 'bsl::string', and monitoring the
+        //:   allocators.  (C-3)
+        //
+        // Testing:
+        //   void reserve(size_type numElements);
+        //   size_type capacity() const;
+        //   const key_container_type& keys() const;
+        //   const mapped_container_type& values() const;
+        //   iterator find(const LOOKUP_KEY& key);
+        //   iterator lower_bound(const LOOKUP_KEY& key);
+        //   iterator upper_bound(const LOOKUP_KEY& key);
+        //   pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+        //   const_iterator find(const LOOKUP_KEY& key) const;
+        //   size_type count(const LOOKUP_KEY& key) const;
+        //   bool contains(const LOOKUP_KEY& key) const;
+        //   const_iterator lower_bound(const LOOKUP_KEY& key) const;
+        //   const_iterator upper_bound(const LOOKUP_KEY& key) const;
+        //   pair<const_iter, const_iter> equal_range(const LOOKUP_KEY&) const;
+        //   CONCERN: Lookup by a transparent comparator allocates no memory.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCAPACITY AND HETEROGENEOUS LOOKUP"
+                            "\n=================================\n");
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (veryVerbose) printf("\tCapacity.\n");
+        {
+            typedef bsl::flat_map<int, int> Obj;
+
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(0 == X.capacity());
+
+            mX.reserve(100);
+            ASSERT(100 <= X.capacity());
+            ASSERT(100 <= X.keys().capacity());
+            ASSERT(100 <= X.values().capacity());
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            for (int i = 0; i < 100; ++i) {
+                const int key = (i * 37) % 100;
+                mX[key] = -key;
+            }
+            ASSERT(100 == X.size());
+            ASSERT(oam.isTotalSame());
+
+            if (veryVerbose) printf("\tKeys and values.\n");
+
+            ASSERT(X.size() == X.keys().size());
+            ASSERT(X.size() == X.values().size());
+
+            int index = 0;
+            for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(index, index == X.keys()[index]);
+                ASSERTV(index, &(*it).first  == &X.keys()[index]);
+                ASSERTV(index, &(*it).second == &X.values()[index]);
+                ASSERTV(index, -index == X.values()[index]);
+                ++index;
+            }
+        }
+
+        if (veryVerbose) printf("\tHeterogeneous lookup.\n");
+        {
+            typedef bsl::flat_map<bsl::string, int, StringRefLess> Obj;
+
+            const char *WORDS[] = { "b", "d", "f", "h" };
+            const int   NUM_WORDS = sizeof WORDS / sizeof *WORDS;
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < NUM_WORDS; ++i) {
+                mX.insert(Obj::value_type(bsl::string(WORDS[i], &oa), i));
+            }
+
+            const char *KEYS[] = { "a", "b", "c", "d", "e", "f", "g", "h",
+                                   "i" };
+            const int   NUM_KEYS = sizeof KEYS / sizeof *KEYS;
+
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                const bsl::string       STRING(KEYS[i], &oa);
+                const bslstl::StringRef REF(KEYS[i]);
+
+                bslma::TestAllocatorMonitor dam(&da);
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                ASSERTV(i, X.find(STRING)         == X.find(REF));
+                ASSERTV(i, mX.find(STRING)        == mX.find(REF));
+                ASSERTV(i, X.count(STRING)        == X.count(REF));
+                ASSERTV(i, X.contains(STRING)     == X.contains(REF));
+                ASSERTV(i, X.lower_bound(STRING)  == X.lower_bound(REF));
+                ASSERTV(i, mX.lower_bound(STRING) == mX.lower_bound(REF));
+                ASSERTV(i, X.upper_bound(STRING)  == X.upper_bound(REF));
+                ASSERTV(i, mX.upper_bound(STRING) == mX.upper_bound(REF));
+                ASSERTV(i, X.equal_range(STRING)  == X.equal_range(REF));
+                ASSERTV(i, mX.equal_range(STRING) == mX.equal_range(REF));
+                ASSERTV(i, (i % 2 == 1) == X.contains(REF));
+
+                ASSERTV(i, dam.isTotalSame());
+                ASSERTV(i, oam.isTotalSame());
+            }
+        }
+        ASSERT(0 == da.numBlocksTotal());
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // COMPARISON OPERATORS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOMPARISON OPERATORS"
+                            "\n====================\n");
+
+        TestDriver<int,       std::less<int>       >::testCase7();
+        TestDriver<AllocType, DataLess<AllocType>  >::testCase7();
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // ELEMENT ACCESS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nELEMENT ACCESS"
+                            "\n==============\n");
+
+        TestDriver<int,       std::less<int>       >::testCase6();
+        TestDriver<AllocType, DataLess<AllocType>  >::testCase6();
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // LOOKUP
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP"
+                            "\n======\n");
+
+        TestDriver<int,       std::less<int>       >::testCase5();
+        TestDriver<AllocType, DataLess<AllocType>  >::testCase5();
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // INSERTION AND REMOVAL
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINSERTION AND REMOVAL"
+                            "\n=====================\n");
+
+        TestDriver<int,       std::less<int>       >::testCase4();
+        TestDriver<AllocType, DataLess<AllocType>  >::testCase4();
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // COPY CONSTRUCTION, ASSIGNMENT AND SWAP
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY CONSTRUCTION, ASSIGNMENT AND SWAP"
+                            "\n======================================\n");
+
+        TestDriver<int,       std::less<int>       >::testCase3();
+        TestDriver<AllocType, DataLess<AllocType>  >::testCase3();
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                            "\n========================================\n");
+
+        TestDriver<int,       std::less<int>       >::testCase2();
+        TestDriver<AllocType, DataLess<AllocType>  >::testCase2();
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Insert, look up, and erase values, in a map large enough to
+        //:   require several reallocations, and verify the results.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            typedef bsl::flat_map<int, int> Obj;
+
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(X.empty());
+
+            const int N = 10000;
+            for (int i = 0; i < N; ++i) {
+                const int key = (i * 7919) % N;
+                ASSERTV(i, mX.insert(Obj::value_type(key, -key)).second);
+            }
+            ASSERT(N == static_cast<int>(X.size()));
+
+            int expected = 0;
+            for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(expected, it->first, expected == it->first);
+                ASSERTV(expected, it->second, -expected == it->second);
+                ++expected;
+            }
+            ASSERT(N == expected);
+
+            Obj mY(X);  const Obj& Y = mY;
+            ASSERT(X == Y);
+
+            for (int i = 0; i < N; i += 2) {
+                ASSERTV(i, 1 == mX.erase(i));
+            }
+            ASSERT(N / 2 == static_cast<int>(X.size()));
+            ASSERT(X.end() == X.find(4));
+            ASSERT(-5      == X.find(5)->second);
+            ASSERT(X != Y);
+            ASSERT(Y <  X);
+
+            mX[4] = 44;
+            ASSERT(44 == X.at(4));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
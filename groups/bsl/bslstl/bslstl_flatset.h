@@ -0,0 +1,1644 @@
+// bslstl_flatset.h                                                   -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATSET
+#define INCLUDED_BSLSTL_FLATSET
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an STL-compliant set held in a sorted vector.
+//
+//@CLASSES:
+//   bsl::flat_set: STL-compliant ordered set held in contiguous storage
+//
+//@SEE_ALSO: bslstl_flatmap, bslstl_flatcontainerutil, bslstl_set
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::flat_set', implementing a container holding an ordered sequence of
+// unique keys (of a template parameter type, 'KEY').  'flat_set' provides the
+// interface of 'bsl::set', but holds its keys in a 'bsl::vector', in order,
+// rather than in a red-black tree having one node per element.
+//
+// An instantiation of 'flat_set' is an allocator-aware, value-semantic type
+// whose salient attributes are its size (number of keys) and the ordered
+// sequence of keys the set contains.  If 'flat_set' is instantiated with a
+// key type that is not itself value-semantic, then it will not retain all of
+// its value-semantic qualities.
+//
+///Choosing Between 'set' and 'flat_set'
+///-------------------------------------
+// A 'flat_set' allocates a single array for all of its keys, so it uses no
+// memory per element beyond the key itself, a lookup is a binary search over
+// contiguous memory, and an iteration touches each cache line once.  A set
+// that is populated once (or in large batches) and then searched many times
+// is best held in a 'flat_set'.
+//
+// In exchange, inserting or erasing a single element shifts every element
+// after it, so takes time linear in the size of the set, and invalidates all
+// iterators into the set, and all references and pointers to its elements.
+// The shift is performed by 'bsl::vector', which moves elements using
+// 'bslalg::ArrayPrimitives', so that elements of a bitwise-moveable type are
+// shifted by a single 'memmove'.  Elements of other types are shifted by
+// assignment, which cannot be undone if it throws, so, to provide the strong
+// exception-safety guarantee, an element of such a type is inserted (other
+// than at the end) by copying the set into a new vector that includes it.
+//
+// Inserting a range of elements (including by the range constructor) appends
+// the elements to the vector, sorts (the indices of) the appended elements
+// once, and merges them with the existing elements in a single pass (see
+// 'bslstl_flatcontainerutil'), so that inserting 'N' elements into a set of
+// 'n' elements takes O[N * log(N) + n] time, rather than O[N * n].  If the
+// range is ordered, and follows the last element of the set, no sort or
+// merge is performed.
+//
+// 'flat_set' does not provide node handles ('extract', and the 'insert'
+// overload taking a node handle), or 'merge'.
+//
+///Heterogeneous Lookup
+///--------------------
+// If the (template parameter) type 'COMPARATOR' is *transparent* (i.e.,
+// declares a nested type named 'is_transparent'), the 'find', 'count',
+// 'contains', 'lower_bound', 'upper_bound', and 'equal_range' methods of
+// 'flat_set' provide additional overloads that accept a key of any type that
+// 'COMPARATOR' can compare with an element.  These overloads do not convert
+// the supplied key to 'KEY', so, for example, a 'flat_set' keyed on
+// 'bsl::string' can be searched using a 'bslstl::StringRef' without
+// constructing (and allocating memory for) a temporary 'bsl::string'.
+//
+///Requirements on 'KEY'
+///---------------------
+// A 'flat_set' has the same requirements on its 'KEY' type as 'bsl::set'
+// (see {'bslstl_set'|Requirements on 'KEY'}).  In addition, since elements
+// are copied when the vector holding them grows, 'KEY' must be
+// "copy-constructible" and "copy-assignable".
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a set's 'ALLOCATOR' template parameter determines how
+// that set will allocate memory, exactly as for 'bsl::set' (see
+// {'bslstl_set'|Memory Allocation}).  The vector of keys, and every key, is
+// allocated using the allocator of the set.  Inserting a range of elements
+// that does not follow the last element of the set in order allocates a
+// temporary array of indices, and a new array of keys.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'flat_set':
+//..
+//  Legend
+//  ------
+//  'K'             - template parameter 'KEY' type of 'flat_set'
+//  'a', 'b'        - two distinct objects of type 'flat_set<K>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'c'             - comparator providing an ordering for objects of type 'K'
+//  'al             - an STL-style memory allocator
+//  'i1', 'i2'      - two iterators defining a sequence of 'K' objects
+//  'k'             - an object of type 'K'
+//  'p1', 'p2'      - two iterators belonging to 'a'
+//  distance(i1,i2) - the number of elements in the range [i1, i2)
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | flat_set<K> a;    (default construction)           | O[1]               |
+//  | flat_set<K> a(al);                                 |                    |
+//  | flat_set<K> a(c, al);                              |                    |
+//  +----------------------------------------------------+--------------------+
+//  | flat_set<K> a(b); (copy construction)              | O[m]               |
+//  | flat_set<K> a(b, al);                              |                    |
+//  +----------------------------------------------------+--------------------+
+//  | flat_set<K> a(i1, i2);                             | O[N] if [i1, i2)   |
+//  | flat_set<K> a(i1, i2, al);                         | is sorted with     |
+//  | flat_set<K> a(i1, i2, c, al);                      | 'a.value_comp()',  |
+//  |                                                    | O[N * log(N)]      |
+//  |                                                    | otherwise, where N |
+//  |                                                    | is distance(i1,i2) |
+//  +----------------------------------------------------+--------------------+
+//  | a.~flat_set<K>(); (destruction)                    | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a = b;            (assignment)                     | O[n + m]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.cbegin(), a.cend(),          | O[1]               |
+//  | a.rbegin(), a.rend(), a.crbegin(), a.crend()       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b                                     | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a < b, a <= b, a > b, a >= b                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a,b)                               | O[1] if 'a' and    |
+//  |                                                    | 'b' use the same   |
+//  |                                                    | allocator,         |
+//  |                                                    | O[n + m] otherwise |
+//  +----------------------------------------------------+--------------------+
+//  | a.size(), a.max_size(), a.empty(), a.capacity()    | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | get_allocator()                                    | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.reserve(k)                                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(k)                                        | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(p1, k)                                    | amortized O[1] if  |
+//  |                                                    | k is inserted      |
+//  |                                                    | right before p1 at |
+//  |                                                    | the end, O[n]      |
+//  |                                                    | otherwise          |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(i1, i2)                                   | O[N] if [i1, i2)   |
+//  |                                                    | follows the last   |
+//  |                                                    | element of 'a' in  |
+//  |                                                    | order, and         |
+//  |                                                    | O[N * log(N) + n]  |
+//  |                                                    | otherwise, where N |
+//  |                                                    | is distance(i1,i2) |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1), a.erase(k), a.erase(p1, p2)           | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.clear()                                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.key_comp(), a.value_comp()                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.contains(k), a.count(k), a.find(k)               | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.lower_bound(k), a.upper_bound(k),                | O[log(n)]          |
+//  | a.equal_range(k)                                   |                    |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Dictionary of Reserved Words
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose a parser needs to determine whether each identifier it reads is a
+// reserved word.  The set of reserved words is loaded once and searched for
+// every identifier, and the parser holds each identifier as a
+// 'bslstl::StringRef' into its input buffer.
+//
+// First, we define a transparent comparator that orders 'bsl::string' and
+// 'bslstl::StringRef' objects with one another:
+//..
+//  struct StringRefLess {
+//      // This 'struct' defines a transparent ordering of strings.
+//
+//      typedef void is_transparent;
+//
+//      bool operator()(const bslstl::StringRef& lhs,
+//                      const bslstl::StringRef& rhs) const
+//          // Return 'true' if the specified 'lhs' is ordered before the
+//          // specified 'rhs', and 'false' otherwise.
+//      {
+//          return lhs < rhs;
+//      }
+//  };
+//..
+// Then, we load the reserved words, in no particular order, into a set in a
+// single call to 'insert':
+//..
+//  bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+//
+//  typedef bsl::flat_set<bsl::string, StringRefLess> WordSet;
+//  WordSet reservedWords(&oa);
+//
+//  const char *WORDS[] = { "while", "if", "for", "return", "else", "do",
+//                          "if" };
+//  reservedWords.insert(WORDS, WORDS + sizeof WORDS / sizeof *WORDS);
+//  assert(6 == reservedWords.size());
+//..
+// Next, we observe that the words are held in order:
+//..
+//  assert("do"    == *reservedWords.begin());
+//  assert("while" == *reservedWords.rbegin());
+//..
+// Now, we look up identifiers held as 'bslstl::StringRef' objects, without
+// creating a temporary 'bsl::string' for each:
+//..
+//  const char *input = "if (count) return index;";
+//
+//  bslma::TestAllocatorMonitor oam(&oa);
+//
+//  assert( reservedWords.contains(bslstl::StringRef(input,      2)));
+//  assert(!reservedWords.contains(bslstl::StringRef(input +  4, 5)));
+//  assert( reservedWords.contains(bslstl::StringRef(input + 11, 6)));
+//  assert(!reservedWords.contains(bslstl::StringRef(input + 18, 5)));
+//..
+// Finally, we confirm that the lookups allocated no memory:
+//..
+//  assert(oam.isTotalSame());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_FLATCONTAINERUTIL
+#include <bslstl_flatcontainerutil.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_PAIR
+#include <bslstl_pair.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_VECTOR
+#include <bslstl_vector.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RANGECOMPARE
+#include <bslalg_rangecompare.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ENABLEIF
+#include <bslmf_enableif.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISTRANSPARENTPREDICATE
+#include <bslmf_istransparentpredicate.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_ALGORITHM
+#include <algorithm>
+#define INCLUDED_ALGORITHM
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                        // =========================
+                        // class FlatSet_TailProctor
+                        // =========================
+
+template <class CONTAINER>
+class FlatSet_TailProctor {
+    // This component-private class implements a proctor that, unless its
+    // 'release' method is called, erases, on destruction, the elements
+    // appended to a container after the proctor was created.
+
+    // DATA
+    CONTAINER   *d_container_p;  // container to truncate, or 0 if released
+    std::size_t  d_length;       // length to which to truncate
+
+  private:
+    // NOT IMPLEMENTED
+    FlatSet_TailProctor(const FlatSet_TailProctor&);
+    FlatSet_TailProctor& operator=(const FlatSet_TailProctor&);
+
+  public:
+    // CREATORS
+    explicit FlatSet_TailProctor(CONTAINER *container);
+        // Create a proctor that, on destruction, truncates the specified
+        // 'container' to its current length, unless 'release' is called.
+
+    ~FlatSet_TailProctor();
+        // Erase the elements following the first 'length()' elements of the
+        // managed container, if any.
+
+    // MANIPULATORS
+    void release();
+        // Release from management the container managed by this proctor.
+
+    // ACCESSORS
+    std::size_t length() const;
+        // Return the length of the managed container when this proctor was
+        // created.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                              // ==============
+                              // class flat_set
+                              // ==============
+
+template <class KEY,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = allocator<KEY> >
+class flat_set {
+    // This class template implements a value-semantic container type holding
+    // an ordered sequence of unique keys (of the template parameter type,
+    // 'KEY'), held in contiguous storage.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    // PRIVATE TYPES
+    typedef bsl::vector<KEY, ALLOCATOR> Container;
+        // This typedef is an alias for the type of the vector holding the
+        // keys.
+
+    typedef typename ALLOCATOR::template rebind<std::size_t>::other
+                                                                IndexAllocator;
+        // This typedef is an alias for the allocator of the vector used to
+        // compute the order of the keys resulting from inserting a range.
+
+    typedef bsl::vector<std::size_t, IndexAllocator>            IndexContainer;
+        // This typedef is an alias for the type of the vector used to compute
+        // the order of the keys resulting from inserting a range.
+
+    typedef typename bsl::allocator_traits<ALLOCATOR> AllocatorTraits;
+        // This typedef is an alias for the allocator traits type associated
+        // with this container.
+
+    // DATA
+    Container  d_keys;        // ordered keys
+    COMPARATOR d_comparator;  // key ordering
+
+    // PRIVATE MANIPULATORS
+    typename Container::const_iterator insertAt(std::size_t position,
+                                                const KEY&  key);
+        // Insert the specified 'key' at the specified 'position' in the array
+        // of keys, and return an iterator referring to the inserted key.  If
+        // an exception is thrown, this set is left unchanged.  The behavior is
+        // undefined unless 'position <= size()', 'key' is ordered after the
+        // key at 'position - 1' and before the key at 'position', and 'key'
+        // does not refer to an element of this set.
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                        key_type;
+    typedef KEY                                        value_type;
+    typedef COMPARATOR                                 key_compare;
+    typedef COMPARATOR                                 value_compare;
+    typedef ALLOCATOR                                  allocator_type;
+    typedef value_type&                                reference;
+    typedef const value_type&                          const_reference;
+
+    typedef typename AllocatorTraits::size_type        size_type;
+    typedef typename AllocatorTraits::difference_type  difference_type;
+    typedef typename AllocatorTraits::pointer          pointer;
+    typedef typename AllocatorTraits::const_pointer    const_pointer;
+
+    typedef typename Container::const_iterator         iterator;
+    typedef typename Container::const_iterator         const_iterator;
+    typedef bsl::reverse_iterator<iterator>            reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
+
+    // CREATORS
+    explicit flat_set(const COMPARATOR& comparator     = COMPARATOR(),
+                      const ALLOCATOR&  basicAllocator = ALLOCATOR())
+        // Construct an empty set.  Optionally specify a 'comparator' used to
+        // order keys contained in this object.  If 'comparator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'COMPARATOR' is used.  Optionally specify the 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the 'ALLOCATOR' is 'bsl::allocator' (the
+        // default), then 'basicAllocator', if supplied, shall be convertible
+        // to 'bslma::Allocator *'.  If the 'ALLOCATOR' is 'bsl::allocator'
+        // and 'basicAllocator' is not supplied, the currently installed
+        // default allocator will be used to supply memory.
+    : d_keys(basicAllocator)
+    , d_comparator(comparator)
+    {
+        // The implementation is placed here in the class definition to
+        // workaround an AIX compiler bug, where the constructor can fail to
+        // compile because it is unable to find the definition of the default
+        // argument.  This occurs when a templatized class wraps around the
+        // container and the comparator is defined after the new class.
+    }
+
+    explicit flat_set(const ALLOCATOR& basicAllocator);
+        // Construct an empty set that will use the specified 'basicAllocator'
+        // to supply memory.  Use a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' to order the keys contained in this
+        // set.  If the (template parameter) type 'ALLOCATOR' is of
+        // 'bsl::allocator' (the default) then 'basicAllocator' shall be
+        // convertible to 'bslma::Allocator *'.
+
+    flat_set(const flat_set& original);
+        // Construct a set having the same value as the specified 'original'.
+        // Use a copy of 'original.key_comp()' to order the keys contained in
+        // this set.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // allocate memory.  If the (template parameter) type 'ALLOCATOR' is of
+        // type 'bsl::allocator' (the default), the currently installed default
+        // allocator will be used to supply memory.
+
+    flat_set(const flat_set& original, const ALLOCATOR& basicAllocator);
+        // Construct a set having the same value as that of the specified
+        // 'original' that will use the specified 'basicAllocator' to supply
+        // memory.  Use a copy of 'original.key_comp()' to order the keys
+        // contained in this set.  If the (template parameter) type
+        // 'ALLOCATOR' is 'bsl::allocator' (the default) then 'basicAllocator'
+        // shall be convertible to 'bslma::Allocator *'.
+
+    template <class INPUT_ITERATOR>
+    flat_set(INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator     = COMPARATOR(),
+             const ALLOCATOR&  basicAllocator = ALLOCATOR());
+        // Construct a set, and insert each 'value_type' object in the sequence
+        // starting at the specified 'first' element, and ending immediately
+        // before the specified 'last' element, ignoring those keys that
+        // appear earlier in the sequence.  Optionally specify a 'comparator'
+        // used to order keys contained in this object.  If 'comparator' is
+        // not supplied, a default-constructed object of the (template
+        // parameter) type 'COMPARATOR' is used.  Optionally specify the
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'ALLOCATOR' is used.  If the type 'ALLOCATOR' is
+        // 'bsl::allocator' (the default) then 'basicAllocator', if supplied,
+        // shall be convertible to 'bslma::Allocator *'.  If the sequence
+        // 'first' and 'last' is ordered according to the identified
+        // 'comparator' then this operation will have O[N] complexity, where N
+        // is the number of elements between 'first' and 'last', otherwise
+        // this operation will have O[N * log(N)] complexity.  The (template
+        // parameter) type 'INPUT_ITERATOR' shall meet the requirements of an
+        // input iterator defined in the C++11 standard [24.2.3] providing
+        // access to values of a type convertible to 'value_type'.  The
+        // behavior is undefined unless 'first' and 'last' refer to a sequence
+        // of valid values where 'first' is at a position at or before 'last'.
+
+    ~flat_set();
+        // Destroy this object.
+
+    // MANIPULATORS
+    flat_set& operator=(const flat_set& rhs);
+        // Assign to this object the value and comparator of the specified
+        // 'rhs' object, propagate to this object the allocator of 'rhs' if the
+        // 'ALLOCATOR' type has trait 'propagate_on_container_copy_assignment',
+        // and return a reference providing modifiable access to this object.
+
+    iterator begin();
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this set, or the 'end' iterator if this set is empty.
+
+    iterator end();
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type' objects
+        // maintained by this set.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this set, or 'rend' if this set is empty.
+
+    reverse_iterator rend();
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this set.
+
+    pair<iterator, bool> insert(const value_type& value);
+        // Insert the specified 'value' into this set if a key equivalent to
+        // 'value' does not already exist in this set; otherwise, if a key
+        // equivalent to 'value' (according to the comparator provided at
+        // construction) already exists in this set, this method has no
+        // effect.  Return a pair whose 'first' member is an iterator referring
+        // to the (possibly newly inserted) 'value_type' object in this set
+        // that is equivalent to 'value', and whose 'second' member is 'true'
+        // if a new value was inserted, and 'false' if the value was already
+        // present.  If a value is inserted, all other iterators into this set
+        // are invalidated.
+
+    iterator insert(const_iterator hint, const value_type& value);
+        // Insert the specified 'value' into this set, immediately before the
+        // specified 'hint' if 'hint' is a valid immediate successor to
+        // 'value', if a key equivalent to 'value' does not already exist in
+        // this set; otherwise, this method has no effect.  Return an iterator
+        // referring to the (possibly newly inserted) 'value_type' object in
+        // this set that is equivalent to 'value'.  If 'hint' is not a valid
+        // immediate successor to 'value', the position of 'value' is found by
+        // a binary search.  If a value is inserted, all other iterators into
+        // this set are invalidated.  The behavior is undefined unless 'hint'
+        // is a valid iterator into this set.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set the value of each 'value_type' object in the
+        // range starting at the specified 'first' iterator and ending
+        // immediately before the specified 'last' iterator, if a key
+        // equivalent to the object is neither already contained in this set
+        // nor appears earlier in the range.  The elements of the range are
+        // appended to this set, then sorted and merged with the existing
+        // elements in a single pass (see {Choosing Between 'set' and
+        // 'flat_set'}).  If an exception is thrown, this set is left
+        // unchanged.  The (template parameter) type 'INPUT_ITERATOR' shall
+        // meet the requirements of an input iterator defined in the C++11
+        // standard [24.2.3] providing access to values of a type convertible
+        // to 'value_type'.  The behavior is undefined unless 'first' and
+        // 'last' refer to a sequence of valid values where 'first' is at a
+        // position at or before 'last', and the sequence does not refer to
+        // elements of this set.
+
+    iterator erase(const_iterator position);
+        // Remove from this set the 'value_type' object at the specified
+        // 'position', and return an iterator referring to the element
+        // immediately following the removed element, or to the past-the-end
+        // position if the removed element was the last in the sequence.  All
+        // other iterators into this set are invalidated.  The behavior is
+        // undefined unless 'position' refers to a 'value_type' object in this
+        // set.
+
+    size_type erase(const key_type& key);
+        // Remove from this set the 'value_type' object equivalent to the
+        // specified 'key', if it exists, and return 1; otherwise, if there is
+        // no 'value_type' object equivalent to 'key', return 0 with no other
+        // effect.  If an element is removed, all iterators into this set are
+        // invalidated.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this set the 'value_type' objects starting at the
+        // specified 'first' position up to, but not including the specified
+        // 'last' position, and return an iterator referring to the element
+        // following the last removed element.  All other iterators into this
+        // set are invalidated.  The behavior is undefined unless 'first' and
+        // 'last' either refer to elements in this set or are the 'end'
+        // iterator, and the 'first' position is at or before the 'last'
+        // position in the ordered sequence provided by this container.
+
+    void swap(flat_set& other);
+        // Exchange the value and comparator of this object with those of the
+        // specified 'other' object; also exchange the allocator of this object
+        // with that of 'other' if the (template parameter) type 'ALLOCATOR'
+        // has the 'propagate_on_container_swap' trait, and do not modify
+        // either allocator otherwise.  This method provides the no-throw
+        // exception-safety guarantee if the allocators are exchanged or are
+        // equal, and provides the basic exception-safety guarantee (by
+        // exchanging copies of the two sets) otherwise.
+
+    void clear();
+        // Remove all entries from this set.  Note that the set is empty after
+        // this call, but allocated memory may be retained for future use.
+
+    void reserve(size_type numElements);
+        // Change the capacity of this set to at least the specified
+        // 'numElements', so that inserting elements into this set until its
+        // size is 'numElements' allocates no memory.
+
+    iterator find(const key_type& key);
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this set equivalent to the specified 'key',
+        // if such an entry exists, and the past-the-end ('end') iterator
+        // otherwise.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this set equivalent to the specified 'key',
+        // if such an entry exists, and the past-the-end ('end') iterator
+        // otherwise.  This method does not participate in overload
+        // resolution unless 'COMPARATOR' is transparent (see {Heterogeneous
+        // Lookup}).
+    {
+        const_iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, *it) ? it : end();
+    }
+
+    iterator lower_bound(const key_type& key);
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this set greater-than
+        // or equal-to the specified 'key', and the past-the-end iterator if
+        // this set does not contain a 'value_type' object greater-than or
+        // equal-to 'key'.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    lower_bound(const LOOKUP_KEY& key)
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this set that is not
+        // ordered before the specified 'key', and the past-the-end iterator
+        // if no such object exists.  This method does not participate in
+        // overload resolution unless 'COMPARATOR' is transparent (see
+        // {Heterogeneous Lookup}).
+    {
+        return std::lower_bound(d_keys.begin(),
+                                d_keys.end(),
+                                key,
+                                d_comparator);
+    }
+
+    iterator upper_bound(const key_type& key);
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this set greater than
+        // the specified 'key', and the past-the-end iterator if this set does
+        // not contain a 'value_type' object greater-than 'key'.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    upper_bound(const LOOKUP_KEY& key)
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this set that is
+        // ordered after the specified 'key', and the past-the-end iterator if
+        // no such object exists.  This method does not participate in
+        // overload resolution unless 'COMPARATOR' is transparent (see
+        // {Heterogeneous Lookup}).
+    {
+        return std::upper_bound(d_keys.begin(),
+                                d_keys.end(),
+                                key,
+                                d_comparator);
+    }
+
+    pair<iterator, iterator> equal_range(const key_type& key);
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this set equivalent to the
+        // specified 'key', where the the first iterator is positioned at the
+        // start of the sequence, and the second is positioned one past the
+        // end of the sequence.  If this set contains no 'value_type' objects
+        // equivalent to 'key', then the two returned iterators will have the
+        // same value.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this set equivalent to the
+        // specified 'key', where the the first iterator is positioned at the
+        // start of the sequence, and the second is positioned one past the
+        // end of the sequence.  This method does not participate in overload
+        // resolution unless 'COMPARATOR' is transparent (see {Heterogeneous
+        // Lookup}).  Note that, unlike 'equal_range(const key_type&)', the
+        // returned sequence may contain more than one element if
+        // 'COMPARATOR' treats several keys as equivalent to 'key'.
+    {
+        return std::equal_range(d_keys.begin(),
+                                d_keys.end(),
+                                key,
+                                d_comparator);
+    }
+
+    // ACCESSORS
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // set.
+
+    const_iterator begin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this set, or the 'end' iterator if this set is empty.
+
+    const_iterator end() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type'
+        // objects maintained by this set.
+
+    const_reverse_iterator rbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this set, or 'rend' if this set is empty.
+
+    const_reverse_iterator rend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this set.
+
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in the ordered sequence of 'value_type' objects
+        // maintained by this set, or the 'cend' iterator if this set is empty.
+
+    const_iterator cend() const;
+        // Return an iterator providing non-modifiable access to the
+        // past-the-end element in the ordered sequence of 'value_type' objects
+        // maintained by this set.
+
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last 'value_type' object in the ordered sequence of 'value_type'
+        // objects maintained by this set, or 'crend' if this set is empty.
+
+    const_reverse_iterator crend() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // prior-to-the-beginning element in the ordered sequence of
+        // 'value_type' objects maintained by this set.
+
+    bool empty() const;
+        // Return 'true' if this set contains no elements, and 'false'
+        // otherwise.
+
+    size_type size() const;
+        // Return the number of elements in this set.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this set could possibly hold.  Note that there is no guarantee
+        // that the set can successfully grow to the returned size, or even
+        // close to that size without running out of resources.
+
+    size_type capacity() const;
+        // Return the number of elements this set can hold without allocating
+        // memory.
+
+    key_compare key_comp() const;
+        // Return the key-comparison functor (or function pointer) used by this
+        // set; if a comparator was supplied at construction, return its value,
+        // otherwise return a default constructed 'key_compare' object.
+
+    value_compare value_comp() const;
+        // Return the value-comparison functor (or function pointer) used by
+        // this set, which is the same as 'key_comp()'.
+
+    const_iterator find(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this set equivalent to the specified 'key',
+        // if such an entry exists, and the past-the-end ('end') iterator
+        // otherwise.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this set equivalent to the specified 'key',
+        // if such an entry exists, and the past-the-end ('end') iterator
+        // otherwise.  This method does not participate in overload
+        // resolution unless 'COMPARATOR' is transparent (see {Heterogeneous
+        // Lookup}).
+    {
+        const_iterator it = lower_bound(key);
+        return it != end() && !d_comparator(key, *it) ? it : end();
+    }
+
+    size_type count(const key_type& key) const;
+        // Return the number of 'value_type' objects within this set equivalent
+        // to the specified 'key'.  Note that since a set maintains unique
+        // keys, the returned value will be either 0 or 1.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of 'value_type' objects within this set
+        // equivalent to the specified 'key'.  This method does not
+        // participate in overload resolution unless 'COMPARATOR' is
+        // transparent (see {Heterogeneous Lookup}).
+    {
+        pair<const_iterator, const_iterator> range = equal_range(key);
+        return static_cast<size_type>(range.second - range.first);
+    }
+
+    bool contains(const key_type& key) const;
+        // Return 'true' if this set contains a 'value_type' object equivalent
+        // to the specified 'key', and 'false' otherwise.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this set contains a 'value_type' object equivalent
+        // to the specified 'key', and 'false' otherwise.  This method does
+        // not participate in overload resolution unless 'COMPARATOR' is
+        // transparent (see {Heterogeneous Lookup}).
+    {
+        return find(key) != end();
+    }
+
+    const_iterator lower_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this set greater-than
+        // or equal-to the specified 'key', and the past-the-end iterator if
+        // this set does not contain a 'value_type' object greater-than or
+        // equal-to 'key'.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    lower_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this set that is not
+        // ordered before the specified 'key', and the past-the-end iterator
+        // if no such object exists.  This method does not participate in
+        // overload resolution unless 'COMPARATOR' is transparent (see
+        // {Heterogeneous Lookup}).
+    {
+        return std::lower_bound(d_keys.begin(),
+                                d_keys.end(),
+                                key,
+                                d_comparator);
+    }
+
+    const_iterator upper_bound(const key_type& key) const;
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this set greater than
+        // the specified 'key', and the past-the-end iterator if this set does
+        // not contain a 'value_type' object greater-than 'key'.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    upper_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this set that is
+        // ordered after the specified 'key', and the past-the-end iterator if
+        // no such object exists.  This method does not participate in
+        // overload resolution unless 'COMPARATOR' is transparent (see
+        // {Heterogeneous Lookup}).
+    {
+        return std::upper_bound(d_keys.begin(),
+                                d_keys.end(),
+                                key,
+                                d_comparator);
+    }
+
+    pair<const_iterator, const_iterator> equal_range(const key_type& key)
+                                                                         const;
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this set equivalent to the
+        // specified 'key', where the the first iterator is positioned at the
+        // start of the sequence, and the second is positioned one past the
+        // end of the sequence.  If this set contains no 'value_type' objects
+        // equivalent to 'key', then the two returned iterators will have the
+        // same value.
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this set equivalent to the
+        // specified 'key', where the the first iterator is positioned at the
+        // start of the sequence, and the second is positioned one past the
+        // end of the sequence.  This method does not participate in overload
+        // resolution unless 'COMPARATOR' is transparent (see {Heterogeneous
+        // Lookup}).
+    {
+        return std::equal_range(d_keys.begin(),
+                                d_keys.end(),
+                                key,
+                                d_comparator);
+    }
+};
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator==(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'flat_set' objects have the same
+    // value if they have the same number of keys, and each key that is
+    // contained in one of the objects is also contained in the other object.
+    // This method requires that the (template parameter) type 'KEY' be
+    // "equality-comparable" (see {Requirements on 'KEY'}).
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'flat_set' objects do not have
+    // the same value if they do not have the same number of keys, or some key
+    // that is contained in one of the objects is not also contained in the
+    // other object.  This method requires that the (template parameter) type
+    // 'KEY' be "equality-comparable" (see {Requirements on 'KEY'}).
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' value is less than the specified
+    // 'rhs' value, and 'false' otherwise.  A set, 'lhs', has a value that is
+    // less than that of 'rhs', if, for the first non-equal corresponding key
+    // in their respective sequences, the 'lhs' key is less than the 'rhs' key,
+    // or, if all of their corresponding keys compare equal, 'lhs' has fewer
+    // keys than 'rhs'.  This method requires that the (template parameter)
+    // type 'KEY' be "less-than-comparable" (see {Requirements on 'KEY'}).
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' value is greater than the specified
+    // 'rhs' value, and 'false' otherwise.  A set, 'lhs', has a value that is
+    // greater than that of 'rhs', if, for the first non-equal corresponding
+    // key in their respective sequences, the 'lhs' key is greater than the
+    // 'rhs' key, or, if all of their corresponding keys compare equal, 'lhs'
+    // has more keys than 'rhs'.  This method requires that the (template
+    // parameter) type 'KEY' be "less-than-comparable" (see {Requirements on
+    // 'KEY'}).
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' value is less-than or equal-to the
+    // specified 'rhs' value, and 'false' otherwise.  A set, 'lhs', has a value
+    // that is less-than or equal-to that of 'rhs', if, for the first non-equal
+    // corresponding key in their respective sequences, the 'lhs' key is less
+    // than the 'rhs' key, or, if all of their corresponding keys compare
+    // equal, 'lhs' has less-than or equal number of keys as 'rhs'.  This
+    // method requires that the (template parameter) type 'KEY' be
+    // "less-than-comparable" (see {Requirements on 'KEY'}).
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' value is greater-than or equal-to
+    // the specified 'rhs' value, and 'false' otherwise.  A set, 'lhs', has a
+    // value that is greater-than or equal-to that of 'rhs', if, for the first
+    // non-equal corresponding key in their respective sequences, the 'lhs' key
+    // is greater than the 'rhs' key, or, if all of their corresponding keys
+    // compare equal, 'lhs' has greater-than or equal number of keys as 'rhs'.
+    // This method requires that the (template parameter) type 'KEY' be
+    // "less-than-comparable" (see {Requirements on 'KEY'}).
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void swap(flat_set<KEY, COMPARATOR, ALLOCATOR>& a,
+          flat_set<KEY, COMPARATOR, ALLOCATOR>& b);
+    // Swap both the value and the comparator of the specified 'a' object with
+    // the value and comparator of the specified 'b' object.  Additionally if
+    // 'bslstl::AllocatorTraits<ALLOCATOR>::propagate_on_container_swap' is
+    // 'true' then exchange the allocator of 'a' with that of 'b', and do not
+    // modify either allocator otherwise.  This method provides the no-throw
+    // exception-safety guarantee and guarantees O[1] complexity if the
+    // allocators are exchanged or are equal.
+
+}  // close namespace bsl
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+namespace BloombergLP {
+namespace bslstl {
+
+                        // -------------------------
+                        // class FlatSet_TailProctor
+                        // -------------------------
+
+// CREATORS
+template <class CONTAINER>
+inline
+FlatSet_TailProctor<CONTAINER>::FlatSet_TailProctor(CONTAINER *container)
+: d_container_p(container)
+, d_length(container->size())
+{
+}
+
+template <class CONTAINER>
+inline
+FlatSet_TailProctor<CONTAINER>::~FlatSet_TailProctor()
+{
+    if (d_container_p) {
+        d_container_p->erase(d_container_p->begin() + d_length,
+                             d_container_p->end());
+    }
+}
+
+// MANIPULATORS
+template <class CONTAINER>
+inline
+void FlatSet_TailProctor<CONTAINER>::release()
+{
+    d_container_p = 0;
+}
+
+// ACCESSORS
+template <class CONTAINER>
+inline
+std::size_t FlatSet_TailProctor<CONTAINER>::length() const
+{
+    return d_length;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                              // --------------
+                              // class flat_set
+                              // --------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+typename bsl::vector<KEY, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::insertAt(std::size_t position,
+                                               const KEY&  key)
+{
+    // Insert in place only if doing so provides the strong guarantee (see
+    // 'bslstl_flatcontainerutil'), having first grown the vector (which, if
+    // it throws, leaves the vector unchanged), since 'bsl::vector' does not
+    // restore the vector if copying an element into newly allocated storage
+    // throws.  Otherwise, build a copy including 'key', and swap it in.
+
+    if (position == d_keys.size()
+     || BloombergLP::bslmf::IsBitwiseMoveable<KEY>::value) {
+        if (d_keys.size() == d_keys.capacity()) {
+            d_keys.reserve(d_keys.empty() ? 1 : 2 * d_keys.size());
+        }
+        return d_keys.insert(d_keys.begin() + position, key);         // RETURN
+    }
+
+    Container keys(d_keys.get_allocator());
+    BloombergLP::bslstl::FlatContainerUtil::copyWithInsert(&keys,
+                                                            d_keys,
+                                                            position,
+                                                            key);
+    d_keys.swap(keys);
+    return d_keys.begin() + position;
+}
+
+// CREATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(const ALLOCATOR& basicAllocator)
+: d_keys(basicAllocator)
+, d_comparator()
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(const flat_set& original)
+: d_keys(original.d_keys,
+         AllocatorTraits::select_on_container_copy_construction(
+                                                 original.get_allocator()))
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                              const flat_set&  original,
+                                              const ALLOCATOR& basicAllocator)
+: d_keys(original.d_keys, basicAllocator)
+, d_comparator(original.d_comparator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              const COMPARATOR& comparator,
+                                              const ALLOCATOR&  basicAllocator)
+: d_keys(basicAllocator)
+, d_comparator(comparator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::~flat_set()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>&
+flat_set<KEY, COMPARATOR, ALLOCATOR>::operator=(const flat_set& rhs)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(this != &rhs)) {
+        d_keys       = rhs.d_keys;
+        d_comparator = rhs.d_comparator;
+    }
+    return *this;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::begin()
+{
+    return d_keys.begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::end()
+{
+    return d_keys.end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bsl::pair<typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    const_iterator it = lower_bound(value);
+    if (it != end() && !d_comparator(value, *it)) {
+        return bsl::pair<iterator, bool>(it, false);                  // RETURN
+    }
+    return bsl::pair<iterator, bool>(insertAt(it - begin(), value), true);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
+                                             const value_type& value)
+{
+    BSLS_ASSERT_SAFE(begin() <= hint);
+    BSLS_ASSERT_SAFE(hint    <= end());
+
+    if ((hint == end()   || d_comparator(value, *hint))
+     && (hint == begin() || d_comparator(*(hint - 1), value))) {
+        return insertAt(hint - begin(), value);                       // RETURN
+    }
+    return insert(value).first;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    // Append the range, then sort and merge the appended keys with the
+    // existing keys in one pass (see 'bslstl_flatcontainerutil').  The proctor
+    // removes the appended keys if an exception is thrown.
+
+    BloombergLP::bslstl::FlatSet_TailProctor<Container> proctor(&d_keys);
+
+    for (; first != last; ++first) {
+        d_keys.push_back(*first);
+    }
+
+    IndexContainer order(d_keys.get_allocator());
+    if (BloombergLP::bslstl::FlatContainerUtil::mergeOrder(&order,
+                                                            d_keys,
+                                                            proctor.length(),
+                                                            d_comparator)) {
+        Container keys(d_keys.get_allocator());
+        BloombergLP::bslstl::FlatContainerUtil::gather(&keys, d_keys, order);
+        d_keys.swap(keys);
+    }
+    proctor.release();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_keys.erase(d_keys.begin() + (position - begin()));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const_iterator it = find(key);
+    if (it == end()) {
+        return 0;                                                     // RETURN
+    }
+    erase(it);
+    return 1;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                            const_iterator last)
+{
+    return d_keys.erase(d_keys.begin() + (first - begin()),
+                        d_keys.begin() + (last  - begin()));
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::swap(flat_set& other)
+{
+    // 'vector::swap' exchanges copies if the allocators are not equal.
+
+    d_keys.swap(other.d_keys);
+
+    using std::swap;
+    swap(d_comparator, other.d_comparator);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::clear()
+{
+    d_keys.clear();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::reserve(size_type numElements)
+{
+    d_keys.reserve(numElements);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::find(const key_type& key)
+{
+    const_iterator it = lower_bound(key);
+    return it != end() && !d_comparator(key, *it) ? it : end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::lower_bound(const key_type& key)
+{
+    return std::lower_bound(d_keys.begin(), d_keys.end(), key, d_comparator);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::upper_bound(const key_type& key)
+{
+    return std::upper_bound(d_keys.begin(), d_keys.end(), key, d_comparator);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator,
+          typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator>
+flat_set<KEY, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key)
+{
+    iterator startIt = lower_bound(key);
+    iterator endIt   = startIt;
+    if (endIt != end() && !d_comparator(key, *endIt)) {
+        ++endIt;
+    }
+    return bsl::pair<iterator, iterator>(startIt, endIt);
+}
+
+// ACCESSORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::allocator_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return d_keys.get_allocator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::begin() const
+{
+    return d_keys.begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::end() const
+{
+    return d_keys.end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::cbegin() const
+{
+    return begin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::cend() const
+{
+    return end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::crbegin() const
+{
+    return rbegin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::crend() const
+{
+    return rend();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_set<KEY, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return d_keys.empty();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_keys.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::max_size() const
+{
+    return d_keys.max_size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::capacity() const
+{
+    return d_keys.capacity();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::key_compare
+flat_set<KEY, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_comparator;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::value_compare
+flat_set<KEY, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return key_comp();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    const_iterator it = lower_bound(key);
+    return it != end() && !d_comparator(key, *it) ? it : end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return contains(key) ? 1 : 0;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool
+flat_set<KEY, COMPARATOR, ALLOCATOR>::contains(const key_type& key) const
+{
+    return find(key) != end();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::lower_bound(const key_type& key) const
+{
+    return std::lower_bound(d_keys.begin(), d_keys.end(), key, d_comparator);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::upper_bound(const key_type& key) const
+{
+    return std::upper_bound(d_keys.begin(), d_keys.end(), key, d_comparator);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bsl::pair<typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator,
+          typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator>
+flat_set<KEY, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key) const
+{
+    const_iterator startIt = lower_bound(key);
+    const_iterator endIt   = startIt;
+    if (endIt != end() && !d_comparator(key, *endIt)) {
+        ++endIt;
+    }
+    return bsl::pair<const_iterator, const_iterator>(startIt, endIt);
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void bsl::swap(bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& a,
+               bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for STL *ordered* containers:
+//: o An ordered container defines STL iterators.
+//: o An ordered container uses 'bslma' allocators if the parameterized
+//:     'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_set<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::flat_set<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -1914,6 +1914,15 @@ class HashTable {
     typedef bslalg::BidirectionalNode<ValueType>   NodeType;
     typedef typename AllocatorTraits::size_type    SizeType;
 
+    typedef BidirectionalNodePool<
+                       ValueType,
+                       typename AllocatorTraits::template rebind_traits<
+                                        NodeType>::allocator_type> NodeFactory;
+        // This 'typedef' is an alias for the type of the pool that supplies
+        // the nodes of this hash table.  Note that this type is needed to
+        // define the type of node handles (see 'bslstl_nodehandle') that own
+        // elements extracted from this hash table.
+
   private:
     // PRIVATE TYPES
     typedef
@@ -2095,6 +2104,15 @@ class HashTable {
         // requirements might simplify in the future, if the standard is
         // updated.
 
+    template <class NODE_HANDLE>
+    NODE_HANDLE extract(bslalg::BidirectionalLink *node);
+        // Remove the specified 'node' from this hash-table without destroying
+        // it, and return an object of the (template parameter) type
+        // 'NODE_HANDLE' that owns the node.  The behavior is undefined unless
+        // 'node' refers to a node in this hash-table, and 'NODE_HANDLE' is a
+        // 'bslstl::NodeHandle' (or a class derived from it) for 'NodeFactory'
+        // and 'ALLOCATOR'.
+
     template <class SOURCE_TYPE>
     bslalg::BidirectionalLink *insert(const SOURCE_TYPE& value);
         // Insert the specified 'value' into this hash-table, and return the
@@ -2157,6 +2175,49 @@ class HashTable {
         // number of buckets larger than can be represented by this hash
         // table's 'SizeType', a 'std::length_error' exception will be thrown.
 
+    template <class NODE_HANDLE>
+    bslalg::BidirectionalLink *insertNode(const NODE_HANDLE& node);
+        // Insert the node owned by the specified 'node' handle into this
+        // hash-table, leave 'node' empty, and return the address of the
+        // inserted node.  If this hash-table already contains an element
+        // having the same key as the node (according to this hash-table's
+        // 'comparator') then insert the node immediately before the first
+        // element having the same key.  The node is relinked, rather than
+        // copied, if the allocator of 'node' compares equal to that of this
+        // hash-table.  Additional buckets will be allocated, as needed, to
+        // preserve the invariant 'loadFactor <= maxLoadFactor'.  The behavior
+        // is undefined unless 'node' is not empty.
+
+    template <class NODE_HANDLE>
+    bslalg::BidirectionalLink *insertNode(const NODE_HANDLE&         node,
+                                          bslalg::BidirectionalLink *hint);
+        // Insert the node owned by the specified 'node' handle into this
+        // hash-table, leave 'node' empty, and return the address of the
+        // inserted node.  If the element stored in the node pointed to by the
+        // specified 'hint' has a key that compares equal to that of the node,
+        // then the node is inserted immediately preceding 'hint'.  The node
+        // is relinked, rather than copied, if the allocator of 'node' compares
+        // equal to that of this hash-table.  Additional buckets will be
+        // allocated, as needed, to preserve the invariant
+        // 'loadFactor <= maxLoadFactor'.  The behavior is undefined unless
+        // 'node' is not empty and 'hint' points to a node in this hash-table.
+
+    template <class NODE_HANDLE>
+    bslalg::BidirectionalLink *insertNodeIfMissing(
+                                            bool               *isInsertedFlag,
+                                            const NODE_HANDLE&  node);
+        // Return the address of an element in this hash-table having a key
+        // that compares equal to the key of the node owned by the specified
+        // 'node' handle.  If no such element exists, insert the node into
+        // this hash-table, leave 'node' empty, and return the address of the
+        // inserted node; otherwise leave 'node' unchanged.  Load 'true' into
+        // the specified 'isInsertedFlag' if insertion is performed, and
+        // 'false' otherwise.  The node is relinked, rather than copied, if
+        // the allocator of 'node' compares equal to that of this hash-table.
+        // Additional buckets will be allocated, as needed, to preserve the
+        // invariant 'loadFactor <= maxLoadFactor'.  The behavior is undefined
+        // unless 'node' is not empty.
+
     void rehashForNumBuckets(SizeType newNumBuckets);
         // Re-organize this hash-table to have at least the specified
         // 'newNumBuckets', preserving the invariant
@@ -2184,6 +2245,18 @@ class HashTable {
         // retained for future use.  The destructor of each (non-trivial)
         // element that is remove shall be run.
 
+    void compact();
+        // Reallocate every node of this hash-table contiguously, in iteration
+        // order, from a single new chunk of memory supplied by the node
+        // factory's allocator, and release the memory previously held for
+        // nodes.  If this hash-table is empty, only release the memory held
+        // for nodes.  Each element is copy-constructed into its new node, and
+        // the element keeps its position in the sequence and in its bucket,
+        // so the hasher is not called.  All iterators, pointers, and
+        // references to elements of this hash-table are invalidated.  This
+        // operation provides the strong exception guarantee (see
+        // {'bsldoc_glossary'}).
+
     void reserveForNumElements(SizeType numElements);
         // Re-organize this hash-table to have a sufficient number of buckets
         // to accommodate at least the specified 'numElements' without
@@ -2262,6 +2335,24 @@ class HashTable {
         // first such element (from the contiguous sequence of elements having
         // the same key).
 
+    template <class RESULT_TYPE>
+    void findBatch(RESULT_TYPE   *results,
+                   const KeyType *keys,
+                   SizeType       numKeys) const;
+        // Load into each of the specified 'numKeys' elements of the specified
+        // 'results' array an object of the (template parameter) type
+        // 'RESULT_TYPE' constructed from the value that 'find' returns for the
+        // corresponding element of the specified 'keys' array.  The hash
+        // codes of a run of keys are computed before any of them is looked
+        // up, and the lookups are then overlapped (see
+        // 'bslalg::HashTableImpUtil::findBatch'), so that, for a hash table
+        // too large to be held in the cache, this method is substantially
+        // faster than calling 'find' for each key.  The behavior is undefined
+        // unless 'results' and 'keys' each refer to an array of at least
+        // 'numKeys' elements.  'RESULT_TYPE' shall be copy-assignable and
+        // explicitly constructible from 'bslalg::BidirectionalLink *' (as are
+        // the iterators of the unordered containers).
+
     bslalg::BidirectionalLink *findEndOfRange(
                                        bslalg::BidirectionalLink *first) const;
         // Return the address of the first node after any nodes holding a value
@@ -2286,6 +2377,35 @@ class HashTable {
         // the element following the range).  Also note that this hash-table
         // ensures all elements having the same key form a contiguous sequence.
 
+    template <class LOOKUP_KEY>
+    bslalg::BidirectionalLink *findTransparent(const LOOKUP_KEY& key) const;
+        // Return the address of a link whose key compares equal to the
+        // specified 'key' (according to this hash-table's 'comparator'), and a
+        // null pointer value if no such link exists.  If this hash-table
+        // contains more than one such element, return the first such element
+        // (from the contiguous sequence of elements having the same key).
+        // Unlike 'find', 'key' is passed to the hasher and 'comparator' of
+        // this hash-table as an object of the (template parameter) type
+        // 'LOOKUP_KEY' without being converted to 'KeyType'.  The behavior is
+        // undefined unless the hasher of this hash-table returns, for 'key',
+        // the same hash code it returns for every 'KeyType' object that
+        // compares equal to 'key'.
+
+    template <class LOOKUP_KEY>
+    void findTransparentRange(bslalg::BidirectionalLink **first,
+                              bslalg::BidirectionalLink **last,
+                              const LOOKUP_KEY&           key) const;
+        // Load into the specified 'first' and 'last' pointers the respective
+        // addresses of the first link, and of the link following the last
+        // link (in the list of elements owned by this hash table) where the
+        // contained elements have a key that compares equal to the specified
+        // 'key' using the 'comparator' of this hash-table, and null pointers
+        // values if there are no elements matching 'key'.  Unlike 'findRange',
+        // 'key' is not converted to 'KeyType'.  The behavior is undefined
+        // unless the hasher of this hash-table returns, for 'key', the same
+        // hash code it returns for every 'KeyType' object that compares equal
+        // to 'key'.
+
     bool hasSameValue(const HashTable& other) const;
         // Return 'true' if the specified 'other' has the same value as this
         // object, and 'false' otherwise.  Two 'HashTable' objects have the
@@ -3655,6 +3775,29 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::operator=(
     return *this;
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class NODE_HANDLE>
+NODE_HANDLE
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::extract(
+                                               bslalg::BidirectionalLink *node)
+{
+    BSLS_ASSERT_SAFE(node);
+    BSLS_ASSERT_SAFE(node->previousLink()
+                  || d_anchor.listRootAddress() == node);
+
+    // Compute the hash code first, as the user-supplied hasher may throw.
+
+    size_t hashCode = hashCodeForNode(node);
+
+    typename NodeFactory::Chunk *chunk =
+                                     d_parameters.nodeFactory().lendNode(node);
+
+    bslalg::HashTableImpUtil::remove(&d_anchor, node, hashCode);
+    --d_size;
+
+    return NODE_HANDLE(static_cast<NodeType *>(node), chunk, allocator());
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 template <class SOURCE_TYPE>
 bslalg::BidirectionalLink *
@@ -3867,6 +4010,112 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
     return position;
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class NODE_HANDLE>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertNode(
+                                                      const NODE_HANDLE& node)
+{
+    BSLS_ASSERT(!node.empty());
+
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    if (d_size >= d_capacity) {
+        this->rehashForNumBuckets(numBuckets() * 2);
+    }
+
+    size_t hashCode = this->d_parameters.hashCodeForKey(
+                                         KEY_CONFIG::extractKey(node.value()));
+    bslalg::BidirectionalLink *position = this->find(
+                                          KEY_CONFIG::extractKey(node.value()),
+                                          hashCode);
+
+    // Take the node from the handle only after the rehash and the calls to
+    // the user-supplied functors, so that 'node' retains ownership if any of
+    // them throws.
+
+    bslalg::BidirectionalLink *newNode =
+                                 node.release(&d_parameters.nodeFactory());
+    if (!position) {
+        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
+    }
+    else {
+        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, position);
+    }
+    ++d_size;
+
+    return newNode;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class NODE_HANDLE>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertNode(
+                                              const NODE_HANDLE&         node,
+                                              bslalg::BidirectionalLink *hint)
+{
+    BSLS_ASSERT(!node.empty());
+    BSLS_ASSERT(hint);
+
+    typedef bslalg::HashTableImpUtil ImpUtil;
+
+    if (d_size >= d_capacity) {
+        this->rehashForNumBuckets(numBuckets() * 2);
+    }
+
+    size_t hashCode = this->d_parameters.hashCodeForKey(
+                                         KEY_CONFIG::extractKey(node.value()));
+    if (!d_parameters.comparator()(KEY_CONFIG::extractKey(node.value()),
+                                   ImpUtil::extractKey<KEY_CONFIG>(hint))) {
+        hint = this->find(KEY_CONFIG::extractKey(node.value()), hashCode);
+    }
+
+    bslalg::BidirectionalLink *newNode =
+                                 node.release(&d_parameters.nodeFactory());
+    if (!hint) {
+        ImpUtil::insertAtFrontOfBucket(&d_anchor, newNode, hashCode);
+    }
+    else {
+        ImpUtil::insertAtPosition(&d_anchor, newNode, hashCode, hint);
+    }
+    ++d_size;
+
+    return newNode;
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class NODE_HANDLE>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertNodeIfMissing(
+                                            bool               *isInsertedFlag,
+                                            const NODE_HANDLE&  node)
+{
+    BSLS_ASSERT(isInsertedFlag);
+    BSLS_ASSERT(!node.empty());
+
+    size_t hashCode = this->d_parameters.hashCodeForKey(
+                                         KEY_CONFIG::extractKey(node.value()));
+    bslalg::BidirectionalLink *position = this->find(
+                                          KEY_CONFIG::extractKey(node.value()),
+                                          hashCode);
+
+    *isInsertedFlag = (!position);
+
+    if (!position) {
+        if (d_size >= d_capacity) {
+            this->rehashForNumBuckets(numBuckets() * 2);
+        }
+
+        position = node.release(&d_parameters.nodeFactory());
+        bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
+                                                        position,
+                                                        hashCode);
+        ++d_size;
+    }
+
+    return position;
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 void
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::rehashForNumBuckets(
@@ -3924,6 +4173,70 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAll()
     d_size = 0;
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::compact()
+{
+    typedef typename ImplParameters::NodeFactory NodeFactory;
+
+    if (0 == d_size) {
+        d_parameters.nodeFactory().release();
+        return;                                                       // RETURN
+    }
+
+    // Clone the elements, in list order, into nodes supplied by a single chunk
+    // of a new pool.  Nothing can throw once every element is cloned, so the
+    // previous link of each original node is then borrowed to hold the
+    // address of its clone, through which each bucket is redirected to the
+    // clones of its first and last nodes.
+
+    NodeFactory newFactory(d_parameters.nodeFactory().allocator());
+    newFactory.reserveNodes(d_size);
+
+    bslalg::HashTableAnchor newAnchor(
+                                  HashTable_ImpDetails::defaultBucketAddress(),
+                                  1,
+                                  0);
+    HashTable_ArrayProctor<NodeFactory> proctor(&newFactory, &newAnchor);
+
+    bslalg::BidirectionalLink *lastNode = 0;
+    for (bslalg::BidirectionalLink *cursor = d_anchor.listRootAddress();
+         cursor;
+         cursor = cursor->nextLink()) {
+        bslalg::BidirectionalLink *newNode = newFactory.cloneNode(*cursor);
+        newNode->setPreviousLink(lastNode);
+        newNode->setNextLink(0);
+        if (lastNode) {
+            lastNode->setNextLink(newNode);
+        }
+        else {
+            newAnchor.setListRootAddress(newNode);
+        }
+        lastNode = newNode;
+    }
+    proctor.release();
+
+    for (bslalg::BidirectionalLink *cursor = d_anchor.listRootAddress(),
+                                   *clone  = newAnchor.listRootAddress();
+         cursor;
+         cursor = cursor->nextLink(), clone = clone->nextLink()) {
+        cursor->setPreviousLink(clone);
+    }
+
+    bslalg::HashTableBucket *bucket    = d_anchor.bucketArrayAddress();
+    bslalg::HashTableBucket *bucketEnd = bucket + d_anchor.bucketArraySize();
+    for (; bucketEnd != bucket; ++bucket) {
+        if (bucket->first()) {
+            bucket->setFirstAndLast(bucket->first()->previousLink(),
+                                    bucket->last()->previousLink());
+        }
+    }
+
+    this->removeAllImp();
+    d_anchor.setListRootAddress(newAnchor.listRootAddress());
+    d_parameters.nodeFactory().swapRetainAllocators(newFactory);
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 inline
 void
@@ -4075,6 +4388,56 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
                                              d_parameters.hashCodeForKey(key));
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class RESULT_TYPE>
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findBatch(
+                                                RESULT_TYPE   *results,
+                                                const KeyType *keys,
+                                                SizeType       numKeys) const
+{
+    BSLS_ASSERT_SAFE(results || 0 == numKeys);
+    BSLS_ASSERT_SAFE(keys    || 0 == numKeys);
+
+    // Hash codes are computed for a run of keys, in a tight loop, before the
+    // lookups of the run are pipelined by 'ImpUtil::findBatch'.  A run is
+    // long compared to the depth of that pipeline, so that little time is
+    // spent filling and draining it.
+
+    enum {
+        k_RUN_LENGTH = 32 * bslalg::HashTableImpUtil::k_FIND_BATCH_DISTANCE
+    };
+
+    native_std::size_t         hashCodes[k_RUN_LENGTH];
+    bslalg::BidirectionalLink *links[k_RUN_LENGTH];
+
+    while (0 < numKeys) {
+        const SizeType runLength = numKeys < k_RUN_LENGTH
+                                 ? numKeys
+                                 : static_cast<SizeType>(k_RUN_LENGTH);
+
+        for (SizeType i = 0; i < runLength; ++i) {
+            hashCodes[i] = d_parameters.hashCodeForKey(keys[i]);
+        }
+
+        bslalg::HashTableImpUtil::findBatch<KEY_CONFIG>(
+                                                    links,
+                                                    d_anchor,
+                                                    keys,
+                                                    hashCodes,
+                                                    runLength,
+                                                    d_parameters.comparator());
+
+        for (SizeType i = 0; i < runLength; ++i) {
+            results[i] = RESULT_TYPE(links[i]);
+        }
+
+        results += runLength;
+        keys    += runLength;
+        numKeys -= runLength;
+    }
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 bslalg::BidirectionalLink *
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findEndOfRange(
@@ -4118,6 +4481,38 @@ HashTable< KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findRange(
            : 0;
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findTransparent(
+                                                   const LOOKUP_KEY& key) const
+{
+    return bslalg::HashTableImpUtil::findTransparent<KEY_CONFIG>(
+                                             d_anchor,
+                                             key,
+                                             d_parameters.comparator(),
+                                             d_parameters.hashCodeForKey(key));
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class LOOKUP_KEY>
+inline
+void
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findTransparentRange(
+                                         bslalg::BidirectionalLink **first,
+                                         bslalg::BidirectionalLink **last,
+                                         const LOOKUP_KEY&           key) const
+{
+    BSLS_ASSERT_SAFE(first);
+    BSLS_ASSERT_SAFE(last);
+
+    *first = this->findTransparent(key);
+    *last  = *first
+           ? this->findEndOfRange(*first)
+           : 0;
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 bool
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::hasSameValue(
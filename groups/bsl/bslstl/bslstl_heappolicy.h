@@ -0,0 +1,421 @@
+// bslstl_heappolicy.h                                                -*-C++-*-
+#ifndef INCLUDED_BSLSTL_HEAPPOLICY
+#define INCLUDED_BSLSTL_HEAPPOLICY
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide policies maintaining a heap held in a random-access range.
+//
+//@CLASSES:
+//  bslstl::StdHeapPolicy: binary heap maintained by the standard algorithms
+//  bslstl::DaryHeapPolicy: heap in which each node has 'ARITY' children
+//
+//@SEE_ALSO: bslstl_priorityqueue, bslstl_pairingheap
+//
+//@DESCRIPTION: This component provides two heap policies, each a namespace
+// for three functions, 'makeHeap', 'pushHeap', and 'popHeap', that take a
+// range of random-access iterators and a comparator, and have the semantics
+// of the standard algorithms 'std::make_heap', 'std::push_heap', and
+// 'std::pop_heap', respectively.  A heap policy is supplied to
+// 'bsl::priority_queue' (see 'bslstl_priorityqueue') to select the layout of
+// the heap held in the container of the priority queue.
+//
+// 'StdHeapPolicy' forwards to the standard algorithms, which maintain a binary
+// heap.  'DaryHeapPolicy<ARITY>' maintains a heap in which each node has up to
+// 'ARITY' children, the children of the element at index 'i' being the
+// elements at indices 'ARITY * i + 1' to 'ARITY * i + ARITY'.  A d-ary heap of
+// 'n' elements has a depth of 'log(n) / log(ARITY)', and so an element pushed
+// onto the heap is compared with fewer ancestors, while an element sifted down
+// after a pop is compared with all (up to 'ARITY') children at each of fewer
+// levels.  As the children of a node are adjacent in memory, the comparisons
+// at one level touch one or two cache lines (rather than the scattered lines
+// touched on the several levels of a binary heap), so that, for large heaps of
+// small elements, a 4-ary or 8-ary heap is typically faster than a binary
+// heap, for both 'push' and 'pop'.  Choosing 'ARITY' such that
+// 'ARITY * sizeof(VALUE)' is the size of a cache line (e.g., 8 for 8-byte
+// elements and 64-byte lines) makes the best use of each line loaded.
+//
+// Note that a heap built by one policy is, in general, not a heap according to
+// another policy, so the policy used to build a heap must also be used to
+// maintain it.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Maintaining a 4-ary Heap in a Vector
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we hold a collection of deadlines in a 'bsl::vector', and we want
+// to repeatedly retrieve the earliest one.
+//
+// First, we build a 4-ary heap from the initial deadlines, using
+// 'std::greater' so that the earliest deadline is at the front:
+//..
+//  typedef bslstl::DaryHeapPolicy<4> Policy;
+//
+//  bsl::vector<int> deadlines;
+//  deadlines.push_back(40);
+//  deadlines.push_back(10);
+//  deadlines.push_back(30);
+//  deadlines.push_back(20);
+//  deadlines.push_back(50);
+//
+//  Policy::makeHeap(deadlines.begin(), deadlines.end(), std::greater<int>());
+//  assert(10 == deadlines.front());
+//..
+// Then, we add a new deadline by appending it to the vector and calling
+// 'pushHeap':
+//..
+//  deadlines.push_back(5);
+//  Policy::pushHeap(deadlines.begin(), deadlines.end(), std::greater<int>());
+//  assert(5 == deadlines.front());
+//..
+// Finally, we retrieve the deadlines in order, using 'popHeap' to move the
+// earliest deadline to the back of the vector, from which it is removed:
+//..
+//  const int EXPECTED[] = { 5, 10, 20, 30, 40, 50 };
+//  for (int i = 0; !deadlines.empty(); ++i) {
+//      Policy::popHeap(deadlines.begin(),
+//                      deadlines.end(),
+//                      std::greater<int>());
+//      assert(EXPECTED[i] == deadlines.back());
+//      deadlines.pop_back();
+//  }
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ASSERT
+#include <bslmf_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_ALGORITHM
+#include <algorithm>
+#define INCLUDED_ALGORITHM
+#endif
+
+#ifndef INCLUDED_ITERATOR
+#include <iterator>
+#define INCLUDED_ITERATOR
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                            // ====================
+                            // struct StdHeapPolicy
+                            // ====================
+
+struct StdHeapPolicy {
+    // This 'struct' provides a namespace for functions maintaining a binary
+    // heap, using the standard heap algorithms.
+
+    // CLASS METHODS
+    template <class RANDOM_ITER, class COMPARATOR>
+    static void makeHeap(RANDOM_ITER first,
+                         RANDOM_ITER last,
+                         COMPARATOR  comparator);
+        // Rearrange the elements in the range starting at the specified
+        // 'first' and ending immediately before the specified 'last' into a
+        // heap ordered by the specified 'comparator'.  In effect, performs
+        // 'std::make_heap(first, last, comparator)'.
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    static void popHeap(RANDOM_ITER first,
+                        RANDOM_ITER last,
+                        COMPARATOR  comparator);
+        // Move the highest-priority element of the heap ordered by the
+        // specified 'comparator' in the range starting at the specified
+        // 'first' and ending immediately before the specified 'last' to
+        // 'last - 1', and rearrange the remaining elements into a heap.  In
+        // effect, performs 'std::pop_heap(first, last, comparator)'.  The
+        // behavior is undefined unless '[first, last)' is a non-empty heap.
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    static void pushHeap(RANDOM_ITER first,
+                         RANDOM_ITER last,
+                         COMPARATOR  comparator);
+        // Insert the element at 'last - 1' into the heap ordered by the
+        // specified 'comparator' in the range starting at the specified
+        // 'first' and ending immediately before 'last - 1', where 'last' is
+        // the specified 'last'.  In effect, performs
+        // 'std::push_heap(first, last, comparator)'.  The behavior is
+        // undefined unless '[first, last - 1)' is a heap.
+};
+
+                           // =====================
+                           // struct DaryHeapPolicy
+                           // =====================
+
+template <int ARITY>
+struct DaryHeapPolicy {
+    // This 'struct' provides a namespace for functions maintaining a heap in
+    // which each node has up to 'ARITY' children.  The children of the element
+    // at index 'i' of a heap are the elements at indices 'ARITY * i + 1' to
+    // 'ARITY * i + ARITY'.  Note that 'DaryHeapPolicy<2>' maintains the same
+    // layout as 'StdHeapPolicy'.
+
+    BSLMF_ASSERT(2 <= ARITY);
+
+  private:
+    // PRIVATE CLASS METHODS
+    template <class RANDOM_ITER,
+              class DIFFERENCE,
+              class VALUE_TYPE,
+              class COMPARATOR>
+    static void siftDown(RANDOM_ITER        first,
+                         DIFFERENCE         hole,
+                         DIFFERENCE         length,
+                         const VALUE_TYPE&  value,
+                         COMPARATOR&        comparator);
+        // Move the specified 'hole' down the heap of the specified 'length'
+        // starting at the specified 'first', ordered by the specified
+        // 'comparator', by moving up the highest-priority child of the hole
+        // for as long as that child has a higher priority than the specified
+        // 'value', and then assign 'value' to the element at the final
+        // position of the hole.  The behavior is undefined unless
+        // 'hole < length'.
+
+    template <class RANDOM_ITER,
+              class DIFFERENCE,
+              class VALUE_TYPE,
+              class COMPARATOR>
+    static void siftUp(RANDOM_ITER        first,
+                       DIFFERENCE         hole,
+                       const VALUE_TYPE&  value,
+                       COMPARATOR&        comparator);
+        // Move the specified 'hole' up the heap starting at the specified
+        // 'first', ordered by the specified 'comparator', by moving down the
+        // parent of the hole for as long as that parent has a lower priority
+        // than the specified 'value', and then assign 'value' to the element
+        // at the final position of the hole.
+
+  public:
+    // CLASS METHODS
+    template <class RANDOM_ITER, class COMPARATOR>
+    static void makeHeap(RANDOM_ITER first,
+                         RANDOM_ITER last,
+                         COMPARATOR  comparator);
+        // Rearrange, in linear time, the elements in the range starting at the
+        // specified 'first' and ending immediately before the specified 'last'
+        // into a heap ordered by the specified 'comparator'.
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    static void popHeap(RANDOM_ITER first,
+                        RANDOM_ITER last,
+                        COMPARATOR  comparator);
+        // Move the highest-priority element of the heap ordered by the
+        // specified 'comparator' in the range starting at the specified
+        // 'first' and ending immediately before the specified 'last' to
+        // 'last - 1', and rearrange the remaining elements into a heap.  The
+        // behavior is undefined unless '[first, last)' is a non-empty heap.
+
+    template <class RANDOM_ITER, class COMPARATOR>
+    static void pushHeap(RANDOM_ITER first,
+                         RANDOM_ITER last,
+                         COMPARATOR  comparator);
+        // Insert the element at 'last - 1' into the heap ordered by the
+        // specified 'comparator' in the range starting at the specified
+        // 'first' and ending immediately before 'last - 1', where 'last' is
+        // the specified 'last'.  The behavior is undefined unless
+        // '[first, last - 1)' is a heap.
+};
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // --------------------
+                            // struct StdHeapPolicy
+                            // --------------------
+
+// CLASS METHODS
+template <class RANDOM_ITER, class COMPARATOR>
+inline
+void StdHeapPolicy::makeHeap(RANDOM_ITER first,
+                             RANDOM_ITER last,
+                             COMPARATOR  comparator)
+{
+    native_std::make_heap(first, last, comparator);
+}
+
+template <class RANDOM_ITER, class COMPARATOR>
+inline
+void StdHeapPolicy::popHeap(RANDOM_ITER first,
+                            RANDOM_ITER last,
+                            COMPARATOR  comparator)
+{
+    native_std::pop_heap(first, last, comparator);
+}
+
+template <class RANDOM_ITER, class COMPARATOR>
+inline
+void StdHeapPolicy::pushHeap(RANDOM_ITER first,
+                             RANDOM_ITER last,
+                             COMPARATOR  comparator)
+{
+    native_std::push_heap(first, last, comparator);
+}
+
+                           // ---------------------
+                           // struct DaryHeapPolicy
+                           // ---------------------
+
+// PRIVATE CLASS METHODS
+template <int ARITY>
+template <class RANDOM_ITER,
+          class DIFFERENCE,
+          class VALUE_TYPE,
+          class COMPARATOR>
+void DaryHeapPolicy<ARITY>::siftDown(RANDOM_ITER        first,
+                                     DIFFERENCE         hole,
+                                     DIFFERENCE         length,
+                                     const VALUE_TYPE&  value,
+                                     COMPARATOR&        comparator)
+{
+    typedef DIFFERENCE Difference;
+
+    // The children of 'hole' are scanned for the highest-priority child; the
+    // last node having children may have fewer than 'ARITY' of them.
+
+    Difference child = ARITY * hole + 1;
+    while (child < length) {
+        const Difference end  = native_std::min<Difference>(child + ARITY,
+                                                            length);
+        Difference       best = child;
+        for (++child; child < end; ++child) {
+            if (comparator(first[best], first[child])) {
+                best = child;
+            }
+        }
+        if (!comparator(value, first[best])) {
+            break;
+        }
+        first[hole] = first[best];
+        hole        = best;
+        child       = ARITY * hole + 1;
+    }
+    first[hole] = value;
+}
+
+template <int ARITY>
+template <class RANDOM_ITER,
+          class DIFFERENCE,
+          class VALUE_TYPE,
+          class COMPARATOR>
+void DaryHeapPolicy<ARITY>::siftUp(RANDOM_ITER        first,
+                                   DIFFERENCE         hole,
+                                   const VALUE_TYPE&  value,
+                                   COMPARATOR&        comparator)
+{
+    typedef DIFFERENCE Difference;
+
+    while (0 < hole) {
+        const Difference parent = (hole - 1) / ARITY;
+        if (!comparator(first[parent], value)) {
+            break;
+        }
+        first[hole] = first[parent];
+        hole        = parent;
+    }
+    first[hole] = value;
+}
+
+// CLASS METHODS
+template <int ARITY>
+template <class RANDOM_ITER, class COMPARATOR>
+void DaryHeapPolicy<ARITY>::makeHeap(RANDOM_ITER first,
+                                     RANDOM_ITER last,
+                                     COMPARATOR  comparator)
+{
+    typedef typename native_std::iterator_traits<RANDOM_ITER>::difference_type
+                                                                    Difference;
+    typedef typename native_std::iterator_traits<RANDOM_ITER>::value_type
+                                                                    ValueType;
+
+    const Difference length = last - first;
+    if (length < 2) {
+        return;                                                       // RETURN
+    }
+
+    // Sift down each node having children, starting from the last such node.
+
+    for (Difference parent = (length - 2) / ARITY; ; --parent) {
+        const ValueType value(first[parent]);
+        siftDown(first, parent, length, value, comparator);
+        if (0 == parent) {
+            break;
+        }
+    }
+}
+
+template <int ARITY>
+template <class RANDOM_ITER, class COMPARATOR>
+void DaryHeapPolicy<ARITY>::popHeap(RANDOM_ITER first,
+                                    RANDOM_ITER last,
+                                    COMPARATOR  comparator)
+{
+    typedef typename native_std::iterator_traits<RANDOM_ITER>::difference_type
+                                                                    Difference;
+    typedef typename native_std::iterator_traits<RANDOM_ITER>::value_type
+                                                                    ValueType;
+
+    const Difference length = last - first;
+    if (length < 2) {
+        return;                                                       // RETURN
+    }
+
+    const ValueType value(first[length - 1]);
+    first[length - 1] = *first;
+    siftDown(first, Difference(0), length - 1, value, comparator);
+}
+
+template <int ARITY>
+template <class RANDOM_ITER, class COMPARATOR>
+void DaryHeapPolicy<ARITY>::pushHeap(RANDOM_ITER first,
+                                     RANDOM_ITER last,
+                                     COMPARATOR  comparator)
+{
+    typedef typename native_std::iterator_traits<RANDOM_ITER>::difference_type
+                                                                    Difference;
+    typedef typename native_std::iterator_traits<RANDOM_ITER>::value_type
+                                                                    ValueType;
+
+    const Difference length = last - first;
+    if (length < 2) {
+        return;                                                       // RETURN
+    }
+
+    const ValueType value(first[length - 1]);
+    siftUp(first, length - 1, value, comparator);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,469 @@
+// bslstl_heappolicy.t.cpp                                            -*-C++-*-
+#include <bslstl_heappolicy.h>
+
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <algorithm>
+#include <functional>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides two heap policies, each a namespace for
+// three function templates.  For each policy, and for several arities of
+// 'DaryHeapPolicy', we build heaps of pseudo-random values of many lengths
+// with 'makeHeap' and with repeated calls to 'pushHeap', verify the heap
+// property according to the layout of the policy after each operation, and
+// verify that repeated calls to 'popHeap' retrieve the values in the order
+// produced by 'std::sort'.  The comparator is varied to verify that the
+// highest-priority element is the one at the front.
+//-----------------------------------------------------------------------------
+// struct StdHeapPolicy
+// [ 2] void makeHeap(RI first, RI last, COMPARATOR cmp);
+// [ 3] void pushHeap(RI first, RI last, COMPARATOR cmp);
+// [ 3] void popHeap(RI first, RI last, COMPARATOR cmp);
+//
+// struct DaryHeapPolicy<ARITY>
+// [ 2] void makeHeap(RI first, RI last, COMPARATOR cmp);
+// [ 3] void pushHeap(RI first, RI last, COMPARATOR cmp);
+// [ 3] void popHeap(RI first, RI last, COMPARATOR cmp);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bsl::vector<int> Values;
+
+enum { k_MAX_LENGTH = 100 };
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static int nextRandom(unsigned *seed)
+    // Advance the specified 'seed' of a linear congruential generator and
+    // return the next pseudo-random number in the range '[0, 32767]'.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return static_cast<int>((*seed >> 16) & 0x7fff);
+}
+
+template <class COMPARATOR>
+bool isHeap(const Values& values, int arity, COMPARATOR comparator)
+    // Return 'true' if the specified 'values' form a heap ordered by the
+    // specified 'comparator' in which the children of the element at index
+    // 'i' are the elements at indices 'arity * i + 1' to 'arity * i + arity',
+    // for the specified 'arity', and 'false' otherwise.
+{
+    const int length = static_cast<int>(values.size());
+    for (int i = 1; i < length; ++i) {
+        if (comparator(values[(i - 1) / arity], values[i])) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+                            // =================
+                            // struct TestDriver
+                            // =================
+
+template <class POLICY, int ARITY>
+struct TestDriver {
+    // This 'struct' provides a namespace for the test cases exercising the
+    // specified heap 'POLICY', which maintains a heap in which each node has
+    // up to the specified 'ARITY' children.
+
+    template <class COMPARATOR>
+    static void testMakeHeap(COMPARATOR comparator);
+        // Test 'makeHeap' using the specified 'comparator'.
+
+    template <class COMPARATOR>
+    static void testPushPopHeap(COMPARATOR comparator);
+        // Test 'pushHeap' and 'popHeap' using the specified 'comparator'.
+};
+
+template <class POLICY, int ARITY>
+template <class COMPARATOR>
+void TestDriver<POLICY, ARITY>::testMakeHeap(COMPARATOR comparator)
+{
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+    unsigned seed = ARITY;
+    for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+        for (int range = 1; range <= 1000; range *= 10) {
+            Values values(&oa);
+            for (int i = 0; i < length; ++i) {
+                values.push_back(nextRandom(&seed) % range);
+            }
+            Values expected(values, &oa);
+            std::sort(expected.begin(), expected.end());
+
+            POLICY::makeHeap(values.begin(), values.end(), comparator);
+
+            ASSERTV(ARITY, length, range, isHeap(values, ARITY, comparator));
+
+            std::sort(values.begin(), values.end());
+            ASSERTV(ARITY, length, range, expected == values);
+        }
+    }
+}
+
+template <class POLICY, int ARITY>
+template <class COMPARATOR>
+void TestDriver<POLICY, ARITY>::testPushPopHeap(COMPARATOR comparator)
+{
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+    unsigned seed = ARITY + 17;
+    for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+        for (int range = 1; range <= 1000; range *= 10) {
+            Values values(&oa);
+            Values heap(&oa);
+            for (int i = 0; i < length; ++i) {
+                const int VALUE = nextRandom(&seed) % range;
+                values.push_back(VALUE);
+
+                heap.push_back(VALUE);
+                POLICY::pushHeap(heap.begin(), heap.end(), comparator);
+
+                ASSERTV(ARITY, length, range, i,
+                        isHeap(heap, ARITY, comparator));
+            }
+
+            // Retrieving the elements in priority order yields the values
+            // sorted in descending order of priority.
+
+            std::sort(values.begin(), values.end(), comparator);
+            for (int i = length - 1; 0 <= i; --i) {
+                POLICY::popHeap(heap.begin(), heap.end(), comparator);
+
+                ASSERTV(ARITY, length, range, i, values[i] == heap.back());
+
+                heap.pop_back();
+
+                ASSERTV(ARITY, length, range, i,
+                        isHeap(heap, ARITY, comparator));
+            }
+        }
+    }
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Maintaining a 4-ary Heap in a Vector
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we hold a collection of deadlines in a 'bsl::vector', and we want
+// to repeatedly retrieve the earliest one.
+//
+// First, we build a 4-ary heap from the initial deadlines, using
+// 'std::greater' so that the earliest deadline is at the front:
+//..
+    typedef bslstl::DaryHeapPolicy<4> Policy;
+
+    bsl::vector<int> deadlines(&oa);
+    deadlines.push_back(40);
+    deadlines.push_back(10);
+    deadlines.push_back(30);
+    deadlines.push_back(20);
+    deadlines.push_back(50);
+
+    Policy::makeHeap(deadlines.begin(), deadlines.end(), std::greater<int>());
+    ASSERT(10 == deadlines.front());
+//..
+// Then, we add a new deadline by appending it to the vector and calling
+// 'pushHeap':
+//..
+    deadlines.push_back(5);
+    Policy::pushHeap(deadlines.begin(), deadlines.end(), std::greater<int>());
+    ASSERT(5 == deadlines.front());
+//..
+// Finally, we retrieve the deadlines in order, using 'popHeap' to move the
+// earliest deadline to the back of the vector, from which it is removed:
+//..
+    const int EXPECTED[] = { 5, 10, 20, 30, 40, 50 };
+    for (int i = 0; !deadlines.empty(); ++i) {
+        Policy::popHeap(deadlines.begin(),
+                        deadlines.end(),
+                        std::greater<int>());
+        ASSERT(EXPECTED[i] == deadlines.back());
+        deadlines.pop_back();
+    }
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'pushHeap' AND 'popHeap'
+        //
+        // Concerns:
+        //: 1 After each call to 'pushHeap', the range is a heap having the
+        //:   layout of the policy, and holds the values pushed so far.
+        //:
+        //: 2 Repeated calls to 'popHeap' move the elements to the back of
+        //:   the range in decreasing order of priority, and the remaining
+        //:   range is a heap after each call.
+        //:
+        //: 3 Equivalent values are handled correctly.
+        //:
+        //: 4 The comparator determines the priority of the elements.
+        //
+        // Plan:
+        //: 1 For 'StdHeapPolicy' and for 'DaryHeapPolicy' of arities 2, 3, 4,
+        //:   and 8, push pseudo-random values, drawn from ranges of several
+        //:   sizes, onto a vector of each length up to 100, and verify the
+        //:   heap property after each push.  Then pop all elements, verifying
+        //:   each popped element against the sorted values, and the heap
+        //:   property after each pop.  (C-1..3)
+        //:
+        //: 2 Repeat P-1 using 'std::greater'.  (C-4)
+        //
+        // Testing:
+        //   void pushHeap(RI first, RI last, COMPARATOR cmp);
+        //   void popHeap(RI first, RI last, COMPARATOR cmp);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'pushHeap' AND 'popHeap'"
+                            "\n========================\n");
+
+        TestDriver<bslstl::StdHeapPolicy, 2>::testPushPopHeap(
+                                                           std::less<int>());
+        TestDriver<bslstl::DaryHeapPolicy<2>, 2>::testPushPopHeap(
+                                                           std::less<int>());
+        TestDriver<bslstl::DaryHeapPolicy<3>, 3>::testPushPopHeap(
+                                                           std::less<int>());
+        TestDriver<bslstl::DaryHeapPolicy<4>, 4>::testPushPopHeap(
+                                                           std::less<int>());
+        TestDriver<bslstl::DaryHeapPolicy<8>, 8>::testPushPopHeap(
+                                                           std::less<int>());
+
+        TestDriver<bslstl::StdHeapPolicy, 2>::testPushPopHeap(
+                                                        std::greater<int>());
+        TestDriver<bslstl::DaryHeapPolicy<4>, 4>::testPushPopHeap(
+                                                        std::greater<int>());
+        TestDriver<bslstl::DaryHeapPolicy<8>, 8>::testPushPopHeap(
+                                                        std::greater<int>());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'makeHeap'
+        //
+        // Concerns:
+        //: 1 'makeHeap' rearranges a range of any length, including 0 and 1,
+        //:   into a heap having the layout of the policy.
+        //:
+        //: 2 The values held in the range are unchanged, including
+        //:   equivalent values.
+        //:
+        //: 3 The comparator determines the priority of the elements.
+        //
+        // Plan:
+        //: 1 For 'StdHeapPolicy' and for 'DaryHeapPolicy' of arities 2, 3, 4,
+        //:   and 8, make heaps of pseudo-random values, drawn from ranges of
+        //:   several sizes, of each length up to 100, and verify the heap
+        //:   property and the sorted values.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 using 'std::greater'.  (C-3)
+        //
+        // Testing:
+        //   void makeHeap(RI first, RI last, COMPARATOR cmp);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'makeHeap'"
+                            "\n==========\n");
+
+        TestDriver<bslstl::StdHeapPolicy, 2>::testMakeHeap(std::less<int>());
+        TestDriver<bslstl::DaryHeapPolicy<2>, 2>::testMakeHeap(
+                                                           std::less<int>());
+        TestDriver<bslstl::DaryHeapPolicy<3>, 3>::testMakeHeap(
+                                                           std::less<int>());
+        TestDriver<bslstl::DaryHeapPolicy<4>, 4>::testMakeHeap(
+                                                           std::less<int>());
+        TestDriver<bslstl::DaryHeapPolicy<8>, 8>::testMakeHeap(
+                                                           std::less<int>());
+
+        TestDriver<bslstl::StdHeapPolicy, 2>::testMakeHeap(
+                                                        std::greater<int>());
+        TestDriver<bslstl::DaryHeapPolicy<4>, 4>::testMakeHeap(
+                                                        std::greater<int>());
+        TestDriver<bslstl::DaryHeapPolicy<8>, 8>::testMakeHeap(
+                                                        std::greater<int>());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Make a 4-ary heap of a few values, push a value, and pop all
+        //:   values, verifying the front of the heap after each step.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        typedef bslstl::DaryHeapPolicy<4> Obj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Values heap(&oa);
+        for (int i = 0; i < 10; ++i) {
+            heap.push_back((i * 7) % 10);
+        }
+        Obj::makeHeap(heap.begin(), heap.end(), std::less<int>());
+        ASSERTV(heap.front(), 9 == heap.front());
+        ASSERT(isHeap(heap, 4, std::less<int>()));
+
+        heap.push_back(42);
+        Obj::pushHeap(heap.begin(), heap.end(), std::less<int>());
+        ASSERTV(heap.front(), 42 == heap.front());
+
+        Obj::popHeap(heap.begin(), heap.end(), std::less<int>());
+        ASSERTV(heap.back(), 42 == heap.back());
+        heap.pop_back();
+
+        for (int i = 9; 0 <= i; --i) {
+            ASSERTV(i, heap.front(), i == heap.front());
+            Obj::popHeap(heap.begin(), heap.end(), std::less<int>());
+            ASSERTV(i, heap.back(), i == heap.back());
+            heap.pop_back();
+        }
+        ASSERT(heap.empty());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
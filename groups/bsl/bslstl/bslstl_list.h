@@ -145,6 +145,8 @@ BSLS_IDENT("$Id: $")
 //  +----------------------------------------------------+--------------------+
 //  | a.clear()                                          | O(n)               |
 //  +----------------------------------------------------+--------------------+
+//  | a.compact()                                        | O(n)               |
+//  +----------------------------------------------------+--------------------+
 //  | a.assign(i1,i2)                                    | O(distance(i1, i2))|
 //  +----------------------------------------------------+--------------------+
 //  | a.assign(n, value_type(v))                         | O(n)               |
@@ -1450,6 +1452,18 @@ class list
     void clear();
         // Remove all the elements from this list.
 
+    void compact();
+        // Reallocate every node of this list, in iteration order, from the
+        // allocator of this list, and return the memory previously held for
+        // nodes to that allocator, restoring the locality of a list whose
+        // nodes have become scattered by a history of insertions and
+        // erasures.  The value of this list is unchanged, but all iterators,
+        // pointers, and references to its elements are invalidated.  If an
+        // exception is thrown, this method has no effect.  Note that, as each
+        // node is obtained individually from the allocator, the new nodes are
+        // contiguous only if the allocator (e.g., a sequential or pool
+        // allocator) supplies consecutive requests from adjacent memory.
+
     // 23.3.5.5 list operations:
 
     void splice(const_iterator position, list& x);
@@ -2832,6 +2846,20 @@ void list<VALUE, ALLOCATOR>::clear()
     erase(begin(), end());
 }
 
+template <class VALUE, class ALLOCATOR>
+void list<VALUE, ALLOCATOR>::compact()
+{
+    if (empty()) {
+        return;                                                       // RETURN
+    }
+
+    // All nodes are allocated, in order, by the copy before any node of this
+    // list is freed, so that no freed node is reused for the copy.
+
+    list tmp(*this, get_allocator());
+    quick_swap(tmp);
+}
+
 // 23.3.5.5 list operations:
 template <class VALUE, class ALLOCATOR>
 void list<VALUE, ALLOCATOR>::splice(const_iterator position, list& x)
@@ -124,6 +124,7 @@ using namespace bsl;
 // [18] iterator erase(const_iterator first, const_iterator last);
 // [19] void swap(list&);
 // [ 2] void clear();
+// [29] void compact();
 // [24] void splice(iterator pos, list& other);
 // [24] void splice(iterator pos, list& other, iterator i);
 // [24] void splice(iterator pos, list& other, iterator first, iterator last);
@@ -160,7 +161,7 @@ using namespace bsl;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [11] ALLOCATOR-RELATED CONCERNS
-// [29] USAGE EXAMPLE
+// [30] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(list<T,A> *object, const char *spec, int vF = 1);
@@ -1781,6 +1782,9 @@ struct TestDriver {
         // length has changed by 'n' elements.  Note: 'n' may be negative.
 
     // TEST CASES
+    static void testCompact();
+        // Test 'compact'
+
     static void testSort();
         // Test 'sort'
 
@@ -3488,6 +3492,105 @@ void TestDriver<TYPE,ALLOC>::testSplice()
     } // end for (op)
 }
 
+template <class TYPE, class ALLOC>
+void TestDriver<TYPE,ALLOC>::testCompact()
+{
+    // --------------------------------------------------------------------
+    // TESTING COMPACT
+    //
+    // Concerns:
+    //   1. Compacting a list with 0, 1, 2, or more elements leaves its
+    //      value unchanged.
+    //   2. Every node of a non-empty list is reallocated, and every node
+    //      is allocated before any node is freed.
+    //   3. The number of blocks in use is unchanged, and compacting an
+    //      empty list allocates no memory.
+    //   4. If an exception is thrown, the list is unchanged.
+    //
+    // Plan:
+    //   Create a list from a variety of specifications, record the
+    //   address of each element, and call 'compact' on the list within an
+    //   exception test loop, using an 'ExceptionGuard' to verify that the
+    //   list is unchanged whenever an exception is thrown.  For concern 1,
+    //   verify the integrity and the value of the list.  For concern 2,
+    //   verify that no element has its original address, which, as the
+    //   original nodes remain allocated until every new node is allocated,
+    //   cannot be reused, and that the total number of blocks allocated
+    //   increased by the number of blocks used by a list of the same
+    //   length.  For concern 3, compare the number of blocks in use before
+    //   and after calling 'compact'.
+    //
+    // Testing:
+    //   void compact();
+    // --------------------------------------------------------------------
+
+    bslma::TestAllocator testAllocator(veryVeryVerbose);
+    ALLOC Z(&testAllocator);
+
+    static const struct {
+        int         d_lineNum;
+        const char *d_spec;
+    } DATA[] = {
+        { L_, ""          },
+        { L_, "A"         },
+        { L_, "AB"        },
+        { L_, "ABC"       },
+        { L_, "ABCDE"     },
+        { L_, "AAAA"      },
+        { L_, "ABCDEABCD" },
+    };
+
+    const int NUM_DATA = sizeof(DATA) / sizeof(DATA[0]);
+
+    enum { MAX_LENGTH = 16 };
+
+    for (int i = 0; i < NUM_DATA; ++i) {
+        const int     LINE   = DATA[i].d_lineNum;
+        const char   *SPEC   = DATA[i].d_spec;
+        const size_t  LENGTH = strlen(SPEC);
+        LOOP_ASSERT(LINE, MAX_LENGTH >= LENGTH);
+
+        Obj mX(Z);
+        const Obj& X = gg(&mX, SPEC);
+
+        const TYPE *ADDRESSES[MAX_LENGTH];
+        int         n = 0;
+        for (const_iterator it = X.begin(); it != X.end(); ++it) {
+            ADDRESSES[n++] = &*it;
+        }
+
+        BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(testAllocator) {
+            ExceptionGuard<Obj> guard(&mX, X, LINE);
+
+            const Int64 BB = testAllocator.numBlocksTotal();
+            const Int64 B  = testAllocator.numBlocksInUse();
+
+            mX.compact();  // Test here
+
+            guard.release();
+
+            const Int64 AA = testAllocator.numBlocksTotal();
+            const Int64 A  = testAllocator.numBlocksInUse();
+
+            LOOP_ASSERT(LINE, checkIntegrity(X, LENGTH));
+            LOOP_ASSERT(LINE, g(SPEC) == X);
+            LOOP_ASSERT(LINE, A == B);
+            if (0 == LENGTH) {
+                LOOP_ASSERT(LINE, AA == BB);
+            }
+            else {
+                LOOP_ASSERT(LINE, BB + expectedBlocks(LENGTH) == AA);
+            }
+        } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+        for (const_iterator it = X.begin(); it != X.end(); ++it) {
+            for (int j = 0; j < n; ++j) {
+                LOOP2_ASSERT(LINE, j, ADDRESSES[j] != &*it);
+            }
+        }
+    } // end for (i)
+}
+
 template <class TYPE, class ALLOC>
 void TestDriver<TYPE,ALLOC>::testReverse()
 {
@@ -8701,7 +8804,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 29: {
+      case 30: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -8741,6 +8844,31 @@ int main(int argc, char *argv[])
         remove("star_data1.txt");
         remove("star_data2.txt");
 
+      } break;
+      case 29: {
+        // --------------------------------------------------------------------
+        // TESTING COMPACT
+        //
+        // Concerns and plan:
+        //   See testCompact for a list of specific concerns and a test plan.
+        //
+        // Testing:
+        //   void compact();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTesting COMPACT"
+                            "\n===============\n");
+
+        if (verbose) printf("\n... with 'char'.\n");
+        TestDriver<char>::testCompact();
+
+        if (verbose) printf("\n... with 'TestType'.\n");
+        TestDriver<T>::testCompact();
+
+        if (verbose) printf("\n... with 'TestTypeOtherAlloc' and"
+                            " 'OtherAlloc'.\n");
+        TestDriver<TOA,OATOA>::testCompact();
+
       } break;
       case 28: {
         // --------------------------------------------------------------------
@@ -0,0 +1,893 @@
+// bslstl_localsharedptr.h                                            -*-C++-*-
+#ifndef INCLUDED_BSLSTL_LOCALSHAREDPTR
+#define INCLUDED_BSLSTL_LOCALSHAREDPTR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a shared pointer with non-atomic reference counting.
+//
+//@CLASSES:
+//  bsl::local_shared_ptr: shared pointer confined to a single thread
+//
+//@SEE_ALSO: bslstl_sharedptr, bslma_sharedptrrep, bslma_sharedptrinplacerep
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bsl::local_shared_ptr', that, like 'bsl::shared_ptr' (see
+// 'bslstl_sharedptr'), shares ownership of an object managed by a
+// 'bslma::SharedPtrRep', but that adjusts the reference count of the
+// representation with plain (relaxed) loads and stores rather than with atomic
+// read-modify-write operations (see the "Local Reference Counting" section of
+// 'bslma_sharedptrrep').  Copying or destroying a 'local_shared_ptr' is
+// therefore no more expensive than adjusting an ordinary integer, which
+// matters for programs that build large graphs of objects owned through shared
+// pointers (e.g., parse trees) and that never share those objects between
+// threads while the graph is being built or traversed.
+//
+// A 'local_shared_ptr' uses the same representations as 'shared_ptr': objects
+// created by 'createInplace' are held, with their reference counts, in a
+// 'bslma::SharedPtrInplaceRep' allocated from the supplied allocator, and an
+// object adopted from a raw pointer is managed by a
+// 'bslma::SharedPtrOutofplaceRep' that deletes the object using the supplied
+// allocator.
+//
+///Thread Safety
+///-------------
+// All of the 'local_shared_ptr' objects sharing ownership of an object, as
+// well as all of the objects that can be reached only through such pointers,
+// must be used (and destroyed) from a single thread.  A 'local_shared_ptr' may
+// not share ownership with a 'shared_ptr' or a 'weak_ptr' (whose reference
+// counting is atomic), and so this component provides no conversion from
+// 'shared_ptr' to 'local_shared_ptr', and no weak counterpart to
+// 'local_shared_ptr'.
+//
+// A graph of objects built through local pointers can be handed to other
+// threads, once complete, using the 'moveToShared' method, which transfers
+// the ownership of the object referred to by a 'local_shared_ptr' into a
+// 'shared_ptr'.  The transfer is checked: 'moveToShared' fails, returning a
+// non-zero value and leaving both pointers unchanged, unless the
+// 'local_shared_ptr' is empty or is the sole owner of its object.  Note that
+// only the ownership of the object referred to directly is checked; the caller
+// must also ensure that it retains no other local pointer into the graph
+// reachable from that object, because such pointers will be copied and
+// destroyed (non-atomically) by the thread that finally releases the graph.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing Subtrees of a Parse Tree
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we are writing an expression parser that represents the
+// expressions it parses as trees in which identical subexpressions are shared,
+// and that the nodes of each tree are owned through shared pointers.  As each
+// tree is built and evaluated by a single thread, we use 'local_shared_ptr'
+// to avoid the cost of atomic reference counting.
+//
+// First, we define the type of the nodes of the tree, each either a number or
+// the sum or the product of two subexpressions:
+//..
+//  struct Expression {
+//      // This 'struct' describes a node of an expression tree.
+//
+//      // DATA
+//      char                                 d_operator;  // '+', '*', or 0
+//      int                                  d_value;     // value if number
+//      bsl::local_shared_ptr<Expression>    d_lhs;       // left operand
+//      bsl::local_shared_ptr<Expression>    d_rhs;       // right operand
+//
+//      // CREATORS
+//      explicit Expression(int value)
+//          // Create a node holding the specified 'value'.
+//      : d_operator(0)
+//      , d_value(value)
+//      {
+//      }
+//
+//      Expression(char                                     op,
+//                 const bsl::local_shared_ptr<Expression>& lhs,
+//                 const bsl::local_shared_ptr<Expression>& rhs)
+//          // Create a node applying the specified 'op' to the specified 'lhs'
+//          // and 'rhs' operands.
+//      : d_operator(op)
+//      , d_value(0)
+//      , d_lhs(lhs)
+//      , d_rhs(rhs)
+//      {
+//      }
+//  };
+//
+//  int evaluate(const Expression& expression)
+//      // Return the value of the specified 'expression'.
+//  {
+//      switch (expression.d_operator) {
+//        case '+': return evaluate(*expression.d_lhs)
+//                                             + evaluate(*expression.d_rhs);
+//        case '*': return evaluate(*expression.d_lhs)
+//                                             * evaluate(*expression.d_rhs);
+//      }
+//      return expression.d_value;
+//  }
+//..
+// Then, we build the tree of '(2 + 3) * (2 + 3)', in which the subexpression
+// '2 + 3' is shared by both operands of the product, creating each node
+// in-place using a test allocator:
+//..
+//  bslma::TestAllocator allocator;
+//
+//  bsl::local_shared_ptr<Expression> two, three, sum, product;
+//  two.createInplace(&allocator, 2);
+//  three.createInplace(&allocator, 3);
+//  sum.createInplace(&allocator, '+', two, three);
+//  product.createInplace(&allocator, '*', sum, sum);
+//
+//  assert(25 == evaluate(*product));
+//  assert( 3 == sum.use_count());
+//..
+// Next, we want to publish the finished tree to other threads.  The transfer
+// fails while 'product' is not the only owner of its node:
+//..
+//  bsl::shared_ptr<Expression>       result;
+//  bsl::local_shared_ptr<Expression> extra(product);
+//
+//  assert(0 != extra.moveToShared(&result));
+//  assert(!result);
+//  assert(2 == product.use_count());
+//..
+// Finally, we release every other reference into the tree, so that the tree
+// is reachable only through 'product', and move the ownership of the tree
+// into 'result', which may then be copied and destroyed from any thread:
+//..
+//  extra.reset();
+//  two.reset();
+//  three.reset();
+//  sum.reset();
+//
+//  assert(0 == product.moveToShared(&result));
+//  assert(!product);
+//  assert(25 == evaluate(*result));
+//  assert( 1 == result.use_count());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_SHAREDPTR
+#include <bslstl_sharedptr.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_SHAREDPTRINPLACEREP
+#include <bslma_sharedptrinplacerep.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_SHAREDPTROUTOFPLACEREP
+#include <bslma_sharedptroutofplacerep.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_SHAREDPTRREP
+#include <bslma_sharedptrrep.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ADDLVALUEREFERENCE
+#include <bslmf_addlvaluereference.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_COMPILERFEATURES
+#include <bsls_compilerfeatures.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_UNSPECIFIEDBOOL
+#include <bsls_unspecifiedbool.h>
+#endif
+
+#ifndef INCLUDED_BSLS_UTIL
+#include <bsls_util.h>
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+namespace bsl {
+
+                           // ======================
+                           // class local_shared_ptr
+                           // ======================
+
+template <class ELEMENT_TYPE>
+class local_shared_ptr {
+    // This class provides a shared pointer, similar to 'shared_ptr', that
+    // adjusts the reference count of its representation non-atomically.  All
+    // of the 'local_shared_ptr' objects sharing ownership of an object must be
+    // used from a single thread.  Ownership of an object may be transferred to
+    // a 'shared_ptr' using the checked 'moveToShared' method.
+
+    // DATA
+    ELEMENT_TYPE                     *d_ptr_p;  // address of the referenced
+                                                // object
+
+    BloombergLP::bslma::SharedPtrRep *d_rep_p;  // address of the
+                                                // (reference-counted)
+                                                // representation
+
+    // PRIVATE TYPES
+    typedef local_shared_ptr<ELEMENT_TYPE> SelfType;
+
+    typedef typename BloombergLP::bsls::UnspecifiedBool<local_shared_ptr>::
+                                                         BoolType BoolType;
+
+    // FRIENDS
+    template <class COMPATIBLE_TYPE>
+    friend class local_shared_ptr;
+
+  public:
+    // TYPES
+    typedef ELEMENT_TYPE element_type;
+        // 'element_type' is an alias for the 'ELEMENT_TYPE' parameter of this
+        // class template.
+
+    // CREATORS
+    local_shared_ptr();
+        // Create an empty local shared pointer, i.e., a local shared pointer
+        // that does not refer to any object and has no representation.
+
+    template <class COMPATIBLE_TYPE>
+    explicit local_shared_ptr(
+                       COMPATIBLE_TYPE               *ptr,
+                       BloombergLP::bslma::Allocator *basicAllocator = 0);
+        // Create a local shared pointer that manages a modifiable object of
+        // (template parameter) type 'COMPATIBLE_TYPE' and refers to the
+        // specified 'ptr' cast to a pointer to 'ELEMENT_TYPE'.  Optionally
+        // specify a 'basicAllocator' used to allocate and deallocate the
+        // internal representation of the local shared pointer and to destroy
+        // the shared object when all references have been released; if
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  If 'ptr' is 0, an empty local shared pointer is created.  If
+        // an exception is thrown allocating the internal representation, then
+        // '*ptr' is destroyed and deallocated using 'basicAllocator'.  The
+        // behavior is undefined unless '*ptr' was allocated using
+        // 'basicAllocator' (or the default allocator if 'basicAllocator' is
+        // 0), and 'COMPATIBLE_TYPE *' is convertible to 'ELEMENT_TYPE *'.
+
+    local_shared_ptr(ELEMENT_TYPE *ptr, BloombergLP::bslma::SharedPtrRep *rep);
+        // Create a local shared pointer that takes ownership of the specified
+        // 'rep' and refers to the modifiable object at the specified 'ptr'
+        // address.  The number of references to 'rep' is *NOT* incremented.
+        // The behavior is undefined unless 'rep' is 0, or 'rep' is referred to
+        // by no 'shared_ptr' or 'weak_ptr' object and by no 'local_shared_ptr'
+        // object used by another thread.  Note that this constructor adopts
+        // the representation released from another 'local_shared_ptr' (see
+        // 'release').
+
+    template <class ANY_TYPE>
+    local_shared_ptr(const local_shared_ptr<ANY_TYPE>&  source,
+                     ELEMENT_TYPE                      *object);
+        // Create a local shared pointer that manages the same object as the
+        // specified 'source' local shared pointer (if any), and that refers to
+        // the modifiable object at the specified 'object' address.  The
+        // resulting local shared pointer is known as an "alias" of 'source'.
+        // If 'source' is empty, the resulting local shared pointer is empty
+        // (regardless of the value of 'object').
+
+    template <class COMPATIBLE_TYPE>
+    local_shared_ptr(const local_shared_ptr<COMPATIBLE_TYPE>& other);
+        // Create a local shared pointer that manages the same object (if any)
+        // as the specified 'other' local shared pointer, and refers to the
+        // same object as 'other' cast to a pointer to 'ELEMENT_TYPE'.  If
+        // 'other' is empty, an empty local shared pointer is created.  Note
+        // that this constructor does not participate in overload resolution
+        // unless 'COMPATIBLE_TYPE *' is convertible to 'ELEMENT_TYPE *'.
+
+    local_shared_ptr(const local_shared_ptr& original);
+        // Create a local shared pointer that manages the same object (if any)
+        // as the specified 'original' local shared pointer, and refers to the
+        // same object as 'original'.  If 'original' is empty, an empty local
+        // shared pointer is created.
+
+    ~local_shared_ptr();
+        // Destroy this local shared pointer.  If this local shared pointer
+        // refers to a (possibly shared) object, then release the reference to
+        // that object, and destroy the shared object if this local shared
+        // pointer held the last reference to it.
+
+    // MANIPULATORS
+    local_shared_ptr& operator=(const local_shared_ptr& rhs);
+        // Make this local shared pointer manage the same object as the
+        // specified 'rhs' local shared pointer and refer to the same object as
+        // 'rhs', and return a reference providing modifiable access to this
+        // local shared pointer.  If this local shared pointer is already
+        // managing a (possibly shared) object, then release the reference to
+        // that object, and destroy the shared object if this local shared
+        // pointer held the last reference to it.
+
+    template <class COMPATIBLE_TYPE>
+    local_shared_ptr& operator=(const local_shared_ptr<COMPATIBLE_TYPE>& rhs);
+        // Make this local shared pointer manage the same object as the
+        // specified 'rhs' local shared pointer and refer to the same object as
+        // 'rhs' cast to a pointer to 'ELEMENT_TYPE', and return a reference
+        // providing modifiable access to this local shared pointer.  If this
+        // local shared pointer is already managing a (possibly shared) object,
+        // then release the reference to that object, and destroy the shared
+        // object if this local shared pointer held the last reference to it.
+        // The behavior is undefined unless 'COMPATIBLE_TYPE *' is convertible
+        // to 'ELEMENT_TYPE *'.
+
+    void reset();
+        // Reset this local shared pointer to the empty state.  If this local
+        // shared pointer is managing a (possibly shared) object, then release
+        // the reference to that object, and destroy the shared object if this
+        // local shared pointer held the last reference to it.
+
+    void swap(local_shared_ptr& other);
+        // Efficiently exchange the states of this local shared pointer and the
+        // specified 'other' local shared pointer such that each will refer to
+        // the object formerly referred to by the other and each will manage
+        // the object formerly managed by the other.
+
+    void createInplace(BloombergLP::bslma::Allocator *basicAllocator = 0);
+        // Create "in-place" in a large enough contiguous memory region both an
+        // internal representation for this local shared pointer and a
+        // default-constructed object of 'ELEMENT_TYPE', and make this local
+        // shared pointer refer to the newly-created 'ELEMENT_TYPE' object.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  If an exception is thrown during allocation or construction
+        // of the 'ELEMENT_TYPE' object, this local shared pointer will be
+        // unchanged.  Otherwise, if this local shared pointer is already
+        // managing a (possibly shared) object, then release the reference to
+        // that object, and destroy the shared object if this local shared
+        // pointer held the last reference to it.  Note that the allocator
+        // argument is *not* passed to the constructor for 'ELEMENT_TYPE'.
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)                 \
+ && defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES)
+    template <class... ARGS>
+    void createInplace(BloombergLP::bslma::Allocator *basicAllocator,
+                       ARGS&&...                      args);
+#else
+    template <class A1>
+    void createInplace(BloombergLP::bslma::Allocator *basicAllocator,
+                       const A1&                      a1);
+    template <class A1, class A2>
+    void createInplace(BloombergLP::bslma::Allocator *basicAllocator,
+                       const A1&                      a1,
+                       const A2&                      a2);
+    template <class A1, class A2, class A3>
+    void createInplace(BloombergLP::bslma::Allocator *basicAllocator,
+                       const A1&                      a1,
+                       const A2&                      a2,
+                       const A3&                      a3);
+    template <class A1, class A2, class A3, class A4>
+    void createInplace(BloombergLP::bslma::Allocator *basicAllocator,
+                       const A1&                      a1,
+                       const A2&                      a2,
+                       const A3&                      a3,
+                       const A4&                      a4);
+    template <class A1, class A2, class A3, class A4, class A5>
+    void createInplace(BloombergLP::bslma::Allocator *basicAllocator,
+                       const A1&                      a1,
+                       const A2&                      a2,
+                       const A3&                      a3,
+                       const A4&                      a4,
+                       const A5&                      a5);
+#endif
+        // Create "in-place" in a large enough contiguous memory region, using
+        // the specified 'basicAllocator' to supply memory, both an internal
+        // representation for this local shared pointer and an object of
+        // 'ELEMENT_TYPE' using the 'ELEMENT_TYPE' constructor that takes the
+        // specified 'args...' (or 'a1' up to 'a5') arguments, and make this
+        // local shared pointer refer to the newly-created 'ELEMENT_TYPE'
+        // object.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  If an exception is thrown during the allocation
+        // or construction of the 'ELEMENT_TYPE' object, this local shared
+        // pointer will be unchanged.  Otherwise, if this local shared pointer
+        // is already managing a (possibly shared) object, then release the
+        // reference to that object, and destroy the shared object if this
+        // local shared pointer held the last reference to it.  Note that the
+        // allocator argument is *not* implicitly passed to the constructor for
+        // 'ELEMENT_TYPE'; to construct an object of 'ELEMENT_TYPE' with an
+        // allocator, pass the allocator as one of the arguments.  Also note
+        // that, on platforms not supporting variadic templates, at most five
+        // constructor arguments are supported.
+
+    pair<ELEMENT_TYPE *, BloombergLP::bslma::SharedPtrRep *> release();
+        // Return the pair consisting of the addresses of the modifiable
+        // 'ELEMENT_TYPE' object referred to, and the representation shared by,
+        // this local shared pointer, and reset this local shared pointer to
+        // the empty state, with no effect on the representation.  Note that
+        // the released representation may be adopted only by another
+        // 'local_shared_ptr' used by the same thread (see the constructor
+        // taking a 'bslma::SharedPtrRep').
+
+    int moveToShared(shared_ptr<ELEMENT_TYPE> *result);
+        // Transfer the ownership of the object (if any) managed by this local
+        // shared pointer to the specified 'result' shared pointer, and reset
+        // this local shared pointer to the empty state, if this local shared
+        // pointer is empty or is the only owner of its object.  Return 0 on
+        // success, and a non-zero value (with no effect on either pointer)
+        // otherwise.  If 'result' was managing a (possibly shared) object
+        // prior to a successful transfer, then the reference to that object is
+        // released.  The behavior is undefined unless every other local shared
+        // pointer to an object reachable from the object managed by this local
+        // shared pointer is reachable only through that object.
+
+    // ACCESSORS
+    operator BoolType() const;
+        // Return a value of an "unspecified bool" type that evaluates to
+        // 'false' if this local shared pointer does not refer to an object,
+        // and 'true' otherwise.
+
+    typename add_lvalue_reference<ELEMENT_TYPE>::type operator*() const;
+        // Return a reference providing modifiable access to the object
+        // referred to by this local shared pointer.  The behavior is undefined
+        // unless this local shared pointer refers to an object, and
+        // 'ELEMENT_TYPE' is not (potentially 'const' or 'volatile' qualified)
+        // 'void'.
+
+    ELEMENT_TYPE *operator->() const;
+        // Return the address providing modifiable access to the object
+        // referred to by this local shared pointer, or 0 if this local shared
+        // pointer does not refer to an object.
+
+    ELEMENT_TYPE *get() const;
+        // Return the address providing modifiable access to the object
+        // referred to by this local shared pointer, or 0 if this local shared
+        // pointer does not refer to an object.
+
+    BloombergLP::bslma::SharedPtrRep *rep() const;
+        // Return the address providing modifiable access to the
+        // 'BloombergLP::bslma::SharedPtrRep' object used by this local shared
+        // pointer, or 0 if this local shared pointer is empty.
+
+    bool unique() const;
+        // Return 'true' if this local shared pointer is not empty and does not
+        // share ownership of the object it manages with any other local shared
+        // pointer, and 'false' otherwise.
+
+    long use_count() const;
+        // Return the number of local shared pointers (including this one) that
+        // share ownership of the object managed by this local shared pointer,
+        // or 0 if this local shared pointer is empty.
+};
+
+// FREE OPERATORS
+template <class LHS_TYPE, class RHS_TYPE>
+bool operator==(const local_shared_ptr<LHS_TYPE>& lhs,
+                const local_shared_ptr<RHS_TYPE>& rhs);
+    // Return 'true' if the specified 'lhs' local shared pointer refers to the
+    // same object (if any) as that referred to by the specified 'rhs' local
+    // shared pointer (if any), and 'false' otherwise; a compiler diagnostic
+    // will be emitted indicating the error unless a (raw) pointer to
+    // 'LHS_TYPE' can be compared to a (raw) pointer to 'RHS_TYPE'.
+
+template <class LHS_TYPE, class RHS_TYPE>
+bool operator!=(const local_shared_ptr<LHS_TYPE>& lhs,
+                const local_shared_ptr<RHS_TYPE>& rhs);
+    // Return 'true' if the specified 'lhs' local shared pointer does not refer
+    // to the same object (if any) as that referred to by the specified 'rhs'
+    // local shared pointer (if any), and 'false' otherwise; a compiler
+    // diagnostic will be emitted indicating the error unless a (raw) pointer
+    // to 'LHS_TYPE' can be compared to a (raw) pointer to 'RHS_TYPE'.
+
+template <class LHS_TYPE, class RHS_TYPE>
+bool operator<(const local_shared_ptr<LHS_TYPE>& lhs,
+               const local_shared_ptr<RHS_TYPE>& rhs);
+    // Return 'true' if the address of the object referred to by the specified
+    // 'lhs' local shared pointer is ordered before the address of the object
+    // referred to by the specified 'rhs' local shared pointer under the total
+    // ordering supplied by 'std::less<const void *>', and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class ELEMENT_TYPE>
+void swap(local_shared_ptr<ELEMENT_TYPE>& a,
+          local_shared_ptr<ELEMENT_TYPE>& b);
+    // Efficiently exchange the states of the specified 'a' and 'b' local
+    // shared pointers such that each will refer to the object formerly
+    // referred to by the other, and each will manage the object formerly
+    // managed by the other.
+
+// ===========================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ===========================================================================
+
+                           // ----------------------
+                           // class local_shared_ptr
+                           // ----------------------
+
+// CREATORS
+template <class ELEMENT_TYPE>
+inline
+local_shared_ptr<ELEMENT_TYPE>::local_shared_ptr()
+: d_ptr_p(0)
+, d_rep_p(0)
+{
+}
+
+template <class ELEMENT_TYPE>
+template <class COMPATIBLE_TYPE>
+local_shared_ptr<ELEMENT_TYPE>::local_shared_ptr(
+                                 COMPATIBLE_TYPE               *ptr,
+                                 BloombergLP::bslma::Allocator *basicAllocator)
+: d_ptr_p(ptr)
+, d_rep_p(0)
+{
+    typedef BloombergLP::bslma::SharedPtrOutofplaceRep<
+                                        COMPATIBLE_TYPE,
+                                        BloombergLP::bslma::Allocator *> Rep;
+    if (d_ptr_p) {
+        basicAllocator =
+                       BloombergLP::bslma::Default::allocator(basicAllocator);
+        d_rep_p = Rep::makeOutofplaceRep(ptr, basicAllocator, basicAllocator);
+    }
+}
+
+template <class ELEMENT_TYPE>
+inline
+local_shared_ptr<ELEMENT_TYPE>::local_shared_ptr(
+                                        ELEMENT_TYPE                     *ptr,
+                                        BloombergLP::bslma::SharedPtrRep *rep)
+: d_ptr_p(ptr)
+, d_rep_p(rep)
+{
+}
+
+template <class ELEMENT_TYPE>
+template <class ANY_TYPE>
+inline
+local_shared_ptr<ELEMENT_TYPE>::local_shared_ptr(
+                                const local_shared_ptr<ANY_TYPE>&  source,
+                                ELEMENT_TYPE                      *object)
+: d_ptr_p(source.d_rep_p ? object : 0)
+, d_rep_p(source.d_rep_p)
+{
+    if (d_rep_p) {
+        d_rep_p->acquireRefLocal();
+    }
+}
+
+template <class ELEMENT_TYPE>
+template <class COMPATIBLE_TYPE>
+inline
+local_shared_ptr<ELEMENT_TYPE>::local_shared_ptr(
+                                const local_shared_ptr<COMPATIBLE_TYPE>& other)
+: d_ptr_p(other.d_ptr_p)
+, d_rep_p(other.d_rep_p)
+{
+    if (d_rep_p) {
+        d_rep_p->acquireRefLocal();
+    }
+}
+
+template <class ELEMENT_TYPE>
+inline
+local_shared_ptr<ELEMENT_TYPE>::local_shared_ptr(
+                                              const local_shared_ptr& original)
+: d_ptr_p(original.d_ptr_p)
+, d_rep_p(original.d_rep_p)
+{
+    if (d_rep_p) {
+        d_rep_p->acquireRefLocal();
+    }
+}
+
+template <class ELEMENT_TYPE>
+inline
+local_shared_ptr<ELEMENT_TYPE>::~local_shared_ptr()
+{
+    if (d_rep_p) {
+        d_rep_p->releaseRefLocal();
+    }
+}
+
+// MANIPULATORS
+template <class ELEMENT_TYPE>
+inline
+local_shared_ptr<ELEMENT_TYPE>&
+local_shared_ptr<ELEMENT_TYPE>::operator=(const local_shared_ptr& rhs)
+{
+    // Acquiring the reference of 'rhs' before releasing ours keeps the object
+    // alive in the case that 'rhs' is (reachable only through) '*this'.
+
+    SelfType(rhs).swap(*this);
+    return *this;
+}
+
+template <class ELEMENT_TYPE>
+template <class COMPATIBLE_TYPE>
+inline
+local_shared_ptr<ELEMENT_TYPE>&
+local_shared_ptr<ELEMENT_TYPE>::operator=(
+                                  const local_shared_ptr<COMPATIBLE_TYPE>& rhs)
+{
+    SelfType(rhs).swap(*this);
+    return *this;
+}
+
+template <class ELEMENT_TYPE>
+inline
+void local_shared_ptr<ELEMENT_TYPE>::reset()
+{
+    BloombergLP::bslma::SharedPtrRep *rep = d_rep_p;
+
+    // Clear 'd_rep_p' first so that, if the destructor of the shared object
+    // accesses this local shared pointer, it will be empty.
+
+    d_ptr_p = 0;
+    d_rep_p = 0;
+
+    if (rep) {
+        rep->releaseRefLocal();
+    }
+}
+
+template <class ELEMENT_TYPE>
+inline
+void local_shared_ptr<ELEMENT_TYPE>::swap(local_shared_ptr& other)
+{
+    native_std::swap(d_ptr_p, other.d_ptr_p);
+    native_std::swap(d_rep_p, other.d_rep_p);
+}
+
+template <class ELEMENT_TYPE>
+void local_shared_ptr<ELEMENT_TYPE>::createInplace(
+                                 BloombergLP::bslma::Allocator *basicAllocator)
+{
+    typedef BloombergLP::bslma::SharedPtrInplaceRep<ELEMENT_TYPE> Rep;
+    basicAllocator = BloombergLP::bslma::Default::allocator(basicAllocator);
+    Rep *rep = new (*basicAllocator) Rep(basicAllocator);
+    SelfType(rep->ptr(), rep).swap(*this);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_VARIADIC_TEMPLATES)                 \
+ && defined(BSLS_COMPILERFEATURES_SUPPORT_RVALUE_REFERENCES)
+template <class ELEMENT_TYPE>
+template <class... ARGS>
+void local_shared_ptr<ELEMENT_TYPE>::createInplace(
+                                 BloombergLP::bslma::Allocator *basicAllocator,
+                                 ARGS&&...                      args)
+{
+    typedef BloombergLP::bslma::SharedPtrInplaceRep<ELEMENT_TYPE> Rep;
+    basicAllocator = BloombergLP::bslma::Default::allocator(basicAllocator);
+    Rep *rep = new (*basicAllocator) Rep(basicAllocator,
+                              BloombergLP::bsls::Util::forward<ARGS>(args)...);
+    SelfType(rep->ptr(), rep).swap(*this);
+}
+#else
+template <class ELEMENT_TYPE>
+template <class A1>
+void local_shared_ptr<ELEMENT_TYPE>::createInplace(
+                                 BloombergLP::bslma::Allocator *basicAllocator,
+                                 const A1&                      a1)
+{
+    typedef BloombergLP::bslma::SharedPtrInplaceRep<ELEMENT_TYPE> Rep;
+    basicAllocator = BloombergLP::bslma::Default::allocator(basicAllocator);
+    Rep *rep = new (*basicAllocator) Rep(basicAllocator, a1);
+    SelfType(rep->ptr(), rep).swap(*this);
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2>
+void local_shared_ptr<ELEMENT_TYPE>::createInplace(
+                                 BloombergLP::bslma::Allocator *basicAllocator,
+                                 const A1&                      a1,
+                                 const A2&                      a2)
+{
+    typedef BloombergLP::bslma::SharedPtrInplaceRep<ELEMENT_TYPE> Rep;
+    basicAllocator = BloombergLP::bslma::Default::allocator(basicAllocator);
+    Rep *rep = new (*basicAllocator) Rep(basicAllocator, a1, a2);
+    SelfType(rep->ptr(), rep).swap(*this);
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3>
+void local_shared_ptr<ELEMENT_TYPE>::createInplace(
+                                 BloombergLP::bslma::Allocator *basicAllocator,
+                                 const A1&                      a1,
+                                 const A2&                      a2,
+                                 const A3&                      a3)
+{
+    typedef BloombergLP::bslma::SharedPtrInplaceRep<ELEMENT_TYPE> Rep;
+    basicAllocator = BloombergLP::bslma::Default::allocator(basicAllocator);
+    Rep *rep = new (*basicAllocator) Rep(basicAllocator, a1, a2, a3);
+    SelfType(rep->ptr(), rep).swap(*this);
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4>
+void local_shared_ptr<ELEMENT_TYPE>::createInplace(
+                                 BloombergLP::bslma::Allocator *basicAllocator,
+                                 const A1&                      a1,
+                                 const A2&                      a2,
+                                 const A3&                      a3,
+                                 const A4&                      a4)
+{
+    typedef BloombergLP::bslma::SharedPtrInplaceRep<ELEMENT_TYPE> Rep;
+    basicAllocator = BloombergLP::bslma::Default::allocator(basicAllocator);
+    Rep *rep = new (*basicAllocator) Rep(basicAllocator, a1, a2, a3, a4);
+    SelfType(rep->ptr(), rep).swap(*this);
+}
+
+template <class ELEMENT_TYPE>
+template <class A1, class A2, class A3, class A4, class A5>
+void local_shared_ptr<ELEMENT_TYPE>::createInplace(
+                                 BloombergLP::bslma::Allocator *basicAllocator,
+                                 const A1&                      a1,
+                                 const A2&                      a2,
+                                 const A3&                      a3,
+                                 const A4&                      a4,
+                                 const A5&                      a5)
+{
+    typedef BloombergLP::bslma::SharedPtrInplaceRep<ELEMENT_TYPE> Rep;
+    basicAllocator = BloombergLP::bslma::Default::allocator(basicAllocator);
+    Rep *rep = new (*basicAllocator) Rep(basicAllocator, a1, a2, a3, a4, a5);
+    SelfType(rep->ptr(), rep).swap(*this);
+}
+#endif
+
+template <class ELEMENT_TYPE>
+inline
+pair<ELEMENT_TYPE *, BloombergLP::bslma::SharedPtrRep *>
+local_shared_ptr<ELEMENT_TYPE>::release()
+{
+    pair<ELEMENT_TYPE *, BloombergLP::bslma::SharedPtrRep *> ret(d_ptr_p,
+                                                                 d_rep_p);
+    d_ptr_p = 0;
+    d_rep_p = 0;
+    return ret;
+}
+
+template <class ELEMENT_TYPE>
+int local_shared_ptr<ELEMENT_TYPE>::moveToShared(
+                                             shared_ptr<ELEMENT_TYPE> *result)
+{
+    BSLS_ASSERT_SAFE(result);
+
+    if (d_rep_p && 1 != d_rep_p->numReferences()) {
+        return -1;                                                    // RETURN
+    }
+
+    // The sole reference is handed over unchanged: from here on, the count
+    // is adjusted atomically by the 'shared_ptr' objects sharing it.
+
+    shared_ptr<ELEMENT_TYPE>(d_ptr_p, d_rep_p).swap(*result);
+    d_ptr_p = 0;
+    d_rep_p = 0;
+    return 0;
+}
+
+// ACCESSORS
+template <class ELEMENT_TYPE>
+inline
+#if defined(BSLS_PLATFORM_CMP_IBM)
+local_shared_ptr<ELEMENT_TYPE>::operator
+                                 typename local_shared_ptr::BoolType() const
+#else
+local_shared_ptr<ELEMENT_TYPE>::operator BoolType() const
+#endif
+{
+    return BloombergLP::bsls::UnspecifiedBool<local_shared_ptr>::makeValue(
+                                                                      d_ptr_p);
+}
+
+template <class ELEMENT_TYPE>
+inline
+typename add_lvalue_reference<ELEMENT_TYPE>::type
+local_shared_ptr<ELEMENT_TYPE>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_ptr_p);
+
+    return *d_ptr_p;
+}
+
+template <class ELEMENT_TYPE>
+inline
+ELEMENT_TYPE *local_shared_ptr<ELEMENT_TYPE>::operator->() const
+{
+    return d_ptr_p;
+}
+
+template <class ELEMENT_TYPE>
+inline
+ELEMENT_TYPE *local_shared_ptr<ELEMENT_TYPE>::get() const
+{
+    return d_ptr_p;
+}
+
+template <class ELEMENT_TYPE>
+inline
+BloombergLP::bslma::SharedPtrRep *local_shared_ptr<ELEMENT_TYPE>::rep() const
+{
+    return d_rep_p;
+}
+
+template <class ELEMENT_TYPE>
+inline
+bool local_shared_ptr<ELEMENT_TYPE>::unique() const
+{
+    return 1 == use_count();
+}
+
+template <class ELEMENT_TYPE>
+inline
+long local_shared_ptr<ELEMENT_TYPE>::use_count() const
+{
+    return d_rep_p ? d_rep_p->numReferences() : 0;
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class LHS_TYPE, class RHS_TYPE>
+inline
+bool bsl::operator==(const local_shared_ptr<LHS_TYPE>& lhs,
+                     const local_shared_ptr<RHS_TYPE>& rhs)
+{
+    return lhs.get() == rhs.get();
+}
+
+template <class LHS_TYPE, class RHS_TYPE>
+inline
+bool bsl::operator!=(const local_shared_ptr<LHS_TYPE>& lhs,
+                     const local_shared_ptr<RHS_TYPE>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class LHS_TYPE, class RHS_TYPE>
+inline
+bool bsl::operator<(const local_shared_ptr<LHS_TYPE>& lhs,
+                    const local_shared_ptr<RHS_TYPE>& rhs)
+{
+    return native_std::less<const void *>()(lhs.get(), rhs.get());
+}
+
+// FREE FUNCTIONS
+template <class ELEMENT_TYPE>
+inline
+void bsl::swap(local_shared_ptr<ELEMENT_TYPE>& a,
+               local_shared_ptr<ELEMENT_TYPE>& b)
+{
+    a.swap(b);
+}
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1046 @@
+// bslstl_localsharedptr.t.cpp                                        -*-C++-*-
+#include <bslstl_localsharedptr.h>
+
+#include <bslstl_sharedptr.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is a shared pointer whose reference counting is
+// non-atomic.  The reference count of the representation is verified, using
+// 'use_count' and the 'numReferences' and 'numWeakReferences' accessors of
+// the representation, after each operation that acquires or releases a
+// reference, and the shared object is verified, using a type counting its
+// live instances, to be destroyed exactly when the last reference is released.
+// Memory is verified to be supplied by the allocator passed to
+// 'createInplace' or to the adopting constructor, and 'createInplace' is
+// verified to leave the pointer unchanged if an exception is thrown.  The
+// checked transfer to 'shared_ptr' is verified to succeed exactly when the
+// local shared pointer is empty or unique, and to leave both pointers
+// unchanged otherwise.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] local_shared_ptr();
+// [ 3] explicit local_shared_ptr(COMPATIBLE_TYPE *ptr, Allocator *a = 0);
+// [ 4] local_shared_ptr(ELEMENT_TYPE *ptr, SharedPtrRep *rep);
+// [ 3] local_shared_ptr(const local_shared_ptr<ANY>& s, ELEMENT_TYPE *o);
+// [ 3] local_shared_ptr(const local_shared_ptr<COMPATIBLE_TYPE>& other);
+// [ 3] local_shared_ptr(const local_shared_ptr& original);
+// [ 2] ~local_shared_ptr();
+//
+// MANIPULATORS
+// [ 3] local_shared_ptr& operator=(const local_shared_ptr& rhs);
+// [ 3] local_shared_ptr& operator=(const local_shared_ptr<OTHER>& rhs);
+// [ 3] void reset();
+// [ 3] void swap(local_shared_ptr& other);
+// [ 2] void createInplace(Allocator *basicAllocator = 0);
+// [ 2] void createInplace(Allocator *basicAllocator, ARGS&&... args);
+// [ 4] pair<ELEMENT_TYPE *, SharedPtrRep *> release();
+// [ 5] int moveToShared(shared_ptr<ELEMENT_TYPE> *result);
+//
+// ACCESSORS
+// [ 2] operator BoolType() const;
+// [ 2] add_lvalue_reference<ELEMENT_TYPE>::type operator*() const;
+// [ 2] ELEMENT_TYPE *operator->() const;
+// [ 2] ELEMENT_TYPE *get() const;
+// [ 4] SharedPtrRep *rep() const;
+// [ 2] bool unique() const;
+// [ 2] long use_count() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const local_shared_ptr<L>&, const ...<R>&);
+// [ 4] bool operator!=(const local_shared_ptr<L>&, const ...<R>&);
+// [ 4] bool operator<(const local_shared_ptr<L>&, const ...<R>&);
+//
+// FREE FUNCTIONS
+// [ 3] void swap(local_shared_ptr<E>& a, local_shared_ptr<E>& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+//-----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL HELPER CLASSES FOR TESTING
+//-----------------------------------------------------------------------------
+
+class Base {
+    // This class provides a base class counting its live instances.
+
+    // CLASS DATA
+    static int s_numObjects;  // number of live instances
+
+  public:
+    // CLASS METHODS
+    static int numObjects()
+        // Return the number of live instances of this class.
+    {
+        return s_numObjects;
+    }
+
+    // CREATORS
+    Base()
+        // Create a 'Base' object.
+    {
+        ++s_numObjects;
+    }
+
+    virtual ~Base()
+        // Destroy this object.
+    {
+        --s_numObjects;
+    }
+};
+
+int Base::s_numObjects = 0;
+
+class Counted : public Base {
+    // This class provides an object, derived from 'Base', holding the sum of
+    // up to five integer arguments supplied at construction.
+
+    // DATA
+    int d_sum;  // sum of the constructor arguments
+
+  public:
+    // CREATORS
+    explicit Counted(int a1 = 0, int a2 = 0, int a3 = 0, int a4 = 0,
+                     int a5 = 0)
+        // Create a 'Counted' object holding the sum of the optionally
+        // specified 'a1', 'a2', 'a3', 'a4', and 'a5'.
+    : d_sum(a1 + a2 + a3 + a4 + a5)
+    {
+    }
+
+    // MANIPULATORS
+    void setSum(int value)
+        // Set the sum held by this object to the specified 'value'.
+    {
+        d_sum = value;
+    }
+
+    // ACCESSORS
+    int sum() const
+        // Return the sum held by this object.
+    {
+        return d_sum;
+    }
+};
+
+class Throwing {
+    // This class provides a type whose constructor allocates from a supplied
+    // allocator, and so may throw from a test allocator.
+
+    // DATA
+    bslma::Allocator *d_allocator_p;  // allocator (held, not owned)
+    void             *d_memory_p;     // allocated block (owned)
+
+  public:
+    // CREATORS
+    explicit Throwing(bslma::Allocator *basicAllocator)
+        // Create a 'Throwing' object allocating a block of memory from the
+        // specified 'basicAllocator'.
+    : d_allocator_p(basicAllocator)
+    , d_memory_p(basicAllocator->allocate(16))
+    {
+    }
+
+    ~Throwing()
+        // Destroy this object.
+    {
+        d_allocator_p->deallocate(d_memory_p);
+    }
+};
+
+typedef bsl::local_shared_ptr<Counted> Obj;
+typedef bsl::local_shared_ptr<Base>    BaseObj;
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+namespace UsageExample {
+
+///Example 1: Sharing Subtrees of a Parse Tree
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we are writing an expression parser that represents the
+// expressions it parses as trees in which identical subexpressions are shared,
+// and that the nodes of each tree are owned through shared pointers.  As each
+// tree is built and evaluated by a single thread, we use 'local_shared_ptr'
+// to avoid the cost of atomic reference counting.
+//
+// First, we define the type of the nodes of the tree, each either a number or
+// the sum or the product of two subexpressions:
+//..
+    struct Expression {
+        // This 'struct' describes a node of an expression tree.
+
+        // DATA
+        char                                 d_operator;  // '+', '*', or 0
+        int                                  d_value;     // value if number
+        bsl::local_shared_ptr<Expression>    d_lhs;       // left operand
+        bsl::local_shared_ptr<Expression>    d_rhs;       // right operand
+
+        // CREATORS
+        explicit Expression(int value)
+            // Create a node holding the specified 'value'.
+        : d_operator(0)
+        , d_value(value)
+        {
+        }
+
+        Expression(char                                     op,
+                   const bsl::local_shared_ptr<Expression>& lhs,
+                   const bsl::local_shared_ptr<Expression>& rhs)
+            // Create a node applying the specified 'op' to the specified 'lhs'
+            // and 'rhs' operands.
+        : d_operator(op)
+        , d_value(0)
+        , d_lhs(lhs)
+        , d_rhs(rhs)
+        {
+        }
+    };
+
+    int evaluate(const Expression& expression)
+        // Return the value of the specified 'expression'.
+    {
+        switch (expression.d_operator) {
+          case '+': return evaluate(*expression.d_lhs)
+                                               + evaluate(*expression.d_rhs);
+          case '*': return evaluate(*expression.d_lhs)
+                                               * evaluate(*expression.d_rhs);
+        }
+        return expression.d_value;
+    }
+//..
+
+}  // close namespace UsageExample
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        using namespace UsageExample;
+
+// Then, we build the tree of '(2 + 3) * (2 + 3)', in which the subexpression
+// '2 + 3' is shared by both operands of the product, creating each node
+// in-place using a test allocator:
+//..
+    bslma::TestAllocator allocator;
+
+    bsl::local_shared_ptr<Expression> two, three, sum, product;
+    two.createInplace(&allocator, 2);
+    three.createInplace(&allocator, 3);
+    sum.createInplace(&allocator, '+', two, three);
+    product.createInplace(&allocator, '*', sum, sum);
+
+    ASSERT(25 == evaluate(*product));
+    ASSERT( 3 == sum.use_count());
+//..
+// Next, we want to publish the finished tree to other threads.  The transfer
+// fails while 'product' is not the only owner of its node:
+//..
+    bsl::shared_ptr<Expression>       result;
+    bsl::local_shared_ptr<Expression> extra(product);
+
+    ASSERT(0 != extra.moveToShared(&result));
+    ASSERT(!result);
+    ASSERT(2 == product.use_count());
+//..
+// Finally, we release every other reference into the tree, so that the tree
+// is reachable only through 'product', and move the ownership of the tree
+// into 'result', which may then be copied and destroyed from any thread:
+//..
+    extra.reset();
+    two.reset();
+    three.reset();
+    sum.reset();
+
+    ASSERT(0 == product.moveToShared(&result));
+    ASSERT(!product);
+    ASSERT(25 == evaluate(*result));
+    ASSERT( 1 == result.use_count());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'moveToShared'
+        //
+        // Concerns:
+        //: 1 Moving an empty local shared pointer succeeds, resetting the
+        //:   result to the empty state.
+        //:
+        //: 2 Moving a unique local shared pointer succeeds, transfers the
+        //:   reference (without adjusting the count) to the result, and
+        //:   leaves the local shared pointer empty.
+        //:
+        //: 3 Moving a local shared pointer that is not unique fails, returning
+        //:   a non-zero value and modifying neither pointer.
+        //:
+        //: 4 The reference previously held by the result is released.
+        //:
+        //: 5 After a transfer, the object is destroyed, and the memory of the
+        //:   representation returned to its allocator, when the last
+        //:   'shared_ptr' referring to it is destroyed.
+        //:
+        //: 6 An alias may be moved, and the result refers to the aliased
+        //:   object.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Apply 'moveToShared' to empty, unique, and shared local shared
+        //:   pointers, verifying the return value, both pointers, and the
+        //:   reference counts after each call.  (C-1..4)
+        //:
+        //: 2 Copy the resulting shared pointer, destroy the copies, and
+        //:   verify the number of live objects and of allocated blocks.  (C-5)
+        //:
+        //: 3 Move an alias of a unique local shared pointer.  (C-6)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for a null result.  (C-7)
+        //
+        // Testing:
+        //   int moveToShared(shared_ptr<ELEMENT_TYPE> *result);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'moveToShared'"
+                            "\n======================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tEmpty and unique pointers.\n");
+        {
+            bsl::shared_ptr<Counted> result;
+            result.createInplace(&oa, 7);
+            ASSERT(1 == Base::numObjects());
+
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == mX.moveToShared(&result));
+            ASSERT(!result);
+            ASSERT(!X);
+            ASSERT(0 == Base::numObjects());
+            ASSERT(0 == oa.numBlocksInUse());
+
+            mX.createInplace(&oa, 5);
+            Counted *const PTR = X.get();
+            bslma::SharedPtrRep *const REP = X.rep();
+
+            ASSERT(0 == mX.moveToShared(&result));
+            ASSERT(!X);
+            ASSERT(0   == X.rep());
+            ASSERT(PTR == result.get());
+            ASSERT(REP == result.rep());
+            ASSERT(1   == result.use_count());
+            ASSERT(0   == REP->numWeakReferences());
+            ASSERT(5   == result->sum());
+
+            {
+                bsl::shared_ptr<Counted> copy(result);
+                ASSERT(2 == result.use_count());
+                result.reset();
+                ASSERT(1 == copy.use_count());
+                ASSERT(1 == Base::numObjects());
+            }
+            ASSERT(0 == Base::numObjects());
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tShared pointers.\n");
+        {
+            bsl::shared_ptr<Counted> result;
+            result.createInplace(&oa, 9);
+            Counted *const OLD = result.get();
+
+            Obj mX;  const Obj& X = mX;
+            mX.createInplace(&oa, 3);
+            Counted *const PTR = X.get();
+
+            Obj mY(X);  const Obj& Y = mY;
+            ASSERT(2 == X.use_count());
+
+            ASSERT(0 != mX.moveToShared(&result));
+            ASSERT(0 != mY.moveToShared(&result));
+            ASSERT(PTR == X.get());
+            ASSERT(PTR == Y.get());
+            ASSERT(2   == X.use_count());
+            ASSERT(OLD == result.get());
+            ASSERT(1   == result.use_count());
+            ASSERT(2   == Base::numObjects());
+
+            mY.reset();
+            ASSERT(0   == mX.moveToShared(&result));
+            ASSERT(PTR == result.get());
+            ASSERT(1   == Base::numObjects());
+        }
+        ASSERT(0 == Base::numObjects());
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tAliases.\n");
+        {
+            Obj mX;
+            mX.createInplace(&oa, 4);
+
+            bsl::local_shared_ptr<int> mA(mX, (int *)0);
+            ASSERT(2 == mA.use_count());
+            mX.reset();
+
+            bsl::shared_ptr<int> result;
+            ASSERT(0 == mA.moveToShared(&result));
+            ASSERT(0 == result.get());
+            ASSERT(1 == result.use_count());
+            ASSERT(1 == Base::numObjects());
+        }
+        ASSERT(0 == Base::numObjects());
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            bsl::shared_ptr<Counted> result;
+            Obj mX;
+
+            ASSERT_SAFE_PASS(mX.moveToShared(&result));
+            ASSERT_SAFE_FAIL(mX.moveToShared(0));
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'release', ADOPTION, AND COMPARISON
+        //
+        // Concerns:
+        //: 1 'release' returns the object and representation, leaves the local
+        //:   shared pointer empty, and does not adjust the reference count.
+        //:
+        //: 2 The constructor taking a representation adopts it without
+        //:   adjusting the reference count.
+        //:
+        //: 3 'rep' returns the representation, or 0 if the pointer is empty.
+        //:
+        //: 4 The comparison operators compare the addresses of the objects
+        //:   referred to, including across compatible types.
+        //
+        // Plan:
+        //: 1 Release a local shared pointer, verifying the returned pair and
+        //:   the reference count, and adopt the pair into another local shared
+        //:   pointer.  (C-1..3)
+        //:
+        //: 2 Compare pointers to distinct and identical objects, and to
+        //:   'Base' and 'Counted', using each operator.  (C-4)
+        //
+        // Testing:
+        //   local_shared_ptr(ELEMENT_TYPE *ptr, SharedPtrRep *rep);
+        //   pair<ELEMENT_TYPE *, SharedPtrRep *> release();
+        //   SharedPtrRep *rep() const;
+        //   bool operator==(const local_shared_ptr<L>&, const ...<R>&);
+        //   bool operator!=(const local_shared_ptr<L>&, const ...<R>&);
+        //   bool operator<(const local_shared_ptr<L>&, const ...<R>&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'release', ADOPTION, AND COMPARISON"
+                            "\n===========================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tTesting 'release' and adoption.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(0 == X.rep());
+
+            bsl::pair<Counted *, bslma::SharedPtrRep *> empty = mX.release();
+            ASSERT(0 == empty.first);
+            ASSERT(0 == empty.second);
+
+            mX.createInplace(&oa, 6);
+            Counted *const PTR = X.get();
+            bslma::SharedPtrRep *const REP = X.rep();
+            ASSERT(0 != REP);
+
+            Obj mY(X);
+
+            bsl::pair<Counted *, bslma::SharedPtrRep *> pair = mX.release();
+            ASSERT(PTR == pair.first);
+            ASSERT(REP == pair.second);
+            ASSERT(!X);
+            ASSERT(0 == X.rep());
+            ASSERT(2 == REP->numReferences());
+
+            mY.reset();
+            ASSERT(1 == REP->numReferences());
+            ASSERT(1 == Base::numObjects());
+
+            Obj mZ(pair.first, pair.second);  const Obj& Z = mZ;
+            ASSERT(PTR == Z.get());
+            ASSERT(REP == Z.rep());
+            ASSERT(1   == Z.use_count());
+        }
+        ASSERT(0 == Base::numObjects());
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tTesting comparison.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+            Obj mY;  const Obj& Y = mY;
+
+            ASSERT(  X == Y);
+            ASSERT(!(X != Y));
+            ASSERT(!(X <  Y));
+
+            mX.createInplace(&oa, 1);
+            mY.createInplace(&oa, 2);
+
+            ASSERT(!(X == Y));
+            ASSERT(  X != Y);
+            ASSERT((X < Y) != (Y < X));
+            ASSERT((X < Y) == (X.get() < Y.get()));
+
+            BaseObj mB(X);  const BaseObj& B = mB;
+            ASSERT(  B == X);
+            ASSERT(!(B != X));
+            ASSERT(!(B <  X));
+            ASSERT(!(X <  B));
+            ASSERT(  B != Y);
+        }
+        ASSERT(0 == Base::numObjects());
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING COPYING, CONVERSION, ALIASING, AND ADOPTING A RAW POINTER
+        //
+        // Concerns:
+        //: 1 Copying a local shared pointer, including to a compatible type,
+        //:   increments the reference count, and refers to the same object.
+        //:
+        //: 2 Assignment releases the reference previously held, acquires that
+        //:   of the source, and is alias-safe.
+        //:
+        //: 3 'reset' releases the reference held, destroying the object and
+        //:   deallocating the representation when it is the last.
+        //:
+        //: 4 'swap' (member and free) exchanges the objects and
+        //:   representations without adjusting the reference counts.
+        //:
+        //: 5 An alias shares the reference count of its source and refers to
+        //:   the supplied object, and an alias of an empty pointer is empty.
+        //:
+        //: 6 A raw pointer is adopted using the supplied allocator (or the
+        //:   default allocator) for the representation, and is deleted using
+        //:   that allocator when the last reference is released.
+        //:
+        //: 7 Adopting a null pointer creates an empty pointer.
+        //
+        // Plan:
+        //: 1 Create, copy, assign, reset, and swap local shared pointers,
+        //:   verifying the objects referred to, the reference counts, and the
+        //:   number of live objects after each operation.  (C-1..4)
+        //:
+        //: 2 Create aliases of empty and non-empty pointers.  (C-5)
+        //:
+        //: 3 Adopt objects allocated from an object allocator and from the
+        //:   default allocator, verifying the blocks in use.  (C-6..7)
+        //
+        // Testing:
+        //   explicit local_shared_ptr(COMPATIBLE_TYPE *ptr, Allocator *a = 0);
+        //   local_shared_ptr(const local_shared_ptr<ANY>& s, ELEMENT_TYPE *o);
+        //   local_shared_ptr(const local_shared_ptr<COMPATIBLE_TYPE>& other);
+        //   local_shared_ptr(const local_shared_ptr& original);
+        //   local_shared_ptr& operator=(const local_shared_ptr& rhs);
+        //   local_shared_ptr& operator=(const local_shared_ptr<OTHER>& rhs);
+        //   void reset();
+        //   void swap(local_shared_ptr& other);
+        //   void swap(local_shared_ptr<E>& a, local_shared_ptr<E>& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING COPYING, CONVERSION, ALIASING, AND "
+                            "ADOPTING A RAW POINTER"
+                            "\n==========================================="
+                            "======================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tCopying and assignment.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+            mX.createInplace(&oa, 1);
+
+            Obj mY(X);  const Obj& Y = mY;
+            ASSERT(X.get() == Y.get());
+            ASSERT(2 == X.use_count());
+            ASSERT(!X.unique());
+
+            BaseObj mB(X);  const BaseObj& B = mB;
+            ASSERT(X.get() == B.get());
+            ASSERT(3 == X.use_count());
+
+            Obj mZ;  const Obj& Z = mZ;
+            mZ.createInplace(&oa, 2);
+            ASSERT(2 == Base::numObjects());
+
+            mZ = X;
+            ASSERT(1 == Base::numObjects());
+            ASSERT(X.get() == Z.get());
+            ASSERT(4 == X.use_count());
+
+            mZ = Z;
+            ASSERT(X.get() == Z.get());
+            ASSERT(4 == X.use_count());
+
+            mB = Obj();
+            ASSERT(!B);
+            ASSERT(3 == X.use_count());
+
+            mB = Z;
+            ASSERT(Z.get() == B.get());
+            ASSERT(4 == X.use_count());
+
+            mY.reset();
+            ASSERT(!Y);
+            ASSERT(0 == Y.use_count());
+            ASSERT(3 == X.use_count());
+
+            mX.reset();
+            mZ.reset();
+            ASSERT(1 == B.use_count());
+            ASSERT(B.unique());
+            ASSERT(1 == Base::numObjects());
+
+            mB.reset();
+            ASSERT(0 == Base::numObjects());
+            ASSERT(0 == oa.numBlocksInUse());
+
+            mB.reset();
+            ASSERT(!B);
+        }
+
+        if (verbose) printf("\tSelf-assignment of the last reference.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+            mX.createInplace(&oa, 3);
+
+            mX = X;
+            ASSERT(1 == X.use_count());
+            ASSERT(3 == X->sum());
+        }
+        ASSERT(0 == Base::numObjects());
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tSwap.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+            Obj mY;  const Obj& Y = mY;
+            mX.createInplace(&oa, 1);
+            Obj mW(X);
+
+            Counted             *const PX = X.get();
+            bslma::SharedPtrRep *const RX = X.rep();
+
+            mX.swap(mY);
+            ASSERT(!X);
+            ASSERT(PX == Y.get());
+            ASSERT(RX == Y.rep());
+            ASSERT(2  == Y.use_count());
+
+            swap(mX, mY);
+            ASSERT(!Y);
+            ASSERT(PX == X.get());
+            ASSERT(2  == X.use_count());
+        }
+        ASSERT(0 == Base::numObjects());
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tAliasing.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+
+            int value = 0;
+            bsl::local_shared_ptr<int> mA(X, &value);
+            ASSERT(!mA);
+            ASSERT(0 == mA.rep());
+
+            mX.createInplace(&oa, 5);
+            bsl::local_shared_ptr<int> mB(X, &value);
+            ASSERT(&value  == mB.get());
+            ASSERT(X.rep() == mB.rep());
+            ASSERT(2 == X.use_count());
+
+            mX.reset();
+            ASSERT(1 == Base::numObjects());
+            ASSERT(1 == mB.use_count());
+
+            mB.reset();
+            ASSERT(0 == Base::numObjects());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tAdopting raw pointers.\n");
+        {
+            Counted *ptr = new (oa) Counted(8);
+            ASSERT(1 == oa.numBlocksInUse());
+
+            BaseObj mX(ptr, &oa);  const BaseObj& X = mX;
+            ASSERT(ptr == X.get());
+            ASSERT(1   == X.use_count());
+            ASSERT(2   == oa.numBlocksInUse());
+
+            BaseObj mY(X);
+            mX.reset();
+            ASSERT(1 == Base::numObjects());
+            mY.reset();
+            ASSERT(0 == Base::numObjects());
+            ASSERT(0 == oa.numBlocksInUse());
+
+            Counted *dptr = new (defaultAllocator) Counted(9);
+            {
+                Obj mZ(dptr);  const Obj& Z = mZ;
+                ASSERT(9 == Z->sum());
+                ASSERT(2 == defaultAllocator.numBlocksInUse());
+            }
+            ASSERT(0 == Base::numObjects());
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+            const bsls::Types::Int64 TOTAL = oa.numBlocksTotal();
+
+            Obj mN((Counted *)0, &oa);  const Obj& N = mN;
+            ASSERT(!N);
+            ASSERT(0     == N.rep());
+            ASSERT(TOTAL == oa.numBlocksTotal());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING 'createInplace' AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed local shared pointer is empty.
+        //:
+        //: 2 'createInplace' constructs the object, using the supplied
+        //:   arguments, in a single block allocated from the supplied
+        //:   allocator, or from the default allocator if none is supplied.
+        //:
+        //: 3 'createInplace' on a non-empty pointer releases the reference
+        //:   previously held.
+        //:
+        //: 4 The accessors return the object, and the reference count, of the
+        //:   representation.
+        //:
+        //: 5 The destructor releases the reference held, destroying the object
+        //:   and deallocating the representation when it is the last.
+        //:
+        //: 6 If an exception is thrown while the object is constructed or the
+        //:   representation allocated, the pointer is unchanged and no memory
+        //:   is leaked.
+        //:
+        //: 7 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create objects using 'createInplace' with zero to five arguments
+        //:   and with and without an allocator, verifying the accessors, the
+        //:   number of live objects, and the blocks in use.  (C-1..5)
+        //:
+        //: 2 Invoke 'createInplace' for a type whose constructor allocates,
+        //:   within the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros.  (C-6)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for dereferencing an empty pointer.  (C-7)
+        //
+        // Testing:
+        //   local_shared_ptr();
+        //   ~local_shared_ptr();
+        //   void createInplace(Allocator *basicAllocator = 0);
+        //   void createInplace(Allocator *basicAllocator, ARGS&&... args);
+        //   operator BoolType() const;
+        //   add_lvalue_reference<ELEMENT_TYPE>::type operator*() const;
+        //   ELEMENT_TYPE *operator->() const;
+        //   ELEMENT_TYPE *get() const;
+        //   bool unique() const;
+        //   long use_count() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'createInplace' AND BASIC ACCESSORS"
+                            "\n===========================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tDefault construction.\n");
+        {
+            const Obj X;
+            ASSERT(!X);
+            ASSERT(0 == X.get());
+            ASSERT(0 == X.operator->());
+            ASSERT(0 == X.use_count());
+            ASSERT(!X.unique());
+        }
+
+        if (verbose) printf("\t'createInplace' with 0 to 5 arguments.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+
+            mX.createInplace(&oa);
+            ASSERT(X);
+            ASSERT(0 == X->sum());
+            ASSERT(1 == X.use_count());
+            ASSERT(X.unique());
+            ASSERT(1 == Base::numObjects());
+            ASSERT(1 == oa.numBlocksInUse());
+
+            mX.createInplace(&oa, 1);
+            ASSERT(1  == X->sum());
+            ASSERT(1  == Base::numObjects());
+            ASSERT(1  == oa.numBlocksInUse());
+
+            mX.createInplace(&oa, 1, 2);
+            ASSERT(3  == X->sum());
+
+            mX.createInplace(&oa, 1, 2, 3);
+            ASSERT(6  == X->sum());
+
+            mX.createInplace(&oa, 1, 2, 3, 4);
+            ASSERT(10 == X->sum());
+
+            mX.createInplace(&oa, 1, 2, 3, 4, 5);
+            ASSERT(15 == (*X).sum());
+            ASSERT(&*X == X.get());
+            ASSERT(1  == Base::numObjects());
+            ASSERT(1  == oa.numBlocksInUse());
+            ASSERT(6  == oa.numBlocksTotal());
+
+            (*X).setSum(42);
+            ASSERT(42 == X.get()->sum());
+
+            ASSERT(0 == defaultAllocator.numBlocksTotal());
+        }
+        ASSERT(0 == Base::numObjects());
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tUsing the default allocator.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+            mX.createInplace();
+            ASSERT(X);
+            ASSERT(1 == defaultAllocator.numBlocksInUse());
+
+            mX.createInplace(0, 7);
+            ASSERT(7 == X->sum());
+            ASSERT(1 == defaultAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) printf("\tException safety.\n");
+        {
+            bsl::local_shared_ptr<Throwing> mX;
+            mX.createInplace(&oa, &oa);
+            const Throwing *const PTR = mX.get();
+            const bsls::Types::Int64 IN_USE = oa.numBlocksInUse();
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                ASSERT(PTR == mX.get());
+                ASSERT(1   == mX.use_count());
+                ASSERT(IN_USE == oa.numBlocksInUse());
+
+                mX.createInplace(&oa, &oa);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERT(PTR != mX.get());
+            ASSERT(IN_USE == oa.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX;  const Obj& X = mX;
+            ASSERT_SAFE_FAIL(*X);
+
+            mX.createInplace(&oa);
+            ASSERT_SAFE_PASS(*X);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create, copy, and destroy local shared pointers, verifying the
+        //:   reference count and the lifetime of the shared object.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(!X);
+
+            mX.createInplace(&oa, 1, 2);
+            ASSERT(X);
+            ASSERT(3 == X->sum());
+            ASSERT(1 == X.use_count());
+            {
+                Obj mY(X);  const Obj& Y = mY;
+                ASSERT(2 == X.use_count());
+                ASSERT(X == Y);
+            }
+            ASSERT(1 == X.use_count());
+            ASSERT(1 == Base::numObjects());
+
+            bsl::shared_ptr<Counted> shared;
+            ASSERT(0 == mX.moveToShared(&shared));
+            ASSERT(!X);
+            ASSERT(3 == shared->sum());
+        }
+        ASSERT(0 == Base::numObjects());
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
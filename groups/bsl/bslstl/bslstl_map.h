@@ -89,6 +89,38 @@ BSLS_IDENT("$Id: $")
 // (template parameter) type 'KEY' and 'VALUE', if respectively, the types
 // define the 'bslma::UsesBslmaAllocator' trait.
 //
+///Heterogeneous Lookup
+///--------------------
+// If the (template parameter) type 'COMPARATOR' is *transparent* (i.e.,
+// declares a nested type named 'is_transparent', as does 'std::less<void>' in
+// C++14), the 'find', 'count', 'contains', 'lower_bound', 'upper_bound', and
+// 'equal_range' methods of 'map' provide additional overloads that accept a
+// key of any type that 'COMPARATOR' can compare with the key of an element.
+// These overloads do not convert the supplied key to 'KEY', so, for example, a
+// 'map' keyed on 'bsl::string' can be searched using a 'bslstl::StringRef' or
+// a 'const char *' without constructing (and allocating memory for) a
+// temporary 'bsl::string'.  If 'COMPARATOR' is not transparent, these
+// overloads do not participate in overload resolution, and the key supplied to
+// a lookup method is converted to 'KEY'.
+//
+///Node Handles
+///------------
+// The 'extract' methods of 'map' unlink an element from the container and
+// return it, without copying or destroying it, in a 'node_type' object (a
+// *node* *handle*, see 'bslstl_nodehandle') that owns the element until it is
+// inserted into another container, or until the node handle is destroyed.
+// Passing a node handle to the overloads of 'insert' taking a 'node_type'
+// links the element into the target container, and 'merge' transfers
+// elements directly from another 'map' or 'multimap' having the same
+// allocator type.  When the allocators of the two containers compare equal,
+// no element is copied and no node is allocated: the node (and the memory
+// block that holds it) is handed over to the target container, whose node pool
+// keeps that block alive even if the source container is subsequently
+// destroyed.  When the allocators differ, the element is instead copied into
+// a node supplied by the target container, and the original is destroyed.
+// Note that, absent move semantics, 'node_type' *transfers* ownership when
+// copied or assigned, leaving the source handle empty.
+//
 ///Operations
 ///----------
 // This section describes the run-time complexity of operations on instances
@@ -107,6 +139,7 @@ BSLS_IDENT("$Id: $")
 //  'k'             - an object of type 'K'
 //  'v'             - an object of type 'V'
 //  'p1', 'p2'      - two iterators belonging to 'a'
+//  'nh'            - an object of type 'node_type'
 //  distance(i1,i2) - the number of elements in the range [i1, i2)
 //
 //  +----------------------------------------------------+--------------------+
@@ -169,6 +202,21 @@ BSLS_IDENT("$Id: $")
 //  |                                                    | where N is         |
 //  |                                                    | n + distance(i1,i2)|
 //  +----------------------------------------------------+--------------------+
+//  | a.insert(nh)                                       | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(p1, nh)                                   | amortized constant |
+//  |                                                    | if the node is     |
+//  |                                                    | inserted right     |
+//  |                                                    | before p1,         |
+//  |                                                    | O[log(n)]          |
+//  |                                                    | otherwise          |
+//  +----------------------------------------------------+--------------------+
+//  | a.extract(p1)                                      | amortized constant |
+//  +----------------------------------------------------+--------------------+
+//  | a.extract(k)                                       | O[log(n)]          |
+//  +----------------------------------------------------+--------------------+
+//  | a.merge(b)                                         | O[m * log(n + m)]  |
+//  +----------------------------------------------------+--------------------+
 //  | a.erase(p1)                                        | amortized constant |
 //  +----------------------------------------------------+--------------------+
 //  | a.erase(k)                                         | O[log(n) +         |
@@ -182,6 +230,8 @@ BSLS_IDENT("$Id: $")
 //  +----------------------------------------------------+--------------------+
 //  | a.clear()                                          | O[n]               |
 //  +----------------------------------------------------+--------------------+
+//  | a.compact()                                        | O[n]               |
+//  +----------------------------------------------------+--------------------+
 //  | a.key_comp()                                       | O[1]               |
 //  +----------------------------------------------------+--------------------+
 //  | a.value_comp()                                     | O[1]               |
@@ -413,6 +463,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_mapcomparator.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_NODEHANDLE
+#include <bslstl_nodehandle.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_PAIR
 #include <bslstl_pair.h>
 #endif
@@ -457,6 +511,14 @@ BSL_OVERRIDES_STD mode"
 #include <bslalg_typetraithasstliterators.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ENABLEIF
+#include <bslmf_enableif.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISTRANSPARENTPREDICATE
+#include <bslmf_istransparentpredicate.h>
+#endif
+
 #ifndef INCLUDED_BSLS_ASSERT
 #include <bsls_assert.h>
 #endif
@@ -472,6 +534,9 @@ BSL_OVERRIDES_STD mode"
 
 namespace bsl {
 
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+class multimap;
+
                              // =========
                              // class map
                              // =========
@@ -564,6 +629,12 @@ class map {
     typedef bsl::reverse_iterator<iterator>            reverse_iterator;
     typedef bsl::reverse_iterator<const_iterator>      const_reverse_iterator;
 
+    typedef BloombergLP::bslstl::MapNodeHandle<NodeFactory, ALLOCATOR>
+                                                                     node_type;
+    typedef BloombergLP::bslstl::NodeInsertReturnType<iterator,
+                                                       node_type>
+                                                            insert_return_type;
+
     class value_compare {
         // This nested class defines a mechanism for comparing two objects of
         // 'value_type' using the (template parameter) type 'COMPARATOR'.  Note
@@ -631,6 +702,28 @@ class map {
         // no-throw exception-safety guarantee.  The behavior is undefined
         // unless this object was created with the same allocator as 'other'.
 
+    template <class SOURCE>
+    void mergeNodes(SOURCE *source);
+        // Transfer into this map each element of the specified 'source'
+        // container whose key is not already present in this map, leaving
+        // the remaining elements in 'source'.  Relink the transferred nodes
+        // if the allocator of 'source' compares equal to that of this map,
+        // and copy them into new nodes otherwise.
+
+    template <class INPUT_ITERATOR>
+    void insertSortedPrefix(INPUT_ITERATOR *first, INPUT_ITERATOR last);
+        // Insert into this map, which must be empty, the values in the range
+        // starting at the specified '*first' iterator and ending immediately
+        // before the specified 'last' iterator, skipping each value whose key
+        // is equivalent to that of its predecessor, for as long as each value
+        // is not ordered before its predecessor; if a value is ordered before
+        // its predecessor, insert it individually and load into 'first' the
+        // position following it, and otherwise load 'last' into 'first'.  The
+        // nodes for the ordered values are created in order, linked into a
+        // chain, and then formed into a perfectly balanced tree in linear
+        // time, without rebalancing on each insertion.  The behavior is
+        // undefined unless this map is empty.
+
     // PRIVATE ACCESSORS
     const NodeFactory& nodeFactory() const;
         // Return a reference providing non-modifiable access to the node
@@ -810,13 +903,43 @@ class map {
         // Insert into this map the value of each 'value_type' object in the
         // range starting at the specified 'first' iterator and ending
         // immediately before the specified 'last' iterator, whose key is not
-        // already contained in this map.  The (template parameter) type
+        // already contained in this map.  If this map is empty and the range
+        // is ordered according to the comparator of this map, this operation
+        // has O[N] complexity, where N is the number of values in the range,
+        // and builds a perfectly balanced tree.  The (template parameter) type
         // 'INPUT_ITERATOR' shall meet the requirements of an input iterator
         // defined in the C++11 standard [24.2.3] providing access to values of
         // a type convertible to 'value_type'.  This method requires that the
         // (template parameter) types 'KEY' and 'VALUE' both be
         // "copy-constructible" (see {Requirements on 'KEY' and 'VALUE'}).
 
+    insert_return_type insert(const node_type& node);
+        // Insert the element owned by the specified 'node' handle into this
+        // map if its key does not already exist in this map, and leave
+        // 'node' empty; otherwise, if an element having the same key already
+        // exists in this map, this method has no effect on this map.
+        // Return an 'insert_return_type' object whose 'position' member
+        // refers to the (possibly newly inserted) element having the key of
+        // the node, whose 'inserted' member is 'true' if the node was
+        // inserted and 'false' otherwise, and whose 'node' member is empty if
+        // the node was inserted, and has taken ownership of the node from
+        // 'node' otherwise.  If 'node' is empty, return an object whose
+        // 'position' is 'end()', whose 'inserted' member is 'false', and
+        // whose 'node' is empty.  No node is allocated if the allocator of
+        // 'node' compares equal to that of this map (see {Node Handles}).
+
+    iterator insert(const_iterator hint, const node_type& node);
+        // Insert the element owned by the specified 'node' handle into this
+        // map (in amortized constant time if the specified 'hint' is a
+        // valid immediate successor to the key of the node), if its key does
+        // not already exist in this map, and leave 'node' empty;
+        // otherwise, leave both this map and 'node' unchanged.  Return an
+        // iterator referring to the (possibly newly inserted) element having
+        // the key of the node, or 'end()' if 'node' is empty.  No node is
+        // allocated if the allocator of 'node' compares equal to that of this
+        // map.  The behavior is undefined unless 'hint' is a valid
+        // iterator into this map.
+
     iterator erase(const_iterator position);
         // Remove from this map the 'value_type' object at the specified
         // 'position', and return an iterator referring to the element
@@ -838,6 +961,32 @@ class map {
         // 'end' iterator, and the 'first' position is at or before the 'last'
         // position in the ordered sequence provided by this container.
 
+    node_type extract(const_iterator position);
+        // Remove from this map the element at the specified 'position'
+        // without destroying it, and return a node handle owning that
+        // element.  The element remains valid (and references to it remain
+        // valid) until it is inserted into another container or the node
+        // handle is destroyed.  The behavior is undefined unless 'position'
+        // refers to an element in this map.
+
+    node_type extract(const key_type& key);
+        // Remove from this map the element having the specified 'key', if
+        // it exists, without destroying it, and return a node handle owning
+        // that element; otherwise, return an empty node handle with no other
+        // effect.
+
+    template <class COMPARATOR2>
+    void merge(map<KEY, VALUE, COMPARATOR2, ALLOCATOR>& source);
+    template <class COMPARATOR2>
+    void merge(multimap<KEY, VALUE, COMPARATOR2, ALLOCATOR>& source);
+        // Transfer into this map each element of the specified 'source'
+        // whose key does not already exist in this map, leaving the
+        // remaining elements in 'source'.  If the allocator of 'source'
+        // compares equal to that of this map, the elements are relinked
+        // without being copied and no new nodes are allocated; otherwise each
+        // transferred element is copied into a node supplied by this map
+        // and then erased from 'source'.
+
     void swap(map& other);
         // Exchange the value of this object as well as its comparator with
         // those of the specified 'other' object.  Additionally if
@@ -853,6 +1002,19 @@ class map {
         // Remove all entries from this map.  Note that the map is empty after
         // this call, but allocated memory may be retained for future use.
 
+    void compact();
+        // Reallocate every node of this map contiguously, in key order, from
+        // a single new chunk of memory supplied by the allocator of this map,
+        // and release the memory previously held for nodes, restoring the
+        // locality of a map whose nodes have become scattered by a history
+        // of insertions and erasures.  If this map is empty, only release the
+        // memory held for nodes.  The value of this map is unchanged, but all
+        // iterators, pointers, and references to its elements are
+        // invalidated.  If an exception is thrown, this method has no effect.
+        // Note that each element is copy-constructed into its new node, so
+        // that memory allocated by the elements themselves is also laid out
+        // in key order.
+
     iterator find(const key_type& key);
         // Return an iterator providing modifiable access to the 'value_type'
         // object in this map having the specified 'key', if such an entry
@@ -889,6 +1051,87 @@ class map {
         // returned iterators will have the same value.  Note that since a map
         // maintains unique keys, the range will contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object in this map whose key is equivalent to the specified 'key',
+        // if such an entry exists, and the past-the-end ('end') iterator
+        // otherwise.  This method does not participate in overload resolution
+        // unless 'COMPARATOR' is transparent (see {Heterogeneous Lookup}).
+    {
+        return iterator(BloombergLP::bslalg::RbTreeUtil::find(
+                                                            d_tree,
+                                                            this->comparator(),
+                                                            key));
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    lower_bound(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this map whose key is not
+        // ordered before the specified 'key', and the past-the-end iterator if
+        // no such object exists.  This method does not participate in overload
+        // resolution unless 'COMPARATOR' is transparent (see {Heterogeneous
+        // Lookup}).
+    {
+        return iterator(BloombergLP::bslalg::RbTreeUtil::lowerBound(
+                                                            d_tree,
+                                                            this->comparator(),
+                                                            key));
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        iterator>::type
+    upper_bound(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first (i.e.,
+        // ordered least) 'value_type' object in this map whose key is ordered
+        // after the specified 'key', and the past-the-end iterator if no such
+        // object exists.  This method does not participate in overload
+        // resolution unless 'COMPARATOR' is transparent (see {Heterogeneous
+        // Lookup}).
+    {
+        return iterator(BloombergLP::bslalg::RbTreeUtil::upperBound(
+                                                            d_tree,
+                                                            this->comparator(),
+                                                            key));
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        bsl::pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this map whose key is equivalent
+        // to the specified 'key', where the first iterator is positioned at
+        // the start of the sequence and the second iterator is positioned one
+        // past the end of the sequence.  If this map contains no such objects,
+        // the two returned iterators will have the same value.  This method
+        // does not participate in overload resolution unless 'COMPARATOR' is
+        // transparent (see {Heterogeneous Lookup}).  Note that, unlike the
+        // 'key_type' overload, the range may contain more than one element if
+        // the comparator treats several keys as equivalent to 'key'.
+    {
+        iterator startIt = lower_bound(key);
+        iterator endIt   = startIt;
+        if (endIt != end() && !comparator()(key, *endIt.node())) {
+            endIt = upper_bound(key);
+        }
+        return bsl::pair<iterator, iterator>(startIt, endIt);
+    }
+
     // ACCESSORS
     allocator_type get_allocator() const;
         // Return (a copy of) the allocator used for memory allocation by this
@@ -976,6 +1219,10 @@ class map {
         // specified 'key'.  Note that since a map maintains unique keys, the
         // returned value will be either 0 or 1.
 
+    bool contains(const key_type& key) const;
+        // Return 'true' if this map contains a 'value_type' object having the
+        // specified 'key', and 'false' otherwise.
+
     const_iterator lower_bound(const key_type& key) const;
         // Return an iterator providing non-modifiable access to the first
         // (i.e., ordered least) 'value_type' object in this map whose key is
@@ -1009,6 +1256,122 @@ class map {
         // value.  Note that since a map maintains unique keys, the range will
         // contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this map whose key is equivalent to the
+        // specified 'key', if such an entry exists, and the past-the-end
+        // ('end') iterator otherwise.  This method does not participate in
+        // overload resolution unless 'COMPARATOR' is transparent (see
+        // {Heterogeneous Lookup}).
+    {
+        return const_iterator(BloombergLP::bslalg::RbTreeUtil::find(
+                                                            d_tree,
+                                                            this->comparator(),
+                                                            key));
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of 'value_type' objects within this map whose key
+        // is equivalent to the specified 'key'.  This method does not
+        // participate in overload resolution unless 'COMPARATOR' is
+        // transparent (see {Heterogeneous Lookup}).
+    {
+        size_type      cnt = 0;
+        const_iterator it  = lower_bound(key);
+        while (it != end() && !comparator()(key, *it.node())) {
+            ++it;
+            ++cnt;
+        }
+        return cnt;
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this map contains a 'value_type' object whose key
+        // is equivalent to the specified 'key', and 'false' otherwise.  This
+        // method does not participate in overload resolution unless
+        // 'COMPARATOR' is transparent (see {Heterogeneous Lookup}).
+    {
+        return find(key) != end();
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    lower_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this map whose key is
+        // not ordered before the specified 'key', and the past-the-end
+        // iterator if no such object exists.  This method does not participate
+        // in overload resolution unless 'COMPARATOR' is transparent (see
+        // {Heterogeneous Lookup}).
+    {
+        return const_iterator(BloombergLP::bslalg::RbTreeUtil::lowerBound(
+                                                            d_tree,
+                                                            this->comparator(),
+                                                            key));
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        const_iterator>::type
+    upper_bound(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // (i.e., ordered least) 'value_type' object in this map whose key is
+        // ordered after the specified 'key', and the past-the-end iterator if
+        // no such object exists.  This method does not participate in overload
+        // resolution unless 'COMPARATOR' is transparent (see {Heterogeneous
+        // Lookup}).
+    {
+        return const_iterator(BloombergLP::bslalg::RbTreeUtil::upperBound(
+                                                            d_tree,
+                                                            this->comparator(),
+                                                            key));
+    }
+
+    template <class LOOKUP_KEY>
+    typename bsl::enable_if<
+        BloombergLP::bslmf::IsTransparentPredicate<COMPARATOR,
+                                                   LOOKUP_KEY>::value,
+        bsl::pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this map whose key is equivalent
+        // to the specified 'key', where the first iterator is positioned at
+        // the start of the sequence and the second iterator is positioned one
+        // past the end of the sequence.  If this map contains no such objects,
+        // the two returned iterators will have the same value.  This method
+        // does not participate in overload resolution unless 'COMPARATOR' is
+        // transparent (see {Heterogeneous Lookup}).  Note that, unlike the
+        // 'key_type' overload, the range may contain more than one element if
+        // the comparator treats several keys as equivalent to 'key'.
+    {
+        const_iterator startIt = lower_bound(key);
+        const_iterator endIt   = startIt;
+        if (endIt != end() && !comparator()(key, *endIt.node())) {
+            endIt = upper_bound(key);
+        }
+        return bsl::pair<const_iterator, const_iterator>(startIt, endIt);
+    }
+
     // NOT IMPLEMENTED
         // The following methods are defined by the C++11 standard, but they
         // are not implemented as they require some level of C++11 compiler
@@ -1221,6 +1584,93 @@ void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::quickSwap(map& other)
     }
 }
 
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class SOURCE>
+void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::mergeNodes(SOURCE *source)
+{
+    const bool relink = get_allocator() == source->get_allocator();
+
+    typename SOURCE::iterator it = source->begin();
+    while (it != source->end()) {
+        int comparisonResult;
+        BloombergLP::bslalg::RbTreeNode *insertLocation =
+            BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            it->first);
+        if (!comparisonResult) {
+            ++it;
+        }
+        else {
+            BloombergLP::bslalg::RbTreeNode *node;
+            if (relink) {
+                // Reserve first, so that adopting the extracted node cannot
+                // throw (and destroy the element).
+
+                nodeFactory().reserveAdoption();
+                node = source->extract(it++).release(&nodeFactory());
+            }
+            else {
+                node = nodeFactory().createNode(*it);
+                source->erase(it++);
+            }
+            BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                                      insertLocation,
+                                                      comparisonResult < 0,
+                                                      node);
+        }
+    }
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insertSortedPrefix(
+                                                         INPUT_ITERATOR *first,
+                                                         INPUT_ITERATOR  last)
+{
+    BSLS_ASSERT_SAFE(0 == d_tree.rootNode());
+
+    // Link the nodes, without rebalancing, into a chain for as long as the
+    // values are ordered, and then balance the chain in a single pass.  The
+    // proctor balances the partially built chain if an exception is thrown,
+    // so that the values appended so far remain in this map.
+
+    BloombergLP::bslalg::RbTreeUtilChainProctor proctor(&d_tree);
+
+    BloombergLP::bslalg::RbTreeNode *lastNode = d_tree.sentinel();
+    for (; *first != last; ++*first) {
+        const value_type& value = **first;
+        if (d_tree.sentinel() != lastNode) {
+            if (this->comparator()(value.first, *lastNode)) {
+                // 'value' is out of order: balance the nodes linked so far,
+                // and insert 'value' individually, as an input iterator cannot
+                // be dereferenced again.
+
+                BloombergLP::bslalg::RbTreeUtil::balanceChain(&d_tree);
+                proctor.release();
+
+                insert(value);
+                ++*first;
+                return;                                               // RETURN
+            }
+            if (!this->comparator()(*lastNode, value.first)) {
+                continue;
+            }
+        }
+
+        BloombergLP::bslalg::RbTreeNode *node =
+                                               nodeFactory().createNode(value);
+        BloombergLP::bslalg::RbTreeUtil::appendToChain(&d_tree,
+                                                       lastNode,
+                                                       node);
+        lastNode = node;
+    }
+    BloombergLP::bslalg::RbTreeUtil::balanceChain(&d_tree);
+
+    proctor.release();
+}
+
 // PRIVATE ACCESSORS
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
@@ -1293,34 +1743,13 @@ map<KEY, VALUE, COMPARATOR, ALLOCATOR>::map(INPUT_ITERATOR    first,
                                                                &d_tree,
                                                                &nodeFactory());
 
-        // The following loop guarantees amortized linear time to insert an
-        // ordered sequence of values (as required by the standard).   If the
-        // values are in sorted order, we are guaranteed the next node can be
-        // inserted as the right child of the previous node, and can call
-        // 'insertAt' without 'findUniqueInsertLocation'.
+        // An ordered sequence of values is linked directly into a balanced
+        // tree in linear time (see 'insertSortedPrefix'); the first
+        // out-of-order value, and any values following it, are inserted
+        // individually.
 
-        insert(*first);
-        BloombergLP::bslalg::RbTreeNode *prevNode = d_tree.rootNode();
-        while (++first != last) {
-            // The values are not in order, so insert them normally.
+        insert(first, last);
 
-            const value_type& value = *first;
-            if (this->comparator()(value.first, *prevNode)) {
-                insert(value);
-                insert(++first, last);
-                break;
-            }
-
-            if (this->comparator()(*prevNode, value.first)) {
-                BloombergLP::bslalg::RbTreeNode *node =
-                                               nodeFactory().createNode(value);
-                BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
-                                                          prevNode,
-                                                          false,
-                                                          node);
-                prevNode = node;
-            }
-        }
         proctor.release();
     }
 }
@@ -1443,6 +1872,9 @@ inline
 void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
                                                     INPUT_ITERATOR last)
 {
+    if (0 == d_tree.rootNode()) {
+        insertSortedPrefix(&first, last);
+    }
     while (first != last) {
         insert(*first);
         ++first;
@@ -1477,6 +1909,63 @@ map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
     return iterator(node);
 }
 
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert_return_type
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const node_type& node)
+{
+    if (node.empty()) {
+        return insert_return_type(end(), false, node_type());         // RETURN
+    }
+
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            node.key());
+    if (!comparisonResult) {
+        return insert_return_type(iterator(insertLocation), false, node);
+                                                                      // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *newNode = node.release(&nodeFactory());
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              newNode);
+    return insert_return_type(iterator(newNode), true, node_type());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const_iterator   hint,
+                                               const node_type& node)
+{
+    if (node.empty()) {
+        return end();                                                 // RETURN
+    }
+
+    BloombergLP::bslalg::RbTreeNode *hintNode =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(hint.node());
+    int comparisonResult;
+    BloombergLP::bslalg::RbTreeNode *insertLocation =
+        BloombergLP::bslalg::RbTreeUtil::findUniqueInsertLocation(
+                                                            &comparisonResult,
+                                                            &d_tree,
+                                                            this->comparator(),
+                                                            node.key(),
+                                                            hintNode);
+    if (!comparisonResult) {
+        return iterator(insertLocation);                              // RETURN
+    }
+    BloombergLP::bslalg::RbTreeNode *newNode = node.release(&nodeFactory());
+    BloombergLP::bslalg::RbTreeUtil::insertAt(&d_tree,
+                                              insertLocation,
+                                              comparisonResult < 0,
+                                              newNode);
+    return iterator(newNode);
+}
+
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
 typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
@@ -1518,6 +2007,48 @@ map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
     return iterator(last.node());
 }
 
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::node_type
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::extract(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    BloombergLP::bslalg::RbTreeNode *node =
+                const_cast<BloombergLP::bslalg::RbTreeNode *>(position.node());
+    typename NodeFactory::Chunk *chunk = nodeFactory().lendNode(node);
+    BloombergLP::bslalg::RbTreeUtil::remove(&d_tree, node);
+    return node_type(toNode(node), chunk, get_allocator());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::node_type
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::extract(const key_type& key)
+{
+    const_iterator it = find(key);
+    if (it == end()) {
+        return node_type();                                           // RETURN
+    }
+    return extract(it);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class COMPARATOR2>
+inline
+void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::merge(
+                               map<KEY, VALUE, COMPARATOR2, ALLOCATOR>& source)
+{
+    mergeNodes(&source);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class COMPARATOR2>
+inline
+void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::merge(
+                          multimap<KEY, VALUE, COMPARATOR2, ALLOCATOR>& source)
+{
+    mergeNodes(&source);
+}
+
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
 void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::swap(map& other)
@@ -1567,6 +2098,46 @@ void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::clear()
 #endif
 }
 
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void map<KEY, VALUE, COMPARATOR, ALLOCATOR>::compact()
+{
+    NodeFactory newFactory(get_allocator());
+    if (0 == d_tree.numNodes()) {
+        nodeFactory().swap(newFactory);
+        return;                                                       // RETURN
+    }
+
+    // Copy the elements, in order, into a chain of nodes supplied by a single
+    // chunk of a new pool, then balance the chain and exchange it, along with
+    // the new pool, for the current tree.  The old pool releases its chunks
+    // on destruction.
+
+    newFactory.reserveNodes(d_tree.numNodes());
+
+    BloombergLP::bslalg::RbTreeAnchor newTree;
+    BloombergLP::bslalg::RbTreeUtilTreeProctor<NodeFactory> proctor(
+                                                                 &newTree,
+                                                                 &newFactory);
+
+    BloombergLP::bslalg::RbTreeNode *lastNode = newTree.sentinel();
+    for (BloombergLP::bslalg::RbTreeNode *node = d_tree.firstNode();
+         d_tree.sentinel() != node;
+         node = BloombergLP::bslalg::RbTreeUtil::next(node)) {
+        BloombergLP::bslalg::RbTreeNode *newNode =
+                                                  newFactory.createNode(*node);
+        BloombergLP::bslalg::RbTreeUtil::appendToChain(&newTree,
+                                                       lastNode,
+                                                       newNode);
+        lastNode = newNode;
+    }
+    BloombergLP::bslalg::RbTreeUtil::balanceChain(&newTree);
+    proctor.release();
+
+    BloombergLP::bslalg::RbTreeUtil::deleteTree(&d_tree, &nodeFactory());
+    BloombergLP::bslalg::RbTreeUtil::swap(&d_tree, &newTree);
+    nodeFactory().swap(newFactory);
+}
+
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
 typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
@@ -1759,6 +2330,14 @@ map<KEY, VALUE, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
     return (find(key) != end()) ? 1 : 0;
 }
 
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool
+map<KEY, VALUE, COMPARATOR, ALLOCATOR>::contains(const key_type& key) const
+{
+    return find(key) != end();
+}
+
 template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
 inline
 typename map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
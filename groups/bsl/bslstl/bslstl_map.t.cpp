@@ -1,5 +1,6 @@
 // bslstl_map.t.cpp                                                   -*-C++-*-
 #include <bslstl_map.h>
+#include <bslstl_multimap.h>  // for testing only
 
 #include <bslstl_vector.h>  // for testing only
 
@@ -152,6 +153,24 @@ using namespace bsl;
 // [13] const_iterator upper_bound(const key_type& key) const;
 // [13] bsl::pair<iterator, iterator> equal_range(const key_type& key);
 // [13] bsl::pair<const_iter, const_iter> equal_range(const key_type&) const;
+// [27] iterator find(const LOOKUP_KEY& key);
+// [27] const_iterator find(const LOOKUP_KEY& key) const;
+// [27] size_type count(const LOOKUP_KEY& key) const;
+// [27] bool contains(const key_type& key) const;
+// [27] bool contains(const LOOKUP_KEY& key) const;
+// [27] iterator lower_bound(const LOOKUP_KEY& key);
+// [27] const_iterator lower_bound(const LOOKUP_KEY& key) const;
+// [27] iterator upper_bound(const LOOKUP_KEY& key);
+// [27] const_iterator upper_bound(const LOOKUP_KEY& key) const;
+// [27] bsl::pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+// [27] bsl::pair<c_iter, c_iter> equal_range(const LOOKUP_KEY&) const;
+// [28] node_type extract(const_iterator position);
+// [28] node_type extract(const key_type& key);
+// [28] insert_return_type insert(const node_type& node);
+// [28] iterator insert(const_iterator hint, const node_type& node);
+// [28] void merge(map<K, V, C2, A>& source);
+// [28] void merge(multimap<K, V, C2, A>& source);
+// [29] void compact();
 //
 // [ 6] bool operator==(const map<K, C, A>& lhs, const map<K, C, A>& rhs);
 // [19] bool operator< (const map<K, C, A>& lhs, const map<K, C, A>& rhs);
@@ -165,7 +184,7 @@ using namespace bsl;
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [26] USAGE EXAMPLE
+// [30] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(map<T,A> *object, const char *spec, int verbose = 1);
@@ -930,6 +949,9 @@ class TestDriver {
 
   public:
     // TEST CASES
+    static void testCase29();
+        // Test 'compact'.
+
     static void testCase26();
         // Test standard interface coverage.
 
@@ -1078,6 +1100,126 @@ bsl::map<KEY, VALUE, COMP, ALLOC> TestDriver<KEY, VALUE, COMP, ALLOC>::g(
     return gg(&object, spec);
 }
 
+template <class KEY, class VALUE, class COMP, class ALLOC>
+void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase29()
+{
+    // ------------------------------------------------------------------------
+    // TESTING 'compact'
+    //
+    // Concerns:
+    //: 1 'compact' leaves the value of the map unchanged, and the map remains
+    //:   searchable.
+    //:
+    //: 2 After 'compact', the nodes of the map are laid out contiguously, in
+    //:   key order, at a constant stride.
+    //:
+    //: 3 After 'compact', the map holds exactly the memory held by a copy of
+    //:   the map, i.e., the memory of nodes removed from the map is released.
+    //:
+    //: 4 'compact' on an empty map releases all memory held for nodes.
+    //:
+    //: 5 'compact' is exception-neutral, and provides the strong exception
+    //:   guarantee.
+    //:
+    //: 6 No memory is allocated from the default allocator.
+    //
+    // Plan:
+    //: 1 For each row of a table of specifications, create a map, erase every
+    //:   other element to scatter the free nodes of its pool, and invoke
+    //:   'compact' within an exception test loop, verifying at the start of
+    //:   each iteration that the value of the map is unchanged.  (C-5)
+    //:
+    //: 2 After 'compact', compare the map with a copy made before, look up
+    //:   each element, and verify that the distance between the addresses
+    //:   of consecutive elements is positive and constant.  (C-1..2)
+    //:
+    //: 3 Compare the number of blocks in use by the map with that of a copy
+    //:   of the map supplied by a separate test allocator.  (C-3)
+    //:
+    //: 4 Clear the map, invoke 'compact', and verify that no memory remains
+    //:   in use.  (C-4)
+    //:
+    //: 5 Verify that no memory is allocated from the default allocator.  (C-6)
+    //
+    // Testing:
+    //   void compact();
+    // ------------------------------------------------------------------------
+
+    const int NUM_DATA                     = DEFAULT_NUM_DATA;
+    const DefaultDataRow (&DATA)[NUM_DATA] = DEFAULT_DATA;
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    for (int ti = 0; ti < NUM_DATA; ++ti) {
+        const int         LINE = DATA[ti].d_line;
+        const char *const SPEC = DATA[ti].d_spec;
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = gg(&mX, SPEC);
+
+        for (Iter it = mX.begin(); it != mX.end(); ) {
+            it = mX.erase(it);
+            if (it != mX.end()) {
+                ++it;
+            }
+        }
+
+        const Obj W(X, &sa);
+        const SizeType LENGTH = X.size();
+
+        if (veryVerbose) { T_ P_(LINE) P_(SPEC) P(LENGTH) }
+
+        BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+            if (veryVeryVerbose) { T_ T_ Q(ExceptionTestBody) }
+
+            ASSERTV(LINE, W == X);
+
+            mX.compact();
+        } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+        ASSERTV(LINE, W == X);
+        ASSERTV(LINE, LENGTH == X.size());
+
+        for (CIter it = W.begin(); it != W.end(); ++it) {
+            CIter found = X.find(it->first);
+            ASSERTV(LINE, X.end() != found && *it == *found);
+        }
+
+        if (2 <= LENGTH) {
+            CIter             it     = X.begin();
+            const char       *prev   = reinterpret_cast<const char *>(&*it);
+            const char       *next   = reinterpret_cast<const char *>(&*++it);
+            const size_t      STRIDE = next - prev;
+            ASSERTV(LINE, prev < next);
+
+            for (++it; it != X.end(); ++it) {
+                prev = next;
+                next = reinterpret_cast<const char *>(&*it);
+                ASSERTV(LINE, prev < next);
+                ASSERTV(LINE, STRIDE == static_cast<size_t>(next - prev));
+            }
+        }
+
+        {
+            bslma::TestAllocator za("copy", veryVeryVeryVerbose);
+
+            const Obj Z(X, &za);
+            ASSERTV(LINE, oa.numBlocksInUse(), za.numBlocksInUse(),
+                    za.numBlocksInUse() == oa.numBlocksInUse());
+        }
+
+        mX.clear();
+        mX.compact();
+        ASSERTV(LINE, oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        ASSERTV(LINE, X.empty());
+
+        ASSERTV(LINE, da.numBlocksTotal(), 0 == da.numBlocksTotal());
+    }
+}
+
 template <class KEY, class VALUE, class COMP, class ALLOC>
 void TestDriver<KEY, VALUE, COMP, ALLOC>::testCase26()
 {
@@ -6555,6 +6697,47 @@ TradeMatcher::BuyOrdersConstIterator TradeMatcher::endBuyOrders() const
 
 }  // close namespace UsageExample
 
+// ============================================================================
+//                     TRANSPARENT COMPARATOR FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct TransparentProbe {
+    // This 'struct' provides a lookup key that is not convertible to 'int',
+    // and that 'TransparentLess' treats as equivalent to every non-negative
+    // 'int' key in the decade 'd_decade' (i.e., every key 'k' for which
+    // 'k / 10 == d_decade').
+
+    int d_decade;
+};
+
+struct TransparentLess {
+    // This 'struct' provides a transparent comparator that orders 'int' keys
+    // and 'TransparentProbe' objects.
+
+    typedef void is_transparent;
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' is less than the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return lhs < rhs;
+    }
+
+    bool operator()(const TransparentProbe& lhs, int rhs) const
+        // Return 'true' if the decade of the specified 'lhs' precedes the
+        // decade of the specified 'rhs', and 'false' otherwise.
+    {
+        return lhs.d_decade < rhs / 10;
+    }
+
+    bool operator()(int lhs, const TransparentProbe& rhs) const
+        // Return 'true' if the decade of the specified 'lhs' precedes the
+        // decade of the specified 'rhs', and 'false' otherwise.
+    {
+        return lhs / 10 < rhs.d_decade;
+    }
+};
+
 // ============================================================================
 //                            MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -6579,7 +6762,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 27: {
+      case 30: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -6622,6 +6805,394 @@ int main(int argc, char *argv[])
             ASSERT(0 < objectAllocator.numBytesInUse());
         }
       } break;
+      case 29: {
+        // --------------------------------------------------------------------
+        // TESTING 'compact'
+        // --------------------------------------------------------------------
+        RUN_EACH_TYPE(TestDriver,
+                      testCase29,
+                      BSLTF_TEMPLATETESTFACILITY_TEST_TYPES_REGULAR);
+        TestDriver<TestKeyType, TestValueType>::testCase29();
+      } break;
+      case 28: {
+        // --------------------------------------------------------------------
+        // TESTING NODE HANDLES
+        //
+        // Concerns:
+        //: 1 'extract' unlinks an element from the container without copying
+        //:   or destroying it, and the returned node handle owns the element.
+        //:
+        //: 2 Inserting a node handle into a container having an equal
+        //:   allocator relinks the very same node, and allocates no memory.
+        //:
+        //: 3 A relinked node, and a node owned by a node handle, remain valid
+        //:   after the container from which the node was extracted is
+        //:   destroyed, and all memory is reclaimed when its owner is
+        //:   destroyed.
+        //:
+        //: 4 Inserting a node whose key is already present has no effect on
+        //:   the container; 'insert(nh)' transfers the node to the 'node'
+        //:   member of the result, and 'insert(hint, nh)' leaves the node in
+        //:   'nh'.
+        //:
+        //: 5 'merge' transfers, from a 'map' or 'multimap', exactly the
+        //:   elements whose keys are not present, relinking them without
+        //:   allocating a node.
+        //:
+        //: 6 If the allocators are not equal, the elements are copied into
+        //:   nodes supplied by the target container, and the source nodes
+        //:   are destroyed.
+        //:
+        //: 7 Inserting an empty node handle has no effect.
+        //
+        // Plan:
+        //: 1 Extract elements from a container, insert them into another
+        //:   container using the same allocator, and compare the addresses
+        //:   of the elements before and after the transfer.  Use a test
+        //:   allocator monitor to verify that no memory is allocated by
+        //:   'insert'.  Destroy the source container and verify the values
+        //:   of the transferred elements.  (C-1..3)
+        //:
+        //: 2 Insert node handles whose keys are already present, and empty
+        //:   node handles, and verify the result and the state of the
+        //:   container.  (C-4, 7)
+        //:
+        //: 3 Merge containers of both types, and verify the contents of the
+        //:   source and target, the address of a transferred element, and
+        //:   the number of blocks allocated.  (C-5)
+        //:
+        //: 4 Repeat the transfers between containers using different test
+        //:   allocators, and verify that no memory remains in use from the
+        //:   source allocator once the source container is destroyed.  (C-6)
+        //
+        // Testing:
+        //   node_type extract(const_iterator position);
+        //   node_type extract(const key_type& key);
+        //   insert_return_type insert(const node_type& node);
+        //   iterator insert(const_iterator hint, const node_type& node);
+        //   void merge(map<K, V, C2, A>& source);
+        //   void merge(multimap<K, V, C2, A>& source);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING NODE HANDLES"
+                            "\n====================\n");
+
+        typedef bsl::map<int, int>      Obj;
+        typedef bsl::multimap<int, int> MultiObj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting 'extract' and 'insert(nh)'.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            Obj::node_type               nh;
+            const Obj::value_type       *ADDRESS;
+            {
+                Obj mY(&oa);  const Obj& Y = mY;
+                for (int i = 0; i < 8; ++i) {
+                    mY.insert(Obj::value_type(i, i * i));
+                }
+                ADDRESS = &*Y.find(3);
+
+                nh = mY.extract(3);
+                ASSERT(!nh.empty());
+                ASSERT(3       == nh.key());
+                ASSERT(9       == nh.mapped());
+                ASSERT(ADDRESS == &nh.value());
+                ASSERT(7       == Y.size());
+                ASSERT(Y.end() == Y.find(3));
+
+                ASSERT(mY.extract(3).empty());
+
+                // The only block that may be allocated is the index with which
+                // 'mX' tracks the chunk from which it borrows the node.
+
+                const bsls::Types::Int64 BLOCKS = oa.numBlocksTotal();
+
+                Obj::insert_return_type R = mX.insert(nh);
+                ASSERTV(oa.numBlocksTotal() - BLOCKS,
+                        1 >= oa.numBlocksTotal() - BLOCKS);
+                ASSERT(R.inserted);
+                ASSERT(R.node.empty());
+                ASSERT(nh.empty());
+                ASSERT(ADDRESS == &*R.position);
+                ASSERT(1       == X.size());
+
+                nh = mY.extract(Y.begin());
+                ASSERT(0 == nh.key());
+                ASSERT(6 == Y.size());
+            }
+
+            // The relinked node, and the node owned by 'nh', outlive the
+            // container from which they were extracted.
+
+            ASSERT(ADDRESS == &*X.begin());
+            ASSERT(3       == X.begin()->first);
+            ASSERT(9       == X.begin()->second);
+            ASSERT(0       == nh.key());
+
+            mX.insert(Obj::value_type(0, 100));
+
+            Obj::insert_return_type R = mX.insert(nh);
+            ASSERT(!R.inserted);
+            ASSERT(nh.empty());
+            ASSERT(!R.node.empty());
+            ASSERT(X.begin() == R.position);
+            ASSERT(100       == R.position->second);
+            ASSERT(0         == R.node.mapped());
+            ASSERT(2         == X.size());
+
+            R.node.key() = 5;
+            Obj::iterator it = mX.insert(X.end(), R.node);
+            ASSERT(R.node.empty());
+            ASSERT(5 == it->first);
+            ASSERT(3 == X.size());
+
+            nh = mX.extract(X.find(5));
+            nh.key() = 3;
+            it = mX.insert(X.begin(), nh);
+            ASSERT(!nh.empty());
+            ASSERT(3 == it->first);
+            ASSERT(2 == X.size());
+
+            const Obj::node_type EMPTY;
+
+            R = mX.insert(EMPTY);
+            ASSERT(!R.inserted);
+            ASSERT(R.node.empty());
+            ASSERT(X.end() == R.position);
+            ASSERT(X.end() == mX.insert(X.begin(), EMPTY));
+            ASSERT(X.end() == mX.insert(X.end(),   EMPTY));
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting 'merge'.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            Obj mY(&oa);  const Obj& Y = mY;
+
+            for (int i = 0; i < 10; ++i) {
+                if (0 == i % 3) {
+                    mX.insert(Obj::value_type(i, -i));
+                }
+                mY.insert(Obj::value_type(i, i));
+            }
+            const Obj::value_type *ADDRESS = &*Y.find(5);
+
+            // No node is allocated: the only blocks that may be allocated are
+            // the indexes with which the two pools track the chunks lent and
+            // borrowed.
+
+            const bsls::Types::Int64 BLOCKS = oa.numBlocksInUse();
+
+            mX.merge(mY);
+
+            ASSERTV(oa.numBlocksInUse() - BLOCKS,
+                    2 >= oa.numBlocksInUse() - BLOCKS);
+            ASSERT(10      == X.size());
+            ASSERT(4       == Y.size());
+            ASSERT(ADDRESS == &*X.find(5));
+            for (Obj::const_iterator it = Y.begin(); it != Y.end(); ++it) {
+                ASSERTV(it->first, 0 == it->first % 3);
+                ASSERTV(it->first, -it->first == X.find(it->first)->second);
+            }
+
+            MultiObj mZ(&oa);  const MultiObj& Z = mZ;
+            mZ.insert(MultiObj::value_type(1, 1));
+            mZ.insert(MultiObj::value_type(11, 11));
+            mZ.insert(MultiObj::value_type(11, 12));
+
+            mX.merge(mZ);
+            ASSERT(11 == X.size());
+            ASSERT(2  == Z.size());
+            ASSERT(1  == Z.count(1));
+            ASSERT(1  == Z.count(11));
+
+            mX.merge(mX);
+            ASSERT(11 == X.size());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting unequal allocators.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            {
+                Obj mY(&za);  const Obj& Y = mY;
+                for (int i = 0; i < 6; ++i) {
+                    mY.insert(Obj::value_type(i, i));
+                }
+                const Obj::value_type *ADDRESS = &*Y.find(2);
+
+                Obj::node_type nh = mY.extract(2);
+                ASSERT(&za == nh.get_allocator().mechanism());
+
+                Obj::insert_return_type R = mX.insert(nh);
+                ASSERT(R.inserted);
+                ASSERT(nh.empty());
+                ASSERT(ADDRESS != &*R.position);
+                ASSERT(2       == R.position->first);
+
+                mX.merge(mY);
+                ASSERT(6 == X.size());
+                ASSERT(0 == Y.size());
+            }
+            ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+
+            int i = 0;
+            for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(i, it->first, i == it->first);
+                ++i;
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING TRANSPARENT LOOKUP
+        //
+        // Concerns:
+        //: 1 If the comparator is transparent, 'find', 'count', 'contains',
+        //:   'lower_bound', 'upper_bound', and 'equal_range' accept a key of a
+        //:   type that is not convertible to 'key_type'.
+        //:
+        //: 2 The transparent overloads locate exactly the elements that the
+        //:   comparator treats as equivalent to the supplied key, including
+        //:   when several elements are equivalent to that key.
+        //:
+        //: 3 Both the 'const' and non-'const' overloads are provided, and
+        //:   return iterators to the same elements.
+        //:
+        //: 4 No memory is allocated by the lookup methods.
+        //:
+        //: 5 'contains' reports whether an element having the supplied
+        //:   'key_type' key exists, whether or not the comparator is
+        //:   transparent.
+        //
+        // Plan:
+        //: 1 Create a map keyed on 'int' using the transparent comparator
+        //:   'TransparentLess', and search it using 'TransparentProbe'
+        //:   objects, which are not convertible to 'int' and are equivalent to
+        //:   every key in a decade.  Compare the results with those of the
+        //:   'key_type' overloads of 'lower_bound' for the bounds of the
+        //:   decade, and with a brute-force count of the equivalent keys.
+        //:   (C-1..3)
+        //:
+        //: 2 Install a test allocator as the default allocator, and use test
+        //:   allocator monitors to verify that no memory is allocated from it,
+        //:   or from the object allocator, by the lookups.  (C-4)
+        //:
+        //: 3 Invoke 'contains' on a map using the default comparator for keys
+        //:   that are, and are not, present.  (C-5)
+        //
+        // Testing:
+        //   iterator find(const LOOKUP_KEY& key);
+        //   const_iterator find(const LOOKUP_KEY& key) const;
+        //   size_type count(const LOOKUP_KEY& key) const;
+        //   bool contains(const key_type& key) const;
+        //   bool contains(const LOOKUP_KEY& key) const;
+        //   iterator lower_bound(const LOOKUP_KEY& key);
+        //   const_iterator lower_bound(const LOOKUP_KEY& key) const;
+        //   iterator upper_bound(const LOOKUP_KEY& key);
+        //   const_iterator upper_bound(const LOOKUP_KEY& key) const;
+        //   pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+        //   pair<c_iter, c_iter> equal_range(const LOOKUP_KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING TRANSPARENT LOOKUP"
+                            "\n==========================\n");
+
+        typedef bsl::map<int, int, TransparentLess> Obj;
+
+        static const int KEYS[]   = { 3, 15, 17, 22, 41, 44, 45 };
+        const int        NUM_KEYS = sizeof KEYS / sizeof *KEYS;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            mX.insert(Obj::value_type(KEYS[i], i));
+        }
+        ASSERTV(X.size(), NUM_KEYS == static_cast<int>(X.size()));
+
+        bslma::TestAllocatorMonitor oam(&oa);
+        bslma::TestAllocatorMonitor dam(&da);
+
+        for (int decade = 0; decade < 6; ++decade) {
+            const TransparentProbe PROBE = { decade };
+
+            int expected = 0;
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                if (KEYS[i] / 10 == decade) {
+                    ++expected;
+                }
+            }
+
+            if (veryVerbose) { T_ P_(decade) P(expected) }
+
+            const Obj::iterator       LB  = mX.lower_bound(PROBE);
+            const Obj::iterator       UB  = mX.upper_bound(PROBE);
+            const Obj::const_iterator CLB =  X.lower_bound(PROBE);
+            const Obj::const_iterator CUB =  X.upper_bound(PROBE);
+
+            ASSERTV(decade, mX.lower_bound(decade * 10)       == LB);
+            ASSERTV(decade, mX.lower_bound((decade + 1) * 10) == UB);
+            ASSERTV(decade, LB == CLB);
+            ASSERTV(decade, UB == CUB);
+
+            int length = 0;
+            for (Obj::const_iterator lb = CLB; lb != CUB; ++lb) {
+                ASSERTV(decade, lb->first, decade == lb->first / 10);
+                ++length;
+            }
+            ASSERTV(decade, expected, length, expected == length);
+
+            ASSERTV(decade, expected == static_cast<int>(X.count(PROBE)));
+            ASSERTV(decade, (0 != expected) == X.contains(PROBE));
+
+            const bsl::pair<Obj::iterator, Obj::iterator> R =
+                                                       mX.equal_range(PROBE);
+            ASSERTV(decade, LB == R.first);
+            ASSERTV(decade, UB == R.second);
+
+            const bsl::pair<Obj::const_iterator, Obj::const_iterator> CR =
+                                                        X.equal_range(PROBE);
+            ASSERTV(decade, CLB == CR.first);
+            ASSERTV(decade, CUB == CR.second);
+
+            if (expected) {
+                ASSERTV(decade, LB  == mX.find(PROBE));
+                ASSERTV(decade, CLB ==  X.find(PROBE));
+            }
+            else {
+                ASSERTV(decade, mX.end() == mX.find(PROBE));
+                ASSERTV(decade,  X.end() ==  X.find(PROBE));
+            }
+        }
+
+        ASSERT(oam.isTotalSame());
+        ASSERT(dam.isTotalSame());
+
+        if (verbose) printf("\nTesting 'contains' with a 'key_type' key.\n");
+        {
+            typedef bsl::map<int, int> PlainObj;
+
+            PlainObj mY(&oa);  const PlainObj& Y = mY;
+            mY.insert(PlainObj::value_type(1, 1));
+            mY.insert(PlainObj::value_type(3, 3));
+
+            ASSERT(!Y.contains(0));
+            ASSERT( Y.contains(1));
+            ASSERT(!Y.contains(2));
+            ASSERT( Y.contains(3));
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
       case 26: {
         // --------------------------------------------------------------------
         // TESTING STANDARD INTERFACE COVERAGE
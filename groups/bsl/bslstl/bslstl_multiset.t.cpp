@@ -1,5 +1,6 @@
 // bslstl_multiset.t.cpp                                              -*-C++-*-
 #include <bslstl_multiset.h>
+#include <bslstl_set.h>  // for testing only
 
 #include <bslalg_rangecompare.h>
 
@@ -137,6 +138,23 @@ using namespace bsl;
 // [13] const_iterator upper_bound(const key_type& key) const;
 // [13] bsl::pair<iterator, iterator> equal_range(const key_type& key);
 // [13] bsl::pair<const_iter, const_iter> equal_range(const key_type&) const;
+// [26] iterator find(const LOOKUP_KEY& key);
+// [26] const_iterator find(const LOOKUP_KEY& key) const;
+// [26] size_type count(const LOOKUP_KEY& key) const;
+// [26] bool contains(const key_type& key) const;
+// [26] bool contains(const LOOKUP_KEY& key) const;
+// [26] iterator lower_bound(const LOOKUP_KEY& key);
+// [26] const_iterator lower_bound(const LOOKUP_KEY& key) const;
+// [26] iterator upper_bound(const LOOKUP_KEY& key);
+// [26] const_iterator upper_bound(const LOOKUP_KEY& key) const;
+// [26] bsl::pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+// [26] bsl::pair<c_iter, c_iter> equal_range(const LOOKUP_KEY&) const;
+// [27] node_type extract(const_iterator position);
+// [27] node_type extract(const key_type& key);
+// [27] iterator insert(const node_type& node);
+// [27] iterator insert(const_iterator hint, const node_type& node);
+// [27] void merge(multiset<K, C2, A>& source);
+// [27] void merge(set<K, C2, A>& source);
 //
 // [ 6] bool operator==(const multiset<K, C, A>& lhs, rhs);
 // [17] bool operator< (const multiset<K, C, A>& lhs, rhs);
@@ -150,7 +168,7 @@ using namespace bsl;
 //
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [21] USAGE EXAMPLE
+// [28] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(multiset<T,A> *object, const char *spec, int verbose = 1);
@@ -6379,6 +6397,47 @@ bool operator!=(const ShoppingCart& lhs, const ShoppingCart& rhs)
 }  // close namespace 'UsageExample'
 
 
+// ============================================================================
+//                     TRANSPARENT COMPARATOR FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct TransparentProbe {
+    // This 'struct' provides a lookup key that is not convertible to 'int',
+    // and that 'TransparentLess' treats as equivalent to every non-negative
+    // 'int' key in the decade 'd_decade' (i.e., every key 'k' for which
+    // 'k / 10 == d_decade').
+
+    int d_decade;
+};
+
+struct TransparentLess {
+    // This 'struct' provides a transparent comparator that orders 'int' keys
+    // and 'TransparentProbe' objects.
+
+    typedef void is_transparent;
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' is less than the specified
+        // 'rhs', and 'false' otherwise.
+    {
+        return lhs < rhs;
+    }
+
+    bool operator()(const TransparentProbe& lhs, int rhs) const
+        // Return 'true' if the decade of the specified 'lhs' precedes the
+        // decade of the specified 'rhs', and 'false' otherwise.
+    {
+        return lhs.d_decade < rhs / 10;
+    }
+
+    bool operator()(int lhs, const TransparentProbe& rhs) const
+        // Return 'true' if the decade of the specified 'lhs' precedes the
+        // decade of the specified 'rhs', and 'false' otherwise.
+    {
+        return lhs / 10 < rhs.d_decade;
+    }
+};
+
 // ============================================================================
 //                            MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -6406,7 +6465,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocator(&defaultAllocator);
 
     switch (test) { case 0:
-      case 26: {
+      case 28: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -6454,6 +6513,357 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case 27: {
+        // --------------------------------------------------------------------
+        // TESTING NODE HANDLES
+        //
+        // Concerns:
+        //: 1 'extract' unlinks an element from the container without copying
+        //:   or destroying it, and the returned node handle owns the element.
+        //:
+        //: 2 Inserting a node handle into a container having an equal
+        //:   allocator relinks the very same node, and allocates no memory.
+        //:
+        //: 3 A relinked node, and a node owned by a node handle, remain valid
+        //:   after the container from which the node was extracted is
+        //:   destroyed, and all memory is reclaimed when its owner is
+        //:   destroyed.
+        //:
+        //: 4 An inserted node follows the elements having an equivalent key.
+        //:
+        //: 5 'merge' transfers every element of a 'multiset' or 'set',
+        //:   relinking them without allocating a node.
+        //:
+        //: 6 If the allocators are not equal, the elements are copied into
+        //:   nodes supplied by the target container, and the source nodes
+        //:   are destroyed.
+        //:
+        //: 7 Inserting an empty node handle has no effect.
+        //
+        // Plan:
+        //: 1 Extract elements from a container, insert them into another
+        //:   container using the same allocator, and compare the addresses
+        //:   of the elements before and after the transfer.  Use a test
+        //:   allocator monitor to verify that no memory is allocated by
+        //:   'insert'.  Destroy the source container and verify the values
+        //:   of the transferred elements.  (C-1..3)
+        //:
+        //: 2 Insert node handles whose keys are present, and empty node
+        //:   handles, and verify the result and the state of the container.
+        //:   (C-4, 7)
+        //:
+        //: 3 Merge containers of both types, and verify the contents of the
+        //:   source and target, the address of a transferred element, and
+        //:   the number of blocks allocated.  (C-5)
+        //:
+        //: 4 Repeat the transfers between containers using different test
+        //:   allocators, and verify that no memory remains in use from the
+        //:   source allocator once the source container is destroyed.  (C-6)
+        //
+        // Testing:
+        //   node_type extract(const_iterator position);
+        //   node_type extract(const key_type& key);
+        //   iterator insert(const node_type& node);
+        //   iterator insert(const_iterator hint, const node_type& node);
+        //   void merge(multiset<K, C2, A>& source);
+        //   void merge(set<K, C2, A>& source);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING NODE HANDLES"
+                            "\n====================\n");
+
+        typedef bsl::multiset<int> Obj;
+        typedef bsl::set<int>      UniqueObj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting 'extract' and 'insert(nh)'.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            Obj::node_type               nh;
+            const Obj::value_type       *ADDRESS;
+            {
+                Obj mY(&oa);  const Obj& Y = mY;
+                for (int i = 0; i < 8; ++i) {
+                    mY.insert(i % 4);
+                }
+                ADDRESS = &*Y.find(2);
+
+                nh = mY.extract(2);
+                ASSERT(!nh.empty());
+                ASSERT(2       == nh.value());
+                ASSERT(ADDRESS == &nh.value());
+                ASSERT(7       == Y.size());
+                ASSERT(1       == Y.count(2));
+
+                // The only block that may be allocated is the index with which
+                // 'mX' tracks the chunk from which it borrows the node.
+
+                const bsls::Types::Int64 BLOCKS = oa.numBlocksTotal();
+
+                Obj::iterator it = mX.insert(nh);
+                ASSERTV(oa.numBlocksTotal() - BLOCKS,
+                        1 >= oa.numBlocksTotal() - BLOCKS);
+                ASSERT(nh.empty());
+                ASSERT(ADDRESS == &*it);
+                ASSERT(1       == X.size());
+
+                nh = mY.extract(Y.begin());
+                ASSERT(0 == nh.value());
+                ASSERT(6 == Y.size());
+            }
+
+            // The relinked node, and the node owned by 'nh', outlive the
+            // container from which they were extracted.
+
+            ASSERT(ADDRESS == &*X.begin());
+            ASSERT(2       == *X.begin());
+            ASSERT(0       == nh.value());
+
+            Obj::iterator first = mX.insert(0);
+
+            Obj::iterator it = mX.insert(nh);
+            ASSERT(nh.empty());
+            ASSERT(2     == X.count(0));
+            ASSERT(first == X.begin());
+            ASSERT(it    == ++X.begin());
+
+            nh = mX.extract(first);
+            nh.value() = 5;
+            it = mX.insert(X.end(), nh);
+            ASSERT(nh.empty());
+            ASSERT(5 == *it);
+            ASSERT(3 == X.size());
+
+            const Obj::node_type EMPTY;
+
+            ASSERT(X.end() == mX.insert(EMPTY));
+            ASSERT(X.end() == mX.insert(X.begin(), EMPTY));
+            ASSERT(mX.extract(7).empty());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting 'merge'.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            Obj mY(&oa);  const Obj& Y = mY;
+
+            for (int i = 0; i < 10; ++i) {
+                mX.insert(i % 5);
+                mY.insert(i % 5);
+            }
+            const Obj::value_type *ADDRESS = &*Y.find(3);
+
+            // No node is allocated: the only blocks that may be allocated are
+            // the indexes with which the two pools track the chunks lent and
+            // borrowed.
+
+            const bsls::Types::Int64 BLOCKS = oa.numBlocksInUse();
+
+            mX.merge(mY);
+
+            ASSERTV(oa.numBlocksInUse() - BLOCKS,
+                    2 >= oa.numBlocksInUse() - BLOCKS);
+            ASSERT(20 == X.size());
+            ASSERT(0  == Y.size());
+            ASSERT(4  == X.count(3));
+
+            // Transferred elements follow the equivalent elements already
+            // present.
+
+            ASSERT(ADDRESS == &*++++X.find(3));
+
+            UniqueObj mZ(&oa);  const UniqueObj& Z = mZ;
+            mZ.insert(1);
+            mZ.insert(11);
+
+            mX.merge(mZ);
+            ASSERT(22 == X.size());
+            ASSERT(0  == Z.size());
+            ASSERT(5  == X.count(1));
+            ASSERT(1  == X.count(11));
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting unequal allocators.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            {
+                Obj mY(&za);  const Obj& Y = mY;
+                for (int i = 0; i < 6; ++i) {
+                    mY.insert(i);
+                }
+                const Obj::value_type *ADDRESS = &*Y.find(2);
+
+                Obj::node_type nh = mY.extract(2);
+                ASSERT(&za == nh.get_allocator().mechanism());
+
+                Obj::iterator it = mX.insert(nh);
+                ASSERT(nh.empty());
+                ASSERT(ADDRESS != &*it);
+                ASSERT(2       == *it);
+
+                mX.merge(mY);
+                ASSERT(6 == X.size());
+                ASSERT(0 == Y.size());
+            }
+            ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+
+            int i = 0;
+            for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(i, *it, i == *it);
+                ++i;
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING TRANSPARENT LOOKUP
+        //
+        // Concerns:
+        //: 1 If the comparator is transparent, 'find', 'count', 'contains',
+        //:   'lower_bound', 'upper_bound', and 'equal_range' accept a key of a
+        //:   type that is not convertible to 'key_type'.
+        //:
+        //: 2 The transparent overloads locate exactly the elements that the
+        //:   comparator treats as equivalent to the supplied key, including
+        //:   when several elements are equivalent to that key.
+        //:
+        //: 3 Both the 'const' and non-'const' overloads are provided, and
+        //:   return iterators to the same elements.
+        //:
+        //: 4 No memory is allocated by the lookup methods.
+        //:
+        //: 5 'contains' reports whether an element having the supplied
+        //:   'key_type' key exists, whether or not the comparator is
+        //:   transparent.
+        //
+        // Plan:
+        //: 1 Create a multiset keyed on 'int' using the transparent comparator
+        //:   'TransparentLess', and search it using 'TransparentProbe'
+        //:   objects, which are not convertible to 'int' and are equivalent to
+        //:   every key in a decade.  Compare the results with those of the
+        //:   'key_type' overloads of 'lower_bound' for the bounds of the
+        //:   decade, and with a brute-force count of the equivalent keys.
+        //:   (C-1..3)
+        //:
+        //: 2 Install a test allocator as the default allocator, and use test
+        //:   allocator monitors to verify that no memory is allocated from it,
+        //:   or from the object allocator, by the lookups.  (C-4)
+        //:
+        //: 3 Invoke 'contains' on a multiset using the default comparator for
+        //:   keys that are, and are not, present.  (C-5)
+        //
+        // Testing:
+        //   iterator find(const LOOKUP_KEY& key);
+        //   const_iterator find(const LOOKUP_KEY& key) const;
+        //   size_type count(const LOOKUP_KEY& key) const;
+        //   bool contains(const key_type& key) const;
+        //   bool contains(const LOOKUP_KEY& key) const;
+        //   iterator lower_bound(const LOOKUP_KEY& key);
+        //   const_iterator lower_bound(const LOOKUP_KEY& key) const;
+        //   iterator upper_bound(const LOOKUP_KEY& key);
+        //   const_iterator upper_bound(const LOOKUP_KEY& key) const;
+        //   pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+        //   pair<c_iter, c_iter> equal_range(const LOOKUP_KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING TRANSPARENT LOOKUP"
+                            "\n==========================\n");
+
+        typedef bsl::multiset<int, TransparentLess> Obj;
+
+        static const int KEYS[]   = { 3, 15, 15, 17, 22, 41, 44, 44, 45 };
+        const int        NUM_KEYS = sizeof KEYS / sizeof *KEYS;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            mX.insert(KEYS[i]);
+        }
+        ASSERTV(X.size(), NUM_KEYS == static_cast<int>(X.size()));
+
+        bslma::TestAllocatorMonitor oam(&oa);
+        bslma::TestAllocatorMonitor dam(&da);
+
+        for (int decade = 0; decade < 6; ++decade) {
+            const TransparentProbe PROBE = { decade };
+
+            int expected = 0;
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                if (KEYS[i] / 10 == decade) {
+                    ++expected;
+                }
+            }
+
+            if (veryVerbose) { T_ P_(decade) P(expected) }
+
+            const Obj::iterator       LB  = mX.lower_bound(PROBE);
+            const Obj::iterator       UB  = mX.upper_bound(PROBE);
+            const Obj::const_iterator CLB =  X.lower_bound(PROBE);
+            const Obj::const_iterator CUB =  X.upper_bound(PROBE);
+
+            ASSERTV(decade, mX.lower_bound(decade * 10)       == LB);
+            ASSERTV(decade, mX.lower_bound((decade + 1) * 10) == UB);
+            ASSERTV(decade, LB == CLB);
+            ASSERTV(decade, UB == CUB);
+
+            int length = 0;
+            for (Obj::const_iterator lb = CLB; lb != CUB; ++lb) {
+                ASSERTV(decade, *lb, decade == *lb / 10);
+                ++length;
+            }
+            ASSERTV(decade, expected, length, expected == length);
+
+            ASSERTV(decade, expected == static_cast<int>(X.count(PROBE)));
+            ASSERTV(decade, (0 != expected) == X.contains(PROBE));
+
+            const bsl::pair<Obj::iterator, Obj::iterator> R =
+                                                       mX.equal_range(PROBE);
+            ASSERTV(decade, LB == R.first);
+            ASSERTV(decade, UB == R.second);
+
+            const bsl::pair<Obj::const_iterator, Obj::const_iterator> CR =
+                                                        X.equal_range(PROBE);
+            ASSERTV(decade, CLB == CR.first);
+            ASSERTV(decade, CUB == CR.second);
+
+            if (expected) {
+                ASSERTV(decade, LB  == mX.find(PROBE));
+                ASSERTV(decade, CLB ==  X.find(PROBE));
+            }
+            else {
+                ASSERTV(decade, mX.end() == mX.find(PROBE));
+                ASSERTV(decade,  X.end() ==  X.find(PROBE));
+            }
+        }
+
+        ASSERT(oam.isTotalSame());
+        ASSERT(dam.isTotalSame());
+
+        if (verbose) printf("\nTesting 'contains' with a 'key_type' key.\n");
+        {
+            typedef bsl::multiset<int> PlainObj;
+
+            PlainObj mY(&oa);  const PlainObj& Y = mY;
+            mY.insert(1);
+            mY.insert(3);
+
+            ASSERT(!Y.contains(0));
+            ASSERT( Y.contains(1));
+            ASSERT(!Y.contains(2));
+            ASSERT( Y.contains(3));
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
       case 25: {
         // --------------------------------------------------------------------
         // TESTING STANDARD INTERFACE COVERAGE
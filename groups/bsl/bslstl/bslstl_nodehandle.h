@@ -0,0 +1,658 @@
+// bslstl_nodehandle.h                                                -*-C++-*-
+#ifndef INCLUDED_BSLSTL_NODEHANDLE
+#define INCLUDED_BSLSTL_NODEHANDLE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide node handles for transferring elements between containers.
+//
+//@CLASSES:
+//  bslstl::NodeHandle: owner of a node extracted from a node-based container
+//  bslstl::MapNodeHandle: node handle providing 'key' and 'mapped' access
+//  bslstl::NodeInsertReturnType: result of inserting a node handle
+//
+//@SEE_ALSO: bslstl_simplepool, bslstl_treenodepool, bslstl_map
+//
+//@DESCRIPTION: This component provides the *node* *handle* types used by the
+// node-based containers of 'bsl' (e.g., 'bsl::map' and 'bsl::unordered_set')
+// to implement the C++17 'extract', node-handle 'insert', and 'merge'
+// operations.  A node handle owns a single node that has been removed from a
+// container, so that the element it holds can be inserted into another
+// container (of compatible type) without copying the element, and without
+// allocating a new node.
+//
+// 'bslstl::NodeHandle' is parameterized by the 'NODE_POOL' type of the
+// container (either 'bslstl::TreeNodePool' or 'bslstl::BidirectionalNodePool')
+// and by the 'ALLOCATOR' type of the container.  'bslstl::MapNodeHandle'
+// extends 'bslstl::NodeHandle' with the 'key' and 'mapped' accessors of the
+// node handle of a map.  'bslstl::NodeInsertReturnType' is the type returned
+// by the node-handle 'insert' method of a container having unique keys.
+//
+///Memory Ownership
+///----------------
+// The nodes of a container are supplied by a pool, which owns the memory of
+// every node it has supplied.  To keep the memory of an extracted node valid,
+// the node is *lent* out of the pool, and the node handle holds a reference to
+// the *chunk* of memory holding the node (see 'bslstl_simplepool').  When a
+// node handle is inserted into a container whose allocator compares equal to
+// that of the node handle, the node is relinked into the container, whose
+// pool takes over the reference to the chunk: the transfer does not copy the
+// element, and allocates memory only to record, the first time, a chunk from
+// which the pool borrows nodes.  Otherwise, the element is copied into a new
+// node supplied by the pool of the container, and the original node is
+// destroyed.
+//
+// The memory footprint of a node that is destroyed while owned by a node
+// handle, or by a container other than the one whose pool supplied the node,
+// is handed back to its chunk: the pool that supplied the node reuses it, or,
+// if that pool was already released, the memory of the chunk is returned to
+// the allocator once no other node of the chunk remains in use.
+//
+///Transfer Semantics
+///------------------
+// C++03 does not support move semantics, so copying a node handle (including
+// passing it by value, or returning it from a function) *transfers* the
+// ownership of its node to the new object, leaving the original empty, in the
+// manner of 'bsl::auto_ptr'.  Similarly, inserting a node handle into a
+// container, which takes its argument by 'const' reference, leaves the node
+// handle empty if (and only if) its node is transferred to the container.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Transferring a Node Between Two Pools
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we are implementing a node-based container, and want to move a
+// node from one container to another without copying its value.
+//
+// First, we define the types of our node pool and node handle:
+//..
+//  typedef bslstl::BidirectionalNodePool<int, bsl::allocator<int> > Pool;
+//  typedef bslstl::NodeHandle<Pool, bsl::allocator<int> >           Handle;
+//..
+// Then, we create two pools using the same allocator, and create a node from
+// the first pool:
+//..
+//  bslma::TestAllocator ta;
+//  bsl::allocator<int>  alloc(&ta);
+//
+//  Pool source(alloc);
+//  Pool target(alloc);
+//
+//  Pool::NodeType *node = static_cast<Pool::NodeType *>(
+//                                                      source.createNode(42));
+//..
+// Next, we transfer the ownership of the node (having removed it from the
+// data structure of our source container) to a node handle, lending the
+// memory of the node out of the source pool:
+//..
+//  Handle handle(node, source.lendNode(node), alloc);
+//  assert(!handle.empty());
+//  assert(42 == handle.value());
+//..
+// Then, we transfer the node to the target pool.  Since the allocators of the
+// pool and the node handle compare equal, the very same node is returned:
+//..
+//  Pool::NodeType *transferred = handle.release(&target);
+//  assert(node == transferred);
+//  assert(handle.empty());
+//..
+// Finally, we observe that the node remains valid after the source pool is
+// released, and is deleted by the target pool.  Once both pools are released,
+// all of their memory is returned to the allocator:
+//..
+//  source.release();
+//  assert(42 == transferred->value());
+//
+//  target.deleteNode(transferred);
+//  target.release();
+//  assert(0 == ta.numBlocksInUse());
+//..
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BSL_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "<bslstl_nodehandle.h> header can't be included directly in \
+BSL_OVERRIDES_STD mode"
+#endif
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARDESTRUCTIONPRIMITIVES
+#include <bslalg_scalardestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_REMOVECONST
+#include <bslmf_removeconst.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_OBJECTBUFFER
+#include <bsls_objectbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_UNSPECIFIEDBOOL
+#include <bsls_unspecifiedbool.h>
+#endif
+
+#ifndef INCLUDED_BSLS_UTIL
+#include <bsls_util.h>
+#endif
+
+#ifndef INCLUDED_NEW
+#include <new>
+#define INCLUDED_NEW
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                            // ================
+                            // class NodeHandle
+                            // ================
+
+template <class NODE_POOL, class ALLOCATOR>
+class NodeHandle {
+    // This class template provides a node handle, owning a node (of the type
+    // 'NODE_POOL::NodeType') that has been extracted from a node-based
+    // container, or no node at all (i.e., being *empty*).  Copying a node
+    // handle transfers the ownership of its node (see {Transfer Semantics}).
+
+  public:
+    // TYPES
+    typedef typename NODE_POOL::ValueType  value_type;
+    typedef ALLOCATOR                      allocator_type;
+
+    typedef typename NODE_POOL::NodeType   NodeType;
+        // Alias for the type of the node owned by this handle.
+
+    typedef typename NODE_POOL::Chunk      Chunk;
+        // Alias for the type of the chunk holding the memory of the node.
+
+  private:
+    // PRIVATE TYPES
+    typedef typename NODE_POOL::AllocatorType PoolAllocator;
+        // Alias for the (rebound) allocator type of 'NODE_POOL'.
+
+    typedef typename bsls::UnspecifiedBool<NodeHandle>::BoolType BoolType;
+
+    typedef bsls::ObjectBuffer<ALLOCATOR> AllocatorBuffer;
+        // Alias for the storage of the allocator of this handle, which holds
+        // an allocator only if this handle owns a node.
+
+    // DATA
+    mutable NodeType        *d_node_p;     // owned node, or 0 if empty
+
+    mutable Chunk           *d_chunk_p;    // chunk holding the memory of
+                                           // 'd_node_p' (held reference), or
+                                           // 0 if empty
+
+    mutable AllocatorBuffer  d_allocator;  // allocator of the container from
+                                           // which the node was extracted
+                                           // (constructed only if this handle
+                                           // is not empty)
+
+    // PRIVATE MANIPULATORS
+    void reset();
+        // Destroy the node owned by this handle (if any), return its memory
+        // to its chunk, and leave this handle empty.
+
+    void takeOver(const NodeHandle& original);
+        // Transfer the node owned by the specified 'original' handle (if
+        // any), along with its allocator, to this handle, and leave
+        // 'original' empty.  The behavior is undefined unless this handle is
+        // empty.  Note that the allocator is copy-constructed in place, so
+        // that the allocator of a handle is never assigned.
+
+  public:
+    // CREATORS
+    NodeHandle();
+        // Create an empty node handle.
+
+    NodeHandle(NodeType         *node,
+               Chunk            *chunk,
+               const ALLOCATOR&  allocator);
+        // Create a node handle owning the specified 'node', lent out of the
+        // specified 'chunk', and that holds a value constructed using the
+        // specified 'allocator'.  The behavior is undefined unless 'node' is
+        // not linked into any container, and the caller holds a reference to
+        // 'chunk' for 'node' (see 'NODE_POOL::lendNode'), which is transferred
+        // to this object.
+
+    NodeHandle(const NodeHandle& original);
+        // Create a node handle owning the node owned by the specified
+        // 'original' handle (if any), and leave 'original' empty.  Note that
+        // 'original' is modified even though it is passed by 'const'
+        // reference (see {Transfer Semantics}).
+
+    ~NodeHandle();
+        // Destroy this object, destroying the node owned by this handle (if
+        // any).
+
+    // MANIPULATORS
+    NodeHandle& operator=(const NodeHandle& rhs);
+        // Destroy the node owned by this handle (if any), transfer the
+        // ownership of the node owned by the specified 'rhs' handle (if any)
+        // to this handle, and leave 'rhs' empty.  Return a reference providing
+        // modifiable access to this object.  Note that 'rhs' is modified even
+        // though it is passed by 'const' reference (see {Transfer Semantics}).
+
+    void swap(NodeHandle& other);
+        // Exchange the node (and allocator) of this handle with those of the
+        // specified 'other' handle.  This method provides the no-throw
+        // exception-safety guarantee.  Note that the allocators are exchanged
+        // by transferring the nodes, and are never assigned.
+
+    // ACCESSORS
+    operator BoolType() const;
+        // Return a value convertible to 'true' if this handle owns a node, and
+        // a value convertible to 'false' otherwise.
+
+    bool empty() const;
+        // Return 'true' if this handle does not own a node, and 'false'
+        // otherwise.
+
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used to construct the value of the
+        // node owned by this handle.  The behavior is undefined if this handle
+        // is empty.
+
+    NodeType *release(NODE_POOL *nodePool) const;
+        // Return the address of a node, suitable for linking into a container
+        // using the specified 'nodePool', holding the value of the node owned
+        // by this handle, and leave this handle empty.  If the allocator of
+        // 'nodePool' compares equal to that of this handle, return the node
+        // owned by this handle, and transfer the reference to its chunk to
+        // 'nodePool'; otherwise, copy the value into a new node supplied by
+        // 'nodePool' and destroy the node owned by this handle.  If an
+        // exception is thrown, this handle is not modified.  The behavior is
+        // undefined if this handle is empty.  Note that, as for the copy
+        // constructor, this method is 'const' because it transfers the
+        // ownership of the node out of a (possibly temporary) handle.
+
+    value_type& value() const;
+        // Return a reference providing modifiable access to the value of the
+        // node owned by this handle.  The behavior is undefined if this handle
+        // is empty.
+};
+
+// FREE FUNCTIONS
+template <class NODE_POOL, class ALLOCATOR>
+void swap(NodeHandle<NODE_POOL, ALLOCATOR>& a,
+          NodeHandle<NODE_POOL, ALLOCATOR>& b);
+    // Exchange the nodes (and allocators) of the specified 'a' and 'b' node
+    // handles.  This function provides the no-throw exception-safety
+    // guarantee.
+
+                           // ===================
+                           // class MapNodeHandle
+                           // ===================
+
+template <class NODE_POOL, class ALLOCATOR>
+class MapNodeHandle : public NodeHandle<NODE_POOL, ALLOCATOR> {
+    // This class template provides a node handle owning a node that holds a
+    // key-value pair (of a type having 'first_type' and 'second_type'
+    // members), such as one extracted from a 'bsl::map', adding the 'key' and
+    // 'mapped' accessors to those of 'NodeHandle'.
+
+    // PRIVATE TYPES
+    typedef NodeHandle<NODE_POOL, ALLOCATOR> Base;
+
+  public:
+    // TYPES
+    typedef typename Base::value_type                  value_type;
+    typedef typename bsl::remove_const<
+                        typename value_type::first_type>::type key_type;
+    typedef typename value_type::second_type           mapped_type;
+
+    // CREATORS
+    MapNodeHandle();
+        // Create an empty node handle.
+
+    MapNodeHandle(typename Base::NodeType *node,
+                  typename Base::Chunk    *chunk,
+                  const ALLOCATOR&         allocator);
+        // Create a node handle owning the specified 'node', lent out of the
+        // specified 'chunk', and that holds a value constructed using the
+        // specified 'allocator'.  The behavior is undefined unless 'node' is
+        // not linked into any container, and the caller holds a reference to
+        // 'chunk' for 'node' (see 'NODE_POOL::lendNode'), which is transferred
+        // to this object.
+
+    // MapNodeHandle(const MapNodeHandle& original) = default;
+        // Create a node handle owning the node owned by the specified
+        // 'original' handle (if any), and leave 'original' empty.
+
+    // ~MapNodeHandle() = default;
+        // Destroy this object, destroying the node owned by this handle (if
+        // any).
+
+    // MANIPULATORS
+    // MapNodeHandle& operator=(const MapNodeHandle& rhs) = default;
+        // Destroy the node owned by this handle (if any), transfer the
+        // ownership of the node owned by the specified 'rhs' handle (if any)
+        // to this handle, and leave 'rhs' empty.  Return a reference providing
+        // modifiable access to this object.
+
+    // ACCESSORS
+    key_type& key() const;
+        // Return a reference providing modifiable access to the key of the
+        // value of the node owned by this handle.  The behavior is undefined
+        // if this handle is empty.  Note that the key may be modified so that
+        // the node can be reinserted under a different key.
+
+    mapped_type& mapped() const;
+        // Return a reference providing modifiable access to the mapped value
+        // of the node owned by this handle.  The behavior is undefined if this
+        // handle is empty.
+};
+
+                       // ==========================
+                       // class NodeInsertReturnType
+                       // ==========================
+
+template <class ITERATOR, class NODE_HANDLE>
+struct NodeInsertReturnType {
+    // This 'struct' template provides the type returned by inserting a node
+    // handle into a container having unique keys.
+
+    // PUBLIC DATA
+    ITERATOR    position;  // inserted element, or element whose key prevented
+                           // the insertion
+
+    bool        inserted;  // 'true' if the node was inserted
+
+    NODE_HANDLE node;      // node that was not inserted, or empty
+
+    // CREATORS
+    NodeInsertReturnType();
+        // Create an object having a default-constructed 'position', 'false'
+        // 'inserted', and an empty 'node'.
+
+    NodeInsertReturnType(const ITERATOR&    position,
+                         bool               inserted,
+                         const NODE_HANDLE& node);
+        // Create an object having the specified 'position' and 'inserted'
+        // values, and owning the node owned by the specified 'node' handle (if
+        // any), leaving 'node' empty.
+};
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                            // ----------------
+                            // class NodeHandle
+                            // ----------------
+
+// PRIVATE MANIPULATORS
+template <class NODE_POOL, class ALLOCATOR>
+void NodeHandle<NODE_POOL, ALLOCATOR>::reset()
+{
+    if (d_node_p) {
+        PoolAllocator allocator(d_allocator.object());
+        bsl::allocator_traits<PoolAllocator>::destroy(
+                                   allocator,
+                                   bsls::Util::addressOf(d_node_p->value()));
+        NODE_POOL::returnNode(d_chunk_p, d_node_p, allocator);
+        bslalg::ScalarDestructionPrimitives::destroy(
+                                  bsls::Util::addressOf(d_allocator.object()));
+
+        d_node_p  = 0;
+        d_chunk_p = 0;
+    }
+}
+
+template <class NODE_POOL, class ALLOCATOR>
+inline
+void NodeHandle<NODE_POOL, ALLOCATOR>::takeOver(const NodeHandle& original)
+{
+    BSLS_ASSERT_SAFE(!d_node_p);
+
+    if (original.d_node_p) {
+        ::new (d_allocator.buffer()) ALLOCATOR(original.d_allocator.object());
+        bslalg::ScalarDestructionPrimitives::destroy(
+                         bsls::Util::addressOf(original.d_allocator.object()));
+
+        d_node_p  = original.d_node_p;
+        d_chunk_p = original.d_chunk_p;
+
+        original.d_node_p  = 0;
+        original.d_chunk_p = 0;
+    }
+}
+
+// CREATORS
+template <class NODE_POOL, class ALLOCATOR>
+inline
+NodeHandle<NODE_POOL, ALLOCATOR>::NodeHandle()
+: d_node_p(0)
+, d_chunk_p(0)
+{
+}
+
+template <class NODE_POOL, class ALLOCATOR>
+inline
+NodeHandle<NODE_POOL, ALLOCATOR>::NodeHandle(NodeType         *node,
+                                             Chunk            *chunk,
+                                             const ALLOCATOR&  allocator)
+: d_node_p(node)
+, d_chunk_p(chunk)
+{
+    BSLS_ASSERT_SAFE(node);
+    BSLS_ASSERT_SAFE(chunk);
+
+    ::new (d_allocator.buffer()) ALLOCATOR(allocator);
+}
+
+template <class NODE_POOL, class ALLOCATOR>
+inline
+NodeHandle<NODE_POOL, ALLOCATOR>::NodeHandle(const NodeHandle& original)
+: d_node_p(0)
+, d_chunk_p(0)
+{
+    takeOver(original);
+}
+
+template <class NODE_POOL, class ALLOCATOR>
+inline
+NodeHandle<NODE_POOL, ALLOCATOR>::~NodeHandle()
+{
+    reset();
+}
+
+// MANIPULATORS
+template <class NODE_POOL, class ALLOCATOR>
+NodeHandle<NODE_POOL, ALLOCATOR>&
+NodeHandle<NODE_POOL, ALLOCATOR>::operator=(const NodeHandle& rhs)
+{
+    if (this != &rhs) {
+        reset();
+        takeOver(rhs);
+    }
+    return *this;
+}
+
+template <class NODE_POOL, class ALLOCATOR>
+void NodeHandle<NODE_POOL, ALLOCATOR>::swap(NodeHandle& other)
+{
+    NodeHandle temp(other);
+
+    other.takeOver(*this);
+    takeOver(temp);
+}
+
+// ACCESSORS
+template <class NODE_POOL, class ALLOCATOR>
+inline
+NodeHandle<NODE_POOL, ALLOCATOR>::operator BoolType() const
+{
+    return bsls::UnspecifiedBool<NodeHandle>::makeValue(d_node_p);
+}
+
+template <class NODE_POOL, class ALLOCATOR>
+inline
+bool NodeHandle<NODE_POOL, ALLOCATOR>::empty() const
+{
+    return 0 == d_node_p;
+}
+
+template <class NODE_POOL, class ALLOCATOR>
+inline
+typename NodeHandle<NODE_POOL, ALLOCATOR>::allocator_type
+NodeHandle<NODE_POOL, ALLOCATOR>::get_allocator() const
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    return d_allocator.object();
+}
+
+template <class NODE_POOL, class ALLOCATOR>
+typename NodeHandle<NODE_POOL, ALLOCATOR>::NodeType *
+NodeHandle<NODE_POOL, ALLOCATOR>::release(NODE_POOL *nodePool) const
+{
+    BSLS_ASSERT(nodePool);
+    BSLS_ASSERT(d_node_p);
+
+    NodeType *result;
+    if (nodePool->allocator() == PoolAllocator(d_allocator.object())) {
+        nodePool->adoptNode(d_chunk_p, d_node_p);
+        result = d_node_p;
+    }
+    else {
+        result = static_cast<NodeType *>(
+                                     nodePool->createNode(d_node_p->value()));
+
+        PoolAllocator allocator(d_allocator.object());
+        bsl::allocator_traits<PoolAllocator>::destroy(
+                                   allocator,
+                                   bsls::Util::addressOf(d_node_p->value()));
+        NODE_POOL::returnNode(d_chunk_p, d_node_p, allocator);
+    }
+    bslalg::ScalarDestructionPrimitives::destroy(
+                                  bsls::Util::addressOf(d_allocator.object()));
+
+    d_node_p  = 0;
+    d_chunk_p = 0;
+
+    return result;
+}
+
+template <class NODE_POOL, class ALLOCATOR>
+inline
+typename NodeHandle<NODE_POOL, ALLOCATOR>::value_type&
+NodeHandle<NODE_POOL, ALLOCATOR>::value() const
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    return d_node_p->value();
+}
+
+                           // -------------------
+                           // class MapNodeHandle
+                           // -------------------
+
+// CREATORS
+template <class NODE_POOL, class ALLOCATOR>
+inline
+MapNodeHandle<NODE_POOL, ALLOCATOR>::MapNodeHandle()
+: Base()
+{
+}
+
+template <class NODE_POOL, class ALLOCATOR>
+inline
+MapNodeHandle<NODE_POOL, ALLOCATOR>::MapNodeHandle(
+                                         typename Base::NodeType *node,
+                                         typename Base::Chunk    *chunk,
+                                         const ALLOCATOR&         allocator)
+: Base(node, chunk, allocator)
+{
+}
+
+// ACCESSORS
+template <class NODE_POOL, class ALLOCATOR>
+inline
+typename MapNodeHandle<NODE_POOL, ALLOCATOR>::key_type&
+MapNodeHandle<NODE_POOL, ALLOCATOR>::key() const
+{
+    return const_cast<key_type&>(this->value().first);
+}
+
+template <class NODE_POOL, class ALLOCATOR>
+inline
+typename MapNodeHandle<NODE_POOL, ALLOCATOR>::mapped_type&
+MapNodeHandle<NODE_POOL, ALLOCATOR>::mapped() const
+{
+    return this->value().second;
+}
+
+                       // --------------------------
+                       // class NodeInsertReturnType
+                       // --------------------------
+
+// CREATORS
+template <class ITERATOR, class NODE_HANDLE>
+inline
+NodeInsertReturnType<ITERATOR, NODE_HANDLE>::NodeInsertReturnType()
+: position()
+, inserted(false)
+, node()
+{
+}
+
+template <class ITERATOR, class NODE_HANDLE>
+inline
+NodeInsertReturnType<ITERATOR, NODE_HANDLE>::NodeInsertReturnType(
+                                                const ITERATOR&    position,
+                                                bool               inserted,
+                                                const NODE_HANDLE& node)
+: position(position)
+, inserted(inserted)
+, node(node)
+{
+}
+
+}  // close package namespace
+
+// FREE FUNCTIONS
+template <class NODE_POOL, class ALLOCATOR>
+inline
+void bslstl::swap(NodeHandle<NODE_POOL, ALLOCATOR>& a,
+                  NodeHandle<NODE_POOL, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
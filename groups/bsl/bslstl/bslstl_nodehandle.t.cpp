@@ -0,0 +1,734 @@
+// bslstl_nodehandle.t.cpp                                            -*-C++-*-
+#include <bslstl_nodehandle.h>
+
+#include <bslstl_allocator.h>
+#include <bslstl_bidirectionalnodepool.h>
+#include <bslstl_pair.h>
+
+#include <bslalg_bidirectionalnode.h>
+
+#include <bslma_allocator.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+using namespace bslstl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides node handles, which own a node removed
+// from a node-based container, along with a reference to the chunk of the
+// pool that supplied the node.  The primary concerns are that the node
+// handle destroys its node and releases its reference (so that no memory is
+// leaked, and none is released early), that copying transfers ownership, and
+// that 'release' relinks the node (without allocating) when the allocators of
+// the handle and the target pool compare equal, and copies it otherwise.
+//
+// Global Concerns:
+//: o No memory is allocated from the default allocator.
+//: o Precondition violations are detected in appropriate build modes.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] NodeHandle();
+// [ 2] NodeHandle(NodeType *, Chunk *, const ALLOCATOR&);
+// [ 3] NodeHandle(const NodeHandle& original);
+// [ 2] ~NodeHandle();
+// [ 5] MapNodeHandle();
+// [ 5] MapNodeHandle(NodeType *, Chunk *, const ALLOCATOR&);
+// [ 5] NodeInsertReturnType();
+// [ 5] NodeInsertReturnType(const ITERATOR&, bool, const NODE_HANDLE&);
+//
+// MANIPULATORS
+// [ 3] NodeHandle& operator=(const NodeHandle& rhs);
+// [ 3] void swap(NodeHandle& other);
+//
+// ACCESSORS
+// [ 2] operator BoolType() const;
+// [ 2] bool empty() const;
+// [ 2] allocator_type get_allocator() const;
+// [ 4] NodeType *release(NODE_POOL *nodePool) const;
+// [ 2] value_type& value() const;
+// [ 5] key_type& key() const;
+// [ 5] mapped_type& mapped() const;
+//
+// FREE FUNCTIONS
+// [ 3] void swap(NodeHandle& a, NodeHandle& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+// NOTE: THIS IS A LOW-LEVEL COMPONENT AND MAY NOT USE ANY C++ LIBRARY
+// FUNCTIONS, INCLUDING IOSTREAMS.
+static int testStatus = 0;
+
+namespace {
+
+void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                       GLOBAL TEST VALUES
+// ----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bsl::allocator<int>                         IntAlloc;
+typedef BidirectionalNodePool<int, IntAlloc>        IntPool;
+typedef NodeHandle<IntPool, IntAlloc>               Obj;
+
+typedef bsl::pair<const int, int>                   PairType;
+typedef bsl::allocator<PairType>                    PairAlloc;
+typedef BidirectionalNodePool<PairType, PairAlloc>  PairPool;
+typedef MapNodeHandle<PairPool, PairAlloc>          MapObj;
+
+typedef NodeInsertReturnType<int *, Obj>            InsertResult;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static
+Obj makeHandle(IntPool *pool, int value, const IntAlloc& allocator)
+    // Return a node handle owning a node, created by the specified 'pool',
+    // holding the specified 'value', and using the specified 'allocator'.
+{
+    IntPool::NodeType *node =
+                     static_cast<IntPool::NodeType *>(pool->createNode(value));
+    return Obj(node, pool->lendNode(node), allocator);
+}
+
+//=============================================================================
+//                                 MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Transferring a Node Between Two Pools
+/// - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we are implementing a node-based container, and want to move a
+// node from one container to another without copying its value.
+//
+// First, we define the types of our node pool and node handle:
+//..
+    typedef bslstl::BidirectionalNodePool<int, bsl::allocator<int> > Pool;
+    typedef bslstl::NodeHandle<Pool, bsl::allocator<int> >           Handle;
+//..
+// Then, we create two pools using the same allocator, and create a node from
+// the first pool:
+//..
+    bslma::TestAllocator ta;
+    bsl::allocator<int>  alloc(&ta);
+
+    Pool source(alloc);
+    Pool target(alloc);
+
+    Pool::NodeType *node = static_cast<Pool::NodeType *>(
+                                                        source.createNode(42));
+//..
+// Next, we transfer the ownership of the node (having removed it from the
+// data structure of our source container) to a node handle, lending the
+// memory of the node out of the source pool:
+//..
+    Handle handle(node, source.lendNode(node), alloc);
+    ASSERT(!handle.empty());
+    ASSERT(42 == handle.value());
+//..
+// Then, we transfer the node to the target pool.  Since the allocators of the
+// pool and the node handle compare equal, the very same node is returned:
+//..
+    Pool::NodeType *transferred = handle.release(&target);
+    ASSERT(node == transferred);
+    ASSERT(handle.empty());
+//..
+// Finally, we observe that the node remains valid after the source pool is
+// released, and is deleted by the target pool.  Once both pools are released,
+// all of their memory is returned to the allocator:
+//..
+    source.release();
+    ASSERT(42 == transferred->value());
+
+    target.deleteNode(transferred);
+    target.release();
+    ASSERT(0 == ta.numBlocksInUse());
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // MAP NODE HANDLE AND INSERT RETURN TYPE
+        //
+        // Concerns:
+        //: 1 'key' and 'mapped' provide modifiable access to the respective
+        //:   members of the value of the node.
+        //:
+        //: 2 Copying a 'MapNodeHandle' transfers ownership of its node.
+        //:
+        //: 3 A default-constructed 'NodeInsertReturnType' has 'false'
+        //:   'inserted' and an empty 'node'.
+        //:
+        //: 4 Constructing a 'NodeInsertReturnType' from a node handle
+        //:   transfers the node to the 'node' member.
+        //
+        // Plan:
+        //: 1 Create a 'MapNodeHandle' owning a node holding a pair, and verify
+        //:   the accessors, modifying both the key and the mapped value.  Copy
+        //:   the handle and verify the transfer.  (C-1..2)
+        //:
+        //: 2 Create 'NodeInsertReturnType' objects using both constructors and
+        //:   verify their members.  (C-3..4)
+        //
+        // Testing:
+        //   MapNodeHandle();
+        //   MapNodeHandle(NodeType *, Chunk *, const ALLOCATOR&);
+        //   key_type& key() const;
+        //   mapped_type& mapped() const;
+        //   NodeInsertReturnType();
+        //   NodeInsertReturnType(const ITERATOR&, bool, const NODE_HANDLE&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMAP NODE HANDLE AND INSERT RETURN TYPE"
+                            "\n======================================\n");
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        {
+            PairPool pool(&ta);
+
+            MapObj mX;  const MapObj& X = mX;
+            ASSERT(X.empty());
+
+            PairPool::NodeType *node = static_cast<PairPool::NodeType *>(
+                                          pool.createNode(PairType(1, 10)));
+            MapObj mY(node, pool.lendNode(node), PairAlloc(&ta));
+            const MapObj& Y = mY;
+
+            ASSERT( 1 == Y.key());
+            ASSERT(10 == Y.mapped());
+
+            Y.key()    = 2;
+            Y.mapped() = 20;
+            ASSERT( 2 == Y.value().first);
+            ASSERT(20 == Y.value().second);
+
+            MapObj mZ(mY);  const MapObj& Z = mZ;
+            ASSERT(Y.empty());
+            ASSERT(2 == Z.key());
+
+            mX = mZ;
+            ASSERT(Z.empty());
+            ASSERT(20 == X.mapped());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        {
+            IntPool pool(&ta);
+
+            const InsertResult X;
+            ASSERT(0 == X.position);
+            ASSERT(!X.inserted);
+            ASSERT(X.node.empty());
+
+            int value = 7;
+            Obj mH = makeHandle(&pool, 7, &ta);
+
+            const InsertResult Y(&value, false, mH);
+            ASSERT(&value == Y.position);
+            ASSERT(!Y.inserted);
+            ASSERT(mH.empty());
+            ASSERT(7 == Y.node.value());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'release'
+        //
+        // Concerns:
+        //: 1 If the allocators of the handle and of the target pool compare
+        //:   equal, 'release' returns the node owned by the handle, without
+        //:   allocating memory once the target pool has reserved space for
+        //:   the adoption, and the target pool may then delete it.
+        //:
+        //: 2 The memory of a relinked node remains valid after the source pool
+        //:   is destroyed, and the chunk holding it is returned to the
+        //:   allocator once the target pool deletes the node.
+        //:
+        //: 3 If the allocators do not compare equal, 'release' returns a new
+        //:   node, supplied by the target pool and holding the same value, and
+        //:   destroys the node owned by the handle.
+        //:
+        //: 4 'release' leaves the handle empty.
+        //:
+        //: 5 Nodes may be transferred back and forth between two pools.
+        //:
+        //: 6 Precondition violations are detected in appropriate build modes.
+        //
+        // Plan:
+        //: 1 Transfer a node between two pools sharing an allocator, and
+        //:   verify the address of the node and the memory in use as each pool
+        //:   is destroyed.  (C-1..2, 4)
+        //:
+        //: 2 Transfer a node between pools using different allocators, and
+        //:   verify the value and the memory in use from each allocator.
+        //:   (C-3..4)
+        //:
+        //: 3 Transfer nodes in both directions between two pools, deleting
+        //:   nodes in each, and verify that all memory is reclaimed.  (C-5)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for an empty handle or a null pool.  (C-6)
+        //
+        // Testing:
+        //   NodeType *release(NODE_POOL *nodePool) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'release'"
+                            "\n=================\n");
+
+        if (verbose) printf("\tEqual allocators relink the node.\n");
+        {
+            bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+            IntPool *source = new IntPool(&ta);
+            IntPool  target(&ta);
+
+            Obj mX = makeHandle(source, 5, &ta);
+            target.reserveAdoption();
+            const bsls::Types::Int64 NUM_TOTAL = ta.numBlocksTotal();
+
+            IntPool::NodeType *transferred = mX.release(&target);
+            ASSERT(mX.empty());
+            ASSERT(5 == transferred->value());
+            ASSERT(NUM_TOTAL == ta.numBlocksTotal());
+
+            const bsls::Types::Int64 NUM_IN_USE = ta.numBlocksInUse();
+
+            delete source;
+            ASSERTV(ta.numBlocksInUse(), NUM_IN_USE > ta.numBlocksInUse());
+            ASSERT(5 == transferred->value());
+
+            const bsls::Types::Int64 NUM_LENT = ta.numBlocksInUse();
+
+            target.deleteNode(transferred);
+            ASSERTV(ta.numBlocksInUse(), NUM_LENT - 1 == ta.numBlocksInUse());
+
+            target.release();
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tDifferent allocators copy the value.\n");
+        {
+            bslma::TestAllocator sa("source", veryVeryVeryVerbose);
+            bslma::TestAllocator ta("target", veryVeryVeryVerbose);
+
+            IntPool source(&sa);
+            IntPool target(&ta);
+
+            Obj mX = makeHandle(&source, 8, &sa);
+            const int *original = &mX.value();
+
+            IntPool::NodeType *copied = mX.release(&target);
+            ASSERT(mX.empty());
+            ASSERT(8 == copied->value());
+            ASSERT(original != &copied->value());
+            ASSERT(1 == ta.numBlocksInUse());
+
+            target.deleteNode(copied);
+            target.release();
+            source.release();
+            ASSERTV(sa.numBlocksInUse(), 0 == sa.numBlocksInUse());
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tTransfers in both directions.\n");
+        {
+            bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+            IntPool *a = new IntPool(&ta);
+            IntPool *b = new IntPool(&ta);
+
+            for (int i = 0; i < 10; ++i) {
+                IntPool *from = i % 2 ? a : b;
+                IntPool *to   = i % 2 ? b : a;
+
+                Obj mX = makeHandle(from, i, &ta);
+                IntPool::NodeType *node = mX.release(to);
+                ASSERTV(i, i == node->value());
+                if (i % 3) {
+                    to->deleteNode(node);
+                }
+            }
+            const bsls::Types::Int64 NUM_IN_USE = ta.numBlocksInUse();
+
+            delete a;
+            ASSERTV(ta.numBlocksInUse(), NUM_IN_USE >= ta.numBlocksInUse());
+
+            delete b;
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                         bsls::AssertTest::failTestDriver);
+
+            bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+            IntPool pool(&ta);
+
+            Obj mX;
+            ASSERT_FAIL(mX.release(&pool));
+
+            Obj mY = makeHandle(&pool, 1, &ta);
+            ASSERT_FAIL(mY.release(0));
+            ASSERT_PASS(pool.deleteNode(mY.release(&pool)));
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TRANSFER SEMANTICS
+        //
+        // Concerns:
+        //: 1 The copy constructor transfers the node of the original handle,
+        //:   leaving the original empty.
+        //:
+        //: 2 Assignment destroys the node of the target (if any), transfers
+        //:   the node of the source, and leaves the source empty.
+        //:
+        //: 3 Self-assignment has no effect.
+        //:
+        //: 4 'swap' (member and free) exchanges the nodes of two handles.
+        //:
+        //: 5 No memory is leaked.
+        //:
+        //: 6 The allocator of a handle is transferred, along with its node, by
+        //:   copy construction, assignment, and 'swap'.
+        //
+        // Plan:
+        //: 1 Create handles, then copy, assign, and swap them, verifying the
+        //:   values and the emptiness of each handle.  (C-1..4)
+        //:
+        //: 2 Verify that all memory is returned to the allocator once the pool
+        //:   and all handles are destroyed.  (C-5)
+        //:
+        //: 3 Copy, assign, and swap handles holding nodes from pools using
+        //:   distinct allocators, and verify the allocator of each handle.
+        //:   (C-5..6)
+        //
+        // Testing:
+        //   NodeHandle(const NodeHandle& original);
+        //   NodeHandle& operator=(const NodeHandle& rhs);
+        //   void swap(NodeHandle& other);
+        //   void swap(NodeHandle& a, NodeHandle& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTRANSFER SEMANTICS"
+                            "\n==================\n");
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            IntPool pool(&ta);
+
+            Obj mX = makeHandle(&pool, 1, &ta);  const Obj& X = mX;
+
+            Obj mY(X);  const Obj& Y = mY;
+            ASSERT(X.empty());
+            ASSERT(1 == Y.value());
+
+            Obj mZ = makeHandle(&pool, 2, &ta);  const Obj& Z = mZ;
+            mZ = Y;
+            ASSERT(Y.empty());
+            ASSERT(1 == Z.value());
+
+            mZ = Z;
+            ASSERT(1 == Z.value());
+
+            mX = Y;
+            ASSERT(X.empty());
+            ASSERT(Y.empty());
+
+            mX = makeHandle(&pool, 3, &ta);
+            mX.swap(mZ);
+            ASSERT(1 == X.value());
+            ASSERT(3 == Z.value());
+
+            swap(mX, mY);
+            ASSERT(X.empty());
+            ASSERT(1 == Y.value());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tTransferring allocators.\n");
+        {
+            bslma::TestAllocator za("other", veryVeryVeryVerbose);
+
+            IntPool pool(&ta);
+            IntPool otherPool(&za);
+
+            Obj mX = makeHandle(&pool,      1, &ta);  const Obj& X = mX;
+            Obj mY = makeHandle(&otherPool, 2, &za);  const Obj& Y = mY;
+
+            mX.swap(mY);
+            ASSERT(2             == X.value());
+            ASSERT(IntAlloc(&za) == X.get_allocator());
+            ASSERT(1             == Y.value());
+            ASSERT(IntAlloc(&ta) == Y.get_allocator());
+
+            mX = Y;
+            ASSERT(Y.empty());
+            ASSERT(1             == X.value());
+            ASSERT(IntAlloc(&ta) == X.get_allocator());
+
+            Obj mZ = makeHandle(&otherPool, 3, &za);  const Obj& Z = mZ;
+
+            swap(mY, mZ);
+            ASSERT(Z.empty());
+            ASSERT(3             == Y.value());
+            ASSERT(IntAlloc(&za) == Y.get_allocator());
+
+            const Obj W(Y);
+            ASSERT(Y.empty());
+            ASSERT(3             == W.value());
+            ASSERT(IntAlloc(&za) == W.get_allocator());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed handle is empty and converts to 'false'.
+        //:
+        //: 2 A handle created from a node is not empty, converts to 'true',
+        //:   and provides access to the value and allocator of the node.
+        //:
+        //: 3 The value is modifiable through a 'const' handle.
+        //:
+        //: 4 Destroying a handle destroys the value of its node, and returns
+        //:   the memory of the node to its chunk, so that the chunk is
+        //:   returned to the allocator only after both the handle and the
+        //:   source pool are destroyed, in either order.
+        //
+        // Plan:
+        //: 1 Create handles using each constructor and verify the accessors.
+        //:   (C-1..3)
+        //:
+        //: 2 Destroy a handle and its source pool in both orders, verifying
+        //:   the memory in use after each step.  (C-4)
+        //
+        // Testing:
+        //   NodeHandle();
+        //   NodeHandle(NodeType *, Chunk *, const ALLOCATOR&);
+        //   ~NodeHandle();
+        //   operator BoolType() const;
+        //   bool empty() const;
+        //   allocator_type get_allocator() const;
+        //   value_type& value() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS AND BASIC ACCESSORS"
+                            "\n============================\n");
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        {
+            const Obj X;
+            ASSERT(X.empty());
+            ASSERT(!X);
+        }
+
+        if (verbose) printf("\tHandle outlives the pool.\n");
+        {
+            IntPool *pool = new IntPool(&ta);
+
+            const Obj X = makeHandle(pool, 42, &ta);
+            ASSERT(!X.empty());
+            ASSERT(X);
+            ASSERT(42 == X.value());
+            ASSERT(IntAlloc(&ta) == X.get_allocator());
+
+            X.value() = 43;
+            ASSERT(43 == X.value());
+
+            const bsls::Types::Int64 NUM_IN_USE = ta.numBlocksInUse();
+            delete pool;
+            ASSERTV(ta.numBlocksInUse(), 0 < ta.numBlocksInUse());
+            ASSERTV(ta.numBlocksInUse(), NUM_IN_USE >= ta.numBlocksInUse());
+            ASSERT(43 == X.value());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tPool outlives the handle.\n");
+        {
+            IntPool pool(&ta);
+            {
+                const Obj X = makeHandle(&pool, 1, &ta);
+                ASSERT(1 == X.value());
+            }
+            ASSERT(0 < ta.numBlocksInUse());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Extract a node into a handle, transfer it to another pool, and
+        //:   verify the value.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+        {
+            IntPool source(&ta);
+            IntPool target(&ta);
+
+            Obj mX = makeHandle(&source, 17, &ta);
+            ASSERT(17 == mX.value());
+
+            Obj mY(mX);
+            ASSERT(mX.empty());
+
+            IntPool::NodeType *node = mY.release(&target);
+            ASSERT(mY.empty());
+            ASSERT(17 == node->value());
+
+            target.deleteNode(node);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1152 @@
+// bslstl_pairingheap.h                                               -*-C++-*-
+#ifndef INCLUDED_BSLSTL_PAIRINGHEAP
+#define INCLUDED_BSLSTL_PAIRINGHEAP
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an addressable priority queue held in a pairing heap.
+//
+//@CLASSES:
+//  bsl::pairing_heap: priority queue supporting 'decrease_key' and 'erase'
+//
+//@SEE_ALSO: bslstl_priorityqueue, bslstl_heappolicy, bslstl_simplepool
+//
+//@DESCRIPTION: This component defines a class template, 'bsl::pairing_heap',
+// a priority queue of values of the (template parameter) type 'VALUE', ordered
+// by the (template parameter) type 'COMPARATOR', that, unlike
+// 'bsl::priority_queue', is *addressable*: 'push' returns a 'handle_type'
+// referring to the inserted element, through which the element can later be
+// accessed ('value'), given a higher priority ('decrease_key'), given an
+// arbitrary new value ('update'), or removed ('erase'), regardless of its
+// position in the queue.  As for 'bsl::priority_queue', the element on 'top'
+// is the one of highest priority, i.e., an element 'e' for which
+// 'comparator(e, x)' is 'false' for every element 'x' in the queue, so that,
+// for example, a 'pairing_heap' using 'std::greater' holds its smallest
+// element on top.
+//
+// The elements are held in the nodes of a pairing heap, a heap-ordered
+// multi-way tree that is restructured only lazily, by pairwise melding of
+// subtrees, when the top element is removed.  Each node is allocated from a
+// 'bslstl::SimplePool' using the allocator of the 'pairing_heap', so that the
+// nodes of the removed elements are reused, and memory for a large number of
+// nodes can be obtained in a single allocation using 'reserve'.  A node, and
+// so a handle referring to it, remains valid until its element is removed
+// from the queue.
+//
+///Naming of 'decrease_key'
+///------------------------
+// 'decrease_key' is named after the operation on a *min*-priority queue (e.g.,
+// a 'pairing_heap' using 'std::greater'), in which a higher priority is a
+// smaller key.  For any 'COMPARATOR', 'decrease_key' assigns a value to an
+// element that does not lower the priority of the element, and is
+// substantially faster than 'update', which accepts any value.
+//
+///Requirements on 'COMPARATOR'
+///----------------------------
+// 'COMPARATOR' must define a strict weak ordering of the values of 'VALUE',
+// and must not throw.  Since the heap is restructured by the comparisons
+// themselves, an exception thrown by the comparator would leave the heap in an
+// unusable state.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'pairing_heap':
+//..
+//  Legend
+//  ------
+//  'X'             - 'pairing_heap<V, C, A>'
+//  'a', 'b'        - distinct objects of type 'X'
+//  'h'             - a handle referring to an element of 'a'
+//  'v'             - an object of type 'V'
+//  'n', 'm'        - number of elements in 'a' and 'b', respectively
+//  'k'             - a number of elements
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | X a; (default construction)                        | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | X a(b); (copy construction)                        | O[m]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.~X(); (destruction)                              | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a = b; (assignment)                                | O[n + m]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.push(v)                                          | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.top(), a.value(h)                                | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.pop(), a.erase(h)                                | Amortized O[log n] |
+//  +----------------------------------------------------+--------------------+
+//  | a.decrease_key(h, v)                               | Amortized          |
+//  |                                                    | o[log n]           |
+//  +----------------------------------------------------+--------------------+
+//  | a.update(h, v)                                     | Amortized O[log n] |
+//  +----------------------------------------------------+--------------------+
+//  | a.reserve(k)                                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.clear()                                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b)                                          | O[1] if 'a' and    |
+//  |                                                    | 'b' use the same   |
+//  |                                                    | allocator,         |
+//  |                                                    | O[n + m] otherwise |
+//  +----------------------------------------------------+--------------------+
+//  | a.empty(), a.size(), a.get_allocator(),            | O[1]               |
+//  | a.value_comp()                                     |                    |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Rescheduling and Cancelling Timers
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we implement a timer queue, in which the earliest deadline is
+// processed first, and in which a timer may be rescheduled or cancelled
+// before its deadline.
+//
+// First, we create a queue of deadlines, ordered by 'std::greater' so that the
+// earliest deadline is on top, and reserve memory for the timers we expect:
+//..
+//  typedef bsl::pairing_heap<int, std::greater<int> > TimerQueue;
+//
+//  TimerQueue timers;
+//  timers.reserve(4);
+//..
+// Then, we schedule four timers, keeping the handles returned by 'push':
+//..
+//  TimerQueue::handle_type a = timers.push(30);
+//  TimerQueue::handle_type b = timers.push(10);
+//  TimerQueue::handle_type c = timers.push(50);
+//  TimerQueue::handle_type d = timers.push(40);
+//
+//  assert(4  == timers.size());
+//  assert(10 == timers.top());
+//..
+// Next, we reschedule timer 'c' to an earlier deadline, which, as the
+// deadline of a timer in a min-queue decreases, is done with 'decrease_key':
+//..
+//  timers.decrease_key(c, 5);
+//  assert(5 == timers.top());
+//  assert(5 == timers.value(c));
+//..
+// Then, we cancel timer 'b', and postpone timer 'a' to a later deadline,
+// using 'update':
+//..
+//  timers.erase(b);
+//  timers.update(a, 60);
+//  assert(60 == timers.value(a));
+//  assert(40 == timers.value(d));
+//..
+// Finally, we process the remaining timers in order of their deadlines:
+//..
+//  const int EXPECTED[] = { 5, 40, 60 };
+//  for (int i = 0; !timers.empty(); ++i) {
+//      assert(EXPECTED[i] == timers.top());
+//      timers.pop();
+//  }
+//..
+
+// Prevent 'bslstl' headers from being included directly in 'BSL_OVERRIDES_STD'
+// mode.  Doing so is unsupported, and is likely to cause compilation errors.
+#if defined(BSL_OVERRIDES_STD) && !defined(BSL_STDHDRS_PROLOGUE_IN_EFFECT)
+#error "<bslstl_pairingheap.h> header can't be included directly in \
+BSL_OVERRIDES_STD mode"
+#endif
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATORTRAITS
+#include <bslstl_allocatortraits.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_SIMPLEPOOL
+#include <bslstl_simplepool.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEALLOCATORPROCTOR
+#include <bslma_deallocatorproctor.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_NATIVESTD
+#include <bsls_nativestd.h>
+#endif
+
+#ifndef INCLUDED_BSLS_UTIL
+#include <bsls_util.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+#ifndef INCLUDED_FUNCTIONAL
+#include <functional>
+#define INCLUDED_FUNCTIONAL
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                          // =======================
+                          // struct PairingHeap_Node
+                          // =======================
+
+template <class VALUE>
+struct PairingHeap_Node {
+    // For use only by 'bsl::pairing_heap'.  This POD-like 'struct' describes
+    // a node of a pairing heap holding a value of the parameterized 'VALUE'.
+    // The children of a node form a doubly-linked list of siblings, the first
+    // child of which links back to the parent.  A node is never constructed,
+    // destroyed, or assigned; its 'd_value' is separately constructed and
+    // destroyed using an appropriate 'bsl::allocator_traits' object.
+
+    // DATA
+    PairingHeap_Node *d_child_p;  // first child, or 0 if none
+
+    PairingHeap_Node *d_next_p;   // next sibling, or 0 if none
+
+    PairingHeap_Node *d_prev_p;   // previous sibling, or parent if this node
+                                  // is a first child, or 0 if this node is a
+                                  // root
+
+    VALUE             d_value;    // payload value
+
+  private:
+    // NOT IMPLEMENTED
+    PairingHeap_Node();
+    PairingHeap_Node(const PairingHeap_Node&);
+    PairingHeap_Node& operator=(const PairingHeap_Node&);
+    ~PairingHeap_Node();
+};
+
+                         // ========================
+                         // class PairingHeap_Handle
+                         // ========================
+
+template <class VALUE>
+class PairingHeap_Handle {
+    // This in-core value-semantic class refers to an element of a
+    // 'bsl::pairing_heap' holding values of the parameterized 'VALUE', or to
+    // no element.  A handle referring to an element remains valid until the
+    // element is removed from the heap.
+
+    // DATA
+    PairingHeap_Node<VALUE> *d_node_p;  // referenced node (not owned), or 0
+
+  public:
+    // CREATORS
+    PairingHeap_Handle();
+        // Create a handle referring to no element.
+
+    explicit PairingHeap_Handle(PairingHeap_Node<VALUE> *node);
+        // Create a handle referring to the element held in the specified
+        // 'node'.  Note that this constructor is for use only by
+        // 'bsl::pairing_heap'.
+
+    // PairingHeap_Handle(const PairingHeap_Handle& original) = default;
+    // ~PairingHeap_Handle() = default;
+
+    // MANIPULATORS
+    // PairingHeap_Handle& operator=(const PairingHeap_Handle& rhs) = default;
+
+    // ACCESSORS
+    PairingHeap_Node<VALUE> *node() const;
+        // Return the address of the node holding the element to which this
+        // handle refers, or 0 if this handle refers to no element.  Note that
+        // this method is for use only by 'bsl::pairing_heap'.
+};
+
+// FREE OPERATORS
+template <class VALUE>
+bool operator==(const PairingHeap_Handle<VALUE>& lhs,
+                const PairingHeap_Handle<VALUE>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' handles refer to the same
+    // element, or both refer to no element, and 'false' otherwise.
+
+template <class VALUE>
+bool operator!=(const PairingHeap_Handle<VALUE>& lhs,
+                const PairingHeap_Handle<VALUE>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' handles do not refer to
+    // the same element, and 'false' otherwise.
+
+                      // ==============================
+                      // class PairingHeap_ClearProctor
+                      // ==============================
+
+template <class HEAP>
+class PairingHeap_ClearProctor {
+    // This class implements a proctor that, unless its 'release' method is
+    // invoked, clears the parameterized 'HEAP' object supplied at
+    // construction when the proctor is destroyed.
+
+    // DATA
+    HEAP *d_heap_p;  // heap to clear (not owned), or 0 if released
+
+  private:
+    // NOT IMPLEMENTED
+    PairingHeap_ClearProctor(const PairingHeap_ClearProctor&);
+    PairingHeap_ClearProctor& operator=(const PairingHeap_ClearProctor&);
+
+  public:
+    // CREATORS
+    explicit PairingHeap_ClearProctor(HEAP *heap);
+        // Create a proctor that clears the specified 'heap' on destruction.
+
+    ~PairingHeap_ClearProctor();
+        // Destroy this proctor, clearing the heap supplied at construction,
+        // unless 'release' has been called.
+
+    // MANIPULATORS
+    void release();
+        // Release the heap supplied at construction from management by this
+        // proctor.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                            // ==================
+                            // class pairing_heap
+                            // ==================
+
+template <class VALUE,
+          class COMPARATOR = native_std::less<VALUE>,
+          class ALLOCATOR  = allocator<VALUE> >
+class pairing_heap {
+    // This class template implements an addressable priority queue of values
+    // of the parameterized 'VALUE', ordered by the parameterized 'COMPARATOR'
+    // and held in a pairing heap whose nodes are supplied by the parameterized
+    // 'ALLOCATOR'.  The element on top is an element of highest priority,
+    // i.e., an element 'e' for which 'comparator(e, x)' is 'false' for every
+    // element 'x'.  'push' returns a handle through which the element can be
+    // accessed, reprioritized, and removed until it is removed from the queue.
+    // The behavior is undefined if 'COMPARATOR' throws an exception.
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::PairingHeap_Node<VALUE>      Node;
+        // Alias for the type of the nodes of the heap.
+
+    typedef BloombergLP::bslstl::SimplePool<Node, ALLOCATOR>  Pool;
+        // Alias for the pool supplying the nodes of the heap.
+
+    typedef typename Pool::AllocatorTraits                   AllocatorTraits;
+        // Alias for the allocator traits defined by 'SimplePool'.
+
+    typedef BloombergLP::bslstl::PairingHeap_ClearProctor<pairing_heap>
+                                                              ClearProctor;
+        // Alias for the proctor clearing a partially copied heap.
+
+  public:
+    // PUBLIC TYPES
+    typedef VALUE                                            value_type;
+    typedef const VALUE&                                     const_reference;
+    typedef native_std::size_t                               size_type;
+    typedef COMPARATOR                                       value_compare;
+    typedef ALLOCATOR                                        allocator_type;
+    typedef BloombergLP::bslstl::PairingHeap_Handle<VALUE>   handle_type;
+
+  private:
+    // DATA
+    COMPARATOR  d_comparator;  // orders the elements
+
+    Pool        d_pool;        // supplies the nodes
+
+    Node       *d_root_p;      // node holding the top element, or 0 if empty
+
+    size_type   d_size;        // number of elements
+
+  private:
+    // PRIVATE MANIPULATORS
+    Node *createNode(const VALUE& value);
+        // Return the address of a new root node holding a copy of the
+        // specified 'value'.
+
+    void deleteNode(Node *node);
+        // Destroy the value of the specified 'node', and return the memory
+        // footprint of 'node' to the pool for reuse.
+
+    Node *meld(Node *first, Node *second);
+        // Make the specified 'first' or 'second' root node, whichever holds
+        // the value of lower priority ('second' if the values are equivalent),
+        // the first child of the other, and return the address of the other.
+
+    Node *combineSiblings(Node *first);
+        // Meld the trees rooted at the list of siblings starting at the
+        // specified 'first' node into a single tree, by melding pairs of
+        // siblings from left to right, and then melding the resulting trees
+        // from right to left, and return the address of its root, or 0 if
+        // 'first' is 0.
+
+    void cut(Node *node);
+        // Unlink the specified 'node', with its subtree, from its parent and
+        // siblings, making it a root.  The behavior is undefined unless
+        // 'node' is not the root of the heap.
+
+    void detach(Node *node);
+        // Remove the specified 'node' from the heap, making its children part
+        // of the heap, and leave 'node' a root having no children.  Note that
+        // the size of the heap is unchanged.
+
+    void copyNodes(const pairing_heap& original);
+        // Create in this empty heap a copy of each node of the specified
+        // 'original' heap, preserving the shape of its tree.  If an exception
+        // is thrown, the nodes copied so far are held by this heap.
+
+    void quickSwap(pairing_heap& other);
+        // Exchange the elements and comparator of this object with those of
+        // the specified 'other' object.  The behavior is undefined unless
+        // this object and 'other' use the same allocator.
+
+  public:
+    // CREATORS
+    explicit pairing_heap(const ALLOCATOR& basicAllocator = ALLOCATOR());
+        // Create an empty heap, ordered by a default-constructed
+        // 'COMPARATOR'.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is not supplied, a default-constructed
+        // object of the (template parameter) type 'ALLOCATOR' is used.  If the
+        // type 'ALLOCATOR' is 'bsl::allocator' (the default), then
+        // 'basicAllocator', if supplied, shall be convertible to
+        // 'bslma::Allocator *'.  If the type 'ALLOCATOR' is 'bsl::allocator'
+        // and 'basicAllocator' is not supplied, the currently installed
+        // default allocator is used.
+
+    explicit pairing_heap(const COMPARATOR& comparator,
+                          const ALLOCATOR&  basicAllocator = ALLOCATOR());
+        // Create an empty heap, ordered by the specified 'comparator'.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied, a default-constructed object of
+        // the (template parameter) type 'ALLOCATOR' is used.
+
+    pairing_heap(const pairing_heap& original);
+        // Create a heap having the same elements and comparator as the
+        // specified 'original' heap.  Use the allocator returned by
+        // 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // supply memory.  If the (template parameter) type 'ALLOCATOR' is
+        // 'bsl::allocator' (the default), the currently installed default
+        // allocator is used.  Note that no handle referring to an element of
+        // 'original' refers to an element of the new heap.
+
+    pairing_heap(const pairing_heap& original,
+                 const ALLOCATOR&    basicAllocator);
+        // Create a heap having the same elements and comparator as the
+        // specified 'original' heap, using the specified 'basicAllocator' to
+        // supply memory.
+
+    ~pairing_heap();
+        // Destroy this object, and all of its elements.
+
+    // MANIPULATORS
+    pairing_heap& operator=(const pairing_heap& rhs);
+        // Assign to this object the elements and comparator of the specified
+        // 'rhs' object, and return a reference providing modifiable access to
+        // this object.  Every handle referring to an element of this object
+        // is invalidated.  If an exception is thrown, this object is left
+        // unchanged.
+
+    handle_type push(const value_type& value);
+        // Insert a copy of the specified 'value' into this heap, and return a
+        // handle referring to the inserted element.  If an exception is
+        // thrown, this object is left unchanged.
+
+    void pop();
+        // Remove the top element of this heap.  The behavior is undefined
+        // unless this heap is not empty.
+
+    void erase(handle_type handle);
+        // Remove the element referred to by the specified 'handle' from this
+        // heap.  The behavior is undefined unless 'handle' refers to an
+        // element of this heap.
+
+    void decrease_key(handle_type handle, const value_type& value);
+        // Assign the specified 'value' to the element referred to by the
+        // specified 'handle', and restore the order of this heap.  If an
+        // exception is thrown by the assignment, this object is left
+        // unchanged.  The behavior is undefined unless 'handle' refers to an
+        // element of this heap and 'value' does not have a lower priority
+        // than the current value of the element, i.e., unless
+        // '!value_comp()(value, this->value(handle))'.  Note that the name of
+        // this method follows the convention of min-priority queues (see
+        // {Naming of 'decrease_key'}).
+
+    void update(handle_type handle, const value_type& value);
+        // Assign the specified 'value' to the element referred to by the
+        // specified 'handle', and restore the order of this heap.  If an
+        // exception is thrown by the assignment, this object is left
+        // unchanged.  The behavior is undefined unless 'handle' refers to an
+        // element of this heap.  Note that 'decrease_key' is faster if the
+        // priority of the element is not lowered.
+
+    void reserve(size_type numElements);
+        // Allocate, in a single block, memory sufficient for inserting the
+        // specified 'numElements' additional elements into this heap without
+        // further allocation by the heap itself.  Note that memory of removed
+        // elements is also reused by subsequent insertions.
+
+    void clear();
+        // Remove all elements from this heap.  Note that the memory of the
+        // removed elements is retained for reuse by this heap.
+
+    void swap(pairing_heap& other);
+        // Exchange the elements and comparator of this object with those of
+        // the specified 'other' object.  If this object and 'other' use the
+        // same allocator, this method provides the no-throw exception-safety
+        // guarantee, and each handle refers to the same element, now held by
+        // the other object; otherwise, this method provides the strong
+        // exception-safety guarantee, and invalidates every handle referring
+        // to an element of either object.
+
+    // ACCESSORS
+    const_reference top() const;
+        // Return a reference providing non-modifiable access to the top
+        // element of this heap.  The behavior is undefined unless this heap is
+        // not empty.
+
+    const_reference value(handle_type handle) const;
+        // Return a reference providing non-modifiable access to the element
+        // referred to by the specified 'handle'.  The behavior is undefined
+        // unless 'handle' refers to an element of this heap.
+
+    bool empty() const;
+        // Return 'true' if this heap has no elements, and 'false' otherwise.
+
+    size_type size() const;
+        // Return the number of elements in this heap.
+
+    value_compare value_comp() const;
+        // Return a copy of the comparator ordering the elements of this heap.
+
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used to supply memory for this
+        // heap.
+};
+
+// FREE FUNCTIONS
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+void swap(pairing_heap<VALUE, COMPARATOR, ALLOCATOR>& a,
+          pairing_heap<VALUE, COMPARATOR, ALLOCATOR>& b);
+    // Exchange the elements and comparators of the specified 'a' and 'b'
+    // objects.  See 'pairing_heap::swap'.
+
+}  // close namespace bsl
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+namespace BloombergLP {
+namespace bslstl {
+
+                         // ------------------------
+                         // class PairingHeap_Handle
+                         // ------------------------
+
+// CREATORS
+template <class VALUE>
+inline
+PairingHeap_Handle<VALUE>::PairingHeap_Handle()
+: d_node_p(0)
+{
+}
+
+template <class VALUE>
+inline
+PairingHeap_Handle<VALUE>::PairingHeap_Handle(PairingHeap_Node<VALUE> *node)
+: d_node_p(node)
+{
+}
+
+// ACCESSORS
+template <class VALUE>
+inline
+PairingHeap_Node<VALUE> *PairingHeap_Handle<VALUE>::node() const
+{
+    return d_node_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class VALUE>
+inline
+bool bslstl::operator==(const PairingHeap_Handle<VALUE>& lhs,
+                        const PairingHeap_Handle<VALUE>& rhs)
+{
+    return lhs.node() == rhs.node();
+}
+
+template <class VALUE>
+inline
+bool bslstl::operator!=(const PairingHeap_Handle<VALUE>& lhs,
+                        const PairingHeap_Handle<VALUE>& rhs)
+{
+    return lhs.node() != rhs.node();
+}
+
+namespace bslstl {
+
+                      // ------------------------------
+                      // class PairingHeap_ClearProctor
+                      // ------------------------------
+
+// CREATORS
+template <class HEAP>
+inline
+PairingHeap_ClearProctor<HEAP>::PairingHeap_ClearProctor(HEAP *heap)
+: d_heap_p(heap)
+{
+}
+
+template <class HEAP>
+inline
+PairingHeap_ClearProctor<HEAP>::~PairingHeap_ClearProctor()
+{
+    if (d_heap_p) {
+        d_heap_p->clear();
+    }
+}
+
+// MANIPULATORS
+template <class HEAP>
+inline
+void PairingHeap_ClearProctor<HEAP>::release()
+{
+    d_heap_p = 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                            // ------------------
+                            // class pairing_heap
+                            // ------------------
+
+// PRIVATE MANIPULATORS
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::Node *
+pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::createNode(const VALUE& value)
+{
+    Node *node = d_pool.allocate();
+    BloombergLP::bslma::DeallocatorProctor<Pool> proctor(node, &d_pool);
+
+    AllocatorTraits::construct(d_pool.allocator(),
+                               BSLS_UTIL_ADDRESSOF(node->d_value),
+                               value);
+    proctor.release();
+
+    node->d_child_p = 0;
+    node->d_next_p  = 0;
+    node->d_prev_p  = 0;
+    return node;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::deleteNode(Node *node)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    AllocatorTraits::destroy(d_pool.allocator(),
+                             BSLS_UTIL_ADDRESSOF(node->d_value));
+    d_pool.deallocate(node);
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::Node *
+pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::meld(Node *first, Node *second)
+{
+    BSLS_ASSERT_SAFE(first  && !first->d_prev_p  && !first->d_next_p);
+    BSLS_ASSERT_SAFE(second && !second->d_prev_p && !second->d_next_p);
+
+    if (d_comparator(first->d_value, second->d_value)) {
+        Node *tmp = first;
+        first     = second;
+        second    = tmp;
+    }
+
+    second->d_prev_p = first;
+    second->d_next_p = first->d_child_p;
+    if (first->d_child_p) {
+        first->d_child_p->d_prev_p = second;
+    }
+    first->d_child_p = second;
+    return first;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+typename pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::Node *
+pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::combineSiblings(Node *first)
+{
+    if (!first) {
+        return 0;                                                     // RETURN
+    }
+
+    // First pass: meld the siblings in pairs, from left to right, pushing
+    // each resulting tree onto a stack linked through 'd_prev_p'.
+
+    Node *stack = 0;
+    while (first) {
+        Node *second = first->d_next_p;
+        Node *next   = second ? second->d_next_p : 0;
+
+        first->d_prev_p = 0;
+        first->d_next_p = 0;
+        if (second) {
+            second->d_prev_p = 0;
+            second->d_next_p = 0;
+            first = meld(first, second);
+        }
+        first->d_prev_p = stack;
+        stack           = first;
+        first           = next;
+    }
+
+    // Second pass: meld the trees into the last one, from right to left.
+
+    Node *result = stack;
+    stack = stack->d_prev_p;
+    result->d_prev_p = 0;
+    while (stack) {
+        Node *next = stack->d_prev_p;
+        stack->d_prev_p = 0;
+        result = meld(stack, result);
+        stack  = next;
+    }
+    return result;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::cut(Node *node)
+{
+    BSLS_ASSERT_SAFE(node && node->d_prev_p);
+
+    // 'd_prev_p' is the parent of a first child, whose 'd_child_p' is then
+    // 'node', and otherwise the previous sibling.
+
+    if (node->d_prev_p->d_child_p == node) {
+        node->d_prev_p->d_child_p = node->d_next_p;
+    }
+    else {
+        node->d_prev_p->d_next_p = node->d_next_p;
+    }
+    if (node->d_next_p) {
+        node->d_next_p->d_prev_p = node->d_prev_p;
+    }
+    node->d_prev_p = 0;
+    node->d_next_p = 0;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+void pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::detach(Node *node)
+{
+    BSLS_ASSERT_SAFE(node);
+
+    if (node == d_root_p) {
+        d_root_p = combineSiblings(node->d_child_p);
+    }
+    else {
+        cut(node);
+        Node *subtree = combineSiblings(node->d_child_p);
+        if (subtree) {
+            d_root_p = meld(d_root_p, subtree);
+        }
+    }
+    node->d_child_p = 0;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+void pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::copyNodes(
+                                                 const pairing_heap& original)
+{
+    BSLS_ASSERT_SAFE(!d_root_p);
+
+    const Node *source = original.d_root_p;
+    if (!source) {
+        return;                                                       // RETURN
+    }
+
+    // Visit the nodes of 'original' in pre-order, viewing each node as a
+    // binary tree node whose left child is its first child, whose right child
+    // is its next sibling, and whose parent is 'd_prev_p'.  Each copy is
+    // linked into this heap as soon as it is created, so that a partial copy
+    // can be cleared.
+
+    Node *target = createNode(source->d_value);
+    d_root_p = target;
+    for (;;) {
+        if (source->d_child_p) {
+            source = source->d_child_p;
+
+            Node *copy = createNode(source->d_value);
+            copy->d_prev_p    = target;
+            target->d_child_p = copy;
+            target            = copy;
+            continue;
+        }
+
+        // Find the nearest node, starting with 'source' and ascending
+        // through the nodes of which it is in the left subtree, that has a
+        // next sibling.
+
+        while (!source->d_next_p) {
+            while (source != original.d_root_p
+                && source->d_prev_p->d_next_p == source) {
+                source = source->d_prev_p;
+                target = target->d_prev_p;
+            }
+            if (source == original.d_root_p) {
+                d_size = original.d_size;
+                return;                                               // RETURN
+            }
+            source = source->d_prev_p;
+            target = target->d_prev_p;
+        }
+
+        source = source->d_next_p;
+
+        Node *copy = createNode(source->d_value);
+        copy->d_prev_p   = target;
+        target->d_next_p = copy;
+        target           = copy;
+    }
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::quickSwap(
+                                                          pairing_heap& other)
+{
+    BloombergLP::bslalg::SwapUtil::swap(&d_comparator, &other.d_comparator);
+    d_pool.quickSwapRetainAllocators(other.d_pool);
+    BloombergLP::bslalg::SwapUtil::swap(&d_root_p, &other.d_root_p);
+    BloombergLP::bslalg::SwapUtil::swap(&d_size,   &other.d_size);
+}
+
+// CREATORS
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::pairing_heap(
+                                               const ALLOCATOR& basicAllocator)
+: d_comparator()
+, d_pool(basicAllocator)
+, d_root_p(0)
+, d_size(0)
+{
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::pairing_heap(
+                                              const COMPARATOR& comparator,
+                                              const ALLOCATOR&  basicAllocator)
+: d_comparator(comparator)
+, d_pool(basicAllocator)
+, d_root_p(0)
+, d_size(0)
+{
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::pairing_heap(
+                                                  const pairing_heap& original)
+: d_comparator(original.d_comparator)
+, d_pool(AllocatorTraits::select_on_container_copy_construction(
+                                                  original.d_pool.allocator()))
+, d_root_p(0)
+, d_size(0)
+{
+    ClearProctor proctor(this);
+    copyNodes(original);
+    proctor.release();
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::pairing_heap(
+                                           const pairing_heap& original,
+                                           const ALLOCATOR&    basicAllocator)
+: d_comparator(original.d_comparator)
+, d_pool(basicAllocator)
+, d_root_p(0)
+, d_size(0)
+{
+    ClearProctor proctor(this);
+    copyNodes(original);
+    proctor.release();
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::~pairing_heap()
+{
+    clear();
+}
+
+// MANIPULATORS
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+pairing_heap<VALUE, COMPARATOR, ALLOCATOR>&
+pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::operator=(const pairing_heap& rhs)
+{
+    if (this != BSLS_UTIL_ADDRESSOF(rhs)) {
+        pairing_heap other(rhs, get_allocator());
+        quickSwap(other);
+    }
+    return *this;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::handle_type
+pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::push(const value_type& value)
+{
+    Node *node = createNode(value);
+    d_root_p = d_root_p ? meld(d_root_p, node) : node;
+    ++d_size;
+    return handle_type(node);
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+void pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::pop()
+{
+    BSLS_ASSERT_SAFE(d_root_p);
+
+    Node *root = d_root_p;
+    d_root_p = combineSiblings(root->d_child_p);
+    deleteNode(root);
+    --d_size;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+void pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::erase(handle_type handle)
+{
+    BSLS_ASSERT_SAFE(handle.node());
+    BSLS_ASSERT_SAFE(d_root_p);
+
+    Node *node = handle.node();
+    detach(node);
+    deleteNode(node);
+    --d_size;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+void pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::decrease_key(
+                                                   handle_type       handle,
+                                                   const value_type& value)
+{
+    BSLS_ASSERT_SAFE(handle.node());
+    BSLS_ASSERT_SAFE(!d_comparator(value, handle.node()->d_value));
+
+    Node *node = handle.node();
+    node->d_value = value;
+    if (node != d_root_p) {
+        cut(node);
+        d_root_p = meld(d_root_p, node);
+    }
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+void pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::update(
+                                                   handle_type       handle,
+                                                   const value_type& value)
+{
+    BSLS_ASSERT_SAFE(handle.node());
+
+    Node *node = handle.node();
+    if (!d_comparator(value, node->d_value)) {
+        decrease_key(handle, value);
+        return;                                                       // RETURN
+    }
+
+    // The priority of the element is lowered: its children may now have a
+    // higher priority, so the node is removed and melded back as a leaf.
+
+    node->d_value = value;
+    detach(node);
+    d_root_p = d_root_p ? meld(d_root_p, node) : node;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::reserve(
+                                                         size_type numElements)
+{
+    if (0 < numElements) {
+        d_pool.reserve(numElements);
+    }
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+void pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::clear()
+{
+    // Delete the nodes without recursion by rotating, in the binary view of
+    // the tree (see 'copyNodes'), each node having a left child to the right
+    // until the node to be deleted has no left child.
+
+    Node *node = d_root_p;
+    while (node) {
+        Node *child = node->d_child_p;
+        if (child) {
+            node->d_child_p = child->d_next_p;
+            child->d_next_p = node;
+            node            = child;
+        }
+        else {
+            Node *next = node->d_next_p;
+            deleteNode(node);
+            node = next;
+        }
+    }
+    d_root_p = 0;
+    d_size   = 0;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+void pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::swap(pairing_heap& other)
+{
+    if (get_allocator() == other.get_allocator()) {
+        quickSwap(other);
+    }
+    else {
+        pairing_heap thisCopy(*this, other.get_allocator());
+        pairing_heap otherCopy(other, get_allocator());
+
+        quickSwap(otherCopy);
+        other.quickSwap(thisCopy);
+    }
+}
+
+// ACCESSORS
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::const_reference
+pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::top() const
+{
+    BSLS_ASSERT_SAFE(d_root_p);
+
+    return d_root_p->d_value;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::const_reference
+pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::value(handle_type handle) const
+{
+    BSLS_ASSERT_SAFE(handle.node());
+
+    return handle.node()->d_value;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::empty() const
+{
+    return 0 == d_size;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::size_type
+pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::size() const
+{
+    return d_size;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::value_compare
+pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return d_comparator;
+}
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::allocator_type
+pairing_heap<VALUE, COMPARATOR, ALLOCATOR>::get_allocator() const
+{
+    return allocator_type(d_pool.allocator());
+}
+
+// FREE FUNCTIONS
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void swap(pairing_heap<VALUE, COMPARATOR, ALLOCATOR>& a,
+          pairing_heap<VALUE, COMPARATOR, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+}  // close namespace bsl
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for 'pairing_heap':
+//: o A 'pairing_heap' uses 'bslma' allocators if the parameterized
+//:   'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+
+namespace BloombergLP {
+namespace bslma {
+
+template <class VALUE, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::pairing_heap<VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
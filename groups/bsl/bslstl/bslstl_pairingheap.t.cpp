@@ -0,0 +1,1042 @@
+// bslstl_pairingheap.t.cpp                                           -*-C++-*-
+#include <bslstl_pairingheap.h>
+
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+
+#include <bsltf_alloctesttype.h>
+#include <bsltf_stdtestallocator.h>
+
+#include <algorithm>
+#include <functional>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is an addressable priority queue held in a
+// pairing heap.  The primary manipulators, 'push' and 'pop', and the basic
+// accessors, 'top', 'size', and 'empty', are tested against a sorted 'vector'
+// holding the same values.  The manipulators taking a handle, 'decrease_key',
+// 'update', and 'erase', are tested by applying pseudo-random sequences of
+// operations both to the heap and to a simple model of it, a 'vector' of
+// values and handles, and verifying the top element and every handle after
+// each operation.  Copying is verified to preserve the elements and to be
+// exception safe, and the nodes are verified to be supplied by the allocator
+// of the heap, to be reused, and to be allocated at once by 'reserve'.
+// Heaps of large depth are copied and destroyed to verify that no operation
+// recurses on the depth of the heap.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit pairing_heap(const ALLOCATOR& basicAllocator = A());
+// [ 2] explicit pairing_heap(const COMPARATOR&, const ALLOCATOR& = A());
+// [ 3] pairing_heap(const pairing_heap& original);
+// [ 3] pairing_heap(const pairing_heap& original, const ALLOCATOR& a);
+// [ 2] ~pairing_heap();
+//
+// MANIPULATORS
+// [ 3] pairing_heap& operator=(const pairing_heap& rhs);
+// [ 2] handle_type push(const value_type& value);
+// [ 2] void pop();
+// [ 4] void erase(handle_type handle);
+// [ 4] void decrease_key(handle_type handle, const value_type& value);
+// [ 4] void update(handle_type handle, const value_type& value);
+// [ 5] void reserve(size_type numElements);
+// [ 5] void clear();
+// [ 5] void swap(pairing_heap& other);
+//
+// ACCESSORS
+// [ 2] const_reference top() const;
+// [ 4] const_reference value(handle_type handle) const;
+// [ 2] bool empty() const;
+// [ 2] size_type size() const;
+// [ 5] value_compare value_comp() const;
+// [ 5] allocator_type get_allocator() const;
+//
+// FREE FUNCTIONS
+// [ 5] void swap(pairing_heap& a, pairing_heap& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [ 3] CONCERN: Deep heaps are copied and destroyed iteratively.
+// [ 2] CONCERN: The object is compatible with STL allocators.
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+//-----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bsl::pairing_heap<int>                       Obj;
+typedef bsl::pairing_heap<int, std::greater<int> >   MinObj;
+typedef bsltf::AllocTestType                         AllocType;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static int nextRandom(unsigned *seed)
+    // Advance the specified 'seed' of a linear congruential generator and
+    // return the next pseudo-random number in the range '[0, 32767]'.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return static_cast<int>((*seed >> 16) & 0x7fff);
+}
+
+struct AllocLess {
+    // This 'struct' provides a comparator ordering 'AllocTestType' objects by
+    // their 'data' attribute.
+
+    bool operator()(const AllocType& lhs, const AllocType& rhs) const
+        // Return 'true' if the 'data' of the specified 'lhs' is less than
+        // that of the specified 'rhs', and 'false' otherwise.
+    {
+        return lhs.data() < rhs.data();
+    }
+};
+
+template <class HEAP>
+bool popAll(bsl::vector<int> *result, HEAP *heap)
+    // Pop every element of the specified 'heap', appending the value of each
+    // element on top to the specified 'result', and return 'true' if 'size'
+    // and 'empty' are consistent with the number of elements popped, and
+    // 'false' otherwise.
+{
+    bool consistent = true;
+    while (!heap->empty()) {
+        const typename HEAP::size_type SIZE = heap->size();
+        result->push_back(heap->top());
+        heap->pop();
+        consistent = consistent && SIZE - 1 == heap->size();
+    }
+    return consistent && 0 == heap->size();
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Rescheduling and Cancelling Timers
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we implement a timer queue, in which the earliest deadline is
+// processed first, and in which a timer may be rescheduled or cancelled
+// before its deadline.
+//
+// First, we create a queue of deadlines, ordered by 'std::greater' so that the
+// earliest deadline is on top, and reserve memory for the timers we expect:
+//..
+    typedef bsl::pairing_heap<int, std::greater<int> > TimerQueue;
+
+    TimerQueue timers;
+    timers.reserve(4);
+//..
+// Then, we schedule four timers, keeping the handles returned by 'push':
+//..
+    TimerQueue::handle_type a = timers.push(30);
+    TimerQueue::handle_type b = timers.push(10);
+    TimerQueue::handle_type c = timers.push(50);
+    TimerQueue::handle_type d = timers.push(40);
+
+    ASSERT(4  == timers.size());
+    ASSERT(10 == timers.top());
+//..
+// Next, we reschedule timer 'c' to an earlier deadline, which, as the
+// deadline of a timer in a min-queue decreases, is done with 'decrease_key':
+//..
+    timers.decrease_key(c, 5);
+    ASSERT(5 == timers.top());
+    ASSERT(5 == timers.value(c));
+//..
+// Then, we cancel timer 'b', and postpone timer 'a' to a later deadline,
+// using 'update':
+//..
+    timers.erase(b);
+    timers.update(a, 60);
+    ASSERT(60 == timers.value(a));
+    ASSERT(40 == timers.value(d));
+//..
+// Finally, we process the remaining timers in order of their deadlines:
+//..
+    const int EXPECTED[] = { 5, 40, 60 };
+    for (int i = 0; !timers.empty(); ++i) {
+        ASSERT(EXPECTED[i] == timers.top());
+        timers.pop();
+    }
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'reserve', 'clear', 'swap', AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 'reserve' allocates a single block, from which the specified
+        //:   number of elements are pushed without further allocation.
+        //:
+        //: 2 The nodes of popped and cleared elements are reused by
+        //:   subsequent pushes.
+        //:
+        //: 3 'clear' removes all elements and leaves the heap usable.
+        //:
+        //: 4 'swap' (member and free) exchanges the elements and comparators,
+        //:   and, for equal allocators, does not allocate and preserves the
+        //:   validity of handles.
+        //:
+        //: 5 'swap' of heaps using different allocators exchanges the
+        //:   elements, each heap keeping its allocator.
+        //:
+        //: 6 'get_allocator' returns the allocator supplied at construction,
+        //:   and 'value_comp' the comparator.
+        //
+        // Plan:
+        //: 1 Reserve memory for a number of elements, and verify that one
+        //:   block is allocated, and that pushing the elements allocates
+        //:   nothing more.  (C-1)
+        //:
+        //: 2 Pop, clear, and push elements, verifying that no memory is
+        //:   allocated and the elements are ordered.  (C-2..3)
+        //:
+        //: 3 Swap heaps using the same allocator, verifying elements, memory
+        //:   use, handles, and comparators.  (C-4, 6)
+        //:
+        //: 4 Swap heaps using distinct allocators, and verify the elements
+        //:   and allocators.  (C-5..6)
+        //
+        // Testing:
+        //   void reserve(size_type numElements);
+        //   void clear();
+        //   void swap(pairing_heap& other);
+        //   value_compare value_comp() const;
+        //   allocator_type get_allocator() const;
+        //   void swap(pairing_heap& a, pairing_heap& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'reserve', 'clear', 'swap', AND ACCESSORS"
+                            "\n=========================================\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        if (veryVerbose) printf("\t'reserve' and node reuse.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(&oa == X.get_allocator());
+
+            mX.reserve(0);
+            ASSERT(0 == oa.numBlocksTotal());
+
+            mX.reserve(1000);
+            ASSERT(1 == oa.numBlocksTotal());
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.push((i * 37) % 1000);
+            }
+            ASSERTV(oa.numBlocksTotal(), 1 == oa.numBlocksTotal());
+            ASSERT(999 == X.top());
+
+            for (int i = 0; i < 500; ++i) {
+                mX.pop();
+            }
+            for (int i = 0; i < 500; ++i) {
+                mX.push(i);
+            }
+            ASSERTV(oa.numBlocksTotal(), 1 == oa.numBlocksTotal());
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+
+            for (int i = 0; i < 1000; ++i) {
+                mX.push(i % 10);
+            }
+            ASSERTV(oa.numBlocksTotal(), 1 == oa.numBlocksTotal());
+
+            bsl::vector<int> popped(&oa);
+            ASSERT(popAll(&popped, &mX));
+            ASSERT(1000 == popped.size());
+            ASSERT(popped.end() == std::adjacent_find(popped.begin(),
+                                                      popped.end(),
+                                                      std::less<int>()));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        if (veryVerbose) printf("\t'swap' with the same allocator.\n");
+        {
+            MinObj mX(std::greater<int>(), &oa);  const MinObj& X = mX;
+            MinObj mY(std::greater<int>(), &oa);  const MinObj& Y = mY;
+
+            MinObj::handle_type hX = mX.push(3);
+            mX.push(1);
+            mX.push(2);
+            MinObj::handle_type hY = mY.push(10);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX.swap(mY);
+            ASSERT(oam.isTotalSame());
+
+            ASSERT(1  == X.size());
+            ASSERT(10 == X.top());
+            ASSERT(10 == X.value(hY));
+            ASSERT(3  == Y.size());
+            ASSERT(1  == Y.top());
+            ASSERT(3  == Y.value(hX));
+
+            mY.decrease_key(hX, 0);
+            ASSERT(0 == Y.top());
+
+            swap(mX, mY);
+            ASSERT(oam.isTotalSame());
+            ASSERT(3  == X.size());
+            ASSERT(0  == X.top());
+            ASSERT(10 == Y.top());
+
+            ASSERT(X.value_comp()(1, 2) == std::greater<int>()(1, 2));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (veryVerbose) printf("\t'swap' with distinct allocators.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            Obj mY(&za);  const Obj& Y = mY;
+
+            for (int i = 0; i < 10; ++i) {
+                mX.push(i);
+            }
+            mY.push(100);
+
+            mX.swap(mY);
+
+            ASSERT(&oa == X.get_allocator());
+            ASSERT(&za == Y.get_allocator());
+            ASSERT(1   == X.size());
+            ASSERT(100 == X.top());
+            ASSERT(10  == Y.size());
+            ASSERT(9   == Y.top());
+
+            bsl::vector<int> popped;
+            ASSERT(popAll(&popped, &mY));
+            for (int i = 0; i < 10; ++i) {
+                ASSERTV(i, popped[i], 9 - i == popped[i]);
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'decrease_key', 'update', 'erase', AND 'value'
+        //
+        // Concerns:
+        //: 1 'value' returns the value of the element referred to by a handle,
+        //:   wherever the element is in the heap.
+        //:
+        //: 2 'decrease_key' gives the element referred to by a handle a
+        //:   higher (or equal) priority, and the element becomes the top
+        //:   element if it has the highest priority.
+        //:
+        //: 3 'update' gives the element referred to by a handle any value,
+        //:   including a value of lower priority, after which elements of
+        //:   higher priority previously below it may be on top.
+        //:
+        //: 4 'erase' removes the element referred to by a handle, including
+        //:   the top element and the last element.
+        //:
+        //: 5 Handles referring to other elements remain valid after each
+        //:   operation, and the memory of removed elements is reused.
+        //:
+        //: 6 The precondition of 'decrease_key' is checked in appropriate
+        //:   build modes.
+        //
+        // Plan:
+        //: 1 Apply a pseudo-random sequence of 'push', 'pop',
+        //:   'decrease_key', 'update', and 'erase' operations to a min-heap
+        //:   and to a model of it holding the value and handle of each
+        //:   element, and verify the top element, the size, and the value of
+        //:   every element, through its handle, after each operation.  Pop
+        //:   the remaining elements and verify their order.  (C-1..5)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments, using 'BSLS_ASSERTTEST_*'.
+        //:   (C-6)
+        //
+        // Testing:
+        //   void erase(handle_type handle);
+        //   void decrease_key(handle_type handle, const value_type& value);
+        //   void update(handle_type handle, const value_type& value);
+        //   const_reference value(handle_type handle) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n'decrease_key', 'update', 'erase', AND 'value'"
+                            "\n=============================================="
+                            "\n");
+
+        typedef MinObj::handle_type Handle;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        // Each value assigned is made unique by its residue modulo
+        // 'k_NUM_TAGS', a tag incremented for each operation and preserved by
+        // 'decrease_key', so that the element removed by 'pop' is identified
+        // in the model.
+
+        enum { k_NUM_TAGS = 4096, k_NUM_OPS = 2000 };
+
+        for (unsigned run = 0; run < 20; ++run) {
+            unsigned seed   = run;
+            const int RANGE = 1 << (run % 10 + 1);
+            int       tag   = 0;
+
+            MinObj mX(&oa);  const MinObj& X = mX;
+
+            bsl::vector<int>    values(&oa);   // model of the elements
+            bsl::vector<Handle> handles(&oa);
+
+            for (int op = 0; op < k_NUM_OPS; ++op) {
+                const int OP    = nextRandom(&seed) % 10;
+                const int KEY   = nextRandom(&seed) % RANGE;
+                const int VALUE = KEY * k_NUM_TAGS + tag++;
+                const int INDEX = values.empty()
+                                ? 0
+                                : nextRandom(&seed) % (int)values.size();
+
+                if (values.empty() || OP < 3) {
+                    handles.push_back(mX.push(VALUE));
+                    values.push_back(VALUE);
+                }
+                else if (3 == OP) {
+                    const int TOP = X.top();
+                    mX.pop();
+
+                    bsl::vector<int>::iterator it =
+                                 std::find(values.begin(), values.end(), TOP);
+                    ASSERTV(run, op, TOP, it != values.end());
+
+                    handles.erase(handles.begin() + (it - values.begin()));
+                    values.erase(it);
+                }
+                else if (OP < 6) {
+                    const int NEW_VALUE =
+                                   values[INDEX] - (KEY % 8 + 1) * k_NUM_TAGS;
+                    mX.decrease_key(handles[INDEX], NEW_VALUE);
+                    values[INDEX] = NEW_VALUE;
+                }
+                else if (OP < 8) {
+                    mX.update(handles[INDEX], VALUE);
+                    values[INDEX] = VALUE;
+                }
+                else {
+                    mX.erase(handles[INDEX]);
+                    values.erase(values.begin() + INDEX);
+                    handles.erase(handles.begin() + INDEX);
+                }
+
+                ASSERTV(run, op, values.size() == X.size());
+                ASSERTV(run, op, values.empty() == X.empty());
+                if (!values.empty()) {
+                    ASSERTV(run, op,
+                            *std::min_element(values.begin(), values.end())
+                                                                  == X.top());
+                }
+                for (int i = 0; i < (int)values.size(); ++i) {
+                    ASSERTV(run, op, i, values[i] == X.value(handles[i]));
+                }
+            }
+
+            bsl::vector<int> popped(&oa);
+            ASSERTV(run, popAll(&popped, &mX));
+            std::sort(values.begin(), values.end());
+            ASSERTV(run, values == popped);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        if (veryVerbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            MinObj mX(&oa);
+            Handle h = mX.push(5);
+            mX.push(3);
+
+            ASSERT_SAFE_PASS(mX.decrease_key(h, 5));
+            ASSERT_SAFE_PASS(mX.decrease_key(h, 4));
+            ASSERT_SAFE_FAIL(mX.decrease_key(h, 6));
+            ASSERT_SAFE_FAIL(mX.erase(Handle()));
+            ASSERT_SAFE_PASS(mX.update(h, 6));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // COPY CONSTRUCTORS AND ASSIGNMENT
+        //
+        // Concerns:
+        //: 1 A copy holds the same elements as the original, which is left
+        //:   unchanged, and the copy uses the allocator supplied at
+        //:   construction or, if none is supplied, the default allocator.
+        //:
+        //: 2 Assignment gives the target the elements of the source, using
+        //:   the allocator of the target, and returns a reference to the
+        //:   target; self-assignment has no effect.
+        //:
+        //: 3 The copy constructors and assignment are exception-neutral, and
+        //:   assignment provides the strong guarantee.
+        //:
+        //: 4 Heaps of large depth are copied and destroyed without recursion.
+        //
+        // Plan:
+        //: 1 For heaps built from pseudo-random pushes and pops of each of
+        //:   several lengths, copy construct, with and without an allocator,
+        //:   and assign, and verify the elements by popping all of them from
+        //:   both the copy and the original.  (C-1..2)
+        //:
+        //: 2 Repeat P-1 for 'AllocTestType' elements within the
+        //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros, verifying that no
+        //:   memory is leaked and that the target of a failed assignment is
+        //:   unchanged.  (C-3)
+        //:
+        //: 3 Build heaps of 100000 elements forming a single chain of nodes,
+        //:   copy, assign, and destroy them.  (C-4)
+        //
+        // Testing:
+        //   pairing_heap(const pairing_heap& original);
+        //   pairing_heap(const pairing_heap& original, const ALLOCATOR& a);
+        //   pairing_heap& operator=(const pairing_heap& rhs);
+        //   CONCERN: Deep heaps are copied and destroyed iteratively.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY CONSTRUCTORS AND ASSIGNMENT"
+                            "\n================================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+
+        for (int length = 0; length < 64; ++length) {
+            unsigned seed = length;
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < length; ++i) {
+                mX.push(nextRandom(&seed) % 50);
+                if (2 == i % 3) {
+                    mX.pop();
+                }
+            }
+
+            bsl::vector<int> expected(&oa);
+            {
+                Obj mW(X);
+                ASSERTV(length, &defaultAllocator == mW.get_allocator());
+                ASSERTV(length, popAll(&expected, &mW));
+            }
+            ASSERTV(length, 0 == defaultAllocator.numBlocksInUse());
+            ASSERTV(length, X.size() == expected.size());
+            ASSERTV(length,
+                    expected.end() == std::adjacent_find(expected.begin(),
+                                                         expected.end(),
+                                                         std::less<int>()));
+
+            {
+                Obj mY(X, &za);
+                ASSERTV(length, &za == mY.get_allocator());
+
+                bsl::vector<int> popped(&oa);
+                ASSERTV(length, popAll(&popped, &mY));
+                ASSERTV(length, expected == popped);
+            }
+            {
+                Obj mZ(&za);
+                mZ.push(-1);
+                mZ.push(1000);
+
+                Obj *mR = &(mZ = X);
+                ASSERTV(length, &mZ == mR);
+                ASSERTV(length, &za == mZ.get_allocator());
+
+                mZ = mZ;
+                ASSERTV(length, X.size() == mZ.size());
+
+                bsl::vector<int> popped(&oa);
+                ASSERTV(length, popAll(&popped, &mZ));
+                ASSERTV(length, expected == popped);
+            }
+
+            bsl::vector<int> popped(&oa);
+            ASSERTV(length, popAll(&popped, &mX));
+            ASSERTV(length, expected == popped);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+
+        if (veryVerbose) printf("\tException safety.\n");
+
+        typedef bsl::pairing_heap<AllocType, AllocLess> AllocObj;
+
+        for (int length = 0; length < 12; ++length) {
+            unsigned seed = length + 100;
+
+            AllocObj mX(&oa);  const AllocObj& X = mX;
+            for (int i = 0; i < length; ++i) {
+                mX.push(AllocType(nextRandom(&seed) % 20, &oa));
+                if (2 == i % 4) {
+                    mX.pop();
+                }
+            }
+            const AllocObj::size_type SIZE = X.size();
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(za) {
+                AllocObj mY(X, &za);
+                ASSERTV(length, SIZE == mY.size());
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERTV(length, 0 == za.numBlocksInUse());
+
+            AllocObj mZ(&za);  const AllocObj& Z = mZ;
+            mZ.push(AllocType(-5, &za));
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(za) {
+                ASSERTV(length, 1 == Z.size() || SIZE == Z.size());
+                if (1 == Z.size()) {
+                    ASSERTV(length, -5 == Z.top().data());
+                }
+                mZ = X;
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+            ASSERTV(length, SIZE == Z.size());
+            if (SIZE) {
+                ASSERTV(length, X.top().data() == Z.top().data());
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+
+        if (veryVerbose) printf("\tHeaps of large depth.\n");
+        {
+            enum { k_DEPTH = 100000 };
+
+            // Increasing values pushed onto a max-heap each become the new
+            // root, forming a chain of 'k_DEPTH' nodes.
+
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < k_DEPTH; ++i) {
+                mX.push(i);
+            }
+
+            Obj mY(X, &za);
+            ASSERT(k_DEPTH     == mY.size());
+            ASSERT(k_DEPTH - 1 == mY.top());
+
+            Obj mZ(&oa);
+            mZ = X;
+            ASSERT(k_DEPTH == mZ.size());
+
+            // Decreasing values form a single root with 'k_DEPTH - 1'
+            // children.
+
+            Obj mW(&oa);
+            for (int i = k_DEPTH; 0 < i; --i) {
+                mW.push(i);
+            }
+            Obj mV(mW);
+            ASSERT(k_DEPTH == mV.size());
+            ASSERT(k_DEPTH == mV.top());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == za.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A default-constructed heap is empty, and uses the allocator
+        //:   supplied at construction, or the default allocator if none is
+        //:   supplied.
+        //:
+        //: 2 'push' inserts the value, and 'top' refers to an element of
+        //:   highest priority.
+        //:
+        //: 3 'pop' removes the top element, and the elements are retrieved
+        //:   in order of priority, including equivalent elements.
+        //:
+        //: 4 'size' and 'empty' reflect the number of elements.
+        //:
+        //: 5 The comparator supplied at construction orders the elements.
+        //:
+        //: 6 All memory is supplied by the allocator of the heap, and is
+        //:   returned on destruction, including for elements that allocate.
+        //:
+        //: 7 'push' is exception-neutral and provides the strong guarantee.
+        //:
+        //: 8 The heap is compatible with STL allocators.
+        //:
+        //: 9 The preconditions of 'top' and 'pop' are checked in appropriate
+        //:   build modes.
+        //
+        // Plan:
+        //: 1 Create heaps with and without an allocator, and verify they are
+        //:   empty and use the expected allocator.  (C-1)
+        //:
+        //: 2 For each of several lengths, push pseudo-random values, some of
+        //:   them equal, interleaved with pops, onto max-heaps and min-heaps,
+        //:   verifying 'top', 'size', and 'empty' against a sorted 'vector'
+        //:   after each operation.  (C-2..5)
+        //:
+        //: 3 Push 'AllocTestType' values within the
+        //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros, and verify memory
+        //:   use.  (C-6..7)
+        //:
+        //: 4 Instantiate the heap with 'bsltf::StdTestAllocator'.  (C-8)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered, using 'BSLS_ASSERTTEST_*'.  (C-9)
+        //
+        // Testing:
+        //   explicit pairing_heap(const ALLOCATOR& basicAllocator = A());
+        //   explicit pairing_heap(const COMPARATOR&, const ALLOCATOR& = A());
+        //   ~pairing_heap();
+        //   handle_type push(const value_type& value);
+        //   void pop();
+        //   const_reference top() const;
+        //   bool empty() const;
+        //   size_type size() const;
+        //   CONCERN: The object is compatible with STL allocators.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                            "\n========================================\n");
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        if (veryVerbose) printf("\tDefault construction.\n");
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(&defaultAllocator == X.get_allocator());
+
+            Obj mY(&oa);  const Obj& Y = mY;
+            ASSERT(Y.empty());
+            ASSERT(&oa == Y.get_allocator());
+
+            MinObj mZ(std::greater<int>(), &oa);  const MinObj& Z = mZ;
+            ASSERT(Z.empty());
+            ASSERT(&oa == Z.get_allocator());
+            ASSERT(0 == oa.numBlocksTotal());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        if (veryVerbose) printf("\tPush and pop.\n");
+        for (int length = 0; length < 300; length += 1 + length / 8) {
+            for (int range = 1; range <= 1000; range *= 10) {
+                unsigned seed = length * 7 + range;
+
+                Obj    mX(&oa);  const Obj&    X = mX;
+                MinObj mY(&oa);  const MinObj& Y = mY;
+
+                bsl::vector<int> sortedX(&oa);  // ascending, as is 'sortedY'
+                bsl::vector<int> sortedY(&oa);
+                for (int i = 0; i < length; ++i) {
+                    const int VALUE = nextRandom(&seed) % range;
+                    mX.push(VALUE);
+                    mY.push(VALUE);
+                    sortedX.insert(std::upper_bound(sortedX.begin(),
+                                                    sortedX.end(),
+                                                    VALUE),
+                                   VALUE);
+                    sortedY.insert(std::upper_bound(sortedY.begin(),
+                                                    sortedY.end(),
+                                                    VALUE),
+                                   VALUE);
+
+                    ASSERTV(length, range, i, sortedX.back()  == X.top());
+                    ASSERTV(length, range, i, sortedY.front() == Y.top());
+                    ASSERTV(length, range, i, sortedX.size() == X.size());
+                    ASSERTV(length, range, i, sortedY.size() == Y.size());
+
+                    if (4 == i % 5) {
+                        mX.pop();
+                        mY.pop();
+                        sortedX.pop_back();
+                        sortedY.erase(sortedY.begin());
+
+                        ASSERTV(length, range, i,
+                                sortedX.size()  == X.size());
+                        ASSERTV(length, range, i,
+                                sortedX.empty() == X.empty());
+                        if (!sortedX.empty()) {
+                            ASSERTV(length, range, i,
+                                    sortedX.back()  == X.top());
+                            ASSERTV(length, range, i,
+                                    sortedY.front() == Y.top());
+                        }
+                    }
+                }
+
+                bsl::vector<int> popped(&oa);
+                ASSERTV(length, range, popAll(&popped, &mX));
+                ASSERTV(length, range, sortedX.size() == popped.size());
+                ASSERTV(length, range,
+                        std::equal(popped.begin(), popped.end(),
+                                   sortedX.rbegin()));
+
+                popped.clear();
+                ASSERTV(length, range, popAll(&popped, &mY));
+                ASSERTV(length, range, sortedY == popped);
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+        if (veryVerbose) printf("\tAllocating elements.\n");
+        {
+            typedef bsl::pairing_heap<AllocType, AllocLess> AllocObj;
+
+            bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+            AllocObj mX(&oa);  const AllocObj& X = mX;
+            for (int i = 0; i < 40; ++i) {
+                const AllocType VALUE((i * 13) % 40, &sa);
+                const AllocObj::size_type SIZE = X.size();
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    ASSERTV(i, SIZE == X.size());
+                    mX.push(VALUE);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(i, SIZE + 1 == X.size());
+            }
+            ASSERT(39 == X.top().data());
+            ASSERT(0 == sa.numBlocksInUse());
+
+            for (int i = 39; 0 <= i; --i) {
+                ASSERTV(i, X.top().data(), i == X.top().data());
+                mX.pop();
+            }
+            ASSERT(X.empty());
+
+            for (int i = 0; i < 10; ++i) {
+                mX.push(AllocType(i, &sa));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (veryVerbose) printf("\tSTL allocator.\n");
+        {
+            typedef bsl::pairing_heap<int,
+                                      std::less<int>,
+                                      bsltf::StdTestAllocator<int> > StlObj;
+
+            StlObj mX;  const StlObj& X = mX;
+            for (int i = 0; i < 100; ++i) {
+                mX.push((i * 31) % 100);
+            }
+            StlObj mY(X);
+            mY = X;
+
+            bsl::vector<int> popped(&oa);
+            ASSERT(popAll(&popped, &mY));
+            for (int i = 0; i < 100; ++i) {
+                ASSERTV(i, 99 - i == popped[i]);
+            }
+        }
+
+        if (veryVerbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT_SAFE_FAIL(X.top());
+            ASSERT_SAFE_FAIL(mX.pop());
+
+            mX.push(1);
+
+            ASSERT_SAFE_PASS(X.top());
+            ASSERT_SAFE_PASS(mX.pop());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Push, reprioritize, erase, and pop a few elements, verifying the
+        //:   top element after each step.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(X.empty());
+
+            Obj::handle_type h1 = mX.push(1);
+            Obj::handle_type h5 = mX.push(5);
+            Obj::handle_type h3 = mX.push(3);
+            ASSERT(3 == X.size());
+            ASSERT(5 == X.top());
+            ASSERT(h1 != h5);
+
+            mX.decrease_key(h1, 7);
+            ASSERT(7 == X.top());
+
+            mX.update(h1, 0);
+            ASSERT(5 == X.top());
+
+            mX.erase(h5);
+            ASSERT(3 == X.top());
+            ASSERT(2 == X.size());
+            ASSERT(3 == X.value(h3));
+
+            mX.pop();
+            ASSERT(0 == X.top());
+            mX.pop();
+            ASSERT(X.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -13,7 +13,7 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //   bslstl::priority_queue: template of highest-priority-first data structure
 //
-//@SEE_ALSO: bslstl_queue, bslstl_stack
+//@SEE_ALSO: bslstl_queue, bslstl_stack, bslstl_heappolicy, bslstl_pairingheap
 //
 //@DESCRIPTION: This component defines a class template, 'bsl::priority_queue',
 // holding a container (of a parameterized type 'CONTAINER' containing elements
@@ -67,6 +67,28 @@ BSLS_IDENT("$Id: $")
 //  | const_reference top() const;         | c.front();                |
 //  +--------------------------------------+---------------------------+
 //
+///Heap Policies
+///-------------
+// The elements of the held container are arranged into a heap by the
+// functions of the type supplied as the optional fourth template parameter,
+// 'HEAP_POLICY' (see 'bslstl_heappolicy').  The default policy,
+// 'bslstl::StdHeapPolicy', uses the standard algorithms 'std::make_heap',
+// 'std::push_heap', and 'std::pop_heap', which maintain a binary heap.  For a
+// large queue of small elements, 'bslstl::DaryHeapPolicy<4>' or
+// 'bslstl::DaryHeapPolicy<8>', which keep the (4 or 8) children of each node
+// adjacent in memory, reduce the depth of the heap and the number of cache
+// lines touched by 'push' and 'pop':
+//..
+//  typedef bsl::priority_queue<int,
+//                              bsl::vector<int>,
+//                              std::greater<int>,
+//                              bslstl::DaryHeapPolicy<8> > TimerQueue;
+//..
+// A priority queue does not support changing the priority of, or removing, an
+// element other than the top element.  'bsl::pairing_heap' (see
+// 'bslstl_pairingheap') provides a priority queue whose 'push' returns a
+// handle through which the element can later be updated or erased.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -316,6 +338,10 @@ BSLS_IDENT("$Id: $")
 #include <bslstl_allocator.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_HEAPPOLICY
+#include <bslstl_heappolicy.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_VECTOR
 #include <bslstl_vector.h>
 #endif
@@ -363,14 +389,17 @@ namespace bsl {
                          // ====================
 
 template <class VALUE,
-          class CONTAINER  = vector<VALUE>,
-          class COMPARATOR = native_std::less<typename CONTAINER::value_type> >
+          class CONTAINER   = vector<VALUE>,
+          class COMPARATOR  = native_std::less<typename CONTAINER::value_type>,
+          class HEAP_POLICY = BloombergLP::bslstl::StdHeapPolicy>
 class priority_queue
     // This class is a value-semantic class template, adapting a container of
     // the parameterized 'CONTAINER' type that holds elements of the
     // parameterized 'VALUE' type, to provides a highest-priority-first
     // priority queue data structure, where the priorities of elements are
-    // compared by a comparator of the parameterized 'COMPARATOR' type.  The
+    // compared by a comparator of the parameterized 'COMPARATOR' type, and the
+    // elements of the container are arranged into a heap by the functions of
+    // the parameterized 'HEAP_POLICY' type (see 'bslstl_heappolicy').  The
     // container object held by a 'priority_queue' class object is referenced
     // as 'c' in the following documentation.
 {
@@ -532,9 +561,9 @@ class priority_queue
 
 // FREE FUNCTIONS
 
-template <class VALUE, class CONTAINER, class COMPARATOR>
-void swap(priority_queue<VALUE, CONTAINER, COMPARATOR>& lhs,
-          priority_queue<VALUE, CONTAINER, COMPARATOR>& rhs);
+template <class VALUE, class CONTAINER, class COMPARATOR, class HEAP_POLICY>
+void swap(priority_queue<VALUE, CONTAINER, COMPARATOR, HEAP_POLICY>& lhs,
+          priority_queue<VALUE, CONTAINER, COMPARATOR, HEAP_POLICY>& rhs);
 
 // ============================================================================
 //                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
@@ -545,46 +574,46 @@ void swap(priority_queue<VALUE, CONTAINER, COMPARATOR>& lhs,
                          // --------------------
 
 // CREATORS
-template <class VALUE, class CONTAINER, class COMPARATOR>
+template <class VALUE, class CONTAINER, class COMPARATOR, class HEAP_POLICY>
 inline
-priority_queue<VALUE, CONTAINER, COMPARATOR>::priority_queue(
+priority_queue<VALUE, CONTAINER, COMPARATOR, HEAP_POLICY>::priority_queue(
                                                   const COMPARATOR& comparator,
                                                   const CONTAINER&  container)
 : c(container)
 , comp(comparator)
 {
-    native_std::make_heap(c.begin(), c.end(), comp);
+    HEAP_POLICY::makeHeap(c.begin(), c.end(), comp);
 }
 
-template <class VALUE, class CONTAINER, class COMPARATOR>
+template <class VALUE, class CONTAINER, class COMPARATOR, class HEAP_POLICY>
 inline
-priority_queue<VALUE, CONTAINER, COMPARATOR>::priority_queue()
+priority_queue<VALUE, CONTAINER, COMPARATOR, HEAP_POLICY>::priority_queue()
 {
 }
 
-template <class VALUE, class CONTAINER, class COMPARATOR>
+template <class VALUE, class CONTAINER, class COMPARATOR, class HEAP_POLICY>
 inline
-priority_queue<VALUE, CONTAINER, COMPARATOR>::priority_queue(
+priority_queue<VALUE, CONTAINER, COMPARATOR, HEAP_POLICY>::priority_queue(
                                                   const COMPARATOR& comparator)
 : comp(comparator)
 {
 }
 
-template <class VALUE, class CONTAINER, class COMPARATOR>
+template <class VALUE, class CONTAINER, class COMPARATOR, class HEAP_POLICY>
 template <class INPUT_ITERATOR>
 inline
-priority_queue<VALUE, CONTAINER, COMPARATOR>::priority_queue(
+priority_queue<VALUE, CONTAINER, COMPARATOR, HEAP_POLICY>::priority_queue(
                                                        INPUT_ITERATOR    first,
                                                        INPUT_ITERATOR    last)
 {
     c.insert(c.end(), first, last);
-    native_std::make_heap(c.begin(), c.end(), comp);
+    HEAP_POLICY::makeHeap(c.begin(), c.end(), comp);
 }
 
-template <class VALUE, class CONTAINER, class COMPARATOR>
+template <class VALUE, class CONTAINER, class COMPARATOR, class HEAP_POLICY>
 template <class INPUT_ITERATOR>
 inline
-priority_queue<VALUE, CONTAINER, COMPARATOR>::priority_queue(
+priority_queue<VALUE, CONTAINER, COMPARATOR, HEAP_POLICY>::priority_queue(
                                                   INPUT_ITERATOR    first,
                                                   INPUT_ITERATOR    last,
                                                   const COMPARATOR& comparator,
@@ -593,22 +622,22 @@ priority_queue<VALUE, CONTAINER, COMPARATOR>::priority_queue(
 , comp(comparator)
 {
     c.insert(c.end(), first, last);
-    native_std::make_heap(c.begin(), c.end(), comp);
+    HEAP_POLICY::makeHeap(c.begin(), c.end(), comp);
 }
 
-template <class VALUE, class CONTAINER, class COMPARATOR>
+template <class VALUE, class CONTAINER, class COMPARATOR, class HEAP_POLICY>
 inline
-priority_queue<VALUE, CONTAINER, COMPARATOR>::priority_queue(
+priority_queue<VALUE, CONTAINER, COMPARATOR, HEAP_POLICY>::priority_queue(
                                                 const priority_queue& original)
 : c(original.c)
 , comp(original.comp)
 {
 }
 
-template <class VALUE, class CONTAINER, class COMPARATOR>
+template <class VALUE, class CONTAINER, class COMPARATOR, class HEAP_POLICY>
 template <class ALLOCATOR>
 inline
-priority_queue<VALUE, CONTAINER, COMPARATOR>::priority_queue(
+priority_queue<VALUE, CONTAINER, COMPARATOR, HEAP_POLICY>::priority_queue(
                            const ALLOCATOR& basicAllocator,
                            typename enable_if<
                            BloombergLP::bslstl::PriorityQueue_HasAllocatorType<
@@ -619,10 +648,10 @@ priority_queue<VALUE, CONTAINER, COMPARATOR>::priority_queue(
 {
 }
 
-template <class VALUE, class CONTAINER, class COMPARATOR>
+template <class VALUE, class CONTAINER, class COMPARATOR, class HEAP_POLICY>
 template <class ALLOCATOR>
 inline
-priority_queue<VALUE, CONTAINER, COMPARATOR>::priority_queue(
+priority_queue<VALUE, CONTAINER, COMPARATOR, HEAP_POLICY>::priority_queue(
                            const COMPARATOR& comparator,
                            const ALLOCATOR&  basicAllocator,
                            typename enable_if<
@@ -634,10 +663,10 @@ priority_queue<VALUE, CONTAINER, COMPARATOR>::priority_queue(
 {
 }
 
-template <class VALUE, class CONTAINER, class COMPARATOR>
+template <class VALUE, class CONTAINER, class COMPARATOR, class HEAP_POLICY>
 template <class ALLOCATOR>
 inline
-priority_queue<VALUE, CONTAINER, COMPARATOR>::priority_queue(
+priority_queue<VALUE, CONTAINER, COMPARATOR, HEAP_POLICY>::priority_queue(
                            const COMPARATOR& comparator,
                            const CONTAINER&  container,
                            const ALLOCATOR&  basicAllocator,
@@ -648,14 +677,14 @@ priority_queue<VALUE, CONTAINER, COMPARATOR>::priority_queue(
 : c(container, basicAllocator)
 , comp(comparator)
 {
-    native_std::make_heap(c.begin(), c.end(), comp);
+    HEAP_POLICY::makeHeap(c.begin(), c.end(), comp);
 }
 
 
-template <class VALUE, class CONTAINER, class COMPARATOR>
+template <class VALUE, class CONTAINER, class COMPARATOR, class HEAP_POLICY>
 template <class ALLOCATOR>
 inline
-priority_queue<VALUE, CONTAINER, COMPARATOR>::priority_queue(
+priority_queue<VALUE, CONTAINER, COMPARATOR, HEAP_POLICY>::priority_queue(
                            const priority_queue& original,
                            const ALLOCATOR&      basicAllocator,
                            typename enable_if<
@@ -669,59 +698,61 @@ priority_queue<VALUE, CONTAINER, COMPARATOR>::priority_queue(
 
 
 // MANIPULATORS
-template <class VALUE, class CONTAINER, class COMPARATOR>
+template <class VALUE, class CONTAINER, class COMPARATOR, class HEAP_POLICY>
 inline
-void priority_queue<VALUE, CONTAINER, COMPARATOR>::push(
+void priority_queue<VALUE, CONTAINER, COMPARATOR, HEAP_POLICY>::push(
                                                        const value_type& value)
 {
     c.push_back(value);
-    native_std::push_heap(c.begin(), c.end(), comp);
+    HEAP_POLICY::pushHeap(c.begin(), c.end(), comp);
 }
 
-template <class VALUE, class CONTAINER, class COMPARATOR>
+template <class VALUE, class CONTAINER, class COMPARATOR, class HEAP_POLICY>
 inline
-void priority_queue<VALUE, CONTAINER, COMPARATOR>::pop()
+void priority_queue<VALUE, CONTAINER, COMPARATOR, HEAP_POLICY>::pop()
 {
-    native_std::pop_heap(c.begin(), c.end(), comp);
+    HEAP_POLICY::popHeap(c.begin(), c.end(), comp);
     c.pop_back();
 }
 
-template <class VALUE, class CONTAINER, class COMPARATOR>
+template <class VALUE, class CONTAINER, class COMPARATOR, class HEAP_POLICY>
 inline
-void priority_queue<VALUE, CONTAINER, COMPARATOR>::swap(priority_queue& other)
+void priority_queue<VALUE, CONTAINER, COMPARATOR, HEAP_POLICY>::swap(
+                                                         priority_queue& other)
 {
     BloombergLP::bslalg::SwapUtil::swap(&c   , &other.c   );
     BloombergLP::bslalg::SwapUtil::swap(&comp, &other.comp);
 }
 
 // ACCESSORS
-template <class VALUE, class CONTAINER, class COMPARATOR>
+template <class VALUE, class CONTAINER, class COMPARATOR, class HEAP_POLICY>
 inline
-bool priority_queue<VALUE, CONTAINER, COMPARATOR>::empty() const
+bool priority_queue<VALUE, CONTAINER, COMPARATOR, HEAP_POLICY>::empty() const
 {
     return c.empty();
 }
 
-template <class VALUE, class CONTAINER, class COMPARATOR>
+template <class VALUE, class CONTAINER, class COMPARATOR, class HEAP_POLICY>
 inline
-typename priority_queue<VALUE, CONTAINER, COMPARATOR>::size_type
-priority_queue<VALUE, CONTAINER, COMPARATOR>::size() const
+typename priority_queue<VALUE, CONTAINER, COMPARATOR, HEAP_POLICY>::size_type
+priority_queue<VALUE, CONTAINER, COMPARATOR, HEAP_POLICY>::size() const
 {
     return c.size();
 }
 
-template <class VALUE, class CONTAINER, class COMPARATOR>
+template <class VALUE, class CONTAINER, class COMPARATOR, class HEAP_POLICY>
 inline
-typename priority_queue<VALUE, CONTAINER, COMPARATOR>::const_reference
-priority_queue<VALUE, CONTAINER, COMPARATOR>::top() const
+typename
+priority_queue<VALUE, CONTAINER, COMPARATOR, HEAP_POLICY>::const_reference
+priority_queue<VALUE, CONTAINER, COMPARATOR, HEAP_POLICY>::top() const
 {
     return c.front();
 }
 
 // FREE FUNCTIONS
-template <class VALUE, class CONTAINER, class COMPARATOR>
-void swap(priority_queue<VALUE, CONTAINER, COMPARATOR>& lhs,
-          priority_queue<VALUE, CONTAINER, COMPARATOR>& rhs)
+template <class VALUE, class CONTAINER, class COMPARATOR, class HEAP_POLICY>
+void swap(priority_queue<VALUE, CONTAINER, COMPARATOR, HEAP_POLICY>& lhs,
+          priority_queue<VALUE, CONTAINER, COMPARATOR, HEAP_POLICY>& rhs)
 {
     lhs.swap(rhs);
 }
@@ -25,6 +25,7 @@
 #include <bsls_util.h>
 
 #include <algorithm>
+#include <functional>
 
 #include <bsltf_templatetestfacility.h>
 #include <bsltf_testvaluesarray.h>
@@ -110,7 +111,8 @@ using namespace bsl;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [14] TESTING NON ALLOCATOR SUPPORTING TYPE
-// [15] USAGE EXAMPLE
+// [15] TESTING HEAP POLICIES
+// [16] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] ggg(queue<V,C> *object, const char *spec, int verbose = 1);
@@ -3072,7 +3074,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator ta(veryVeryVeryVerbose);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         // --------------------------------------------------------------------
@@ -3110,6 +3112,126 @@ int main(int argc, char *argv[])
         }
         taskScheduler.processTasks(veryVerbose);
       } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING HEAP POLICIES
+        //
+        // Concerns:
+        //: 1 A priority queue instantiated with a 'HEAP_POLICY' other than
+        //:   the default retrieves its elements in order of priority, for
+        //:   elements supplied at construction and by 'push', interleaved
+        //:   with 'pop'.
+        //:
+        //: 2 The comparator determines the priority of the elements.
+        //
+        // Plan:
+        //: 1 For 'DaryHeapPolicy' of arities 3, 4, and 8, and for
+        //:   'StdHeapPolicy' named explicitly, construct a priority queue
+        //:   from a range of pseudo-random values, then push further values,
+        //:   popping an element after every third push, and finally pop all
+        //:   elements, verifying each element on top against a sorted
+        //:   'vector' holding the same values.  (C-1)
+        //:
+        //: 2 Repeat P-1 using 'std::greater'.  (C-2)
+        //
+        // Testing:
+        //   CONCERN: 'HEAP_POLICY' selects the layout of the heap.
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTesting Heap Policies"
+                            "\n=====================\n");
+
+        typedef priority_queue<int,
+                               vector<int>,
+                               std::less<int>,
+                               bslstl::DaryHeapPolicy<3> >    Obj3;
+        typedef priority_queue<int,
+                               vector<int>,
+                               std::less<int>,
+                               bslstl::DaryHeapPolicy<4> >    Obj4;
+        typedef priority_queue<int,
+                               vector<int>,
+                               std::greater<int>,
+                               bslstl::DaryHeapPolicy<8> >    Obj8;
+        typedef priority_queue<int,
+                               vector<int>,
+                               std::greater<int>,
+                               bslstl::StdHeapPolicy>         ObjStd;
+
+        unsigned seed = 12345;
+        for (int length = 0; length < 200; length += 7) {
+            vector<int> initial(&ta);
+            for (int i = 0; i < length; ++i) {
+                seed = seed * 1103515245u + 12345u;
+                initial.push_back(static_cast<int>((seed >> 16) % 100));
+            }
+
+            Obj3   mX3(initial.begin(), initial.end());
+            Obj4   mX4(initial.begin(), initial.end());
+            Obj8   mX8(initial.begin(), initial.end());
+            ObjStd mXS(initial.begin(), initial.end());
+
+            vector<int> ascending(initial, &ta);    // popped from the back
+            vector<int> descending(initial, &ta);   // popped from the back
+            std::sort(ascending.begin(), ascending.end());
+            std::sort(descending.begin(), descending.end(),
+                      std::greater<int>());
+
+            for (int i = 0; i < length; ++i) {
+                seed = seed * 1103515245u + 12345u;
+                const int VALUE = static_cast<int>((seed >> 16) % 100);
+
+                mX3.push(VALUE);
+                mX4.push(VALUE);
+                mX8.push(VALUE);
+                mXS.push(VALUE);
+                ascending.insert(std::upper_bound(ascending.begin(),
+                                                  ascending.end(),
+                                                  VALUE),
+                                 VALUE);
+                descending.insert(std::upper_bound(descending.begin(),
+                                                   descending.end(),
+                                                   VALUE,
+                                                   std::greater<int>()),
+                                  VALUE);
+
+                if (2 == i % 3) {
+                    ASSERTV(length, i, ascending.back()  == mX3.top());
+                    ASSERTV(length, i, ascending.back()  == mX4.top());
+                    ASSERTV(length, i, descending.back() == mX8.top());
+                    ASSERTV(length, i, descending.back() == mXS.top());
+                    mX3.pop();
+                    mX4.pop();
+                    mX8.pop();
+                    mXS.pop();
+                    ascending.pop_back();
+                    descending.pop_back();
+                }
+            }
+
+            ASSERTV(length, ascending.size() == mX3.size());
+            ASSERTV(length, ascending.size() == mX4.size());
+            ASSERTV(length, ascending.size() == mX8.size());
+            ASSERTV(length, ascending.size() == mXS.size());
+
+            while (!ascending.empty()) {
+                ASSERTV(length, ascending.back()  == mX3.top());
+                ASSERTV(length, ascending.back()  == mX4.top());
+                ASSERTV(length, descending.back() == mX8.top());
+                ASSERTV(length, descending.back() == mXS.top());
+                mX3.pop();
+                mX4.pop();
+                mX8.pop();
+                mXS.pop();
+                ascending.pop_back();
+                descending.pop_back();
+            }
+            ASSERTV(length, mX3.empty());
+            ASSERTV(length, mX4.empty());
+            ASSERTV(length, mX8.empty());
+            ASSERTV(length, mXS.empty());
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // TESTING NON ALLOCATOR SUPPORTING TYPE
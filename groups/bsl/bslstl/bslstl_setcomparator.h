@@ -204,6 +204,22 @@ class SetComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
         // otherwise.  The behavior is undefined unless 'rhs' can be safely
         // cast to 'NodeType'.
 
+    template <class LOOKUP_KEY>
+    bool operator()(const LOOKUP_KEY&         lhs,
+                    const bslalg::RbTreeNode& rhs);
+    template <class LOOKUP_KEY>
+    bool operator()(const bslalg::RbTreeNode& lhs,
+                    const LOOKUP_KEY&         rhs);
+        // Return 'true' if the specified 'lhs' is less than (ordered before,
+        // according to the comparator held by this object) the specified
+        // 'rhs', where a 'bslalg::RbTreeNode' argument is compared by its
+        // 'value()' after being cast to 'NodeType', and 'false' otherwise.
+        // The behavior is undefined unless the 'bslalg::RbTreeNode' argument
+        // can be safely cast to 'NodeType'.  Note that these overloads
+        // support heterogeneous (transparent) lookup, and can be instantiated
+        // only if 'COMPARATOR' can compare objects of the (template parameter)
+        // type 'LOOKUP_KEY' with objects of type 'KEY'.
+
     void swap(SetComparator& other);
         // Efficiently exchange the value of this object with the value of the
         // specified 'other' object.  This method provides the no-throw
@@ -226,6 +242,22 @@ class SetComparator : private bslalg::FunctorAdapter<COMPARATOR>::Type {
         // otherwise.  The behavior is undefined unless 'rhs' can be safely
         // cast to 'NodeType'.
 
+    template <class LOOKUP_KEY>
+    bool operator()(const LOOKUP_KEY&         lhs,
+                    const bslalg::RbTreeNode& rhs) const;
+    template <class LOOKUP_KEY>
+    bool operator()(const bslalg::RbTreeNode& lhs,
+                    const LOOKUP_KEY&         rhs) const;
+        // Return 'true' if the specified 'lhs' is less than (ordered before,
+        // according to the comparator held by this object) the specified
+        // 'rhs', where a 'bslalg::RbTreeNode' argument is compared by its
+        // 'value()' after being cast to 'NodeType', and 'false' otherwise.
+        // The behavior is undefined unless the 'bslalg::RbTreeNode' argument
+        // can be safely cast to 'NodeType'.  Note that these overloads
+        // support heterogeneous (transparent) lookup, and can be instantiated
+        // only if 'COMPARATOR' can compare objects of the (template parameter)
+        // type 'LOOKUP_KEY' with objects of type 'KEY'.
+
     COMPARATOR& keyComparator();
         // Return a reference providing modifiable access to the function
         // pointer or functor to which this comparator delegates comparison
@@ -320,6 +352,46 @@ bool SetComparator<KEY, COMPARATOR>::operator()(
     return keyComparator()(static_cast<const NodeType&>(lhs).value(), rhs);
 }
 
+template <class KEY, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+bool SetComparator<KEY, COMPARATOR>::operator()(
+                                           const LOOKUP_KEY&         lhs,
+                                           const bslalg::RbTreeNode& rhs)
+{
+    return keyComparator()(lhs, static_cast<const NodeType&>(rhs).value());
+}
+
+template <class KEY, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+bool SetComparator<KEY, COMPARATOR>::operator()(
+                                           const LOOKUP_KEY&         lhs,
+                                           const bslalg::RbTreeNode& rhs) const
+{
+    return keyComparator()(lhs, static_cast<const NodeType&>(rhs).value());
+}
+
+template <class KEY, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+bool SetComparator<KEY, COMPARATOR>::operator()(
+                                           const bslalg::RbTreeNode& lhs,
+                                           const LOOKUP_KEY&         rhs)
+{
+    return keyComparator()(static_cast<const NodeType&>(lhs).value(), rhs);
+}
+
+template <class KEY, class COMPARATOR>
+template <class LOOKUP_KEY>
+inline
+bool SetComparator<KEY, COMPARATOR>::operator()(
+                                           const bslalg::RbTreeNode& lhs,
+                                           const LOOKUP_KEY&         rhs) const
+{
+    return keyComparator()(static_cast<const NodeType&>(lhs).value(), rhs);
+}
+
 template <class KEY, class COMPARATOR>
 inline
 COMPARATOR& SetComparator<KEY, COMPARATOR>::keyComparator()
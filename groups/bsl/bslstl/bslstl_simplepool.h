@@ -60,6 +60,41 @@ BSLS_IDENT("$Id: $")
 // designed for node-based STL containers, and its pooling behavior may change
 // according to the needs of those containers.
 //
+///Lending Blocks Between Pools
+///----------------------------
+// Node-based containers transfer nodes to one another (e.g., 'extract' and
+// 'merge' on 'bsl::map') by relinking them, rather than by copying their
+// values.  A transferred block, however, still lies in a chunk owned by the
+// pool that supplied it, and would dangle once that pool releases its chunks.
+// To support such transfers, the ownership of each chunk is tracked
+// separately, using a reference count held in the header of the chunk: the
+// pool that allocated the chunk holds one reference, and each block *lent* out
+// of the chunk holds another.
+//
+//: o 'lendBlock' acquires a reference to the chunk holding a block on behalf
+//:   of the caller, who thereby keeps the block valid after the pool that
+//:   supplied it is released.
+//:
+//: o 'adoptBlock' hands a lent block, along with its reference, over to a pool
+//:   (using an equal allocator).  A pool adopting one of its own blocks simply
+//:   drops the reference.  Otherwise, the pool records the borrowed block in a
+//:   sorted index of chunks, so that, when the block is deallocated to the
+//:   pool, it is returned to its chunk rather than reused.
+//:
+//: o 'returnBlock' hands a lent block back to the chunk holding it, and drops
+//:   the reference: the owning pool reclaims the block for reuse the next time
+//:   it runs out of free blocks, or, if that pool was already released, the
+//:   chunk is returned to the allocator once its last reference is dropped.
+//
+// Therefore, a released pool retains only the chunks holding blocks that are
+// still lent out, and a block transferred between pools any number of times is
+// ultimately reused by, or returned with the chunk of, the pool that supplied
+// it.  Chunks are shared only through their atomic reference counts and
+// (lock-free) lists of returned blocks, so blocks may be lent to, and returned
+// from, pools used by other threads.  A pool that never lends or adopts a
+// block incurs no overhead from this facility other than the size of the
+// chunk headers.
+//
 ///Usage
 ///-----
 // This section illustrates intended use for this component.
@@ -225,8 +260,16 @@ BSL_OVERRIDES_STD mode"
 #include <bsls_assert.h>
 #endif
 
+#ifndef INCLUDED_BSLS_ATOMICOPERATIONS
+#include <bsls_atomicoperations.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
 #ifndef INCLUDED_ALGORITHM
-#include <algorithm>       // 'std::swap'
+#include <algorithm>       // 'std::swap', 'std::sort'
 #define INCLUDED_ALGORITHM
 #endif
 
@@ -286,18 +329,6 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
                                             // ensure proper alignment
     };
 
-    union Chunk {
-        // This 'union' prepends to the beginning of each managed block of
-        // allocated memory, implementing a singly-linked list of managed
-        // chunks, and thereby enabling constant-time additions to the list of
-        // chunks.
-
-        Chunk *d_next_p;  // pointer to next Chunk
-
-        typename bsls::AlignmentFromType<Block>::Type d_alignment;
-                          // ensure each block is correctly aligned
-    };
-
   public:
     // TYPES
     typedef VALUE ValueType;
@@ -313,13 +344,81 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
 
     typedef typename AllocatorTraits::size_type size_type;
 
+    struct Chunk {
+        // This 'struct' implements the header prepended to each managed block
+        // of allocated memory, implementing a singly-linked list of managed
+        // chunks, and holding the reference count that tracks the ownership
+        // of the chunk (see {Lending Blocks Between Pools}).  Other than by
+        // the pool that allocated the chunk, only 'd_returnedBlocks' and
+        // 'd_numReferences' are accessed, and only atomically.  Clients should
+        // treat this type as opaque.
+
+        Chunk *d_next_p;       // next chunk owned by the same pool
+
+        Chunk *d_nextLent_p;   // next chunk in the list of chunks, owned by
+                               // the same pool, having lent blocks
+
+        Block *d_end_p;        // address one past the last block
+
+        bsls::AtomicOperations::AtomicTypes::Pointer
+               d_returnedBlocks;
+                               // lent blocks returned to the chunk, and not
+                               // yet reclaimed by the owning pool
+
+        bsls::AtomicOperations::AtomicTypes::Int
+               d_numReferences;
+                               // one reference held by the owning pool
+                               // (until released) plus one per lent block
+
+        bool   d_isLent;       // 'true' if the chunk is in the list of
+                               // chunks having lent blocks
+    };
+
   private:
+    // PRIVATE TYPES
+    union ChunkHeader {
+        // This 'union' has the size of a 'Chunk' rounded up to the alignment
+        // of a 'Block', so that the blocks of a chunk immediately follow its
+        // header.
+
+        char d_size[sizeof(Chunk)];
+
+        typename bsls::AlignmentFromType<Block>::Type d_alignment;
+                          // ensure each block is correctly aligned
+    };
+
+    struct ChunkRecord {
+        // This 'struct' implements an entry of the chunk index of a pool.
+
+        Chunk *d_chunk_p;      // indexed chunk
+
+        int    d_numBorrowed;  // number of blocks adopted from the chunk
+                               // (owned by another pool) that are in use by
+                               // the pool having the index, or 0 if that pool
+                               // owns the chunk
+    };
+
     // DATA
-    Chunk *d_chunkList_p;     // linked list of "chunks" of memory
+    Chunk       *d_chunkList_p;     // linked list of "chunks" of memory
+
+    Block       *d_freeList_p;      // linked list of free memory blocks
+
+    int          d_blocksPerChunk;  // current chunk size (in blocks-per-chunk)
+
+    Chunk       *d_lentList_p;      // linked list of the chunks owned by this
+                                    // pool having lent blocks
+
+    ChunkRecord *d_index_p;         // chunk index: records of the chunks
+                                    // owned by, or borrowed from by, this
+                                    // pool, sorted by address, or 0 until a
+                                    // block is first lent or adopted
+
+    int          d_indexLength;     // number of records in 'd_index_p'
 
-    Block *d_freeList_p;      // linked list of free memory blocks
+    int          d_indexCapacity;   // capacity of 'd_index_p' (in records)
 
-    int    d_blocksPerChunk;  // current chunk size (in blocks-per-chunk)
+    int          d_numBorrowed;     // number of blocks adopted from chunks
+                                    // of other pools that are in use
 
   private:
     // NOT IMPLEMENTED
@@ -330,15 +429,89 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
     // PRIVATE MANIPULATORS
     Block *allocateChunk(size_type size);
         // Allocate a chunk of memory with at least the specified 'size' number
-        // of usable bytes and add the chunk to the chunk list.  Return the
-        // address of the usable portion of the memory.
+        // of usable bytes and add the chunk to the chunk list (and, if this
+        // pool has one, to the chunk index).  Return the address of the
+        // usable portion of the memory.
+
+    void createIndex();
+        // Create the chunk index of this pool, recording every chunk owned by
+        // this pool, with capacity for at least one more record.  The
+        // behavior is undefined if this pool already has a chunk index.
+
+    void insertRecord(int position, Chunk *chunk, int numBorrowed);
+        // Insert, at the specified 'position' of the chunk index, a record of
+        // the specified 'chunk' having the specified 'numBorrowed' blocks.
+        // The behavior is undefined unless the capacity of the index exceeds
+        // its length, and 'chunk' belongs at 'position' in address order.
+
+    void reclaimLentBlocks();
+        // Add each block returned to a chunk owned by this pool to the free
+        // list, and remove each chunk having no more lent blocks from the list
+        // of chunks having lent blocks.
+
+    void removeRecord(int position);
+        // Remove the record at the specified 'position' from the chunk index.
 
     void replenish();
-        // Dynamically allocate a new chunk using the pool's underlying growth
-        // strategy, and use the chunk to replenish the free memory list of
-        // this pool.
+        // Reclaim the blocks returned to the chunks of this pool if there are
+        // any, and otherwise dynamically allocate a new chunk using the pool's
+        // underlying growth strategy, and use the chunk to replenish the free
+        // memory list of this pool.
+
+    void reserveIndex(int numRecords);
+        // Ensure that the chunk index of this pool, creating an empty index
+        // if this pool has none, has capacity for at least the specified
+        // 'numRecords'.
+
+    bool returnBorrowedBlock(void *address);
+        // If the block at the specified 'address' was adopted from a chunk
+        // owned by another pool, return the block to that chunk (see
+        // 'returnBlock') and return 'true'; otherwise, return 'false' with no
+        // effect.
+
+    void swapMembers(SimplePool& other);
+        // Exchange the memory blocks, but not the allocator, of this object
+        // with those of the specified 'other' object.
+
+    // PRIVATE CLASS METHODS
+    static void deallocateChunk(Chunk *chunk, AllocatorType& allocator);
+        // Return the specified 'chunk' to the specified 'allocator'.
+
+    static bool isLess(const ChunkRecord& lhs, const ChunkRecord& rhs);
+        // Return 'true' if the chunk of the specified 'lhs' record lies at a
+        // lower address than that of the specified 'rhs' record, and 'false'
+        // otherwise.
+
+    static size_type numMaxAlignedTypes(size_type numBytes);
+        // Return the number of 'bsls::AlignmentUtil::MaxAlignedType' objects
+        // needed to hold the specified 'numBytes'.
+
+    // PRIVATE ACCESSORS
+    int findRecord(const void *address) const;
+        // Return the position, in the chunk index of this pool, of the record
+        // of the chunk holding the block at the specified 'address', or -1 if
+        // no indexed chunk holds 'address'.
+
+    int upperBound(const void *address) const;
+        // Return the number of records in the chunk index of this pool whose
+        // chunk lies at or below the specified 'address'.
 
   public:
+    // CLASS METHODS
+    static void returnBlock(Chunk                *chunk,
+                            void                 *address,
+                            const AllocatorType&  allocator);
+        // Return the block at the specified 'address', lent out of the
+        // specified 'chunk', to 'chunk', and release the reference to 'chunk'
+        // held by the caller (see 'lendBlock').  The pool owning 'chunk' (if
+        // not yet released) reclaims the block for reuse when it next runs
+        // out of free blocks; otherwise, if this was the last reference to
+        // 'chunk', its memory is returned to the specified 'allocator'.  This
+        // method may be called from any thread.  The behavior is undefined
+        // unless the caller holds a reference to 'chunk' for the block at
+        // 'address', and 'allocator' compares equal to the allocator of the
+        // pool that lent the block.
+
     // CREATORS
     explicit SimplePool(const ALLOCATOR& allocator);
         // Create a memory pool that returns blocks of contiguous memory of the
@@ -363,9 +536,11 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
 
     void deallocate(void *address);
         // Relinquish the memory block at the specified 'address' back to this
-        // pool object for reuse.  The behavior is undefined unless 'address'
-        // is non-zero, was allocated by this pool, and has not already been
-        // deallocated.
+        // pool object for reuse, or, if the block was adopted from a chunk
+        // owned by another pool (see 'adoptBlock'), return it to that chunk.
+        // The behavior is undefined unless 'address' is non-zero, was
+        // allocated or adopted by this pool, and has not already been
+        // deallocated or lent.
 
     void reserve(size_type numBlocks);
         // Dynamically allocate a new chunk containing the specified
@@ -375,6 +550,36 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
 
     void release();
         // Relinquish all memory currently allocated via this pool object.
+        // Note that a chunk holding blocks lent out of this pool (see
+        // 'lendBlock') is returned to the allocator only once each of those
+        // blocks has been returned.
+
+    Chunk *lendBlock(void *address);
+        // Lend the block at the specified 'address' out of this pool, and
+        // return the address of the chunk holding the block, with a reference
+        // to the chunk acquired on behalf of the caller, which thereby keeps
+        // the block valid even after this pool is released.  The caller
+        // becomes responsible for handing the block, along with the
+        // reference, over to a pool (see 'adoptBlock') or back to its chunk
+        // (see 'returnBlock').  The behavior is undefined unless 'address' was
+        // allocated or adopted by this pool, and has not been deallocated or
+        // lent.  Note that memory is allocated only the first time a block is
+        // lent out of, or adopted by, this pool.
+
+    void reserveAdoption();
+        // Ensure that the next call to 'adoptBlock' on this pool does not
+        // allocate memory.
+
+    void adoptBlock(Chunk *chunk, void *address);
+        // Take over the block at the specified 'address', lent out of the
+        // specified 'chunk', along with the reference to 'chunk' held by the
+        // caller, so that the block may be deallocated to this pool.  If
+        // 'chunk' is not owned by this pool, this method may allocate memory
+        // (unless 'reserveAdoption' was called since the last call to this
+        // method), and, if an exception is thrown, has no effect.  The
+        // behavior is undefined unless the caller holds a reference to 'chunk'
+        // for the block at 'address' (see 'lendBlock'), and the block was lent
+        // by a pool whose allocator compares equal to 'allocator()'.
 
     void swap(SimplePool& other);
         // Efficiently exchange the memory blocks of this object with those of
@@ -406,35 +611,154 @@ class SimplePool : public SimplePool_Type<ALLOCATOR>::AllocatorType {
 //                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
 // ============================================================================
 
+                       // ----------------
+                       // class SimplePool
+                       // ----------------
+
 // PRIVATE MANIPULATORS
 template <class VALUE, class ALLOCATOR>
 typename SimplePool<VALUE, ALLOCATOR>::Block *
 SimplePool<VALUE, ALLOCATOR>::allocateChunk(size_type size)
 {
+    if (d_index_p) {
+        reserveIndex(d_indexLength + 1);
+    }
+
     // Determine the number of bytes we want to allocate and compute the number
     // of 'MaxAlignedType' needed to contain those bytes.
 
-    size_type numBytes = static_cast<size_type>(sizeof(Chunk)) + size;
-    size_type numMaxAlignedType =
-                       (numBytes + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
-                     / bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+    size_type numMaxAlignedType = numMaxAlignedTypes(
+                           static_cast<size_type>(sizeof(ChunkHeader)) + size);
 
     Chunk *chunkPtr = reinterpret_cast<Chunk *>(
                     AllocatorTraits::allocate(allocator(), numMaxAlignedType));
 
     BSLS_ASSERT_SAFE(0 ==
-             reinterpret_cast<bsls::Types::UintPtr>(chunkPtr) % sizeof(Chunk));
+                        reinterpret_cast<bsls::Types::UintPtr>(chunkPtr)
+                      % bsls::AlignmentFromType<Block>::VALUE);
+
+    Block *begin = reinterpret_cast<Block *>(
+                                reinterpret_cast<ChunkHeader *>(chunkPtr) + 1);
+
+    chunkPtr->d_next_p     = d_chunkList_p;
+    chunkPtr->d_nextLent_p = 0;
+    chunkPtr->d_end_p      = reinterpret_cast<Block *>(
+                                       reinterpret_cast<char *>(begin) + size);
+    bsls::AtomicOperations::initPointer(&chunkPtr->d_returnedBlocks, 0);
+    bsls::AtomicOperations::initInt(&chunkPtr->d_numReferences, 1);
+    chunkPtr->d_isLent     = false;
+    d_chunkList_p          = chunkPtr;
+
+    if (d_index_p) {
+        insertRecord(upperBound(chunkPtr), chunkPtr, 0);
+    }
+
+    return begin;
+}
+
+template <class VALUE, class ALLOCATOR>
+void SimplePool<VALUE, ALLOCATOR>::createIndex()
+{
+    BSLS_ASSERT_SAFE(!d_index_p);
+
+    int numChunks = 0;
+    for (Chunk *chunk = d_chunkList_p; chunk; chunk = chunk->d_next_p) {
+        ++numChunks;
+    }
 
-    chunkPtr->d_next_p = d_chunkList_p;
-    d_chunkList_p      = chunkPtr;
+    reserveIndex(numChunks + 1);
 
-    return reinterpret_cast<Block *>(chunkPtr + 1);
+    ChunkRecord *record = d_index_p;
+    for (Chunk *chunk = d_chunkList_p; chunk; chunk = chunk->d_next_p) {
+        record->d_chunk_p     = chunk;
+        record->d_numBorrowed = 0;
+        ++record;
+    }
+    d_indexLength = numChunks;
+
+    std::sort(d_index_p, d_index_p + d_indexLength, &isLess);
+}
+
+template <class VALUE, class ALLOCATOR>
+void SimplePool<VALUE, ALLOCATOR>::insertRecord(int    position,
+                                                Chunk *chunk,
+                                                int    numBorrowed)
+{
+    BSLS_ASSERT_SAFE(0 <= position);
+    BSLS_ASSERT_SAFE(position <= d_indexLength);
+    BSLS_ASSERT_SAFE(d_indexLength < d_indexCapacity);
+
+    for (int i = d_indexLength; i > position; --i) {
+        d_index_p[i] = d_index_p[i - 1];
+    }
+    d_index_p[position].d_chunk_p     = chunk;
+    d_index_p[position].d_numBorrowed = numBorrowed;
+    ++d_indexLength;
+}
+
+template <class VALUE, class ALLOCATOR>
+void SimplePool<VALUE, ALLOCATOR>::reclaimLentBlocks()
+{
+    Chunk **link = &d_lentList_p;
+    while (*link) {
+        Chunk *chunk = *link;
+
+        // A chunk is idle if only this pool holds a reference to it.  Since a
+        // lent block is added to the list of returned blocks *before* its
+        // reference is released, reading the count before taking the list
+        // ensures that no block of an idle chunk is left behind.
+
+        const bool isIdle = 1 == bsls::AtomicOperations::getIntAcquire(
+                                                     &chunk->d_numReferences);
+
+        Block *returned = static_cast<Block *>(
+                         bsls::AtomicOperations::swapPtrAcqRel(
+                                                     &chunk->d_returnedBlocks,
+                                                     0));
+        if (returned) {
+            Block *last = returned;
+            while (last->d_next_p) {
+                last = last->d_next_p;
+            }
+            last->d_next_p = d_freeList_p;
+            d_freeList_p   = returned;
+        }
+
+        if (isIdle) {
+            *link               = chunk->d_nextLent_p;
+            chunk->d_nextLent_p = 0;
+            chunk->d_isLent     = false;
+        }
+        else {
+            link = &chunk->d_nextLent_p;
+        }
+    }
+}
+
+template <class VALUE, class ALLOCATOR>
+inline
+void SimplePool<VALUE, ALLOCATOR>::removeRecord(int position)
+{
+    BSLS_ASSERT_SAFE(0 <= position);
+    BSLS_ASSERT_SAFE(position < d_indexLength);
+
+    --d_indexLength;
+    for (int i = position; i < d_indexLength; ++i) {
+        d_index_p[i] = d_index_p[i + 1];
+    }
 }
 
 template <class VALUE, class ALLOCATOR>
 inline
 void SimplePool<VALUE, ALLOCATOR>::replenish()
 {
+    if (d_lentList_p) {
+        reclaimLentBlocks();
+        if (d_freeList_p) {
+            return;                                                   // RETURN
+        }
+    }
+
     reserve(d_blocksPerChunk);
 
     enum { MAX_BLOCKS_PER_CHUNK = 32 };
@@ -444,6 +768,174 @@ void SimplePool<VALUE, ALLOCATOR>::replenish()
     }
 }
 
+template <class VALUE, class ALLOCATOR>
+void SimplePool<VALUE, ALLOCATOR>::reserveIndex(int numRecords)
+{
+    if (d_index_p && numRecords <= d_indexCapacity) {
+        return;                                                       // RETURN
+    }
+
+    enum { k_MIN_INDEX_CAPACITY = 8 };
+
+    int newCapacity = d_indexCapacity ? d_indexCapacity * 2
+                                      : static_cast<int>(k_MIN_INDEX_CAPACITY);
+    while (newCapacity < numRecords) {
+        newCapacity *= 2;
+    }
+
+    ChunkRecord *newIndex = reinterpret_cast<ChunkRecord *>(
+                        AllocatorTraits::allocate(
+                              allocator(),
+                              numMaxAlignedTypes(newCapacity
+                                                 * sizeof(ChunkRecord))));
+
+    if (d_index_p) {
+        std::copy(d_index_p, d_index_p + d_indexLength, newIndex);
+        AllocatorTraits::deallocate(
+                    allocator(),
+                    reinterpret_cast<typename AllocatorTraits::value_type *>(
+                                                                    d_index_p),
+                    numMaxAlignedTypes(d_indexCapacity * sizeof(ChunkRecord)));
+    }
+    d_index_p       = newIndex;
+    d_indexCapacity = newCapacity;
+}
+
+template <class VALUE, class ALLOCATOR>
+bool SimplePool<VALUE, ALLOCATOR>::returnBorrowedBlock(void *address)
+{
+    const int position = findRecord(address);
+    if (position < 0 || 0 == d_index_p[position].d_numBorrowed) {
+        return false;                                                 // RETURN
+    }
+
+    Chunk *chunk = d_index_p[position].d_chunk_p;
+    if (0 == --d_index_p[position].d_numBorrowed) {
+        removeRecord(position);
+    }
+    --d_numBorrowed;
+
+    returnBlock(chunk, address, allocator());
+    return true;
+}
+
+template <class VALUE, class ALLOCATOR>
+inline
+void SimplePool<VALUE, ALLOCATOR>::swapMembers(SimplePool& other)
+{
+    std::swap(d_blocksPerChunk, other.d_blocksPerChunk);
+    std::swap(d_freeList_p, other.d_freeList_p);
+    std::swap(d_chunkList_p, other.d_chunkList_p);
+    std::swap(d_lentList_p, other.d_lentList_p);
+    std::swap(d_index_p, other.d_index_p);
+    std::swap(d_indexLength, other.d_indexLength);
+    std::swap(d_indexCapacity, other.d_indexCapacity);
+    std::swap(d_numBorrowed, other.d_numBorrowed);
+}
+
+// PRIVATE CLASS METHODS
+template <class VALUE, class ALLOCATOR>
+inline
+void SimplePool<VALUE, ALLOCATOR>::deallocateChunk(Chunk         *chunk,
+                                                   AllocatorType& allocator)
+{
+    AllocatorTraits::deallocate(
+                      allocator,
+                      reinterpret_cast<typename AllocatorTraits::value_type *>(
+                                                                        chunk),
+                      1);
+}
+
+template <class VALUE, class ALLOCATOR>
+inline
+bool SimplePool<VALUE, ALLOCATOR>::isLess(const ChunkRecord& lhs,
+                                          const ChunkRecord& rhs)
+{
+    return reinterpret_cast<bsls::Types::UintPtr>(lhs.d_chunk_p)
+         < reinterpret_cast<bsls::Types::UintPtr>(rhs.d_chunk_p);
+}
+
+template <class VALUE, class ALLOCATOR>
+inline
+typename SimplePool<VALUE, ALLOCATOR>::size_type
+SimplePool<VALUE, ALLOCATOR>::numMaxAlignedTypes(size_type numBytes)
+{
+    return (numBytes + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
+         / bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+}
+
+// PRIVATE ACCESSORS
+template <class VALUE, class ALLOCATOR>
+inline
+int SimplePool<VALUE, ALLOCATOR>::findRecord(const void *address) const
+{
+    const int position = upperBound(address) - 1;
+    if (0 <= position) {
+        const Block *end = d_index_p[position].d_chunk_p->d_end_p;
+        if (reinterpret_cast<bsls::Types::UintPtr>(address)
+                               < reinterpret_cast<bsls::Types::UintPtr>(end)) {
+            return position;                                          // RETURN
+        }
+    }
+    return -1;
+}
+
+template <class VALUE, class ALLOCATOR>
+int SimplePool<VALUE, ALLOCATOR>::upperBound(const void *address) const
+{
+    const bsls::Types::UintPtr key =
+                              reinterpret_cast<bsls::Types::UintPtr>(address);
+
+    int low  = 0;
+    int high = d_indexLength;
+    while (low < high) {
+        const int middle = low + (high - low) / 2;
+        if (reinterpret_cast<bsls::Types::UintPtr>(
+                                        d_index_p[middle].d_chunk_p) <= key) {
+            low = middle + 1;
+        }
+        else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+// CLASS METHODS
+template <class VALUE, class ALLOCATOR>
+void SimplePool<VALUE, ALLOCATOR>::returnBlock(
+                                              Chunk                *chunk,
+                                              void                 *address,
+                                              const AllocatorType&  allocator)
+{
+    BSLS_ASSERT(chunk);
+    BSLS_ASSERT(address);
+
+    Block *block = static_cast<Block *>(address);
+    void  *head  = bsls::AtomicOperations::getPtrRelaxed(
+                                                     &chunk->d_returnedBlocks);
+    while (true) {
+        block->d_next_p = static_cast<Block *>(head);
+        void *previous = bsls::AtomicOperations::testAndSwapPtrAcqRel(
+                                                      &chunk->d_returnedBlocks,
+                                                      head,
+                                                      block);
+        if (previous == head) {
+            break;
+        }
+        head = previous;
+    }
+
+    if (0 == bsls::AtomicOperations::decrementIntNvAcqRel(
+                                                   &chunk->d_numReferences)) {
+        // The pool owning 'chunk' has been released, and no other block of
+        // 'chunk' remains lent, so no other thread can reach the chunk.
+
+        AllocatorType allocatorCopy(allocator);
+        deallocateChunk(chunk, allocatorCopy);
+    }
+}
+
 // CREATORS
 template <class VALUE, class ALLOCATOR>
 inline
@@ -452,6 +944,11 @@ SimplePool<VALUE, ALLOCATOR>::SimplePool(const ALLOCATOR& allocator)
 , d_chunkList_p(0)
 , d_freeList_p(0)
 , d_blocksPerChunk(1)
+, d_lentList_p(0)
+, d_index_p(0)
+, d_indexLength(0)
+, d_indexCapacity(0)
+, d_numBorrowed(0)
 {
 }
 
@@ -489,6 +986,10 @@ void SimplePool<VALUE, ALLOCATOR>::deallocate(void *address)
 {
     BSLS_ASSERT_SAFE(address);
 
+    if (d_numBorrowed && returnBorrowedBlock(address)) {
+        return;                                                       // RETURN
+    }
+
     reinterpret_cast<Block *>(address)->d_next_p = d_freeList_p;
     d_freeList_p = reinterpret_cast<Block *>(address);
 }
@@ -499,9 +1000,7 @@ void SimplePool<VALUE, ALLOCATOR>::swap(SimplePool<VALUE, ALLOCATOR>& other)
 {
     BSLS_ASSERT_SAFE(allocator() == other.allocator());
 
-    std::swap(d_blocksPerChunk, other.d_blocksPerChunk);
-    std::swap(d_freeList_p, other.d_freeList_p);
-    std::swap(d_chunkList_p, other.d_chunkList_p);
+    swapMembers(other);
 }
 
 template <class VALUE, class ALLOCATOR>
@@ -518,9 +1017,7 @@ void SimplePool<VALUE, ALLOCATOR>::quickSwapExchangeAllocators(
                                            SimplePool<VALUE, ALLOCATOR>& other)
 {
     bslalg::SwapUtil::swap(&this->allocator(), &other.allocator());
-    std::swap(d_blocksPerChunk, other.d_blocksPerChunk);
-    std::swap(d_freeList_p, other.d_freeList_p);
-    std::swap(d_chunkList_p, other.d_chunkList_p);
+    swapMembers(other);
 }
 
 template <class VALUE, class ALLOCATOR>
@@ -551,14 +1048,120 @@ SimplePool<VALUE, ALLOCATOR>::allocator() const
 template <class VALUE, class ALLOCATOR>
 void SimplePool<VALUE, ALLOCATOR>::release()
 {
+    if (d_index_p) {
+        // Release the references to the chunks of other pools held for the
+        // adopted blocks (if any) still in use.
+
+        for (int i = 0; i < d_indexLength; ++i) {
+            Chunk *chunk = d_index_p[i].d_chunk_p;
+            if (d_index_p[i].d_numBorrowed
+             && 0 == bsls::AtomicOperations::addIntNvAcqRel(
+                                               &chunk->d_numReferences,
+                                               -d_index_p[i].d_numBorrowed)) {
+                deallocateChunk(chunk, allocator());
+            }
+        }
+
+        AllocatorTraits::deallocate(
+                    allocator(),
+                    reinterpret_cast<typename AllocatorTraits::value_type *>(
+                                                                    d_index_p),
+                    numMaxAlignedTypes(d_indexCapacity * sizeof(ChunkRecord)));
+        d_index_p       = 0;
+        d_indexLength   = 0;
+        d_indexCapacity = 0;
+        d_numBorrowed   = 0;
+    }
+
+    // A chunk having lent blocks is returned to the allocator by whoever
+    // drops the last reference to it.
+
     while (d_chunkList_p) {
-        typename AllocatorTraits::value_type *lastChunk =
-                      reinterpret_cast<typename AllocatorTraits::value_type *>(
-                                                                d_chunkList_p);
-        d_chunkList_p   = d_chunkList_p->d_next_p;
-        AllocatorTraits::deallocate(allocator(), lastChunk, 1);
+        Chunk *chunk  = d_chunkList_p;
+        d_chunkList_p = chunk->d_next_p;
+
+        if (!chunk->d_isLent
+         || 0 == bsls::AtomicOperations::decrementIntNvAcqRel(
+                                                   &chunk->d_numReferences)) {
+            deallocateChunk(chunk, allocator());
+        }
     }
     d_freeList_p = 0;
+    d_lentList_p = 0;
+}
+
+template <class VALUE, class ALLOCATOR>
+typename SimplePool<VALUE, ALLOCATOR>::Chunk *
+SimplePool<VALUE, ALLOCATOR>::lendBlock(void *address)
+{
+    BSLS_ASSERT(address);
+
+    if (!d_index_p) {
+        createIndex();
+    }
+
+    const int position = findRecord(address);
+    BSLS_ASSERT(0 <= position);
+
+    Chunk *chunk = d_index_p[position].d_chunk_p;
+    if (d_index_p[position].d_numBorrowed) {
+        // The block was adopted from a chunk owned by another pool: hand the
+        // reference held by this pool over to the caller.
+
+        if (0 == --d_index_p[position].d_numBorrowed) {
+            removeRecord(position);
+        }
+        --d_numBorrowed;
+    }
+    else {
+        bsls::AtomicOperations::incrementIntAcqRel(&chunk->d_numReferences);
+        if (!chunk->d_isLent) {
+            chunk->d_isLent     = true;
+            chunk->d_nextLent_p = d_lentList_p;
+            d_lentList_p        = chunk;
+        }
+    }
+    return chunk;
+}
+
+template <class VALUE, class ALLOCATOR>
+inline
+void SimplePool<VALUE, ALLOCATOR>::reserveAdoption()
+{
+    if (!d_index_p) {
+        createIndex();
+    }
+    else {
+        reserveIndex(d_indexLength + 1);
+    }
+}
+
+template <class VALUE, class ALLOCATOR>
+void SimplePool<VALUE, ALLOCATOR>::adoptBlock(Chunk *chunk, void *address)
+{
+    BSLS_ASSERT(chunk);
+    BSLS_ASSERT(address);
+
+    reserveAdoption();
+
+    const int position = findRecord(address);
+    if (0 <= position) {
+        BSLS_ASSERT_SAFE(chunk == d_index_p[position].d_chunk_p);
+
+        if (0 == d_index_p[position].d_numBorrowed) {
+            // The block was lent out of this pool, which already holds a
+            // reference to its chunk.
+
+            bsls::AtomicOperations::decrementIntAcqRel(
+                                                     &chunk->d_numReferences);
+            return;                                                   // RETURN
+        }
+        ++d_index_p[position].d_numBorrowed;
+    }
+    else {
+        insertRecord(upperBound(address), chunk, 1);
+    }
+    ++d_numBorrowed;
 }
 
 }  // close namespace bslstl
@@ -49,12 +49,18 @@ using namespace bslstl;
 // [ 6] void reserve(std::size_t numBlocks);
 // [ 7] void release();
 // [ 8] void swap(SimplePool<VALUE, ALLOCATOR>& other);
+// [10] Chunk *lendBlock(void *address);
+// [10] void reserveAdoption();
+// [10] void adoptBlock(Chunk *chunk, void *address);
+//
+// CLASS METHODS
+// [10] static void returnBlock(Chunk *, void *, const AllocatorType&);
 //
 // ACCESSORS
 // [ 4] const AllocatorType& allocator() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [10] USAGE EXAMPLE
+// [11] USAGE EXAMPLE
 // [ 9] CONCERN: Standard allocator can be used
 // [ 3] TEST APPARATUS
 
@@ -1266,7 +1272,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:
-      case 10: {
+      case 11: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1312,6 +1318,242 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // LENDING BLOCKS
+        //
+        // Concerns:
+        //: 1 A lent block remains valid after its pool is released, which
+        //:   retains only the chunk holding the block, and that chunk is
+        //:   returned to the allocator once the block is returned.
+        //:
+        //: 2 A block returned to its chunk is reclaimed, and reused, by the
+        //:   pool that lent it, if that pool has not been released.
+        //:
+        //: 3 A block adopted by a pool that does not own its chunk is returned
+        //:   to that chunk when deallocated, rather than reused.
+        //:
+        //: 4 A block lent back to the pool that supplied it is again owned by
+        //:   that pool.
+        //:
+        //: 5 Transferring blocks between pools, repeatedly, out of pools that
+        //:   are then released, or out of a pool that is never released, does
+        //:   not increase the memory in use.
+        //:
+        //: 6 'adoptBlock' does not allocate memory following a call to
+        //:   'reserveAdoption'.
+        //:
+        //: 7 'release' and 'swap' account for the lent and adopted blocks of
+        //:   a pool.
+        //
+        // Plan:
+        //: 1 Using a test allocator, lend a block out of a pool having two
+        //:   chunks, destroy the pool, verify that a single chunk remains in
+        //:   use, and that no memory is in use once the block is returned.
+        //:   (C-1)
+        //:
+        //: 2 Return a lent block to a pool, and verify that the block is
+        //:   allocated again without allocating memory.  (C-2)
+        //:
+        //: 3 Have a second pool adopt a block, destroy the pool that lent it,
+        //:   deallocate the block to the second pool, and verify that the
+        //:   chunk of the block is returned to the allocator.  (C-3)
+        //:
+        //: 4 Lend a block to a second pool, which lends it back, and verify
+        //:   the block is reused by the first pool.  (C-4)
+        //:
+        //: 5 Over many rounds, transfer a block out of a pool having
+        //:   allocated 10,000 blocks, and then destroyed, to a long-lived pool
+        //:   that deallocates the block of the previous round; verify that the
+        //:   memory in use is the same after each round.  Repeat, lending
+        //:   blocks out of a single long-lived pool.  (C-5)
+        //:
+        //: 6 Adopt blocks from many chunks, calling 'reserveAdoption' before
+        //:   each, and verify that 'adoptBlock' allocates no memory.  (C-6)
+        //:
+        //: 7 'release' and 'swap' pools having lent and adopted blocks, and
+        //:   verify the memory in use.  (C-7)
+        //
+        // Testing:
+        //   Chunk *lendBlock(void *address);
+        //   void reserveAdoption();
+        //   void adoptBlock(Chunk *chunk, void *address);
+        //   static void returnBlock(Chunk *, void *, const AllocatorType&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLENDING BLOCKS"
+                            "\n==============\n");
+
+        typedef SimplePool<int, bsl::allocator<int> > Obj;
+        typedef Obj::Chunk                            Chunk;
+
+        bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tA lent block outlives its pool.\n");
+        {
+            Obj *mX = new Obj(&ta);
+            mX->reserve(4);
+            int *block = mX->allocate();
+            mX->reserve(4);
+            *block = 7;
+            ASSERT(2 == ta.numBlocksInUse());
+
+            Chunk *chunk = mX->lendBlock(block);
+            ASSERT(chunk);
+
+            delete mX;
+            ASSERTV(ta.numBlocksInUse(), 1 == ta.numBlocksInUse());
+            ASSERT(7 == *block);
+
+            Obj::returnBlock(chunk, block, bsl::allocator<int>(&ta));
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tA returned block is reused.\n");
+        {
+            Obj mX(&ta);
+
+            int *block = mX.allocate();
+            Obj::returnBlock(mX.lendBlock(block), block, mX.allocator());
+
+            const bsls::Types::Int64 NUM_TOTAL = ta.numBlocksTotal();
+            ASSERT(block == mX.allocate());
+            ASSERT(NUM_TOTAL == ta.numBlocksTotal());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tAn adopted block is returned to its chunk.\n");
+        {
+            Obj *mX = new Obj(&ta);
+            Obj  mY(&ta);
+
+            int *block = mX->allocate();
+            mY.adoptBlock(mX->lendBlock(block), block);
+            delete mX;
+
+            const bsls::Types::Int64 NUM_IN_USE = ta.numBlocksInUse();
+            mY.deallocate(block);
+            ASSERTV(NUM_IN_USE, ta.numBlocksInUse(),
+                    NUM_IN_USE - 1 == ta.numBlocksInUse());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tA block lent back to its pool.\n");
+        {
+            Obj mX(&ta);
+            Obj mY(&ta);
+
+            int *block = mX.allocate();
+            mY.adoptBlock(mX.lendBlock(block), block);
+            mX.adoptBlock(mY.lendBlock(block), block);
+            mX.deallocate(block);
+
+            const bsls::Types::Int64 NUM_TOTAL = ta.numBlocksTotal();
+            ASSERT(block == mX.allocate());
+            ASSERT(NUM_TOTAL == ta.numBlocksTotal());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\tRepeated transfers.\n");
+        {
+            enum { k_NUM_BLOCKS = 10000, k_NUM_ROUNDS = 20 };
+
+            Obj  mY(&ta);
+            int *kept = 0;
+
+            bsls::Types::Int64 numBytes = 0;
+            for (int round = 0; round < k_NUM_ROUNDS; ++round) {
+                Obj  *mX = new Obj(&ta);
+                int **blocks = static_cast<int **>(
+                                   ta.allocate(k_NUM_BLOCKS * sizeof(int *)));
+                for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                    blocks[i] = mX->allocate();
+                }
+                int *block = blocks[k_NUM_BLOCKS / 2];
+                mY.adoptBlock(mX->lendBlock(block), block);
+                for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                    if (block != blocks[i]) {
+                        mX->deallocate(blocks[i]);
+                    }
+                }
+                ta.deallocate(blocks);
+                delete mX;
+
+                if (kept) {
+                    mY.deallocate(kept);
+                }
+                kept = block;
+
+                if (0 == round) {
+                    numBytes = ta.numBytesInUse();
+                }
+                ASSERTV(round, numBytes, ta.numBytesInUse(),
+                        numBytes == ta.numBytesInUse());
+            }
+            mY.deallocate(kept);
+
+            Obj mX(&ta);
+            for (int round = 0; round < k_NUM_ROUNDS; ++round) {
+                int *block = mX.allocate();
+                mY.adoptBlock(mX.lendBlock(block), block);
+                mY.deallocate(block);
+
+                if (0 == round) {
+                    numBytes = ta.numBytesInUse();
+                }
+                ASSERTV(round, numBytes, ta.numBytesInUse(),
+                        numBytes == ta.numBytesInUse());
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\t'reserveAdoption'.\n");
+        {
+            enum { k_NUM_CHUNKS = 20 };
+
+            Obj mX(&ta);
+            Obj mY(&ta);
+
+            for (int i = 0; i < k_NUM_CHUNKS; ++i) {
+                mX.reserve(1);
+                int   *block = mX.allocate();
+                Chunk *chunk = mX.lendBlock(block);
+
+                mY.reserveAdoption();
+                const bsls::Types::Int64 NUM_TOTAL = ta.numBlocksTotal();
+                mY.adoptBlock(chunk, block);
+                ASSERTV(i, NUM_TOTAL == ta.numBlocksTotal());
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) printf("\t'release' and 'swap'.\n");
+        {
+            Obj mX(&ta);
+            Obj mY(&ta);
+            Obj mZ(&ta);
+
+            int   *lent  = mX.allocate();
+            Chunk *chunk = mX.lendBlock(lent);
+            mX.allocate();
+            mX.allocate();
+
+            int *adopted = mZ.allocate();
+            mX.adoptBlock(mZ.lendBlock(adopted), adopted);
+
+            mX.swap(mY);
+            mY.release();
+            ASSERT(0 < ta.numBlocksInUse());
+
+            Obj::returnBlock(chunk, lent, mX.allocator());
+            mZ.release();
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+            mX.allocate();
+            mX.release();
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // ALIGNMENT TEST
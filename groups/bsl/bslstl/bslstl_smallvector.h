@@ -0,0 +1,1908 @@
+// bslstl_smallvector.h                                               -*-C++-*-
+#ifndef INCLUDED_BSLSTL_SMALLVECTOR
+#define INCLUDED_BSLSTL_SMALLVECTOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an STL-compliant vector with inline capacity.
+//
+//@CLASSES:
+//   bsl::small_vector: vector holding up to 'N' elements without allocating
+//
+//@SEE_ALSO: bslstl_vector
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bsl::small_vector', implementing a dynamically-sized array of elements (of
+// a template parameter type, 'VALUE_TYPE') that holds up to a fixed number of
+// elements (given by a template parameter, 'INLINE_CAPACITY') in a buffer
+// embedded in the 'small_vector' object itself, and holds its elements in
+// memory supplied by its allocator only once it grows beyond that number.
+//
+// An instantiation of 'small_vector' is an allocator-aware, value-semantic
+// type whose salient attributes are its size (number of elements) and the
+// sequence of values of its elements.  'INLINE_CAPACITY' is *not* a salient
+// attribute, and, since it is part of the type, two 'small_vector' objects
+// can be compared only if they have the same 'INLINE_CAPACITY'.
+//
+///Choosing Between 'vector' and 'small_vector'
+///--------------------------------------------
+// A 'bsl::vector' allocates memory when its first element is inserted, so a
+// program creating many short-lived vectors that mostly hold a handful of
+// elements spends much of its time allocating (and deallocating) small
+// arrays.  A 'small_vector' whose 'INLINE_CAPACITY' covers the typical size
+// of such a vector allocates no memory at all in the typical case, and its
+// elements lie in the same cache lines as the object itself.
+//
+// In exchange, a 'small_vector' object is larger than a 'vector' object by
+// 'INLINE_CAPACITY * sizeof(VALUE_TYPE)' bytes, whether or not the inline
+// buffer is in use, and exchanging the values of two 'small_vector' objects
+// ('swap') must move the elements held inline, so takes time linear in
+// 'INLINE_CAPACITY' rather than constant time.
+//
+// Like 'bsl::vector', 'small_vector' constructs, moves, and destroys its
+// elements using 'bslalg::ArrayPrimitives', so that elements of a
+// bitwise-moveable type (see 'bslmf_isbitwisemoveable') are moved from the
+// inline buffer to allocated memory (and from one allocated array to a larger
+// one) by a single 'memcpy', and are shifted within the array by a single
+// 'memmove'.
+//
+///Requirements on 'VALUE_TYPE'
+///----------------------------
+// A 'small_vector' has the same requirements on its 'VALUE_TYPE' as
+// 'bsl::vector'.  In particular, 'VALUE_TYPE' must be "copy-constructible"
+// and "copy-assignable", and must be "default-constructible" to use the
+// constructor and the 'resize' overload taking only a size.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as a 'small_vector''s 'ALLOCATOR' template parameter
+// determines how that vector will allocate memory once its size exceeds
+// 'INLINE_CAPACITY', and which allocator is supplied to its elements, exactly
+// as for 'bsl::vector' (see {'bslstl_vector'}).  In particular, the allocator
+// of a 'small_vector' is fixed at construction, is not propagated by
+// assignment or 'swap', and the copy constructor uses the allocator returned
+// by 'bsl::allocator_traits<ALLOCATOR>::select_on_container_copy_construction'
+// (which, for 'bsl::allocator', is the currently installed default
+// allocator).  Note that every element, including an element held inline,
+// uses the allocator of the 'small_vector'.
+//
+// A 'small_vector' whose size exceeds 'INLINE_CAPACITY' grows geometrically,
+// exactly as a 'bsl::vector' does.  Calling 'shrink_to_fit' on a
+// 'small_vector' whose size is at most 'INLINE_CAPACITY' moves its elements
+// back into the inline buffer and releases the allocated array.
+//
+///Operations
+///----------
+// This section describes the run-time complexity of operations on instances
+// of 'small_vector':
+//..
+//  Legend
+//  ------
+//  'V'             - template parameter 'VALUE_TYPE' of 'small_vector'
+//  'N'             - template parameter 'INLINE_CAPACITY' of 'small_vector'
+//  'a', 'b'        - two distinct objects of type 'small_vector<V, N>'
+//  'n', 'm'        - number of elements in 'a' and 'b' respectively
+//  'k'             - non-negative integer
+//  'al             - an STL-style memory allocator
+//  'i1', 'i2'      - two iterators defining a sequence of 'V' objects
+//  'v'             - an object of type 'V'
+//  'p1', 'p2'      - two iterators belonging to 'a'
+//  distance(i1,i2) - the number of elements in the range [i1, i2)
+//
+//  +----------------------------------------------------+--------------------+
+//  | Operation                                          | Complexity         |
+//  +====================================================+====================+
+//  | small_vector<V, N> a;    (default construction)    | O[1]               |
+//  | small_vector<V, N> a(al);                          |                    |
+//  +----------------------------------------------------+--------------------+
+//  | small_vector<V, N> a(b); (copy construction)       | O[m]               |
+//  | small_vector<V, N> a(b, al);                       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | small_vector<V, N> a(k);                           | O[k]               |
+//  | small_vector<V, N> a(k, v);                        |                    |
+//  | small_vector<V, N> a(k, v, al);                    |                    |
+//  +----------------------------------------------------+--------------------+
+//  | small_vector<V, N> a(i1, i2);                      | O[distance(i1,i2)] |
+//  | small_vector<V, N> a(i1, i2, al);                  |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.~small_vector<V, N>(); (destruction)             | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a = b;                   (assignment)              | O[n + m]           |
+//  | a.assign(k, v), a.assign(i1, i2)                   |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a.begin(), a.end(), a.cbegin(), a.cend(),          | O[1]               |
+//  | a.rbegin(), a.rend(), a.crbegin(), a.crend()       |                    |
+//  +----------------------------------------------------+--------------------+
+//  | a == b, a != b                                     | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a < b, a <= b, a > b, a >= b                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.swap(b), swap(a,b)                               | O[1] if 'a' and    |
+//  |                                                    | 'b' use the same   |
+//  |                                                    | allocator and      |
+//  |                                                    | n > N and m > N,   |
+//  |                                                    | O[N] if they use   |
+//  |                                                    | the same allocator |
+//  |                                                    | otherwise, and     |
+//  |                                                    | O[n + m] otherwise |
+//  +----------------------------------------------------+--------------------+
+//  | a.size(), a.max_size(), a.capacity(), a.empty()    | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | get_allocator()                                    | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.reserve(k), a.shrink_to_fit()                    | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.resize(k), a.resize(k, v)                        | O[k]               |
+//  +----------------------------------------------------+--------------------+
+//  | a[k], a.at(k), a.front(), a.back(), a.data()       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.push_back(v)                                     | amortized O[1]     |
+//  +----------------------------------------------------+--------------------+
+//  | a.pop_back()                                       | O[1]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(p1, v), a.insert(p1, k, v),               | O[n + k] (resp.    |
+//  | a.insert(p1, i1, i2)                               | n + distance(i1,   |
+//  |                                                    | i2))               |
+//  +----------------------------------------------------+--------------------+
+//  | a.erase(p1), a.erase(p1, p2)                       | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//  | a.clear()                                          | O[n]               |
+//  +----------------------------------------------------+--------------------+
+//..
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Splitting Records Into Fields
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we parse a file of comma-separated records, and, for each record,
+// collect the offsets at which its fields begin.  Almost every record has
+// fewer than eight fields, but an occasional record has many more.
+//
+// First, we define a function that appends the offsets of the fields of a
+// record to a vector supplied by the caller:
+//..
+//  template <class VECTOR>
+//  void splitFields(VECTOR *offsets, const char *record)
+//      // Append to the specified 'offsets' the offset of each field of the
+//      // specified comma-separated 'record'.
+//  {
+//      offsets->push_back(0);
+//      for (int i = 0; record[i]; ++i) {
+//          if (',' == record[i]) {
+//              offsets->push_back(i + 1);
+//          }
+//      }
+//  }
+//..
+// Then, we split a typical record into a 'small_vector' that holds up to
+// eight offsets inline, and observe that no memory is allocated:
+//..
+//  bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+//
+//  typedef bsl::small_vector<int, 8> Offsets;
+//
+//  Offsets offsets(&oa);
+//  splitFields(&offsets, "IBM,N,100,127.5");
+//
+//  assert(4  == offsets.size());
+//  assert(6  == offsets[2]);
+//  assert(10 == offsets.back());
+//  assert(0  == oa.numBlocksTotal());
+//..
+// Next, we split a long record, and observe that the vector spills its
+// elements to memory supplied by its allocator:
+//..
+//  offsets.clear();
+//  splitFields(&offsets, "a,b,c,d,e,f,g,h,i,j");
+//
+//  assert(10 == offsets.size());
+//  assert(18 == offsets.back());
+//  assert(1  == oa.numBlocksInUse());
+//..
+// Now, we release that memory once we no longer need the long record, which
+// moves the offsets of a shorter record back into the inline buffer:
+//..
+//  offsets.resize(2);
+//  offsets.shrink_to_fit();
+//
+//  assert(8 == offsets.capacity());
+//  assert(0 == oa.numBlocksInUse());
+//..
+// Finally, we note that a 'bsl::vector' would have allocated memory for the
+// first record:
+//..
+//  bsl::vector<int> vectorOffsets(&oa);
+//  splitFields(&vectorOffsets, "IBM,N,100,127.5");
+//
+//  assert(0 < oa.numBlocksInUse());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ALLOCATOR
+#include <bslstl_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_ITERATOR
+#include <bslstl_iterator.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_ARRAYDESTRUCTIONPRIMITIVES
+#include <bslalg_arraydestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_ARRAYPRIMITIVES
+#include <bslalg_arrayprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_CONTAINERBASE
+#include <bslalg_containerbase.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_RANGECOMPARE
+#include <bslalg_rangecompare.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARDESTRUCTIONPRIMITIVES
+#include <bslalg_scalardestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_TYPETRAITHASSTLITERATORS
+#include <bslalg_typetraithasstliterators.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ASSERT
+#include <bslmf_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISCONVERTIBLE
+#include <bslmf_isconvertible.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_MATCHANYTYPE
+#include <bslmf_matchanytype.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_MATCHARITHMETICTYPE
+#include <bslmf_matcharithmetictype.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NIL
+#include <bslmf_nil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNEDBUFFER
+#include <bsls_alignedbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTFROMTYPE
+#include <bsls_alignmentfromtype.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_CSTDDEF
+#include <cstddef>
+#define INCLUDED_CSTDDEF
+#endif
+
+namespace bsl {
+
+                          // =======================
+                          // struct SmallVector_Util
+                          // =======================
+
+struct SmallVector_Util {
+    // This component-private 'struct' provides a namespace for the parts of
+    // the implementation of 'small_vector' that do not depend on its template
+    // parameters.
+
+    // CLASS METHODS
+    static std::size_t computeNewCapacity(std::size_t newLength,
+                                          std::size_t capacity,
+                                          std::size_t maxSize);
+        // Return a capacity at least the specified 'newLength' and at least
+        // the minimum of twice the specified 'capacity' and the specified
+        // 'maxSize'.  The behavior is undefined unless 'capacity < newLength'
+        // and 'newLength <= maxSize'.  Note that the returned value is always
+        // at most 'maxSize'.
+};
+
+                            // ==================
+                            // class small_vector
+                            // ==================
+
+template <class VALUE_TYPE,
+          std::size_t INLINE_CAPACITY,
+          class ALLOCATOR = allocator<VALUE_TYPE> >
+class small_vector : private BloombergLP::bslalg::ContainerBase<ALLOCATOR> {
+    // This class template provides an STL-compliant vector that holds up to
+    // the specified 'INLINE_CAPACITY' elements in a buffer embedded in the
+    // object, and holds its elements in an array supplied by its allocator
+    // once it grows beyond 'INLINE_CAPACITY' elements.  The behavior is
+    // undefined unless 'INLINE_CAPACITY' is positive.
+    //
+    // This class:
+    //: o supports a complete set of *value-semantic* operations
+    //:   o except for 'bdex' serialization
+    //: o is *exception-neutral*
+    //: o is *alias-safe*
+    //: o is 'const' *thread-safe*
+    // For terminology see {'bsldoc_glossary'}.
+
+    BSLMF_ASSERT(0 < INLINE_CAPACITY);
+
+    // PRIVATE TYPES
+    typedef BloombergLP::bslalg::ContainerBase<ALLOCATOR> Base;
+        // This typedef is an alias for the base class that holds the
+        // allocator of this vector.
+
+    typedef BloombergLP::bsls::AlignmentFromType<VALUE_TYPE> Alignment;
+        // This typedef is an alias for the type providing the alignment of
+        // 'VALUE_TYPE'.
+
+    typedef BloombergLP::bsls::AlignedBuffer<
+                        static_cast<int>(INLINE_CAPACITY * sizeof(VALUE_TYPE)),
+                        Alignment::VALUE>                         InlineBuffer;
+        // This typedef is an alias for the type of the buffer holding the
+        // elements of this vector while its size is at most
+        // 'INLINE_CAPACITY'.
+
+    class Guard {
+        // This class provides a proctor for deallocating an array of
+        // 'VALUE_TYPE' objects, to be used in the 'small_vector' constructors
+        // and in the methods that move the elements of a vector to a newly
+        // allocated array.
+
+        // DATA
+        VALUE_TYPE  *d_data_p;       // array to deallocate, or 0 if released
+        std::size_t  d_capacity;     // capacity of the array
+        Base        *d_container_p;  // container base supplying the allocator
+
+      public:
+        // CREATORS
+        Guard(VALUE_TYPE *data, std::size_t capacity, Base *container);
+            // Create a proctor for the specified 'data' array of the specified
+            // 'capacity', using the 'deallocateN' method of the specified
+            // 'container' to return 'data' to its allocator upon destruction,
+            // unless this proctor's 'release' is called prior.
+
+        ~Guard();
+            // Destroy this proctor, deallocating any data under management.
+
+        // MANIPULATORS
+        void release();
+            // Release the data from management by this proctor.
+    };
+
+  public:
+    // PUBLIC TYPES
+    typedef VALUE_TYPE                             value_type;
+    typedef ALLOCATOR                              allocator_type;
+    typedef VALUE_TYPE&                            reference;
+    typedef const VALUE_TYPE&                      const_reference;
+    typedef VALUE_TYPE                            *pointer;
+    typedef const VALUE_TYPE                      *const_pointer;
+    typedef VALUE_TYPE                            *iterator;
+    typedef const VALUE_TYPE                      *const_iterator;
+    typedef std::size_t                            size_type;
+    typedef std::ptrdiff_t                         difference_type;
+    typedef bsl::reverse_iterator<iterator>        reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>  const_reverse_iterator;
+
+  private:
+    // DATA
+    VALUE_TYPE   *d_dataBegin_p;   // first element
+    VALUE_TYPE   *d_dataEnd_p;     // one past the last element
+    size_type     d_capacity;      // capacity of the array holding elements
+    InlineBuffer  d_inlineBuffer;  // storage for up to 'INLINE_CAPACITY'
+                                   // elements
+
+    // PRIVATE MANIPULATORS
+    VALUE_TYPE *inlineData();
+        // Return the address of the first element of the inline buffer of
+        // this vector.
+
+    void privateDeallocate();
+        // Return the array holding the elements of this vector to the
+        // allocator of this vector, unless the elements are held in the inline
+        // buffer.  Note that this method neither destroys elements nor updates
+        // the data members of this vector.
+
+    void privateRelocate(size_type newCapacity);
+        // Move the elements of this vector to an array of the specified
+        // 'newCapacity', which is the inline buffer of this vector if
+        // 'newCapacity <= INLINE_CAPACITY', and is supplied by the allocator
+        // of this vector otherwise, and release the array previously holding
+        // the elements.  If an exception is thrown, this vector is left
+        // unchanged.  The behavior is undefined unless
+        // 'size() <= newCapacity', and the elements are held in the inline
+        // buffer only if 'INLINE_CAPACITY < newCapacity'.
+
+    void privateSwapInline(small_vector& other);
+        // Exchange the value of this vector with that of the specified 'other'
+        // vector, both of which hold their elements in their inline buffers.
+        // The behavior is undefined unless
+        // 'get_allocator() == other.get_allocator()'.
+
+    template <class INPUT_ITER>
+    void privateInsertDispatch(
+                             const_iterator                          position,
+                             INPUT_ITER                              count,
+                             INPUT_ITER                              value,
+                             BloombergLP::bslmf::MatchArithmeticType ,
+                             BloombergLP::bslmf::Nil                 );
+        // Match integral type for 'INPUT_ITER'.
+
+    template <class INPUT_ITER>
+    void privateInsertDispatch(const_iterator                    position,
+                               INPUT_ITER                        first,
+                               INPUT_ITER                        last,
+                               BloombergLP::bslmf::MatchAnyType  ,
+                               BloombergLP::bslmf::MatchAnyType  );
+        // Match non-integral type for 'INPUT_ITER'.
+
+    template <class INPUT_ITER>
+    void privateInsert(const_iterator                 position,
+                       INPUT_ITER                     first,
+                       INPUT_ITER                     last,
+                       const std::input_iterator_tag&);
+        // Specialized insertion for input iterators.
+
+    template <class FWD_ITER>
+    void privateInsert(const_iterator                   position,
+                       FWD_ITER                         first,
+                       FWD_ITER                         last,
+                       const std::forward_iterator_tag&);
+        // Specialized insertion for forward, bidirectional, and random-access
+        // iterators.
+
+    // PRIVATE ACCESSORS
+    const VALUE_TYPE *inlineData() const;
+        // Return the address of the first element of the inline buffer of
+        // this vector.
+
+  public:
+    // CREATORS
+    explicit small_vector(const ALLOCATOR& basicAllocator = ALLOCATOR());
+        // Create an empty vector.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is not supplied, a
+        // default-constructed object of the (template parameter) type
+        // 'ALLOCATOR' is used.  If the 'ALLOCATOR' is 'bsl::allocator' (the
+        // default), then 'basicAllocator', if supplied, shall be convertible
+        // to 'bslma::Allocator *'.  If the 'ALLOCATOR' is 'bsl::allocator'
+        // and 'basicAllocator' is not supplied, the currently installed
+        // default allocator will be used to supply memory.  Note that no
+        // memory is allocated.
+
+    explicit small_vector(size_type        initialSize,
+                          const ALLOCATOR& basicAllocator = ALLOCATOR());
+        // Create a vector of the specified 'initialSize' whose every element
+        // is a default-constructed object of the (template parameter) type
+        // 'VALUE_TYPE'.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is not supplied, a default-constructed
+        // object of the (template parameter) type 'ALLOCATOR' is used.  Throw
+        // 'std::length_error' if 'initialSize > max_size()'.
+
+    small_vector(size_type         initialSize,
+                 const VALUE_TYPE& value,
+                 const ALLOCATOR&  basicAllocator = ALLOCATOR());
+        // Create a vector of the specified 'initialSize' whose every element
+        // is a copy of the specified 'value'.  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'ALLOCATOR' is used.  Throw 'std::length_error' if
+        // 'initialSize > max_size()'.
+
+    template <class INPUT_ITER>
+    small_vector(INPUT_ITER       first,
+                 INPUT_ITER       last,
+                 const ALLOCATOR& basicAllocator = ALLOCATOR());
+        // Create a vector, and insert (in order) each 'value_type' object in
+        // the range starting at the specified 'first' element, and ending
+        // immediately before the specified 'last' element.  Optionally
+        // specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is not supplied, a default-constructed object of
+        // the (template parameter) type 'ALLOCATOR' is used.  The (template
+        // parameter) type 'INPUT_ITER' shall meet the requirements of an input
+        // iterator defined in the C++11 standard [24.2.3] providing access to
+        // values of a type convertible to 'value_type'.  The behavior is
+        // undefined unless 'first' and 'last' refer to a sequence of valid
+        // values where 'last' is at a position at or after 'first'.
+
+    small_vector(const small_vector& original);
+        // Create a vector having the same value as the specified 'original'.
+        // Use the allocator returned by 'bsl::allocator_traits<ALLOCATOR>::
+        // select_on_container_copy_construction(original.get_allocator())' to
+        // allocate memory.  If the (template parameter) type 'ALLOCATOR' is of
+        // type 'bsl::allocator' (the default), the currently installed default
+        // allocator will be used to supply memory.
+
+    small_vector(const small_vector& original,
+                 const ALLOCATOR&    basicAllocator);
+        // Create a vector having the same value as the specified 'original'
+        // that will use the specified 'basicAllocator' to supply memory.
+
+    ~small_vector();
+        // Destroy this vector.
+
+    // MANIPULATORS
+    small_vector& operator=(const small_vector& rhs);
+        // Assign to this object the value of the specified 'rhs' object, and
+        // return a reference providing modifiable access to this object.  Note
+        // that the allocator of this object is not changed.
+
+    template <class INPUT_ITER>
+    void assign(INPUT_ITER first, INPUT_ITER last);
+        // Assign to this object the value resulting from first clearing this
+        // vector and then inserting (in order) each 'value_type' object in the
+        // range starting at the specified 'first' element, and ending
+        // immediately before the specified 'last' element.  The behavior is
+        // undefined unless 'first' and 'last' refer to a sequence of valid
+        // values where 'last' is at a position at or after 'first', and the
+        // sequence does not refer to elements of this vector.
+
+    void assign(size_type numElements, const VALUE_TYPE& value);
+        // Assign to this object the value resulting from first clearing this
+        // vector and then inserting the specified 'numElements' copies of the
+        // specified 'value'.
+
+    iterator begin();
+        // Return an iterator providing modifiable access to the first element
+        // in this vector, or the past-the-end iterator if this vector is
+        // empty.
+
+    iterator end();
+        // Return the past-the-end iterator providing modifiable access to this
+        // vector.
+
+    reverse_iterator rbegin();
+        // Return a reverse iterator providing modifiable access to the last
+        // element in this vector, or the past-the-end reverse iterator if this
+        // vector is empty.
+
+    reverse_iterator rend();
+        // Return the past-the-end reverse iterator providing modifiable access
+        // to this vector.
+
+    void resize(size_type newSize);
+        // Change the size of this vector to the specified 'newSize'.  If
+        // 'newSize < size()', erase the elements at positions
+        // '[newSize, size())'; otherwise, append 'newSize - size()'
+        // default-constructed elements.  Throw 'std::length_error' if
+        // 'newSize > max_size()'.
+
+    void resize(size_type newSize, const VALUE_TYPE& value);
+        // Change the size of this vector to the specified 'newSize'.  If
+        // 'newSize < size()', erase the elements at positions
+        // '[newSize, size())'; otherwise, append 'newSize - size()' copies of
+        // the specified 'value'.  Throw 'std::length_error' if
+        // 'newSize > max_size()'.
+
+    void reserve(size_type newCapacity);
+        // Change the capacity of this vector to at least the specified
+        // 'newCapacity'.  If an exception is thrown, the value of this vector
+        // is unchanged.  Throw 'std::length_error' if
+        // 'newCapacity > max_size()'.  Note that the capacity of a vector is
+        // never less than 'INLINE_CAPACITY'.
+
+    void shrink_to_fit();
+        // Reduce the capacity of this vector to the greater of its size and
+        // 'INLINE_CAPACITY', moving the elements of this vector into its
+        // inline buffer if they fit, and releasing the allocated array
+        // previously holding them, if any.  If an exception is thrown, this
+        // vector is left unchanged.
+
+    reference operator[](size_type position);
+        // Return a reference providing modifiable access to the element at the
+        // specified 'position' in this vector.  The behavior is undefined
+        // unless 'position < size()'.
+
+    reference at(size_type position);
+        // Return a reference providing modifiable access to the element at the
+        // specified 'position' in this vector.  Throw 'std::out_of_range' if
+        // 'position >= size()'.
+
+    reference front();
+        // Return a reference providing modifiable access to the first element
+        // in this vector.  The behavior is undefined unless this vector is not
+        // empty.
+
+    reference back();
+        // Return a reference providing modifiable access to the last element
+        // in this vector.  The behavior is undefined unless this vector is not
+        // empty.
+
+    VALUE_TYPE *data();
+        // Return the address of the modifiable first element of this vector,
+        // which is the address of the inline buffer of this vector if its
+        // elements are held inline.
+
+    void push_back(const VALUE_TYPE& value);
+        // Append to the end of this vector a copy of the specified 'value'.
+        // If an exception is thrown, this vector is left unchanged.  Throw
+        // 'std::length_error' if 'size() == max_size()'.
+
+    void pop_back();
+        // Erase the last element from this vector.  The behavior is undefined
+        // if this vector is empty.
+
+    iterator insert(const_iterator position, const VALUE_TYPE& value);
+        // Insert a copy of the specified 'value' at the specified 'position'
+        // in this vector, and return an iterator referring to the newly
+        // inserted element.  If an exception is thrown (other than by the copy
+        // constructor or assignment operator of 'VALUE_TYPE'), this vector is
+        // left unchanged.  Throw 'std::length_error' if
+        // 'size() == max_size()'.  The behavior is undefined unless 'position'
+        // is an iterator in the range '[begin(), end()]' (both endpoints
+        // included).
+
+    void insert(const_iterator    position,
+                size_type         numElements,
+                const VALUE_TYPE& value);
+        // Insert the specified 'numElements' copies of the specified 'value'
+        // at the specified 'position' in this vector.  If an exception is
+        // thrown (other than by the copy constructor or assignment operator of
+        // 'VALUE_TYPE'), this vector is left unchanged.  Throw
+        // 'std::length_error' if 'size() + numElements > max_size()'.  The
+        // behavior is undefined unless 'position' is an iterator in the range
+        // '[begin(), end()]' (both endpoints included).
+
+    template <class INPUT_ITER>
+    void insert(const_iterator position, INPUT_ITER first, INPUT_ITER last);
+        // Insert (in order) each 'value_type' object in the range starting at
+        // the specified 'first' element, and ending immediately before the
+        // specified 'last' element, at the specified 'position' in this
+        // vector.  If an exception is thrown (other than by the copy
+        // constructor or assignment operator of 'VALUE_TYPE'), this vector is
+        // left unchanged.  Throw 'std::length_error' if the resulting size
+        // would exceed 'max_size()'.  The behavior is undefined unless
+        // 'position' is an iterator in the range '[begin(), end()]' (both
+        // endpoints included), 'first' and 'last' refer to a sequence of valid
+        // values where 'last' is at a position at or after 'first', and the
+        // sequence does not refer to elements of this vector.
+
+    iterator erase(const_iterator position);
+        // Remove from this vector the element at the specified 'position', and
+        // return an iterator providing modifiable access to the element
+        // immediately following the removed element, or to the position
+        // returned by the 'end' method if the removed element was the last in
+        // the sequence.  The behavior is undefined unless 'position' is an
+        // iterator in the range '[begin(), end())'.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Remove from this vector the sequence of elements starting at the
+        // specified 'first' position and ending before the specified 'last'
+        // position, and return an iterator providing modifiable access to the
+        // element immediately following the last removed element, or to the
+        // position returned by the 'end' method if the removed elements were
+        // last in the sequence.  The behavior is undefined unless 'first' and
+        // 'last' are iterators in the range '[begin(), end()]' (both endpoints
+        // included) and 'first <= last'.
+
+    void swap(small_vector& other);
+        // Exchange the value of this vector with that of the specified 'other'
+        // vector.  If this vector and 'other' use the same allocator and both
+        // hold their elements in allocated arrays, this method exchanges the
+        // arrays, takes constant time, and provides the no-throw guarantee;
+        // otherwise, the elements held in inline buffers are moved (or
+        // swapped), and, if the allocators differ, both vectors are copied.
+        // Note that moving an element that is not bitwise moveable copies it,
+        // and that the allocators of the vectors are not exchanged.
+
+    void clear();
+        // Remove all the elements from this vector.  Note that the capacity of
+        // this vector is unchanged.
+
+    // ACCESSORS
+    allocator_type get_allocator() const;
+        // Return (a copy of) the allocator used for memory allocation by this
+        // vector.
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator providing non-modifiable access to the first
+        // element in this vector, or the past-the-end iterator if this vector
+        // is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator providing non-modifiable access to
+        // this vector.
+
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator crbegin() const;
+        // Return a reverse iterator providing non-modifiable access to the
+        // last element in this vector, or the past-the-end reverse iterator if
+        // this vector is empty.
+
+    const_reverse_iterator rend() const;
+    const_reverse_iterator crend() const;
+        // Return the past-the-end reverse iterator providing non-modifiable
+        // access to this vector.
+
+    size_type size() const;
+        // Return the number of elements in this vector.
+
+    size_type max_size() const;
+        // Return a theoretical upper bound on the largest number of elements
+        // that this vector could possibly hold.
+
+    size_type capacity() const;
+        // Return the number of elements this vector can hold without
+        // allocating memory, which is 'INLINE_CAPACITY' if its elements are
+        // held in its inline buffer.
+
+    bool empty() const;
+        // Return 'true' if this vector has size 0, and 'false' otherwise.
+
+    const_reference operator[](size_type position) const;
+        // Return a reference providing non-modifiable access to the element at
+        // the specified 'position' in this vector.  The behavior is undefined
+        // unless 'position < size()'.
+
+    const_reference at(size_type position) const;
+        // Return a reference providing non-modifiable access to the element at
+        // the specified 'position' in this vector.  Throw 'std::out_of_range'
+        // if 'position >= size()'.
+
+    const_reference front() const;
+        // Return a reference providing non-modifiable access to the first
+        // element in this vector.  The behavior is undefined unless this
+        // vector is not empty.
+
+    const_reference back() const;
+        // Return a reference providing non-modifiable access to the last
+        // element in this vector.  The behavior is undefined unless this
+        // vector is not empty.
+
+    const VALUE_TYPE *data() const;
+        // Return the address of the non-modifiable first element of this
+        // vector, which is the address of the inline buffer of this vector if
+        // its elements are held inline.
+};
+
+// FREE OPERATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator==(
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'small_vector' objects have the same
+    // value if they have the same number of elements, and each element in the
+    // ordered sequence of elements of 'lhs' has the same value as the
+    // corresponding element in the ordered sequence of elements of 'rhs'.
+    // This method requires that the (template parameter) type 'VALUE_TYPE' be
+    // "equality-comparable" (see {Requirements on 'VALUE_TYPE'}).
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator!=(
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'small_vector' objects do not
+    // have the same value if they do not have the same number of elements, or
+    // some element in the ordered sequence of elements of 'lhs' does not have
+    // the same value as the corresponding element in the ordered sequence of
+    // elements of 'rhs'.
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator<(
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' vector is
+    // lexicographically less than that of the specified 'rhs' vector, and
+    // 'false' otherwise.  Given iterators 'i' and 'j' over the respective
+    // sequences '[lhs.begin(), lhs.end())' and '[rhs.begin(), rhs.end())',
+    // the value of vector 'lhs' is lexicographically less than that of vector
+    // 'rhs' if 'true == *i < *j' for the first pair of corresponding iterator
+    // positions where '*i < *j' and '*j < *i' are not both 'false'.  If no
+    // such corresponding iterator position exists, the value of 'lhs' is
+    // lexicographically less than that of 'rhs' if 'lhs.size() < rhs.size()'.
+    // This method requires that 'operator<', inducing a total order, be
+    // defined for 'value_type'.
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator>(
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' vector is
+    // lexicographically greater than that of the specified 'rhs' vector, and
+    // 'false' otherwise.  The value of vector 'lhs' is lexicographically
+    // greater than that of vector 'rhs' if 'rhs' is lexicographically less
+    // than 'lhs' (see 'operator<').  This method requires that 'operator<',
+    // inducing a total order, be defined for 'value_type'.
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator<=(
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' vector is
+    // lexicographically less than or equal to that of the specified 'rhs'
+    // vector, and 'false' otherwise.  The value of vector 'lhs' is
+    // lexicographically less than or equal to that of vector 'rhs' if 'rhs'
+    // is not lexicographically less than 'lhs' (see 'operator<').  This
+    // method requires that 'operator<', inducing a total order, be defined
+    // for 'value_type'.
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+bool operator>=(
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+              const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs);
+    // Return 'true' if the value of the specified 'lhs' vector is
+    // lexicographically greater than or equal to that of the specified 'rhs'
+    // vector, and 'false' otherwise.  The value of vector 'lhs' is
+    // lexicographically greater than or equal to that of vector 'rhs' if
+    // 'lhs' is not lexicographically less than 'rhs' (see 'operator<').  This
+    // method requires that 'operator<', inducing a total order, be defined
+    // for 'value_type'.
+
+// FREE FUNCTIONS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void swap(small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& a,
+          small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& b);
+    // Exchange the values of the specified 'a' and 'b' objects.  This method
+    // provides the no-throw exception-safety guarantee if 'a' and 'b' use the
+    // same allocator and both hold their elements in allocated arrays (see
+    // 'small_vector::swap').
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                  // ------------------------------------------
+                  // class small_vector<VALUE_TYPE, ...>::Guard
+                  // ------------------------------------------
+
+// CREATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::Guard::Guard(
+                                                   VALUE_TYPE  *data,
+                                                   std::size_t  capacity,
+                                                   Base        *container)
+: d_data_p(data)
+, d_capacity(capacity)
+, d_container_p(container)
+{
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::Guard::~Guard()
+{
+    if (d_data_p) {
+        d_container_p->deallocateN(d_data_p, d_capacity);
+    }
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::Guard::release()
+{
+    d_data_p = 0;
+}
+
+                            // ------------------
+                            // class small_vector
+                            // ------------------
+
+// PRIVATE MANIPULATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+VALUE_TYPE *small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::inlineData()
+{
+    return reinterpret_cast<VALUE_TYPE *>(d_inlineBuffer.buffer());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateDeallocate()
+{
+    if (d_dataBegin_p != inlineData()) {
+        this->deallocateN(d_dataBegin_p, d_capacity);
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateRelocate(
+                                                         size_type newCapacity)
+{
+    BSLS_ASSERT_SAFE(size() <= newCapacity);
+
+    const size_type numElements = size();
+
+    VALUE_TYPE *newData;
+    if (newCapacity <= INLINE_CAPACITY) {
+        BSLS_ASSERT_SAFE(d_dataBegin_p != inlineData());
+
+        newData     = inlineData();
+        newCapacity = INLINE_CAPACITY;
+    }
+    else {
+        newData = this->allocateN((VALUE_TYPE *) 0, newCapacity);
+    }
+
+    Guard guard(newData == inlineData() ? 0 : newData,
+                newCapacity,
+                static_cast<Base *>(this));
+
+    BloombergLP::bslalg::ArrayPrimitives::destructiveMove(
+                                                       newData,
+                                                       d_dataBegin_p,
+                                                       d_dataEnd_p,
+                                                       this->bslmaAllocator());
+    guard.release();
+
+    privateDeallocate();
+    d_dataBegin_p = newData;
+    d_dataEnd_p   = newData + numElements;
+    d_capacity    = newCapacity;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateSwapInline(
+                                                           small_vector& other)
+{
+    BSLS_ASSERT_SAFE(d_dataBegin_p       == inlineData());
+    BSLS_ASSERT_SAFE(other.d_dataBegin_p == other.inlineData());
+
+    small_vector& shorter = size() <= other.size() ? *this : other;
+    small_vector& longer  = size() <= other.size() ? other : *this;
+
+    const size_type numCommon = shorter.size();
+    for (size_type i = 0; i < numCommon; ++i) {
+        BloombergLP::bslalg::SwapUtil::swap(shorter.d_dataBegin_p + i,
+                                            longer.d_dataBegin_p + i);
+    }
+
+    // Move the elements of 'longer' having no counterpart in 'shorter' to
+    // the end of 'shorter'.  Note that the allocators of the two vectors are
+    // the same, so moving an element has the same effect as copying it.
+
+    VALUE_TYPE *tail = longer.d_dataBegin_p + numCommon;
+    BloombergLP::bslalg::ArrayPrimitives::destructiveMove(
+                                                     shorter.d_dataEnd_p,
+                                                     tail,
+                                                     longer.d_dataEnd_p,
+                                                     shorter.bslmaAllocator());
+    shorter.d_dataEnd_p += longer.d_dataEnd_p - tail;
+    longer.d_dataEnd_p   = tail;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::
+privateInsertDispatch(const_iterator                          position,
+                      INPUT_ITER                              count,
+                      INPUT_ITER                              value,
+                      BloombergLP::bslmf::MatchArithmeticType ,
+                      BloombergLP::bslmf::Nil                 )
+{
+    // 'count' and 'value' are integral types that just happen to be the same.
+    // They are not iterators, so we call 'insert(position, count, value)'.
+
+    this->insert(position,
+                 static_cast<size_type>(count),
+                 static_cast<VALUE_TYPE>(value));
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::
+privateInsertDispatch(const_iterator                   position,
+                      INPUT_ITER                       first,
+                      INPUT_ITER                       last,
+                      BloombergLP::bslmf::MatchAnyType ,
+                      BloombergLP::bslmf::MatchAnyType )
+{
+    // Dispatch based on iterator category.
+
+    typedef typename bsl::iterator_traits<INPUT_ITER>::iterator_category Tag;
+    this->privateInsert(position, first, last, Tag());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateInsert(
+                                      const_iterator                  position,
+                                      INPUT_ITER                      first,
+                                      INPUT_ITER                      last,
+                                      const std::input_iterator_tag&)
+{
+    // IMPLEMENTATION NOTES: We can't compute size in advance, so we collect
+    // the elements in a temporary vector using the same allocator (which
+    // also guarantees that if the allocator throws, then this vector is
+    // unchanged), and then insert them.
+
+    if (first == last) {
+        return;                                                       // RETURN
+    }
+
+    small_vector temp(this->allocator());
+    while (first != last) {
+        temp.push_back(*first);
+        ++first;
+    }
+
+    if (empty() && temp.d_dataBegin_p != temp.inlineData()) {
+        // Optimization: no need to copy the elements into an empty vector if
+        // they are held in an allocated array, just swap.
+
+        swap(temp);
+        return;                                                       // RETURN
+    }
+
+    privateInsert(position,
+                  temp.d_dataBegin_p,
+                  temp.d_dataEnd_p,
+                  std::forward_iterator_tag());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class FWD_ITER>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::privateInsert(
+                                    const_iterator                    position,
+                                    FWD_ITER                          first,
+                                    FWD_ITER                          last,
+                                    const std::forward_iterator_tag&)
+{
+    VALUE_TYPE *pos = const_cast<VALUE_TYPE *>(position);
+
+    const size_type maxSize = max_size();
+    const size_type n = bsl::distance(first, last);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(n > maxSize - size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                 "small_vector<...>::insert(pos,first,last): vector too long");
+    }
+
+    const size_type newSize = size() + n;
+    if (newSize > d_capacity) {
+        const size_type newCapacity = SmallVector_Util::computeNewCapacity(
+                                                                   newSize,
+                                                                   d_capacity,
+                                                                   maxSize);
+        VALUE_TYPE *newData = this->allocateN((VALUE_TYPE *) 0, newCapacity);
+        Guard guard(newData, newCapacity, static_cast<Base *>(this));
+
+        BloombergLP::bslalg::ArrayPrimitives::destructiveMoveAndInsert(
+                                                       newData,
+                                                       &d_dataEnd_p,
+                                                       d_dataBegin_p,
+                                                       pos,
+                                                       d_dataEnd_p,
+                                                       first,
+                                                       last,
+                                                       n,
+                                                       this->bslmaAllocator());
+        guard.release();
+
+        privateDeallocate();
+        d_dataBegin_p = newData;
+        d_dataEnd_p   = newData + newSize;
+        d_capacity    = newCapacity;
+    }
+    else {
+        BloombergLP::bslalg::ArrayPrimitives::insert(pos,
+                                                     d_dataEnd_p,
+                                                     first,
+                                                     last,
+                                                     n,
+                                                     this->bslmaAllocator());
+        d_dataEnd_p += n;
+    }
+}
+
+// PRIVATE ACCESSORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+const VALUE_TYPE *
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::inlineData() const
+{
+    return reinterpret_cast<const VALUE_TYPE *>(d_inlineBuffer.buffer());
+}
+
+// CREATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                                               const ALLOCATOR& basicAllocator)
+: Base(basicAllocator)
+, d_capacity(INLINE_CAPACITY)
+{
+    d_dataBegin_p = d_dataEnd_p = inlineData();
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                                               size_type        initialSize,
+                                               const ALLOCATOR& basicAllocator)
+: Base(basicAllocator)
+, d_capacity(INLINE_CAPACITY)
+{
+    d_dataBegin_p = d_dataEnd_p = inlineData();
+    resize(initialSize);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                                              size_type         initialSize,
+                                              const VALUE_TYPE& value,
+                                              const ALLOCATOR&  basicAllocator)
+: Base(basicAllocator)
+, d_capacity(INLINE_CAPACITY)
+{
+    d_dataBegin_p = d_dataEnd_p = inlineData();
+    insert(d_dataEnd_p, initialSize, value);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                                               INPUT_ITER       first,
+                                               INPUT_ITER       last,
+                                               const ALLOCATOR& basicAllocator)
+: Base(basicAllocator)
+, d_capacity(INLINE_CAPACITY)
+{
+    d_dataBegin_p = d_dataEnd_p = inlineData();
+    insert(d_dataEnd_p, first, last);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                                                 const small_vector& original)
+: Base(original)
+, d_capacity(INLINE_CAPACITY)
+{
+    d_dataBegin_p = d_dataEnd_p = inlineData();
+    privateInsert(d_dataEnd_p,
+                  original.begin(),
+                  original.end(),
+                  std::forward_iterator_tag());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::small_vector(
+                                            const small_vector& original,
+                                            const ALLOCATOR&    basicAllocator)
+: Base(basicAllocator)
+, d_capacity(INLINE_CAPACITY)
+{
+    d_dataBegin_p = d_dataEnd_p = inlineData();
+    privateInsert(d_dataEnd_p,
+                  original.begin(),
+                  original.end(),
+                  std::forward_iterator_tag());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::~small_vector()
+{
+    BloombergLP::bslalg::ArrayDestructionPrimitives::destroy(d_dataBegin_p,
+                                                             d_dataEnd_p);
+    privateDeallocate();
+}
+
+// MANIPULATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>&
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::operator=(
+                                                       const small_vector& rhs)
+{
+    if (this != &rhs) {
+        clear();
+        privateInsert(d_dataEnd_p,
+                      rhs.begin(),
+                      rhs.end(),
+                      std::forward_iterator_tag());
+    }
+    return *this;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::assign(
+                                                              INPUT_ITER first,
+                                                              INPUT_ITER last)
+{
+    clear();
+    insert(d_dataEnd_p, first, last);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::assign(
+                                                 size_type         numElements,
+                                                 const VALUE_TYPE& value)
+{
+    clear();
+    insert(d_dataEnd_p, numElements, value);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::begin()
+{
+    return d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::end()
+{
+    return d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::resize(
+                                                             size_type newSize)
+{
+    if (newSize <= size()) {
+        BloombergLP::bslalg::ArrayDestructionPrimitives::destroy(
+                                                      d_dataBegin_p + newSize,
+                                                      d_dataEnd_p);
+        d_dataEnd_p = d_dataBegin_p + newSize;
+    }
+    else {
+        if (newSize > d_capacity) {
+            reserve(newSize);
+        }
+        BloombergLP::bslalg::ArrayPrimitives::defaultConstruct(
+                                                       d_dataEnd_p,
+                                                       newSize - size(),
+                                                       this->bslmaAllocator());
+        d_dataEnd_p = d_dataBegin_p + newSize;
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::resize(
+                                                     size_type         newSize,
+                                                     const VALUE_TYPE& value)
+{
+    if (newSize <= size()) {
+        BloombergLP::bslalg::ArrayDestructionPrimitives::destroy(
+                                                      d_dataBegin_p + newSize,
+                                                      d_dataEnd_p);
+        d_dataEnd_p = d_dataBegin_p + newSize;
+    }
+    else {
+        insert(d_dataEnd_p, newSize - size(), value);
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reserve(
+                                                         size_type newCapacity)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(newCapacity > max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                   "small_vector<...>::reserve(newCapacity): vector too long");
+    }
+    if (d_capacity < newCapacity) {
+        privateRelocate(newCapacity);
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::shrink_to_fit()
+{
+    if (size() < d_capacity && d_dataBegin_p != inlineData()) {
+        privateRelocate(size());
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::operator[](
+                                                            size_type position)
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::at(size_type position)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                          "small_vector<...>::at(position): invalid position");
+    }
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::front()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_dataEnd_p - 1);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+VALUE_TYPE *small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::data()
+{
+    return d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::push_back(
+                                                       const VALUE_TYPE& value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_capacity > size())) {
+        BloombergLP::bslalg::ScalarPrimitives::copyConstruct(
+                                                       d_dataEnd_p,
+                                                       value,
+                                                       this->bslmaAllocator());
+        ++d_dataEnd_p;
+    }
+    else {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        insert(d_dataEnd_p, size_type(1), value);
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::pop_back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    BloombergLP::bslalg::ScalarDestructionPrimitives::destroy(--d_dataEnd_p);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::insert(
+                                                  const_iterator    position,
+                                                  const VALUE_TYPE& value)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position <= end());
+
+    const size_type index = position - begin();
+    insert(position, size_type(1), value);
+    return begin() + index;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::insert(
+                                                 const_iterator    position,
+                                                 size_type         numElements,
+                                                 const VALUE_TYPE& value)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position <= end());
+
+    VALUE_TYPE *pos = const_cast<VALUE_TYPE *>(position);
+
+    const size_type maxSize = max_size();
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                            numElements > maxSize - size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                        "small_vector<...>::insert(pos,n,v): vector too long");
+    }
+
+    const size_type newSize = size() + numElements;
+    if (newSize > d_capacity) {
+        const size_type newCapacity = SmallVector_Util::computeNewCapacity(
+                                                                   newSize,
+                                                                   d_capacity,
+                                                                   maxSize);
+        VALUE_TYPE *newData = this->allocateN((VALUE_TYPE *) 0, newCapacity);
+        Guard guard(newData, newCapacity, static_cast<Base *>(this));
+
+        BloombergLP::bslalg::ArrayPrimitives::destructiveMoveAndInsert(
+                                                       newData,
+                                                       &d_dataEnd_p,
+                                                       d_dataBegin_p,
+                                                       pos,
+                                                       d_dataEnd_p,
+                                                       value,
+                                                       numElements,
+                                                       this->bslmaAllocator());
+        guard.release();
+
+        privateDeallocate();
+        d_dataBegin_p = newData;
+        d_dataEnd_p   = newData + newSize;
+        d_capacity    = newCapacity;
+    }
+    else {
+        BloombergLP::bslalg::ArrayPrimitives::insert(pos,
+                                                     d_dataEnd_p,
+                                                     value,
+                                                     numElements,
+                                                     this->bslmaAllocator());
+        d_dataEnd_p += numElements;
+    }
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+template <class INPUT_ITER>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::insert(
+                                                       const_iterator position,
+                                                       INPUT_ITER     first,
+                                                       INPUT_ITER     last)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position <= end());
+
+    // If 'first' and 'last' are integral, then they are not iterators and we
+    // should call 'insert(position, first, last)', where 'first' is actually a
+    // misnamed count, and 'last' is a misnamed value (see 'bslstl_vector').
+
+    privateInsertDispatch(position,
+                          first,
+                          last,
+                          first,
+                          BloombergLP::bslmf::Nil());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::erase(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT_SAFE(begin() <= position);
+    BSLS_ASSERT_SAFE(position < end());
+
+    return erase(position, position + 1);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::erase(
+                                                          const_iterator first,
+                                                          const_iterator last)
+{
+    BSLS_ASSERT_SAFE(begin() <= first);
+    BSLS_ASSERT_SAFE(first <= end());
+    BSLS_ASSERT_SAFE(first <= last);
+    BSLS_ASSERT_SAFE(last <= end());
+
+    const size_type n = last - first;
+    BloombergLP::bslalg::ArrayPrimitives::erase(
+                                               const_cast<VALUE_TYPE *>(first),
+                                               const_cast<VALUE_TYPE *>(last),
+                                               d_dataEnd_p,
+                                               this->bslmaAllocator());
+    d_dataEnd_p -= n;
+    return const_cast<VALUE_TYPE *>(first);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::swap(
+                                                           small_vector& other)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                  this->allocator() != other.allocator())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        small_vector v1(other, this->allocator());
+        small_vector v2(*this, other.allocator());
+
+        v1.swap(*this);
+        v2.swap(other);
+        return;                                                       // RETURN
+    }
+
+    const bool isInline      = d_dataBegin_p       == inlineData();
+    const bool isOtherInline = other.d_dataBegin_p == other.inlineData();
+
+    if (isInline && isOtherInline) {
+        privateSwapInline(other);
+        return;                                                       // RETURN
+    }
+
+    if (isInline || isOtherInline) {
+        // Move the elements of the vector holding them inline into the
+        // (unused) inline buffer of the vector holding its elements in an
+        // allocated array, and hand the allocated array over.
+
+        small_vector& allocated = isInline ? other : *this;
+        small_vector& embedded  = isInline ? *this : other;
+
+        VALUE_TYPE      *buffer      = allocated.inlineData();
+        const size_type  numElements = embedded.size();
+
+        BloombergLP::bslalg::ArrayPrimitives::destructiveMove(
+                                                 buffer,
+                                                 embedded.d_dataBegin_p,
+                                                 embedded.d_dataEnd_p,
+                                                 allocated.bslmaAllocator());
+
+        embedded.d_dataBegin_p  = allocated.d_dataBegin_p;
+        embedded.d_dataEnd_p    = allocated.d_dataEnd_p;
+        embedded.d_capacity     = allocated.d_capacity;
+        allocated.d_dataBegin_p = buffer;
+        allocated.d_dataEnd_p   = buffer + numElements;
+        allocated.d_capacity    = INLINE_CAPACITY;
+        return;                                                       // RETURN
+    }
+
+    BloombergLP::bslalg::SwapUtil::swap(&d_dataBegin_p, &other.d_dataBegin_p);
+    BloombergLP::bslalg::SwapUtil::swap(&d_dataEnd_p,   &other.d_dataEnd_p);
+    BloombergLP::bslalg::SwapUtil::swap(&d_capacity,    &other.d_capacity);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::clear()
+{
+    BloombergLP::bslalg::ArrayDestructionPrimitives::destroy(d_dataBegin_p,
+                                                             d_dataEnd_p);
+    d_dataEnd_p = d_dataBegin_p;
+}
+
+// ACCESSORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::allocator_type
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::get_allocator() const
+{
+    return this->allocator();
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::begin() const
+{
+    return d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::cbegin() const
+{
+    return d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::end() const
+{
+    return d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::cend() const
+{
+    return d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE,
+                      INLINE_CAPACITY,
+                      ALLOCATOR>::const_reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE,
+                      INLINE_CAPACITY,
+                      ALLOCATOR>::const_reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::crbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE,
+                      INLINE_CAPACITY,
+                      ALLOCATOR>::const_reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE,
+                      INLINE_CAPACITY,
+                      ALLOCATOR>::const_reverse_iterator
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::crend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::size() const
+{
+    return d_dataEnd_p - d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::max_size() const
+{
+    return this->allocator().max_size();
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::size_type
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::capacity() const
+{
+    return d_capacity;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::empty() const
+{
+    return d_dataBegin_p == d_dataEnd_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::operator[](
+                                                      size_type position) const
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::at(
+                                                      size_type position) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                    "const small_vector<...>::at(position): invalid position");
+    }
+    return d_dataBegin_p[position];
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::front() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_dataBegin_p;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+typename small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::const_reference
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::back() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *(d_dataEnd_p - 1);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+const VALUE_TYPE *
+small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>::data() const
+{
+    return d_dataBegin_p;
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator==(
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator<(
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator>(
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& lhs,
+               const small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+inline
+void bsl::swap(small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& a,
+               small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR>& b)
+{
+    a.swap(b);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for STL *sequence* containers:
+//: o A sequence container defines STL iterators.
+//: o A sequence container uses 'bslma' allocators if the parameterized
+//:     'ALLOCATOR' is convertible from 'bslma::Allocator*'.
+//
+// Note that, unlike 'bsl::vector', 'small_vector' is not bitwise moveable,
+// since it may refer to its own inline buffer.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+struct HasStlIterators<
+                    bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR> >
+    : bsl::true_type
+{};
+
+}  // close package namespace
+
+namespace bslma {
+
+template <class VALUE_TYPE, std::size_t INLINE_CAPACITY, class ALLOCATOR>
+struct UsesBslmaAllocator<
+                    bsl::small_vector<VALUE_TYPE, INLINE_CAPACITY, ALLOCATOR> >
+    : bsl::is_convertible<Allocator*, ALLOCATOR>
+{};
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
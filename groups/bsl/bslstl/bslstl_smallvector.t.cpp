@@ -0,0 +1,1470 @@
+// bslstl_smallvector.t.cpp                                          -*-C++-*-
+#include <bslstl_smallvector.h>
+
+#include <bslstl_allocator.h>
+#include <bslstl_iterator.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_issame.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_types.h>
+
+#include <bsltf_alloctesttype.h>
+
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a container class template,
+// 'bsl::small_vector', that holds up to 'INLINE_CAPACITY' elements in a
+// buffer embedded in the object, and moves its elements to an array supplied
+// by its allocator when it grows beyond that.  Elements are constructed,
+// moved, and destroyed by 'bslalg::ArrayPrimitives', which is tested by its
+// own test driver.  This test driver therefore concentrates on the
+// transitions between the inline buffer and allocated arrays in every
+// manipulator, on allocating no memory while the elements fit inline, on the
+// allocator propagation expected of a BDE container (matching
+// 'bsl::vector'), and on exception safety.
+//
+// Each case is run for 'int' elements (bitwise moveable) and for
+// 'bsltf::AllocTestType' elements (allocating memory, and not bitwise
+// moveable), with inline capacities of 1 and 4.  The value of a vector is
+// verified against a reference 'std::vector<int>'.
+//
+// Global Concerns:
+//: o No memory is allocated while the elements fit in the inline buffer.
+//: o All memory is supplied by the allocator passed at construction.
+//: o No memory is leaked.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] small_vector(const A& allocator = A());
+// [ 4] small_vector(size_type initialSize, const A& allocator = A());
+// [ 4] small_vector(size_type n, const V& value, const A& allocator = A());
+// [ 4] small_vector(ITER first, ITER last, const A& allocator = A());
+// [ 3] small_vector(const small_vector& original);
+// [ 3] small_vector(const small_vector& original, const A& allocator);
+// [ 2] ~small_vector();
+//
+// MANIPULATORS
+// [ 3] small_vector& operator=(const small_vector& rhs);
+// [ 4] void assign(INPUT_ITER first, INPUT_ITER last);
+// [ 4] void assign(size_type numElements, const VALUE_TYPE& value);
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 2] reverse_iterator rbegin();
+// [ 2] reverse_iterator rend();
+// [ 4] void resize(size_type newSize);
+// [ 4] void resize(size_type newSize, const VALUE_TYPE& value);
+// [ 5] void reserve(size_type newCapacity);
+// [ 5] void shrink_to_fit();
+// [ 5] reference operator[](size_type position);
+// [ 5] reference at(size_type position);
+// [ 5] reference front();
+// [ 5] reference back();
+// [ 5] VALUE_TYPE *data();
+// [ 2] void push_back(const VALUE_TYPE& value);
+// [ 2] void pop_back();
+// [ 4] iterator insert(const_iterator position, const VALUE_TYPE& value);
+// [ 4] void insert(const_iterator position, size_type n, const V& value);
+// [ 4] void insert(const_iterator position, ITER first, ITER last);
+// [ 4] iterator erase(const_iterator position);
+// [ 4] iterator erase(const_iterator first, const_iterator last);
+// [ 3] void swap(small_vector& other);
+// [ 2] void clear();
+//
+// ACCESSORS
+// [ 2] allocator_type get_allocator() const;
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_reverse_iterator rbegin() const;
+// [ 2] const_reverse_iterator rend() const;
+// [ 2] const_iterator cbegin() const;
+// [ 2] const_iterator cend() const;
+// [ 2] const_reverse_iterator crbegin() const;
+// [ 2] const_reverse_iterator crend() const;
+// [ 2] size_type size() const;
+// [ 2] size_type max_size() const;
+// [ 2] size_type capacity() const;
+// [ 2] bool empty() const;
+// [ 5] const_reference operator[](size_type position) const;
+// [ 5] const_reference at(size_type position) const;
+// [ 5] const_reference front() const;
+// [ 5] const_reference back() const;
+// [ 5] const VALUE_TYPE *data() const;
+//
+// FREE OPERATORS
+// [ 6] bool operator==(const small_vector& lhs, const small_vector& rhs);
+// [ 6] bool operator!=(const small_vector& lhs, const small_vector& rhs);
+// [ 6] bool operator< (const small_vector& lhs, const small_vector& rhs);
+// [ 6] bool operator> (const small_vector& lhs, const small_vector& rhs);
+// [ 6] bool operator<=(const small_vector& lhs, const small_vector& rhs);
+// [ 6] bool operator>=(const small_vector& lhs, const small_vector& rhs);
+// [ 3] void swap(small_vector& a, small_vector& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] CONCERN: The type has the expected type traits.
+// [ 2] CONCERN: No memory is allocated until the inline buffer is full.
+// [ 3] CONCERN: 'swap' moves elements between inline buffers correctly.
+// [ 4] CONCERN: Appending provides the strong exception-safety guarantee.
+// [ 5] CONCERN: 'shrink_to_fit' moves the elements back inline.
+// [ 7] USAGE EXAMPLE
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bsls::Types::Int64   Int64;
+typedef bsltf::AllocTestType AllocType;
+typedef std::vector<int>     Reference;
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+namespace BloombergLP {
+namespace bsltf {
+
+bool operator<(const AllocTestType& lhs, const AllocTestType& rhs)
+    // Return 'true' if the specified 'lhs' is ordered before the specified
+    // 'rhs', and 'false' otherwise.  Note that this operator is required to
+    // test the relational operators on vectors of 'AllocTestType'.
+{
+    return lhs.data() < rhs.data();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+template <class VALUE>
+struct ValueUtil;
+    // This 'struct' provides, for each element type used by this test
+    // driver, a class method 'create' returning an element having a specified
+    // integer value, and a class method 'toInt' returning the integer value
+    // of an element.
+
+template <>
+struct ValueUtil<int> {
+    static int create(int value, bslma::Allocator *)
+    {
+        return value;
+    }
+
+    static int toInt(int value)
+    {
+        return value;
+    }
+};
+
+template <>
+struct ValueUtil<AllocType> {
+    static AllocType create(int value, bslma::Allocator *basicAllocator)
+    {
+        return AllocType(value, basicAllocator);
+    }
+
+    static int toInt(const AllocType& value)
+    {
+        return value.data();
+    }
+};
+
+static const int SIZES[] = { 0, 1, 2, 3, 4, 5, 8, 9, 17, 100 };
+static const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+//=============================================================================
+//                              USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+template <class VECTOR>
+void splitFields(VECTOR *offsets, const char *record)
+    // Append to the specified 'offsets' the offset of each field of the
+    // specified comma-separated 'record'.
+{
+    offsets->push_back(0);
+    for (int i = 0; record[i]; ++i) {
+        if (',' == record[i]) {
+            offsets->push_back(i + 1);
+        }
+    }
+}
+
+//=============================================================================
+//                       TEST DRIVER TEMPLATE
+//-----------------------------------------------------------------------------
+
+template <class VALUE, std::size_t INLINE_CAPACITY>
+struct TestDriver {
+    // This templatized struct provides a namespace for testing the
+    // 'small_vector' container holding elements of the (template parameter)
+    // 'VALUE' type, with the (template parameter) 'INLINE_CAPACITY'.
+
+    // TYPES
+    typedef bsl::small_vector<VALUE, INLINE_CAPACITY> Obj;
+    typedef typename Obj::iterator                    Iterator;
+    typedef typename Obj::const_iterator              ConstIterator;
+    typedef typename Obj::allocator_type              Allocator;
+    typedef ValueUtil<VALUE>                          Util;
+
+    enum { k_INLINE = INLINE_CAPACITY };
+
+    // CLASS METHODS
+    static bool verify(const Obj& object, const Reference& reference)
+        // Return 'true' if the specified 'object' holds the same sequence of
+        // elements as the specified 'reference', iterating in both
+        // directions, and 'false' otherwise.
+    {
+        if (object.size() != reference.size()) {
+            return false;                                             // RETURN
+        }
+        ConstIterator             it  = object.begin();
+        Reference::const_iterator rit = reference.begin();
+        for (; it != object.end(); ++it, ++rit) {
+            if (Util::toInt(*it) != *rit) {
+                return false;                                         // RETURN
+            }
+        }
+        typename Obj::const_reverse_iterator rev  = object.rbegin();
+        Reference::const_reverse_iterator    rrev = reference.rbegin();
+        for (; rev != object.rend(); ++rev, ++rrev) {
+            if (Util::toInt(*rev) != *rrev) {
+                return false;                                         // RETURN
+            }
+        }
+        return true;
+    }
+
+    static bool isInline(const Obj& object)
+        // Return 'true' if the specified 'object' holds its elements in its
+        // inline buffer, and 'false' otherwise.
+    {
+        const char *data = reinterpret_cast<const char *>(object.data());
+        const char *self = reinterpret_cast<const char *>(&object);
+        return self <= data && data < self + sizeof object;
+    }
+
+    static void fill(Obj              *object,
+                     Reference        *reference,
+                     int               length,
+                     int               firstValue,
+                     bslma::Allocator *scratch)
+        // Append to the specified 'object' and 'reference' the specified
+        // 'length' consecutive values starting at the specified 'firstValue',
+        // using the specified 'scratch' allocator for temporaries.
+    {
+        for (int i = 0; i < length; ++i) {
+            object->push_back(Util::create(firstValue + i, scratch));
+            reference->push_back(firstValue + i);
+        }
+    }
+
+    // TEST CASES
+    static void testCase2();
+        // Test primary manipulators and basic accessors.
+
+    static void testCase3();
+        // Test copy construction, assignment and 'swap'.
+
+    static void testCase4();
+        // Test value constructors, insertion and removal.
+
+    static void testCase5();
+        // Test capacity and element access.
+
+    static void testCase6();
+        // Test comparison operators.
+};
+
+template <class VALUE, std::size_t INLINE_CAPACITY>
+void TestDriver<VALUE, INLINE_CAPACITY>::testCase2()
+{
+    // ------------------------------------------------------------------------
+    // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+    //
+    // Concerns:
+    //: 1 A default-constructed vector is empty, has capacity
+    //:   'INLINE_CAPACITY', allocates no memory, and uses the supplied
+    //:   allocator, or the default allocator if none is supplied.
+    //:
+    //: 2 'push_back' appends the value, holding the elements inline, without
+    //:   allocating memory, until the size exceeds 'INLINE_CAPACITY', and
+    //:   then moves them to a single allocated array that grows
+    //:   geometrically.
+    //:
+    //: 3 'pop_back' removes the last element.
+    //:
+    //: 4 Forward and reverse iteration visit the elements in order.
+    //:
+    //: 5 'clear' removes every element, retaining the capacity.
+    //:
+    //: 6 The type has the 'HasStlIterators' and 'UsesBslmaAllocator' traits,
+    //:   and not the 'IsBitwiseMoveable' trait.
+    //:
+    //: 7 All memory comes from the object allocator, and none is leaked.
+    //
+    // Plan:
+    //: 1 Construct vectors using each constructor, and verify the allocator,
+    //:   that the vector is empty, and that no memory is allocated.  (C-1)
+    //:
+    //: 2 For each of several lengths, append values to a vector and to a
+    //:   reference 'std::vector', and verify the value of the vector in both
+    //:   directions, whether its elements are inline, and the number of
+    //:   blocks allocated, after each append.  (C-2, 4, 7)
+    //:
+    //: 3 Remove the elements with 'pop_back', verifying the value.  (C-3)
+    //:
+    //: 4 Clear the vector and verify that it is empty and retains its
+    //:   capacity.  (C-5)
+    //:
+    //: 5 Verify the traits.  (C-6)
+    //
+    // Testing:
+    //   small_vector(const A& allocator = A());
+    //   ~small_vector();
+    //   iterator begin();
+    //   iterator end();
+    //   reverse_iterator rbegin();
+    //   reverse_iterator rend();
+    //   void push_back(const VALUE_TYPE& value);
+    //   void pop_back();
+    //   void clear();
+    //   allocator_type get_allocator() const;
+    //   const_iterator begin() const;
+    //   const_iterator end() const;
+    //   const_reverse_iterator rbegin() const;
+    //   const_reverse_iterator rend() const;
+    //   const_iterator cbegin() const;
+    //   const_iterator cend() const;
+    //   const_reverse_iterator crbegin() const;
+    //   const_reverse_iterator crend() const;
+    //   size_type size() const;
+    //   size_type max_size() const;
+    //   size_type capacity() const;
+    //   bool empty() const;
+    //   CONCERN: The type has the expected type traits.
+    //   CONCERN: No memory is allocated until the inline buffer is full.
+    // ------------------------------------------------------------------------
+
+    BSLMF_ASSERT((bslalg::HasStlIterators<Obj>::value));
+    BSLMF_ASSERT((bslma::UsesBslmaAllocator<Obj>::value));
+    BSLMF_ASSERT(!(bslmf::IsBitwiseMoveable<Obj>::value));
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    if (veryVerbose) printf("\tDefault construction.\n");
+    {
+        Obj mW;  const Obj& W = mW;
+        ASSERT(W.get_allocator() == Allocator(&da));
+        ASSERT(W.empty());
+        ASSERT(0 == W.size());
+        ASSERT(INLINE_CAPACITY == W.capacity());
+        ASSERT(isInline(W));
+        ASSERT(W.begin() == W.end());
+        ASSERT(W.cbegin() == W.cend());
+        ASSERT(W.rbegin() == W.rend());
+        ASSERT(W.crbegin() == W.crend());
+        ASSERT(0 < W.max_size());
+
+        Obj mX(&oa);  const Obj& X = mX;
+        ASSERT(X.get_allocator() == Allocator(&oa));
+        ASSERT(X.empty());
+        ASSERT(INLINE_CAPACITY == X.capacity());
+    }
+    ASSERT(0 == oa.numBlocksTotal());
+    ASSERT(0 == da.numBlocksTotal());
+
+    if (veryVerbose) printf("\tAppending and iteration.\n");
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        const int LENGTH = SIZES[ti];
+
+        Obj       mX(&oa);  const Obj& X = mX;
+        Reference reference;
+
+        for (int i = 0; i < LENGTH; ++i) {
+            const Int64 BLOCKS = oa.numBlocksTotal();
+            const bool  GROWS  = X.size() == X.capacity();
+
+            mX.push_back(Util::create(i, &sa));
+            reference.push_back(i);
+
+            ASSERTV(LENGTH, i, verify(X, reference));
+            ASSERTV(LENGTH, i, X.size() <= X.capacity());
+            ASSERTV(LENGTH, i, isInline(X) == (i < k_INLINE));
+            ASSERTV(LENGTH, i, i >= k_INLINE || X.capacity() == k_INLINE);
+
+            // Growing allocates one array, and, for 'AllocType' (which is not
+            // bitwise moveable), each element allocates one block when it is
+            // created or copied to the new array.
+
+            const Int64 PER = bslma::UsesBslmaAllocator<VALUE>::value ? 1 : 0;
+            const Int64 EXP = BLOCKS + PER
+                            + (GROWS ? 1 + PER * static_cast<Int64>(i) : 0);
+            ASSERTV(LENGTH, i, EXP, oa.numBlocksTotal(),
+                    EXP == oa.numBlocksTotal());
+        }
+
+        int count = 0;
+        for (Iterator it = mX.begin(); it != mX.end(); ++it) {
+            ++count;
+        }
+        ASSERTV(LENGTH, count, X.size() == static_cast<size_t>(count));
+
+        count = 0;
+        for (typename Obj::reverse_iterator it  = mX.rbegin();
+                                            it != mX.rend();
+                                            ++it) {
+            ++count;
+        }
+        ASSERTV(LENGTH, count, X.size() == static_cast<size_t>(count));
+
+        const std::size_t CAPACITY = X.capacity();
+        for (int i = LENGTH; i > LENGTH / 2; --i) {
+            mX.pop_back();
+            reference.pop_back();
+            ASSERTV(LENGTH, i, verify(X, reference));
+            ASSERTV(LENGTH, i, CAPACITY == X.capacity());
+        }
+
+        mX.clear();
+        ASSERTV(LENGTH, X.empty());
+        ASSERTV(LENGTH, X.begin() == X.end());
+        ASSERTV(LENGTH, CAPACITY == X.capacity());
+        ASSERTV(LENGTH, (LENGTH > k_INLINE ? 1 : 0) == oa.numBlocksInUse());
+
+        mX.push_back(Util::create(1, &sa));
+        ASSERTV(LENGTH, 1 == X.size());
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+    ASSERT(0 == da.numBlocksTotal());
+}
+
+template <class VALUE, std::size_t INLINE_CAPACITY>
+void TestDriver<VALUE, INLINE_CAPACITY>::testCase3()
+{
+    // ------------------------------------------------------------------------
+    // COPY CONSTRUCTION, ASSIGNMENT AND SWAP
+    //
+    // Concerns:
+    //: 1 A copy has the same value as the original, and uses the supplied
+    //:   allocator, or the default allocator if none is supplied, exactly as
+    //:   for 'bsl::vector'.
+    //:
+    //: 2 The original is not modified by copying.
+    //:
+    //: 3 Assignment gives the target the value of the source, retaining the
+    //:   allocator of the target, and self-assignment has no effect.
+    //:
+    //: 4 'swap' (member and free) exchanges the values of two vectors,
+    //:   whether each holds its elements inline or in an allocated array,
+    //:   without allocating memory if their allocators are equal (unless
+    //:   elements that are not bitwise moveable are moved between inline
+    //:   buffers), and exchanging copies otherwise.
+    //:
+    //: 5 'swap' of two vectors holding their elements in allocated arrays
+    //:   exchanges the arrays.
+    //:
+    //: 6 No memory is leaked.
+    //
+    // Plan:
+    //: 1 For pairs of vectors of various sizes (on either side of
+    //:   'INLINE_CAPACITY'), copy, assign and swap them, verifying the
+    //:   values against references, and the allocators used.  (C-1..6)
+    //
+    // Testing:
+    //   small_vector(const small_vector& original);
+    //   small_vector(const small_vector& original, const A& allocator);
+    //   small_vector& operator=(const small_vector& rhs);
+    //   void swap(small_vector& other);
+    //   void swap(small_vector& a, small_vector& b);
+    //   CONCERN: 'swap' moves elements between inline buffers correctly.
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        const int LENGTH1 = SIZES[ti];
+
+        Obj       mX(&oa);  const Obj& X = mX;
+        Reference reference1;
+        fill(&mX, &reference1, LENGTH1, 0, &sa);
+        ASSERTV(LENGTH1, verify(X, reference1));
+
+        {
+            const Obj Y(X);
+            ASSERTV(LENGTH1, Y.get_allocator() == Allocator(&da));
+            ASSERTV(LENGTH1, verify(Y, reference1));
+            ASSERTV(LENGTH1, isInline(Y) == (LENGTH1 <= k_INLINE));
+            ASSERTV(LENGTH1, X == Y);
+        }
+        ASSERTV(LENGTH1, 0 == da.numBlocksInUse());
+        {
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            const Obj Y(X, &za);
+            ASSERTV(LENGTH1, Y.get_allocator() == Allocator(&za));
+            ASSERTV(LENGTH1, verify(Y, reference1));
+            ASSERTV(LENGTH1, oam.isTotalSame());
+        }
+        ASSERTV(LENGTH1, verify(X, reference1));
+
+        for (int tj = 0; tj < NUM_SIZES; ++tj) {
+            const int LENGTH2 = SIZES[tj];
+
+            Reference reference2;
+            {
+                Obj mY(&za);  const Obj& Y = mY;
+                fill(&mY, &reference2, LENGTH2, 1000, &sa);
+
+                Obj *mR = &(mY = X);
+                ASSERTV(LENGTH1, LENGTH2, mR == &mY);
+                ASSERTV(LENGTH1, LENGTH2, verify(Y, reference1));
+                ASSERTV(LENGTH1, LENGTH2, verify(X, reference1));
+                ASSERTV(LENGTH1, LENGTH2,
+                        Y.get_allocator() == Allocator(&za));
+
+                mR = &(mY = Y);
+                ASSERTV(LENGTH1, LENGTH2, mR == &mY);
+                ASSERTV(LENGTH1, LENGTH2, verify(Y, reference1));
+            }
+            ASSERTV(LENGTH1, LENGTH2, 0 == za.numBlocksInUse());
+
+            {
+                Obj mA(X, &oa);  const Obj& A = mA;
+                Obj mB(&oa);     const Obj& B = mB;
+                reference2.clear();
+                fill(&mB, &reference2, LENGTH2, 1000, &sa);
+
+                const VALUE *DATA_A = A.data();
+                const VALUE *DATA_B = B.data();
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                mA.swap(mB);
+                ASSERTV(LENGTH1, LENGTH2, verify(A, reference2));
+                ASSERTV(LENGTH1, LENGTH2, verify(B, reference1));
+                ASSERTV(LENGTH1, LENGTH2,
+                        isInline(A) == (LENGTH2 <= k_INLINE));
+                ASSERTV(LENGTH1, LENGTH2,
+                        isInline(B) == (LENGTH1 <= k_INLINE));
+                if (!isInline(A)) {
+                    ASSERTV(LENGTH1, LENGTH2, DATA_B == A.data());
+                }
+                if (!isInline(B)) {
+                    ASSERTV(LENGTH1, LENGTH2, DATA_A == B.data());
+                }
+
+                swap(mA, mB);
+                ASSERTV(LENGTH1, LENGTH2, verify(A, reference1));
+                ASSERTV(LENGTH1, LENGTH2, verify(B, reference2));
+
+                mA.swap(mA);
+                ASSERTV(LENGTH1, LENGTH2, verify(A, reference1));
+
+                // Moving an element that is not bitwise moveable between
+                // inline buffers copies it.
+
+                if (bslmf::IsBitwiseMoveable<VALUE>::value
+                 || (LENGTH1 > k_INLINE && LENGTH2 > k_INLINE)) {
+                    ASSERTV(LENGTH1, LENGTH2, oam.isTotalSame());
+                }
+                ASSERTV(LENGTH1, LENGTH2, oam.isInUseSame());
+            }
+
+            {
+                Obj mA(X, &oa);  const Obj& A = mA;
+                Obj mB(&za);     const Obj& B = mB;
+                reference2.clear();
+                fill(&mB, &reference2, LENGTH2, 1000, &sa);
+
+                mA.swap(mB);
+                ASSERTV(LENGTH1, LENGTH2, verify(A, reference2));
+                ASSERTV(LENGTH1, LENGTH2, verify(B, reference1));
+                ASSERTV(LENGTH1, LENGTH2, A.get_allocator() ==
+                                                          Allocator(&oa));
+                ASSERTV(LENGTH1, LENGTH2, B.get_allocator() ==
+                                                          Allocator(&za));
+            }
+            ASSERTV(LENGTH1, LENGTH2, 0 == za.numBlocksInUse());
+        }
+    }
+    ASSERT(0 == da.numBlocksInUse());
+    ASSERT(0 == oa.numBlocksInUse());
+}
+
+template <class VALUE, std::size_t INLINE_CAPACITY>
+void TestDriver<VALUE, INLINE_CAPACITY>::testCase4()
+{
+    // ------------------------------------------------------------------------
+    // VALUE CONSTRUCTORS, INSERTION AND REMOVAL
+    //
+    // Concerns:
+    //: 1 The size, size-and-value, and range constructors create the
+    //:   specified value, holding the elements inline if they fit, and an
+    //:   integral pair of arguments is taken as a size and a value.
+    //:
+    //: 2 Each form of 'insert' inserts the elements at the specified
+    //:   position, whether or not the vector must move its elements to a
+    //:   (larger) allocated array, and whether the range is given by input or
+    //:   forward iterators.
+    //:
+    //: 3 Each form of 'erase' removes the identified elements, and returns
+    //:   an iterator to the element following them.
+    //:
+    //: 4 'resize' and 'assign' set the specified value.
+    //:
+    //: 5 Appending to a vector provides the strong exception-safety
+    //:   guarantee, and no form of 'insert' leaks memory if an allocation
+    //:   fails.
+    //:
+    //: 6 No memory is leaked.
+    //
+    // Plan:
+    //: 1 Construct vectors of various sizes using each constructor, and
+    //:   verify their values, whether their elements are inline, and that
+    //:   no memory is allocated for those that are.  (C-1)
+    //:
+    //: 2 For vectors of various sizes, and each position, insert one, and
+    //:   several, copies of a value, and a range of values given by
+    //:   forward and input iterators, and erase the inserted elements, and
+    //:   verify the results against a reference.  (C-2..3)
+    //:
+    //: 3 For vectors of various sizes, 'resize' and 'assign' to values of
+    //:   various sizes, and verify the results.  (C-4)
+    //:
+    //: 4 Repeat appending and inserting under
+    //:   'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*', verifying that the value is
+    //:   unchanged when appending throws.  (C-5..6)
+    //
+    // Testing:
+    //   small_vector(size_type initialSize, const A& allocator = A());
+    //   small_vector(size_type n, const V& value, const A& allocator = A());
+    //   small_vector(ITER first, ITER last, const A& allocator = A());
+    //   void assign(INPUT_ITER first, INPUT_ITER last);
+    //   void assign(size_type numElements, const VALUE_TYPE& value);
+    //   void resize(size_type newSize);
+    //   void resize(size_type newSize, const VALUE_TYPE& value);
+    //   iterator insert(const_iterator position, const VALUE_TYPE& value);
+    //   void insert(const_iterator position, size_type n, const V& value);
+    //   void insert(const_iterator position, ITER first, ITER last);
+    //   iterator erase(const_iterator position);
+    //   iterator erase(const_iterator first, const_iterator last);
+    //   CONCERN: Appending provides the strong exception-safety guarantee.
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    const VALUE SEVEN = Util::create(7, &sa);
+
+    if (veryVerbose) printf("\tValue constructors.\n");
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        const int LENGTH = SIZES[ti];
+
+        std::vector<VALUE> values;
+        Reference          reference;
+        for (int i = 0; i < LENGTH; ++i) {
+            values.push_back(Util::create(i, &sa));
+            reference.push_back(i);
+        }
+        const Int64 PER_ELEMENT = bslma::UsesBslmaAllocator<VALUE>::value
+                                ? LENGTH
+                                : 0;
+        const Int64 ARRAY = LENGTH > k_INLINE ? 1 : 0;
+        {
+            const Int64 BLOCKS = oa.numBlocksTotal();
+
+            const Obj X(values.begin(), values.end(), &oa);
+            ASSERTV(LENGTH, verify(X, reference));
+            ASSERTV(LENGTH, isInline(X) == (LENGTH <= k_INLINE));
+            ASSERTV(LENGTH, BLOCKS + ARRAY + PER_ELEMENT ==
+                                                        oa.numBlocksTotal());
+        }
+        ASSERTV(LENGTH, 0 == oa.numBlocksInUse());
+        {
+            const Obj X(LENGTH, SEVEN, &oa);
+            ASSERTV(LENGTH, Reference(LENGTH, 7) == Reference(X.size(), 7));
+            for (int i = 0; i < LENGTH; ++i) {
+                ASSERTV(LENGTH, i, 7 == Util::toInt(X[i]));
+            }
+            ASSERTV(LENGTH, isInline(X) == (LENGTH <= k_INLINE));
+        }
+        {
+            const Obj X(LENGTH, &oa);
+            ASSERTV(LENGTH, LENGTH == static_cast<int>(X.size()));
+            for (int i = 0; i < LENGTH; ++i) {
+                ASSERTV(LENGTH, i, X[i] == VALUE());
+            }
+        }
+        ASSERTV(LENGTH, 0 == oa.numBlocksInUse());
+    }
+    {
+        // An integral pair of arguments is a size and a value.
+
+        bsl::small_vector<int, INLINE_CAPACITY> mX(5, 3, &oa);
+        ASSERT(5 == mX.size());
+        ASSERT(3 == mX[4]);
+
+        mX.insert(mX.begin(), 2, 1);
+        ASSERT(7 == mX.size());
+        ASSERT(1 == mX[1]);
+        ASSERT(3 == mX[2]);
+
+        mX.assign(2, 9);
+        ASSERT(2 == mX.size());
+        ASSERT(9 == mX[1]);
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+
+    if (veryVerbose) printf("\tInsertion and removal.\n");
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        const int LENGTH = SIZES[ti];
+        for (int pos = 0; pos <= LENGTH; ++pos) {
+            for (int n = 1; n <= 5; n += 2) {
+                std::vector<VALUE> values;
+                for (int i = 0; i < n; ++i) {
+                    values.push_back(Util::create(100 + i, &sa));
+                }
+
+                for (int mode = 0; mode < 4; ++mode) {
+                    Obj       mX(&oa);  const Obj& X = mX;
+                    Reference reference;
+                    fill(&mX, &reference, LENGTH, 0, &sa);
+
+                    switch (mode) {
+                      case 0: {
+                        Iterator it = mX.insert(X.begin() + pos, values[0]);
+                        ASSERTV(LENGTH, pos, it == X.begin() + pos);
+                        reference.insert(reference.begin() + pos, 100);
+                      } break;
+                      case 1: {
+                        mX.insert(X.begin() + pos, n, values[0]);
+                        reference.insert(reference.begin() + pos, n, 100);
+                      } break;
+                      case 2: {
+                        mX.insert(X.begin() + pos,
+                                  values.begin(),
+                                  values.end());
+                        for (int i = 0; i < n; ++i) {
+                            reference.insert(reference.begin() + pos + i,
+                                             100 + i);
+                        }
+                      } break;
+                      case 3: {
+                        // Input iterators.
+
+                        std::ostringstream stream;
+                        for (int i = 0; i < n; ++i) {
+                            stream << 100 + i << ' ';
+                        }
+                        std::istringstream       in(stream.str());
+                        std::istream_iterator<int> first(in), last;
+
+                        bsl::small_vector<int, INLINE_CAPACITY> mY(&oa);
+                        for (int i = 0; i < LENGTH; ++i) {
+                            mY.push_back(i);
+                        }
+                        mY.insert(mY.begin() + pos, first, last);
+                        for (int i = 0; i < n; ++i) {
+                            reference.insert(reference.begin() + pos + i,
+                                             100 + i);
+                        }
+                        ASSERTV(LENGTH, pos, n,
+                                Reference(mY.begin(), mY.end()) ==
+                                                                  reference);
+                        mX.insert(X.begin() + pos,
+                                  values.begin(),
+                                  values.end());
+                      } break;
+                    }
+                    ASSERTV(LENGTH, pos, n, mode, verify(X, reference));
+
+                    // Erase the inserted elements.
+
+                    const int NUM_INSERTED = 0 == mode ? 1 : n;
+                    Iterator  it;
+                    if (1 == NUM_INSERTED) {
+                        it = mX.erase(X.begin() + pos);
+                    }
+                    else {
+                        it = mX.erase(X.begin() + pos,
+                                      X.begin() + pos + NUM_INSERTED);
+                    }
+                    ASSERTV(LENGTH, pos, n, mode, it == X.begin() + pos);
+                    reference.erase(reference.begin() + pos,
+                                    reference.begin() + pos + NUM_INSERTED);
+                    ASSERTV(LENGTH, pos, n, mode, verify(X, reference));
+                }
+            }
+        }
+
+        // Insert an element of the vector into itself.
+
+        if (LENGTH) {
+            Obj       mX(&oa);  const Obj& X = mX;
+            Reference reference;
+            fill(&mX, &reference, LENGTH, 0, &sa);
+
+            mX.insert(X.begin(), X.back());
+            reference.insert(reference.begin(), reference.back());
+            ASSERTV(LENGTH, verify(X, reference));
+
+            mX.push_back(X.front());
+            reference.push_back(reference.front());
+            ASSERTV(LENGTH, verify(X, reference));
+        }
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+
+    if (veryVerbose) printf("\tResize and assign.\n");
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        const int LENGTH1 = SIZES[ti];
+        for (int tj = 0; tj < NUM_SIZES; ++tj) {
+            const int LENGTH2 = SIZES[tj];
+            {
+                Obj       mX(&oa);  const Obj& X = mX;
+                Reference reference;
+                fill(&mX, &reference, LENGTH1, 0, &sa);
+
+                mX.resize(LENGTH2, SEVEN);
+                reference.resize(LENGTH2, 7);
+                ASSERTV(LENGTH1, LENGTH2, verify(X, reference));
+
+                mX.resize(LENGTH1);
+                ASSERTV(LENGTH1, LENGTH2, LENGTH1 == (int) X.size());
+            }
+            {
+                Obj       mX(&oa);  const Obj& X = mX;
+                Reference reference;
+                fill(&mX, &reference, LENGTH1, 0, &sa);
+
+                std::vector<VALUE> values;
+                reference.clear();
+                for (int i = 0; i < LENGTH2; ++i) {
+                    values.push_back(Util::create(50 + i, &sa));
+                    reference.push_back(50 + i);
+                }
+                mX.assign(values.begin(), values.end());
+                ASSERTV(LENGTH1, LENGTH2, verify(X, reference));
+
+                mX.assign(LENGTH1, SEVEN);
+                ASSERTV(LENGTH1, LENGTH2, verify(X, Reference(LENGTH1, 7)));
+            }
+        }
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+
+    if (veryVerbose) printf("\tException safety.\n");
+    {
+        const int LENGTH = 2 * k_INLINE + 3;
+
+        Obj       mX(&oa);  const Obj& X = mX;
+        Reference reference;
+
+        for (int i = 0; i < LENGTH; ++i) {
+            const VALUE VALUE_I = Util::create(i, &sa);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                ASSERTV(i, verify(X, reference));
+
+                mX.push_back(VALUE_I);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            reference.push_back(i);
+            ASSERTV(i, verify(X, reference));
+        }
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        const int LENGTH = SIZES[ti];
+
+        std::vector<VALUE> values;
+        for (int i = 0; i < 3; ++i) {
+            values.push_back(Util::create(100 + i, &sa));
+        }
+
+        BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+            Obj       mX(&oa);  const Obj& X = mX;
+            Reference reference;
+            fill(&mX, &reference, LENGTH, 0, &sa);
+
+            mX.insert(X.begin() + LENGTH / 2, values.begin(), values.end());
+            mX.insert(X.begin(), 2, values[1]);
+        } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+    ASSERT(0 == da.numBlocksInUse());
+}
+
+template <class VALUE, std::size_t INLINE_CAPACITY>
+void TestDriver<VALUE, INLINE_CAPACITY>::testCase5()
+{
+    // ------------------------------------------------------------------------
+    // CAPACITY AND ELEMENT ACCESS
+    //
+    // Concerns:
+    //: 1 'reserve' of at most 'INLINE_CAPACITY' elements has no effect, and
+    //:   'reserve' of more elements moves the elements to an allocated array
+    //:   of (at least) that capacity, preserving the value.
+    //:
+    //: 2 'reserve' and 'shrink_to_fit' leave the vector unchanged if an
+    //:   allocation fails.
+    //:
+    //: 3 'shrink_to_fit' moves the elements back to the inline buffer if
+    //:   they fit, releasing the allocated array, and otherwise reduces the
+    //:   capacity to the size.
+    //:
+    //: 4 'reserve' throws 'std::length_error' if the capacity exceeds
+    //:   'max_size()'.
+    //:
+    //: 5 'operator[]', 'at', 'front', 'back' and 'data' provide access to the
+    //:   elements, and 'at' throws 'std::out_of_range' for an invalid
+    //:   position.
+    //
+    // Plan:
+    //: 1 For vectors of various sizes, reserve various capacities, and
+    //:   shrink the vector, under 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*',
+    //:   verifying the value, capacity, whether the elements are inline, and
+    //:   the memory in use.  (C-1..3)
+    //:
+    //: 2 Verify that reserving 'max_size() + 1' elements throws.  (C-4)
+    //:
+    //: 3 Access the elements of vectors of various sizes through each
+    //:   accessor and manipulator, and verify that 'at' throws for the
+    //:   position 'size()'.  (C-5)
+    //
+    // Testing:
+    //   void reserve(size_type newCapacity);
+    //   void shrink_to_fit();
+    //   reference operator[](size_type position);
+    //   reference at(size_type position);
+    //   reference front();
+    //   reference back();
+    //   VALUE_TYPE *data();
+    //   const_reference operator[](size_type position) const;
+    //   const_reference at(size_type position) const;
+    //   const_reference front() const;
+    //   const_reference back() const;
+    //   const VALUE_TYPE *data() const;
+    //   CONCERN: 'shrink_to_fit' moves the elements back inline.
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator da("default", veryVeryVeryVerbose);
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    const Int64 PER_ELEMENT = bslma::UsesBslmaAllocator<VALUE>::value ? 1 : 0;
+
+    if (veryVerbose) printf("\tReserve and shrink.\n");
+    for (int ti = 0; ti < NUM_SIZES; ++ti) {
+        const int LENGTH = SIZES[ti];
+        for (int tc = 0; tc < NUM_SIZES; ++tc) {
+            const int CAPACITY = SIZES[tc];
+
+            Obj       mX(&oa);  const Obj& X = mX;
+            Reference reference;
+            fill(&mX, &reference, LENGTH, 0, &sa);
+            mX.shrink_to_fit();
+
+            const std::size_t OLD_CAPACITY = X.capacity();
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                ASSERTV(LENGTH, CAPACITY, verify(X, reference));
+                ASSERTV(LENGTH, CAPACITY, OLD_CAPACITY == X.capacity());
+
+                mX.reserve(CAPACITY);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERTV(LENGTH, CAPACITY, verify(X, reference));
+            ASSERTV(LENGTH, CAPACITY,
+                    X.capacity() >= static_cast<std::size_t>(CAPACITY));
+            ASSERTV(LENGTH, CAPACITY,
+                    isInline(X) == (X.capacity() == INLINE_CAPACITY));
+            ASSERTV(LENGTH, CAPACITY, isInline(X) ==
+                          (LENGTH <= k_INLINE && CAPACITY <= k_INLINE));
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                ASSERTV(LENGTH, CAPACITY, verify(X, reference));
+
+                mX.shrink_to_fit();
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERTV(LENGTH, CAPACITY, verify(X, reference));
+            ASSERTV(LENGTH, CAPACITY, isInline(X) == (LENGTH <= k_INLINE));
+            ASSERTV(LENGTH, CAPACITY, X.capacity() ==
+                        (LENGTH <= k_INLINE ? INLINE_CAPACITY
+                                            : static_cast<size_t>(LENGTH)));
+            ASSERTV(LENGTH, CAPACITY, oa.numBlocksInUse() ==
+                               PER_ELEMENT * LENGTH + (isInline(X) ? 0 : 1));
+        }
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+
+#ifdef BDE_BUILD_TARGET_EXC
+    {
+        Obj mX(&oa);
+        bool caught = false;
+        try {
+            mX.reserve(mX.max_size() + 1);
+        }
+        catch (const std::length_error&) {
+            caught = true;
+        }
+        ASSERT(caught);
+    }
+#endif
+
+    if (veryVerbose) printf("\tElement access.\n");
+    for (int ti = 1; ti < NUM_SIZES; ++ti) {
+        const int LENGTH = SIZES[ti];
+
+        Obj       mX(&oa);  const Obj& X = mX;
+        Reference reference;
+        fill(&mX, &reference, LENGTH, 0, &sa);
+
+        for (int i = 0; i < LENGTH; ++i) {
+            ASSERTV(LENGTH, i, i == Util::toInt(X[i]));
+            ASSERTV(LENGTH, i, i == Util::toInt(X.at(i)));
+            ASSERTV(LENGTH, i, &X[i] == &mX[i]);
+            ASSERTV(LENGTH, i, &X[i] == &mX.at(i));
+            ASSERTV(LENGTH, i, &X[i] == X.data() + i);
+        }
+        ASSERTV(LENGTH, &X.front() == X.data());
+        ASSERTV(LENGTH, &mX.front() == mX.data());
+        ASSERTV(LENGTH, &X.back() == X.data() + LENGTH - 1);
+        ASSERTV(LENGTH, &mX.back() == &X.back());
+        ASSERTV(LENGTH, X.data() == &*X.begin());
+
+        mX[0] = Util::create(-1, &sa);
+        ASSERTV(LENGTH, -1 == Util::toInt(X.front()));
+
+#ifdef BDE_BUILD_TARGET_EXC
+        bool caught = false;
+        try {
+            X.at(LENGTH);
+        }
+        catch (const std::out_of_range&) {
+            caught = true;
+        }
+        ASSERTV(LENGTH, caught);
+
+        caught = false;
+        try {
+            mX.at(LENGTH);
+        }
+        catch (const std::out_of_range&) {
+            caught = true;
+        }
+        ASSERTV(LENGTH, caught);
+#endif
+    }
+    ASSERT(0 == oa.numBlocksInUse());
+    ASSERT(0 == da.numBlocksTotal());
+}
+
+template <class VALUE, std::size_t INLINE_CAPACITY>
+void TestDriver<VALUE, INLINE_CAPACITY>::testCase6()
+{
+    // ------------------------------------------------------------------------
+    // COMPARISON OPERATORS
+    //
+    // Concerns:
+    //: 1 Two vectors compare equal if and only if they hold the same
+    //:   sequence of values, whether or not their elements are inline, and
+    //:   regardless of their allocators.
+    //:
+    //: 2 The relational operators order vectors lexicographically.
+    //
+    // Plan:
+    //: 1 For each pair of a set of vectors ordered lexicographically, verify
+    //:   that the operators return the results given by comparing the
+    //:   indices of the vectors in the set.  (C-1..2)
+    //
+    // Testing:
+    //   bool operator==(const small_vector& lhs, const small_vector& rhs);
+    //   bool operator!=(const small_vector& lhs, const small_vector& rhs);
+    //   bool operator< (const small_vector& lhs, const small_vector& rhs);
+    //   bool operator> (const small_vector& lhs, const small_vector& rhs);
+    //   bool operator<=(const small_vector& lhs, const small_vector& rhs);
+    //   bool operator>=(const small_vector& lhs, const small_vector& rhs);
+    // ------------------------------------------------------------------------
+
+    bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+    bslma::TestAllocator za("other",   veryVeryVeryVerbose);
+    bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+    // Specifications of vectors, in lexicographical order.
+
+    static const char *SPECS[] = {
+        "",
+        "A",
+        "AA",
+        "AAAAAAAAAAA",
+        "AB",
+        "ABCDEFGHIJ",
+        "ABCDEFGHIJK",
+        "B",
+        "BA",
+    };
+    const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+    for (int i = 0; i < NUM_SPECS; ++i) {
+        Obj mX(&oa);  const Obj& X = mX;
+        for (const char *p = SPECS[i]; *p; ++p) {
+            mX.push_back(Util::create(*p, &sa));
+        }
+        for (int j = 0; j < NUM_SPECS; ++j) {
+            Obj mY(&za);  const Obj& Y = mY;
+            for (const char *p = SPECS[j]; *p; ++p) {
+                mY.push_back(Util::create(*p, &sa));
+            }
+
+            ASSERTV(i, j, (i == j) == (X == Y));
+            ASSERTV(i, j, (i != j) == (X != Y));
+            ASSERTV(i, j, (i <  j) == (X <  Y));
+            ASSERTV(i, j, (i >  j) == (X >  Y));
+            ASSERTV(i, j, (i <= j) == (X <= Y));
+            ASSERTV(i, j, (i >= j) == (X >= Y));
+        }
+    }
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Splitting Records Into Fields
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we parse a file of comma-separated records, and, for each record,
+// collect the offsets at which its fields begin.  Almost every record has
+// fewer than eight fields, but an occasional record has many more.
+//
+// First, we define a function that appends the offsets of the fields of a
+// record to a vector supplied by the caller:
+//..
+//  template <class VECTOR>
+//  void splitFields(VECTOR *offsets, const char *record)
+//      ...
+//..
+// Then, we split a typical record into a 'small_vector' that holds up to
+// eight offsets inline, and observe that no memory is allocated:
+//..
+    bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+    typedef bsl::small_vector<int, 8> Offsets;
+
+    Offsets offsets(&oa);
+    splitFields(&offsets, "IBM,N,100,127.5");
+
+    ASSERT(4  == offsets.size());
+    ASSERT(6  == offsets[2]);
+    ASSERT(10 == offsets.back());
+    ASSERT(0  == oa.numBlocksTotal());
+//..
+// Next, we split a long record, and observe that the vector spills its
+// elements to memory supplied by its allocator:
+//..
+    offsets.clear();
+    splitFields(&offsets, "a,b,c,d,e,f,g,h,i,j");
+
+    ASSERT(10 == offsets.size());
+    ASSERT(18 == offsets.back());
+    ASSERT(1  == oa.numBlocksInUse());
+//..
+// Now, we release that memory once we no longer need the long record, which
+// moves the offsets of a shorter record back into the inline buffer:
+//..
+    offsets.resize(2);
+    offsets.shrink_to_fit();
+
+    ASSERT(8 == offsets.capacity());
+    ASSERT(0 == oa.numBlocksInUse());
+//..
+// Finally, we note that a 'bsl::vector' would have allocated memory for the
+// first record:
+//..
+    bsl::vector<int> vectorOffsets(&oa);
+    splitFields(&vectorOffsets, "IBM,N,100,127.5");
+
+    ASSERT(0 < oa.numBlocksInUse());
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // COMPARISON OPERATORS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOMPARISON OPERATORS"
+                            "\n====================\n");
+
+        TestDriver<int,       1>::testCase6();
+        TestDriver<int,       4>::testCase6();
+        TestDriver<AllocType, 1>::testCase6();
+        TestDriver<AllocType, 4>::testCase6();
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CAPACITY AND ELEMENT ACCESS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCAPACITY AND ELEMENT ACCESS"
+                            "\n===========================\n");
+
+        TestDriver<int,       1>::testCase5();
+        TestDriver<int,       4>::testCase5();
+        TestDriver<AllocType, 1>::testCase5();
+        TestDriver<AllocType, 4>::testCase5();
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // VALUE CONSTRUCTORS, INSERTION AND REMOVAL
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nVALUE CONSTRUCTORS, INSERTION AND REMOVAL"
+                            "\n=========================================\n");
+
+        TestDriver<int,       1>::testCase4();
+        TestDriver<int,       4>::testCase4();
+        TestDriver<AllocType, 1>::testCase4();
+        TestDriver<AllocType, 4>::testCase4();
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // COPY CONSTRUCTION, ASSIGNMENT AND SWAP
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY CONSTRUCTION, ASSIGNMENT AND SWAP"
+                            "\n======================================\n");
+
+        TestDriver<int,       1>::testCase3();
+        TestDriver<int,       4>::testCase3();
+        TestDriver<AllocType, 1>::testCase3();
+        TestDriver<AllocType, 4>::testCase3();
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                            "\n========================================\n");
+
+        TestDriver<int,       1>::testCase2();
+        TestDriver<int,       4>::testCase2();
+        TestDriver<AllocType, 1>::testCase2();
+        TestDriver<AllocType, 4>::testCase2();
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Append, access, insert, and erase values, in a vector that
+        //:   outgrows its inline buffer, and verify the results.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        {
+            typedef bsl::small_vector<int, 8> Obj;
+
+            Obj mX(&oa);  const Obj& X = mX;
+            ASSERT(X.empty());
+            ASSERT(8 == X.capacity());
+
+            for (int i = 0; i < 8; ++i) {
+                mX.push_back(i);
+            }
+            ASSERT(8 == X.size());
+            ASSERT(0 == oa.numBlocksTotal());
+
+            const int N = 10000;
+            for (int i = 8; i < N; ++i) {
+                mX.push_back(i);
+            }
+            ASSERT(N == static_cast<int>(X.size()));
+            ASSERT(1 == oa.numBlocksInUse());
+
+            for (int i = 0; i < N; ++i) {
+                ASSERTV(i, i == X[i]);
+            }
+
+            mX.erase(mX.begin() + 10, mX.end());
+            mX.insert(mX.begin(), -1);
+            ASSERT(11 == X.size());
+            ASSERT(-1 == X.front());
+            ASSERT( 9 == X.back());
+
+            mX.resize(3);
+            mX.shrink_to_fit();
+            ASSERT(3 == X.size());
+            ASSERT(8 == X.capacity());
+            ASSERT(0 == oa.numBlocksInUse());
+
+            Obj mY(X, &oa);  const Obj& Y = mY;
+            ASSERT(X == Y);
+            mY.push_back(3);
+            ASSERT(X < Y);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -168,6 +168,25 @@ BSLS_IDENT("$Id: $")
 //  +-----------------------------------------+-------------------------------+
 //..
 //
+///Searching
+///---------
+// The 'find', 'rfind', 'find_first_of', 'find_last_of', 'find_first_not_of',
+// and 'find_last_not_of' methods of 'bsl::string' (i.e., of 'basic_string'
+// instantiated with 'char' and 'native_std::char_traits<char>') are
+// implemented by 'bslstl::StringSearchUtil', which examines 16 or 32
+// characters per step on platforms supporting SSE2 or AVX2, and which tests
+// membership in a set of characters in constant time.  All other
+// instantiations compare one character at a time using 'CHAR_TRAITS'.
+//
+///Appending Numbers
+///-----------------
+// As an extension to the C++ standard, 'basic_string' provides 'append'
+// overloads taking an integral or a 'double' value, which append its decimal
+// representation as written by 'bslalg::NumericFormatterUtil::toChars'.
+// These overloads format into a buffer on the stack, and so avoid the
+// temporary string, the stream state, and the locale lookup incurred by
+// 'bsl::ostringstream' or 'sprintf'.
+//
 ///Usage
 ///-----
 // In this section we show intended use of this component.
@@ -589,10 +608,18 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_stringrefdata.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_STRINGSEARCHUTIL
+#include <bslstl_stringsearchutil.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_CONTAINERBASE
 #include <bslalg_containerbase.h>
 #endif
 
+#ifndef INCLUDED_BSLALG_NUMERICFORMATTERUTIL
+#include <bslalg_numericformatterutil.h>
+#endif
+
 #ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
 #include <bslalg_scalarprimitives.h>
 #endif
@@ -775,6 +802,117 @@ String_Traits<native_std::char_traits<char> >::find(const char  *s,
 
 #endif
 
+                        // ====================
+                        // struct String_Search
+                        // ====================
+
+template <class CHAR_TYPE, class CHAR_TRAITS>
+struct String_Search {
+    // This component-private 'struct' provides a namespace for the functions
+    // that search a sequence of 'CHAR_TYPE' on behalf of the 'find' family of
+    // 'basic_string' methods.  This primary template compares one character
+    // at a time using the parameterized 'CHAR_TRAITS'; the specialization for
+    // 'char' and 'native_std::char_traits<char>' forwards to the vectorized
+    // functions of 'bslstl::StringSearchUtil', whose contracts these functions
+    // share.
+
+    // PRIVATE TYPES
+    typedef native_std::size_t size_type;
+
+    // CLASS METHODS
+    static const CHAR_TYPE *find(const CHAR_TYPE *string,
+                                 size_type        length,
+                                 const CHAR_TYPE *substring,
+                                 size_type        substringLength);
+        // Return the address of the first occurrence of the specified
+        // 'substring' having the specified 'substringLength' in the specified
+        // 'string' having the specified 'length', or 0 if there is no such
+        // occurrence.  If '0 == substringLength', return 'string'.
+
+    static const CHAR_TYPE *findLast(const CHAR_TYPE *string,
+                                     size_type        length,
+                                     const CHAR_TYPE *substring,
+                                     size_type        substringLength);
+        // Return the address of the last occurrence of the specified
+        // 'substring' having the specified 'substringLength' in the specified
+        // 'string' having the specified 'length', or 0 if there is no such
+        // occurrence.  If '0 == substringLength', return 'string + length'.
+
+    static const CHAR_TYPE *findFirstOf(const CHAR_TYPE *string,
+                                        size_type        length,
+                                        const CHAR_TYPE *characterSet,
+                                        size_type        setLength);
+        // Return the address of the first character in the specified 'string'
+        // having the specified 'length' that is equal to one of the characters
+        // in the specified 'characterSet' having the specified 'setLength', or
+        // 0 if there is no such character.
+
+    static const CHAR_TYPE *findFirstNotOf(const CHAR_TYPE *string,
+                                           size_type        length,
+                                           const CHAR_TYPE *characterSet,
+                                           size_type        setLength);
+        // Return the address of the first character in the specified 'string'
+        // having the specified 'length' that is not equal to any of the
+        // characters in the specified 'characterSet' having the specified
+        // 'setLength', or 0 if there is no such character.
+
+    static const CHAR_TYPE *findLastOf(const CHAR_TYPE *string,
+                                       size_type        length,
+                                       const CHAR_TYPE *characterSet,
+                                       size_type        setLength);
+        // Return the address of the last character in the specified 'string'
+        // having the specified 'length' that is equal to one of the characters
+        // in the specified 'characterSet' having the specified 'setLength', or
+        // 0 if there is no such character.
+
+    static const CHAR_TYPE *findLastNotOf(const CHAR_TYPE *string,
+                                          size_type        length,
+                                          const CHAR_TYPE *characterSet,
+                                          size_type        setLength);
+        // Return the address of the last character in the specified 'string'
+        // having the specified 'length' that is not equal to any of the
+        // characters in the specified 'characterSet' having the specified
+        // 'setLength', or 0 if there is no such character.
+};
+
+template <>
+struct String_Search<char, native_std::char_traits<char> > {
+    // This specialization of 'String_Search' forwards each search to
+    // 'bslstl::StringSearchUtil'.
+
+    // PRIVATE TYPES
+    typedef native_std::size_t                     size_type;
+    typedef BloombergLP::bslstl::StringSearchUtil  Util;
+
+    // CLASS METHODS
+    static const char *find(const char *string,
+                            size_type   length,
+                            const char *substring,
+                            size_type   substringLength);
+    static const char *findLast(const char *string,
+                                size_type   length,
+                                const char *substring,
+                                size_type   substringLength);
+    static const char *findFirstOf(const char *string,
+                                   size_type   length,
+                                   const char *characterSet,
+                                   size_type   setLength);
+    static const char *findFirstNotOf(const char *string,
+                                      size_type   length,
+                                      const char *characterSet,
+                                      size_type   setLength);
+    static const char *findLastOf(const char *string,
+                                  size_type   length,
+                                  const char *characterSet,
+                                  size_type   setLength);
+    static const char *findLastNotOf(const char *string,
+                                     size_type   length,
+                                     const char *characterSet,
+                                     size_type   setLength);
+        // Return the result of the function of the same name in
+        // 'bslstl::StringSearchUtil' for the specified arguments.
+};
+
                         // ================
                         // class String_Imp
                         // ================
@@ -1040,6 +1178,12 @@ class basic_string
         // 'privateReplaceDispatch' to separate the integral type from iterator
         // types.
 
+    template <class NUMERIC_TYPE>
+    basic_string& privateAppendNumber(NUMERIC_TYPE value);
+        // Append the representation of the specified 'value' written by
+        // 'bslalg::NumericFormatterUtil::toChars' to this string, and return a
+        // reference providing modifiable access to this string.
+
     basic_string& privateAssign(const CHAR_TYPE *characterString,
                                 size_type        numChars);
         // Assign characters from the specified 'characterString' array of
@@ -1509,6 +1653,22 @@ class basic_string
         // providing modifiable access to this string.  The behavior is
         // undefined unless '[first, last)' is a valid iterator range.
 
+    basic_string& append(int                value);
+    basic_string& append(unsigned int       value);
+    basic_string& append(long               value);
+    basic_string& append(unsigned long      value);
+    basic_string& append(long long          value);
+    basic_string& append(unsigned long long value);
+    basic_string& append(double             value);
+        // Append the decimal representation of the specified 'value' at the
+        // end of this string, and return a reference providing modifiable
+        // access to this string.  The representation is the one written by
+        // 'bslalg::NumericFormatterUtil::toChars' (the shortest representation
+        // that identifies a 'double' value exactly), and is produced without
+        // creating a temporary string.  Note that a 'CHAR_TYPE' argument is
+        // also appended as a number; use 'push_back' to append a single
+        // character.  Note also that these overloads are a BDE extension.
+
     void push_back(CHAR_TYPE   character);
         // Append the specified 'character' at the end of this string.
 
@@ -2412,6 +2572,184 @@ void hashAppend(
 // See IMPLEMENTATION NOTES in the '.cpp' before modifying anything below.
 
 namespace bsl {
+                        // --------------------
+                        // struct String_Search
+                        // --------------------
+
+// CLASS METHODS
+template <class CHAR_TYPE, class CHAR_TRAITS>
+const CHAR_TYPE *String_Search<CHAR_TYPE, CHAR_TRAITS>::find(
+                                            const CHAR_TYPE *string,
+                                            size_type        length,
+                                            const CHAR_TYPE *substring,
+                                            size_type        substringLength)
+{
+    if (substringLength > length) {
+        return 0;                                                     // RETURN
+    }
+    if (0 == substringLength) {
+        return string;                                                // RETURN
+    }
+    const CHAR_TYPE *next;
+    for (size_type remChars = length - substringLength + 1;
+         0 != (next = BSLSTL_CHAR_TRAITS::find(string, remChars, *substring));
+         remChars -= ++next - string, string = next)
+    {
+        if (0 == CHAR_TRAITS::compare(next, substring, substringLength)) {
+            return next;                                              // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS>
+const CHAR_TYPE *String_Search<CHAR_TYPE, CHAR_TRAITS>::findLast(
+                                            const CHAR_TYPE *string,
+                                            size_type        length,
+                                            const CHAR_TYPE *substring,
+                                            size_type        substringLength)
+{
+    if (substringLength > length) {
+        return 0;                                                     // RETURN
+    }
+    if (0 == substringLength) {
+        return string + length;                                       // RETURN
+    }
+    for (const CHAR_TYPE *current = string + (length - substringLength) + 1;
+         current != string;)
+    {
+        --current;
+        if (0 == CHAR_TRAITS::compare(current, substring, substringLength)) {
+            return current;                                           // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS>
+const CHAR_TYPE *String_Search<CHAR_TYPE, CHAR_TRAITS>::findFirstOf(
+                                               const CHAR_TYPE *string,
+                                               size_type        length,
+                                               const CHAR_TYPE *characterSet,
+                                               size_type        setLength)
+{
+    for (const CHAR_TYPE *end = string + length; string != end; ++string) {
+        if (BSLSTL_CHAR_TRAITS::find(characterSet, setLength, *string)) {
+            return string;                                            // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS>
+const CHAR_TYPE *String_Search<CHAR_TYPE, CHAR_TRAITS>::findFirstNotOf(
+                                               const CHAR_TYPE *string,
+                                               size_type        length,
+                                               const CHAR_TYPE *characterSet,
+                                               size_type        setLength)
+{
+    for (const CHAR_TYPE *end = string + length; string != end; ++string) {
+        if (!BSLSTL_CHAR_TRAITS::find(characterSet, setLength, *string)) {
+            return string;                                            // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS>
+const CHAR_TYPE *String_Search<CHAR_TYPE, CHAR_TRAITS>::findLastOf(
+                                               const CHAR_TYPE *string,
+                                               size_type        length,
+                                               const CHAR_TYPE *characterSet,
+                                               size_type        setLength)
+{
+    for (const CHAR_TYPE *current = string + length; current != string;) {
+        --current;
+        if (BSLSTL_CHAR_TRAITS::find(characterSet, setLength, *current)) {
+            return current;                                           // RETURN
+        }
+    }
+    return 0;
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS>
+const CHAR_TYPE *String_Search<CHAR_TYPE, CHAR_TRAITS>::findLastNotOf(
+                                               const CHAR_TYPE *string,
+                                               size_type        length,
+                                               const CHAR_TYPE *characterSet,
+                                               size_type        setLength)
+{
+    for (const CHAR_TYPE *current = string + length; current != string;) {
+        --current;
+        if (!BSLSTL_CHAR_TRAITS::find(characterSet, setLength, *current)) {
+            return current;                                           // RETURN
+        }
+    }
+    return 0;
+}
+
+inline
+const char *String_Search<char, native_std::char_traits<char> >::find(
+                                                 const char *string,
+                                                 size_type   length,
+                                                 const char *substring,
+                                                 size_type   substringLength)
+{
+    return Util::find(string, length, substring, substringLength);
+}
+
+inline
+const char *String_Search<char, native_std::char_traits<char> >::findLast(
+                                                 const char *string,
+                                                 size_type   length,
+                                                 const char *substring,
+                                                 size_type   substringLength)
+{
+    return Util::findLast(string, length, substring, substringLength);
+}
+
+inline
+const char *String_Search<char, native_std::char_traits<char> >::findFirstOf(
+                                                    const char *string,
+                                                    size_type   length,
+                                                    const char *characterSet,
+                                                    size_type   setLength)
+{
+    return Util::findFirstOf(string, length, characterSet, setLength);
+}
+
+inline
+const char *
+String_Search<char, native_std::char_traits<char> >::findFirstNotOf(
+                                                    const char *string,
+                                                    size_type   length,
+                                                    const char *characterSet,
+                                                    size_type   setLength)
+{
+    return Util::findFirstNotOf(string, length, characterSet, setLength);
+}
+
+inline
+const char *String_Search<char, native_std::char_traits<char> >::findLastOf(
+                                                    const char *string,
+                                                    size_type   length,
+                                                    const char *characterSet,
+                                                    size_type   setLength)
+{
+    return Util::findLastOf(string, length, characterSet, setLength);
+}
+
+inline
+const char *
+String_Search<char, native_std::char_traits<char> >::findLastNotOf(
+                                                    const char *string,
+                                                    size_type   length,
+                                                    const char *characterSet,
+                                                    size_type   setLength)
+{
+    return Util::findLastNotOf(string, length, characterSet, setLength);
+}
+
                           // ----------------
                           // class String_Imp
                           // ----------------
@@ -2612,6 +2950,31 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::privateAppendDispatch(
                                                               // overloads
 }
 
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+template <class NUMERIC_TYPE>
+basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>&
+basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::privateAppendNumber(
+                                                            NUMERIC_TYPE value)
+{
+    typedef BloombergLP::bslalg::NumericFormatterUtil Formatter;
+
+    // Decimal representations are much shorter than 'k_MAX_LENGTH_INT64',
+    // which is sized for base 2.
+
+    char        buffer[Formatter::k_MAX_LENGTH_INT64];
+    const char *end = Formatter::toChars(buffer,
+                                         buffer + sizeof buffer,
+                                         value);
+    BSLS_ASSERT_SAFE(end);
+
+    CHAR_TYPE       characters[sizeof buffer];
+    const size_type numChars = end - buffer;
+    for (size_type i = 0; i < numChars; ++i) {
+        characters[i] = CHAR_TYPE(buffer[i]);
+    }
+    return append(characters, numChars);
+}
+
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
 basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>&
 basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::privateAssign(
@@ -3722,6 +4085,62 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::append(INPUT_ITER first,
     return privateAppendDispatch(first, last);
 }
 
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>&
+basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::append(int value)
+{
+    return privateAppendNumber(value);
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>&
+basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::append(unsigned int value)
+{
+    return privateAppendNumber(value);
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>&
+basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::append(long value)
+{
+    return privateAppendNumber(value);
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>&
+basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::append(unsigned long value)
+{
+    return privateAppendNumber(value);
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>&
+basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::append(long long value)
+{
+    return privateAppendNumber(value);
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>&
+basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::append(unsigned long long value)
+{
+    return privateAppendNumber(value);
+}
+
+template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
+inline
+basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>&
+basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::append(double value)
+{
+    return privateAppendNumber(value);
+}
+
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
 void basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::push_back(
                                                            CHAR_TYPE character)
@@ -4575,26 +4994,15 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find(
 {
     BSLS_ASSERT_SAFE(substring);
 
-    size_type remChars = length() - position;
-    if (position > length() || numChars > remChars) {
+    if (position > length()) {
         return npos;                                                  // RETURN
     }
-    if (0 == numChars) {
-        return position;                                              // RETURN
-    }
-    const CHAR_TYPE *thisString = this->dataPtr() + position;
-    const CHAR_TYPE *nextString;
-    for (remChars -= numChars - 1;
-         0 != (nextString = BSLSTL_CHAR_TRAITS::find(thisString,
-                                                     remChars,
-                                                     *substring));
-         remChars -= ++nextString - thisString, thisString = nextString)
-    {
-        if (0 == CHAR_TRAITS::compare(nextString, substring, numChars)) {
-            return nextString - this->dataPtr();                      // RETURN
-        }
-    }
-    return npos;
+    const CHAR_TYPE *result = String_Search<CHAR_TYPE, CHAR_TRAITS>::find(
+                                                   this->dataPtr() + position,
+                                                   length() - position,
+                                                   substring,
+                                                   numChars);
+    return result ? result - this->dataPtr() : npos;
 }
 
 template <class CHAR_TYPE, class CHAR_TRAITS, class ALLOCATOR>
@@ -4650,13 +5058,14 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::rfind(
         if (position > length() - numChars) {
             position = length() - numChars;
         }
-        const CHAR_TYPE *thisString = this->dataPtr() + position;
-        for (; position != npos; --thisString, --position) {
-            if (0 == CHAR_TRAITS::compare(thisString,
-                                          characterString,
-                                          numChars)) {
-                return position;                                      // RETURN
-            }
+        const CHAR_TYPE *result =
+                           String_Search<CHAR_TYPE, CHAR_TRAITS>::findLast(
+                                                          this->dataPtr(),
+                                                          position + numChars,
+                                                          characterString,
+                                                          numChars);
+        if (result) {
+            return result - this->dataPtr();                          // RETURN
         }
     }
     return npos;
@@ -4707,14 +5116,14 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find_first_of(
     BSLS_ASSERT_SAFE(characterString || 0 == numChars);
 
     if (0 < numChars && position < length()) {
-        for (const CHAR_TYPE *current = this->dataPtr() + position;
-             current != this->dataPtr() + length();
-             ++current)
-        {
-            if (BSLSTL_CHAR_TRAITS::find(characterString, numChars, *current)
-                != 0) {
-                return current - this->dataPtr();                     // RETURN
-            }
+        const CHAR_TYPE *result =
+                        String_Search<CHAR_TYPE, CHAR_TRAITS>::findFirstOf(
+                                                   this->dataPtr() + position,
+                                                   length() - position,
+                                                   characterString,
+                                                   numChars);
+        if (result) {
+            return result - this->dataPtr();                          // RETURN
         }
     }
     return npos;
@@ -4767,17 +5176,14 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find_last_of(
 
     if (0 < numChars && 0 < length()) {
         size_type remChars = position < length() ? position : length() - 1;
-        for (const CHAR_TYPE *current = this->dataPtr() + remChars;
-             ;
-             --current)
-        {
-            if (BSLSTL_CHAR_TRAITS::find(
-                                        characterString, numChars, *current)) {
-                return current - this->dataPtr();                     // RETURN
-            }
-            if (current == this->dataPtr()) {
-                break;
-            }
+        const CHAR_TYPE *result =
+                         String_Search<CHAR_TYPE, CHAR_TRAITS>::findLastOf(
+                                                             this->dataPtr(),
+                                                             remChars + 1,
+                                                             characterString,
+                                                             numChars);
+        if (result) {
+            return result - this->dataPtr();                          // RETURN
         }
     }
     return npos;
@@ -4829,15 +5235,14 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find_first_not_of(
     BSLS_ASSERT_SAFE(characterString || 0 == numChars);
 
     if (position < length()) {
-        const CHAR_TYPE *last = this->dataPtr() + length();
-        for (const CHAR_TYPE *current = this->dataPtr() + position;
-             current != last;
-             ++current)
-        {
-            if (!BSLSTL_CHAR_TRAITS::find(
-                                        characterString, numChars, *current)) {
-                return current - this->dataPtr();                     // RETURN
-            }
+        const CHAR_TYPE *result =
+                     String_Search<CHAR_TYPE, CHAR_TRAITS>::findFirstNotOf(
+                                                   this->dataPtr() + position,
+                                                   length() - position,
+                                                   characterString,
+                                                   numChars);
+        if (result) {
+            return result - this->dataPtr();                          // RETURN
         }
     }
     return npos;
@@ -4890,14 +5295,14 @@ basic_string<CHAR_TYPE,CHAR_TRAITS,ALLOCATOR>::find_last_not_of (
 
     if (0 < length()) {
         size_type remChars = position < length() ? position : length() - 1;
-        for (const CHAR_TYPE *current = this->dataPtr() + remChars;
-             remChars != npos;
-             --current, --remChars)
-        {
-            if (!BSLSTL_CHAR_TRAITS::find(
-                                        characterString, numChars, *current)) {
-                return current - this->dataPtr();                     // RETURN
-            }
+        const CHAR_TYPE *result =
+                      String_Search<CHAR_TYPE, CHAR_TRAITS>::findLastNotOf(
+                                                             this->dataPtr(),
+                                                             remChars + 1,
+                                                             characterString,
+                                                             numChars);
+        if (result) {
+            return result - this->dataPtr();                          // RETURN
         }
     }
     return npos;
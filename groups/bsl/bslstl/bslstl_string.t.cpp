@@ -149,6 +149,13 @@ using namespace std;
 // [17] string& append(size_type n, C c);
 // [17] template <class InputIter>
 //        string& append(InputIter first, InputIter last);
+// [30] string& append(int value);
+// [30] string& append(unsigned int value);
+// [30] string& append(long value);
+// [30] string& append(unsigned long value);
+// [30] string& append(long long value);
+// [30] string& append(unsigned long long value);
+// [30] string& append(double value);
 // [ 2] void push_back(C c);
 // [18] string& insert(size_type pos1, const string& str);
 // [18] string& insert(size_type pos1, const string& str, pos2, n);
@@ -921,6 +928,9 @@ struct TestDriver {
         // specifications, and check that the specified 'result' agrees.
 
     // TEST CASES
+    static void testCase30();
+        // Test 'append' of numeric values.
+
     static void testCase29();
         // Test the hash append specialization.
 
@@ -1206,6 +1216,187 @@ void TestDriver<TYPE,TRAITS,ALLOC>::checkCompare(const Obj& X,
                                  // ----------
                                  // TEST CASES
                                  // ----------
+template <class TYPE, class TRAITS, class ALLOC>
+void TestDriver<TYPE,TRAITS,ALLOC>::testCase30()
+{
+    // --------------------------------------------------------------------
+    // TESTING 'append' OF NUMERIC VALUES
+    //
+    // Concerns:
+    //: 1 Each overload appends the representation written by
+    //:   'bslalg::NumericFormatterUtil::toChars', widened to 'TYPE', after the
+    //:   existing contents of the string, which are preserved.
+    //:
+    //: 2 The string remains null-terminated.
+    //:
+    //: 3 Memory is allocated only from the string's allocator, and only when
+    //:   the capacity of the string must grow.
+    //
+    // Plan:
+    //: 1 For a set of values of each numeric type, and for initial strings of
+    //:   several lengths (including lengths at which appending crosses the
+    //:   short-string capacity), append the value and compare the result with
+    //:   a string built by appending the characters one by one.  (C-1, 2)
+    //:
+    //: 2 Verify that the default allocator is not used, and that no memory
+    //:   is allocated when the capacity suffices.  (C-3)
+    //
+    // Testing:
+    //   string& append(int value);
+    //   string& append(unsigned int value);
+    //   string& append(long value);
+    //   string& append(unsigned long value);
+    //   string& append(long long value);
+    //   string& append(unsigned long long value);
+    //   string& append(double value);
+    // --------------------------------------------------------------------
+
+    typedef BloombergLP::bslalg::NumericFormatterUtil Formatter;
+
+    bslma::TestAllocator testAllocator(veryVeryVerbose);
+    const Int64          DEFAULT_BLOCKS = defaultAllocator_p->numBlocksTotal();
+
+    static const char *const PREFIXES[] = {
+        "",
+        "a",
+        "abcdefghij",
+        "abcdefghijklmnopqrstuvwxyz",
+    };
+    const int NUM_PREFIXES = sizeof PREFIXES / sizeof *PREFIXES;
+
+    static const double DOUBLES[] = {
+        0.0, -0.0, 1.0, -2.5, 101.25, 0.1, 1.0 / 3, 1e22, 6.02214076e-23,
+        1.7976931348623157e308
+    };
+    const int NUM_DOUBLES = sizeof DOUBLES / sizeof *DOUBLES;
+
+    static const long long INTEGERS[] = {
+        0, 1, -1, 42, -1042, 2147483647LL, -2147483647LL - 1,
+        9223372036854775807LL, -9223372036854775807LL - 1
+    };
+    const int NUM_INTEGERS = sizeof INTEGERS / sizeof *INTEGERS;
+
+    for (int pi = 0; pi < NUM_PREFIXES; ++pi) {
+        const char *const PREFIX = PREFIXES[pi];
+
+        for (int vi = 0; vi < NUM_INTEGERS + NUM_DOUBLES; ++vi) {
+            const bool      IS_INTEGER = vi < NUM_INTEGERS;
+            const long long INTEGER    = IS_INTEGER ? INTEGERS[vi] : 0;
+            const double    DOUBLE     = IS_INTEGER
+                                       ? 0
+                                       : DOUBLES[vi - NUM_INTEGERS];
+
+            // Each integral value is appended with each of the six integral
+            // overloads whose parameter type can represent it.
+
+            for (int ti = 0; ti < (IS_INTEGER ? 6 : 1); ++ti) {
+                const bool FITS_INT      = -2147483647LL - 1 <= INTEGER
+                                        && INTEGER <= 2147483647LL;
+                const bool FITS_UNSIGNED = 0 <= INTEGER
+                                        && INTEGER <= 4294967295LL;
+                const bool FITS_LONG     = sizeof(long) == 8 || FITS_INT;
+                const bool FITS_ULONG    = sizeof(long) == 8
+                                         ? 0 <= INTEGER
+                                         : FITS_UNSIGNED;
+                const bool FITS_ULLONG   = 0 <= INTEGER;
+
+                char  buffer[Formatter::k_MAX_LENGTH_INT64];
+                char *end = 0;
+
+                AllocType  allocator(&testAllocator);
+                Obj        mX(allocator);  const Obj& X = mX;
+                Obj        mY(allocator);  const Obj& Y = mY;
+                for (const char *p = PREFIX; *p; ++p) {
+                    mX.push_back(TYPE(*p));
+                    mY.push_back(TYPE(*p));
+                }
+
+                if (!IS_INTEGER) {
+                    end = Formatter::toChars(buffer,
+                                             buffer + sizeof buffer,
+                                             DOUBLE);
+                    mX.append(DOUBLE);
+                }
+                else if (0 == ti && FITS_INT) {
+                    const int VALUE = static_cast<int>(INTEGER);
+                    end = Formatter::toChars(buffer,
+                                             buffer + sizeof buffer,
+                                             VALUE);
+                    mX.append(VALUE);
+                }
+                else if (1 == ti && FITS_UNSIGNED) {
+                    const unsigned int VALUE =
+                                            static_cast<unsigned int>(INTEGER);
+                    end = Formatter::toChars(buffer,
+                                             buffer + sizeof buffer,
+                                             VALUE);
+                    mX.append(VALUE);
+                }
+                else if (2 == ti && FITS_LONG) {
+                    const long VALUE = static_cast<long>(INTEGER);
+                    end = Formatter::toChars(buffer,
+                                             buffer + sizeof buffer,
+                                             VALUE);
+                    mX.append(VALUE);
+                }
+                else if (3 == ti && FITS_ULONG) {
+                    const unsigned long VALUE =
+                                           static_cast<unsigned long>(INTEGER);
+                    end = Formatter::toChars(buffer,
+                                             buffer + sizeof buffer,
+                                             VALUE);
+                    mX.append(VALUE);
+                }
+                else if (4 == ti) {
+                    end = Formatter::toChars(buffer,
+                                             buffer + sizeof buffer,
+                                             INTEGER);
+                    mX.append(INTEGER);
+                }
+                else if (5 == ti && FITS_ULLONG) {
+                    const unsigned long long VALUE =
+                                      static_cast<unsigned long long>(INTEGER);
+                    end = Formatter::toChars(buffer,
+                                             buffer + sizeof buffer,
+                                             VALUE);
+                    mX.append(VALUE);
+                }
+                else {
+                    continue;
+                }
+
+                for (const char *p = buffer; p != end; ++p) {
+                    mY.push_back(TYPE(*p));
+                }
+
+                if (veryVerbose) {
+                    printf("\tprefix %d, value %d, overload %d\n", pi, vi, ti);
+                }
+
+                LOOP3_ASSERT(pi, vi, ti, Y == X);
+                LOOP3_ASSERT(pi, vi, ti, TYPE() == X.c_str()[X.length()]);
+            }
+        }
+    }
+
+    if (verbose) printf("\tTesting that no memory is allocated when the"
+                        " capacity suffices.\n");
+    {
+        AllocType  allocator(&testAllocator);
+        Obj        mX(allocator);  const Obj& X = mX;
+        mX.reserve(200);
+
+        const Int64 BLOCKS = testAllocator.numBlocksTotal();
+        mX.append(-1042);
+        mX.append(18446744073709551615ULL);
+        mX.append(-1.7976931348623157e308);
+        ASSERT(BLOCKS == testAllocator.numBlocksTotal());
+        ASSERT(5 + 20 + 24 == X.length());
+    }
+
+    ASSERT(DEFAULT_BLOCKS == defaultAllocator_p->numBlocksTotal());
+}
+
 template <class TYPE, class TRAITS, class ALLOC>
 void TestDriver<TYPE,TRAITS,ALLOC>::testCase29()
 {
@@ -14091,7 +14282,7 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 30: {
+      case 31: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -14303,6 +14494,37 @@ int main(int argc, char *argv[])
             }
         }
       } break;
+      case 30: {
+        // --------------------------------------------------------------------
+        // TESTING 'append' OF NUMERIC VALUES
+        //
+        // Concerns:
+        //: 1 Numeric values are appended as their decimal representation,
+        //:   for every character type.
+        //
+        // Plan:
+        //: 1 Run 'testCase30' for 'char' and 'wchar_t'.  (C-1)
+        //
+        // Testing:
+        //   string& append(int value);
+        //   string& append(unsigned int value);
+        //   string& append(long value);
+        //   string& append(unsigned long value);
+        //   string& append(long long value);
+        //   string& append(unsigned long long value);
+        //   string& append(double value);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'append' OF NUMERIC VALUES"
+                            "\n==================================\n");
+
+        if (verbose) printf("\n... with 'char'.\n");
+        TestDriver<char>::testCase30();
+
+        if (verbose) printf("\n... with 'wchar_t'.\n");
+        TestDriver<wchar_t>::testCase30();
+
+      } break;
       case 29: {
         // --------------------------------------------------------------------
         // TESTING 'hashAppend'
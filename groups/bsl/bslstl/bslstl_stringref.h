@@ -110,6 +110,10 @@ BSLS_IDENT("$Id: $")
 // is applied to the string in order to locate its end.  There are *no*
 // allocations done on behalf of the temporary object.
 //
+// Finally, 'operator==' and 'operator!=' compare the lengths of their
+// arguments before their characters, so strings of different lengths are
+// found to be unequal in constant time.
+//
 ///Caveats
 ///-------
 // 1) The string referenced by 'bslstl::StringRef' need not be null-terminated,
@@ -949,7 +953,10 @@ inline
 bool bslstl::operator==(const StringRefImp<CHAR_TYPE>& lhs,
                         const StringRefImp<CHAR_TYPE>& rhs)
 {
-    return lhs.compare(rhs) == 0;
+    return lhs.length() == rhs.length()
+        && 0 == native_std::char_traits<CHAR_TYPE>::compare(lhs.data(),
+                                                            rhs.data(),
+                                                            lhs.length());
 }
 
 template <typename CHAR_TYPE>
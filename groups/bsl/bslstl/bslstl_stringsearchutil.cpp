@@ -0,0 +1,711 @@
+// bslstl_stringsearchutil.cpp                                        -*-C++-*-
+#include <bslstl_stringsearchutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_assert.h>
+#include <bsls_atomicoperations.h>
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#include <string.h>
+
+#ifdef BSLSTL_STRINGSEARCHUTIL_X86
+#error BSLSTL_STRINGSEARCHUTIL_X86 must be a macro scoped locally to this file
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BSLSTL_STRINGSEARCHUTIL_X86 1
+#include <immintrin.h>
+#endif
+
+///IMPLEMENTATION NOTES
+///--------------------
+// SSE2 is part of the x86-64 base instruction set, so the SSE2 kernels are
+// compiled for every x86-64 target.  The AVX2 kernels are compiled with the
+// 'target' function attribute, which lets them use AVX2 instructions without
+// requiring AVX2 of the rest of the translation unit, and are called only
+// after 'supportedInstructionSet' has confirmed that the host supports AVX2.
+//
+// Every kernel loads only complete blocks lying within the searched sequence,
+// and examines the remaining (fewer than one block) positions one character at
+// a time.
+
+namespace BloombergLP {
+namespace bslstl {
+
+namespace {
+
+typedef StringSearchUtil Util;
+
+bsls::AtomicOperations::AtomicTypes::Int s_instructionSet;
+    // One more than the 'Util::InstructionSet' in use, or 0 if it has not yet
+    // been determined.  Zero-initialized before any dynamic initialization.
+
+Util::InstructionSet currentInstructionSet()
+    // Return the instruction set in use, determining it first if necessary.
+{
+    int value = bsls::AtomicOperations::getIntRelaxed(&s_instructionSet);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == value)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // Concurrent first calls compute and store the same value.
+
+        value = Util::supportedInstructionSet() + 1;
+        bsls::AtomicOperations::setIntRelaxed(&s_instructionSet, value);
+    }
+    return static_cast<Util::InstructionSet>(value - 1);
+}
+
+                        // ==================
+                        // class CharacterSet
+                        // ==================
+
+class CharacterSet {
+    // This class provides a set of 'char' values, represented as a 256-bit
+    // table, that supports membership tests in constant time.
+
+    // DATA
+    unsigned int d_bits[256 / 32];  // bit 'c % 32' of word 'c / 32' is set
+                                    // if 'c' is a member
+
+  public:
+    // CREATORS
+    CharacterSet(const char *characters, size_t numCharacters);
+        // Create a set of the specified 'numCharacters' characters at the
+        // specified 'characters' address.
+
+    // ACCESSORS
+    bool contains(char character) const;
+        // Return 'true' if the specified 'character' is a member of this set,
+        // and 'false' otherwise.
+};
+
+                        // ------------------
+                        // class CharacterSet
+                        // ------------------
+
+// CREATORS
+CharacterSet::CharacterSet(const char *characters, size_t numCharacters)
+{
+    memset(d_bits, 0, sizeof d_bits);
+
+    for (size_t i = 0; i < numCharacters; ++i) {
+        const unsigned char c = static_cast<unsigned char>(characters[i]);
+        d_bits[c >> 5] |= 1u << (c & 31);
+    }
+}
+
+// ACCESSORS
+inline
+bool CharacterSet::contains(char character) const
+{
+    const unsigned char c = static_cast<unsigned char>(character);
+    return (d_bits[c >> 5] >> (c & 31)) & 1;
+}
+
+                        // ------------------
+                        // portable functions
+                        // ------------------
+
+inline
+bool matchesAt(const char *position,
+               const char *substring,
+               size_t      substringLength)
+    // Return 'true' if the specified 'substringLength' characters at the
+    // specified 'position' are equal to those of the specified 'substring',
+    // and 'false' otherwise.  The behavior is undefined unless
+    // '2 <= substringLength'.  Note that the first and last characters are
+    // compared before the others, matching the filter of the vectorized
+    // kernels.
+{
+    return position[0] == substring[0]
+        && position[substringLength - 1] == substring[substringLength - 1]
+        && 0 == memcmp(position + 1, substring + 1, substringLength - 2);
+}
+
+const char *findPortable(const char *string,
+                         size_t      begin,
+                         size_t      numPositions,
+                         const char *substring,
+                         size_t      substringLength)
+    // Return the address of the first position in the range
+    // '[begin, numPositions)' of the specified 'string' at which the specified
+    // 'substring' having the specified 'substringLength' occurs, or 0 if there
+    // is no such position.  The behavior is undefined unless
+    // '2 <= substringLength' and 'string' holds at least
+    // 'numPositions + substringLength - 1' characters.
+{
+    const char *current = string + begin;
+    const char *last    = string + numPositions;
+
+    while (current != last) {
+        current = static_cast<const char *>(
+                                memchr(current, substring[0], last - current));
+        if (0 == current) {
+            return 0;                                                 // RETURN
+        }
+        if (matchesAt(current, substring, substringLength)) {
+            return current;                                           // RETURN
+        }
+        ++current;
+    }
+    return 0;
+}
+
+const char *findLastPortable(const char *string,
+                             size_t      numPositions,
+                             const char *substring,
+                             size_t      substringLength)
+    // Return the address of the last position in the range
+    // '[0, numPositions)' of the specified 'string' at which the specified
+    // 'substring' having the specified 'substringLength' occurs, or 0 if there
+    // is no such position.  The behavior is undefined unless
+    // '2 <= substringLength' and 'string' holds at least
+    // 'numPositions + substringLength - 1' characters.
+{
+    for (const char *current = string + numPositions; current != string;) {
+        --current;
+        if (matchesAt(current, substring, substringLength)) {
+            return current;                                           // RETURN
+        }
+    }
+    return 0;
+}
+
+const char *findFirstInSetPortable(const char          *string,
+                                   size_t               length,
+                                   const CharacterSet&  set,
+                                   bool                 isMember)
+    // Return the address of the first character in the specified 'string'
+    // having the specified 'length' whose membership in the specified 'set'
+    // is the specified 'isMember', or 0 if there is no such character.
+{
+    const char *end = string + length;
+
+    for (const char *current = string; current != end; ++current) {
+        if (set.contains(*current) == isMember) {
+            return current;                                           // RETURN
+        }
+    }
+    return 0;
+}
+
+const char *findLastInSetPortable(const char          *string,
+                                  size_t               length,
+                                  const CharacterSet&  set,
+                                  bool                 isMember)
+    // Return the address of the last character in the specified 'string'
+    // having the specified 'length' whose membership in the specified 'set'
+    // is the specified 'isMember', or 0 if there is no such character.
+{
+    for (const char *current = string + length; current != string;) {
+        --current;
+        if (set.contains(*current) == isMember) {
+            return current;                                           // RETURN
+        }
+    }
+    return 0;
+}
+
+const char *findFirstInShortSet(const char *string,
+                                size_t      length,
+                                const char *characterSet,
+                                size_t      setLength,
+                                bool        isMember)
+    // Return the address of the first character in the specified 'string'
+    // having the specified 'length' whose membership in the specified
+    // 'characterSet' having the specified 'setLength' is the specified
+    // 'isMember', or 0 if there is no such character.  Note that this function
+    // is intended for the few characters following the last complete block
+    // examined by a vectorized kernel, for which building a 'CharacterSet'
+    // would not pay off.
+{
+    const char *end = string + length;
+
+    for (const char *current = string; current != end; ++current) {
+        if ((0 != memchr(characterSet, *current, setLength)) == isMember) {
+            return current;                                           // RETURN
+        }
+    }
+    return 0;
+}
+
+#ifdef BSLSTL_STRINGSEARCHUTIL_X86
+
+                        // --------------
+                        // SSE2 functions
+                        // --------------
+
+const char *findSse2(const char *string,
+                     size_t      numPositions,
+                     const char *substring,
+                     size_t      substringLength)
+    // Return the address of the first position in the range
+    // '[0, numPositions)' of the specified 'string' at which the specified
+    // 'substring' having the specified 'substringLength' occurs, or 0 if there
+    // is no such position.  The behavior is undefined unless
+    // '2 <= substringLength' and 'string' holds
+    // 'numPositions + substringLength - 1' characters.
+{
+    const size_t  lastOffset = substringLength - 1;
+    const __m128i first      = _mm_set1_epi8(substring[0]);
+    const __m128i last       = _mm_set1_epi8(substring[lastOffset]);
+
+    size_t i = 0;
+    for (; i + 16 <= numPositions; i += 16) {
+        const __m128i blockFirst = _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(string + i));
+        const __m128i blockLast  = _mm_loadu_si128(
+                   reinterpret_cast<const __m128i *>(string + i + lastOffset));
+
+        unsigned int mask = _mm_movemask_epi8(
+                             _mm_and_si128(_mm_cmpeq_epi8(blockFirst, first),
+                                           _mm_cmpeq_epi8(blockLast,  last)));
+        while (mask) {
+            const char *candidate = string + i + __builtin_ctz(mask);
+
+            if (0 == memcmp(candidate + 1, substring + 1, lastOffset - 1)) {
+                return candidate;                                     // RETURN
+            }
+            mask &= mask - 1;
+        }
+    }
+    return findPortable(string, i, numPositions, substring, substringLength);
+}
+
+const char *findLastSse2(const char *string,
+                         size_t      numPositions,
+                         const char *substring,
+                         size_t      substringLength)
+    // Return the address of the last position in the range
+    // '[0, numPositions)' of the specified 'string' at which the specified
+    // 'substring' having the specified 'substringLength' occurs, or 0 if there
+    // is no such position.  The behavior is undefined unless
+    // '2 <= substringLength' and 'string' holds
+    // 'numPositions + substringLength - 1' characters.
+{
+    const size_t  lastOffset = substringLength - 1;
+    const __m128i first      = _mm_set1_epi8(substring[0]);
+    const __m128i last       = _mm_set1_epi8(substring[lastOffset]);
+
+    size_t i = numPositions;
+    while (i >= 16) {
+        i -= 16;
+
+        const __m128i blockFirst = _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(string + i));
+        const __m128i blockLast  = _mm_loadu_si128(
+                   reinterpret_cast<const __m128i *>(string + i + lastOffset));
+
+        unsigned int mask = _mm_movemask_epi8(
+                             _mm_and_si128(_mm_cmpeq_epi8(blockFirst, first),
+                                           _mm_cmpeq_epi8(blockLast,  last)));
+        while (mask) {
+            const int   bit       = 31 - __builtin_clz(mask);
+            const char *candidate = string + i + bit;
+
+            if (0 == memcmp(candidate + 1, substring + 1, lastOffset - 1)) {
+                return candidate;                                     // RETURN
+            }
+            mask &= ~(1u << bit);
+        }
+    }
+    return findLastPortable(string, i, substring, substringLength);
+}
+
+const char *findFirstInSetSse2(const char *string,
+                               size_t      length,
+                               const char *characterSet,
+                               size_t      setLength,
+                               bool        isMember)
+    // Return the address of the first character in the specified 'string'
+    // having the specified 'length' whose membership in the specified
+    // 'characterSet' having the specified 'setLength' is the specified
+    // 'isMember', or 0 if there is no such character.  The behavior is
+    // undefined unless '1 <= setLength <= Util::k_MAX_VECTOR_SET_LENGTH'.
+{
+    __m128i members[Util::k_MAX_VECTOR_SET_LENGTH];
+    for (size_t j = 0; j < setLength; ++j) {
+        members[j] = _mm_set1_epi8(characterSet[j]);
+    }
+
+    const unsigned int invert = isMember ? 0 : 0xffff;
+
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        const __m128i block = _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(string + i));
+
+        __m128i hits = _mm_cmpeq_epi8(block, members[0]);
+        for (size_t j = 1; j < setLength; ++j) {
+            hits = _mm_or_si128(hits, _mm_cmpeq_epi8(block, members[j]));
+        }
+
+        const unsigned int mask = _mm_movemask_epi8(hits) ^ invert;
+        if (mask) {
+            return string + i + __builtin_ctz(mask);                  // RETURN
+        }
+    }
+    return findFirstInShortSet(string + i,
+                               length - i,
+                               characterSet,
+                               setLength,
+                               isMember);
+}
+
+                        // --------------
+                        // AVX2 functions
+                        // --------------
+
+__attribute__((target("avx2")))
+const char *findAvx2(const char *string,
+                     size_t      numPositions,
+                     const char *substring,
+                     size_t      substringLength)
+    // Return the address of the first position in the range
+    // '[0, numPositions)' of the specified 'string' at which the specified
+    // 'substring' having the specified 'substringLength' occurs, or 0 if there
+    // is no such position.  The behavior is undefined unless
+    // '2 <= substringLength', 'string' holds
+    // 'numPositions + substringLength - 1' characters, and the host supports
+    // AVX2.
+{
+    const size_t  lastOffset = substringLength - 1;
+    const __m256i first      = _mm256_set1_epi8(substring[0]);
+    const __m256i last       = _mm256_set1_epi8(substring[lastOffset]);
+
+    size_t i = 0;
+    for (; i + 32 <= numPositions; i += 32) {
+        const __m256i blockFirst = _mm256_loadu_si256(
+                                reinterpret_cast<const __m256i *>(string + i));
+        const __m256i blockLast  = _mm256_loadu_si256(
+                   reinterpret_cast<const __m256i *>(string + i + lastOffset));
+
+        unsigned int mask = _mm256_movemask_epi8(
+                       _mm256_and_si256(_mm256_cmpeq_epi8(blockFirst, first),
+                                        _mm256_cmpeq_epi8(blockLast,  last)));
+        while (mask) {
+            const char *candidate = string + i + __builtin_ctz(mask);
+
+            if (0 == memcmp(candidate + 1, substring + 1, lastOffset - 1)) {
+                return candidate;                                     // RETURN
+            }
+            mask &= mask - 1;
+        }
+    }
+    return findPortable(string, i, numPositions, substring, substringLength);
+}
+
+__attribute__((target("avx2")))
+const char *findLastAvx2(const char *string,
+                         size_t      numPositions,
+                         const char *substring,
+                         size_t      substringLength)
+    // Return the address of the last position in the range
+    // '[0, numPositions)' of the specified 'string' at which the specified
+    // 'substring' having the specified 'substringLength' occurs, or 0 if there
+    // is no such position.  The behavior is undefined unless
+    // '2 <= substringLength', 'string' holds
+    // 'numPositions + substringLength - 1' characters, and the host supports
+    // AVX2.
+{
+    const size_t  lastOffset = substringLength - 1;
+    const __m256i first      = _mm256_set1_epi8(substring[0]);
+    const __m256i last       = _mm256_set1_epi8(substring[lastOffset]);
+
+    size_t i = numPositions;
+    while (i >= 32) {
+        i -= 32;
+
+        const __m256i blockFirst = _mm256_loadu_si256(
+                                reinterpret_cast<const __m256i *>(string + i));
+        const __m256i blockLast  = _mm256_loadu_si256(
+                   reinterpret_cast<const __m256i *>(string + i + lastOffset));
+
+        unsigned int mask = _mm256_movemask_epi8(
+                       _mm256_and_si256(_mm256_cmpeq_epi8(blockFirst, first),
+                                        _mm256_cmpeq_epi8(blockLast,  last)));
+        while (mask) {
+            const int   bit       = 31 - __builtin_clz(mask);
+            const char *candidate = string + i + bit;
+
+            if (0 == memcmp(candidate + 1, substring + 1, lastOffset - 1)) {
+                return candidate;                                     // RETURN
+            }
+            mask &= ~(1u << bit);
+        }
+    }
+    return findLastPortable(string, i, substring, substringLength);
+}
+
+__attribute__((target("avx2")))
+const char *findFirstInSetAvx2(const char *string,
+                               size_t      length,
+                               const char *characterSet,
+                               size_t      setLength,
+                               bool        isMember)
+    // Return the address of the first character in the specified 'string'
+    // having the specified 'length' whose membership in the specified
+    // 'characterSet' having the specified 'setLength' is the specified
+    // 'isMember', or 0 if there is no such character.  The behavior is
+    // undefined unless '1 <= setLength <= Util::k_MAX_VECTOR_SET_LENGTH' and
+    // the host supports AVX2.
+{
+    __m256i members[Util::k_MAX_VECTOR_SET_LENGTH];
+    for (size_t j = 0; j < setLength; ++j) {
+        members[j] = _mm256_set1_epi8(characterSet[j]);
+    }
+
+    const unsigned int invert = isMember ? 0 : 0xffffffffu;
+
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32) {
+        const __m256i block = _mm256_loadu_si256(
+                                reinterpret_cast<const __m256i *>(string + i));
+
+        __m256i hits = _mm256_cmpeq_epi8(block, members[0]);
+        for (size_t j = 1; j < setLength; ++j) {
+            hits = _mm256_or_si256(hits, _mm256_cmpeq_epi8(block, members[j]));
+        }
+
+        const unsigned int mask =
+                static_cast<unsigned int>(_mm256_movemask_epi8(hits)) ^ invert;
+        if (mask) {
+            return string + i + __builtin_ctz(mask);                  // RETURN
+        }
+    }
+    return findFirstInShortSet(string + i,
+                               length - i,
+                               characterSet,
+                               setLength,
+                               isMember);
+}
+
+#endif  // BSLSTL_STRINGSEARCHUTIL_X86
+
+const char *findFirstInSet(const char *string,
+                           size_t      length,
+                           const char *characterSet,
+                           size_t      setLength,
+                           bool        isMember)
+    // Return the address of the first character in the specified 'string'
+    // having the specified 'length' whose membership in the specified
+    // 'characterSet' having the specified 'setLength' is the specified
+    // 'isMember', or 0 if there is no such character.
+{
+    if (0 < setLength && setLength <= Util::k_MAX_VECTOR_SET_LENGTH) {
+        switch (currentInstructionSet()) {
+#ifdef BSLSTL_STRINGSEARCHUTIL_X86
+          case Util::e_AVX2: {
+            return findFirstInSetAvx2(string,
+                                      length,
+                                      characterSet,
+                                      setLength,
+                                      isMember);                      // RETURN
+          }
+          case Util::e_SSE2: {
+            return findFirstInSetSse2(string,
+                                      length,
+                                      characterSet,
+                                      setLength,
+                                      isMember);                      // RETURN
+          }
+#endif
+          default: {
+          } break;
+        }
+    }
+    return findFirstInSetPortable(string,
+                                  length,
+                                  CharacterSet(characterSet, setLength),
+                                  isMember);
+}
+
+}  // close unnamed namespace
+
+                          // -----------------------
+                          // struct StringSearchUtil
+                          // -----------------------
+
+// CLASS METHODS
+const char *StringSearchUtil::find(const char *string,
+                                   size_t      length,
+                                   const char *substring,
+                                   size_t      substringLength)
+{
+    BSLS_ASSERT_SAFE(string    || 0 == length);
+    BSLS_ASSERT_SAFE(substring || 0 == substringLength);
+
+    if (substringLength > length) {
+        return 0;                                                     // RETURN
+    }
+    if (substringLength <= 1) {
+        return 0 == substringLength
+               ? string
+               : static_cast<const char *>(
+                                    memchr(string, substring[0], length));
+                                                                      // RETURN
+    }
+
+    const size_t numPositions = length - substringLength + 1;
+
+    switch (currentInstructionSet()) {
+#ifdef BSLSTL_STRINGSEARCHUTIL_X86
+      case e_AVX2: {
+        return findAvx2(string, numPositions, substring, substringLength);
+                                                                      // RETURN
+      }
+      case e_SSE2: {
+        return findSse2(string, numPositions, substring, substringLength);
+                                                                      // RETURN
+      }
+#endif
+      default: {
+      } break;
+    }
+    return findPortable(string, 0, numPositions, substring, substringLength);
+}
+
+const char *StringSearchUtil::findLast(const char *string,
+                                       size_t      length,
+                                       const char *substring,
+                                       size_t      substringLength)
+{
+    BSLS_ASSERT_SAFE(string    || 0 == length);
+    BSLS_ASSERT_SAFE(substring || 0 == substringLength);
+
+    if (substringLength > length) {
+        return 0;                                                     // RETURN
+    }
+    if (substringLength <= 1) {
+        return 0 == substringLength
+               ? string + length
+               : findLastInSetPortable(string,
+                                       length,
+                                       CharacterSet(substring, 1),
+                                       true);                         // RETURN
+    }
+
+    const size_t numPositions = length - substringLength + 1;
+
+    switch (currentInstructionSet()) {
+#ifdef BSLSTL_STRINGSEARCHUTIL_X86
+      case e_AVX2: {
+        return findLastAvx2(string, numPositions, substring, substringLength);
+                                                                      // RETURN
+      }
+      case e_SSE2: {
+        return findLastSse2(string, numPositions, substring, substringLength);
+                                                                      // RETURN
+      }
+#endif
+      default: {
+      } break;
+    }
+    return findLastPortable(string, numPositions, substring, substringLength);
+}
+
+const char *StringSearchUtil::findFirstOf(const char *string,
+                                          size_t      length,
+                                          const char *characterSet,
+                                          size_t      setLength)
+{
+    BSLS_ASSERT_SAFE(string       || 0 == length);
+    BSLS_ASSERT_SAFE(characterSet || 0 == setLength);
+
+    if (0 == setLength) {
+        return 0;                                                     // RETURN
+    }
+    if (1 == setLength) {
+        return static_cast<const char *>(
+                                     memchr(string, characterSet[0], length));
+                                                                      // RETURN
+    }
+    return findFirstInSet(string, length, characterSet, setLength, true);
+}
+
+const char *StringSearchUtil::findFirstNotOf(const char *string,
+                                             size_t      length,
+                                             const char *characterSet,
+                                             size_t      setLength)
+{
+    BSLS_ASSERT_SAFE(string       || 0 == length);
+    BSLS_ASSERT_SAFE(characterSet || 0 == setLength);
+
+    return findFirstInSet(string, length, characterSet, setLength, false);
+}
+
+const char *StringSearchUtil::findLastOf(const char *string,
+                                         size_t      length,
+                                         const char *characterSet,
+                                         size_t      setLength)
+{
+    BSLS_ASSERT_SAFE(string       || 0 == length);
+    BSLS_ASSERT_SAFE(characterSet || 0 == setLength);
+
+    return findLastInSetPortable(string,
+                                 length,
+                                 CharacterSet(characterSet, setLength),
+                                 true);
+}
+
+const char *StringSearchUtil::findLastNotOf(const char *string,
+                                            size_t      length,
+                                            const char *characterSet,
+                                            size_t      setLength)
+{
+    BSLS_ASSERT_SAFE(string       || 0 == length);
+    BSLS_ASSERT_SAFE(characterSet || 0 == setLength);
+
+    return findLastInSetPortable(string,
+                                 length,
+                                 CharacterSet(characterSet, setLength),
+                                 false);
+}
+
+StringSearchUtil::InstructionSet StringSearchUtil::instructionSet()
+{
+    return currentInstructionSet();
+}
+
+void StringSearchUtil::setInstructionSet(InstructionSet value)
+{
+    BSLS_ASSERT(value <= supportedInstructionSet());
+
+    bsls::AtomicOperations::setIntRelaxed(&s_instructionSet, value + 1);
+}
+
+StringSearchUtil::InstructionSet StringSearchUtil::supportedInstructionSet()
+{
+#ifdef BSLSTL_STRINGSEARCHUTIL_X86
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") ? e_AVX2 : e_SSE2;
+#else
+    return e_PORTABLE;
+#endif
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#undef BSLSTL_STRINGSEARCHUTIL_X86
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
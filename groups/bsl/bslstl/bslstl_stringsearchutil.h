@@ -0,0 +1,226 @@
+// bslstl_stringsearchutil.h                                          -*-C++-*-
+#ifndef INCLUDED_BSLSTL_STRINGSEARCHUTIL
+#define INCLUDED_BSLSTL_STRINGSEARCHUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide vectorized search functions for sequences of 'char'.
+//
+//@CLASSES:
+//  bslstl::StringSearchUtil: namespace for 'char' sequence search functions
+//
+//@SEE_ALSO: bslstl_string, bslstl_stringref
+//
+//@DESCRIPTION: This component provides a 'struct', 'bslstl::StringSearchUtil',
+// that serves as a namespace for functions that search a sequence of 'char'
+// for a substring, or for the first or last character that is (or is not) a
+// member of a set of characters.  These functions supply the implementation
+// of the 'find', 'rfind', 'find_first_of', 'find_last_of',
+// 'find_first_not_of', and 'find_last_not_of' methods of 'bsl::string'.
+//
+///Instruction Sets
+///----------------
+// On x86-64 platforms built with a GCC-compatible compiler, the substring
+// searches and the 'findFirstOf' and 'findFirstNotOf' functions examine 16
+// (SSE2) or 32 (AVX2) characters per step.  The widest instruction set
+// supported by the host processor is determined when a function of this
+// component is first called, so a single binary runs on processors with and
+// without AVX2.  On all other platforms, and for sets of more than
+// 'k_MAX_VECTOR_SET_LENGTH' characters, a portable implementation is used that
+// tests set membership with a 256-bit table built on entry.
+//
+// The 'setInstructionSet' function allows a test driver or a benchmark to
+// select a narrower instruction set than the one supported by the host; it is
+// not intended for use in production code.
+//
+// Substring searches compare the first and the last character of the
+// substring against consecutive blocks of the searched sequence in parallel,
+// and compare the remaining characters only at the positions where both
+// match.  The characters of the searched sequence are read at most once per
+// block, and no character beyond the end of either sequence is ever read.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Splitting a FIX Message into Fields
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// A FIX message is a sequence of 'tag=value' fields, each terminated by the
+// SOH ('\x01') character.  In this example we extract the tag and the value
+// of each field using 'findFirstOf'.
+//
+// First, we define a message holding three fields:
+//..
+//  const char   *message = "8=FIX.4.2\x01" "35=D\x01" "55=IBM\x01";
+//  const size_t  length  = strlen(message);
+//..
+// Then, we search for the end of the tag, and of the value, of each field in
+// turn:
+//..
+//  const char *tags[3];
+//  const char *values[3];
+//  int         numFields = 0;
+//
+//  const char *current = message;
+//  const char *end     = message + length;
+//  while (current != end) {
+//      const char *equals = bslstl::StringSearchUtil::findFirstOf(
+//                                                             current,
+//                                                             end - current,
+//                                                             "=\x01",
+//                                                             2);
+//      assert(equals && '=' == *equals);
+//
+//      const char *soh = bslstl::StringSearchUtil::findFirstOf(
+//                                                            equals,
+//                                                            end - equals,
+//                                                            "\x01",
+//                                                            1);
+//      assert(soh);
+//
+//      tags[numFields]   = current;
+//      values[numFields] = equals + 1;
+//      ++numFields;
+//
+//      current = soh + 1;
+//  }
+//..
+// Finally, we verify that all three fields were found:
+//..
+//  assert(3 == numFields);
+//  assert(0 == strncmp(tags[1],   "35",  2));
+//  assert(0 == strncmp(values[2], "IBM", 3));
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_STDDEF_H
+#include <stddef.h>
+#define INCLUDED_STDDEF_H
+#endif
+
+namespace BloombergLP {
+
+namespace bslstl {
+
+                          // =======================
+                          // struct StringSearchUtil
+                          // =======================
+
+struct StringSearchUtil {
+    // This 'struct' provides a namespace for functions that search a sequence
+    // of 'char' for a substring or for characters belonging to a set.  Each
+    // function returns the address of the character found, or 0 if there is
+    // no such character.  The behavior of every function is undefined unless
+    // each sequence supplied to it is valid for its specified length.
+
+    // TYPES
+    enum InstructionSet {
+        // Enumerate the instruction sets for which the functions of this
+        // component provide an implementation, narrowest first.
+
+        e_PORTABLE,  // one character per step
+        e_SSE2,      // 16 characters per step
+        e_AVX2       // 32 characters per step
+    };
+
+    enum { k_MAX_VECTOR_SET_LENGTH = 16 };
+        // The maximum length of a set of characters for which 'findFirstOf'
+        // and 'findFirstNotOf' use a vectorized implementation.
+
+    // CLASS METHODS
+    static const char *find(const char *string,
+                            size_t      length,
+                            const char *substring,
+                            size_t      substringLength);
+        // Return the address of the first occurrence of the specified
+        // 'substring' having the specified 'substringLength' in the specified
+        // 'string' having the specified 'length', or 0 if there is no such
+        // occurrence.  If '0 == substringLength', return 'string'.
+
+    static const char *findLast(const char *string,
+                                size_t      length,
+                                const char *substring,
+                                size_t      substringLength);
+        // Return the address of the last occurrence of the specified
+        // 'substring' having the specified 'substringLength' in the specified
+        // 'string' having the specified 'length', or 0 if there is no such
+        // occurrence.  If '0 == substringLength', return 'string + length'.
+
+    static const char *findFirstOf(const char *string,
+                                   size_t      length,
+                                   const char *characterSet,
+                                   size_t      setLength);
+        // Return the address of the first character in the specified 'string'
+        // having the specified 'length' that is equal to one of the characters
+        // in the specified 'characterSet' having the specified 'setLength', or
+        // 0 if there is no such character.
+
+    static const char *findFirstNotOf(const char *string,
+                                      size_t      length,
+                                      const char *characterSet,
+                                      size_t      setLength);
+        // Return the address of the first character in the specified 'string'
+        // having the specified 'length' that is not equal to any of the
+        // characters in the specified 'characterSet' having the specified
+        // 'setLength', or 0 if there is no such character.
+
+    static const char *findLastOf(const char *string,
+                                  size_t      length,
+                                  const char *characterSet,
+                                  size_t      setLength);
+        // Return the address of the last character in the specified 'string'
+        // having the specified 'length' that is equal to one of the characters
+        // in the specified 'characterSet' having the specified 'setLength', or
+        // 0 if there is no such character.
+
+    static const char *findLastNotOf(const char *string,
+                                     size_t      length,
+                                     const char *characterSet,
+                                     size_t      setLength);
+        // Return the address of the last character in the specified 'string'
+        // having the specified 'length' that is not equal to any of the
+        // characters in the specified 'characterSet' having the specified
+        // 'setLength', or 0 if there is no such character.
+
+    static InstructionSet instructionSet();
+        // Return the instruction set used by the functions of this component.
+        // Unless 'setInstructionSet' has been called, this is the value
+        // returned by 'supportedInstructionSet'.
+
+    static void setInstructionSet(InstructionSet value);
+        // Use the specified 'value' as the instruction set of the functions of
+        // this component.  The behavior is undefined unless
+        // 'value <= supportedInstructionSet()'.  Note that this function is
+        // intended for testing and benchmarking only.
+
+    static InstructionSet supportedInstructionSet();
+        // Return the widest instruction set for which this component provides
+        // an implementation and that is supported by the host processor.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
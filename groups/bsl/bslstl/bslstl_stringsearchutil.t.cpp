@@ -0,0 +1,585 @@
+// bslstl_stringsearchutil.t.cpp                                      -*-C++-*-
+#include <bslstl_stringsearchutil.h>
+
+#include <bsls_bsltestutil.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides stateless search functions having several
+// implementations, one of which is selected at run time.  Each function is
+// tested, for every instruction set supported by the host, by comparing its
+// result with that of a straightforward reference implementation over a large
+// number of pseudo-random sequences drawn from alphabets of several sizes,
+// including characters having the high bit set.  Each sequence searched is
+// copied into a heap buffer of exactly its length, so that reading beyond its
+// end is detected by memory-checking tools.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] const char *find(const char *, size_t, const char *, size_t);
+// [ 3] const char *findLast(const char *, size_t, const char *, size_t);
+// [ 4] const char *findFirstOf(const char *, size_t, const char *, size_t);
+// [ 4] const char *findFirstNotOf(const char *, size_t, const char *, size_t);
+// [ 4] const char *findLastOf(const char *, size_t, const char *, size_t);
+// [ 4] const char *findLastNotOf(const char *, size_t, const char *, size_t);
+// [ 2] InstructionSet instructionSet();
+// [ 2] void setInstructionSet(InstructionSet value);
+// [ 2] InstructionSet supportedInstructionSet();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+//=============================================================================
+//                  STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+static int testStatus = 0;
+
+static void aSsErT(bool b, const char *s, int i) {
+    if (b) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", i, s);
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+typedef bslstl::StringSearchUtil Util;
+
+enum { k_MAX_LENGTH = 130 };  // exceeds four 32-character blocks
+
+static const char ALPHABET[] = "ab\x01" "=\xff\x80" "cdefghijklmnopqrstuvwxyz"
+                               "\0";
+    // The characters from which the test sequences are drawn.  The prefix of
+    // length 'k' is used as the alphabet of size 'k'.
+
+enum { k_ALPHABET_LENGTH = sizeof ALPHABET - 1 };
+
+static const int ALPHABET_SIZES[] = { 1, 2, 4, 6, k_ALPHABET_LENGTH };
+
+enum { k_NUM_ALPHABET_SIZES = sizeof ALPHABET_SIZES / sizeof *ALPHABET_SIZES };
+
+//=============================================================================
+//                  GLOBAL HELPER FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+static int nextRandom(unsigned *seed)
+    // Advance the specified 'seed' of a linear congruential generator and
+    // return the next pseudo-random number in the range '[0, 32767]'.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return static_cast<int>((*seed >> 16) & 0x7fff);
+}
+
+static char *makeSequence(int length, int alphabetSize, unsigned *seed)
+    // Return the address of a newly allocated buffer of exactly the specified
+    // 'length' characters drawn pseudo-randomly, using the specified 'seed',
+    // from the first 'alphabetSize' characters of 'ALPHABET'.  The caller is
+    // responsible for releasing the buffer with 'free'.
+{
+    char *result = static_cast<char *>(malloc(length ? length : 1));
+    for (int i = 0; i < length; ++i) {
+        result[i] = ALPHABET[nextRandom(seed) % alphabetSize];
+    }
+    return result;
+}
+
+static bool isMember(char character, const char *set, int setLength)
+    // Return 'true' if the specified 'character' is one of the specified
+    // 'setLength' characters of the specified 'set', and 'false' otherwise.
+{
+    for (int i = 0; i < setLength; ++i) {
+        if (set[i] == character) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+static int naiveFind(const char *string,
+                     int         length,
+                     const char *substring,
+                     int         substringLength)
+    // Return the position of the first occurrence of the specified
+    // 'substring' having the specified 'substringLength' in the specified
+    // 'string' having the specified 'length', or -1 if there is none.
+{
+    for (int i = 0; i + substringLength <= length; ++i) {
+        if (0 == memcmp(string + i, substring, substringLength)) {
+            return i;                                                 // RETURN
+        }
+    }
+    return -1;
+}
+
+static int naiveFindLast(const char *string,
+                         int         length,
+                         const char *substring,
+                         int         substringLength)
+    // Return the position of the last occurrence of the specified 'substring'
+    // having the specified 'substringLength' in the specified 'string' having
+    // the specified 'length', or -1 if there is none.
+{
+    for (int i = length - substringLength; 0 <= i; --i) {
+        if (0 == memcmp(string + i, substring, substringLength)) {
+            return i;                                                 // RETURN
+        }
+    }
+    return -1;
+}
+
+static int naiveFindFirst(const char *string,
+                          int         length,
+                          const char *set,
+                          int         setLength,
+                          bool        member)
+    // Return the position of the first character in the specified 'string'
+    // having the specified 'length' whose membership in the specified 'set'
+    // having the specified 'setLength' is the specified 'member', or -1 if
+    // there is none.
+{
+    for (int i = 0; i < length; ++i) {
+        if (isMember(string[i], set, setLength) == member) {
+            return i;                                                 // RETURN
+        }
+    }
+    return -1;
+}
+
+static int naiveFindLast(const char *string,
+                         int         length,
+                         const char *set,
+                         int         setLength,
+                         bool        member)
+    // Return the position of the last character in the specified 'string'
+    // having the specified 'length' whose membership in the specified 'set'
+    // having the specified 'setLength' is the specified 'member', or -1 if
+    // there is none.
+{
+    for (int i = length - 1; 0 <= i; --i) {
+        if (isMember(string[i], set, setLength) == member) {
+            return i;                                                 // RETURN
+        }
+    }
+    return -1;
+}
+
+static int position(const char *result, const char *string)
+    // Return the offset of the specified 'result' from the specified 'string',
+    // or -1 if 'result' is 0.
+{
+    return result ? static_cast<int>(result - string) : -1;
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    const int SUPPORTED = Util::supportedInstructionSet();
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Splitting a FIX Message into Fields
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// A FIX message is a sequence of 'tag=value' fields, each terminated by the
+// SOH ('\x01') character.  In this example we extract the tag and the value
+// of each field using 'findFirstOf'.
+//
+// First, we define a message holding three fields:
+//..
+    const char   *message = "8=FIX.4.2\x01" "35=D\x01" "55=IBM\x01";
+    const size_t  length  = strlen(message);
+//..
+// Then, we search for the end of the tag, and of the value, of each field in
+// turn:
+//..
+    const char *tags[3];
+    const char *values[3];
+    int         numFields = 0;
+
+    const char *current = message;
+    const char *end     = message + length;
+    while (current != end) {
+        const char *equals = bslstl::StringSearchUtil::findFirstOf(
+                                                               current,
+                                                               end - current,
+                                                               "=\x01",
+                                                               2);
+        ASSERT(equals && '=' == *equals);
+
+        const char *soh = bslstl::StringSearchUtil::findFirstOf(
+                                                              equals,
+                                                              end - equals,
+                                                              "\x01",
+                                                              1);
+        ASSERT(soh);
+
+        tags[numFields]   = current;
+        values[numFields] = equals + 1;
+        ++numFields;
+
+        current = soh + 1;
+    }
+//..
+// Finally, we verify that all three fields were found:
+//..
+    ASSERT(3 == numFields);
+    ASSERT(0 == strncmp(tags[1],   "35",  2));
+    ASSERT(0 == strncmp(values[2], "IBM", 3));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CHARACTER SET SEARCHES
+        //
+        // Concerns:
+        //: 1 'findFirstOf' and 'findLastOf' return the address of the first
+        //:   and last character, respectively, that is a member of the set,
+        //:   and 0 if there is none.
+        //:
+        //: 2 'findFirstNotOf' and 'findLastNotOf' return the address of the
+        //:   first and last character, respectively, that is not a member of
+        //:   the set, and 0 if there is none.
+        //:
+        //: 3 An empty set has no members, and a set may hold a character more
+        //:   than once.
+        //:
+        //: 4 Sets both shorter and longer than 'k_MAX_VECTOR_SET_LENGTH' are
+        //:   supported, as are characters having the high bit set and the
+        //:   null character.
+        //:
+        //: 5 The result is the same for every supported instruction set, and
+        //:   no character outside of either sequence is read.
+        //
+        // Plan:
+        //: 1 For each supported instruction set, for each alphabet size, and
+        //:   for each length of sequence up to 'k_MAX_LENGTH', search
+        //:   pseudo-random sequences for pseudo-random sets of up to 40
+        //:   characters drawn from a slightly larger alphabet, and compare
+        //:   each result with that of a reference implementation.  (C-1..5)
+        //
+        // Testing:
+        //   const char *findFirstOf(const char *, size_t, const char *, ...);
+        //   const char *findFirstNotOf(const char *, size_t, ...);
+        //   const char *findLastOf(const char *, size_t, const char *, ...);
+        //   const char *findLastNotOf(const char *, size_t, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCHARACTER SET SEARCHES"
+                            "\n======================\n");
+
+        for (int isa = 0; isa <= SUPPORTED; ++isa) {
+            Util::setInstructionSet(static_cast<Util::InstructionSet>(isa));
+
+            if (veryVerbose) { T_ P(isa) }
+
+            unsigned seed = 7;
+            for (int ai = 0; ai < k_NUM_ALPHABET_SIZES; ++ai) {
+                const int ALPHABET_SIZE = ALPHABET_SIZES[ai];
+                const int SET_ALPHABET  = ALPHABET_SIZE < k_ALPHABET_LENGTH
+                                        ? ALPHABET_SIZE + 1
+                                        : ALPHABET_SIZE;
+
+                for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+                    char *string = makeSequence(length, ALPHABET_SIZE, &seed);
+
+                    for (int setLength = 0; setLength <= 40; ++setLength) {
+                        char *set = makeSequence(setLength,
+                                                 SET_ALPHABET,
+                                                 &seed);
+                        const size_t LEN = length;
+                        const size_t SET = setLength;
+
+                        ASSERTV(isa, ai, length, setLength,
+                                naiveFindFirst(string, length,
+                                               set, setLength, true) ==
+                                position(Util::findFirstOf(string, LEN,
+                                                           set, SET),
+                                         string));
+
+                        ASSERTV(isa, ai, length, setLength,
+                                naiveFindFirst(string, length,
+                                               set, setLength, false) ==
+                                position(Util::findFirstNotOf(string, LEN,
+                                                              set, SET),
+                                         string));
+
+                        ASSERTV(isa, ai, length, setLength,
+                                naiveFindLast(string, length,
+                                              set, setLength, true) ==
+                                position(Util::findLastOf(string, LEN,
+                                                          set, SET),
+                                         string));
+
+                        ASSERTV(isa, ai, length, setLength,
+                                naiveFindLast(string, length,
+                                              set, setLength, false) ==
+                                position(Util::findLastNotOf(string, LEN,
+                                                             set, SET),
+                                         string));
+                        free(set);
+                    }
+                    free(string);
+                }
+            }
+        }
+        Util::setInstructionSet(Util::supportedInstructionSet());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // SUBSTRING SEARCHES
+        //
+        // Concerns:
+        //: 1 'find' and 'findLast' return the address of the first and last
+        //:   occurrence, respectively, of the substring, and 0 if there is
+        //:   none.
+        //:
+        //: 2 An empty substring occurs at the start ('find') and at the end
+        //:   ('findLast') of every sequence, including an empty one.
+        //:
+        //: 3 Occurrences that overlap, and occurrences at the very start and
+        //:   the very end of the sequence, are found.
+        //:
+        //: 4 The result is the same for every supported instruction set, and
+        //:   no character outside of either sequence is read.
+        //
+        // Plan:
+        //: 1 For each supported instruction set, for each alphabet size, and
+        //:   for each length of sequence up to 'k_MAX_LENGTH', search
+        //:   pseudo-random sequences for substrings of up to 40 characters,
+        //:   both pseudo-random and copied from the sequence itself, and
+        //:   compare each result with that of a reference implementation.
+        //:   (C-1..4)
+        //
+        // Testing:
+        //   const char *find(const char *, size_t, const char *, size_t);
+        //   const char *findLast(const char *, size_t, const char *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSUBSTRING SEARCHES"
+                            "\n==================\n");
+
+        for (int isa = 0; isa <= SUPPORTED; ++isa) {
+            Util::setInstructionSet(static_cast<Util::InstructionSet>(isa));
+
+            if (veryVerbose) { T_ P(isa) }
+
+            unsigned seed = 3;
+            for (int ai = 0; ai < k_NUM_ALPHABET_SIZES; ++ai) {
+                const int ALPHABET_SIZE = ALPHABET_SIZES[ai];
+
+                for (int length = 0; length <= k_MAX_LENGTH; ++length) {
+                    char *string = makeSequence(length, ALPHABET_SIZE, &seed);
+
+                    for (int subLength = 0; subLength <= 40; ++subLength) {
+                        char *sub = makeSequence(subLength,
+                                                 ALPHABET_SIZE,
+                                                 &seed);
+
+                        // Half of the time, search for a substring of the
+                        // sequence itself so that matches are found even for
+                        // large alphabets.
+
+                        if (subLength <= length && (nextRandom(&seed) & 1)) {
+                            const int FROM = nextRandom(&seed)
+                                                  % (length - subLength + 1);
+                            memcpy(sub, string + FROM, subLength);
+                        }
+
+                        const size_t LEN = length;
+                        const size_t SUB = subLength;
+
+                        ASSERTV(isa, ai, length, subLength,
+                                naiveFind(string, length, sub, subLength) ==
+                                position(Util::find(string, LEN, sub, SUB),
+                                         string));
+
+                        ASSERTV(isa, ai, length, subLength,
+                                naiveFindLast(string, length,
+                                              sub, subLength) ==
+                                position(Util::findLast(string, LEN,
+                                                        sub, SUB),
+                                         string));
+                        free(sub);
+                    }
+                    free(string);
+                }
+            }
+        }
+        Util::setInstructionSet(Util::supportedInstructionSet());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // INSTRUCTION SET SELECTION
+        //
+        // Concerns:
+        //: 1 Unless overridden, the instruction set in use is the one
+        //:   supported by the host.
+        //:
+        //: 2 'setInstructionSet' selects any instruction set no wider than
+        //:   the one supported by the host.
+        //:
+        //: 3 The instruction set supported by the host does not change.
+        //
+        // Plan:
+        //: 1 Verify that 'instructionSet' returns the value of
+        //:   'supportedInstructionSet' before any other function is called.
+        //:   (C-1)
+        //:
+        //: 2 Select each supported instruction set in turn, and verify that
+        //:   'instructionSet' returns it, and that 'supportedInstructionSet'
+        //:   is unchanged.  (C-2..3)
+        //
+        // Testing:
+        //   InstructionSet instructionSet();
+        //   void setInstructionSet(InstructionSet value);
+        //   InstructionSet supportedInstructionSet();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nINSTRUCTION SET SELECTION"
+                            "\n=========================\n");
+
+        if (veryVerbose) { T_ P(SUPPORTED) }
+
+        ASSERTV(SUPPORTED, Util::instructionSet(),
+                SUPPORTED == Util::instructionSet());
+
+        for (int isa = 0; isa <= SUPPORTED; ++isa) {
+            Util::setInstructionSet(static_cast<Util::InstructionSet>(isa));
+
+            ASSERTV(isa, Util::instructionSet(),
+                    isa == Util::instructionSet());
+            ASSERTV(isa, Util::supportedInstructionSet(),
+                    SUPPORTED == Util::supportedInstructionSet());
+        }
+        Util::setInstructionSet(Util::supportedInstructionSet());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Search a short sentence with each function.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        const char   *S = "the quick brown fox jumps over the lazy dog";
+        const size_t  N = strlen(S);
+
+        ASSERT(S +  0 == Util::find(S, N, "the", 3));
+        ASSERT(S + 31 == Util::findLast(S, N, "the", 3));
+        ASSERT(0      == Util::find(S, N, "cat", 3));
+        ASSERT(S +  3 == Util::findFirstOf(S, N, " ,.", 3));
+        ASSERT(S + 39 == Util::findLastOf(S, N, " ,.", 3));
+        ASSERT(S +  3 == Util::findFirstNotOf(S, N, "eht", 3));
+        ASSERT(S + 41 == Util::findLastNotOf(S, N, "g", 1));
+        ASSERT(0      == Util::findFirstOf(S, N, "!?", 2));
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2013 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -280,7 +280,27 @@ class TreeNodePool {
     typedef typename AllocatorTraits::size_type size_type;
         // Alias for the 'size_type' of the allocator defined by 'SimplePool'.
 
+    typedef VALUE ValueType;
+        // Alias for the type of the value held by each node.
+
+    typedef TreeNode<VALUE> NodeType;
+        // Alias for the type of the nodes created by this pool.
+
+    typedef typename Pool::Chunk Chunk;
+        // Alias for the chunk type defined by 'SimplePool'.
+
   public:
+    // CLASS METHODS
+    static void returnNode(Chunk                *chunk,
+                           bslalg::RbTreeNode   *node,
+                           const AllocatorType&  allocator);
+        // Return the memory footprint of the specified 'node', lent out of the
+        // specified 'chunk', to 'chunk', and release the reference to 'chunk'
+        // held by the caller, returning the memory of 'chunk' to the
+        // specified 'allocator' if it was the last reference.  The behavior is
+        // undefined unless the value of 'node' has been destroyed.  See
+        // 'SimplePool::returnBlock'.
+
     // CREATORS
     explicit TreeNodePool(const ALLOCATOR& allocator);
         // Create a node-allocator that will use the specified 'allocator' to
@@ -314,6 +334,27 @@ class TreeNodePool {
         // least the specified 'numNodes' before the pool replenishes.  The
         // behavior is undefined unless '0 < numNodes'.
 
+    Chunk *lendNode(bslalg::RbTreeNode *node);
+        // Lend the memory footprint of the specified 'node', removed from a
+        // container using this pool, out of this pool, and return the chunk
+        // holding it, with a reference to the chunk acquired on behalf of the
+        // caller, which thereby keeps 'node' valid until handing it over to a
+        // pool (see 'adoptNode') or back to its chunk (see 'returnNode').  See
+        // 'SimplePool::lendBlock'.
+
+    void reserveAdoption();
+        // Ensure that the next call to 'adoptNode' on this pool does not
+        // allocate memory.
+
+    void adoptNode(Chunk *chunk, bslalg::RbTreeNode *node);
+        // Take over the specified 'node', lent out of the specified 'chunk',
+        // along with the reference to 'chunk' held by the caller, so that
+        // 'node' may be deleted by this pool.  If an exception is thrown, this
+        // method has no effect.  The behavior is undefined unless the caller
+        // holds a reference to 'chunk' for 'node', lent by a pool whose
+        // allocator compares equal to 'allocator()'.  See
+        // 'SimplePool::adoptBlock'.
+
     void swap(TreeNodePool<VALUE, ALLOCATOR>& other);
         // Efficiently exchange the management of nodes of this object and
         // the specified 'other' object.  The behavior is undefined unless the
@@ -331,6 +372,17 @@ class TreeNodePool {
 //                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
 // ===========================================================================
 
+// CLASS METHODS
+template <class VALUE, class ALLOCATOR>
+inline
+void TreeNodePool<VALUE, ALLOCATOR>::returnNode(
+                                               Chunk                *chunk,
+                                               bslalg::RbTreeNode   *node,
+                                               const AllocatorType&  allocator)
+{
+    Pool::returnBlock(chunk, static_cast<TreeNode<VALUE> *>(node), allocator);
+}
+
 // CREATORS
 template <class VALUE, class ALLOCATOR>
 inline
@@ -406,6 +458,29 @@ void TreeNodePool<VALUE, ALLOCATOR>::reserveNodes(size_type numNodes)
     d_pool.reserve(numNodes);
 }
 
+template <class VALUE, class ALLOCATOR>
+inline
+typename TreeNodePool<VALUE, ALLOCATOR>::Chunk *
+TreeNodePool<VALUE, ALLOCATOR>::lendNode(bslalg::RbTreeNode *node)
+{
+    return d_pool.lendBlock(static_cast<TreeNode<VALUE> *>(node));
+}
+
+template <class VALUE, class ALLOCATOR>
+inline
+void TreeNodePool<VALUE, ALLOCATOR>::reserveAdoption()
+{
+    d_pool.reserveAdoption();
+}
+
+template <class VALUE, class ALLOCATOR>
+inline
+void TreeNodePool<VALUE, ALLOCATOR>::adoptNode(Chunk              *chunk,
+                                               bslalg::RbTreeNode *node)
+{
+    d_pool.adoptBlock(chunk, static_cast<TreeNode<VALUE> *>(node));
+}
+
 template <class VALUE, class ALLOCATOR>
 inline
 void TreeNodePool<VALUE, ALLOCATOR>::swap(
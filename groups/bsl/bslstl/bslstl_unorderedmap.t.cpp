@@ -1,5 +1,6 @@
 // bslstl_unorderedmap.t.cpp                                          -*-C++-*-
 #include <bslstl_unorderedmap.h>
+#include <bslstl_unorderedmultimap.h>  // for testing only
 
 #include <bslstl_hash.h>
 #include <bslstl_pair.h>
@@ -25,6 +26,7 @@
 #include <bsls_exceptionutil.h>
 #include <bsls_objectbuffer.h>
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_util.h>
 
 #include <bsltf_stdtestallocator.h>
@@ -57,7 +59,13 @@ using namespace BloombergLP;
 // [ ]
 //-----------------------------------------------------------------------------
 // [1] BREATHING TEST
-// [2] USAGE EXAMPLE
+// [17] TRANSPARENT LOOKUP
+// [18] NODE HANDLES
+// [19] void compact();
+// [20] void find_batch(const key_type *k, size_type n, iterator *r);
+// [20] void find_batch(const key_type *k, size_type n, c_iter *r) const;
+// [21] USAGE EXAMPLE
+// [-1] PERFORMANCE: 'find_batch' VS. 'find'
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -9534,6 +9542,74 @@ void testImplicitInsert(CONTAINER& mX)
 
 }  // close namespace BREATHING_TEST
 
+// ============================================================================
+//                  TRANSPARENT HASHER AND EQUALITY FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct TransparentProbe {
+    // This 'struct' provides a lookup key, holding an 'int' value, that is not
+    // convertible to 'int'.
+
+    int d_value;
+};
+
+struct TransparentHash {
+    // This 'struct' provides a transparent hasher for 'int' keys and
+    // 'TransparentProbe' objects that returns the same hash code for an 'int'
+    // and a 'TransparentProbe' having the same value.
+
+    typedef void is_transparent;
+
+    native_std::size_t operator()(int key) const
+        // Return a hash code for the specified 'key'.
+    {
+        return static_cast<native_std::size_t>(key) * 0x9E3779B1u;
+    }
+
+    native_std::size_t operator()(const TransparentProbe& key) const
+        // Return a hash code for the value held by the specified 'key'.
+    {
+        return (*this)(key.d_value);
+    }
+};
+
+struct TransparentEqual {
+    // This 'struct' provides a transparent equality comparator for 'int' keys
+    // and 'TransparentProbe' objects.
+
+    typedef void is_transparent;
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' has the same value as the
+        // specified 'rhs', and 'false' otherwise.
+    {
+        return lhs == rhs;
+    }
+
+    bool operator()(const TransparentProbe& lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' holds the same value as the
+        // specified 'rhs', and 'false' otherwise.
+    {
+        return lhs.d_value == rhs;
+    }
+};
+
+// ============================================================================
+//                      COLLIDING HASHER FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct CollidingHash {
+    // This 'struct' provides a hasher for 'int' keys that returns one of only
+    // a few distinct hash codes, so that the buckets of a hash table using it
+    // hold long chains of elements.
+
+    native_std::size_t operator()(int key) const
+        // Return a hash code for the specified 'key'.
+    {
+        return static_cast<native_std::size_t>(key) % 5;
+    }
+};
+
 //=============================================================================
 // MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -9553,7 +9629,7 @@ int main(int argc, char *argv[])
 
     switch (test) { case 0:
 #if !defined(BSLSTL_UNORDEREDMAP_DO_NOT_TEST_USAGE)
-        case 17: {
+        case 21: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -9574,6 +9650,630 @@ int main(int argc, char *argv[])
         usage();
       } break;
 #endif
+      case 20: {
+        // --------------------------------------------------------------------
+        // TESTING 'find_batch'
+        //
+        // Concerns:
+        //: 1 Each result of 'find_batch' is the iterator that 'find' returns
+        //:   for the corresponding key, whether or not the key is present.
+        //:
+        //: 2 Batches of any length, including 0 and lengths that are not
+        //:   multiples of the internal pipeline and run sizes, are handled,
+        //:   and no element of the results array beyond the batch is
+        //:   modified.
+        //:
+        //: 3 Keys in long bucket chains, and keys looked up in an empty map,
+        //:   are handled.
+        //:
+        //: 4 Both the modifiable and the non-modifiable overloads are
+        //:   provided, and neither modifies the map.
+        //:
+        //: 5 No memory is allocated.
+        //
+        // Plan:
+        //: 1 Create maps holding the even integers in a range, using a good
+        //:   hasher and a hasher yielding only five distinct hash codes, and
+        //:   an empty map.
+        //:
+        //: 2 For a set of batch lengths, look up batches of consecutive
+        //:   integers, present and absent, starting at several offsets, with
+        //:   each overload, and compare each result to 'find'.  Verify that
+        //:   the element following the batch in the results array is
+        //:   unchanged.  (C-1..4)
+        //:
+        //: 3 Verify that no memory is allocated from either the object or the
+        //:   default allocator during the lookups.  (C-5)
+        //
+        // Testing:
+        //   void find_batch(const key_type *k, size_type n, iterator *r);
+        //   void find_batch(const key_type *k, size_type n, c_iter *r) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'find_batch'"
+                            "\n====================\n");
+
+        typedef bsl::unordered_map<int, int>                Obj;
+        typedef bsl::unordered_map<int, int, CollidingHash> CollidingObj;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        enum { k_NUM_ELEMENTS = 300, k_NUM_KEYS = 2 * k_NUM_ELEMENTS + 2 };
+
+        Obj          mX(&oa);  const Obj&          X = mX;
+        CollidingObj mY(&oa);  const CollidingObj& Y = mY;
+        Obj          mZ(&oa);  const Obj&          Z = mZ;
+
+        for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+            mX[2 * i] = i;
+            mY[2 * i] = i;
+        }
+
+        int keys[k_NUM_KEYS];
+        for (int i = 0; i < k_NUM_KEYS; ++i) {
+            keys[i] = i - 1;
+        }
+
+        static const int LENGTHS[] = {
+            0, 1, 2, 15, 16, 17, 33, 64, 65, 257, k_NUM_KEYS - 30
+        };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        static const int STARTS[] = { 0, 1, 7, 30 };
+        const int NUM_STARTS = sizeof STARTS / sizeof *STARTS;
+
+        const bsls::Types::Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int LENGTH = LENGTHS[ti];
+
+            for (int tj = 0; tj < NUM_STARTS; ++tj) {
+                const int  START = STARTS[tj];
+                const int *KEYS  = keys + START;
+
+                if (veryVerbose) { T_ P_(LENGTH) P(START) }
+
+                Obj::iterator                results[k_NUM_KEYS + 1];
+                Obj::const_iterator          cResults[k_NUM_KEYS + 1];
+                CollidingObj::const_iterator yResults[k_NUM_KEYS + 1];
+                Obj::const_iterator          zResults[k_NUM_KEYS + 1];
+
+                results[LENGTH]  = mX.begin();
+                cResults[LENGTH] = X.begin();
+                yResults[LENGTH] = Y.begin();
+                zResults[LENGTH] = X.begin();
+
+                mX.find_batch(KEYS, LENGTH, results);
+                X.find_batch(KEYS, LENGTH, cResults);
+                Y.find_batch(KEYS, LENGTH, yResults);
+                Z.find_batch(KEYS, LENGTH, zResults);
+
+                for (int i = 0; i < LENGTH; ++i) {
+                    ASSERTV(LENGTH, START, i, mX.find(KEYS[i]) == results[i]);
+                    ASSERTV(LENGTH, START, i, X.find(KEYS[i]) == cResults[i]);
+                    ASSERTV(LENGTH, START, i, Y.find(KEYS[i]) == yResults[i]);
+                    ASSERTV(LENGTH, START, i, Z.end()         == zResults[i]);
+
+                    if (0 == KEYS[i] % 2
+                     && 0 <= KEYS[i] && KEYS[i] < 2 * k_NUM_ELEMENTS) {
+                        ASSERTV(LENGTH, START, i, X.end() != cResults[i]);
+                        ASSERTV(LENGTH, START, i, Y.end() != yResults[i]);
+                    }
+                }
+
+                ASSERTV(LENGTH, START, mX.begin() == results[LENGTH]);
+                ASSERTV(LENGTH, START, X.begin()  == cResults[LENGTH]);
+                ASSERTV(LENGTH, START, Y.begin()  == yResults[LENGTH]);
+                ASSERTV(LENGTH, START, X.begin()  == zResults[LENGTH]);
+            }
+        }
+
+        ASSERT(k_NUM_ELEMENTS == X.size());
+        ASSERT(k_NUM_ELEMENTS == Y.size());
+        ASSERT(0              == Z.size());
+
+        ASSERTV(NUM_ALLOCATIONS, oa.numAllocations(),
+                NUM_ALLOCATIONS == oa.numAllocations());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 19: {
+        // --------------------------------------------------------------------
+        // TESTING 'compact'
+        //
+        // Concerns:
+        //: 1 'compact' leaves the value, the iteration order, and the bucket
+        //:   layout of the map unchanged.
+        //:
+        //: 2 After 'compact', the nodes of the map are laid out contiguously,
+        //:   in iteration order, at a constant stride.
+        //:
+        //: 3 After 'compact', the map holds exactly the memory held by a copy
+        //:   of the map, i.e., the memory of nodes removed from the map is
+        //:   released.
+        //:
+        //: 4 'compact' on an empty map releases all memory held for nodes.
+        //:
+        //: 5 'compact' is exception-neutral, and provides the strong
+        //:   exception guarantee.
+        //:
+        //: 6 No memory is allocated from the default allocator.
+        //
+        // Plan:
+        //: 1 Create a map whose elements allocate memory, erase every other
+        //:   element to scatter the free nodes of its pool, and record the
+        //:   sequence of keys in iteration order and bucket by bucket.
+        //:
+        //: 2 Invoke 'compact' within an exception test loop, verifying at the
+        //:   start of each iteration that the value of the map is unchanged.
+        //:   (C-5)
+        //:
+        //: 3 Verify the value, the recorded sequences of keys, and the
+        //:   distance between the addresses of consecutive elements.
+        //:   (C-1..2)
+        //:
+        //: 4 Compare the number of blocks in use by the map with that of a
+        //:   copy of the map supplied by a separate test allocator.  (C-3)
+        //:
+        //: 5 Clear the map, invoke 'compact', and verify that only the bucket
+        //:   array remains in use.  (C-4)
+        //:
+        //: 6 Verify that no memory is allocated from the default allocator.
+        //:   (C-6)
+        //
+        // Testing:
+        //   void compact();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'compact'"
+                            "\n=================\n");
+
+        typedef bsl::unordered_map<int, bsl::string> Obj;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator sa("scratch", veryVeryVeryVerbose);
+
+        const int NUM_VALUES = 64;
+
+        Obj mX(&oa);  const Obj& X = mX;
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            mX[i].assign(40, static_cast<char>('a' + i % 26));
+        }
+        for (int i = 1; i < NUM_VALUES; i += 2) {
+            ASSERTV(i, 1 == mX.erase(i));
+        }
+
+        const Obj W(X, &sa);
+
+        bsl::vector<int> keys(&sa);
+        for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+            keys.push_back(it->first);
+        }
+        bsl::vector<int> bucketKeys(&sa);
+        for (Obj::size_type b = 0; b < X.bucket_count(); ++b) {
+            for (Obj::const_local_iterator it = X.begin(b);
+                 it != X.end(b);
+                 ++it) {
+                bucketKeys.push_back(it->first);
+            }
+        }
+        const Obj::size_type NUM_BUCKETS = X.bucket_count();
+
+        EXCEPTION_TEST_BEGIN(mX) {
+            if (veryVeryVerbose) { T_ T_ Q(ExceptionTestBody) }
+
+            ASSERT(W == X);
+
+            mX.compact();
+        } EXCEPTION_TEST_END
+
+        ASSERT(W == X);
+        ASSERT(NUM_VALUES / 2 == X.size());
+        ASSERT(NUM_BUCKETS    == X.bucket_count());
+
+        native_std::size_t i = 0;
+        for (Obj::const_iterator it = X.begin(); it != X.end(); ++it, ++i) {
+            ASSERTV(i, i < keys.size() && keys[i] == it->first);
+        }
+
+        i = 0;
+        for (Obj::size_type b = 0; b < X.bucket_count(); ++b) {
+            for (Obj::const_local_iterator it = X.begin(b);
+                 it != X.end(b);
+                 ++it, ++i) {
+                ASSERTV(b, i, i < bucketKeys.size()
+                                              && bucketKeys[i] == it->first);
+            }
+        }
+        ASSERTV(i, bucketKeys.size() == i);
+
+        Obj::const_iterator  it     = X.begin();
+        const char          *prev   = reinterpret_cast<const char *>(&*it);
+        const char          *next   = reinterpret_cast<const char *>(&*++it);
+        const int            STRIDE = static_cast<int>(next - prev);
+        ASSERT(0 < STRIDE);
+
+        for (++it; it != X.end(); ++it) {
+            prev = next;
+            next = reinterpret_cast<const char *>(&*it);
+            ASSERTV(next - prev, STRIDE == next - prev);
+        }
+
+        {
+            bslma::TestAllocator za("copy", veryVeryVeryVerbose);
+
+            const Obj Z(X, &za);
+            ASSERTV(oa.numBlocksInUse(), za.numBlocksInUse(),
+                    za.numBlocksInUse() == oa.numBlocksInUse());
+        }
+
+        mX.clear();
+        mX.compact();
+        ASSERTV(oa.numBlocksInUse(), 1 == oa.numBlocksInUse());
+        ASSERT(X.empty());
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // TESTING NODE HANDLES
+        //
+        // Concerns:
+        //: 1 'extract' unlinks an element from the container without copying
+        //:   or destroying it, and the returned node handle owns the element.
+        //:
+        //: 2 Inserting a node handle into a container having an equal
+        //:   allocator relinks the very same node, and allocates no memory.
+        //:
+        //: 3 A relinked node, and a node owned by a node handle, remain valid
+        //:   after the container from which the node was extracted is
+        //:   destroyed, and all memory is reclaimed when its owner is
+        //:   destroyed.
+        //:
+        //: 4 Inserting a node whose key is already present has no effect on
+        //:   the container; 'insert(nh)' transfers the node to the 'node'
+        //:   member of the result, and 'insert(hint, nh)' leaves the node in
+        //:   'nh'.
+        //:
+        //: 5 'merge' transfers, from a container of either type, exactly the
+        //:   elements whose keys are not present, relinking them without
+        //:   allocating a node.
+        //:
+        //: 6 If the allocators are not equal, the elements are copied into
+        //:   nodes supplied by the target container, and the source nodes
+        //:   are destroyed.
+        //:
+        //: 7 Inserting an empty node handle has no effect.
+        //
+        // Plan:
+        //: 1 Extract elements from a container, insert them into another
+        //:   container using the same allocator, and compare the addresses
+        //:   of the elements before and after the transfer.  Use a test
+        //:   allocator monitor to verify that no memory is allocated by
+        //:   'insert'.  Destroy the source container and verify the values
+        //:   of the transferred elements.  (C-1..3)
+        //:
+        //: 2 Insert node handles whose keys are already present, and empty
+        //:   node handles, and verify the result and the state of the
+        //:   container.  (C-4, 7)
+        //:
+        //: 3 Merge containers of both types, and verify the contents of the
+        //:   source and target, the address of a transferred element, and
+        //:   the number of blocks allocated.  (C-5)
+        //:
+        //: 4 Repeat the transfers between containers using different test
+        //:   allocators, and verify that no memory remains in use from the
+        //:   source allocator once the source container is destroyed.  (C-6)
+        //
+        // Testing:
+        //   node_type extract(const_iterator position);
+        //   node_type extract(const key_type& key);
+        //   insert_return_type insert(const node_type& node);
+        //   iterator insert(const_iterator hint, const node_type& node);
+        //   void merge(unordered_map<K, V, H2, E2, A>& source);
+        //   void merge(unordered_multimap<K, V, H2, E2, A>& source);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING NODE HANDLES"
+                            "\n====================\n");
+
+        typedef bsl::unordered_map<int, int>      Obj;
+        typedef bsl::unordered_multimap<int, int> MultiObj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting 'extract' and 'insert(nh)'.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.reserve(16);
+
+            Obj::node_type         nh;
+            const Obj::value_type *ADDRESS;
+            {
+                Obj mY(&oa);  const Obj& Y = mY;
+                for (int i = 0; i < 8; ++i) {
+                    mY.insert(Obj::value_type(i, i * i));
+                }
+                ADDRESS = &*Y.find(3);
+
+                nh = mY.extract(3);
+                ASSERT(!nh.empty());
+                ASSERT(3       == nh.key());
+                ASSERT(9       == nh.mapped());
+                ASSERT(ADDRESS == &nh.value());
+                ASSERT(7       == Y.size());
+                ASSERT(Y.end() == Y.find(3));
+
+                ASSERT(mY.extract(3).empty());
+
+                // The only block that may be allocated is the index with which
+                // 'mX' tracks the chunk from which it borrows the node.
+
+                const bsls::Types::Int64 BLOCKS = oa.numBlocksTotal();
+
+                Obj::insert_return_type R = mX.insert(nh);
+                ASSERTV(oa.numBlocksTotal() - BLOCKS,
+                        1 >= oa.numBlocksTotal() - BLOCKS);
+                ASSERT(R.inserted);
+                ASSERT(R.node.empty());
+                ASSERT(nh.empty());
+                ASSERT(ADDRESS == &*R.position);
+                ASSERT(1       == X.size());
+
+                nh = mY.extract(Y.find(0));
+                ASSERT(0 == nh.key());
+                ASSERT(6 == Y.size());
+            }
+
+            // The relinked node, and the node owned by 'nh', outlive the
+            // container from which they were extracted.
+
+            ASSERT(ADDRESS == &*X.find(3));
+            ASSERT(9       == X.find(3)->second);
+            ASSERT(0       == nh.key());
+
+            mX.insert(Obj::value_type(0, 100));
+
+            Obj::insert_return_type R = mX.insert(nh);
+            ASSERT(!R.inserted);
+            ASSERT(nh.empty());
+            ASSERT(!R.node.empty());
+            ASSERT(X.find(0) == R.position);
+            ASSERT(100       == R.position->second);
+            ASSERT(0         == R.node.mapped());
+            ASSERT(2         == X.size());
+
+            R.node.key() = 5;
+            Obj::iterator it = mX.insert(X.begin(), R.node);
+            ASSERT(R.node.empty());
+            ASSERT(5 == it->first);
+            ASSERT(3 == X.size());
+
+            nh = mX.extract(X.find(5));
+            nh.key() = 3;
+            it = mX.insert(X.end(), nh);
+            ASSERT(!nh.empty());
+            ASSERT(X.find(3) == it);
+            ASSERT(2         == X.size());
+
+            const Obj::node_type EMPTY;
+
+            R = mX.insert(EMPTY);
+            ASSERT(!R.inserted);
+            ASSERT(R.node.empty());
+            ASSERT(X.end() == R.position);
+            ASSERT(X.end() == mX.insert(X.begin(), EMPTY));
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting 'merge'.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            Obj mY(&oa);  const Obj& Y = mY;
+            mX.reserve(32);
+
+            for (int i = 0; i < 10; ++i) {
+                if (0 == i % 3) {
+                    mX.insert(Obj::value_type(i, -i));
+                }
+                mY.insert(Obj::value_type(i, i));
+            }
+            const Obj::value_type *ADDRESS = &*Y.find(5);
+
+            // No node is allocated: the only blocks that may be allocated are
+            // the indexes with which the two pools track the chunks lent and
+            // borrowed.
+
+            const bsls::Types::Int64 BLOCKS = oa.numBlocksInUse();
+
+            mX.merge(mY);
+
+            ASSERTV(oa.numBlocksInUse() - BLOCKS,
+                    2 >= oa.numBlocksInUse() - BLOCKS);
+            ASSERT(10      == X.size());
+            ASSERT(4       == Y.size());
+            ASSERT(ADDRESS == &*X.find(5));
+            for (Obj::const_iterator it = Y.begin(); it != Y.end(); ++it) {
+                ASSERTV(it->first, 0 == it->first % 3);
+                ASSERTV(it->first, -it->first == X.find(it->first)->second);
+            }
+
+            MultiObj mZ(&oa);  const MultiObj& Z = mZ;
+            mZ.insert(MultiObj::value_type(1, 1));
+            mZ.insert(MultiObj::value_type(11, 11));
+            mZ.insert(MultiObj::value_type(11, 12));
+
+            mX.merge(mZ);
+            ASSERT(11 == X.size());
+            ASSERT(2  == Z.size());
+            ASSERT(1  == Z.count(1));
+            ASSERT(1  == Z.count(11));
+
+            mX.merge(mX);
+            ASSERT(11 == X.size());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting unequal allocators.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            {
+                Obj mY(&za);  const Obj& Y = mY;
+                for (int i = 0; i < 6; ++i) {
+                    mY.insert(Obj::value_type(i, i));
+                }
+                const Obj::value_type *ADDRESS = &*Y.find(2);
+
+                Obj::node_type nh = mY.extract(2);
+                ASSERT(&za == nh.get_allocator().mechanism());
+
+                Obj::insert_return_type R = mX.insert(nh);
+                ASSERT(R.inserted);
+                ASSERT(nh.empty());
+                ASSERT(ADDRESS != &*R.position);
+                ASSERT(2       == R.position->first);
+
+                mX.merge(mY);
+                ASSERT(6 == X.size());
+                ASSERT(0 == Y.size());
+            }
+            ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+
+            for (int i = 0; i < 6; ++i) {
+                ASSERTV(i, 1 == X.count(i));
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+
+      case 17: {
+        // --------------------------------------------------------------------
+        // TESTING TRANSPARENT LOOKUP
+        //
+        // Concerns:
+        //: 1 If both the hasher and the equality comparator are transparent,
+        //:   'find', 'count', 'contains', and 'equal_range' accept a key of a
+        //:   type that is not convertible to 'key_type'.
+        //:
+        //: 2 The transparent overloads locate exactly the elements that are
+        //:   equal to the supplied key.
+        //:
+        //: 3 Both the 'const' and non-'const' overloads are provided, and
+        //:   return iterators to the same elements.
+        //:
+        //: 4 No memory is allocated by the lookup methods.
+        //:
+        //: 5 'contains' reports whether an element having the supplied
+        //:   'key_type' key exists, whether or not the functors are
+        //:   transparent.
+        //
+        // Plan:
+        //: 1 Create an unordered map keyed on 'int' using the transparent
+        //:   functors 'TransparentHash' and 'TransparentEqual', and search it
+        //:   using 'TransparentProbe' objects, which are not convertible to
+        //:   'int'.  Compare the results with those of the 'key_type'
+        //:   overloads, and with a brute-force count of the equal keys.
+        //:   (C-1..3)
+        //:
+        //: 2 Install a test allocator as the default allocator, and use test
+        //:   allocator monitors to verify that no memory is allocated from it,
+        //:   or from the object allocator, by the lookups.  (C-4)
+        //:
+        //: 3 Invoke 'contains' on an unordered map using the default functors
+        //:   for keys that are, and are not, present.  (C-5)
+        //
+        // Testing:
+        //   iterator find(const LOOKUP_KEY& key);
+        //   const_iterator find(const LOOKUP_KEY& key) const;
+        //   size_type count(const LOOKUP_KEY& key) const;
+        //   bool contains(const key_type& key) const;
+        //   bool contains(const LOOKUP_KEY& key) const;
+        //   pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+        //   pair<c_iter, c_iter> equal_range(const LOOKUP_KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING TRANSPARENT LOOKUP"
+                            "\n==========================\n");
+
+        typedef bsl::unordered_map<int, int, TransparentHash, TransparentEqual>
+                                                                           Obj;
+
+        static const int KEYS[]   = { 3, 15, 17, 22, 41, 44, 45 };
+        const int        NUM_KEYS = sizeof KEYS / sizeof *KEYS;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            mX.insert(Obj::value_type(KEYS[i], i));
+        }
+        ASSERTV(X.size(), NUM_KEYS == static_cast<int>(X.size()));
+
+        bslma::TestAllocatorMonitor oam(&oa);
+        bslma::TestAllocatorMonitor dam(&da);
+
+        for (int value = 0; value < 50; ++value) {
+            const TransparentProbe PROBE = { value };
+
+            int expected = 0;
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                if (KEYS[i] == value) {
+                    ++expected;
+                }
+            }
+
+            if (veryVerbose) { T_ P_(value) P(expected) }
+
+            ASSERTV(value, mX.find(value) == mX.find(PROBE));
+            ASSERTV(value,  X.find(value) ==  X.find(PROBE));
+            ASSERTV(value, (0 == expected) == (X.end() == X.find(PROBE)));
+
+            ASSERTV(value, expected == static_cast<int>(X.count(PROBE)));
+            ASSERTV(value, (0 != expected) == X.contains(PROBE));
+
+            const bsl::pair<Obj::iterator, Obj::iterator> R =
+                                                       mX.equal_range(PROBE);
+            ASSERTV(value, mX.equal_range(value) == R);
+
+            const bsl::pair<Obj::const_iterator, Obj::const_iterator> CR =
+                                                        X.equal_range(PROBE);
+            ASSERTV(value, X.equal_range(value) == CR);
+
+            int length = 0;
+            for (Obj::const_iterator it = CR.first; it != CR.second; ++it) {
+                ASSERTV(value, it->first, value == it->first);
+                ++length;
+            }
+            ASSERTV(value, expected, length, expected == length);
+        }
+
+        ASSERT(oam.isTotalSame());
+        ASSERT(dam.isTotalSame());
+
+        if (verbose) printf("\nTesting 'contains' with a 'key_type' key.\n");
+        {
+            typedef bsl::unordered_map<int, int> PlainObj;
+
+            PlainObj mY(&oa);  const PlainObj& Y = mY;
+            mY.insert(PlainObj::value_type(1, 1));
+            mY.insert(PlainObj::value_type(3, 3));
+
+            ASSERT(!Y.contains(0));
+            ASSERT( Y.contains(1));
+            ASSERT(!Y.contains(2));
+            ASSERT( Y.contains(3));
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // GROWING FUNCTIONS
@@ -9998,6 +10698,88 @@ int main(int argc, char *argv[])
         if (veryVerbose)
             printf("Final message to confim the end of the breathing test.\n");
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: 'find_batch' VS. 'find'
+        //
+        // Concerns:
+        //: 1 For a map too large to be held in the cache, looking up a batch
+        //:   of keys with 'find_batch' is substantially faster than looking
+        //:   up each key with 'find'.
+        //
+        // Plan:
+        //: 1 For maps of several sizes, look up the same random sequence of
+        //:   keys, half of them present, with 'find' and with 'find_batch',
+        //:   and report the average time per lookup.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: 'find_batch' VS. 'find'
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: 'find_batch' VS. 'find'"
+                            "\n====================================\n");
+
+        typedef bsl::unordered_map<int, int> Obj;
+
+        bslma::Allocator *ma = &bslma::MallocFreeAllocator::singleton();
+
+        enum { k_BATCH_SIZE = 10000, k_NUM_LOOKUPS = 2000000 };
+
+        static const int SIZES[] = { 1000, 100000, 1000000, 4000000 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        printf("%10s %12s %12s   (ns per lookup)\n",
+               "size", "find", "find_batch");
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            Obj mX(ma);  const Obj& X = mX;
+            for (int i = 0; i < SIZE; ++i) {
+                mX[2 * i] = i;
+            }
+
+            bsl::vector<int> keys(ma);
+            keys.reserve(k_NUM_LOOKUPS);
+            unsigned int state = 12345;
+            for (int i = 0; i < k_NUM_LOOKUPS; ++i) {
+                state = state * 1103515245u + 12345u;
+                keys.push_back(static_cast<int>((state >> 8) % (2 * SIZE)));
+            }
+
+            bsl::vector<Obj::const_iterator> results(k_BATCH_SIZE, ma);
+
+            int             found = 0;
+            bsls::Stopwatch timer;
+
+            timer.start();
+            for (int i = 0; i < k_NUM_LOOKUPS; ++i) {
+                found += X.end() != X.find(keys[i]);
+            }
+            timer.stop();
+            const double FIND_TIME = timer.elapsedTime();
+
+            int foundBatch = 0;
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < k_NUM_LOOKUPS; i += k_BATCH_SIZE) {
+                X.find_batch(&keys[i], k_BATCH_SIZE, &results[0]);
+                for (int j = 0; j < k_BATCH_SIZE; ++j) {
+                    foundBatch += X.end() != results[j];
+                }
+            }
+            timer.stop();
+            const double BATCH_TIME = timer.elapsedTime();
+
+            ASSERTV(found, foundBatch, found == foundBatch);
+
+            printf("%10d %12.1f %12.1f\n",
+                   SIZE,
+                   FIND_TIME  * 1e9 / k_NUM_LOOKUPS,
+                   BATCH_TIME * 1e9 / k_NUM_LOOKUPS);
+        }
+      } break;
       default: {
         fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
         testStatus = -1;
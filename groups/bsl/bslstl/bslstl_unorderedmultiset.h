@@ -99,6 +99,40 @@ BSLS_IDENT("$Id: $")
 // two objects whose keys compare equal by the comparator, shall produce the
 // same value from the hasher.
 //
+///Heterogeneous Lookup
+///--------------------
+// If both of the (template parameter) types 'HASH' and 'EQUAL' are
+// *transparent* (i.e., each declares a nested type named 'is_transparent'),
+// the 'find', 'count', 'contains', and 'equal_range' methods of
+// 'unordered_multiset' provide additional overloads that accept a key of any
+// type that 'HASH' can hash and 'EQUAL' can compare with 'KEY'.  These
+// overloads do not convert the supplied key to 'KEY', so, for example, an
+// 'unordered_multiset' keyed on 'bsl::string' can be searched using a
+// 'bslstl::StringRef' or a 'const char *' without constructing (and allocating
+// memory for) a temporary 'bsl::string'.  The behavior is undefined unless
+// 'HASH' returns the same hash code for a key as it does for every 'KEY' that
+// 'EQUAL' considers equal to that key.  If either 'HASH' or 'EQUAL' is not
+// transparent, these overloads do not participate in overload resolution.
+//
+///Node Handles
+///------------
+// The 'extract' methods of 'unordered_multiset' unlink an element from the
+// container and return it, without copying or destroying it, in a 'node_type'
+// object (a *node* *handle*, see 'bslstl_nodehandle') that owns the element
+// until it is inserted into another container, or until the node handle is
+// destroyed.  Passing a node handle to the overloads of 'insert' taking a
+// 'node_type' links the element into the target container, and 'merge'
+// transfers elements directly from another 'unordered_multiset' or
+// 'unordered_set' having the same allocator type.  When the allocators of the
+// two containers compare equal, no element is copied and no node is allocated:
+// the node (and the memory block that holds it) is handed over to the target
+// container, whose node pool keeps that block alive even if the source
+// container is subsequently destroyed.  When the allocators differ, the
+// element is instead copied into a node supplied by the target container, and
+// the original is destroyed.  Note that, absent move semantics, 'node_type'
+// *transfers* ownership when copied or assigned, leaving the source handle
+// empty.
+//
 ///Memory Allocation
 ///-----------------
 // The type supplied as a set's 'ALLOCATOR' template parameter determines how
@@ -145,6 +179,7 @@ BSLS_IDENT("$Id: $")
 //  'k'             - an object of type 'K'
 //  'v'             - an object of type 'value_type'
 //  'p1', 'p2'      - two iterators belonging to 'a'
+//  'nh'            - an object of type 'node_type'
 //  distance(i1,i2) - the number of elements in the range [i1, i2)
 //  distance(p1,p2) - the number of elements in the range [p1, p2)
 //
@@ -206,6 +241,21 @@ BSLS_IDENT("$Id: $")
 //  |                                                    | Worst:  O[ n *     |
 //  |                                                    |   distance(i1, i2)]|
 //  +----------------------------------------------------+--------------------+
+//  | a.insert(nh)                                       | Average: O[1]      |
+//  |                                                    | Worst:   O[n]      |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(p1, nh)                                   | Average: O[1]      |
+//  |                                                    | Worst:   O[n]      |
+//  +----------------------------------------------------+--------------------+
+//  | a.extract(p1)                                      | Average: O[1]      |
+//  |                                                    | Worst:   O[n]      |
+//  +----------------------------------------------------+--------------------+
+//  | a.extract(k)                                       | Average: O[1]      |
+//  |                                                    | Worst:   O[n]      |
+//  +----------------------------------------------------+--------------------+
+//  | a.merge(b)                                         | Average: O[m]      |
+//  |                                                    | Worst:   O[n * m]  |
+//  +----------------------------------------------------+--------------------+
 //  | a.erase(p1)                                        | Average: O[1]      |
 //  |                                                    | Worst:   O[n]      |
 //  +----------------------------------------------------+--------------------+
@@ -600,6 +650,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_iteratorutil.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_NODEHANDLE
+#include <bslstl_nodehandle.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_PAIR
 #include <bslstl_pair.h>  // result type of 'equal_range' method
 #endif
@@ -624,10 +678,18 @@ BSL_OVERRIDES_STD mode"
 #include <bslma_usesbslmaallocator.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ENABLEIF
+#include <bslmf_enableif.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
 #include <bslmf_isbitwisemoveable.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISTRANSPARENTPREDICATE
+#include <bslmf_istransparentpredicate.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
 #include <bslmf_nestedtraitdeclaration.h>
 #endif
@@ -643,6 +705,9 @@ BSL_OVERRIDES_STD mode"
 
 namespace bsl {
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+class unordered_set;
+
                         // ========================
                         // class unordered_multiset
                         // ========================
@@ -732,10 +797,22 @@ class unordered_multiset
     typedef iterator                                            const_iterator;
     typedef local_iterator                                const_local_iterator;
 
+    typedef BloombergLP::bslstl::NodeHandle<typename HashTable::NodeFactory,
+                                            ALLOCATOR>
+                                                                     node_type;
+
   private:
     // DATA
     HashTable d_impl;
 
+    // PRIVATE MANIPULATORS
+    template <class SOURCE>
+    void mergeNodes(SOURCE *source);
+        // Transfer into this unordered multiset every element of the specified
+        // 'source' container, leaving 'source' empty.  Relink the transferred
+        // nodes if the allocator of 'source' compares equal to that of this
+        // unordered multiset, and copy them into new nodes otherwise.
+
   public:
     // CREATORS
     explicit unordered_multiset(
@@ -873,6 +950,32 @@ class unordered_multiset
         // having 'key', then the two returned iterators will have the same
         // value.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH,
+                                                      LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,
+                                                      LOOKUP_KEY>::value,
+        pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this unordered multiset equal to
+        // the specified 'key', where the first iterator is positioned at the
+        // start of the sequence, and the second is positioned one past the end
+        // of the sequence.  If this unordered multiset contains no such
+        // 'value_type' object, then the two returned iterators will have the
+        // same value, 'end()'.  This method does not participate in overload
+        // resolution unless both 'HASH' and 'EQUAL' are transparent (see
+        // {Heterogeneous Lookup}).
+    {
+        typedef bsl::pair<iterator, iterator> ResultType;
+
+        HashTableLink *first;
+        HashTableLink *last;
+        d_impl.findTransparentRange(&first, &last, key);
+        return ResultType(iterator(first), iterator(last));
+    }
+
     size_type erase(const key_type& key);
         // Remove from this multi-set all 'value_type' objects having the
         // specified 'key', if they exist, and return the number of object
@@ -901,6 +1004,24 @@ class unordered_multiset
         // this multi-set having the specified 'key', if such value-elements
         // exist, and the past-the-end ('end') iterator otherwise.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH,
+                                                      LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,
+                                                      LOOKUP_KEY>::value,
+        iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the first
+        // 'value_type' object in this unordered multiset equal to the
+        // specified 'key', if such an object exists, and the past-the-end
+        // iterator ('end') otherwise.  This method does not participate in
+        // overload resolution unless both 'HASH' and 'EQUAL' are transparent
+        // (see {Heterogeneous Lookup}).
+    {
+        return iterator(d_impl.findTransparent(key));
+    }
+
     iterator insert(const value_type& value);
         // Insert the specified 'value' into multi-set;  if a 'value_type'
         // object having the same key (according to 'key_equal') as 'value'
@@ -959,6 +1080,50 @@ class unordered_multiset
         // numElements'.  Also note that this operation has no effect if
         // 'numElements <= size()'.
 
+    node_type extract(const_iterator position);
+        // Remove from this unordered multiset the element at the specified
+        // 'position' without destroying it, and return a node handle owning
+        // that element.  The element (and references to it) remain valid until
+        // it is inserted into another container or the node handle is
+        // destroyed.  The behavior is undefined unless 'position' refers to an
+        // element in this unordered multiset.
+
+    node_type extract(const key_type& key);
+        // Remove from this unordered multiset the first element having the
+        // specified 'key', if it exists, without destroying it, and return a
+        // node handle owning that element; otherwise, return an empty node
+        // handle with no other effect.
+
+    iterator insert(const node_type& node);
+        // Insert the element owned by the specified 'node' handle into this
+        // unordered multiset, immediately before the first element (if any)
+        // having the same key, and leave 'node' empty.  Return an iterator
+        // referring to the newly inserted element, or 'end()' if 'node' is
+        // empty.  No memory is allocated for the element if the allocator of
+        // 'node' compares equal to that of this unordered multiset (see
+        // {Node Handles}).
+
+    iterator insert(const_iterator hint, const node_type& node);
+        // Insert the element owned by the specified 'node' handle into this
+        // unordered multiset, immediately before the specified 'hint' if the
+        // element at 'hint' has the same key as the node, and otherwise before
+        // the first element (if any) having the same key, and leave 'node'
+        // empty.  Return an iterator referring to the newly inserted element,
+        // or 'end()' if 'node' is empty.  The behavior is undefined unless
+        // 'hint' is a valid iterator into this unordered multiset.
+
+    template <class HASH2, class EQUAL2>
+    void merge(unordered_multiset<KEY, HASH2, EQUAL2, ALLOCATOR>& source);
+    template <class HASH2, class EQUAL2>
+    void merge(unordered_set<KEY, HASH2, EQUAL2, ALLOCATOR>& source);
+        // Transfer into this unordered multiset every element of the specified
+        // 'source', leaving 'source' empty.  If the allocator of 'source'
+        // compares equal to that of this unordered multiset, the elements are
+        // relinked without being copied and no new nodes are allocated;
+        // otherwise each element is copied into a node supplied by this
+        // unordered multiset and then erased from 'source'.  The behavior is
+        // undefined if 'source' is this unordered multiset.
+
     void swap(unordered_multiset& other);
         // Exchange the value of this object as well as its hasher and
         // key-equality functor with those of the specified 'other' object.
@@ -1018,6 +1183,50 @@ class unordered_multiset
         // specified 'key'.  Note that since an unordered set maintains unique
         // keys, the returned value will be either 0 or 1.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH,
+                                                      LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,
+                                                      LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of 'value_type' objects contained within this
+        // unordered multiset equal to the specified 'key'.  This method does
+        // not participate in overload resolution unless both 'HASH' and
+        // 'EQUAL' are transparent (see {Heterogeneous Lookup}).
+    {
+        HashTableLink *first;
+        HashTableLink *last;
+        d_impl.findTransparentRange(&first, &last, key);
+
+        size_type result = 0;
+        for (; first != last; first = first->nextLink()) {
+            ++result;
+        }
+        return result;
+    }
+
+    bool contains(const key_type& key) const;
+        // Return 'true' if this unordered multiset contains a 'value_type'
+        // object having the specified 'key', and 'false' otherwise.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH,
+                                                      LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,
+                                                      LOOKUP_KEY>::value,
+        bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this unordered multiset contains a 'value_type'
+        // object equal to the specified 'key', and 'false' otherwise.  This
+        // method does not participate in overload resolution unless both
+        // 'HASH' and 'EQUAL' are transparent (see {Heterogeneous Lookup}).
+    {
+        return 0 != d_impl.findTransparent(key);
+    }
+
     bool empty() const;
         // Return 'true' if multi-set contains no elements, and 'false'
         // otherwise.
@@ -1033,12 +1242,56 @@ class unordered_multiset
         // same value.  Note that since a set maintains unique keys, the range
         // will contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH,
+                                                      LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,
+                                                      LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this unordered multiset equal to
+        // the specified 'key', where the first iterator is positioned at the
+        // start of the sequence, and the second is positioned one past the end
+        // of the sequence.  If this unordered multiset contains no such
+        // 'value_type' object, then the two returned iterators will have the
+        // same value, 'end()'.  This method does not participate in overload
+        // resolution unless both 'HASH' and 'EQUAL' are transparent (see
+        // {Heterogeneous Lookup}).
+    {
+        typedef bsl::pair<const_iterator, const_iterator> ResultType;
+
+        HashTableLink *first;
+        HashTableLink *last;
+        d_impl.findTransparentRange(&first, &last, key);
+        return ResultType(const_iterator(first), const_iterator(last));
+    }
+
     const_iterator find(const key_type& key) const;
         // Return an iterator providing non-modifiable access to the first
         // 'value_type' objects in the sequence of value-elements of this
         // multi-set having the specified 'key', if such value-elements exist,
         // and the past-the-end ('end') iterator otherwise.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH,
+                                                      LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,
+                                                      LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the first
+        // 'value_type' object in this unordered multiset equal to the
+        // specified 'key', if such an object exists, and the past-the-end
+        // iterator ('end') otherwise.  This method does not participate in
+        // overload resolution unless both 'HASH' and 'EQUAL' are transparent
+        // (see {Heterogeneous Lookup}).
+    {
+        return const_iterator(d_impl.findTransparent(key));
+    }
+
     allocator_type get_allocator() const;
         // Return (a copy of) the allocator used for memory allocation by this
         // set.
@@ -1135,6 +1388,26 @@ void swap(unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>& a,
                         // class unordered_multiset
                         //-------------------------
 
+// PRIVATE MANIPULATORS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class SOURCE>
+void unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::mergeNodes(
+                                                                SOURCE *source)
+{
+    const bool relink = get_allocator() == source->get_allocator();
+
+    typename SOURCE::iterator it = source->begin();
+    while (it != source->end()) {
+        if (relink) {
+            d_impl.insertNode(source->extract(it++));
+        }
+        else {
+            d_impl.insert(*it);
+            source->erase(it++);
+        }
+    }
+}
+
 // CREATORS
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::
@@ -1407,6 +1680,70 @@ unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::reserve(size_type numElements)
     d_impl.reserveForNumElements(numElements);
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+typename unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::node_type
+unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::extract(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != this->end());
+
+    return d_impl.template extract<node_type>(position.node());
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+typename unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::node_type
+unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::extract(const key_type& key)
+{
+    HashTableLink *target = d_impl.find(key);
+    if (!target) {
+        return node_type();                                           // RETURN
+    }
+    return d_impl.template extract<node_type>(target);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+typename unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::insert(const node_type& node)
+{
+    if (node.empty()) {
+        return end();                                                 // RETURN
+    }
+
+    return iterator(d_impl.insertNode(node));
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+typename unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::insert(const_iterator   hint,
+                                                        const node_type& node)
+{
+    if (node.empty()) {
+        return end();                                                 // RETURN
+    }
+
+    return hint == end()
+         ? iterator(d_impl.insertNode(node))
+         : iterator(d_impl.insertNode(node, hint.node()));
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class HASH2, class EQUAL2>
+inline
+void unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::merge(
+                     unordered_multiset<KEY, HASH2, EQUAL2, ALLOCATOR>& source)
+{
+    mergeNodes(&source);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class HASH2, class EQUAL2>
+inline
+void unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::merge(
+                          unordered_set<KEY, HASH2, EQUAL2, ALLOCATOR>& source)
+{
+    mergeNodes(&source);
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 void
 unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::swap(
@@ -1537,6 +1874,15 @@ unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::count(
     return result;
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool
+unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::contains(
+                                                     const key_type& key) const
+{
+    return 0 != d_impl.find(key);
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 typename unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator
 unordered_multiset<KEY, HASH, EQUAL, ALLOCATOR>::find(
@@ -1,6 +1,7 @@
 // bslstl_unorderedmultiset.t.cpp                                     -*-C++-*-
 
 #include <bslstl_unorderedmultiset.h>
+#include <bslstl_unorderedset.h>  // for testing only
 
 #include <bslstl_iterator.h>  // for testing only
 
@@ -143,6 +144,19 @@ using namespace BloombergLP;
 // [ 4] size_type count(const key_type& key) const;
 // [ 4] bsl::pair<iterator, iterator> equal_range(const key_type& key);
 // [ 4] bsl::pair<const_iter, const_iter> equal_range(const key_type&) const;
+// [16] iterator find(const LOOKUP_KEY& key);
+// [16] const_iterator find(const LOOKUP_KEY& key) const;
+// [16] size_type count(const LOOKUP_KEY& key) const;
+// [16] bool contains(const key_type& key) const;
+// [16] bool contains(const LOOKUP_KEY& key) const;
+// [16] bsl::pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+// [16] bsl::pair<c_iter, c_iter> equal_range(const LOOKUP_KEY&) const;
+// [17] node_type extract(const_iterator position);
+// [17] node_type extract(const key_type& key);
+// [17] iterator insert(const node_type& node);
+// [17] iterator insert(const_iterator hint, const node_type& node);
+// [17] void merge(unordered_multiset<K, H2, E2, A>& source);
+// [17] void merge(unordered_set<K, H2, E2, A>& source);
 //
 // bucket interface:
 // [ 4] size_type bucket_count() const;
@@ -165,7 +179,7 @@ using namespace BloombergLP;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] default construction (only)
-// [ 5] USAGE EXAMPLE
+// [18] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int ggg(unordered_multiset<T,H,E,A> *o, const char *s, int verbose);
@@ -4496,6 +4510,58 @@ if (verbose) {
     }
 //..
 
+// ============================================================================
+//                  TRANSPARENT HASHER AND EQUALITY FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct TransparentProbe {
+    // This 'struct' provides a lookup key, holding an 'int' value, that is not
+    // convertible to 'int'.
+
+    int d_value;
+};
+
+struct TransparentHash {
+    // This 'struct' provides a transparent hasher for 'int' keys and
+    // 'TransparentProbe' objects that returns the same hash code for an 'int'
+    // and a 'TransparentProbe' having the same value.
+
+    typedef void is_transparent;
+
+    native_std::size_t operator()(int key) const
+        // Return a hash code for the specified 'key'.
+    {
+        return static_cast<native_std::size_t>(key) * 0x9E3779B1u;
+    }
+
+    native_std::size_t operator()(const TransparentProbe& key) const
+        // Return a hash code for the value held by the specified 'key'.
+    {
+        return (*this)(key.d_value);
+    }
+};
+
+struct TransparentEqual {
+    // This 'struct' provides a transparent equality comparator for 'int' keys
+    // and 'TransparentProbe' objects.
+
+    typedef void is_transparent;
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' has the same value as the
+        // specified 'rhs', and 'false' otherwise.
+    {
+        return lhs == rhs;
+    }
+
+    bool operator()(const TransparentProbe& lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' holds the same value as the
+        // specified 'rhs', and 'false' otherwise.
+    {
+        return lhs.d_value == rhs;
+    }
+};
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -4514,7 +4580,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocator(&testAlloc);
 
     switch (test) { case 0:
-      case 16: {
+      case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -4667,6 +4733,346 @@ int main(int argc, char *argv[])
 // See the material in {'bslstl_unorderedmap'|Example 2}.
 
       } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // TESTING NODE HANDLES
+        //
+        // Concerns:
+        //: 1 'extract' unlinks an element from the container without copying
+        //:   or destroying it, and the returned node handle owns the element.
+        //:
+        //: 2 Inserting a node handle into a container having an equal
+        //:   allocator relinks the very same node, and allocates no memory.
+        //:
+        //: 3 A relinked node, and a node owned by a node handle, remain valid
+        //:   after the container from which the node was extracted is
+        //:   destroyed, and all memory is reclaimed when its owner is
+        //:   destroyed.
+        //:
+        //: 4 An inserted node precedes the elements having an equivalent key
+        //:   (or the element at the hint, if it has an equivalent key).
+        //:
+        //: 5 'merge' transfers every element of a container of either type,
+        //:   relinking them without allocating a node.
+        //:
+        //: 6 If the allocators are not equal, the elements are copied into
+        //:   nodes supplied by the target container, and the source nodes
+        //:   are destroyed.
+        //:
+        //: 7 Inserting an empty node handle has no effect.
+        //
+        // Plan:
+        //: 1 Extract elements from a container, insert them into another
+        //:   container using the same allocator, and compare the addresses
+        //:   of the elements before and after the transfer.  Use a test
+        //:   allocator monitor to verify that no memory is allocated by
+        //:   'insert'.  Destroy the source container and verify the values
+        //:   of the transferred elements.  (C-1..3)
+        //:
+        //: 2 Insert node handles whose keys are already present, and empty
+        //:   node handles, and verify the result and the state of the
+        //:   container.  (C-4, 7)
+        //:
+        //: 3 Merge containers of both types, and verify the contents of the
+        //:   source and target, the address of a transferred element, and
+        //:   the number of blocks allocated.  (C-5)
+        //:
+        //: 4 Repeat the transfers between containers using different test
+        //:   allocators, and verify that no memory remains in use from the
+        //:   source allocator once the source container is destroyed.  (C-6)
+        //
+        // Testing:
+        //   node_type extract(const_iterator position);
+        //   node_type extract(const key_type& key);
+        //   iterator insert(const node_type& node);
+        //   iterator insert(const_iterator hint, const node_type& node);
+        //   void merge(unordered_multiset<K, H2, E2, A>& source);
+        //   void merge(unordered_set<K, H2, E2, A>& source);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING NODE HANDLES"
+                            "\n====================\n");
+
+        typedef bsl::unordered_multiset<int> Obj;
+        typedef bsl::unordered_set<int>      UniqueObj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting 'extract' and 'insert(nh)'.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.reserve(16);
+
+            Obj::node_type         nh;
+            const Obj::value_type *ADDRESS;
+            {
+                Obj mY(&oa);  const Obj& Y = mY;
+                for (int i = 0; i < 8; ++i) {
+                    mY.insert(i % 4);
+                }
+                ADDRESS = &*Y.find(2);
+
+                nh = mY.extract(2);
+                ASSERT(!nh.empty());
+                ASSERT(2       == nh.value());
+                ASSERT(ADDRESS == &nh.value());
+                ASSERT(7       == Y.size());
+                ASSERT(1       == Y.count(2));
+
+                // The only block that may be allocated is the index with which
+                // 'mX' tracks the chunk from which it borrows the node.
+
+                const bsls::Types::Int64 BLOCKS = oa.numBlocksTotal();
+
+                Obj::iterator it = mX.insert(nh);
+                ASSERTV(oa.numBlocksTotal() - BLOCKS,
+                        1 >= oa.numBlocksTotal() - BLOCKS);
+                ASSERT(nh.empty());
+                ASSERT(ADDRESS == &*it);
+                ASSERT(1       == X.size());
+
+                nh = mY.extract(Y.find(0));
+                ASSERT(0 == nh.value());
+                ASSERT(6 == Y.size());
+            }
+
+            // The relinked node, and the node owned by 'nh', outlive the
+            // container from which they were extracted.
+
+            ASSERT(ADDRESS == &*X.find(2));
+            ASSERT(0       == nh.value());
+
+            mX.insert(0);
+
+            // A node is inserted before the equivalent elements.
+
+            Obj::iterator it = mX.insert(nh);
+            ASSERT(nh.empty());
+            ASSERT(2  == X.count(0));
+            ASSERT(it == X.find(0));
+
+            Obj::iterator second = it;
+            ++second;
+            nh = mX.extract(second);
+            it = mX.insert(X.find(0), nh);
+            ASSERT(nh.empty());
+            ASSERT(it == X.find(0));
+
+            nh = mX.extract(2);
+            nh.value() = 5;
+            it = mX.insert(X.end(), nh);
+            ASSERT(nh.empty());
+            ASSERT(5 == *it);
+            ASSERT(3 == X.size());
+
+            const Obj::node_type EMPTY;
+
+            ASSERT(X.end() == mX.insert(EMPTY));
+            ASSERT(X.end() == mX.insert(X.begin(), EMPTY));
+            ASSERT(mX.extract(7).empty());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting 'merge'.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            Obj mY(&oa);  const Obj& Y = mY;
+            mX.reserve(32);
+
+            for (int i = 0; i < 10; ++i) {
+                mX.insert(i % 5);
+                mY.insert(i % 5);
+            }
+            const Obj::value_type *ADDRESS = &*Y.find(3);
+
+            // No node is allocated: the only blocks that may be allocated are
+            // the indexes with which the two pools track the chunks lent and
+            // borrowed.
+
+            const bsls::Types::Int64 BLOCKS = oa.numBlocksInUse();
+
+            mX.merge(mY);
+
+            ASSERTV(oa.numBlocksInUse() - BLOCKS,
+                    2 >= oa.numBlocksInUse() - BLOCKS);
+            ASSERT(20 == X.size());
+            ASSERT(0  == Y.size());
+            ASSERT(4  == X.count(3));
+
+            bool found = false;
+            for (Obj::const_iterator it = X.find(3);
+                 it != X.end() && 3 == *it;
+                 ++it) {
+                found = found || ADDRESS == &*it;
+            }
+            ASSERT(found);
+
+            UniqueObj mZ(&oa);  const UniqueObj& Z = mZ;
+            mZ.insert(1);
+            mZ.insert(11);
+
+            mX.merge(mZ);
+            ASSERT(22 == X.size());
+            ASSERT(0  == Z.size());
+            ASSERT(5  == X.count(1));
+            ASSERT(1  == X.count(11));
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting unequal allocators.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            {
+                Obj mY(&za);  const Obj& Y = mY;
+                for (int i = 0; i < 6; ++i) {
+                    mY.insert(i);
+                }
+                const Obj::value_type *ADDRESS = &*Y.find(2);
+
+                Obj::node_type nh = mY.extract(2);
+                ASSERT(&za == nh.get_allocator().mechanism());
+
+                Obj::iterator it = mX.insert(nh);
+                ASSERT(nh.empty());
+                ASSERT(ADDRESS != &*it);
+                ASSERT(2       == *it);
+
+                mX.merge(mY);
+                ASSERT(6 == X.size());
+                ASSERT(0 == Y.size());
+            }
+            ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+
+            for (int i = 0; i < 6; ++i) {
+                ASSERTV(i, 1 == X.count(i));
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING TRANSPARENT LOOKUP
+        //
+        // Concerns:
+        //: 1 If both the hasher and the equality comparator are transparent,
+        //:   'find', 'count', 'contains', and 'equal_range' accept a key of a
+        //:   type that is not convertible to 'key_type'.
+        //:
+        //: 2 The transparent overloads locate exactly the elements that are
+        //:   equal to the supplied key.
+        //:
+        //: 3 Both the 'const' and non-'const' overloads are provided, and
+        //:   return iterators to the same elements.
+        //:
+        //: 4 No memory is allocated by the lookup methods.
+        //:
+        //: 5 'contains' reports whether an element having the supplied
+        //:   'key_type' key exists, whether or not the functors are
+        //:   transparent.
+        //
+        // Plan:
+        //: 1 Create an unordered multiset keyed on 'int' using the transparent
+        //:   functors 'TransparentHash' and 'TransparentEqual', and search it
+        //:   using 'TransparentProbe' objects, which are not convertible to
+        //:   'int'.  Compare the results with those of the 'key_type'
+        //:   overloads, and with a brute-force count of the equal keys.
+        //:   (C-1..3)
+        //:
+        //: 2 Install a test allocator as the default allocator, and use test
+        //:   allocator monitors to verify that no memory is allocated from it,
+        //:   or from the object allocator, by the lookups.  (C-4)
+        //:
+        //: 3 Invoke 'contains' on an unordered multiset using the default
+        //:   functors for keys that are, and are not, present.  (C-5)
+        //
+        // Testing:
+        //   iterator find(const LOOKUP_KEY& key);
+        //   const_iterator find(const LOOKUP_KEY& key) const;
+        //   size_type count(const LOOKUP_KEY& key) const;
+        //   bool contains(const key_type& key) const;
+        //   bool contains(const LOOKUP_KEY& key) const;
+        //   pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+        //   pair<c_iter, c_iter> equal_range(const LOOKUP_KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING TRANSPARENT LOOKUP"
+                            "\n==========================\n");
+
+        typedef bsl::unordered_multiset<int, TransparentHash, TransparentEqual>
+                                                                           Obj;
+
+        static const int KEYS[]   = { 3, 15, 15, 17, 22, 41, 44, 44, 45 };
+        const int        NUM_KEYS = sizeof KEYS / sizeof *KEYS;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            mX.insert(KEYS[i]);
+        }
+        ASSERTV(X.size(), NUM_KEYS == static_cast<int>(X.size()));
+
+        bslma::TestAllocatorMonitor oam(&oa);
+        bslma::TestAllocatorMonitor dam(&da);
+
+        for (int value = 0; value < 50; ++value) {
+            const TransparentProbe PROBE = { value };
+
+            int expected = 0;
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                if (KEYS[i] == value) {
+                    ++expected;
+                }
+            }
+
+            if (veryVerbose) { T_ P_(value) P(expected) }
+
+            ASSERTV(value, mX.find(value) == mX.find(PROBE));
+            ASSERTV(value,  X.find(value) ==  X.find(PROBE));
+            ASSERTV(value, (0 == expected) == (X.end() == X.find(PROBE)));
+
+            ASSERTV(value, expected == static_cast<int>(X.count(PROBE)));
+            ASSERTV(value, (0 != expected) == X.contains(PROBE));
+
+            const bsl::pair<Obj::iterator, Obj::iterator> R =
+                                                       mX.equal_range(PROBE);
+            ASSERTV(value, mX.equal_range(value) == R);
+
+            const bsl::pair<Obj::const_iterator, Obj::const_iterator> CR =
+                                                        X.equal_range(PROBE);
+            ASSERTV(value, X.equal_range(value) == CR);
+
+            int length = 0;
+            for (Obj::const_iterator it = CR.first; it != CR.second; ++it) {
+                ASSERTV(value, *it, value == *it);
+                ++length;
+            }
+            ASSERTV(value, expected, length, expected == length);
+        }
+
+        ASSERT(oam.isTotalSame());
+        ASSERT(dam.isTotalSame());
+
+        if (verbose) printf("\nTesting 'contains' with a 'key_type' key.\n");
+        {
+            typedef bsl::unordered_multiset<int> PlainObj;
+
+            PlainObj mY(&oa);  const PlainObj& Y = mY;
+            mY.insert(1);
+            mY.insert(3);
+
+            ASSERT(!Y.contains(0));
+            ASSERT( Y.contains(1));
+            ASSERT(!Y.contains(2));
+            ASSERT( Y.contains(3));
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // TESTING HASH_FUNCTION AND KEY_EQ
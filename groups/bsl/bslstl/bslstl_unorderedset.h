@@ -97,6 +97,54 @@ BSLS_IDENT("$Id: $")
 // two objects whose keys compare equal by the comparator, shall produce the
 // same value from the hasher.
 //
+///Heterogeneous Lookup
+///--------------------
+// If both of the (template parameter) types 'HASH' and 'EQUAL' are
+// *transparent* (i.e., each declares a nested type named 'is_transparent'),
+// the 'find', 'count', 'contains', and 'equal_range' methods of
+// 'unordered_set' provide additional overloads that accept a key of any type
+// that 'HASH' can hash and 'EQUAL' can compare with 'KEY'.  These overloads do
+// not convert the supplied key to 'KEY', so, for example, an 'unordered_set'
+// keyed on 'bsl::string' can be searched using a 'bslstl::StringRef' or a
+// 'const char *' without constructing (and allocating memory for) a temporary
+// 'bsl::string'.  The behavior is undefined unless 'HASH' returns the same
+// hash code for a key as it does for every 'KEY' that 'EQUAL' considers equal
+// to that key.  If either 'HASH' or 'EQUAL' is not transparent, these
+// overloads do not participate in overload resolution.
+//
+///Batched Lookup
+///--------------
+// 'find_batch' looks up an array of keys, loading an iterator for each into
+// an array of results.  It yields the same iterators as calling 'find' for
+// each key, but hashes a run of keys before looking any of them up, and then
+// pipelines the lookups: while one bucket is searched, the first node of a
+// bucket some keys ahead, and the bucket of a key further ahead still, are
+// prefetched (see 'bslalg::HashTableImpUtil::findBatch').  When the container
+// is too large to be held in the cache, each lookup is dominated by the
+// latency of two or more cache misses, which 'find_batch' incurs in parallel
+// rather than one after another, so that looking up a large batch of keys is
+// typically one and a half to two times faster.  For a container that fits in
+// the cache, calling 'find' for each key is faster.
+//
+///Node Handles
+///------------
+// The 'extract' methods of 'unordered_set' unlink an element from the
+// container and return it, without copying or destroying it, in a 'node_type'
+// object (a *node* *handle*, see 'bslstl_nodehandle') that owns the element
+// until it is inserted into another container, or until the node handle is
+// destroyed.  Passing a node handle to the overloads of 'insert' taking a
+// 'node_type' links the element into the target container, and 'merge'
+// transfers elements directly from another 'unordered_set' or
+// 'unordered_multiset' having the same allocator type.  When the allocators of
+// the two containers compare equal, no element is copied and no node is
+// allocated: the node (and the memory block that holds it) is handed over to
+// the target container, whose node pool keeps that block alive even if the
+// source container is subsequently destroyed.  When the allocators differ, the
+// element is instead copied into a node supplied by the target container, and
+// the original is destroyed.  Note that, absent move semantics, 'node_type'
+// *transfers* ownership when copied or assigned, leaving the source handle
+// empty.
+//
 ///Memory Allocation
 ///-----------------
 // The type supplied as a set's 'ALLOCATOR' template parameter determines how
@@ -142,6 +190,7 @@ BSLS_IDENT("$Id: $")
 //  'k'             - an object of type 'K'
 //  'v'             - an object of type 'value_type'
 //  'p1', 'p2'      - two iterators belonging to 'a'
+//  'nh'            - an object of type 'node_type'
 //  distance(i1,i2) - the number of elements in the range [i1, i2)
 //  distance(p1,p2) - the number of elements in the range [p1, p2)
 //
@@ -204,6 +253,21 @@ BSLS_IDENT("$Id: $")
 //  |                                                    | Worst:  O[ n *     |
 //  |                                                    |   distance(i1, i2)]|
 //  +----------------------------------------------------+--------------------+
+//  | a.insert(nh)                                       | Average: O[1]      |
+//  |                                                    | Worst:   O[n]      |
+//  +----------------------------------------------------+--------------------+
+//  | a.insert(p1, nh)                                   | Average: O[1]      |
+//  |                                                    | Worst:   O[n]      |
+//  +----------------------------------------------------+--------------------+
+//  | a.extract(p1)                                      | Average: O[1]      |
+//  |                                                    | Worst:   O[n]      |
+//  +----------------------------------------------------+--------------------+
+//  | a.extract(k)                                       | Average: O[1]      |
+//  |                                                    | Worst:   O[n]      |
+//  +----------------------------------------------------+--------------------+
+//  | a.merge(b)                                         | Average: O[m]      |
+//  |                                                    | Worst:   O[n * m]  |
+//  +----------------------------------------------------+--------------------+
 //  | a.erase(p1)                                        | Average: O[1]      |
 //  |                                                    | Worst:   O[n]      |
 //  +----------------------------------------------------+--------------------+
@@ -220,6 +284,9 @@ BSLS_IDENT("$Id: $")
 //  | a.find(k)                                          | Average: O[1]      |
 //  |                                                    | Worst:   O[n]      |
 //  +----------------------------------------------------+--------------------+
+//  | a.find_batch(k, m, r)                              | Average: O[m]      |
+//  |                                                    | Worst:   O[m * n]  |
+//  +----------------------------------------------------+--------------------+
 //  | a.count(k)                                         | Average: O[1]      |
 //  |                                                    | Worst:   O[n]      |
 //  +----------------------------------------------------+--------------------+
@@ -552,6 +619,10 @@ BSL_OVERRIDES_STD mode"
 #include <bslstl_iteratorutil.h>
 #endif
 
+#ifndef INCLUDED_BSLSTL_NODEHANDLE
+#include <bslstl_nodehandle.h>
+#endif
+
 #ifndef INCLUDED_BSLSTL_PAIR
 #include <bslstl_pair.h>  // result type of 'equal_range' method
 #endif
@@ -572,10 +643,18 @@ BSL_OVERRIDES_STD mode"
 #include <bslma_usesbslmaallocator.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ENABLEIF
+#include <bslmf_enableif.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
 #include <bslmf_isbitwisemoveable.h>
 #endif
 
+#ifndef INCLUDED_BSLMF_ISTRANSPARENTPREDICATE
+#include <bslmf_istransparentpredicate.h>
+#endif
+
 #ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
 #include <bslmf_nestedtraitdeclaration.h>
 #endif
@@ -591,6 +670,9 @@ BSL_OVERRIDES_STD mode"
 
 namespace bsl {
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+class unordered_multiset;
+
                         // ===================
                         // class unordered_set
                         // ===================
@@ -680,10 +762,26 @@ class unordered_set
     typedef iterator                                            const_iterator;
     typedef local_iterator                                const_local_iterator;
 
+    typedef BloombergLP::bslstl::NodeHandle<typename HashTable::NodeFactory,
+                                            ALLOCATOR>
+                                                                     node_type;
+    typedef BloombergLP::bslstl::NodeInsertReturnType<iterator,
+                                                       node_type>
+                                                            insert_return_type;
+
   private:
     // DATA
     HashTable  d_impl;
 
+    // PRIVATE MANIPULATORS
+    template <class SOURCE>
+    void mergeNodes(SOURCE *source);
+        // Transfer into this unordered set each element of the specified
+        // 'source' container whose key is not already present in this
+        // unordered set, leaving the remaining elements in 'source'.  Relink
+        // the transferred nodes if the allocator of 'source' compares equal to
+        // that of this unordered set, and copy them into new nodes otherwise.
+
   public:
     // CREATORS
     explicit unordered_set(
@@ -821,6 +919,32 @@ class unordered_set
         // same value.  Note that since a set maintains unique keys, the range
         // will contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH,
+                                                      LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,
+                                                      LOOKUP_KEY>::value,
+        pair<iterator, iterator> >::type
+    equal_range(const LOOKUP_KEY& key)
+        // Return a pair of iterators providing modifiable access to the
+        // sequence of 'value_type' objects in this unordered set equal to the
+        // specified 'key', where the first iterator is positioned at the start
+        // of the sequence, and the second is positioned one past the end of
+        // the sequence.  If this unordered set contains no such 'value_type'
+        // object, then the two returned iterators will have the same value,
+        // 'end()'.  This method does not participate in overload resolution
+        // unless both 'HASH' and 'EQUAL' are transparent (see {Heterogeneous
+        // Lookup}).
+    {
+        typedef bsl::pair<iterator, iterator> ResultType;
+
+        HashTableLink *first = d_impl.findTransparent(key);
+        return first
+             ? ResultType(iterator(first), iterator(first->nextLink()))
+             : ResultType(iterator(0),     iterator(0));
+    }
+
     size_type erase(const key_type& key);
         // Remove from this set the 'value_type' object having the specified
         // 'key', if it exists, and return 1; otherwise, if there is no
@@ -848,6 +972,23 @@ class unordered_set
         // object in this set having the specified 'key', if such an entry
         // exists, and the past-the-end ('end') iterator otherwise.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH,
+                                                      LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,
+                                                      LOOKUP_KEY>::value,
+        iterator>::type
+    find(const LOOKUP_KEY& key)
+        // Return an iterator providing modifiable access to the 'value_type'
+        // object in this unordered set equal to the specified 'key', if such
+        // an entry exists, and the past-the-end iterator ('end') otherwise.
+        // This method does not participate in overload resolution unless both
+        // 'HASH' and 'EQUAL' are transparent (see {Heterogeneous Lookup}).
+    {
+        return iterator(d_impl.findTransparent(key));
+    }
+
     pair<iterator, bool> insert(const value_type& value);
         // Insert the specified 'value' into this set if the key (the 'first'
         // element) of the 'value' does not already exist in this set;
@@ -911,6 +1052,57 @@ class unordered_set
         // numElements'.  Also note that this operation has no effect if
         // 'numElements <= size()'.
 
+    node_type extract(const_iterator position);
+        // Remove from this unordered set the element at the specified
+        // 'position' without destroying it, and return a node handle owning
+        // that element.  The element (and references to it) remain valid until
+        // it is inserted into another container or the node handle is
+        // destroyed.  The behavior is undefined unless 'position' refers to an
+        // element in this unordered set.
+
+    node_type extract(const key_type& key);
+        // Remove from this unordered set the element having the specified
+        // 'key', if it exists, without destroying it, and return a node handle
+        // owning that element; otherwise, return an empty node handle with no
+        // other effect.
+
+    insert_return_type insert(const node_type& node);
+        // Insert the element owned by the specified 'node' handle into this
+        // unordered set if its key does not already exist in this unordered
+        // set, and leave 'node' empty; otherwise, if an element having the
+        // same key already exists in this unordered set, this method has no
+        // effect on this unordered set.  Return an 'insert_return_type' object
+        // whose 'position' member refers to the (possibly newly inserted)
+        // element having the key of the node, whose 'inserted' member is
+        // 'true' if the node was inserted and 'false' otherwise, and whose
+        // 'node' member is empty if the node was inserted, and has taken
+        // ownership of the node from 'node' otherwise.  If 'node' is empty,
+        // return an object whose 'position' is 'end()', whose 'inserted'
+        // member is 'false', and whose 'node' is empty.  No memory is
+        // allocated for the element if the allocator of 'node' compares equal
+        // to that of this unordered set (see {Node Handles}).
+
+    iterator insert(const_iterator hint, const node_type& node);
+        // Insert the element owned by the specified 'node' handle into this
+        // unordered set if its key does not already exist in this unordered
+        // set, and leave 'node' empty; otherwise, leave both this unordered
+        // set and 'node' unchanged.  Return an iterator referring to the
+        // (possibly newly inserted) element having the key of the node, or
+        // 'end()' if 'node' is empty.  Note that the specified 'hint' is
+        // ignored.
+
+    template <class HASH2, class EQUAL2>
+    void merge(unordered_set<KEY, HASH2, EQUAL2, ALLOCATOR>& source);
+    template <class HASH2, class EQUAL2>
+    void merge(unordered_multiset<KEY, HASH2, EQUAL2, ALLOCATOR>& source);
+        // Transfer into this unordered set each element of the specified
+        // 'source' whose key does not already exist in this unordered set,
+        // leaving the remaining elements in 'source'.  If the allocator of
+        // 'source' compares equal to that of this unordered set, the elements
+        // are relinked without being copied and no new nodes are allocated;
+        // otherwise each transferred element is copied into a node supplied by
+        // this unordered set and then erased from 'source'.
+
     void swap(unordered_set& other);
         // Exchange the value of this object as well as its hasher and
         // key-equality functor with those of the specified 'other' object.
@@ -969,6 +1161,42 @@ class unordered_set
         // specified 'key'.  Note that since an unordered set maintains unique
         // keys, the returned value will be either 0 or 1.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH,
+                                                      LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,
+                                                      LOOKUP_KEY>::value,
+        size_type>::type
+    count(const LOOKUP_KEY& key) const
+        // Return the number of 'value_type' objects contained within this
+        // unordered set equal to the specified 'key'.  This method does not
+        // participate in overload resolution unless both 'HASH' and 'EQUAL'
+        // are transparent (see {Heterogeneous Lookup}).
+    {
+        return 0 != d_impl.findTransparent(key);
+    }
+
+    bool contains(const key_type& key) const;
+        // Return 'true' if this unordered set contains a 'value_type' object
+        // having the specified 'key', and 'false' otherwise.
+
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH,
+                                                      LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,
+                                                      LOOKUP_KEY>::value,
+        bool>::type
+    contains(const LOOKUP_KEY& key) const
+        // Return 'true' if this unordered set contains a 'value_type' object
+        // equal to the specified 'key', and 'false' otherwise.  This method
+        // does not participate in overload resolution unless both 'HASH' and
+        // 'EQUAL' are transparent (see {Heterogeneous Lookup}).
+    {
+        return 0 != d_impl.findTransparent(key);
+    }
+
     bool empty() const;
         // Return 'true' if this set contains no elements, and 'false'
         // otherwise.
@@ -984,11 +1212,69 @@ class unordered_set
         // same value.  Note that since a set maintains unique keys, the range
         // will contain at most one element.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH,
+                                                      LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,
+                                                      LOOKUP_KEY>::value,
+        pair<const_iterator, const_iterator> >::type
+    equal_range(const LOOKUP_KEY& key) const
+        // Return a pair of iterators providing non-modifiable access to the
+        // sequence of 'value_type' objects in this unordered set equal to the
+        // specified 'key', where the first iterator is positioned at the start
+        // of the sequence, and the second is positioned one past the end of
+        // the sequence.  If this unordered set contains no such 'value_type'
+        // object, then the two returned iterators will have the same value,
+        // 'end()'.  This method does not participate in overload resolution
+        // unless both 'HASH' and 'EQUAL' are transparent (see {Heterogeneous
+        // Lookup}).
+    {
+        typedef bsl::pair<const_iterator, const_iterator> ResultType;
+
+        HashTableLink *first = d_impl.findTransparent(key);
+        return first
+             ? ResultType(const_iterator(first),
+                          const_iterator(first->nextLink()))
+             : ResultType(const_iterator(0), const_iterator(0));
+    }
+
     const_iterator find(const key_type& key) const;
         // Return an iterator providing non-modifiable access to the
         // 'value_type' object in this set having the specified 'key', if such
         // an entry exists, and the past-the-end ('end') iterator otherwise.
 
+    template <class LOOKUP_KEY>
+    typename enable_if<
+           BloombergLP::bslmf::IsTransparentPredicate<HASH,
+                                                      LOOKUP_KEY>::value
+        && BloombergLP::bslmf::IsTransparentPredicate<EQUAL,
+                                                      LOOKUP_KEY>::value,
+        const_iterator>::type
+    find(const LOOKUP_KEY& key) const
+        // Return an iterator providing non-modifiable access to the
+        // 'value_type' object in this unordered set equal to the specified
+        // 'key', if such an entry exists, and the past-the-end iterator
+        // ('end') otherwise.  This method does not participate in overload
+        // resolution unless both 'HASH' and 'EQUAL' are transparent (see
+        // {Heterogeneous Lookup}).
+    {
+        return const_iterator(d_impl.findTransparent(key));
+    }
+
+    void find_batch(const key_type *keys,
+                    size_type       numKeys,
+                    const_iterator *results) const;
+        // Load into each of the specified 'numKeys' elements of the specified
+        // 'results' array an iterator providing non-modifiable access to the
+        // 'value_type' object in this set equal to the corresponding element
+        // of the specified 'keys' array, if such an entry exists, and the
+        // past-the-end ('end') iterator otherwise.  The behavior is undefined
+        // unless 'keys' and 'results' each refer to an array of at least
+        // 'numKeys' elements.  Note that the results are the same as those of
+        // calling 'find' for each key, but this method is faster for large
+        // batches of keys (see {Batched Lookup}).
+
     allocator_type get_allocator() const;
         // Return (a copy of) the allocator used for memory allocation by this
         // set.
@@ -1076,6 +1362,28 @@ void swap(unordered_set<KEY, HASH, EQUAL, ALLOCATOR>& a,
                         // class unordered_set
                         //--------------------
 
+// PRIVATE MANIPULATORS
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class SOURCE>
+void unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::mergeNodes(SOURCE *source)
+{
+    const bool relink = get_allocator() == source->get_allocator();
+
+    typename SOURCE::iterator it = source->begin();
+    while (it != source->end()) {
+        if (d_impl.find(*it)) {
+            ++it;
+        }
+        else if (relink) {
+            d_impl.insertNode(source->extract(it++));
+        }
+        else {
+            d_impl.insert(*it);
+            source->erase(it++);
+        }
+    }
+}
+
 // CREATORS
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
@@ -1340,6 +1648,79 @@ unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::reserve(size_type numElements)
     d_impl.reserveForNumElements(numElements);
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::node_type
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::extract(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != this->end());
+
+    return d_impl.template extract<node_type>(position.node());
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::node_type
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::extract(const key_type& key)
+{
+    HashTableLink *target = d_impl.find(key);
+    if (!target) {
+        return node_type();                                           // RETURN
+    }
+    return d_impl.template extract<node_type>(target);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::insert_return_type
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::insert(const node_type& node)
+{
+    if (node.empty()) {
+        return insert_return_type(end(), false, node_type());         // RETURN
+    }
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.insertNodeIfMissing(&isInsertedFlag, node);
+
+    return isInsertedFlag
+         ? insert_return_type(iterator(result), true, node_type())
+         : insert_return_type(iterator(result), false, node);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::insert(
+                                                         const_iterator,
+                                                         const node_type& node)
+{
+    // As with the insertion of a value, the 'hint' is of no help in finding
+    // the start of the bucket, which must be searched for duplicates.
+
+    if (node.empty()) {
+        return end();                                                 // RETURN
+    }
+
+    bool isInsertedFlag;  // not used
+
+    return iterator(d_impl.insertNodeIfMissing(&isInsertedFlag, node));
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class HASH2, class EQUAL2>
+inline
+void unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::merge(
+                          unordered_set<KEY, HASH2, EQUAL2, ALLOCATOR>& source)
+{
+    mergeNodes(&source);
+}
+
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+template <class HASH2, class EQUAL2>
+inline
+void unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::merge(
+                     unordered_multiset<KEY, HASH2, EQUAL2, ALLOCATOR>& source)
+{
+    mergeNodes(&source);
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
 void unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::swap(unordered_set& other)
@@ -1428,6 +1809,15 @@ unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::count(const key_type& key) const
     return 0 != d_impl.find(key);
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bool
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::contains(
+                                                     const key_type& key) const
+{
+    return 0 != d_impl.find(key);
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
 bool unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::empty() const
@@ -1443,6 +1833,19 @@ unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::find(const key_type& key) const
     return const_iterator(d_impl.find(key));
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::find_batch(
+                                             const key_type *keys,
+                                             size_type       numKeys,
+                                             const_iterator *results) const
+{
+    BSLS_ASSERT_SAFE(keys    || 0 == numKeys);
+    BSLS_ASSERT_SAFE(results || 0 == numKeys);
+
+    d_impl.findBatch(results, keys, numKeys);
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
 bsl::pair<typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator,
@@ -1,6 +1,7 @@
 // bslstl_unorderedset.t.cpp                                          -*-C++-*-
 
 #include <bslstl_unorderedset.h>
+#include <bslstl_unorderedmultiset.h>  // for testing only
 
 #include <bslalg_rangecompare.h>
 #include <bslalg_swaputil.h>
@@ -168,6 +169,20 @@ using namespace BloombergLP;
 //*[13] size_type count(const key_type& key) const;
 //*[13] bsl::pair<iterator, iterator> equal_range(const key_type& key);
 //*[13] bsl::pair<const_iter, const_iter> equal_range(const key_type&) const;
+// [28] iterator find(const LOOKUP_KEY& key);
+// [28] const_iterator find(const LOOKUP_KEY& key) const;
+// [28] size_type count(const LOOKUP_KEY& key) const;
+// [28] bool contains(const key_type& key) const;
+// [28] bool contains(const LOOKUP_KEY& key) const;
+// [28] bsl::pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+// [28] bsl::pair<c_iter, c_iter> equal_range(const LOOKUP_KEY&) const;
+// [29] node_type extract(const_iterator position);
+// [29] node_type extract(const key_type& key);
+// [29] insert_return_type insert(const node_type& node);
+// [29] iterator insert(const_iterator hint, const node_type& node);
+// [29] void merge(unordered_set<K, H2, E2, A>& source);
+// [29] void merge(unordered_multiset<K, H2, E2, A>& source);
+// [30] void find_batch(const key_type *k, size_type n, c_iter *r) const;
 //
 // bucket interface:
 //*[26] size_type bucket_count() const;
@@ -198,7 +213,7 @@ using namespace BloombergLP;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] default construction (only)
-// [29] USAGE EXAMPLE
+// [31] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 //*[ 3] int ggg(unordered_set<K,H,E,A> *object, const char *spec, int verbose);
@@ -6345,6 +6360,74 @@ typedef bsl::unordered_set<CustomerProfile,
 typedef ProfileCategories::const_iterator        ProfileCategoriesConstItr;
 //..
 
+// ============================================================================
+//                  TRANSPARENT HASHER AND EQUALITY FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct TransparentProbe {
+    // This 'struct' provides a lookup key, holding an 'int' value, that is not
+    // convertible to 'int'.
+
+    int d_value;
+};
+
+struct TransparentHash {
+    // This 'struct' provides a transparent hasher for 'int' keys and
+    // 'TransparentProbe' objects that returns the same hash code for an 'int'
+    // and a 'TransparentProbe' having the same value.
+
+    typedef void is_transparent;
+
+    native_std::size_t operator()(int key) const
+        // Return a hash code for the specified 'key'.
+    {
+        return static_cast<native_std::size_t>(key) * 0x9E3779B1u;
+    }
+
+    native_std::size_t operator()(const TransparentProbe& key) const
+        // Return a hash code for the value held by the specified 'key'.
+    {
+        return (*this)(key.d_value);
+    }
+};
+
+struct TransparentEqual {
+    // This 'struct' provides a transparent equality comparator for 'int' keys
+    // and 'TransparentProbe' objects.
+
+    typedef void is_transparent;
+
+    bool operator()(int lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' has the same value as the
+        // specified 'rhs', and 'false' otherwise.
+    {
+        return lhs == rhs;
+    }
+
+    bool operator()(const TransparentProbe& lhs, int rhs) const
+        // Return 'true' if the specified 'lhs' holds the same value as the
+        // specified 'rhs', and 'false' otherwise.
+    {
+        return lhs.d_value == rhs;
+    }
+};
+
+// ============================================================================
+//                      COLLIDING HASHER FOR TESTING
+// ----------------------------------------------------------------------------
+
+struct CollidingHash {
+    // This 'struct' provides a hasher for 'int' keys that returns one of only
+    // a few distinct hash codes, so that the buckets of a hash table using it
+    // hold long chains of elements.
+
+    native_std::size_t operator()(int key) const
+        // Return a hash code for the specified 'key'.
+    {
+        return static_cast<native_std::size_t>(key) % 5;
+    }
+};
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -6364,7 +6447,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocator(&testAlloc);
 
     switch (test) { case 0:
-      case 28: {
+      case 31: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -6519,6 +6602,475 @@ if (verbose) {
 // See the material in {'bslstl_unorderedmap'|Example 2}.
 
       } break;
+      case 30: {
+        // --------------------------------------------------------------------
+        // TESTING 'find_batch'
+        //
+        // Concerns:
+        //: 1 Each result of 'find_batch' is the iterator that 'find' returns
+        //:   for the corresponding key, whether or not the key is present.
+        //:
+        //: 2 Batches of any length, including 0 and lengths that are not
+        //:   multiples of the internal pipeline and run sizes, are handled,
+        //:   and no element of the results array beyond the batch is
+        //:   modified.
+        //:
+        //: 3 Keys in long bucket chains, and keys looked up in an empty set,
+        //:   are handled.
+        //:
+        //: 4 No memory is allocated.
+        //
+        // Plan:
+        //: 1 Create sets holding the even integers in a range, using a good
+        //:   hasher and a hasher yielding only five distinct hash codes, and
+        //:   an empty set.
+        //:
+        //: 2 For a set of batch lengths, look up batches of consecutive
+        //:   integers, present and absent, starting at several offsets, and
+        //:   compare each result to 'find'.  Verify that the element
+        //:   following the batch in the results array is unchanged.
+        //:   (C-1..3)
+        //:
+        //: 3 Verify that no memory is allocated from either the object or the
+        //:   default allocator during the lookups.  (C-4)
+        //
+        // Testing:
+        //   void find_batch(const key_type *k, size_type n, c_iter *r) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING 'find_batch'"
+                            "\n====================\n");
+
+        typedef bsl::unordered_set<int>                Obj;
+        typedef bsl::unordered_set<int, CollidingHash> CollidingObj;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        enum { k_NUM_ELEMENTS = 300, k_NUM_KEYS = 2 * k_NUM_ELEMENTS + 2 };
+
+        Obj          mX(&oa);  const Obj&          X = mX;
+        CollidingObj mY(&oa);  const CollidingObj& Y = mY;
+        Obj          mZ(&oa);  const Obj&          Z = mZ;
+
+        for (int i = 0; i < k_NUM_ELEMENTS; ++i) {
+            mX.insert(2 * i);
+            mY.insert(2 * i);
+        }
+
+        int keys[k_NUM_KEYS];
+        for (int i = 0; i < k_NUM_KEYS; ++i) {
+            keys[i] = i - 1;
+        }
+
+        static const int LENGTHS[] = {
+            0, 1, 2, 15, 16, 17, 33, 64, 65, 257, k_NUM_KEYS - 30
+        };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        static const int STARTS[] = { 0, 1, 7, 30 };
+        const int NUM_STARTS = sizeof STARTS / sizeof *STARTS;
+
+        const bsls::Types::Int64 NUM_ALLOCATIONS = oa.numAllocations();
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int LENGTH = LENGTHS[ti];
+
+            for (int tj = 0; tj < NUM_STARTS; ++tj) {
+                const int  START = STARTS[tj];
+                const int *KEYS  = keys + START;
+
+                if (veryVerbose) { T_ P_(LENGTH) P(START) }
+
+                Obj::const_iterator          results[k_NUM_KEYS + 1];
+                CollidingObj::const_iterator yResults[k_NUM_KEYS + 1];
+                Obj::const_iterator          zResults[k_NUM_KEYS + 1];
+
+                results[LENGTH]  = X.begin();
+                yResults[LENGTH] = Y.begin();
+                zResults[LENGTH] = X.begin();
+
+                X.find_batch(KEYS, LENGTH, results);
+                Y.find_batch(KEYS, LENGTH, yResults);
+                Z.find_batch(KEYS, LENGTH, zResults);
+
+                for (int i = 0; i < LENGTH; ++i) {
+                    ASSERTV(LENGTH, START, i, X.find(KEYS[i]) == results[i]);
+                    ASSERTV(LENGTH, START, i, Y.find(KEYS[i]) == yResults[i]);
+                    ASSERTV(LENGTH, START, i, Z.end()         == zResults[i]);
+
+                    if (0 == KEYS[i] % 2
+                     && 0 <= KEYS[i] && KEYS[i] < 2 * k_NUM_ELEMENTS) {
+                        ASSERTV(LENGTH, START, i, X.end() != results[i]);
+                        ASSERTV(LENGTH, START, i, Y.end() != yResults[i]);
+                    }
+                }
+
+                ASSERTV(LENGTH, START, X.begin() == results[LENGTH]);
+                ASSERTV(LENGTH, START, Y.begin() == yResults[LENGTH]);
+                ASSERTV(LENGTH, START, X.begin() == zResults[LENGTH]);
+            }
+        }
+
+        ASSERT(k_NUM_ELEMENTS == X.size());
+        ASSERT(k_NUM_ELEMENTS == Y.size());
+        ASSERT(0              == Z.size());
+
+        ASSERTV(NUM_ALLOCATIONS, oa.numAllocations(),
+                NUM_ALLOCATIONS == oa.numAllocations());
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 29: {
+        // --------------------------------------------------------------------
+        // TESTING NODE HANDLES
+        //
+        // Concerns:
+        //: 1 'extract' unlinks an element from the container without copying
+        //:   or destroying it, and the returned node handle owns the element.
+        //:
+        //: 2 Inserting a node handle into a container having an equal
+        //:   allocator relinks the very same node, and allocates no memory.
+        //:
+        //: 3 A relinked node, and a node owned by a node handle, remain valid
+        //:   after the container from which the node was extracted is
+        //:   destroyed, and all memory is reclaimed when its owner is
+        //:   destroyed.
+        //:
+        //: 4 Inserting a node whose key is already present has no effect on
+        //:   the container; 'insert(nh)' transfers the node to the 'node'
+        //:   member of the result, and 'insert(hint, nh)' leaves the node in
+        //:   'nh'.
+        //:
+        //: 5 'merge' transfers, from a container of either type, exactly the
+        //:   elements whose keys are not present, relinking them without
+        //:   allocating a node.
+        //:
+        //: 6 If the allocators are not equal, the elements are copied into
+        //:   nodes supplied by the target container, and the source nodes
+        //:   are destroyed.
+        //:
+        //: 7 Inserting an empty node handle has no effect.
+        //
+        // Plan:
+        //: 1 Extract elements from a container, insert them into another
+        //:   container using the same allocator, and compare the addresses
+        //:   of the elements before and after the transfer.  Use a test
+        //:   allocator monitor to verify that no memory is allocated by
+        //:   'insert'.  Destroy the source container and verify the values
+        //:   of the transferred elements.  (C-1..3)
+        //:
+        //: 2 Insert node handles whose keys are already present, and empty
+        //:   node handles, and verify the result and the state of the
+        //:   container.  (C-4, 7)
+        //:
+        //: 3 Merge containers of both types, and verify the contents of the
+        //:   source and target, the address of a transferred element, and
+        //:   the number of blocks allocated.  (C-5)
+        //:
+        //: 4 Repeat the transfers between containers using different test
+        //:   allocators, and verify that no memory remains in use from the
+        //:   source allocator once the source container is destroyed.  (C-6)
+        //
+        // Testing:
+        //   node_type extract(const_iterator position);
+        //   node_type extract(const key_type& key);
+        //   insert_return_type insert(const node_type& node);
+        //   iterator insert(const_iterator hint, const node_type& node);
+        //   void merge(unordered_set<K, H2, E2, A>& source);
+        //   void merge(unordered_multiset<K, H2, E2, A>& source);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING NODE HANDLES"
+                            "\n====================\n");
+
+        typedef bsl::unordered_set<int>      Obj;
+        typedef bsl::unordered_multiset<int> MultiObj;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        if (verbose) printf("\nTesting 'extract' and 'insert(nh)'.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            mX.reserve(16);
+
+            Obj::node_type         nh;
+            const Obj::value_type *ADDRESS;
+            {
+                Obj mY(&oa);  const Obj& Y = mY;
+                for (int i = 0; i < 8; ++i) {
+                    mY.insert(i);
+                }
+                ADDRESS = &*Y.find(3);
+
+                nh = mY.extract(3);
+                ASSERT(!nh.empty());
+                ASSERT(3       == nh.value());
+                ASSERT(ADDRESS == &nh.value());
+                ASSERT(7       == Y.size());
+                ASSERT(Y.end() == Y.find(3));
+
+                ASSERT(mY.extract(3).empty());
+
+                // The only block that may be allocated is the index with which
+                // 'mX' tracks the chunk from which it borrows the node.
+
+                const bsls::Types::Int64 BLOCKS = oa.numBlocksTotal();
+
+                Obj::insert_return_type R = mX.insert(nh);
+                ASSERTV(oa.numBlocksTotal() - BLOCKS,
+                        1 >= oa.numBlocksTotal() - BLOCKS);
+                ASSERT(R.inserted);
+                ASSERT(R.node.empty());
+                ASSERT(nh.empty());
+                ASSERT(ADDRESS == &*R.position);
+                ASSERT(1       == X.size());
+
+                nh = mY.extract(Y.find(0));
+                ASSERT(0 == nh.value());
+                ASSERT(6 == Y.size());
+            }
+
+            // The relinked node, and the node owned by 'nh', outlive the
+            // container from which they were extracted.
+
+            ASSERT(ADDRESS == &*X.find(3));
+            ASSERT(0       == nh.value());
+
+            mX.insert(0);
+
+            Obj::insert_return_type R = mX.insert(nh);
+            ASSERT(!R.inserted);
+            ASSERT(nh.empty());
+            ASSERT(!R.node.empty());
+            ASSERT(X.find(0) == R.position);
+            ASSERT(2         == X.size());
+
+            R.node.value() = 5;
+            Obj::iterator it = mX.insert(X.begin(), R.node);
+            ASSERT(R.node.empty());
+            ASSERT(5 == *it);
+            ASSERT(3 == X.size());
+
+            nh = mX.extract(X.find(5));
+            nh.value() = 3;
+            it = mX.insert(X.end(), nh);
+            ASSERT(!nh.empty());
+            ASSERT(X.find(3) == it);
+            ASSERT(2         == X.size());
+
+            const Obj::node_type EMPTY;
+
+            R = mX.insert(EMPTY);
+            ASSERT(!R.inserted);
+            ASSERT(R.node.empty());
+            ASSERT(X.end() == R.position);
+            ASSERT(X.end() == mX.insert(X.begin(), EMPTY));
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting 'merge'.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            Obj mY(&oa);  const Obj& Y = mY;
+            mX.reserve(32);
+
+            for (int i = 0; i < 10; ++i) {
+                if (0 == i % 3) {
+                    mX.insert(i);
+                }
+                mY.insert(i);
+            }
+            const Obj::value_type *ADDRESS = &*Y.find(5);
+
+            // No node is allocated: the only blocks that may be allocated are
+            // the indexes with which the two pools track the chunks lent and
+            // borrowed.
+
+            const bsls::Types::Int64 BLOCKS = oa.numBlocksInUse();
+
+            mX.merge(mY);
+
+            ASSERTV(oa.numBlocksInUse() - BLOCKS,
+                    2 >= oa.numBlocksInUse() - BLOCKS);
+            ASSERT(10      == X.size());
+            ASSERT(4       == Y.size());
+            ASSERT(ADDRESS == &*X.find(5));
+            for (Obj::const_iterator it = Y.begin(); it != Y.end(); ++it) {
+                ASSERTV(*it, 0 == *it % 3);
+            }
+
+            MultiObj mZ(&oa);  const MultiObj& Z = mZ;
+            mZ.insert(1);
+            mZ.insert(11);
+            mZ.insert(11);
+
+            mX.merge(mZ);
+            ASSERT(11 == X.size());
+            ASSERT(2  == Z.size());
+            ASSERT(1  == Z.count(1));
+            ASSERT(1  == Z.count(11));
+
+            mX.merge(mX);
+            ASSERT(11 == X.size());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+
+        if (verbose) printf("\nTesting unequal allocators.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            {
+                Obj mY(&za);  const Obj& Y = mY;
+                for (int i = 0; i < 6; ++i) {
+                    mY.insert(i);
+                }
+                const Obj::value_type *ADDRESS = &*Y.find(2);
+
+                Obj::node_type nh = mY.extract(2);
+                ASSERT(&za == nh.get_allocator().mechanism());
+
+                Obj::insert_return_type R = mX.insert(nh);
+                ASSERT(R.inserted);
+                ASSERT(nh.empty());
+                ASSERT(ADDRESS != &*R.position);
+                ASSERT(2       == *R.position);
+
+                mX.merge(mY);
+                ASSERT(6 == X.size());
+                ASSERT(0 == Y.size());
+            }
+            ASSERTV(za.numBlocksInUse(), 0 == za.numBlocksInUse());
+
+            for (int i = 0; i < 6; ++i) {
+                ASSERTV(i, 1 == X.count(i));
+            }
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+
+      case 28: {
+        // --------------------------------------------------------------------
+        // TESTING TRANSPARENT LOOKUP
+        //
+        // Concerns:
+        //: 1 If both the hasher and the equality comparator are transparent,
+        //:   'find', 'count', 'contains', and 'equal_range' accept a key of a
+        //:   type that is not convertible to 'key_type'.
+        //:
+        //: 2 The transparent overloads locate exactly the elements that are
+        //:   equal to the supplied key.
+        //:
+        //: 3 Both the 'const' and non-'const' overloads are provided, and
+        //:   return iterators to the same elements.
+        //:
+        //: 4 No memory is allocated by the lookup methods.
+        //:
+        //: 5 'contains' reports whether an element having the supplied
+        //:   'key_type' key exists, whether or not the functors are
+        //:   transparent.
+        //
+        // Plan:
+        //: 1 Create an unordered set keyed on 'int' using the transparent
+        //:   functors 'TransparentHash' and 'TransparentEqual', and search it
+        //:   using 'TransparentProbe' objects, which are not convertible to
+        //:   'int'.  Compare the results with those of the 'key_type'
+        //:   overloads, and with a brute-force count of the equal keys.
+        //:   (C-1..3)
+        //:
+        //: 2 Install a test allocator as the default allocator, and use test
+        //:   allocator monitors to verify that no memory is allocated from it,
+        //:   or from the object allocator, by the lookups.  (C-4)
+        //:
+        //: 3 Invoke 'contains' on an unordered set using the default functors
+        //:   for keys that are, and are not, present.  (C-5)
+        //
+        // Testing:
+        //   iterator find(const LOOKUP_KEY& key);
+        //   const_iterator find(const LOOKUP_KEY& key) const;
+        //   size_type count(const LOOKUP_KEY& key) const;
+        //   bool contains(const key_type& key) const;
+        //   bool contains(const LOOKUP_KEY& key) const;
+        //   pair<iterator, iterator> equal_range(const LOOKUP_KEY& key);
+        //   pair<c_iter, c_iter> equal_range(const LOOKUP_KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING TRANSPARENT LOOKUP"
+                            "\n==========================\n");
+
+        typedef bsl::unordered_set<int, TransparentHash, TransparentEqual> Obj;
+
+        static const int KEYS[]   = { 3, 15, 17, 22, 41, 44, 45 };
+        const int        NUM_KEYS = sizeof KEYS / sizeof *KEYS;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator oa("object",  veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            mX.insert(KEYS[i]);
+        }
+        ASSERTV(X.size(), NUM_KEYS == static_cast<int>(X.size()));
+
+        bslma::TestAllocatorMonitor oam(&oa);
+        bslma::TestAllocatorMonitor dam(&da);
+
+        for (int value = 0; value < 50; ++value) {
+            const TransparentProbe PROBE = { value };
+
+            int expected = 0;
+            for (int i = 0; i < NUM_KEYS; ++i) {
+                if (KEYS[i] == value) {
+                    ++expected;
+                }
+            }
+
+            if (veryVerbose) { T_ P_(value) P(expected) }
+
+            ASSERTV(value, mX.find(value) == mX.find(PROBE));
+            ASSERTV(value,  X.find(value) ==  X.find(PROBE));
+            ASSERTV(value, (0 == expected) == (X.end() == X.find(PROBE)));
+
+            ASSERTV(value, expected == static_cast<int>(X.count(PROBE)));
+            ASSERTV(value, (0 != expected) == X.contains(PROBE));
+
+            const bsl::pair<Obj::iterator, Obj::iterator> R =
+                                                       mX.equal_range(PROBE);
+            ASSERTV(value, mX.equal_range(value) == R);
+
+            const bsl::pair<Obj::const_iterator, Obj::const_iterator> CR =
+                                                        X.equal_range(PROBE);
+            ASSERTV(value, X.equal_range(value) == CR);
+
+            int length = 0;
+            for (Obj::const_iterator it = CR.first; it != CR.second; ++it) {
+                ASSERTV(value, *it, value == *it);
+                ++length;
+            }
+            ASSERTV(value, expected, length, expected == length);
+        }
+
+        ASSERT(oam.isTotalSame());
+        ASSERT(dam.isTotalSame());
+
+        if (verbose) printf("\nTesting 'contains' with a 'key_type' key.\n");
+        {
+            typedef bsl::unordered_set<int> PlainObj;
+
+            PlainObj mY(&oa);  const PlainObj& Y = mY;
+            mY.insert(1);
+            mY.insert(3);
+
+            ASSERT(!Y.contains(0));
+            ASSERT( Y.contains(1));
+            ASSERT(!Y.contains(2));
+            ASSERT( Y.contains(3));
+        }
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
       case 27: {
         // --------------------------------------------------------------------
         // TESTING SPREAD
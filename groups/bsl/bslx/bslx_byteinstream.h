@@ -328,6 +328,10 @@ BSLS_IDENT("$Id: $")
 #include <bslx_marshallingutil.h>
 #endif
 
+#ifndef INCLUDED_BSLX_VARINTUTIL
+#include <bslx_varintutil.h>
+#endif
+
 #ifndef INCLUDED_BSLS_ASSERT
 #include <bsls_assert.h>
 #endif
@@ -655,6 +659,19 @@ class ByteInStream {
         // value, this stream is marked invalid and the value of 'variable' is
         // undefined.
 
+    ByteInStream& getStringRef(bslstl::StringRef& variable);
+        // Bind the specified 'variable' to the string data (see 'getUint8')
+        // of this stream that follows the length of the string (see
+        // 'getLength') at the current cursor location, update the cursor
+        // location, and return a reference to this stream.  If this stream is
+        // initially invalid, this operation has no effect.  If this function
+        // otherwise fails to extract a valid value, this stream is marked
+        // invalid and the value of 'variable' is unchanged.  Note that the
+        // string data is not copied, so 'variable' is valid only as long as
+        // the buffer supplied to this stream; this method is therefore not
+        // part of the BDEX 'InStream' protocol.  Also note that the data is in
+        // the same format as that read by 'getString'.
+
                       // *** arrays of integer values ***
 
     ByteInStream& getArrayInt64(bsls::Types::Int64 *variables,
@@ -895,6 +912,64 @@ class ByteInStream {
         // undefined.  The behavior is undefined unless '0 <= numVariables' and
         // 'variables' has sufficient capacity.
 
+                      // *** variable-length integer values ***
+
+    ByteInStream& getVarUint64(bsls::Types::Uint64& variable);
+        // Assign to the specified 'variable' the value whose variable-length
+        // representation (see 'bslx_varintutil') is at the current cursor
+        // location of this stream, update the cursor location, and return a
+        // reference to this stream.  If this stream is initially invalid,
+        // this operation has no effect.  If this function otherwise fails to
+        // extract a valid value, this stream is marked invalid and the value
+        // of 'variable' is unchanged.
+
+    ByteInStream& getVarInt64(bsls::Types::Int64& variable);
+        // Assign to the specified 'variable' the value whose zig-zag encoding
+        // has the variable-length representation (see 'bslx_varintutil') at
+        // the current cursor location of this stream, update the cursor
+        // location, and return a reference to this stream.  If this stream is
+        // initially invalid, this operation has no effect.  If this function
+        // otherwise fails to extract a valid value, this stream is marked
+        // invalid and the value of 'variable' is unchanged.
+
+    ByteInStream& getArrayVarUint64(bsls::Types::Uint64 *variables,
+                                    int                  numVariables);
+        // Assign to the specified 'variables' the specified 'numVariables'
+        // values whose consecutive variable-length representations (see
+        // 'bslx_varintutil') are at the current cursor location of this
+        // stream, update the cursor location, and return a reference to this
+        // stream.  If this stream is initially invalid, this operation has no
+        // effect.  If this function otherwise fails to extract a valid value,
+        // this stream is marked invalid and the value of 'variables' is
+        // undefined.  The behavior is undefined unless '0 <= numVariables' and
+        // 'variables' has sufficient capacity.
+
+    ByteInStream& getArrayVarInt64(bsls::Types::Int64 *variables,
+                                   int                 numVariables);
+        // Assign to the specified 'variables' the specified 'numVariables'
+        // values whose zig-zag encodings have the consecutive variable-length
+        // representations (see 'bslx_varintutil') at the current cursor
+        // location of this stream, update the cursor location, and return a
+        // reference to this stream.  If this stream is initially invalid,
+        // this operation has no effect.  If this function otherwise fails to
+        // extract a valid value, this stream is marked invalid and the value
+        // of 'variables' is undefined.  The behavior is undefined unless
+        // '0 <= numVariables' and 'variables' has sufficient capacity.
+
+    ByteInStream& getDeltaArrayVarInt64(bsls::Types::Int64 *variables,
+                                        int                 numVariables);
+        // Assign to the specified 'variables' the specified 'numVariables'
+        // values written by 'ByteOutStream::putDeltaArrayVarInt64' at the
+        // current cursor location of this stream (i.e., each being the sum of
+        // the preceding value and the difference whose zig-zag encoding has
+        // the next variable-length representation), update the cursor
+        // location, and return a reference to this stream.  If this stream is
+        // initially invalid, this operation has no effect.  If this function
+        // otherwise fails to extract a valid value, this stream is marked
+        // invalid and the value of 'variables' is undefined.  The behavior is
+        // undefined unless '0 <= numVariables' and 'variables' has sufficient
+        // capacity.
+
     // ACCESSORS
     operator const void *() const;
         // Return a non-zero value if this stream is valid, and 0 otherwise.
@@ -1448,6 +1523,33 @@ ByteInStream& ByteInStream::getString(bsl::string& variable)
         getArrayUint8(&variable[initialLength], length - initialLength);
     }
 
+    return *this;
+}
+
+inline
+ByteInStream& ByteInStream::getStringRef(bslstl::StringRef& variable)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    int len;
+    getLength(len);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    if (cursor() + len <= length()) {
+        variable.assign(d_buffer + cursor(), len);
+        d_cursor += len;
+    }
+    else {
+        invalidate();
+    }
+
     return *this;
 }
 
@@ -1918,6 +2020,133 @@ ByteInStream& ByteInStream::getArrayFloat32(float *variables, int numVariables)
         invalidate();
     }
 
+    return *this;
+}
+
+                      // *** variable-length integer values ***
+
+inline
+ByteInStream& ByteInStream::getVarUint64(bsls::Types::Uint64& variable)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int len = VarIntUtil::getVarUint64(&variable,
+                                             d_buffer + cursor(),
+                                             length() - cursor());
+    if (0 != len) {
+        d_cursor += len;
+    }
+    else {
+        invalidate();
+    }
+
+    return *this;
+}
+
+inline
+ByteInStream& ByteInStream::getVarInt64(bsls::Types::Int64& variable)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    const int len = VarIntUtil::getVarInt64(&variable,
+                                            d_buffer + cursor(),
+                                            length() - cursor());
+    if (0 != len) {
+        d_cursor += len;
+    }
+    else {
+        invalidate();
+    }
+
+    return *this;
+}
+
+inline
+ByteInStream& ByteInStream::getArrayVarUint64(
+                                             bsls::Types::Uint64 *variables,
+                                             int                  numVariables)
+{
+    BSLS_ASSERT_SAFE(variables || 0 == numVariables);
+    BSLS_ASSERT_SAFE(0 <= numVariables);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    bsl::size_t len = 0;
+    if (0 == VarIntUtil::getArrayVarUint64(variables,
+                                           &len,
+                                           d_buffer + cursor(),
+                                           length() - cursor(),
+                                           numVariables)) {
+        d_cursor += len;
+    }
+    else {
+        invalidate();
+    }
+
+    return *this;
+}
+
+inline
+ByteInStream& ByteInStream::getArrayVarInt64(bsls::Types::Int64 *variables,
+                                             int                 numVariables)
+{
+    BSLS_ASSERT_SAFE(variables || 0 == numVariables);
+    BSLS_ASSERT_SAFE(0 <= numVariables);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    bsl::size_t len = 0;
+    if (0 == VarIntUtil::getArrayVarInt64(variables,
+                                          &len,
+                                          d_buffer + cursor(),
+                                          length() - cursor(),
+                                          numVariables)) {
+        d_cursor += len;
+    }
+    else {
+        invalidate();
+    }
+
+    return *this;
+}
+
+inline
+ByteInStream& ByteInStream::getDeltaArrayVarInt64(
+                                              bsls::Types::Int64 *variables,
+                                              int                 numVariables)
+{
+    BSLS_ASSERT_SAFE(variables || 0 == numVariables);
+    BSLS_ASSERT_SAFE(0 <= numVariables);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    bsl::size_t len = 0;
+    if (0 == VarIntUtil::getDeltaArrayVarInt64(variables,
+                                               &len,
+                                               d_buffer + cursor(),
+                                               length() - cursor(),
+                                               numVariables)) {
+        d_cursor += len;
+    }
+    else {
+        invalidate();
+    }
+
     return *this;
 }
 
@@ -66,6 +66,7 @@ using namespace bslx;
 // [14] getFloat64(double& variable);
 // [13] getFloat32(float& variable);
 // [26] getString(bsl::string& variable);
+// [31] getStringRef(bslstl::StringRef& variable);
 // [22] getArrayInt64(bsls::Types::Int64 *variables, int numVariables);
 // [22] getArrayUint64(bsls::Types::Uint64 *variables, int numVariables);
 // [21] getArrayInt56(bsls::Types::Int64 *variables, int numVariables);
@@ -86,6 +87,11 @@ using namespace bslx;
 // [15] getArrayUint8(unsigned char *variables, int numVariables);
 // [24] getArrayFloat64(double *variables, int numVariables);
 // [23] getArrayFloat32(float *variables, int numVariables);
+// [30] getVarUint64(bsls::Types::Uint64& variable);
+// [30] getVarInt64(bsls::Types::Int64& variable);
+// [30] getArrayVarUint64(bsls::Types::Uint64 *variables, int num...);
+// [30] getArrayVarInt64(bsls::Types::Int64 *variables, int num...);
+// [30] getDeltaArrayVarInt64(bsls::Types::Int64 *variables, int num...);
 // [ 2] void invalidate();
 // [27] void reset();
 // [27] void reset(const char *buffer, bsl::size_t numBytes);
@@ -102,7 +108,7 @@ using namespace bslx;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [29] THIRD-PARTY EXTERNALIZATION
-// [30] USAGE EXAMPLE
+// [32] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -532,7 +538,116 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 30: {
+      case 31: {
+        // --------------------------------------------------------------------
+        // TESTING 'getStringRef'
+        //   Verify this method binds to the expected data.
+        //
+        // Concerns:
+        //: 1 Method binds the reference to the string data in the buffer of
+        //:   the stream, without copying it.
+        //:
+        //: 2 Method reads the format written by 'putString', for lengths that
+        //:   are stored in one byte and in four bytes.
+        //:
+        //: 3 Method has no effect on an invalid stream.
+        //:
+        //: 4 Method invalidates the stream, and leaves the reference
+        //:   unchanged, if the data is truncated.
+        //
+        // Plan:
+        //: 1 Unexternalize strings of various lengths, interleaved with
+        //:   markers, and verify the values, the addresses of the referenced
+        //:   data, and the markers.  (C-1..2)
+        //:
+        //: 2 Invalidate the stream, unexternalize a string, and verify the
+        //:   reference and the cursor are unchanged.  (C-3)
+        //:
+        //: 3 Unexternalize a string from every proper prefix of the data, and
+        //:   verify the stream is invalid and the reference is unchanged.
+        //:   (C-4)
+        //
+        // Testing:
+        //   getStringRef(bslstl::StringRef& variable);
+        // --------------------------------------------------------------------
+
+        if (verbose) {
+            cout << endl
+                 << "TESTING 'getStringRef'" << endl
+                 << "======================" << endl;
+        }
+
+        const bsl::string LONG(300, 'x');
+
+        Out o(VERSION_SELECTOR);
+        o.putString(bsl::string("alpha"));    o.putInt8(0xFF);
+        o.putString(bsl::string(""));         o.putInt8(0xFE);
+        o.putString(LONG);                    o.putInt8(0xFD);
+
+        if (verbose) {
+            cout << "\nTesting 'getStringRef(bslstl::StringRef&)'." << endl;
+        }
+        {
+            Obj mX(o.data(), o.length());  const Obj& X = mX;
+
+            if (veryVerbose) { P(X) }
+
+            char              marker;
+            bslstl::StringRef val;
+
+            mX.getStringRef(val);      mX.getInt8(marker);
+            ASSERT(val == "alpha");    ASSERT('\xFF' == marker);
+            ASSERT(o.data() + 1 == val.data());
+
+            mX.getStringRef(val);      mX.getInt8(marker);
+            ASSERT(val.isEmpty());     ASSERT('\xFE' == marker);
+
+            mX.getStringRef(val);      mX.getInt8(marker);
+            ASSERT(val == LONG);       ASSERT('\xFD' == marker);
+            ASSERT(o.data() + 13 == val.data());
+
+            ASSERT(X.isValid());
+            ASSERT(o.length() == X.cursor());
+
+            // Verify the return value.
+
+            mX.reset();
+            ASSERT(&mX == &mX.getStringRef(val));
+        }
+
+        if (verbose) {
+            cout << "\nTesting invalid stream." << endl;
+        }
+        {
+            const char        *DATA = "unchanged";
+            bslstl::StringRef  val(DATA);
+
+            Obj mX(o.data(), o.length());  const Obj& X = mX;
+            mX.invalidate();
+            mX.getStringRef(val);
+            ASSERT(DATA == val.data());
+            ASSERT(0 == X.cursor());
+        }
+
+        if (verbose) {
+            cout << "\nTesting truncated data." << endl;
+        }
+        {
+            Out out(VERSION_SELECTOR);
+            out.putString(LONG);
+
+            for (bsl::size_t len = 0; len < out.length(); ++len) {
+                const char        *DATA = "unchanged";
+                bslstl::StringRef  val(DATA);
+
+                Obj mX(out.data(), len);  const Obj& X = mX;
+                mX.getStringRef(val);
+                LOOP_ASSERT(len, !X.isValid());
+                LOOP_ASSERT(len, DATA == val.data());
+            }
+        }
+      } break;
+      case 32: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -603,6 +718,201 @@ if (veryVerbose) {
 //..
 
       } break;
+      case 30: {
+        // --------------------------------------------------------------------
+        // GET VARIABLE-LENGTH INTEGER TEST
+        //   Verify the methods unexternalize the expected values.
+        //
+        // Concerns:
+        //: 1 The methods unexternalize the values externalized by the
+        //:   corresponding 'ByteOutStream' methods, and advance the cursor by
+        //:   exactly the number of bytes externalized.
+        //:
+        //: 2 The methods have no effect on an invalid stream.
+        //:
+        //: 3 The methods invalidate the stream if the data is truncated or
+        //:   invalid.
+        //:
+        //: 4 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Externalize a set of values with 'ByteOutStream', interleaved
+        //:   with markers, unexternalize them, and verify the values and the
+        //:   markers.  (C-1)
+        //:
+        //: 2 Invalidate the stream, unexternalize values, and verify the
+        //:   values and the cursor are unchanged.  (C-2)
+        //:
+        //: 3 Unexternalize values from every proper prefix of the data, and
+        //:   from a representation longer than ten bytes, and verify the
+        //:   stream is invalid.  (C-3)
+        //:
+        //: 4 Verify defensive checks are triggered for invalid values.  (C-4)
+        //
+        // Testing:
+        //   getVarUint64(bsls::Types::Uint64& variable);
+        //   getVarInt64(bsls::Types::Int64& variable);
+        //   getArrayVarUint64(bsls::Types::Uint64 *variables, int num...);
+        //   getArrayVarInt64(bsls::Types::Int64 *variables, int num...);
+        //   getDeltaArrayVarInt64(bsls::Types::Int64 *variables, int num...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "GET VARIABLE-LENGTH INTEGER TEST" << endl
+                          << "================================" << endl;
+
+        typedef bsls::Types::Int64  Int64;
+        typedef bsls::Types::Uint64 Uint64;
+
+        const int    NUM_VALUES      = 40;
+        Uint64       UDATA[NUM_VALUES];
+        Int64        DATA[NUM_VALUES];
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            UDATA[i] = i % 3 ? i : 0xffffffffffffffffULL >> i;
+            DATA[i]  = i % 2 ? -static_cast<Int64>(UDATA[i])
+                             : static_cast<Int64>(UDATA[i]);
+        }
+
+        Out o(VERSION_SELECTOR);
+        o.putVarUint64(0xffffffffffffffffULL);        o.putInt8(0xff);
+        o.putVarInt64(-64);                           o.putInt8(0xfe);
+        o.putArrayVarUint64(UDATA, NUM_VALUES);       o.putInt8(0xfd);
+        o.putArrayVarInt64(DATA, NUM_VALUES);         o.putInt8(0xfc);
+        o.putDeltaArrayVarInt64(DATA, NUM_VALUES);    o.putInt8(0xfb);
+
+        if (verbose) cout << "\nTesting round trip." << endl;
+        {
+            Uint64 uvalue = 0;
+            Int64  value  = 0;
+            Uint64 uvalues[NUM_VALUES];
+            Int64  values[NUM_VALUES];
+            char   marker = 0;
+
+            Obj mX(o.data(), o.length());  const Obj& X = mX;
+
+            mX.getVarUint64(uvalue);                   mX.getInt8(marker);
+            ASSERT(0xffffffffffffffffULL == uvalue);
+            ASSERT('\xff' == marker);
+            ASSERT(11 == X.cursor());
+
+            mX.getVarInt64(value);                     mX.getInt8(marker);
+            ASSERT(-64 == value);
+            ASSERT('\xfe' == marker);
+            ASSERT(13 == X.cursor());
+
+            mX.getArrayVarUint64(uvalues, NUM_VALUES); mX.getInt8(marker);
+            ASSERT(0 == memcmp(UDATA, uvalues, sizeof UDATA));
+            ASSERT('\xfd' == marker);
+
+            mX.getArrayVarInt64(values, NUM_VALUES);   mX.getInt8(marker);
+            ASSERT(0 == memcmp(DATA, values, sizeof DATA));
+            ASSERT('\xfc' == marker);
+
+            mX.getDeltaArrayVarInt64(values, NUM_VALUES);
+            mX.getInt8(marker);
+            ASSERT(0 == memcmp(DATA, values, sizeof DATA));
+            ASSERT('\xfb' == marker);
+
+            ASSERT(X.isValid());
+            ASSERT(o.length() == X.cursor());
+
+            // Verify the return values.
+
+            mX.reset();
+            ASSERT(&mX == &mX.getVarUint64(uvalue));
+            ASSERT(&mX == &mX.getVarInt64(value));
+            ASSERT(&mX == &mX.getArrayVarUint64(uvalues, 1));
+            ASSERT(&mX == &mX.getArrayVarInt64(values, 1));
+            ASSERT(&mX == &mX.getDeltaArrayVarInt64(values, 1));
+        }
+
+        if (verbose) cout << "\nTesting invalid stream." << endl;
+        {
+            Uint64 uvalue     = 7;
+            Int64  value      = 7;
+            Uint64 uvalues[1] = { 7 };
+            Int64  values[1]  = { 7 };
+
+            Obj mX(o.data(), o.length());  const Obj& X = mX;
+            mX.invalidate();
+
+            mX.getVarUint64(uvalue);
+            mX.getVarInt64(value);
+            mX.getArrayVarUint64(uvalues, 1);
+            mX.getArrayVarInt64(values, 1);
+            mX.getDeltaArrayVarInt64(values, 1);
+
+            ASSERT(7 == uvalue);
+            ASSERT(7 == value);
+            ASSERT(7 == uvalues[0]);
+            ASSERT(7 == values[0]);
+            ASSERT(0 == X.cursor());
+        }
+
+        if (verbose) cout << "\nTesting truncated and invalid data." << endl;
+        {
+            Uint64 uvalues[NUM_VALUES];
+            Int64  values[NUM_VALUES];
+
+            for (bsl::size_t len = 0; len < 10; ++len) {
+                Uint64 uvalue = 7;
+
+                Obj mX(o.data(), len);  const Obj& X = mX;
+                mX.getVarUint64(uvalue);
+                LOOP_ASSERT(len, !X.isValid());
+                LOOP_ASSERT(len, 7 == uvalue);
+            }
+
+            Out out(VERSION_SELECTOR);
+            out.putArrayVarUint64(UDATA, NUM_VALUES);
+            for (bsl::size_t len = 0; len < out.length(); ++len) {
+                Obj mX(out.data(), len);  const Obj& X = mX;
+                mX.getArrayVarUint64(uvalues, NUM_VALUES);
+                LOOP_ASSERT(len, !X.isValid());
+            }
+
+            out.reset();
+            out.putDeltaArrayVarInt64(DATA, NUM_VALUES);
+            for (bsl::size_t len = 0; len < out.length(); ++len) {
+                Obj mX(out.data(), len);  const Obj& X = mX;
+                mX.getDeltaArrayVarInt64(values, NUM_VALUES);
+                LOOP_ASSERT(len, !X.isValid());
+            }
+
+            const char ELEVEN_BYTES[] = "\x80\x80\x80\x80\x80"
+                                        "\x80\x80\x80\x80\x80\x01";
+            {
+                Int64 value = 7;
+
+                Obj mX(ELEVEN_BYTES, 11);  const Obj& X = mX;
+                mX.getVarInt64(value);
+                ASSERT(!X.isValid());
+                ASSERT(7 == value);
+            }
+            {
+                Obj mX(ELEVEN_BYTES, 11);  const Obj& X = mX;
+                mX.getArrayVarInt64(values, 1);
+                ASSERT(!X.isValid());
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            Uint64 uvalues[1];  (void)uvalues;
+            Int64  values[1];   (void)values;
+
+            bsls::AssertFailureHandlerGuard
+                                          hG(bsls::AssertTest::failTestDriver);
+
+            Obj mX(o.data(), o.length());
+            ASSERT_SAFE_FAIL(mX.getArrayVarUint64(uvalues, -1));
+            ASSERT_SAFE_PASS(mX.getArrayVarUint64(0, 0));
+            ASSERT_SAFE_FAIL(mX.getArrayVarInt64(values, -1));
+            ASSERT_SAFE_PASS(mX.getArrayVarInt64(0, 0));
+            ASSERT_SAFE_FAIL(mX.getDeltaArrayVarInt64(values, -1));
+            ASSERT_SAFE_PASS(mX.getDeltaArrayVarInt64(0, 0));
+        }
+      } break;
       case 29: {
         // --------------------------------------------------------------------
         // THIRD-PARTY EXTERNALIZATION
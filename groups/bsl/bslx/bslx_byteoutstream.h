@@ -149,6 +149,10 @@ BSLS_IDENT("$Id: $")
 #include <bslx_outstreamfunctions.h>
 #endif
 
+#ifndef INCLUDED_BSLX_VARINTUTIL
+#include <bslx_varintutil.h>
+#endif
+
 #ifndef INCLUDED_BSLMA_ALLOCATOR
 #include <bslma_allocator.h>
 #endif
@@ -593,6 +597,58 @@ class ByteOutStream {
         // unless '0 <= numValues' and 'values' has sufficient contents.  Note
         // that for non-conforming platforms, this operation may be lossy.
 
+                      // *** variable-length integer values ***
+
+    ByteOutStream& putVarUint64(bsls::Types::Uint64 value);
+        // Write to this stream the variable-length representation (see
+        // 'bslx_varintutil') of the specified 'value', and return a reference
+        // to this stream.  If this stream is initially invalid, this operation
+        // has no effect.  Note that the representation occupies between one
+        // and ten bytes, and must be read with 'ByteInStream::getVarUint64'.
+
+    ByteOutStream& putVarInt64(bsls::Types::Int64 value);
+        // Write to this stream the variable-length representation (see
+        // 'bslx_varintutil') of the zig-zag encoding of the specified 'value',
+        // and return a reference to this stream.  If this stream is initially
+        // invalid, this operation has no effect.  Note that the representation
+        // occupies between one and ten bytes, and must be read with
+        // 'ByteInStream::getVarInt64'.
+
+    ByteOutStream& putArrayVarUint64(const bsls::Types::Uint64 *values,
+                                     int                        numValues);
+        // Write to this stream the consecutive variable-length representations
+        // (see 'bslx_varintutil') of each of the specified 'numValues' leading
+        // entries in the specified 'values', and return a reference to this
+        // stream.  If this stream is initially invalid, this operation has no
+        // effect.  The behavior is undefined unless '0 <= numValues' and
+        // 'values' has sufficient contents.  Note that the number of values
+        // is not written, and that the representations must be read with
+        // 'ByteInStream::getArrayVarUint64'.
+
+    ByteOutStream& putArrayVarInt64(const bsls::Types::Int64 *values,
+                                    int                       numValues);
+        // Write to this stream the consecutive variable-length representations
+        // (see 'bslx_varintutil') of the zig-zag encodings of each of the
+        // specified 'numValues' leading entries in the specified 'values', and
+        // return a reference to this stream.  If this stream is initially
+        // invalid, this operation has no effect.  The behavior is undefined
+        // unless '0 <= numValues' and 'values' has sufficient contents.  Note
+        // that the number of values is not written, and that the
+        // representations must be read with 'ByteInStream::getArrayVarInt64'.
+
+    ByteOutStream& putDeltaArrayVarInt64(const bsls::Types::Int64 *values,
+                                         int                       numValues);
+        // Write to this stream the consecutive variable-length representations
+        // (see 'bslx_varintutil') of the zig-zag encodings of the difference
+        // between each of the specified 'numValues' leading entries in the
+        // specified 'values' and the entry preceding it (the first entry being
+        // written as is), and return a reference to this stream.  If this
+        // stream is initially invalid, this operation has no effect.  The
+        // behavior is undefined unless '0 <= numValues' and 'values' has
+        // sufficient contents.  Note that the number of values is not written,
+        // and that the representations must be read with
+        // 'ByteInStream::getDeltaArrayVarInt64'.
+
     // ACCESSORS
     operator const void *() const;
         // Return a non-zero value if this stream is valid, and 0 otherwise.
@@ -1538,6 +1594,131 @@ ByteOutStream& ByteOutStream::putArrayFloat32(const float *values,
 
     MarshallingUtil::putArrayFloat32(d_buffer.data() + n, values, numValues);
 
+    return *this;
+}
+
+                      // *** variable-length integer values ***
+
+inline
+ByteOutStream& ByteOutStream::putVarUint64(bsls::Types::Uint64 value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    // Resize the buffer to have sufficient capacity with care to ensure this
+    // stream is invalidated if an exception is thrown.
+
+    const bsl::size_t n = d_buffer.size();
+    invalidate();
+    d_buffer.resize(n + VarIntUtil::k_MAX_SIZEOF_VARINT64);
+    validate();
+
+    // Write to the buffer the specified 'value', and then discard the unused
+    // capacity.
+
+    d_buffer.resize(n + VarIntUtil::putVarUint64(d_buffer.data() + n, value));
+
+    return *this;
+}
+
+inline
+ByteOutStream& ByteOutStream::putVarInt64(bsls::Types::Int64 value)
+{
+    return putVarUint64(VarIntUtil::zigZagEncode(value));
+}
+
+inline
+ByteOutStream& ByteOutStream::putArrayVarUint64(
+                                           const bsls::Types::Uint64 *values,
+                                           int                       numValues)
+{
+    BSLS_ASSERT_SAFE(values || 0 == numValues);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid() || 0 == numValues)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    // Resize the buffer to have sufficient capacity with care to ensure this
+    // stream is invalidated if an exception is thrown.
+
+    const bsl::size_t n = d_buffer.size();
+    invalidate();
+    d_buffer.resize(n + numValues * VarIntUtil::k_MAX_SIZEOF_VARINT64);
+    validate();
+
+    // Write to the buffer the specified 'values', and then discard the unused
+    // capacity.
+
+    d_buffer.resize(n + VarIntUtil::putArrayVarUint64(d_buffer.data() + n,
+                                                      values,
+                                                      numValues));
+
+    return *this;
+}
+
+inline
+ByteOutStream& ByteOutStream::putArrayVarInt64(
+                                            const bsls::Types::Int64 *values,
+                                            int                      numValues)
+{
+    BSLS_ASSERT_SAFE(values || 0 == numValues);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid() || 0 == numValues)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    // Resize the buffer to have sufficient capacity with care to ensure this
+    // stream is invalidated if an exception is thrown.
+
+    const bsl::size_t n = d_buffer.size();
+    invalidate();
+    d_buffer.resize(n + numValues * VarIntUtil::k_MAX_SIZEOF_VARINT64);
+    validate();
+
+    // Write to the buffer the specified 'values', and then discard the unused
+    // capacity.
+
+    d_buffer.resize(n + VarIntUtil::putArrayVarInt64(d_buffer.data() + n,
+                                                     values,
+                                                     numValues));
+
+    return *this;
+}
+
+inline
+ByteOutStream& ByteOutStream::putDeltaArrayVarInt64(
+                                            const bsls::Types::Int64 *values,
+                                            int                      numValues)
+{
+    BSLS_ASSERT_SAFE(values || 0 == numValues);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid() || 0 == numValues)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    // Resize the buffer to have sufficient capacity with care to ensure this
+    // stream is invalidated if an exception is thrown.
+
+    const bsl::size_t n = d_buffer.size();
+    invalidate();
+    d_buffer.resize(n + numValues * VarIntUtil::k_MAX_SIZEOF_VARINT64);
+    validate();
+
+    // Write to the buffer the specified 'values', and then discard the unused
+    // capacity.
+
+    d_buffer.resize(n + VarIntUtil::putDeltaArrayVarInt64(d_buffer.data() + n,
+                                                          values,
+                                                          numValues));
+
     return *this;
 }
 
@@ -85,6 +85,11 @@ using namespace bslx;
 // [15] putArrayUint8(const unsigned char *array, int count);
 // [24] putArrayFloat64(const double *array, int count);
 // [23] putArrayFloat32(const float *array, int count);
+// [28] putVarUint64(bsls::Types::Uint64 value);
+// [28] putVarInt64(bsls::Types::Int64 value);
+// [28] putArrayVarUint64(const bsls::Types::Uint64 *array, int count);
+// [28] putArrayVarInt64(const bsls::Types::Int64 *array, int count);
+// [28] putDeltaArrayVarInt64(const bsls::Types::Int64 *array, int count);
 // [ 4] operator const void *() const;
 // [ 3] int bdexVersionSelector() const;
 // [ 3] const char *data() const;
@@ -95,7 +100,7 @@ using namespace bslx;
 // [27] ByteOutStream& operator<<(ByteOutStream&, const TYPE& value);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [28] USAGE EXAMPLE
+// [29] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -202,7 +207,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator ta(veryVeryVeryVerbose);
 
     switch (test) { case 0:
-      case 28: {
+      case 29: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -291,6 +296,136 @@ int main(int argc, char *argv[])
 // example of using 'bslx' streams.
 
       } break;
+      case 28: {
+        // --------------------------------------------------------------------
+        // PUT VARIABLE-LENGTH INTEGER TEST
+        //   Verify the methods externalize the expected bytes.
+        //
+        // Concerns:
+        //: 1 The methods externalize the expected bytes, and the length of
+        //:   the stream grows by exactly the number of bytes externalized.
+        //:
+        //: 2 The externalization position does not affect the output.
+        //:
+        //: 3 The methods have no effect on an invalid stream.
+        //:
+        //: 4 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Externalize values at different offsets and verify the bytes.
+        //:   (C-1..2)
+        //:
+        //: 2 Invalidate the stream, externalize values, and verify the bytes
+        //:   are unchanged.  (C-3)
+        //:
+        //: 3 Verify defensive checks are triggered for invalid values.  (C-4)
+        //
+        // Testing:
+        //   putVarUint64(bsls::Types::Uint64 value);
+        //   putVarInt64(bsls::Types::Int64 value);
+        //   putArrayVarUint64(const bsls::Types::Uint64 *array, int count);
+        //   putArrayVarInt64(const bsls::Types::Int64 *array, int count);
+        //   putDeltaArrayVarInt64(const bsls::Types::Int64 *array, int count);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PUT VARIABLE-LENGTH INTEGER TEST" << endl
+                          << "================================" << endl;
+
+        if (verbose) cout << "\nTesting scalar methods." << endl;
+        {
+            Obj mX(VERSION_SELECTOR);  const Obj& X = mX;
+            mX.putVarUint64(0);                     mX.putInt8(0xff);
+            mX.putVarUint64(300);                   mX.putInt8(0xfe);
+            mX.putVarUint64(0xffffffffffffffffULL); mX.putInt8(0xfd);
+            mX.putVarInt64(-1);                     mX.putInt8(0xfc);
+            mX.putVarInt64(64);                     mX.putInt8(0xfb);
+            if (veryVerbose) { P(X); }
+
+            const bsl::size_t NUM_BYTES = 5 * SIZEOF_INT8 + 1 + 2 + 10 + 1 + 2;
+            ASSERT(NUM_BYTES == X.length());
+            ASSERT(0 == memcmp(X.data(),
+                               "\x00"                     "\xff"
+                               "\xac\x02"                 "\xfe"
+                               "\xff\xff\xff\xff\xff\xff\xff\xff"
+                               "\xff\x01"                 "\xfd"
+                               "\x01"                     "\xfc"
+                               "\x80\x01"                 "\xfb",
+                               NUM_BYTES));
+
+            // Verify methods have no effect if the stream is invalid.
+            mX.invalidate();
+            mX.putVarUint64(300);
+            mX.putVarInt64(-1);
+            ASSERT(NUM_BYTES == X.length());
+
+            // Verify the return values.
+            mX.reset();
+            ASSERT(&mX == &mX.putVarUint64(1));
+            ASSERT(&mX == &mX.putVarInt64(1));
+        }
+
+        if (verbose) cout << "\nTesting array methods." << endl;
+        {
+            const bsls::Types::Uint64 UDATA[] = { 1, 300 };
+            const bsls::Types::Int64  DATA[]  = { -1, 1 };
+            const bsls::Types::Int64  SEQ[]   = { 10, 12, 11 };
+
+            Obj mX(VERSION_SELECTOR);  const Obj& X = mX;
+            mX.putArrayVarUint64(UDATA, 0);         mX.putInt8(0xff);
+            mX.putArrayVarUint64(UDATA, 2);         mX.putInt8(0xfe);
+            mX.putArrayVarInt64(DATA, 0);           mX.putInt8(0xfd);
+            mX.putArrayVarInt64(DATA, 2);           mX.putInt8(0xfc);
+            mX.putDeltaArrayVarInt64(SEQ, 0);       mX.putInt8(0xfb);
+            mX.putDeltaArrayVarInt64(SEQ, 3);       mX.putInt8(0xfa);
+            if (veryVerbose) { P(X); }
+
+            const bsl::size_t NUM_BYTES = 6 * SIZEOF_INT8 + 3 + 2 + 3;
+            ASSERT(NUM_BYTES == X.length());
+            ASSERT(0 == memcmp(X.data(),
+                               ""                         "\xff"
+                               "\x01\xac\x02"             "\xfe"
+                               ""                         "\xfd"
+                               "\x01\x02"                 "\xfc"
+                               ""                         "\xfb"
+                               "\x14\x04\x01"             "\xfa",
+                               NUM_BYTES));
+
+            // Verify methods have no effect if the stream is invalid.
+            mX.invalidate();
+            mX.putArrayVarUint64(UDATA, 2);
+            mX.putArrayVarInt64(DATA, 2);
+            mX.putDeltaArrayVarInt64(SEQ, 3);
+            ASSERT(NUM_BYTES == X.length());
+
+            // Verify the return values.
+            mX.reset();
+            ASSERT(&mX == &mX.putArrayVarUint64(UDATA, 2));
+            ASSERT(&mX == &mX.putArrayVarInt64(DATA, 2));
+            ASSERT(&mX == &mX.putDeltaArrayVarInt64(SEQ, 3));
+        }
+
+        if (verbose)
+            cout << "\nNegative Testing." << endl;
+        {
+            const bsls::Types::Uint64 UDATA[] = { 1, 2, 3 };
+            const bsls::Types::Int64  DATA[]  = { 1, 2, 3 };
+
+            bsls::AssertFailureHandlerGuard
+                                          hG(bsls::AssertTest::failTestDriver);
+
+            Obj mX(VERSION_SELECTOR);
+            ASSERT_SAFE_FAIL(mX.putArrayVarUint64(UDATA, -1));
+            ASSERT_SAFE_PASS(mX.putArrayVarUint64(0, 0));
+            ASSERT_SAFE_PASS(mX.putArrayVarUint64(UDATA, 1));
+            ASSERT_SAFE_FAIL(mX.putArrayVarInt64(DATA, -1));
+            ASSERT_SAFE_PASS(mX.putArrayVarInt64(0, 0));
+            ASSERT_SAFE_PASS(mX.putArrayVarInt64(DATA, 1));
+            ASSERT_SAFE_FAIL(mX.putDeltaArrayVarInt64(DATA, -1));
+            ASSERT_SAFE_PASS(mX.putDeltaArrayVarInt64(0, 0));
+            ASSERT_SAFE_PASS(mX.putDeltaArrayVarInt64(DATA, 1));
+        }
+      } break;
       case 27: {
         // --------------------------------------------------------------------
         // EXTERNALIZATION FREE OPERATOR
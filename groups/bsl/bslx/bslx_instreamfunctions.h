@@ -781,6 +781,20 @@ namespace InStreamFunctions {
         // more information on BDEX streaming of value-semantic types and
         // containers.
 
+    template <class STREAM, class ALLOC>
+    STREAM& bdexStreamIn(STREAM&                   stream,
+                         bsl::vector<bool, ALLOC>& variable,
+                         int                       version);
+        // Assign to the specified 'variable' the 'bsl::vector<bool, ALLOC>'
+        // value read from the specified input 'stream', and return a reference
+        // to 'stream'.  The specified 'version' is ignored.  If 'stream' is
+        // initially invalid, this operation has no effect.  If 'stream'
+        // becomes invalid during this operation, 'variable' has an undefined,
+        // but valid, state.  See the 'bslx' package-level documentation for
+        // more information on BDEX streaming of value-semantic types and
+        // containers.  Note that the elements are read using array 'get'
+        // methods.
+
     template <class STREAM, class ALLOC>
     STREAM& bdexStreamIn(STREAM&                   stream,
                          bsl::vector<char, ALLOC>& variable,
@@ -872,6 +886,33 @@ namespace InStreamFunctions {
         // 'bslx' package-level documentation for more information on BDEX
         // streaming of value-semantic types and containers.
 
+    template <class STREAM, class ALLOC>
+    STREAM& bdexStreamIn(STREAM&                   stream,
+                         bsl::vector<long, ALLOC>& variable,
+                         int                       version);
+        // Assign to the specified 'variable' the 'bsl::vector<long, ALLOC>'
+        // value read from the specified input 'stream', and return a reference
+        // to 'stream'.  The specified 'version' is ignored.  If 'stream' is
+        // initially invalid, this operation has no effect.  If 'stream'
+        // becomes invalid during this operation, 'variable' has an undefined,
+        // but valid, state.  See the 'bslx' package-level documentation for
+        // more information on BDEX streaming of value-semantic types and
+        // containers.  Note that each element is read as a 32-bit 'int'.
+
+    template <class STREAM, class ALLOC>
+    STREAM& bdexStreamIn(STREAM&                            stream,
+                         bsl::vector<unsigned long, ALLOC>& variable,
+                         int                                version);
+        // Assign to the specified 'variable' the
+        // 'bsl::vector<unsigned long, ALLOC>' value read from the specified
+        // input 'stream', and return a reference to 'stream'.  The specified
+        // 'version' is ignored.  If 'stream' is initially invalid, this
+        // operation has no effect.  If 'stream' becomes invalid during this
+        // operation, 'variable' has an undefined, but valid, state.  See the
+        // 'bslx' package-level documentation for more information on BDEX
+        // streaming of value-semantic types and containers.  Note that each
+        // element is read as a 32-bit 'unsigned int'.
+
     template <class STREAM, class ALLOC>
     STREAM& bdexStreamIn(STREAM&                                 stream,
                          bsl::vector<bsls::Types::Int64, ALLOC>& variable,
@@ -1172,6 +1213,51 @@ STREAM& InStreamFunctions::bdexStreamIn(STREAM&      stream,
     return stream.getString(variable);
 }
 
+template <class STREAM, class ALLOC>
+STREAM& InStreamFunctions::bdexStreamIn(STREAM&                   stream,
+                                        bsl::vector<bool, ALLOC>& variable,
+                                        int                    /* version */)
+{
+    // The elements are read in fixed-size chunks of their wire representation
+    // so that the stream is accessed once per chunk rather than once per
+    // element.
+
+    enum { k_BUFFER_SIZE = 256 };
+
+    int length = 0;
+    stream.getLength(length);
+
+    if (!stream) {
+        return stream;
+    }
+
+    variable.resize(length);
+
+    // 'buffer' is value-initialized because compilers cannot always
+    // determine that only the elements written by a successful 'getArray*'
+    // call are read.
+
+    char buffer[k_BUFFER_SIZE] = { 0 };
+
+    for (int i = 0; i < length; i += k_BUFFER_SIZE) {
+        const int count = length - i < k_BUFFER_SIZE
+                          ? length - i
+                          : static_cast<int>(k_BUFFER_SIZE);
+
+        stream.getArrayInt8(buffer, count);
+
+        if (!stream) {
+            return stream;
+        }
+
+        for (int j = 0; j < count; ++j) {
+            variable[i + j] = static_cast<bool>(buffer[j]);
+        }
+    }
+
+    return stream;
+}
+
 template <class STREAM, class ALLOC>
 inline
 STREAM& InStreamFunctions::bdexStreamIn(STREAM&                   stream,
@@ -1302,6 +1388,81 @@ STREAM& InStreamFunctions::bdexStreamIn(
     return 0 < length ? stream.getArrayUint32(&variable[0], length) : stream;
 }
 
+template <class STREAM, class ALLOC>
+STREAM& InStreamFunctions::bdexStreamIn(STREAM&                   stream,
+                                        bsl::vector<long, ALLOC>& variable,
+                                        int                    /* version */)
+{
+    enum { k_BUFFER_SIZE = 256 };
+
+    int length = 0;
+    stream.getLength(length);
+
+    if (!stream) {
+        return stream;
+    }
+
+    variable.resize(length);
+
+    int buffer[k_BUFFER_SIZE] = { 0 };
+
+    for (int i = 0; i < length; i += k_BUFFER_SIZE) {
+        const int count = length - i < k_BUFFER_SIZE
+                          ? length - i
+                          : static_cast<int>(k_BUFFER_SIZE);
+
+        stream.getArrayInt32(buffer, count);
+
+        if (!stream) {
+            return stream;
+        }
+
+        for (int j = 0; j < count; ++j) {
+            variable[i + j] = buffer[j];
+        }
+    }
+
+    return stream;
+}
+
+template <class STREAM, class ALLOC>
+STREAM& InStreamFunctions::bdexStreamIn(
+                                 STREAM&                            stream,
+                                 bsl::vector<unsigned long, ALLOC>& variable,
+                                 int                             /* version */)
+{
+    enum { k_BUFFER_SIZE = 256 };
+
+    int length = 0;
+    stream.getLength(length);
+
+    if (!stream) {
+        return stream;
+    }
+
+    variable.resize(length);
+
+    unsigned int buffer[k_BUFFER_SIZE] = { 0 };
+
+    for (int i = 0; i < length; i += k_BUFFER_SIZE) {
+        const int count = length - i < k_BUFFER_SIZE
+                          ? length - i
+                          : static_cast<int>(k_BUFFER_SIZE);
+
+        stream.getArrayUint32(buffer, count);
+
+        if (!stream) {
+            return stream;
+        }
+
+        for (int j = 0; j < count; ++j) {
+            variable[i + j] = buffer[j];
+        }
+    }
+
+    return stream;
+}
+
 template <class STREAM, class ALLOC>
 inline
 STREAM& InStreamFunctions::bdexStreamIn(
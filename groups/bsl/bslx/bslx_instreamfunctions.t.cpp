@@ -875,9 +875,9 @@ int main(int argc, char *argv[])
             stream.clear();
             stream.putVersion(1);
             stream.putLength(3);
-            stream.putType(MyTestInStream::k_INT + 1);
-            stream.putType(MyTestInStream::k_INT + 1);
-            stream.putType(MyTestInStream::k_INT + 1);
+            stream.putType(MyTestInStream::k_ARRAY
+                           + MyTestInStream::k_INT
+                           + 1);
             pRV = &bdexStreamIn(stream, XVA);
             ASSERT(pRV == &stream);
             ASSERT(false == stream.error());
@@ -886,11 +886,13 @@ int main(int argc, char *argv[])
             stream.putVersion(1);
             stream.putLength(2);
             stream.putLength(3);
-            stream.putType(MyTestInStream::k_INT + 1);
-            stream.putType(MyTestInStream::k_INT + 1);
-            stream.putType(MyTestInStream::k_INT + 1);
+            stream.putType(MyTestInStream::k_ARRAY
+                           + MyTestInStream::k_INT
+                           + 1);
             stream.putLength(1);
-            stream.putType(MyTestInStream::k_INT + 1);
+            stream.putType(MyTestInStream::k_ARRAY
+                           + MyTestInStream::k_INT
+                           + 1);
             pRV = &bdexStreamIn(stream, XVVA);
             ASSERT(pRV == &stream);
             ASSERT(false == stream.error());
@@ -1246,9 +1248,9 @@ int main(int argc, char *argv[])
             stream.clear();
             stream.putVersion(1);
             stream.putLength(3);
-            stream.putType(MyTestInStream::k_INT + 4);
-            stream.putType(MyTestInStream::k_INT + 4);
-            stream.putType(MyTestInStream::k_INT + 4);
+            stream.putType(MyTestInStream::k_ARRAY
+                           + MyTestInStream::k_INT
+                           + 4);
             pRV = &bdexStreamIn(stream, XVI);
             ASSERT(pRV == &stream);
             ASSERT(false == stream.error());
@@ -1257,11 +1259,13 @@ int main(int argc, char *argv[])
             stream.putVersion(1);
             stream.putLength(2);
             stream.putLength(3);
-            stream.putType(MyTestInStream::k_INT + 4);
-            stream.putType(MyTestInStream::k_INT + 4);
-            stream.putType(MyTestInStream::k_INT + 4);
+            stream.putType(MyTestInStream::k_ARRAY
+                           + MyTestInStream::k_INT
+                           + 4);
             stream.putLength(1);
-            stream.putType(MyTestInStream::k_INT + 4);
+            stream.putType(MyTestInStream::k_ARRAY
+                           + MyTestInStream::k_INT
+                           + 4);
             pRV = &bdexStreamIn(stream, XVVI);
             ASSERT(pRV == &stream);
             ASSERT(false == stream.error());
@@ -1290,13 +1294,8 @@ int main(int argc, char *argv[])
             stream.clear();
             stream.putVersion(1);
             stream.putLength(3);
-            stream.putType(MyTestInStream::k_UNSIGNED
-                           + MyTestInStream::k_INT
-                           + 4);
-            stream.putType(MyTestInStream::k_UNSIGNED
-                           + MyTestInStream::k_INT
-                           + 4);
-            stream.putType(MyTestInStream::k_UNSIGNED
+            stream.putType(MyTestInStream::k_ARRAY
+                           + MyTestInStream::k_UNSIGNED
                            + MyTestInStream::k_INT
                            + 4);
             pRV = &bdexStreamIn(stream, XVJ);
@@ -1307,17 +1306,13 @@ int main(int argc, char *argv[])
             stream.putVersion(1);
             stream.putLength(2);
             stream.putLength(3);
-            stream.putType(MyTestInStream::k_UNSIGNED
-                           + MyTestInStream::k_INT
-                           + 4);
-            stream.putType(MyTestInStream::k_UNSIGNED
-                           + MyTestInStream::k_INT
-                           + 4);
-            stream.putType(MyTestInStream::k_UNSIGNED
+            stream.putType(MyTestInStream::k_ARRAY
+                           + MyTestInStream::k_UNSIGNED
                            + MyTestInStream::k_INT
                            + 4);
             stream.putLength(1);
-            stream.putType(MyTestInStream::k_UNSIGNED
+            stream.putType(MyTestInStream::k_ARRAY
+                           + MyTestInStream::k_UNSIGNED
                            + MyTestInStream::k_INT
                            + 4);
             pRV = &bdexStreamIn(stream, XVVJ);
@@ -1839,9 +1834,9 @@ int main(int argc, char *argv[])
 
             stream.clear();
             stream.putLength(3);
-            stream.putType(MyTestInStream::k_INT + 1);
-            stream.putType(MyTestInStream::k_INT + 1);
-            stream.putType(MyTestInStream::k_INT + 1);
+            stream.putType(MyTestInStream::k_ARRAY
+                           + MyTestInStream::k_INT
+                           + 1);
             pRV = &bdexStreamIn(stream, XVA, 1);
             ASSERT(pRV == &stream);
             ASSERT(false == stream.error());
@@ -1849,11 +1844,13 @@ int main(int argc, char *argv[])
             stream.clear();
             stream.putLength(2);
             stream.putLength(3);
-            stream.putType(MyTestInStream::k_INT + 1);
-            stream.putType(MyTestInStream::k_INT + 1);
-            stream.putType(MyTestInStream::k_INT + 1);
+            stream.putType(MyTestInStream::k_ARRAY
+                           + MyTestInStream::k_INT
+                           + 1);
             stream.putLength(1);
-            stream.putType(MyTestInStream::k_INT + 1);
+            stream.putType(MyTestInStream::k_ARRAY
+                           + MyTestInStream::k_INT
+                           + 1);
             pRV = &bdexStreamIn(stream, XVVA, 1);
             ASSERT(pRV == &stream);
             ASSERT(false == stream.error());
@@ -2185,9 +2182,9 @@ int main(int argc, char *argv[])
 
             stream.clear();
             stream.putLength(3);
-            stream.putType(MyTestInStream::k_INT + 4);
-            stream.putType(MyTestInStream::k_INT + 4);
-            stream.putType(MyTestInStream::k_INT + 4);
+            stream.putType(MyTestInStream::k_ARRAY
+                           + MyTestInStream::k_INT
+                           + 4);
             pRV = &bdexStreamIn(stream, XVI, 1);
             ASSERT(pRV == &stream);
             ASSERT(false == stream.error());
@@ -2195,11 +2192,13 @@ int main(int argc, char *argv[])
             stream.clear();
             stream.putLength(2);
             stream.putLength(3);
-            stream.putType(MyTestInStream::k_INT + 4);
-            stream.putType(MyTestInStream::k_INT + 4);
-            stream.putType(MyTestInStream::k_INT + 4);
+            stream.putType(MyTestInStream::k_ARRAY
+                           + MyTestInStream::k_INT
+                           + 4);
             stream.putLength(1);
-            stream.putType(MyTestInStream::k_INT + 4);
+            stream.putType(MyTestInStream::k_ARRAY
+                           + MyTestInStream::k_INT
+                           + 4);
             pRV = &bdexStreamIn(stream, XVVI, 1);
             ASSERT(pRV == &stream);
             ASSERT(false == stream.error());
@@ -2226,13 +2225,8 @@ int main(int argc, char *argv[])
 
             stream.clear();
             stream.putLength(3);
-            stream.putType(MyTestInStream::k_UNSIGNED
-                           + MyTestInStream::k_INT
-                           + 4);
-            stream.putType(MyTestInStream::k_UNSIGNED
-                           + MyTestInStream::k_INT
-                           + 4);
-            stream.putType(MyTestInStream::k_UNSIGNED
+            stream.putType(MyTestInStream::k_ARRAY
+                           + MyTestInStream::k_UNSIGNED
                            + MyTestInStream::k_INT
                            + 4);
             pRV = &bdexStreamIn(stream, XVJ, 1);
@@ -2242,17 +2236,13 @@ int main(int argc, char *argv[])
             stream.clear();
             stream.putLength(2);
             stream.putLength(3);
-            stream.putType(MyTestInStream::k_UNSIGNED
-                           + MyTestInStream::k_INT
-                           + 4);
-            stream.putType(MyTestInStream::k_UNSIGNED
-                           + MyTestInStream::k_INT
-                           + 4);
-            stream.putType(MyTestInStream::k_UNSIGNED
+            stream.putType(MyTestInStream::k_ARRAY
+                           + MyTestInStream::k_UNSIGNED
                            + MyTestInStream::k_INT
                            + 4);
             stream.putLength(1);
-            stream.putType(MyTestInStream::k_UNSIGNED
+            stream.putType(MyTestInStream::k_ARRAY
+                           + MyTestInStream::k_UNSIGNED
                            + MyTestInStream::k_INT
                            + 4);
             pRV = &bdexStreamIn(stream, XVVJ, 1);
@@ -0,0 +1,323 @@
+// bslx_instreamutil.h                                                -*-C++-*-
+#ifndef INCLUDED_BSLX_INSTREAMUTIL
+#define INCLUDED_BSLX_INSTREAMUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide utilities to unexternalize objects into a given allocator.
+//
+//@CLASSES:
+//  bslx::InStreamUtil: namespace for allocator-aware unexternalization
+//
+//@SEE_ALSO: bslx_instreamfunctions, bslx_byteinstream
+//
+//@DESCRIPTION: This component provides a 'struct', 'bslx::InStreamUtil',
+// containing function templates that create an object of a BDEX-compliant
+// type from an input stream, such that the object itself, and all of the
+// memory allocated by the object while it is unexternalized, is supplied by a
+// given allocator.
+//
+///Unexternalizing into an Arena
+///-----------------------------
+// An object of an allocator-aware type (i.e., a type having the
+// 'bslma::UsesBslmaAllocator' trait) passes the allocator with which it is
+// created to each of its allocator-aware members (e.g., 'bsl::string' and
+// 'bsl::vector' members), which in turn pass it to their elements.  Since the
+// 'bdexStreamIn' methods of such types unexternalize *into* an existing
+// object, the allocator used by an entire unexternalized object graph is
+// therefore determined by the allocator with which the root object is
+// created.  'bslx::InStreamUtil::createObject' creates the root object from,
+// and using, a supplied allocator, and then unexternalizes it.
+//
+// When that allocator is an arena (e.g., a 'bdlma::SequentialAllocator'),
+// unexternalizing a large object graph amounts to a sequence of bump-pointer
+// allocations, and the entire graph can be discarded by releasing the arena
+// (e.g., by 'bdlma::SequentialAllocator::release' or the destruction of the
+// arena), without destroying the objects of the graph one by one, provided
+// that their destructors have no effect other than deallocating memory
+// supplied by the arena.
+//
+// Note that memory allocated by the stream itself, and any temporary memory
+// allocated by 'bdexStreamIn' methods that do not use the allocator of their
+// object, is not supplied by the given allocator.
+//
+///Borrowed Strings
+///----------------
+// 'bslx::ByteInStream::getStringRef' binds a 'bslstl::StringRef' to the
+// string data in the buffer of the stream, instead of copying that data into
+// a 'bsl::string'.  A type whose 'bdexStreamIn' method is specific to
+// 'bslx::ByteInStream' (or that is otherwise known to be unexternalized only
+// from a byte buffer that outlives the object) can use it to avoid copying,
+// and allocating memory for, its string members altogether.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Unexternalizing an Object into an Arena
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a BDEX-compliant, allocator-aware class, 'MyCatalog', that
+// holds a name and a list of items:
+//..
+//  class MyCatalog {
+//      // This class represents a named list of items.
+//
+//      // DATA
+//      bsl::string              d_name;   // name of the catalog
+//      bsl::vector<bsl::string> d_items;  // items of the catalog
+//
+//    public:
+//      // TRAITS
+//      BSLMF_NESTED_TRAIT_DECLARATION(MyCatalog, bslma::UsesBslmaAllocator);
+//
+//      // CLASS METHODS
+//      static int maxSupportedBdexVersion(int /* versionSelector */)
+//      {
+//          return 1;
+//      }
+//
+//      // CREATORS
+//      explicit MyCatalog(bslma::Allocator *basicAllocator = 0)
+//      : d_name(basicAllocator)
+//      , d_items(basicAllocator)
+//      {
+//      }
+//
+//      // MANIPULATORS
+//      template <class STREAM>
+//      STREAM& bdexStreamIn(STREAM& stream, int version)
+//      {
+//          if (1 == version) {
+//              bslx::InStreamFunctions::bdexStreamIn(stream, d_name, 1);
+//              bslx::InStreamFunctions::bdexStreamIn(stream, d_items, 1);
+//          }
+//          else {
+//              stream.invalidate();
+//          }
+//          return stream;
+//      }
+//
+//      bsl::string& name()
+//      {
+//          return d_name;
+//      }
+//
+//      bsl::vector<bsl::string>& items()
+//      {
+//          return d_items;
+//      }
+//
+//      // ACCESSORS
+//      template <class STREAM>
+//      STREAM& bdexStreamOut(STREAM& stream, int /* version */) const
+//      {
+//          bslx::OutStreamFunctions::bdexStreamOut(stream, d_name, 1);
+//          bslx::OutStreamFunctions::bdexStreamOut(stream, d_items, 1);
+//          return stream;
+//      }
+//  };
+//..
+// First, we create a catalog and externalize it:
+//..
+//  MyCatalog catalog;
+//  catalog.name() = "a catalog of fruits, in no particular order";
+//  catalog.items().push_back("a basket of apples of various kinds");
+//  catalog.items().push_back("a bunch of bananas that are very ripe");
+//
+//  bslx::ByteOutStream outStream(20150101);
+//  outStream << catalog;
+//  assert(outStream);
+//..
+// Then, we create the allocator from which the unexternalized catalog is to
+// be supplied.  In practice, this would be an arena such as a
+// 'bdlma::SequentialAllocator'; here, we use a 'bslma::TestAllocator' so that
+// we can observe the allocations.  We also install a test allocator as the
+// default allocator to confirm that it is not used:
+//..
+//  bslma::TestAllocator         arena("arena");
+//  bslma::TestAllocator         da("default");
+//  bslma::DefaultAllocatorGuard dag(&da);
+//..
+// Next, we unexternalize a new catalog from the data:
+//..
+//  bslx::ByteInStream inStream(outStream.data(), outStream.length());
+//
+//  MyCatalog *newCatalog = bslx::InStreamUtil::createObject<MyCatalog>(
+//                                                                   inStream,
+//                                                                   &arena);
+//  assert(newCatalog);
+//  assert(inStream);
+//  assert(catalog.name()  == newCatalog->name());
+//  assert(catalog.items() == newCatalog->items());
+//..
+// Now, we observe that the catalog, its name, its list of items, and each of
+// the items were allocated from 'arena', and that the default allocator was
+// not used:
+//..
+//  assert(5 == arena.numBlocksInUse());
+//  assert(0 == da.numBlocksTotal());
+//..
+// Finally, we delete the catalog.  Note that, had 'arena' been a
+// 'bdlma::SequentialAllocator', we could instead have released all of its
+// memory at once:
+//..
+//  arena.deleteObject(newCatalog);
+//  assert(0 == arena.numBlocksInUse());
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLX_INSTREAMFUNCTIONS
+#include <bslx_instreamfunctions.h>
+#endif
+
+#ifndef INCLUDED_BSLX_VERSIONFUNCTIONS
+#include <bslx_versionfunctions.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEALLOCATORPROCTOR
+#include <bslma_deallocatorproctor.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_RAWDELETERPROCTOR
+#include <bslma_rawdeleterproctor.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+namespace BloombergLP {
+namespace bslx {
+
+                            // ===================
+                            // struct InStreamUtil
+                            // ===================
+
+struct InStreamUtil {
+    // This 'struct' provides a namespace for function templates that create
+    // objects of BDEX-compliant types from input streams using a supplied
+    // allocator.
+
+    // CLASS METHODS
+    template <class TYPE, class STREAM>
+    static TYPE *createObject(STREAM& stream, bslma::Allocator *allocator);
+        // Create a default-constructed object of the (template parameter)
+        // 'TYPE' in memory supplied by the specified 'allocator', passing
+        // 'allocator' to the constructor if 'TYPE' uses 'bslma::Allocator',
+        // unexternalize into the object the version (if 'TYPE' requires one)
+        // and the value at the current cursor location of the specified
+        // 'stream' as if by 'operator>>', and return the address of the
+        // object.  If 'stream' is initially invalid, or is invalid after the
+        // value is unexternalized, destroy the object, return its memory to
+        // 'allocator', and return 0.  The behavior is undefined unless
+        // 'allocator' is non-null and 'TYPE' is BDEX-compliant.  Note that
+        // the returned object must be deleted by 'allocator' (or 'allocator'
+        // be released, as appropriate).
+
+    template <class TYPE, class STREAM>
+    static TYPE *createObject(STREAM&           stream,
+                              int               version,
+                              bslma::Allocator *allocator);
+        // Create a default-constructed object of the (template parameter)
+        // 'TYPE' in memory supplied by the specified 'allocator', passing
+        // 'allocator' to the constructor if 'TYPE' uses 'bslma::Allocator',
+        // unexternalize into the object the value at the current cursor
+        // location of the specified 'stream' using the specified 'version'
+        // format, and return the address of the object.  If 'stream' is
+        // initially invalid, or is invalid after the value is unexternalized,
+        // destroy the object, return its memory to 'allocator', and return 0.
+        // The behavior is undefined unless 'allocator' is non-null and 'TYPE'
+        // is BDEX-compliant.  Note that the returned object must be deleted
+        // by 'allocator' (or 'allocator' be released, as appropriate).
+};
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // struct InStreamUtil
+                            // -------------------
+
+// CLASS METHODS
+template <class TYPE, class STREAM>
+TYPE *InStreamUtil::createObject(STREAM& stream, bslma::Allocator *allocator)
+{
+    BSLS_ASSERT_SAFE(allocator);
+
+    using VersionFunctions::maxSupportedBdexVersion;
+
+    // Determine if the 'TYPE' requires a version to be externalized using an
+    // arbitrary value for 'versionSelector'.
+
+    int version = maxSupportedBdexVersion(static_cast<TYPE *>(0), 0);
+    if (VersionFunctions::k_NO_VERSION != version) {
+        stream.getVersion(version);
+    }
+
+    return createObject<TYPE>(stream, version, allocator);
+}
+
+template <class TYPE, class STREAM>
+TYPE *InStreamUtil::createObject(STREAM&           stream,
+                                 int               version,
+                                 bslma::Allocator *allocator)
+{
+    BSLS_ASSERT_SAFE(allocator);
+
+    if (!stream) {
+        return 0;                                                     // RETURN
+    }
+
+    TYPE *object = static_cast<TYPE *>(allocator->allocate(sizeof(TYPE)));
+
+    bslma::DeallocatorProctor<bslma::Allocator> deallocatorProctor(object,
+                                                                   allocator);
+    bslalg::ScalarPrimitives::defaultConstruct(object, allocator);
+    deallocatorProctor.release();
+
+    bslma::RawDeleterProctor<TYPE, bslma::Allocator> deleterProctor(object,
+                                                                    allocator);
+    InStreamFunctions::bdexStreamIn(stream, *object, version);
+    if (!stream) {
+        return 0;                                                     // RETURN
+    }
+    deleterProctor.release();
+
+    return object;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2014 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,777 @@
+// bslx_instreamutil.t.cpp                                            -*-C++-*-
+
+#include <bslx_instreamutil.h>
+
+#include <bslx_byteinstream.h>
+#include <bslx_byteoutstream.h>
+#include <bslx_instreamfunctions.h>
+#include <bslx_outstreamfunctions.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+using namespace bslx;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// We are testing a pair of function templates that create an object in memory
+// supplied by a given allocator and unexternalize into it.  We verify, using
+// test allocators, that the object and all of the memory it allocates while
+// it is unexternalized are supplied by the given allocator, that the default
+// allocator is not used, and that nothing is leaked when unexternalization
+// fails or an exception is thrown.  The results are compared with those of
+// 'bslx::InStreamFunctions::bdexStreamIn' applied to an existing object.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] TYPE *createObject(STREAM&, int version, bslma::Allocator *);
+// [ 3] TYPE *createObject(STREAM&, bslma::Allocator *);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef InStreamUtil Util;
+
+const int VERSION_SELECTOR = 20150101;
+
+// ============================================================================
+//                      GLOBAL TEST CLASSES
+// ----------------------------------------------------------------------------
+
+                              // ==============
+                              // class MyRecord
+                              // ==============
+
+class MyRecord {
+    // This allocator-aware, BDEX-compliant class holds a string, a vector of
+    // strings, and a vector of vectors of integers, and supports versions 1
+    // and 2 of its BDEX format (version 1 omitting the vector of vectors).
+
+    // DATA
+    bsl::string                   d_name;     // name
+    bsl::vector<bsl::string>      d_tags;     // tags
+    bsl::vector<bsl::vector<int> > d_values;  // values (version 2 only)
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(MyRecord, bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    static int maxSupportedBdexVersion(int versionSelector)
+        // Return 2 if the specified 'versionSelector' is at least
+        // 'VERSION_SELECTOR', and 1 otherwise.
+    {
+        return versionSelector >= VERSION_SELECTOR ? 2 : 1;
+    }
+
+    // CREATORS
+    explicit MyRecord(bslma::Allocator *basicAllocator = 0)
+        // Create an empty record.  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+    : d_name(basicAllocator)
+    , d_tags(basicAllocator)
+    , d_values(basicAllocator)
+    {
+    }
+
+    // MANIPULATORS
+    template <class STREAM>
+    STREAM& bdexStreamIn(STREAM& stream, int version)
+        // Assign to this object the value read from the specified input
+        // 'stream' using the specified 'version' format, and return a
+        // reference to 'stream'.
+    {
+        if (1 != version && 2 != version) {
+            stream.invalidate();
+            return stream;                                            // RETURN
+        }
+        InStreamFunctions::bdexStreamIn(stream, d_name, 1);
+        InStreamFunctions::bdexStreamIn(stream, d_tags, 1);
+        if (2 == version) {
+            InStreamFunctions::bdexStreamIn(stream, d_values, 1);
+        }
+        return stream;
+    }
+
+    bsl::string& name()
+        // Return a reference to the modifiable name of this object.
+    {
+        return d_name;
+    }
+
+    bsl::vector<bsl::string>& tags()
+        // Return a reference to the modifiable tags of this object.
+    {
+        return d_tags;
+    }
+
+    bsl::vector<bsl::vector<int> >& values()
+        // Return a reference to the modifiable values of this object.
+    {
+        return d_values;
+    }
+
+    // ACCESSORS
+    template <class STREAM>
+    STREAM& bdexStreamOut(STREAM& stream, int version) const
+        // Write the value of this object, using the specified 'version'
+        // format, to the specified output 'stream', and return a reference to
+        // 'stream'.
+    {
+        OutStreamFunctions::bdexStreamOut(stream, d_name, 1);
+        OutStreamFunctions::bdexStreamOut(stream, d_tags, 1);
+        if (2 == version) {
+            OutStreamFunctions::bdexStreamOut(stream, d_values, 1);
+        }
+        return stream;
+    }
+
+    bslma::Allocator *allocator() const
+        // Return the allocator used by this object to supply memory.
+    {
+        return d_name.get_allocator().mechanism();
+    }
+
+    bool isEqual(const MyRecord& other) const
+        // Return 'true' if the specified 'other' record has the same value as
+        // this object, and 'false' otherwise.
+    {
+        return d_name   == other.d_name
+            && d_tags   == other.d_tags
+            && d_values == other.d_values;
+    }
+};
+
+static void setRecord(MyRecord *record)
+    // Load into the specified 'record' a value whose members are all large
+    // enough to allocate memory.
+{
+    record->name() = "a name that is too long for the short-string buffer";
+    for (int i = 0; i < 5; ++i) {
+        record->tags().push_back(
+                         bsl::string(40 + i, static_cast<char>('a' + i)));
+        record->values().push_back(bsl::vector<int>(10 * (i + 1), i));
+    }
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Unexternalizing an Object into an Arena
+/// - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a BDEX-compliant, allocator-aware class, 'MyCatalog', that
+// holds a name and a list of items:
+//..
+    class MyCatalog {
+        // This class represents a named list of items.
+
+        // DATA
+        bsl::string              d_name;   // name of the catalog
+        bsl::vector<bsl::string> d_items;  // items of the catalog
+
+      public:
+        // TRAITS
+        BSLMF_NESTED_TRAIT_DECLARATION(MyCatalog, bslma::UsesBslmaAllocator);
+
+        // CLASS METHODS
+        static int maxSupportedBdexVersion(int /* versionSelector */)
+        {
+            return 1;
+        }
+
+        // CREATORS
+        explicit MyCatalog(bslma::Allocator *basicAllocator = 0)
+        : d_name(basicAllocator)
+        , d_items(basicAllocator)
+        {
+        }
+
+        // MANIPULATORS
+        template <class STREAM>
+        STREAM& bdexStreamIn(STREAM& stream, int version)
+        {
+            if (1 == version) {
+                bslx::InStreamFunctions::bdexStreamIn(stream, d_name, 1);
+                bslx::InStreamFunctions::bdexStreamIn(stream, d_items, 1);
+            }
+            else {
+                stream.invalidate();
+            }
+            return stream;
+        }
+
+        bsl::string& name()
+        {
+            return d_name;
+        }
+
+        bsl::vector<bsl::string>& items()
+        {
+            return d_items;
+        }
+
+        // ACCESSORS
+        template <class STREAM>
+        STREAM& bdexStreamOut(STREAM& stream, int /* version */) const
+        {
+            bslx::OutStreamFunctions::bdexStreamOut(stream, d_name, 1);
+            bslx::OutStreamFunctions::bdexStreamOut(stream, d_items, 1);
+            return stream;
+        }
+    };
+//..
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// First, we create a catalog and externalize it:
+//..
+    MyCatalog catalog;
+    catalog.name() = "a catalog of fruits, in no particular order";
+    catalog.items().push_back("a basket of apples of various kinds");
+    catalog.items().push_back("a bunch of bananas that are very ripe");
+
+    bslx::ByteOutStream outStream(20150101);
+    outStream << catalog;
+    ASSERT(outStream);
+//..
+// Then, we create the allocator from which the unexternalized catalog is to
+// be supplied.  In practice, this would be an arena such as a
+// 'bdlma::SequentialAllocator'; here, we use a 'bslma::TestAllocator' so that
+// we can observe the allocations.  We also install a test allocator as the
+// default allocator to confirm that it is not used:
+//..
+    bslma::TestAllocator         arena("arena");
+    bslma::TestAllocator         da("default");
+    bslma::DefaultAllocatorGuard dag(&da);
+//..
+// Next, we unexternalize a new catalog from the data:
+//..
+    bslx::ByteInStream inStream(outStream.data(), outStream.length());
+
+    MyCatalog *newCatalog = bslx::InStreamUtil::createObject<MyCatalog>(
+                                                                     inStream,
+                                                                     &arena);
+    ASSERT(newCatalog);
+    ASSERT(inStream);
+    ASSERT(catalog.name()  == newCatalog->name());
+    ASSERT(catalog.items() == newCatalog->items());
+//..
+// Now, we observe that the catalog, its name, its list of items, and each of
+// the items were allocated from 'arena', and that the default allocator was
+// not used:
+//..
+    ASSERT(5 == arena.numBlocksInUse());
+    ASSERT(0 == da.numBlocksTotal());
+//..
+// Finally, we delete the catalog.  Note that, had 'arena' been a
+// 'bdlma::SequentialAllocator', we could instead have released all of its
+// memory at once:
+//..
+    arena.deleteObject(newCatalog);
+    ASSERT(0 == arena.numBlocksInUse());
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'createObject' WITHOUT VERSION
+        //   Verify the version is read if, and only if, the type requires one.
+        //
+        // Concerns:
+        //: 1 For a type that requires a version, the version is read from the
+        //:   stream and the value is read in that version's format.
+        //:
+        //: 2 For a type that does not require a version, no version is read.
+        //:
+        //: 3 The result, and the cursor location of the stream, are the same
+        //:   as those of 'InStreamFunctions::bdexStreamIn' applied to an
+        //:   existing object.
+        //:
+        //: 4 If the stream is invalid, or the version is invalid or missing,
+        //:   0 is returned and no memory is leaked.
+        //:
+        //: 5 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Externalize, using 'operator<<', values of 'MyRecord' (with
+        //:   version selectors mapping to both of its versions), 'int', and
+        //:   'bsl::vector<bsl::string>'.  Create objects from the data, and
+        //:   compare them, and the cursor location, with the results of
+        //:   'bdexStreamIn' applied to default-constructed objects.  (C-1..3)
+        //:
+        //: 2 Create objects from invalid streams, from data having an invalid
+        //:   version, and from every proper prefix of the data, and verify 0
+        //:   is returned and the allocator has no memory in use.  (C-4)
+        //:
+        //: 3 Verify defensive checks are triggered for invalid values.  (C-5)
+        //
+        // Testing:
+        //   TYPE *createObject(STREAM&, bslma::Allocator *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'createObject' WITHOUT VERSION" << endl
+                          << "==============================" << endl;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\nTesting a versioned type." << endl;
+        for (int selector = VERSION_SELECTOR - 1;
+             selector <= VERSION_SELECTOR;
+             ++selector) {
+            if (veryVerbose) { T_ P(selector) }
+
+            MyRecord record;
+            setRecord(&record);
+
+            ByteOutStream out(selector);
+            out << record;
+            ASSERT(out);
+
+            ByteInStream expectedIn(out.data(), out.length());
+            MyRecord     expected;
+            InStreamFunctions::bdexStreamIn(expectedIn, expected);
+            ASSERT(expectedIn);
+
+            {
+                bslma::DefaultAllocatorGuard dag(&da);
+
+                ByteInStream in(out.data(), out.length());
+
+                MyRecord *object = Util::createObject<MyRecord>(in, &sa);
+                LOOP_ASSERT(selector, object);
+                LOOP_ASSERT(selector, in);
+                LOOP_ASSERT(selector, expectedIn.cursor() == in.cursor());
+                LOOP_ASSERT(selector, object->isEqual(expected));
+                LOOP_ASSERT(selector, &sa == object->allocator());
+                LOOP_ASSERT(selector, 0 == da.numBlocksTotal());
+
+                sa.deleteObject(object);
+                LOOP_ASSERT(selector, 0 == sa.numBlocksInUse());
+            }
+
+            for (bsl::size_t len = 0; len < out.length(); ++len) {
+                bslma::DefaultAllocatorGuard dag(&da);
+
+                ByteInStream in(out.data(), len);
+
+                MyRecord *object = Util::createObject<MyRecord>(in, &sa);
+                LOOP2_ASSERT(selector, len, 0 == object);
+                LOOP2_ASSERT(selector, len, !in);
+                LOOP2_ASSERT(selector, len, 0 == sa.numBlocksInUse());
+                LOOP2_ASSERT(selector, len, 0 == da.numBlocksTotal());
+            }
+        }
+
+        if (verbose) cout << "\nTesting unversioned types." << endl;
+        {
+            MyRecord record;
+            setRecord(&record);
+
+            ByteOutStream out(VERSION_SELECTOR);
+            out << 17 << record.tags();
+            ASSERT(out);
+
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            ByteInStream in(out.data(), out.length());
+
+            int *i = Util::createObject<int>(in, &sa);
+            ASSERT(i);
+            ASSERT(17 == *i);
+            ASSERT(4 == in.cursor());
+
+            bsl::vector<bsl::string> *tags =
+                      Util::createObject<bsl::vector<bsl::string> >(in, &sa);
+            ASSERT(tags);
+            ASSERT(in);
+            ASSERT(out.length() == in.cursor());
+            ASSERT(record.tags() == *tags);
+            ASSERT(&sa == tags->get_allocator().mechanism());
+            ASSERT(&sa == (*tags)[0].get_allocator().mechanism());
+            ASSERT(0 == da.numBlocksTotal());
+
+            sa.deleteObject(i);
+            sa.deleteObject(tags);
+            ASSERT(0 == sa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting invalid streams and versions." << endl;
+        {
+            MyRecord record;
+            setRecord(&record);
+
+            ByteOutStream out(VERSION_SELECTOR);
+            out.putVersion(3);
+            record.bdexStreamOut(out, 2);
+            ASSERT(out);
+
+            ByteInStream in(out.data(), out.length());
+            ASSERT(0 == Util::createObject<MyRecord>(in, &sa));
+            ASSERT(!in);
+            ASSERT(0 == sa.numBlocksInUse());
+
+            in.reset();
+            in.invalidate();
+            ASSERT(0 == Util::createObject<MyRecord>(in, &sa));
+            ASSERT(0 == Util::createObject<int>(in, &sa));
+            ASSERT(0 == in.cursor());
+            ASSERT(0 == sa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard
+                                          hG(bsls::AssertTest::failTestDriver);
+
+            ByteOutStream out(VERSION_SELECTOR);
+            out << 1;
+
+            ByteInStream in(out.data(), out.length());
+
+            ASSERT_SAFE_FAIL(Util::createObject<int>(in, 0));
+            int *object = 0;
+            ASSERT_SAFE_PASS(object = Util::createObject<int>(in, &sa));
+            sa.deleteObject(object);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'createObject' WITH VERSION
+        //   Verify the object and its memory are supplied by the allocator.
+        //
+        // Concerns:
+        //: 1 The object is created in memory supplied by the given allocator,
+        //:   is passed that allocator, and has the unexternalized value.
+        //:
+        //: 2 All memory allocated by the object (and its members) while it is
+        //:   unexternalized is supplied by the given allocator; the default
+        //:   allocator is not used.
+        //:
+        //: 3 If the stream is initially invalid, no memory is allocated and
+        //:   0 is returned.
+        //:
+        //: 4 If unexternalization fails, the object is destroyed, its memory
+        //:   is returned to the allocator, and 0 is returned.
+        //:
+        //: 5 No memory is leaked if an exception is thrown.
+        //:
+        //: 6 QoI: asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Externalize a 'MyRecord' value in each of its versions, create
+        //:   objects from the data, and verify the value, the allocator of the
+        //:   object, and the allocations of the supplied and default
+        //:   allocators.  (C-1..2)
+        //:
+        //: 2 Create objects from an invalid stream, from every proper prefix
+        //:   of the data, and using an unsupported version, and verify 0 is
+        //:   returned and the allocator has no memory in use.  (C-3..4)
+        //:
+        //: 3 Create an object within the 'bslma' exception-test loop.  (C-5)
+        //:
+        //: 4 Verify defensive checks are triggered for invalid values.  (C-6)
+        //
+        // Testing:
+        //   TYPE *createObject(STREAM&, int version, bslma::Allocator *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'createObject' WITH VERSION" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        MyRecord record;
+        setRecord(&record);
+
+        if (verbose) cout << "\nTesting valid data." << endl;
+        for (int version = 1; version <= 2; ++version) {
+            if (veryVerbose) { T_ P(version) }
+
+            ByteOutStream out(VERSION_SELECTOR);
+            record.bdexStreamOut(out, version);
+
+            MyRecord expected;
+            {
+                ByteInStream in(out.data(), out.length());
+                expected.bdexStreamIn(in, version);
+                ASSERT(in);
+            }
+
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            ByteInStream in(out.data(), out.length());
+
+            MyRecord *object = Util::createObject<MyRecord>(in, version, &sa);
+            LOOP_ASSERT(version, object);
+            LOOP_ASSERT(version, in);
+            LOOP_ASSERT(version, out.length() == in.cursor());
+            LOOP_ASSERT(version, object->isEqual(expected));
+            LOOP_ASSERT(version, &sa == object->allocator());
+            LOOP_ASSERT(version, 0 < sa.numBlocksInUse());
+            LOOP_ASSERT(version, 0 == da.numBlocksTotal());
+
+            sa.deleteObject(object);
+            LOOP_ASSERT(version, 0 == sa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting invalid data." << endl;
+        {
+            ByteOutStream out(VERSION_SELECTOR);
+            record.bdexStreamOut(out, 2);
+
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            {
+                const bsls::Types::Int64 NUM_BLOCKS = sa.numBlocksTotal();
+
+                ByteInStream in(out.data(), out.length());
+                in.invalidate();
+
+                ASSERT(0 == Util::createObject<MyRecord>(in, 2, &sa));
+                ASSERT(NUM_BLOCKS == sa.numBlocksTotal());
+            }
+
+            for (bsl::size_t len = 0; len < out.length(); ++len) {
+                ByteInStream in(out.data(), len);
+
+                LOOP_ASSERT(len, 0 == Util::createObject<MyRecord>(in,
+                                                                   2,
+                                                                   &sa));
+                LOOP_ASSERT(len, !in);
+                LOOP_ASSERT(len, 0 == sa.numBlocksInUse());
+            }
+
+            {
+                ByteInStream in(out.data(), out.length());
+
+                ASSERT(0 == Util::createObject<MyRecord>(in, 3, &sa));
+                ASSERT(!in);
+                ASSERT(0 == sa.numBlocksInUse());
+            }
+
+            ASSERT(0 == da.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\nTesting exception safety." << endl;
+        {
+            ByteOutStream out(VERSION_SELECTOR);
+            record.bdexStreamOut(out, 2);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(sa) {
+                ByteInStream in(out.data(), out.length());
+
+                MyRecord *object = Util::createObject<MyRecord>(in, 2, &sa);
+                ASSERT(object);
+                ASSERT(object->isEqual(record));
+
+                sa.deleteObject(object);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(0 == sa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard
+                                          hG(bsls::AssertTest::failTestDriver);
+
+            ByteOutStream out(VERSION_SELECTOR);
+            record.bdexStreamOut(out, 1);
+
+            ByteInStream in(out.data(), out.length());
+
+            ASSERT_SAFE_FAIL(Util::createObject<MyRecord>(in, 1, 0));
+            MyRecord *object = 0;
+            ASSERT_SAFE_PASS(object = Util::createObject<MyRecord>(in,
+                                                                   1,
+                                                                   &sa));
+            sa.deleteObject(object);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create objects of 'int' and 'MyRecord' from externalized data,
+        //:   and verify their values and the allocator used.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        MyRecord record;
+        setRecord(&record);
+
+        ByteOutStream out(VERSION_SELECTOR);
+        out << 5 << record;
+
+        ByteInStream in(out.data(), out.length());
+
+        int *i = Util::createObject<int>(in, &sa);
+        ASSERT(i);
+        ASSERT(5 == *i);
+
+        MyRecord *object = Util::createObject<MyRecord>(in, &sa);
+        ASSERT(object);
+        ASSERT(object->isEqual(record));
+        ASSERT(&sa == object->allocator());
+
+        if (veryVerbose) { P(sa.numBlocksInUse()) }
+
+        sa.deleteObject(i);
+        sa.deleteObject(object);
+        ASSERT(0 == sa.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2014 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -4,9 +4,67 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bslx_marshallingutil_cpp,"$Id$ $CSID$")
 
+#include <bsls_byteorderutil.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The array functions for 16-, 32-, and 64-bit values, whose in-memory size
+// matches their size in the external representation, convert the whole array
+// at once: on little-endian platforms, the bytes of each value are reversed by
+// 'bsls::ByteOrderUtil::swapBytesArray{16,32,64}', which processes several
+// values per instruction where the host supports it; on big-endian platforms,
+// the array is copied as is.  The remaining array functions convert one value
+// at a time.
+
 namespace BloombergLP {
 namespace bslx {
 
+namespace {
+
+inline
+void copyInNetworkOrder16(void *destination, const void *source, int numValues)
+    // Load into the specified 'destination' the specified 'numValues' 16-bit
+    // words at the specified 'source', converting each between host and
+    // network byte order.  The behavior is undefined unless '0 <= numValues'
+    // and the 'destination' and 'source' sequences do not overlap.
+{
+#if BSLS_PLATFORM_IS_LITTLE_ENDIAN
+    bsls::ByteOrderUtil::swapBytesArray16(destination, source, numValues);
+#else
+    bsl::memcpy(destination, source, numValues * 2);
+#endif
+}
+
+inline
+void copyInNetworkOrder32(void *destination, const void *source, int numValues)
+    // Load into the specified 'destination' the specified 'numValues' 32-bit
+    // words at the specified 'source', converting each between host and
+    // network byte order.  The behavior is undefined unless '0 <= numValues'
+    // and the 'destination' and 'source' sequences do not overlap.
+{
+#if BSLS_PLATFORM_IS_LITTLE_ENDIAN
+    bsls::ByteOrderUtil::swapBytesArray32(destination, source, numValues);
+#else
+    bsl::memcpy(destination, source, numValues * 4);
+#endif
+}
+
+inline
+void copyInNetworkOrder64(void *destination, const void *source, int numValues)
+    // Load into the specified 'destination' the specified 'numValues' 64-bit
+    // words at the specified 'source', converting each between host and
+    // network byte order.  The behavior is undefined unless '0 <= numValues'
+    // and the 'destination' and 'source' sequences do not overlap.
+{
+#if BSLS_PLATFORM_IS_LITTLE_ENDIAN
+    bsls::ByteOrderUtil::swapBytesArray64(destination, source, numValues);
+#else
+    bsl::memcpy(destination, source, numValues * 8);
+#endif
+}
+
+}  // close unnamed namespace
+
                         // ----------------------
                         // struct MarshallingUtil
                         // ----------------------
@@ -23,6 +81,11 @@ void MarshallingUtil::putArrayInt64(char                     *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_INT64) {
+        copyInNetworkOrder64(buffer, values, numValues);
+        return;                                                       // RETURN
+    }
+
     const bsls::Types::Int64 *end = values + numValues;
     for (; values != end; ++values) {
         putInt64(buffer, *values);
@@ -38,6 +101,11 @@ void MarshallingUtil::putArrayInt64(char                      *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_INT64) {
+        copyInNetworkOrder64(buffer, values, numValues);
+        return;                                                       // RETURN
+    }
+
     const bsls::Types::Uint64 *end = values + numValues;
     for (; values != end; ++values) {
         putInt64(buffer, *values);
@@ -143,6 +211,11 @@ void MarshallingUtil::putArrayInt32(char      *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_INT32) {
+        copyInNetworkOrder32(buffer, values, numValues);
+        return;                                                       // RETURN
+    }
+
     const int *end = values + numValues;
     for (; values != end; ++values) {
         putInt32(buffer, *values);
@@ -158,6 +231,11 @@ void MarshallingUtil::putArrayInt32(char               *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_INT32) {
+        copyInNetworkOrder32(buffer, values, numValues);
+        return;                                                       // RETURN
+    }
+
     const unsigned int *end = values + numValues;
     for (; values != end; ++values) {
         putInt32(buffer, *values);
@@ -203,6 +281,11 @@ void MarshallingUtil::putArrayInt16(char        *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_INT16) {
+        copyInNetworkOrder16(buffer, values, numValues);
+        return;                                                       // RETURN
+    }
+
     const short *end = values + numValues;
     for (; values != end; ++values) {
         putInt16(buffer, *values);
@@ -218,6 +301,11 @@ void MarshallingUtil::putArrayInt16(char                 *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_INT16) {
+        copyInNetworkOrder16(buffer, values, numValues);
+        return;                                                       // RETURN
+    }
+
     const unsigned short *end = values + numValues;
     for (; values != end; ++values) {
         putInt16(buffer, *values);
@@ -235,6 +323,11 @@ void MarshallingUtil::putArrayFloat64(char         *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_FLOAT64) {
+        copyInNetworkOrder64(buffer, values, numValues);
+        return;                                                       // RETURN
+    }
+
     const double *end = values + numValues;
     for (; values < end; ++values) {
         putFloat64(buffer, *values);
@@ -250,6 +343,11 @@ void MarshallingUtil::putArrayFloat32(char        *buffer,
     BSLS_ASSERT(values);
     BSLS_ASSERT(0 <= numValues);
 
+    if (sizeof *values == k_SIZEOF_FLOAT32) {
+        copyInNetworkOrder32(buffer, values, numValues);
+        return;                                                       // RETURN
+    }
+
     const float *end = values + numValues;
     for (; values < end; ++values) {
         putFloat32(buffer, *values);
@@ -267,6 +365,11 @@ void MarshallingUtil::getArrayInt64(bsls::Types::Int64 *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_INT64) {
+        copyInNetworkOrder64(variables, buffer, numVariables);
+        return;                                                       // RETURN
+    }
+
     const bsls::Types::Int64 *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getInt64(variables, buffer);
@@ -282,6 +385,11 @@ void MarshallingUtil::getArrayUint64(bsls::Types::Uint64 *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_INT64) {
+        copyInNetworkOrder64(variables, buffer, numVariables);
+        return;                                                       // RETURN
+    }
+
     const bsls::Types::Uint64 *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getUint64(variables, buffer);
@@ -387,6 +495,11 @@ void MarshallingUtil::getArrayInt32(int        *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_INT32) {
+        copyInNetworkOrder32(variables, buffer, numVariables);
+        return;                                                       // RETURN
+    }
+
     const int *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getInt32(variables, buffer);
@@ -402,6 +515,11 @@ void MarshallingUtil::getArrayUint32(unsigned int *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_INT32) {
+        copyInNetworkOrder32(variables, buffer, numVariables);
+        return;                                                       // RETURN
+    }
+
     const unsigned int *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getUint32(variables, buffer);
@@ -447,6 +565,11 @@ void MarshallingUtil::getArrayInt16(short      *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_INT16) {
+        copyInNetworkOrder16(variables, buffer, numVariables);
+        return;                                                       // RETURN
+    }
+
     const short *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getInt16(variables, buffer);
@@ -462,6 +585,11 @@ void MarshallingUtil::getArrayUint16(unsigned short *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_INT16) {
+        copyInNetworkOrder16(variables, buffer, numVariables);
+        return;                                                       // RETURN
+    }
+
     const unsigned short *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getUint16(variables, buffer);
@@ -479,6 +607,11 @@ void MarshallingUtil::getArrayFloat64(double     *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_FLOAT64) {
+        copyInNetworkOrder64(variables, buffer, numVariables);
+        return;                                                       // RETURN
+    }
+
     const double *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getFloat64(variables, buffer);
@@ -494,6 +627,11 @@ void MarshallingUtil::getArrayFloat32(float      *variables,
     BSLS_ASSERT(buffer);
     BSLS_ASSERT(0 <= numVariables);
 
+    if (sizeof *variables == k_SIZEOF_FLOAT32) {
+        copyInNetworkOrder32(variables, buffer, numVariables);
+        return;                                                       // RETURN
+    }
+
     const float *end = variables + numVariables;
     for (; variables != end; ++variables) {
         getFloat32(variables, buffer);
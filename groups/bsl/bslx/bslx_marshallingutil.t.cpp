@@ -593,7 +593,7 @@ int main(int argc, char *argv[]) {
             if (wasError) break;        // no need to continue.
         }
 
-        const int NUM_TRIALS = 10;
+        const int NUM_TRIALS = 40;  // spans several vectorized blocks
         T         input[NUM_TRIALS];
         {   // load repeating pattern: A, B, C, ..., A, B, C, ...
             for (i = 0; i < NUM_TRIALS; ++i) {
@@ -842,7 +842,7 @@ int main(int argc, char *argv[]) {
             if (wasError) break;        // no need to continue.
         }
 
-        const int NUM_TRIALS = 10;
+        const int NUM_TRIALS = 40;  // spans several vectorized blocks
         T         input[NUM_TRIALS];
         {   // load repeating pattern: A, B, C, ..., A, B, C, ...
             for (i = 0; i < NUM_TRIALS; ++i) {
@@ -1318,7 +1318,7 @@ int main(int argc, char *argv[]) {
             if (wasError) break;        // no need to continue.
         }
 
-        const int NUM_TRIALS = 10;
+        const int NUM_TRIALS = 40;  // spans several vectorized blocks
         T         input[NUM_TRIALS];
         {   // load repeating pattern: A, B, C, ..., A, B, C, ...
             for (i = 0; i < NUM_TRIALS; ++i) {
@@ -1783,7 +1783,7 @@ int main(int argc, char *argv[]) {
             if (wasError) break;        // no need to continue.
         }
 
-        const int NUM_TRIALS = 10;
+        const int NUM_TRIALS = 40;  // spans several vectorized blocks
         T         input[NUM_TRIALS];
         {   // load repeating pattern: A, B, C, ..., A, B, C, ...
             for (i = 0; i < NUM_TRIALS; ++i) {
@@ -2741,7 +2741,7 @@ int main(int argc, char *argv[]) {
             if (wasError) break;        // no need to continue.
         }
 
-        const int NUM_TRIALS = 10;
+        const int NUM_TRIALS = 40;  // spans several vectorized blocks
         T         input[NUM_TRIALS];
         {   // load repeating pattern: A, B, C, ..., A, B, C, ...
             for (i = 0; i < NUM_TRIALS; ++i) {
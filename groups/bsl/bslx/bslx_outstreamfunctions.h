@@ -760,6 +760,20 @@ namespace OutStreamFunctions {
         // documentation for more information on BDEX streaming of
         // value-semantic types and containers.
 
+    template <class STREAM, class ALLOC>
+    STREAM& bdexStreamOut(STREAM&                         stream,
+                          const bsl::vector<bool, ALLOC>& value,
+                          int                             version);
+        // Write the specified 'bsl::vector<bool, ALLOC>' 'value' to the
+        // specified output 'stream', and return a reference to 'stream'.  The
+        // specified 'version' is ignored.  If 'stream' is initially invalid,
+        // this operation has no effect.  See the 'bslx' package-level
+        // documentation for more information on BDEX streaming of
+        // value-semantic types and containers.  Note that the elements are
+        // written using array 'put' methods, and that the resulting stream
+        // content is identical to that produced by externalizing each element
+        // individually.
+
     template <class STREAM, class ALLOC>
     STREAM& bdexStreamOut(STREAM&                         stream,
                           const bsl::vector<char, ALLOC>& value,
@@ -837,6 +851,34 @@ namespace OutStreamFunctions {
         // documentation for more information on BDEX streaming of
         // value-semantic types and containers.
 
+    template <class STREAM, class ALLOC>
+    STREAM& bdexStreamOut(STREAM&                         stream,
+                          const bsl::vector<long, ALLOC>& value,
+                          int                             version);
+        // Write the specified 'bsl::vector<long, ALLOC>' 'value' to the
+        // specified output 'stream', and return a reference to 'stream'.  The
+        // specified 'version' is ignored.  If 'stream' is initially invalid,
+        // this operation has no effect.  See the 'bslx' package-level
+        // documentation for more information on BDEX streaming of
+        // value-semantic types and containers.  Note that each element is
+        // written as a 32-bit 'int' (consistent with the 'long' overload), so
+        // the externalization is lossy for elements outside the range of an
+        // 'int32_t'.
+
+    template <class STREAM, class ALLOC>
+    STREAM& bdexStreamOut(STREAM&                                  stream,
+                          const bsl::vector<unsigned long, ALLOC>& value,
+                          int                                      version);
+        // Write the specified 'bsl::vector<unsigned long, ALLOC>' 'value' to
+        // the specified output 'stream', and return a reference to 'stream'.
+        // The specified 'version' is ignored.  If 'stream' is initially
+        // invalid, this operation has no effect.  See the 'bslx' package-level
+        // documentation for more information on BDEX streaming of
+        // value-semantic types and containers.  Note that each element is
+        // written as a 32-bit 'unsigned int' (consistent with the
+        // 'unsigned long' overload), so the externalization is lossy for
+        // elements outside the range of a 'uint32_t'.
+
     template <class STREAM, class ALLOC>
     STREAM& bdexStreamOut(
                         STREAM&                                       stream,
@@ -1109,6 +1151,37 @@ STREAM& OutStreamFunctions::bdexStreamOut(STREAM&            stream,
     return stream.putString(value);
 }
 
+template <class STREAM, class ALLOC>
+STREAM& OutStreamFunctions::bdexStreamOut(
+                                    STREAM&                         stream,
+                                    const bsl::vector<bool, ALLOC>& value,
+                                    int                          /* version */)
+{
+    // The elements are converted to their wire representation in fixed-size
+    // chunks so that the stream is accessed once per chunk rather than once
+    // per element.
+
+    enum { k_BUFFER_SIZE = 256 };
+
+    const int length = static_cast<int>(value.size());
+    stream.putLength(length);
+
+    char buffer[k_BUFFER_SIZE];
+
+    for (int i = 0; i < length; i += k_BUFFER_SIZE) {
+        const int count = length - i < k_BUFFER_SIZE
+                          ? length - i
+                          : static_cast<int>(k_BUFFER_SIZE);
+
+        for (int j = 0; j < count; ++j) {
+            buffer[j] = static_cast<char>(value[i + j]);
+        }
+        stream.putArrayInt8(buffer, count);
+    }
+
+    return stream;
+}
+
 template <class STREAM, class ALLOC>
 inline
 STREAM& OutStreamFunctions::bdexStreamOut(
@@ -1200,6 +1273,60 @@ STREAM& OutStreamFunctions::bdexStreamOut(
     return 0 < length ? stream.putArrayUint32(&value[0], length) : stream;
 }
 
+template <class STREAM, class ALLOC>
+STREAM& OutStreamFunctions::bdexStreamOut(
+                                    STREAM&                         stream,
+                                    const bsl::vector<long, ALLOC>& value,
+                                    int                          /* version */)
+{
+    enum { k_BUFFER_SIZE = 256 };
+
+    const int length = static_cast<int>(value.size());
+    stream.putLength(length);
+
+    int buffer[k_BUFFER_SIZE];
+
+    for (int i = 0; i < length; i += k_BUFFER_SIZE) {
+        const int count = length - i < k_BUFFER_SIZE
+                          ? length - i
+                          : static_cast<int>(k_BUFFER_SIZE);
+
+        for (int j = 0; j < count; ++j) {
+            buffer[j] = static_cast<int>(value[i + j]);
+        }
+        stream.putArrayInt32(buffer, count);
+    }
+
+    return stream;
+}
+
+template <class STREAM, class ALLOC>
+STREAM& OutStreamFunctions::bdexStreamOut(
+                           STREAM&                                  stream,
+                           const bsl::vector<unsigned long, ALLOC>& value,
+                           int                                   /* version */)
+{
+    enum { k_BUFFER_SIZE = 256 };
+
+    const int length = static_cast<int>(value.size());
+    stream.putLength(length);
+
+    unsigned int buffer[k_BUFFER_SIZE];
+
+    for (int i = 0; i < length; i += k_BUFFER_SIZE) {
+        const int count = length - i < k_BUFFER_SIZE
+                          ? length - i
+                          : static_cast<int>(k_BUFFER_SIZE);
+
+        for (int j = 0; j < count; ++j) {
+            buffer[j] = static_cast<unsigned int>(value[i + j]);
+        }
+        stream.putArrayUint32(buffer, count);
+    }
+
+    return stream;
+}
+
 template <class STREAM, class ALLOC>
 inline
 STREAM& OutStreamFunctions::bdexStreamOut(
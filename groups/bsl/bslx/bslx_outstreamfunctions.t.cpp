@@ -1023,8 +1023,7 @@ int main(int argc, char *argv[])
             TestWithoutVersion<bool                 >::test(L_,
                                                             stream,
                                                             1,
-                                                            exp,
-                                                            false);
+                                                            exp);
 
             exp.clear();
             exp.push_back(MyTestOutStream::k_INT + 1);
@@ -1080,16 +1079,14 @@ int main(int argc, char *argv[])
             TestWithoutVersion<long                 >::test(L_,
                                                             stream,
                                                             1,
-                                                            exp,
-                                                            false);
+                                                            exp);
 
             exp.clear();
             exp.push_back(MyTestOutStream::k_UINT + 4);
             TestWithoutVersion<unsigned long        >::test(L_,
                                                             stream,
                                                             1,
-                                                            exp,
-                                                            false);
+                                                            exp);
 
             exp.clear();
             exp.push_back(MyTestOutStream::k_INT + 8);
@@ -1173,8 +1170,7 @@ int main(int argc, char *argv[])
             TestWithoutVersion<bool                 >::test(L_,
                                                             stream,
                                                             1,
-                                                            exp,
-                                                            false);
+                                                            exp);
 
             exp.clear();
             exp.push_back(MyTestOutStream::k_INT + 1);
@@ -1230,16 +1226,14 @@ int main(int argc, char *argv[])
             TestWithoutVersion<long                 >::test(L_,
                                                             stream,
                                                             1,
-                                                            exp,
-                                                            false);
+                                                            exp);
 
             exp.clear();
             exp.push_back(MyTestOutStream::k_UINT + 4);
             TestWithoutVersion<unsigned long        >::test(L_,
                                                             stream,
                                                             1,
-                                                            exp,
-                                                            false);
+                                                            exp);
 
             exp.clear();
             exp.push_back(MyTestOutStream::k_INT + 8);
@@ -1327,6 +1321,11 @@ int main(int argc, char *argv[])
         //: 3 Non-directly supported vectors are externalized correctly.
         //:
         //: 4 The version is forwarded correctly.
+        //:
+        //: 5 Vectors of 'bool', 'long', and 'unsigned long' are externalized
+        //:   using one array method invocation per conversion chunk of 256
+        //:   elements, including when the length is not a multiple of the
+        //:   chunk size.
         //
         // Plan:
         //: 1 Create a test stream object that will track invoked methods.
@@ -1343,6 +1342,10 @@ int main(int argc, char *argv[])
         //: 5 Externalize a test object which externalizes differently for
         //:   different versions and vectors of this type with different
         //:   supplied versions; verify correct method forwarding.  (C-4)
+        //:
+        //: 6 Externalize vectors of 'bool', 'long', and 'unsigned long' of
+        //:   lengths on either side of the chunk boundaries, and verify the
+        //:   number and kind of array methods invoked.  (C-5)
         //
         // Testing:
         //   bdexStreamOut(STREAM& stream, const TYPE& value, int version)
@@ -1359,7 +1362,7 @@ int main(int argc, char *argv[])
 
             exp.clear();
             exp.push_back(MyTestOutStream::k_INT + 1);
-            TestWithVersion<bool                 >::test(L_, 1, exp, false);
+            TestWithVersion<bool                 >::test(L_, 1, exp);
 
             exp.clear();
             exp.push_back(MyTestOutStream::k_INT + 1);
@@ -1391,11 +1394,11 @@ int main(int argc, char *argv[])
 
             exp.clear();
             exp.push_back(MyTestOutStream::k_INT + 4);
-            TestWithVersion<long                 >::test(L_, 1, exp, false);
+            TestWithVersion<long                 >::test(L_, 1, exp);
 
             exp.clear();
             exp.push_back(MyTestOutStream::k_UINT + 4);
-            TestWithVersion<unsigned long        >::test(L_, 1, exp, false);
+            TestWithVersion<unsigned long        >::test(L_, 1, exp);
 
             exp.clear();
             exp.push_back(MyTestOutStream::k_INT + 8);
@@ -1442,6 +1445,62 @@ int main(int argc, char *argv[])
             exp.push_back(MyTestOutStream::k_FLOAT + 8);
             TestWithVersion<MyTestClass          >::test(L_, 2, exp, false);
         }
+
+        if (verbose) cout << "\nTesting multi-chunk vectors." << endl;
+        {
+            using bslx::OutStreamFunctions::bdexStreamOut;
+
+            static const struct {
+                int d_line;       // source line number
+                int d_length;     // vector length
+                int d_numChunks;  // expected number of array invocations
+            } DATA[] = {
+                //LINE  LENGTH  CHUNKS
+                //----  ------  ------
+                { L_,      255,      1 },
+                { L_,      256,      1 },
+                { L_,      257,      2 },
+                { L_,      512,      2 },
+                { L_,     1000,      4 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE       = DATA[ti].d_line;
+                const int LENGTH     = DATA[ti].d_length;
+                const int NUM_CHUNKS = DATA[ti].d_numChunks;
+
+                const int INDICATOR[] = {
+                    MyTestOutStream::k_ARRAY + MyTestOutStream::k_INT + 1,
+                    MyTestOutStream::k_ARRAY + MyTestOutStream::k_INT + 4,
+                    MyTestOutStream::k_ARRAY + MyTestOutStream::k_UINT + 4
+                };
+
+                const bsl::vector<bool>          VA(LENGTH, true);
+                const bsl::vector<long>          VI(LENGTH, 7L);
+                const bsl::vector<unsigned long> VJ(LENGTH, 7UL);
+
+                MyTestOutStream mA(VERSION_SELECTOR);
+                MyTestOutStream mI(VERSION_SELECTOR);
+                MyTestOutStream mJ(VERSION_SELECTOR);
+
+                bdexStreamOut(mA, VA, 1);
+                bdexStreamOut(mI, VI, 1);
+                bdexStreamOut(mJ, VJ, 1);
+
+                const MyTestOutStream *STREAM[] = { &mA, &mI, &mJ };
+
+                for (int si = 0; si < 3; ++si) {
+                    const MyTestOutStream& X = *STREAM[si];
+
+                    LOOP2_ASSERT(LINE, si, NUM_CHUNKS + 1 == X.size());
+                    LOOP2_ASSERT(LINE, si, MyTestOutStream::k_LENGTH == X[0]);
+                    for (int ci = 1; ci <= NUM_CHUNKS; ++ci) {
+                        LOOP3_ASSERT(LINE, si, ci, INDICATOR[si] == X[ci]);
+                    }
+                }
+            }
+        }
       } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
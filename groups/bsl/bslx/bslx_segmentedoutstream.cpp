@@ -0,0 +1,649 @@
+// bslx_segmentedoutstream.cpp                                        -*-C++-*-
+#include <bslx_segmentedoutstream.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bslx_segmentedoutstream_cpp,"$Id$ $CSID$")
+
+#include <bslma_deallocatorproctor.h>
+
+#include <bsl_cstring.h>
+#include <bsl_iomanip.h>
+#include <bsl_ios.h>
+#include <bsl_ostream.h>
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The content of the stream is the concatenation of the closed segments in
+// 'd_segments' and of the open segment, '[d_segmentBegin_p .. d_cursor_p)',
+// which lies in the current block, 'd_blocks[d_numBlocksInUse - 1]'.  Writing
+// advances 'd_cursor_p' until it reaches 'd_blockEnd_p', at which point the
+// open segment is closed and a new one is opened at the start of the next
+// block.  Appending an external buffer closes the open segment, appends the
+// buffer as a closed segment, and leaves a new, empty open segment at the
+// cursor, so that subsequent output continues in the unused part of the
+// current block.  An empty stream has no current block, and all three
+// pointers are null.
+
+namespace BloombergLP {
+namespace bslx {
+
+                        // ------------------------
+                        // class SegmentedOutStream
+                        // ------------------------
+
+// PRIVATE MANIPULATORS
+void SegmentedOutStream::addBlock()
+{
+    BSLS_ASSERT(isValid());
+
+    // Allocate with care to ensure this stream is invalidated if an exception
+    // is thrown.
+
+    invalidate();
+
+    closeSegment();
+
+    if (d_numBlocksInUse == d_blocks.size()) {
+        char *block = static_cast<char *>(d_allocator_p->allocate(
+                                                                d_blockSize));
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(block,
+                                                            d_allocator_p);
+        d_blocks.push_back(block);
+        proctor.release();
+    }
+
+    d_segmentBegin_p = d_blocks[d_numBlocksInUse];
+    d_cursor_p       = d_segmentBegin_p;
+    d_blockEnd_p     = d_segmentBegin_p + d_blockSize;
+    ++d_numBlocksInUse;
+
+    validate();
+}
+
+template <class TYPE>
+void SegmentedOutStream::putArray(const TYPE *values,
+                                  int         numValues,
+                                  int         size,
+                                  void      (*putArrayFunction)(char *,
+                                                                const TYPE *,
+                                                                int))
+{
+    BSLS_ASSERT(isValid());
+    BSLS_ASSERT(0 <= numValues);
+    BSLS_ASSERT(0 < size && size <= 8);
+
+    while (0 < numValues) {
+        const bsl::size_t fit = (d_blockEnd_p - d_cursor_p) / size;
+
+        if (0 < fit) {
+            // Write as many values as fit in the current block.
+
+            const int n = fit < static_cast<bsl::size_t>(numValues)
+                        ? static_cast<int>(fit)
+                        : numValues;
+
+            putArrayFunction(d_cursor_p, values, n);
+            d_cursor_p += n * size;
+            values     += n;
+            numValues  -= n;
+        }
+        else {
+            // Split the next value across the current block and the next.
+
+            char bytes[8];
+            putArrayFunction(bytes, values, 1);
+            putBytes(bytes, size);
+            ++values;
+            --numValues;
+        }
+    }
+}
+
+void SegmentedOutStream::putBytes(const char *bytes, bsl::size_t numBytes)
+{
+    BSLS_ASSERT(isValid());
+
+    while (true) {
+        const bsl::size_t available = d_blockEnd_p - d_cursor_p;
+
+        if (numBytes <= available) {
+            if (0 < numBytes) {
+                bsl::memcpy(d_cursor_p, bytes, numBytes);
+                d_cursor_p += numBytes;
+            }
+            return;                                                   // RETURN
+        }
+
+        if (0 < available) {
+            bsl::memcpy(d_cursor_p, bytes, available);
+            d_cursor_p += available;
+            bytes      += available;
+            numBytes   -= available;
+        }
+
+        addBlock();
+    }
+}
+
+// CREATORS
+SegmentedOutStream::~SegmentedOutStream()
+{
+    for (bsl::size_t i = 0; i < d_blocks.size(); ++i) {
+        d_allocator_p->deallocate(d_blocks[i]);
+    }
+}
+
+// MANIPULATORS
+SegmentedOutStream& SegmentedOutStream::appendExternalBuffer(
+                                                      const char  *buffer,
+                                                      bsl::size_t  length)
+{
+    BSLS_ASSERT_SAFE(buffer || 0 == length);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid() || 0 == length)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    // Append the segment with care to ensure this stream is invalidated if an
+    // exception is thrown.
+
+    invalidate();
+
+    closeSegment();
+
+    Segment segment;
+    segment.d_data_p = buffer;
+    segment.d_length = length;
+    d_segments.push_back(segment);
+    d_closedLength += length;
+
+    validate();
+
+    return *this;
+}
+
+void SegmentedOutStream::reserveCapacity(bsl::size_t newCapacity)
+{
+    const bsl::size_t available = (d_blockEnd_p - d_cursor_p)
+                                + (d_blocks.size() - d_numBlocksInUse)
+                                                                * d_blockSize;
+
+    bsl::size_t capacity = length() + available;
+
+    if (newCapacity <= capacity) {
+        return;                                                       // RETURN
+    }
+
+    for (; capacity < newCapacity; capacity += d_blockSize) {
+        char *block = static_cast<char *>(d_allocator_p->allocate(
+                                                                d_blockSize));
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(block,
+                                                            d_allocator_p);
+        d_blocks.push_back(block);
+        proctor.release();
+    }
+
+    // Writing into the spare blocks closes one segment per block, so reserve
+    // the segment entries as well to make that output allocation-free.
+
+    d_segments.reserve(d_segments.size()
+                       + (d_blocks.size() - d_numBlocksInUse)
+                       + 1);
+}
+
+                      // *** string values ***
+
+SegmentedOutStream& SegmentedOutStream::putString(const bsl::string& value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    putLength(static_cast<int>(value.size()));
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(isValid())) {
+        putBytes(value.data(), value.size());
+    }
+
+    return *this;
+}
+
+                      // *** arrays of integer values ***
+
+SegmentedOutStream& SegmentedOutStream::putArrayInt64(
+                                           const bsls::Types::Int64 *values,
+                                           int                       numValues)
+{
+    BSLS_ASSERT_SAFE(values);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    putArray(values,
+             numValues,
+             MarshallingUtil::k_SIZEOF_INT64,
+             &MarshallingUtil::putArrayInt64);
+
+    return *this;
+}
+
+SegmentedOutStream& SegmentedOutStream::putArrayUint64(
+                                          const bsls::Types::Uint64 *values,
+                                          int                        numValues)
+{
+    BSLS_ASSERT_SAFE(values);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    putArray(values,
+             numValues,
+             MarshallingUtil::k_SIZEOF_INT64,
+             &MarshallingUtil::putArrayInt64);
+
+    return *this;
+}
+
+SegmentedOutStream& SegmentedOutStream::putArrayInt56(
+                                           const bsls::Types::Int64 *values,
+                                           int                       numValues)
+{
+    BSLS_ASSERT_SAFE(values);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    putArray(values,
+             numValues,
+             MarshallingUtil::k_SIZEOF_INT56,
+             &MarshallingUtil::putArrayInt56);
+
+    return *this;
+}
+
+SegmentedOutStream& SegmentedOutStream::putArrayUint56(
+                                          const bsls::Types::Uint64 *values,
+                                          int                        numValues)
+{
+    BSLS_ASSERT_SAFE(values);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    putArray(values,
+             numValues,
+             MarshallingUtil::k_SIZEOF_INT56,
+             &MarshallingUtil::putArrayInt56);
+
+    return *this;
+}
+
+SegmentedOutStream& SegmentedOutStream::putArrayInt48(
+                                           const bsls::Types::Int64 *values,
+                                           int                       numValues)
+{
+    BSLS_ASSERT_SAFE(values);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    putArray(values,
+             numValues,
+             MarshallingUtil::k_SIZEOF_INT48,
+             &MarshallingUtil::putArrayInt48);
+
+    return *this;
+}
+
+SegmentedOutStream& SegmentedOutStream::putArrayUint48(
+                                          const bsls::Types::Uint64 *values,
+                                          int                        numValues)
+{
+    BSLS_ASSERT_SAFE(values);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    putArray(values,
+             numValues,
+             MarshallingUtil::k_SIZEOF_INT48,
+             &MarshallingUtil::putArrayInt48);
+
+    return *this;
+}
+
+SegmentedOutStream& SegmentedOutStream::putArrayInt40(
+                                           const bsls::Types::Int64 *values,
+                                           int                       numValues)
+{
+    BSLS_ASSERT_SAFE(values);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    putArray(values,
+             numValues,
+             MarshallingUtil::k_SIZEOF_INT40,
+             &MarshallingUtil::putArrayInt40);
+
+    return *this;
+}
+
+SegmentedOutStream& SegmentedOutStream::putArrayUint40(
+                                          const bsls::Types::Uint64 *values,
+                                          int                        numValues)
+{
+    BSLS_ASSERT_SAFE(values);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    putArray(values,
+             numValues,
+             MarshallingUtil::k_SIZEOF_INT40,
+             &MarshallingUtil::putArrayInt40);
+
+    return *this;
+}
+
+SegmentedOutStream& SegmentedOutStream::putArrayInt32(const int *values,
+                                                      int        numValues)
+{
+    BSLS_ASSERT_SAFE(values);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    putArray(values,
+             numValues,
+             MarshallingUtil::k_SIZEOF_INT32,
+             &MarshallingUtil::putArrayInt32);
+
+    return *this;
+}
+
+SegmentedOutStream& SegmentedOutStream::putArrayUint32(
+                                                 const unsigned int *values,
+                                                 int                 numValues)
+{
+    BSLS_ASSERT_SAFE(values);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    putArray(values,
+             numValues,
+             MarshallingUtil::k_SIZEOF_INT32,
+             &MarshallingUtil::putArrayInt32);
+
+    return *this;
+}
+
+SegmentedOutStream& SegmentedOutStream::putArrayInt24(const int *values,
+                                                      int        numValues)
+{
+    BSLS_ASSERT_SAFE(values);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    putArray(values,
+             numValues,
+             MarshallingUtil::k_SIZEOF_INT24,
+             &MarshallingUtil::putArrayInt24);
+
+    return *this;
+}
+
+SegmentedOutStream& SegmentedOutStream::putArrayUint24(
+                                                 const unsigned int *values,
+                                                 int                 numValues)
+{
+    BSLS_ASSERT_SAFE(values);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    putArray(values,
+             numValues,
+             MarshallingUtil::k_SIZEOF_INT24,
+             &MarshallingUtil::putArrayInt24);
+
+    return *this;
+}
+
+SegmentedOutStream& SegmentedOutStream::putArrayInt16(const short *values,
+                                                      int          numValues)
+{
+    BSLS_ASSERT_SAFE(values);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    putArray(values,
+             numValues,
+             MarshallingUtil::k_SIZEOF_INT16,
+             &MarshallingUtil::putArrayInt16);
+
+    return *this;
+}
+
+SegmentedOutStream& SegmentedOutStream::putArrayUint16(
+                                               const unsigned short *values,
+                                               int                   numValues)
+{
+    BSLS_ASSERT_SAFE(values);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    putArray(values,
+             numValues,
+             MarshallingUtil::k_SIZEOF_INT16,
+             &MarshallingUtil::putArrayInt16);
+
+    return *this;
+}
+
+SegmentedOutStream& SegmentedOutStream::putArrayInt8(const char *values,
+                                                     int         numValues)
+{
+    BSLS_ASSERT_SAFE(values);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    putBytes(values, numValues);
+
+    return *this;
+}
+
+SegmentedOutStream& SegmentedOutStream::putArrayInt8(
+                                                  const signed char *values,
+                                                  int                numValues)
+{
+    BSLS_ASSERT_SAFE(values);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    putBytes(reinterpret_cast<const char *>(values), numValues);
+
+    return *this;
+}
+
+SegmentedOutStream& SegmentedOutStream::putArrayUint8(const char *values,
+                                                      int         numValues)
+{
+    BSLS_ASSERT_SAFE(values);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    putBytes(values, numValues);
+
+    return *this;
+}
+
+SegmentedOutStream& SegmentedOutStream::putArrayUint8(
+                                                const unsigned char *values,
+                                                int                  numValues)
+{
+    BSLS_ASSERT_SAFE(values);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    putBytes(reinterpret_cast<const char *>(values), numValues);
+
+    return *this;
+}
+
+                      // *** arrays of floating-point values ***
+
+SegmentedOutStream& SegmentedOutStream::putArrayFloat64(
+                                                       const double *values,
+                                                       int           numValues)
+{
+    BSLS_ASSERT_SAFE(values);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    putArray(values,
+             numValues,
+             MarshallingUtil::k_SIZEOF_FLOAT64,
+             &MarshallingUtil::putArrayFloat64);
+
+    return *this;
+}
+
+SegmentedOutStream& SegmentedOutStream::putArrayFloat32(const float *values,
+                                                        int          numValues)
+{
+    BSLS_ASSERT_SAFE(values);
+    BSLS_ASSERT_SAFE(0 <= numValues);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    putArray(values,
+             numValues,
+             MarshallingUtil::k_SIZEOF_FLOAT32,
+             &MarshallingUtil::putArrayFloat32);
+
+    return *this;
+}
+
+// FREE OPERATORS
+bsl::ostream& operator<<(bsl::ostream&             stream,
+                         const SegmentedOutStream& object)
+{
+    bsl::ios::fmtflags flags = stream.flags();
+
+    stream << bsl::hex;
+
+    bsl::size_t i = 0;
+    for (int s = 0; s < object.numSegments(); ++s) {
+        const char        *data   = object.segmentData(s);
+        const bsl::size_t  length = object.segmentLength(s);
+
+        for (bsl::size_t j = 0; j < length; ++j, ++i) {
+            if (0 < i && 0 != i % 8) {
+                stream << ' ';
+            }
+            if (0 == i % 8) {  // output newline character and address every 8
+                               // bytes
+                stream << '\n' << bsl::setw(4) << bsl::setfill('0') << i
+                       << '\t';
+            }
+
+            stream << bsl::setw(2)
+                   << bsl::setfill('0')
+                   << static_cast<int>(static_cast<unsigned char>(data[j]));
+        }
+    }
+
+    stream.flags(flags);  // reset stream format flags
+
+    return stream;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2014 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1230 @@
+// bslx_segmentedoutstream.h                                          -*-C++-*-
+#ifndef INCLUDED_BSLX_SEGMENTEDOUTSTREAM
+#define INCLUDED_BSLX_SEGMENTEDOUTSTREAM
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a segmented output stream for externalization.
+//
+//@CLASSES:
+//  bslx::SegmentedOutStream: block-chain-based output stream
+//
+//@SEE_ALSO: bslx_byteoutstream, bslx_byteinstream
+//
+//@DESCRIPTION: This component implements an output stream class,
+// 'bslx::SegmentedOutStream', that provides platform-independent output
+// methods ("externalization") on values, and arrays of values, of fundamental
+// types, and on 'bsl::string'.  The stream writes exactly the same bytes as
+// 'bslx::ByteOutStream', and its output is therefore readable by
+// 'bslx::ByteInStream'.
+//
+// Unlike 'bslx::ByteOutStream', which writes to a single contiguous buffer
+// that is reallocated (and its content copied) as it grows, a
+// 'bslx::SegmentedOutStream' writes to a chain of fixed-size blocks of memory
+// obtained from the allocator supplied at construction.  Bytes once written
+// are never moved, so the cost of writing a large message is proportional to
+// its length.  A value that does not fit in the remaining space of the
+// current block is split across it and the next one.
+//
+// The content of the stream is exposed as a sequence of *segments*, each a
+// contiguous range of bytes, whose concatenation is the content of the
+// stream.  Each segment is either a (possibly partial) block owned by the
+// stream or a buffer owned by the client and appended, without copying, by
+// 'appendExternalBuffer'.  The 'loadIovecs' method loads the segments into an
+// array of 'iovec'-like structures, which can be passed to a scatter-gather
+// output function such as 'writev' to send the content to a file or socket
+// without first copying it into a contiguous buffer.
+//
+// Since all blocks have the same size, a pool-based allocator serves them
+// efficiently.  The blocks are retained by 'reset', so that a stream reused
+// for a sequence of messages stops allocating once it has grown to the size
+// of the largest message.
+//
+// Note that the values are stored in big-endian (i.e., network byte order)
+// format.
+//
+// Note that output streams can be *invalidated* explicitly and queried for
+// *validity*.  Writing to an initially invalid stream has no effect.  Whenever
+// an output operation fails, the stream should be invalidated explicitly.
+//
+// Note that, since its content is not contiguous, this stream does not
+// provide the 'data' method of the BDEX 'OutStream' protocol; see the 'bslx'
+// package-level documentation.
+//
+///Versioning
+///----------
+// See the 'bslx_byteoutstream' component-level documentation and the 'bslx'
+// package-level documentation for a description of the 'versionSelector'
+// supplied at construction.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Scatter-Gather Output of a Message
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we send messages consisting of a small header, produced by BDEX
+// externalization, followed by a large payload that we already have in
+// memory.  A 'bslx::SegmentedOutStream' lets us send both with a single
+// scatter-gather write, without copying the payload.
+//
+// First, we define a structure having the members of the POSIX 'iovec'
+// structure, which we use in place of 'iovec' to keep this example portable:
+//..
+//  struct IoVec {
+//      void        *iov_base;
+//      bsl::size_t  iov_len;
+//  };
+//..
+// Then, we create a stream with an arbitrary value for its 'versionSelector'
+// and a block size of 64 bytes, and write the header:
+//..
+//  const char payload[] = "a payload that is sent without being copied";
+//  const int  payloadLength = static_cast<int>(sizeof payload - 1);
+//
+//  bslx::SegmentedOutStream outStream(20131127, 64);
+//  outStream.putString(bsl::string("greeting"));
+//  outStream.putInt32(7);
+//  outStream.putLength(payloadLength);
+//..
+// Next, we append the payload, and write a trailer following it:
+//..
+//  outStream.appendExternalBuffer(payload, payloadLength);
+//  outStream.putInt8('.');
+//  assert(3 == outStream.numSegments());
+//  assert(1 + 8 + 4 + 1 + payloadLength + 1 == outStream.length());
+//..
+// Now, we load the segments into an array of 'IoVec', which could be passed
+// to 'writev' if it were an array of 'iovec':
+//..
+//  IoVec     iovecs[8];
+//  const int numIovecs = outStream.loadIovecs(iovecs, 8);
+//  assert(3       == numIovecs);
+//  assert(payload == iovecs[1].iov_base);
+//..
+// Finally, we gather the segments as a 'writev' would, and verify that the
+// result is readable by 'bslx::ByteInStream' (here, we show only the bytes):
+//..
+//  bsl::string message;
+//  for (int i = 0; i < numIovecs; ++i) {
+//      message.append(static_cast<const char *>(iovecs[i].iov_base),
+//                     iovecs[i].iov_len);
+//  }
+//  assert(outStream.length() == message.size());
+//  assert(0 == bsl::memcmp(message.data(),
+//                          "\x08" "greeting" "\x00\x00\x00\x07" "\x2b",
+//                          14));
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLX_MARSHALLINGUTIL
+#include <bslx_marshallingutil.h>
+#endif
+
+#ifndef INCLUDED_BSLX_OUTSTREAMFUNCTIONS
+#include <bslx_outstreamfunctions.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_IOSFWD
+#include <bsl_iosfwd.h>
+#endif
+
+#ifndef INCLUDED_BSL_STRING
+#include <bsl_string.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+namespace BloombergLP {
+namespace bslx {
+
+                        // ========================
+                        // class SegmentedOutStream
+                        // ========================
+
+class SegmentedOutStream {
+    // This class provides output methods to externalize values, and C-style
+    // arrays of values, of the fundamental integral and floating-point types,
+    // as well as 'bsl::string' values, to a chain of fixed-size blocks of
+    // memory.  In particular, each 'put' method of this class writes the same
+    // bytes as the corresponding method of 'bslx::ByteOutStream', and is
+    // therefore guaranteed to write stream data that can be read by the
+    // corresponding 'get' method of 'bslx::ByteInStream'.  See the 'bslx'
+    // package-level documentation for the definition of the BDEX 'OutStream'
+    // protocol.
+
+    // PRIVATE TYPES
+    struct Segment {
+        // A contiguous range of the content of the stream.
+
+        const char  *d_data_p;  // address of the first byte (held, not owned)
+        bsl::size_t  d_length;  // number of bytes
+    };
+
+    // DATA
+    bsl::vector<Segment>  d_segments;         // segments preceding the open
+                                              // one, in order
+
+    bsl::vector<char *>   d_blocks;           // blocks owned by this stream
+
+    bsl::size_t           d_numBlocksInUse;   // number of leading blocks in
+                                              // 'd_blocks' holding content;
+                                              // the last one is current
+
+    char                 *d_segmentBegin_p;   // first byte of the open
+                                              // segment in the current block
+
+    char                 *d_cursor_p;         // next byte to write in the
+                                              // current block
+
+    char                 *d_blockEnd_p;       // end of the current block
+
+    bsl::size_t           d_closedLength;     // total length of 'd_segments'
+
+    bsl::size_t           d_blockSize;        // size (in bytes) of each block
+
+    int                   d_versionSelector;  // 'versionSelector' to use with
+                                              // 'operator<<' as per the
+                                              // 'bslx' package-level
+                                              // documentation
+
+    int                   d_validFlag;        // stream validity flag; 'true'
+                                              // if stream is in valid state,
+                                              // 'false' otherwise
+
+    bslma::Allocator     *d_allocator_p;      // memory allocator (held, not
+                                              // owned)
+
+    // FRIENDS
+    friend bsl::ostream& operator<<(bsl::ostream&,
+                                    const SegmentedOutStream&);
+
+    // NOT IMPLEMENTED
+    SegmentedOutStream(const SegmentedOutStream&);
+    SegmentedOutStream& operator=(const SegmentedOutStream&);
+
+  private:
+    // PRIVATE MANIPULATORS
+    void addBlock();
+        // Close the open segment and make the next block of this stream,
+        // allocating it if necessary, the current one.  If an exception is
+        // thrown, this stream is left invalid.  The behavior is undefined
+        // unless this stream is valid.
+
+    void closeSegment();
+        // If the open segment is not empty, append it to the sequence of
+        // closed segments and open a new, empty segment at the cursor.
+
+    template <class TYPE>
+    void putArray(const TYPE *values,
+                  int         numValues,
+                  int         size,
+                  void      (*putArrayFunction)(char *, const TYPE *, int));
+        // Write to this stream the specified 'numValues' leading entries in
+        // the specified 'values', each of which occupies the specified 'size'
+        // bytes in the stream, using the specified 'putArrayFunction' to
+        // format each run of values fitting in a block.  The behavior is
+        // undefined unless this stream is valid, '0 <= numValues', and
+        // '0 < size <= 8'.
+
+    void putBytes(const char *bytes, bsl::size_t numBytes);
+        // Write to this stream the specified 'numBytes' bytes at the
+        // specified 'bytes', adding blocks as needed.  The behavior is
+        // undefined unless this stream is valid.
+
+    void validate();
+        // Put this output stream into a valid state.  This function has no
+        // effect if this stream is already valid.
+
+  public:
+    // TYPES
+    enum { k_DEFAULT_BLOCK_SIZE = 16384 };
+        // The size (in bytes) of the blocks of a stream for which no block
+        // size is specified at construction.
+
+    // CREATORS
+    explicit SegmentedOutStream(int               versionSelector,
+                                bslma::Allocator *basicAllocator = 0);
+        // Create an empty output stream that will use the specified
+        // (*compile*-time-defined) 'versionSelector' as needed (see
+        // {Versioning}) and allocate blocks of 'k_DEFAULT_BLOCK_SIZE' bytes.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  Note that the 'versionSelector' is expected to be formatted
+        // as "YYYYMMDD", a date representation.
+
+    SegmentedOutStream(int               versionSelector,
+                       bsl::size_t       blockSize,
+                       bslma::Allocator *basicAllocator = 0);
+        // Create an empty output stream that will use the specified
+        // (*compile*-time-defined) 'versionSelector' as needed (see
+        // {Versioning}) and allocate blocks of the specified 'blockSize'
+        // bytes.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '0 < blockSize'.  Note that the 'versionSelector' is expected to be
+        // formatted as "YYYYMMDD", a date representation.
+
+    ~SegmentedOutStream();
+        // Destroy this object, releasing the blocks of memory it owns.
+
+    // MANIPULATORS
+    SegmentedOutStream& appendExternalBuffer(const char  *buffer,
+                                             bsl::size_t  length);
+        // Append to this stream, as a segment of its own and without copying,
+        // the specified 'length' bytes at the specified 'buffer', and return a
+        // reference to this stream.  Subsequent output is written to a new
+        // segment following that one.  If this stream is initially invalid,
+        // or if 'length' is 0, this operation has no effect.  The behavior is
+        // undefined unless the 'length' bytes at 'buffer' remain valid and
+        // unmodified until this stream is reset or destroyed.  Note that the
+        // appended bytes are not formatted in any way; it is the caller's
+        // responsibility to ensure that the result is readable by the
+        // intended input stream (e.g., by first writing the length of the
+        // buffer with 'putLength').
+
+    void invalidate();
+        // Put this output stream in an invalid state.  This function has no
+        // effect if this stream is already invalid.
+
+    SegmentedOutStream& putLength(int length);
+        // If the specified 'length' is less than 128, write to this stream the
+        // one-byte integer comprised of the least-significant one byte of the
+        // 'length'; otherwise, write to this stream the four-byte, two's
+        // complement integer (in network byte order) comprised of the
+        // least-significant four bytes of the 'length' (in host byte order)
+        // with the most-significant bit set.  Return a reference to this
+        // stream.  If this stream is initially invalid, this operation has no
+        // effect.  The behavior is undefined unless '0 <= length'.
+
+    SegmentedOutStream& putVersion(int version);
+        // Write to this stream the one-byte, two's complement unsigned integer
+        // comprised of the least-significant one byte of the specified
+        // 'version', and return a reference to this stream.  If this stream is
+        // initially invalid, this operation has no effect.
+
+    void reserveCapacity(bsl::size_t newCapacity);
+        // Allocate memory as needed so that the length of this stream plus
+        // the number of bytes that can be written to it without allocating is
+        // at least the specified 'newCapacity' (in bytes).  Note that
+        // 'appendExternalBuffer' may allocate regardless.
+
+    void reset();
+        // Remove all content in this stream and validate this stream if it is
+        // currently invalid.  The blocks of memory owned by this stream are
+        // retained for reuse by subsequent output.
+
+                      // *** scalar integer values ***
+
+    SegmentedOutStream& putInt64(bsls::Types::Int64 value);
+        // Write to this stream the eight-byte, two's complement integer (in
+        // network byte order) comprised of the least-significant eight bytes
+        // of the specified 'value' (in host byte order), and return a
+        // reference to this stream.  If this stream is initially invalid, this
+        // operation has no effect.
+
+    SegmentedOutStream& putUint64(bsls::Types::Uint64 value);
+        // Write to this stream the eight-byte, two's complement unsigned
+        // integer (in network byte order) comprised of the least-significant
+        // eight bytes of the specified 'value' (in host byte order), and
+        // return a reference to this stream.  If this stream is initially
+        // invalid, this operation has no effect.
+
+    SegmentedOutStream& putInt56(bsls::Types::Int64 value);
+        // Write to this stream the seven-byte, two's complement integer (in
+        // network byte order) comprised of the least-significant seven bytes
+        // of the specified 'value' (in host byte order), and return a
+        // reference to this stream.  If this stream is initially invalid, this
+        // operation has no effect.
+
+    SegmentedOutStream& putUint56(bsls::Types::Uint64 value);
+        // Write to this stream the seven-byte, two's complement unsigned
+        // integer (in network byte order) comprised of the least-significant
+        // seven bytes of the specified 'value' (in host byte order), and
+        // return a reference to this stream.  If this stream is initially
+        // invalid, this operation has no effect.
+
+    SegmentedOutStream& putInt48(bsls::Types::Int64 value);
+        // Write to this stream the six-byte, two's complement integer (in
+        // network byte order) comprised of the least-significant six bytes of
+        // the specified 'value' (in host byte order), and return a reference
+        // to this stream.  If this stream is initially invalid, this operation
+        // has no effect.
+
+    SegmentedOutStream& putUint48(bsls::Types::Uint64 value);
+        // Write to this stream the six-byte, two's complement unsigned integer
+        // (in network byte order) comprised of the least-significant six bytes
+        // of the specified 'value' (in host byte order), and return a
+        // reference to this stream.  If this stream is initially invalid, this
+        // operation has no effect.
+
+    SegmentedOutStream& putInt40(bsls::Types::Int64 value);
+        // Write to this stream the five-byte, two's complement integer (in
+        // network byte order) comprised of the least-significant five bytes of
+        // the specified 'value' (in host byte order), and return a reference
+        // to this stream.  If this stream is initially invalid, this operation
+        // has no effect.
+
+    SegmentedOutStream& putUint40(bsls::Types::Uint64 value);
+        // Write to this stream the five-byte, two's complement unsigned
+        // integer (in network byte order) comprised of the least-significant
+        // five bytes of the specified 'value' (in host byte order), and return
+        // a reference to this stream.  If this stream is initially invalid,
+        // this operation has no effect.
+
+    SegmentedOutStream& putInt32(int value);
+        // Write to this stream the four-byte, two's complement integer (in
+        // network byte order) comprised of the least-significant four bytes of
+        // the specified 'value' (in host byte order), and return a reference
+        // to this stream.  If this stream is initially invalid, this operation
+        // has no effect.
+
+    SegmentedOutStream& putUint32(unsigned int value);
+        // Write to this stream the four-byte, two's complement unsigned
+        // integer (in network byte order) comprised of the least-significant
+        // four bytes of the specified 'value' (in host byte order), and return
+        // a reference to this stream.  If this stream is initially invalid,
+        // this operation has no effect.
+
+    SegmentedOutStream& putInt24(int value);
+        // Write to this stream the three-byte, two's complement integer (in
+        // network byte order) comprised of the least-significant three bytes
+        // of the specified 'value' (in host byte order), and return a
+        // reference to this stream.  If this stream is initially invalid, this
+        // operation has no effect.
+
+    SegmentedOutStream& putUint24(unsigned int value);
+        // Write to this stream the three-byte, two's complement unsigned
+        // integer (in network byte order) comprised of the least-significant
+        // three bytes of the specified 'value' (in host byte order), and
+        // return a reference to this stream.  If this stream is initially
+        // invalid, this operation has no effect.
+
+    SegmentedOutStream& putInt16(int value);
+        // Write to this stream the two-byte, two's complement integer (in
+        // network byte order) comprised of the least-significant two bytes of
+        // the specified 'value' (in host byte order), and return a reference
+        // to this stream.  If this stream is initially invalid, this operation
+        // has no effect.
+
+    SegmentedOutStream& putUint16(unsigned int value);
+        // Write to this stream the two-byte, two's complement unsigned integer
+        // (in network byte order) comprised of the least-significant two bytes
+        // of the specified 'value' (in host byte order), and return a
+        // reference to this stream.  If this stream is initially invalid, this
+        // operation has no effect.
+
+    SegmentedOutStream& putInt8(int value);
+        // Write to this stream the one-byte, two's complement integer
+        // comprised of the least-significant one byte of the specified
+        // 'value', and return a reference to this stream.  If this stream is
+        // initially invalid, this operation has no effect.
+
+    SegmentedOutStream& putUint8(unsigned int value);
+        // Write to this stream the one-byte, two's complement unsigned integer
+        // comprised of the least-significant one byte of the specified
+        // 'value', and return a reference to this stream.  If this stream is
+        // initially invalid, this operation has no effect.
+
+                      // *** scalar floating-point values ***
+
+    SegmentedOutStream& putFloat64(double value);
+        // Write to this stream the eight-byte IEEE double-precision
+        // floating-point number (in network byte order) comprised of the
+        // most-significant eight bytes of the specified 'value' (in host byte
+        // order), and return a reference to this stream.  If this stream is
+        // initially invalid, this operation has no effect.  Note that for
+        // non-conforming platforms, this operation may be lossy.
+
+    SegmentedOutStream& putFloat32(float value);
+        // Write to this stream the four-byte IEEE single-precision
+        // floating-point number (in network byte order) comprised of the
+        // most-significant four bytes of the specified 'value' (in host byte
+        // order), and return a reference to this stream.  If this stream is
+        // initially invalid, this operation has no effect.  Note that for
+        // non-conforming platforms, this operation may be lossy.
+
+                      // *** string values ***
+
+    SegmentedOutStream& putString(const bsl::string& value);
+        // Write to this stream the length of the specified 'value' (see
+        // 'putLength') and an array of one-byte, two's complement unsigned
+        // integers comprised of the least-significant one byte of each
+        // character in the 'value', and return a reference to this stream.  If
+        // this stream is initially invalid, this operation has no effect.
+
+                      // *** arrays of integer values ***
+
+    SegmentedOutStream& putArrayInt64(const bsls::Types::Int64 *values,
+                                      int                       numValues);
+        // Write to this stream the consecutive eight-byte, two's complement
+        // integers (in network byte order) comprised of the least-significant
+        // eight bytes of each of the specified 'numValues' leading entries in
+        // the specified 'values' (in host byte order), and return a reference
+        // to this stream.  If this stream is initially invalid, this operation
+        // has no effect.  The behavior is undefined unless '0 <= numValues'
+        // and 'values' has sufficient contents.
+
+    SegmentedOutStream& putArrayUint64(const bsls::Types::Uint64 *values,
+                                       int                        numValues);
+        // Write to this stream the consecutive eight-byte, two's complement
+        // unsigned integers (in network byte order) comprised of the
+        // least-significant eight bytes of each of the specified 'numValues'
+        // leading entries in the specified 'values' (in host byte order), and
+        // return a reference to this stream.  If this stream is initially
+        // invalid, this operation has no effect.  The behavior is undefined
+        // unless '0 <= numValues' and 'values' has sufficient contents.
+
+    SegmentedOutStream& putArrayInt56(const bsls::Types::Int64 *values,
+                                      int                       numValues);
+        // Write to this stream the consecutive seven-byte, two's complement
+        // integers (in network byte order) comprised of the least-significant
+        // seven bytes of each of the specified 'numValues' leading entries in
+        // the specified 'values' (in host byte order), and return a reference
+        // to this stream.  If this stream is initially invalid, this operation
+        // has no effect.  The behavior is undefined unless '0 <= numValues'
+        // and 'values' has sufficient contents.
+
+    SegmentedOutStream& putArrayUint56(const bsls::Types::Uint64 *values,
+                                       int                        numValues);
+        // Write to this stream the consecutive seven-byte, two's complement
+        // unsigned integers (in network byte order) comprised of the
+        // least-significant seven bytes of each of the specified 'numValues'
+        // leading entries in the specified 'values' (in host byte order), and
+        // return a reference to this stream.  If this stream is initially
+        // invalid, this operation has no effect.  The behavior is undefined
+        // unless '0 <= numValues' and 'values' has sufficient contents.
+
+    SegmentedOutStream& putArrayInt48(const bsls::Types::Int64 *values,
+                                      int                       numValues);
+        // Write to this stream the consecutive six-byte, two's complement
+        // integers (in network byte order) comprised of the least-significant
+        // six bytes of each of the specified 'numValues' leading entries in
+        // the specified 'values' (in host byte order), and return a reference
+        // to this stream.  If this stream is initially invalid, this operation
+        // has no effect.  The behavior is undefined unless '0 <= numValues'
+        // and 'values' has sufficient contents.
+
+    SegmentedOutStream& putArrayUint48(const bsls::Types::Uint64 *values,
+                                       int                        numValues);
+        // Write to this stream the consecutive six-byte, two's complement
+        // unsigned integers (in network byte order) comprised of the
+        // least-significant six bytes of each of the specified 'numValues'
+        // leading entries in the specified 'values' (in host byte order), and
+        // return a reference to this stream.  If this stream is initially
+        // invalid, this operation has no effect.  The behavior is undefined
+        // unless '0 <= numValues' and 'values' has sufficient contents.
+
+    SegmentedOutStream& putArrayInt40(const bsls::Types::Int64 *values,
+                                      int                       numValues);
+        // Write to this stream the consecutive five-byte, two's complement
+        // integers (in network byte order) comprised of the least-significant
+        // five bytes of each of the specified 'numValues' leading entries in
+        // the specified 'values' (in host byte order), and return a reference
+        // to this stream.  If this stream is initially invalid, this operation
+        // has no effect.  The behavior is undefined unless '0 <= numValues'
+        // and 'values' has sufficient contents.
+
+    SegmentedOutStream& putArrayUint40(const bsls::Types::Uint64 *values,
+                                       int                        numValues);
+        // Write to this stream the consecutive five-byte, two's complement
+        // unsigned integers (in network byte order) comprised of the
+        // least-significant five bytes of each of the specified 'numValues'
+        // leading entries in the specified 'values' (in host byte order), and
+        // return a reference to this stream.  If this stream is initially
+        // invalid, this operation has no effect.  The behavior is undefined
+        // unless '0 <= numValues' and 'values' has sufficient contents.
+
+    SegmentedOutStream& putArrayInt32(const int *values, int numValues);
+        // Write to this stream the consecutive four-byte, two's complement
+        // integers (in network byte order) comprised of the least-significant
+        // four bytes of each of the specified 'numValues' leading entries in
+        // the specified 'values' (in host byte order), and return a reference
+        // to this stream.  If this stream is initially invalid, this operation
+        // has no effect.  The behavior is undefined unless '0 <= numValues'
+        // and 'values' has sufficient contents.
+
+    SegmentedOutStream& putArrayUint32(const unsigned int *values,
+                                       int                 numValues);
+        // Write to this stream the consecutive four-byte, two's complement
+        // unsigned integers (in network byte order) comprised of the
+        // least-significant four bytes of each of the specified 'numValues'
+        // leading entries in the specified 'values' (in host byte order), and
+        // return a reference to this stream.  If this stream is initially
+        // invalid, this operation has no effect.  The behavior is undefined
+        // unless '0 <= numValues' and 'values' has sufficient contents.
+
+    SegmentedOutStream& putArrayInt24(const int *values, int numValues);
+        // Write to this stream the consecutive three-byte, two's complement
+        // integers (in network byte order) comprised of the least-significant
+        // three bytes of each of the specified 'numValues' leading entries in
+        // the specified 'values' (in host byte order), and return a reference
+        // to this stream.  If this stream is initially invalid, this operation
+        // has no effect.  The behavior is undefined unless '0 <= numValues'
+        // and 'values' has sufficient contents.
+
+    SegmentedOutStream& putArrayUint24(const unsigned int *values,
+                                       int                 numValues);
+        // Write to this stream the consecutive three-byte, two's complement
+        // unsigned integers (in network byte order) comprised of the
+        // least-significant three bytes of each of the specified 'numValues'
+        // leading entries in the specified 'values' (in host byte order), and
+        // return a reference to this stream.  If this stream is initially
+        // invalid, this operation has no effect.  The behavior is undefined
+        // unless '0 <= numValues' and 'values' has sufficient contents.
+
+    SegmentedOutStream& putArrayInt16(const short *values, int numValues);
+        // Write to this stream the consecutive two-byte, two's complement
+        // integers (in network byte order) comprised of the least-significant
+        // two bytes of each of the specified 'numValues' leading entries in
+        // the specified 'values' (in host byte order), and return a reference
+        // to this stream.  If this stream is initially invalid, this operation
+        // has no effect.  The behavior is undefined unless '0 <= numValues'
+        // and 'values' has sufficient contents.
+
+    SegmentedOutStream& putArrayUint16(const unsigned short *values,
+                                       int                   numValues);
+        // Write to this stream the consecutive two-byte, two's complement
+        // unsigned integers (in network byte order) comprised of the
+        // least-significant two bytes of each of the specified 'numValues'
+        // leading entries in the specified 'values' (in host byte order), and
+        // return a reference to this stream.  If this stream is initially
+        // invalid, this operation has no effect.  The behavior is undefined
+        // unless '0 <= numValues' and 'values' has sufficient contents.
+
+    SegmentedOutStream& putArrayInt8(const char        *values, int numValues);
+    SegmentedOutStream& putArrayInt8(const signed char *values, int numValues);
+        // Write to this stream the consecutive one-byte, two's complement
+        // integers comprised of the least-significant one byte of each of the
+        // specified 'numValues' leading entries in the specified 'values', and
+        // return a reference to this stream.  If this stream is initially
+        // invalid, this operation has no effect.  The behavior is undefined
+        // unless '0 <= numValues' and 'values' has sufficient contents.
+
+    SegmentedOutStream& putArrayUint8(const char          *values,
+                                      int                  numValues);
+    SegmentedOutStream& putArrayUint8(const unsigned char *values,
+                                      int                  numValues);
+        // Write to this stream the consecutive one-byte, two's complement
+        // unsigned integers comprised of the least-significant one byte of
+        // each of the specified 'numValues' leading entries in the specified
+        // 'values', and return a reference to this stream.  If this stream is
+        // initially invalid, this operation has no effect.  The behavior is
+        // undefined unless '0 <= numValues' and 'values' has sufficient
+        // contents.
+
+                      // *** arrays of floating-point values ***
+
+    SegmentedOutStream& putArrayFloat64(const double *values, int numValues);
+        // Write to this stream the consecutive eight-byte IEEE
+        // double-precision floating-point numbers (in network byte order)
+        // comprised of the most-significant eight bytes of each of the
+        // specified 'numValues' leading entries in the specified 'values' (in
+        // host byte order), and return a reference to this stream.  If this
+        // stream is initially invalid, this operation has no effect.  The
+        // behavior is undefined unless '0 <= numValues' and 'values' has
+        // sufficient contents.  Note that for non-conforming platforms, this
+        // operation may be lossy.
+
+    SegmentedOutStream& putArrayFloat32(const float *values, int numValues);
+        // Write to this stream the consecutive four-byte IEEE single-precision
+        // floating-point numbers (in network byte order) comprised of the
+        // most-significant four bytes of each of the specified 'numValues'
+        // leading entries in the specified 'values' (in host byte order), and
+        // return a reference to this stream.  If this stream is initially
+        // invalid, this operation has no effect.  The behavior is undefined
+        // unless '0 <= numValues' and 'values' has sufficient contents.  Note
+        // that for non-conforming platforms, this operation may be lossy.
+
+    // ACCESSORS
+    operator const void *() const;
+        // Return a non-zero value if this stream is valid, and 0 otherwise.
+        // An invalid stream is a stream for which an output operation was
+        // detected to have failed or 'invalidate' was called.
+
+    int bdexVersionSelector() const;
+        // Return the 'versionSelector' to be used with 'operator<<' for BDEX
+        // streaming as per the 'bslx' package-level documentation.
+
+    bsl::size_t blockSize() const;
+        // Return the size (in bytes) of the blocks of memory allocated by this
+        // stream.
+
+    bool isValid() const;
+        // Return 'true' if this stream is valid, and 'false' otherwise.  An
+        // invalid stream is a stream for which an output operation was
+        // detected to have failed or 'invalidate' was called.
+
+    bsl::size_t length() const;
+        // Return the number of bytes in this stream.
+
+    template <class IOVEC>
+    int loadIovecs(IOVEC *iovecs,
+                   int    maxNumIovecs,
+                   int    firstSegment = 0) const;
+        // Load into consecutive elements of the specified 'iovecs' array the
+        // address and length of each segment of this stream, in order,
+        // starting with the segment at the optionally specified
+        // 'firstSegment' index and loading at most the specified
+        // 'maxNumIovecs' elements, and return the number of elements loaded.
+        // If 'firstSegment' is not specified, the first segment is used.
+        // Each element is loaded by assigning the address of the first byte
+        // of the segment (cast to 'void *') to its 'iov_base' member, and the
+        // length of the segment to its 'iov_len' member; the POSIX 'iovec'
+        // structure, for use with 'writev', satisfies these requirements.
+        // The addresses remain valid as long as this stream is not destroyed
+        // or reset, and the bytes they refer to must not be modified.  The
+        // behavior is undefined unless '0 <= maxNumIovecs',
+        // '0 <= firstSegment <= numSegments()', and 'iovecs' has at least
+        // 'maxNumIovecs' elements.
+
+    int numSegments() const;
+        // Return the number of segments of this stream.  Note that every
+        // segment is non-empty, and an empty stream has no segments.
+
+    const char *segmentData(int index) const;
+        // Return the address of the first byte of the segment at the
+        // specified 'index' of this stream.  The address remains valid as
+        // long as this stream is not destroyed or reset.  The behavior is
+        // undefined unless '0 <= index < numSegments()'.
+
+    bsl::size_t segmentLength(int index) const;
+        // Return the number of bytes in the segment at the specified 'index'
+        // of this stream.  The behavior is undefined unless
+        // '0 <= index < numSegments()'.
+};
+
+// FREE OPERATORS
+bsl::ostream& operator<<(bsl::ostream&             stream,
+                         const SegmentedOutStream& object);
+    // Write the specified 'object' to the specified output 'stream' in some
+    // reasonable (multi-line) format, and return a reference to 'stream'.
+
+template <class TYPE>
+SegmentedOutStream& operator<<(SegmentedOutStream& stream, const TYPE& value);
+    // Write the specified 'value' to the specified output 'stream' following
+    // the requirements of the BDEX protocol (see the 'bslx' package-level
+    // documentation), and return a reference to 'stream'.  The behavior is
+    // undefined unless 'TYPE' is BDEX-compliant.
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                        // ------------------------
+                        // class SegmentedOutStream
+                        // ------------------------
+
+// PRIVATE MANIPULATORS
+inline
+void SegmentedOutStream::closeSegment()
+{
+    if (d_cursor_p != d_segmentBegin_p) {
+        Segment segment;
+        segment.d_data_p = d_segmentBegin_p;
+        segment.d_length = d_cursor_p - d_segmentBegin_p;
+        d_segments.push_back(segment);
+        d_closedLength   += segment.d_length;
+        d_segmentBegin_p  = d_cursor_p;
+    }
+}
+
+inline
+void SegmentedOutStream::validate()
+{
+    d_validFlag = true;
+}
+
+// CREATORS
+inline
+SegmentedOutStream::SegmentedOutStream(int               versionSelector,
+                                       bslma::Allocator *basicAllocator)
+: d_segments(basicAllocator)
+, d_blocks(basicAllocator)
+, d_numBlocksInUse(0)
+, d_segmentBegin_p(0)
+, d_cursor_p(0)
+, d_blockEnd_p(0)
+, d_closedLength(0)
+, d_blockSize(k_DEFAULT_BLOCK_SIZE)
+, d_versionSelector(versionSelector)
+, d_validFlag(true)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+inline
+SegmentedOutStream::SegmentedOutStream(int               versionSelector,
+                                       bsl::size_t       blockSize,
+                                       bslma::Allocator *basicAllocator)
+: d_segments(basicAllocator)
+, d_blocks(basicAllocator)
+, d_numBlocksInUse(0)
+, d_segmentBegin_p(0)
+, d_cursor_p(0)
+, d_blockEnd_p(0)
+, d_closedLength(0)
+, d_blockSize(blockSize)
+, d_versionSelector(versionSelector)
+, d_validFlag(true)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_SAFE(0 < blockSize);
+}
+
+// MANIPULATORS
+inline
+void SegmentedOutStream::invalidate()
+{
+    d_validFlag = false;
+}
+
+inline
+SegmentedOutStream& SegmentedOutStream::putLength(int length)
+{
+    BSLS_ASSERT_SAFE(0 <= length);
+
+    if (length > 127) {
+        putInt32(length | (1 << 31));
+    } else {
+        putInt8(length);
+    }
+    return *this;
+}
+
+inline
+SegmentedOutStream& SegmentedOutStream::putVersion(int version)
+{
+    return putUint8(version);
+}
+
+inline
+void SegmentedOutStream::reset()
+{
+    d_segments.clear();
+    d_numBlocksInUse = 0;
+    d_segmentBegin_p = 0;
+    d_cursor_p       = 0;
+    d_blockEnd_p     = 0;
+    d_closedLength   = 0;
+    validate();
+}
+
+                      // *** scalar integer values ***
+
+inline
+SegmentedOutStream& SegmentedOutStream::putInt64(bsls::Types::Int64 value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+               d_blockEnd_p - d_cursor_p >= MarshallingUtil::k_SIZEOF_INT64)) {
+        MarshallingUtil::putInt64(d_cursor_p, value);
+        d_cursor_p += MarshallingUtil::k_SIZEOF_INT64;
+    }
+    else {
+        char bytes[MarshallingUtil::k_SIZEOF_INT64];
+        MarshallingUtil::putInt64(bytes, value);
+        putBytes(bytes, MarshallingUtil::k_SIZEOF_INT64);
+    }
+    return *this;
+}
+
+inline
+SegmentedOutStream& SegmentedOutStream::putUint64(bsls::Types::Uint64 value)
+{
+    return putInt64(static_cast<bsls::Types::Int64>(value));
+}
+
+inline
+SegmentedOutStream& SegmentedOutStream::putInt56(bsls::Types::Int64 value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+               d_blockEnd_p - d_cursor_p >= MarshallingUtil::k_SIZEOF_INT56)) {
+        MarshallingUtil::putInt56(d_cursor_p, value);
+        d_cursor_p += MarshallingUtil::k_SIZEOF_INT56;
+    }
+    else {
+        char bytes[MarshallingUtil::k_SIZEOF_INT56];
+        MarshallingUtil::putInt56(bytes, value);
+        putBytes(bytes, MarshallingUtil::k_SIZEOF_INT56);
+    }
+    return *this;
+}
+
+inline
+SegmentedOutStream& SegmentedOutStream::putUint56(bsls::Types::Uint64 value)
+{
+    return putInt56(static_cast<bsls::Types::Int64>(value));
+}
+
+inline
+SegmentedOutStream& SegmentedOutStream::putInt48(bsls::Types::Int64 value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+               d_blockEnd_p - d_cursor_p >= MarshallingUtil::k_SIZEOF_INT48)) {
+        MarshallingUtil::putInt48(d_cursor_p, value);
+        d_cursor_p += MarshallingUtil::k_SIZEOF_INT48;
+    }
+    else {
+        char bytes[MarshallingUtil::k_SIZEOF_INT48];
+        MarshallingUtil::putInt48(bytes, value);
+        putBytes(bytes, MarshallingUtil::k_SIZEOF_INT48);
+    }
+    return *this;
+}
+
+inline
+SegmentedOutStream& SegmentedOutStream::putUint48(bsls::Types::Uint64 value)
+{
+    return putInt48(static_cast<bsls::Types::Int64>(value));
+}
+
+inline
+SegmentedOutStream& SegmentedOutStream::putInt40(bsls::Types::Int64 value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+               d_blockEnd_p - d_cursor_p >= MarshallingUtil::k_SIZEOF_INT40)) {
+        MarshallingUtil::putInt40(d_cursor_p, value);
+        d_cursor_p += MarshallingUtil::k_SIZEOF_INT40;
+    }
+    else {
+        char bytes[MarshallingUtil::k_SIZEOF_INT40];
+        MarshallingUtil::putInt40(bytes, value);
+        putBytes(bytes, MarshallingUtil::k_SIZEOF_INT40);
+    }
+    return *this;
+}
+
+inline
+SegmentedOutStream& SegmentedOutStream::putUint40(bsls::Types::Uint64 value)
+{
+    return putInt40(static_cast<bsls::Types::Int64>(value));
+}
+
+inline
+SegmentedOutStream& SegmentedOutStream::putInt32(int value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+               d_blockEnd_p - d_cursor_p >= MarshallingUtil::k_SIZEOF_INT32)) {
+        MarshallingUtil::putInt32(d_cursor_p, value);
+        d_cursor_p += MarshallingUtil::k_SIZEOF_INT32;
+    }
+    else {
+        char bytes[MarshallingUtil::k_SIZEOF_INT32];
+        MarshallingUtil::putInt32(bytes, value);
+        putBytes(bytes, MarshallingUtil::k_SIZEOF_INT32);
+    }
+    return *this;
+}
+
+inline
+SegmentedOutStream& SegmentedOutStream::putUint32(unsigned int value)
+{
+    return putInt32(static_cast<int>(value));
+}
+
+inline
+SegmentedOutStream& SegmentedOutStream::putInt24(int value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+               d_blockEnd_p - d_cursor_p >= MarshallingUtil::k_SIZEOF_INT24)) {
+        MarshallingUtil::putInt24(d_cursor_p, value);
+        d_cursor_p += MarshallingUtil::k_SIZEOF_INT24;
+    }
+    else {
+        char bytes[MarshallingUtil::k_SIZEOF_INT24];
+        MarshallingUtil::putInt24(bytes, value);
+        putBytes(bytes, MarshallingUtil::k_SIZEOF_INT24);
+    }
+    return *this;
+}
+
+inline
+SegmentedOutStream& SegmentedOutStream::putUint24(unsigned int value)
+{
+    return putInt24(static_cast<int>(value));
+}
+
+inline
+SegmentedOutStream& SegmentedOutStream::putInt16(int value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+               d_blockEnd_p - d_cursor_p >= MarshallingUtil::k_SIZEOF_INT16)) {
+        MarshallingUtil::putInt16(d_cursor_p, value);
+        d_cursor_p += MarshallingUtil::k_SIZEOF_INT16;
+    }
+    else {
+        char bytes[MarshallingUtil::k_SIZEOF_INT16];
+        MarshallingUtil::putInt16(bytes, value);
+        putBytes(bytes, MarshallingUtil::k_SIZEOF_INT16);
+    }
+    return *this;
+}
+
+inline
+SegmentedOutStream& SegmentedOutStream::putUint16(unsigned int value)
+{
+    return putInt16(static_cast<int>(value));
+}
+
+inline
+SegmentedOutStream& SegmentedOutStream::putInt8(int value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                d_blockEnd_p - d_cursor_p >= MarshallingUtil::k_SIZEOF_INT8)) {
+        MarshallingUtil::putInt8(d_cursor_p, value);
+        d_cursor_p += MarshallingUtil::k_SIZEOF_INT8;
+    }
+    else {
+        char bytes[MarshallingUtil::k_SIZEOF_INT8];
+        MarshallingUtil::putInt8(bytes, value);
+        putBytes(bytes, MarshallingUtil::k_SIZEOF_INT8);
+    }
+    return *this;
+}
+
+inline
+SegmentedOutStream& SegmentedOutStream::putUint8(unsigned int value)
+{
+    return putInt8(static_cast<int>(value));
+}
+
+                      // *** scalar floating-point values ***
+
+inline
+SegmentedOutStream& SegmentedOutStream::putFloat64(double value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+             d_blockEnd_p - d_cursor_p >= MarshallingUtil::k_SIZEOF_FLOAT64)) {
+        MarshallingUtil::putFloat64(d_cursor_p, value);
+        d_cursor_p += MarshallingUtil::k_SIZEOF_FLOAT64;
+    }
+    else {
+        char bytes[MarshallingUtil::k_SIZEOF_FLOAT64];
+        MarshallingUtil::putFloat64(bytes, value);
+        putBytes(bytes, MarshallingUtil::k_SIZEOF_FLOAT64);
+    }
+    return *this;
+}
+
+inline
+SegmentedOutStream& SegmentedOutStream::putFloat32(float value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!isValid())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return *this;                                                 // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+             d_blockEnd_p - d_cursor_p >= MarshallingUtil::k_SIZEOF_FLOAT32)) {
+        MarshallingUtil::putFloat32(d_cursor_p, value);
+        d_cursor_p += MarshallingUtil::k_SIZEOF_FLOAT32;
+    }
+    else {
+        char bytes[MarshallingUtil::k_SIZEOF_FLOAT32];
+        MarshallingUtil::putFloat32(bytes, value);
+        putBytes(bytes, MarshallingUtil::k_SIZEOF_FLOAT32);
+    }
+    return *this;
+}
+
+// ACCESSORS
+inline
+SegmentedOutStream::operator const void *() const
+{
+    return isValid() ? this : 0;
+}
+
+inline
+int SegmentedOutStream::bdexVersionSelector() const
+{
+    return d_versionSelector;
+}
+
+inline
+bsl::size_t SegmentedOutStream::blockSize() const
+{
+    return d_blockSize;
+}
+
+inline
+bool SegmentedOutStream::isValid() const
+{
+    return d_validFlag;
+}
+
+inline
+bsl::size_t SegmentedOutStream::length() const
+{
+    return d_closedLength + (d_cursor_p - d_segmentBegin_p);
+}
+
+template <class IOVEC>
+int SegmentedOutStream::loadIovecs(IOVEC *iovecs,
+                                   int    maxNumIovecs,
+                                   int    firstSegment) const
+{
+    BSLS_ASSERT_SAFE(iovecs || 0 == maxNumIovecs);
+    BSLS_ASSERT_SAFE(0 <= maxNumIovecs);
+    BSLS_ASSERT_SAFE(0 <= firstSegment);
+    BSLS_ASSERT_SAFE(firstSegment <= numSegments());
+
+    const int numLoaded = numSegments() - firstSegment < maxNumIovecs
+                        ? numSegments() - firstSegment
+                        : maxNumIovecs;
+
+    for (int i = 0; i < numLoaded; ++i) {
+        iovecs[i].iov_base = const_cast<char *>(
+                                              segmentData(firstSegment + i));
+        iovecs[i].iov_len  = segmentLength(firstSegment + i);
+    }
+    return numLoaded;
+}
+
+inline
+int SegmentedOutStream::numSegments() const
+{
+    return static_cast<int>(d_segments.size())
+         + (d_cursor_p != d_segmentBegin_p ? 1 : 0);
+}
+
+inline
+const char *SegmentedOutStream::segmentData(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < numSegments());
+
+    return static_cast<bsl::size_t>(index) < d_segments.size()
+           ? d_segments[index].d_data_p
+           : d_segmentBegin_p;
+}
+
+inline
+bsl::size_t SegmentedOutStream::segmentLength(int index) const
+{
+    BSLS_ASSERT_SAFE(0 <= index);
+    BSLS_ASSERT_SAFE(index < numSegments());
+
+    return static_cast<bsl::size_t>(index) < d_segments.size()
+           ? d_segments[index].d_length
+           : static_cast<bsl::size_t>(d_cursor_p - d_segmentBegin_p);
+}
+
+// FREE OPERATORS
+template <class TYPE>
+inline
+SegmentedOutStream& operator<<(SegmentedOutStream& stream, const TYPE& value)
+{
+    return OutStreamFunctions::bdexStreamOut(stream, value);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// TRAITS
+namespace BloombergLP {
+namespace bslma {
+
+template <>
+struct UsesBslmaAllocator<bslx::SegmentedOutStream> : bsl::true_type {};
+
+}  // close 'bslma' namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2014 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
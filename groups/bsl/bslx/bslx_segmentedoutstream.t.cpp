@@ -0,0 +1,1607 @@
+// bslx_segmentedoutstream.t.cpp                                      -*-C++-*-
+
+#include <bslx_segmentedoutstream.h>
+
+#include <bslx_byteoutstream.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+using namespace bslx;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The formatting of each value is delegated to 'bslx::MarshallingUtil', and
+// 'bslx::SegmentedOutStream' is required to write exactly the bytes written by
+// 'bslx::ByteOutStream'.  We therefore use 'bslx::ByteOutStream' as an oracle:
+// each output method is applied to both streams, for block sizes small enough
+// to place every value at every position relative to a block boundary, and
+// the concatenation of the segments of the object under test is compared to
+// the content of the oracle.
+//
+// We have chosen the primary manipulator for 'SegmentedOutStream' to be
+// 'putInt8', and the basic accessors to be 'length', 'numSegments',
+// 'segmentData', and 'segmentLength'.
+// ----------------------------------------------------------------------------
+// [ 2] SegmentedOutStream(int sV, *ba = 0);
+// [ 2] SegmentedOutStream(int sV, bsl::size_t blockSize, *ba = 0);
+// [ 2] ~SegmentedOutStream();
+// [ 9] appendExternalBuffer(const char *buffer, bsl::size_t length);
+// [ 4] void invalidate();
+// [ 8] putLength(int length);
+// [ 8] putVersion(int version);
+// [10] reserveCapacity(bsl::size_t newCapacity);
+// [ 2] reset();
+// [ 6] putInt64(bsls::Types::Int64 value);
+// [ 6] putUint64(bsls::Types::Uint64 value);
+// [ 6] putInt56(bsls::Types::Int64 value);
+// [ 6] putUint56(bsls::Types::Uint64 value);
+// [ 6] putInt48(bsls::Types::Int64 value);
+// [ 6] putUint48(bsls::Types::Uint64 value);
+// [ 6] putInt40(bsls::Types::Int64 value);
+// [ 6] putUint40(bsls::Types::Uint64 value);
+// [ 6] putInt32(int value);
+// [ 6] putUint32(unsigned int value);
+// [ 6] putInt24(int value);
+// [ 6] putUint24(unsigned int value);
+// [ 6] putInt16(int value);
+// [ 6] putUint16(unsigned int value);
+// [ 2] putInt8(int value);
+// [ 6] putUint8(unsigned int value);
+// [ 6] putFloat64(double value);
+// [ 6] putFloat32(float value);
+// [ 8] putString(const bsl::string& value);
+// [ 7] putArrayInt64(const bsls::Types::Int64 *array, int count);
+// [ 7] putArrayUint64(const bsls::Types::Uint64 *array, int count);
+// [ 7] putArrayInt56(const bsls::Types::Int64 *array, int count);
+// [ 7] putArrayUint56(const bsls::Types::Uint64 *array, int count);
+// [ 7] putArrayInt48(const bsls::Types::Int64 *array, int count);
+// [ 7] putArrayUint48(const bsls::Types::Uint64 *array, int count);
+// [ 7] putArrayInt40(const bsls::Types::Int64 *array, int count);
+// [ 7] putArrayUint40(const bsls::Types::Uint64 *array, int count);
+// [ 7] putArrayInt32(const int *array, int count);
+// [ 7] putArrayUint32(const unsigned int *array, int count);
+// [ 7] putArrayInt24(const int *array, int count);
+// [ 7] putArrayUint24(const unsigned int *array, int count);
+// [ 7] putArrayInt16(const short *array, int count);
+// [ 7] putArrayUint16(const unsigned short *array, int count);
+// [ 7] putArrayInt8(const char *array, int count);
+// [ 7] putArrayInt8(const signed char *array, int count);
+// [ 7] putArrayUint8(const char *array, int count);
+// [ 7] putArrayUint8(const unsigned char *array, int count);
+// [ 7] putArrayFloat64(const double *array, int count);
+// [ 7] putArrayFloat32(const float *array, int count);
+// [ 4] operator const void *() const;
+// [ 3] int bdexVersionSelector() const;
+// [ 3] bsl::size_t blockSize() const;
+// [ 4] bool isValid() const;
+// [ 3] bsl::size_t length() const;
+// [11] int loadIovecs(IOVEC *iovecs, int maxNumIovecs, int first) const;
+// [ 3] int numSegments() const;
+// [ 3] const char *segmentData(int index) const;
+// [ 3] bsl::size_t segmentLength(int index) const;
+//
+// [ 5] ostream& operator<<(ostream& stream, const SegmentedOutStream&);
+// [13] SegmentedOutStream& operator<<(SegmentedOutStream&, const TYPE&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [12] EXCEPTION SAFETY
+// [14] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef SegmentedOutStream Obj;
+
+const int VERSION_SELECTOR = 20131127;
+
+const int NUM_SCALAR_METHODS = 18;
+    // Number of scalar output methods exercised by 'putScalar'.
+
+const int NUM_ARRAY_METHODS = 20;
+    // Number of array output methods exercised by 'putArray'.
+
+// ============================================================================
+//                      HELPER CLASSES AND FUNCTIONS
+// ----------------------------------------------------------------------------
+
+namespace BloombergLP {
+namespace bslx {
+
+void debugprint(const SegmentedOutStream& object)
+{
+    bsl::cout << object;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+struct IoVec {
+    // This 'struct' has the members of the POSIX 'iovec' structure.
+
+    void        *iov_base;
+    bsl::size_t  iov_len;
+};
+
+static bsl::string contents(const Obj& object)
+    // Return the concatenation of the segments of the specified 'object'.
+{
+    bsl::string result;
+    for (int i = 0; i < object.numSegments(); ++i) {
+        result.append(object.segmentData(i), object.segmentLength(i));
+    }
+    return result;
+}
+
+static bool equals(const Obj& object, const ByteOutStream& oracle)
+    // Return 'true' if the content of the specified 'object' is the same as
+    // that of the specified 'oracle', and 'false' otherwise.
+{
+    const bsl::string content = contents(object);
+    return object.length() == oracle.length()
+        && content.size()  == oracle.length()
+        && 0 == bsl::memcmp(content.data(), oracle.data(), content.size());
+}
+
+template <class STREAM>
+void putScalar(STREAM *stream, int method, int seed)
+    // Apply to the specified 'stream' the scalar output method identified by
+    // the specified 'method', with a value derived from the specified 'seed'.
+    // The behavior is undefined unless '0 <= method < NUM_SCALAR_METHODS'.
+{
+    const bsls::Types::Int64 v = 0x0102030405060708LL * (seed + 1);
+
+    switch (method) {
+      case  0: stream->putInt64(v);                            break;
+      case  1: stream->putUint64(v);                           break;
+      case  2: stream->putInt56(v);                            break;
+      case  3: stream->putUint56(v);                           break;
+      case  4: stream->putInt48(v);                            break;
+      case  5: stream->putUint48(v);                           break;
+      case  6: stream->putInt40(v);                            break;
+      case  7: stream->putUint40(v);                           break;
+      case  8: stream->putInt32(static_cast<int>(v));          break;
+      case  9: stream->putUint32(static_cast<unsigned int>(v)); break;
+      case 10: stream->putInt24(static_cast<int>(v));          break;
+      case 11: stream->putUint24(static_cast<unsigned int>(v)); break;
+      case 12: stream->putInt16(static_cast<int>(v));          break;
+      case 13: stream->putUint16(static_cast<unsigned int>(v)); break;
+      case 14: stream->putInt8(static_cast<int>(v));           break;
+      case 15: stream->putUint8(static_cast<unsigned int>(v)); break;
+      case 16: stream->putFloat64(1.0 / (seed + 3));           break;
+      default: stream->putFloat32(1.0f / (seed + 3));          break;
+    }
+}
+
+template <class STREAM>
+void putArray(STREAM *stream, int method, int numValues)
+    // Apply to the specified 'stream' the array output method identified by
+    // the specified 'method' for the specified 'numValues' leading entries of
+    // a fixed array of values.  The behavior is undefined unless
+    // '0 <= method < NUM_ARRAY_METHODS' and '0 <= numValues <= 32'.
+{
+    bsls::Types::Int64  i64[32];
+    bsls::Types::Uint64 u64[32];
+    int                 i32[32];
+    unsigned int        u32[32];
+    short               i16[32];
+    unsigned short      u16[32];
+    char                c8[32];
+    signed char         i8[32];
+    unsigned char       u8[32];
+    double              f64[32];
+    float               f32[32];
+
+    for (int i = 0; i < 32; ++i) {
+        i64[i] = 0x0102030405060708LL * (i + 1) - 3;
+        u64[i] = static_cast<bsls::Types::Uint64>(i64[i]);
+        i32[i] = static_cast<int>(i64[i]);
+        u32[i] = static_cast<unsigned int>(i64[i]);
+        i16[i] = static_cast<short>(i64[i]);
+        u16[i] = static_cast<unsigned short>(i64[i]);
+        c8[i]  = static_cast<char>(i64[i]);
+        i8[i]  = static_cast<signed char>(i64[i]);
+        u8[i]  = static_cast<unsigned char>(i64[i]);
+        f64[i] = 1.0 / (i + 3);
+        f32[i] = 1.0f / (i + 3);
+    }
+
+    switch (method) {
+      case  0: stream->putArrayInt64(i64, numValues);   break;
+      case  1: stream->putArrayUint64(u64, numValues);  break;
+      case  2: stream->putArrayInt56(i64, numValues);   break;
+      case  3: stream->putArrayUint56(u64, numValues);  break;
+      case  4: stream->putArrayInt48(i64, numValues);   break;
+      case  5: stream->putArrayUint48(u64, numValues);  break;
+      case  6: stream->putArrayInt40(i64, numValues);   break;
+      case  7: stream->putArrayUint40(u64, numValues);  break;
+      case  8: stream->putArrayInt32(i32, numValues);   break;
+      case  9: stream->putArrayUint32(u32, numValues);  break;
+      case 10: stream->putArrayInt24(i32, numValues);   break;
+      case 11: stream->putArrayUint24(u32, numValues);  break;
+      case 12: stream->putArrayInt16(i16, numValues);   break;
+      case 13: stream->putArrayUint16(u16, numValues);  break;
+      case 14: stream->putArrayInt8(c8, numValues);     break;
+      case 15: stream->putArrayInt8(i8, numValues);     break;
+      case 16: stream->putArrayUint8(c8, numValues);    break;
+      case 17: stream->putArrayUint8(u8, numValues);    break;
+      case 18: stream->putArrayFloat64(f64, numValues); break;
+      default: stream->putArrayFloat32(f32, numValues); break;
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+    int veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocator(&defaultAllocator);
+
+    bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+    switch (test) { case 0:
+      case 14: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file must
+        //:   compile, link, and run as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, replace
+        //:   leading comment characters with spaces, replace 'assert' with
+        //:   'ASSERT', and insert 'if (veryVerbose)' before all output
+        //:   operations.  (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "USAGE EXAMPLE" << endl
+                                  << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Scatter-Gather Output of a Message
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we send messages consisting of a small header, produced by BDEX
+// externalization, followed by a large payload that we already have in
+// memory.  A 'bslx::SegmentedOutStream' lets us send both with a single
+// scatter-gather write, without copying the payload.
+//
+// First, we define a structure having the members of the POSIX 'iovec'
+// structure, which we use in place of 'iovec' to keep this example portable:
+//..
+//  struct IoVec {
+//      void        *iov_base;
+//      bsl::size_t  iov_len;
+//  };
+//..
+// Then, we create a stream with an arbitrary value for its 'versionSelector'
+// and a block size of 64 bytes, and write the header:
+//..
+    const char payload[] = "a payload that is sent without being copied";
+    const int  payloadLength = static_cast<int>(sizeof payload - 1);
+
+    bslx::SegmentedOutStream outStream(20131127, 64);
+    outStream.putString(bsl::string("greeting"));
+    outStream.putInt32(7);
+    outStream.putLength(payloadLength);
+//..
+// Next, we append the payload, and write a trailer following it:
+//..
+    outStream.appendExternalBuffer(payload, payloadLength);
+    outStream.putInt8('.');
+    ASSERT(3 == outStream.numSegments());
+    ASSERT(1 + 8 + 4 + 1 + payloadLength + 1 == outStream.length());
+//..
+// Now, we load the segments into an array of 'IoVec', which could be passed
+// to 'writev' if it were an array of 'iovec':
+//..
+    IoVec     iovecs[8];
+    const int numIovecs = outStream.loadIovecs(iovecs, 8);
+    ASSERT(3       == numIovecs);
+    ASSERT(payload == iovecs[1].iov_base);
+//..
+// Finally, we gather the segments as a 'writev' would, and verify that the
+// result is readable by 'bslx::ByteInStream' (here, we show only the bytes):
+//..
+    bsl::string message;
+    for (int i = 0; i < numIovecs; ++i) {
+        message.append(static_cast<const char *>(iovecs[i].iov_base),
+                       iovecs[i].iov_len);
+    }
+    ASSERT(outStream.length() == message.size());
+    ASSERT(0 == bsl::memcmp(message.data(),
+                            "\x08" "greeting" "\x00\x00\x00\x07" "\x2b",
+                            14));
+//..
+
+      } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // EXTERNALIZATION FREE OPERATOR
+        //   Verify 'operator<<' works correctly.
+        //
+        // Concerns:
+        //: 1 The method inline-forwards to the implementation correctly.
+        //:
+        //: 2 Invocations of the method can be chained.
+        //
+        // Plan:
+        //: 1 Externalize a set of values, in one code line, to an object
+        //:   having a small block size and to a 'ByteOutStream', and verify
+        //:   that the contents are the same.  (C-1..2)
+        //
+        // Testing:
+        //   SegmentedOutStream& operator<<(SegmentedOutStream&, const TYPE&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EXTERNALIZATION FREE OPERATOR" << endl
+                          << "=============================" << endl;
+
+        bsl::vector<int> vector;
+        for (int i = 0; i < 20; ++i) {
+            vector.push_back(i * 1000);
+        }
+
+        Obj           mX(VERSION_SELECTOR, 5, &ta);  const Obj& X = mX;
+        ByteOutStream expected(VERSION_SELECTOR, &ta);
+
+        mX << 'a' << 7.0 << bsl::string("hello") << vector << short(2);
+        expected << 'a' << 7.0 << bsl::string("hello") << vector << short(2);
+
+        ASSERT(equals(X, expected));
+      } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 No memory is leaked if an allocation fails.
+        //:
+        //: 2 A stream is invalid after an allocation failure.
+        //:
+        //: 3 A stream that has been reset after an allocation failure writes
+        //:   the expected content.
+        //
+        // Plan:
+        //: 1 Using the standard 'bslma' exception-testing macros, write a
+        //:   sequence of scalars, arrays, strings, and external buffers to an
+        //:   object, created outside the macros, after resetting it.  At the
+        //:   start of each retry, verify that the object is invalid.  After
+        //:   the macros, verify that the content matches that of a
+        //:   'ByteOutStream'.  (C-1..3)
+        //
+        // Testing:
+        //   EXCEPTION SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EXCEPTION SAFETY" << endl
+                          << "================" << endl;
+
+        const bsl::string STRING(300, 'x');
+        const char        BUFFER[] = "external";
+
+        ByteOutStream expected(VERSION_SELECTOR, &ta);
+        for (int i = 0; i < 4; ++i) {
+            putScalar(&expected, i * 4 % NUM_SCALAR_METHODS, i);
+            putArray(&expected, i * 5 % NUM_ARRAY_METHODS, 20);
+            expected.putString(STRING);
+            expected.putArrayInt8(BUFFER, 8);
+        }
+
+        for (bsl::size_t blockSize = 1; blockSize <= 64; blockSize *= 4) {
+            if (veryVerbose) { T_ P(blockSize) }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            {
+                Obj mX(VERSION_SELECTOR, blockSize, &oa);  const Obj& X = mX;
+
+                int numTries = 0;
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                    if (0 < numTries) {
+                        LOOP2_ASSERT(blockSize, numTries, !X.isValid());
+                    }
+                    ++numTries;
+
+                    mX.reset();
+                    for (int i = 0; i < 4; ++i) {
+                        putScalar(&mX, i * 4 % NUM_SCALAR_METHODS, i);
+                        putArray(&mX, i * 5 % NUM_ARRAY_METHODS, 20);
+                        mX.putString(STRING);
+                        mX.appendExternalBuffer(BUFFER, 8);
+                    }
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                LOOP_ASSERT(blockSize, X.isValid());
+                LOOP_ASSERT(blockSize, equals(X, expected));
+            }
+            LOOP_ASSERT(blockSize, 0 == oa.numBlocksInUse());
+        }
+      } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // TESTING 'loadIovecs'
+        //
+        // Concerns:
+        //: 1 Each loaded element holds the address and length of the
+        //:   corresponding segment.
+        //:
+        //: 2 At most 'maxNumIovecs' elements are loaded, starting with the
+        //:   segment at 'firstSegment', and the number loaded is returned.
+        //:
+        //: 3 No element beyond those loaded is modified.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create an object having several segments.  For each first
+        //:   segment and maximum number of elements, load an array whose
+        //:   elements are initialized to a sentinel value, and verify the
+        //:   returned number and each element.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   int loadIovecs(IOVEC *iovecs, int maxNumIovecs, int first) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'loadIovecs'" << endl
+                          << "====================" << endl;
+
+        const char BUFFER[] = "0123456789";
+
+        Obj mX(VERSION_SELECTOR, 8, &ta);  const Obj& X = mX;
+
+        IoVec iovecs[16];
+        ASSERT(0 == X.loadIovecs(iovecs, 16));
+
+        for (int i = 0; i < 20; ++i) {
+            mX.putInt8(i);
+        }
+        mX.appendExternalBuffer(BUFFER, 10);
+        mX.putInt8(20);
+        mX.appendExternalBuffer(BUFFER + 3, 4);
+        ASSERT(6 == X.numSegments());
+
+        const int NUM_SEGMENTS = X.numSegments();
+
+        for (int first = 0; first <= NUM_SEGMENTS; ++first) {
+            for (int max = 0; max <= NUM_SEGMENTS + 1; ++max) {
+                for (int i = 0; i < 16; ++i) {
+                    iovecs[i].iov_base = 0;
+                    iovecs[i].iov_len  = 99;
+                }
+
+                const int EXP = NUM_SEGMENTS - first < max
+                              ? NUM_SEGMENTS - first
+                              : max;
+
+                const int n = first ? X.loadIovecs(iovecs, max, first)
+                                    : X.loadIovecs(iovecs, max);
+                LOOP3_ASSERT(first, max, n, EXP == n);
+
+                for (int i = 0; i < n; ++i) {
+                    LOOP3_ASSERT(first, max, i,
+                                 X.segmentData(first + i) ==
+                                                        iovecs[i].iov_base);
+                    LOOP3_ASSERT(first, max, i,
+                                 X.segmentLength(first + i) ==
+                                                         iovecs[i].iov_len);
+                }
+                for (int i = n; i < 16; ++i) {
+                    LOOP3_ASSERT(first, max, i, 0  == iovecs[i].iov_base);
+                    LOOP3_ASSERT(first, max, i, 99 == iovecs[i].iov_len);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_SAFE_PASS(X.loadIovecs(iovecs, 0, NUM_SEGMENTS));
+            ASSERT_SAFE_FAIL(X.loadIovecs(iovecs, 0, NUM_SEGMENTS + 1));
+            ASSERT_SAFE_FAIL(X.loadIovecs(iovecs, 1, -1));
+            ASSERT_SAFE_FAIL(X.loadIovecs(iovecs, -1));
+            ASSERT_SAFE_PASS(X.loadIovecs(static_cast<IoVec *>(0), 0));
+            ASSERT_SAFE_FAIL(X.loadIovecs(static_cast<IoVec *>(0), 1));
+        }
+      } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING 'reserveCapacity' AND BLOCK REUSE
+        //
+        // Concerns:
+        //: 1 'reserveCapacity' allocates blocks so that at least the requested
+        //:   capacity is available, and does not allocate if it already is.
+        //:
+        //: 2 Output into reserved capacity does not allocate.
+        //:
+        //: 3 'reset' retains the blocks, and output after 'reset' reuses them
+        //:   without allocating.
+        //:
+        //: 4 'reserveCapacity' does not change the content of the stream.
+        //
+        // Plan:
+        //: 1 For a few block sizes and capacities, reserve capacity in an
+        //:   empty object and in one having content, verify the number of
+        //:   allocations, write up to the capacity, and verify that no further
+        //:   allocation occurred.  (C-1..2, 4)
+        //:
+        //: 2 Reset the object, write the same content again, and verify that
+        //:   no allocation occurred and that the content is as expected.
+        //:   (C-3)
+        //
+        // Testing:
+        //   reserveCapacity(bsl::size_t newCapacity);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'reserveCapacity' AND BLOCK REUSE"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        for (bsl::size_t blockSize = 1; blockSize <= 16; ++blockSize) {
+        for (bsl::size_t prefix = 0; prefix <= 20; prefix += 5) {
+        for (bsl::size_t capacity = 0; capacity <= 70; capacity += 7) {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(VERSION_SELECTOR, blockSize, &oa);  const Obj& X = mX;
+
+            for (bsl::size_t i = 0; i < prefix; ++i) {
+                mX.putInt8(static_cast<int>(i));
+            }
+            const bsls::Types::Int64 NUM_INITIAL = oa.numAllocations();
+
+            mX.reserveCapacity(capacity);
+            LOOP3_ASSERT(blockSize, prefix, capacity, prefix == X.length());
+
+            const bsl::size_t TOTAL = prefix > capacity ? prefix : capacity;
+            const bsls::Types::Int64 NUM_BLOCKS =
+                                          (TOTAL + blockSize - 1) / blockSize;
+            LOOP3_ASSERT(blockSize, prefix, capacity,
+                         NUM_BLOCKS * static_cast<bsls::Types::Int64>(
+                                          blockSize) <= oa.numBytesInUse());
+
+            const bsls::Types::Int64 NUM_RESERVED = oa.numAllocations();
+            LOOP3_ASSERT(blockSize, prefix, capacity,
+                         prefix < capacity || NUM_INITIAL == NUM_RESERVED);
+
+            for (bsl::size_t i = prefix; i < capacity; ++i) {
+                mX.putInt8(static_cast<int>(i));
+            }
+            LOOP3_ASSERT(blockSize, prefix, capacity,
+                         NUM_RESERVED == oa.numAllocations());
+
+            mX.reset();
+            for (bsl::size_t i = 0; i < TOTAL; ++i) {
+                mX.putInt8(static_cast<int>(i));
+            }
+            LOOP3_ASSERT(blockSize, prefix, capacity,
+                         NUM_RESERVED == oa.numAllocations());
+
+            const bsl::string CONTENT = contents(X);
+            LOOP3_ASSERT(blockSize, prefix, capacity,
+                         TOTAL == CONTENT.size());
+            for (bsl::size_t i = 0; i < CONTENT.size(); ++i) {
+                LOOP4_ASSERT(blockSize, prefix, capacity, i,
+                             static_cast<char>(i) == CONTENT[i]);
+            }
+        }
+        }
+        }
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // TESTING 'appendExternalBuffer'
+        //
+        // Concerns:
+        //: 1 The buffer becomes a segment of its own, referring to the
+        //:   supplied memory, and is not copied.
+        //:
+        //: 2 Output following the buffer continues in the unused part of the
+        //:   current block, in a new segment.
+        //:
+        //: 3 Appending an empty buffer, or appending to an invalid stream, has
+        //:   no effect.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For several block sizes and positions, write some bytes, append
+        //:   a buffer, write more bytes, and verify the segments, the
+        //:   content, and the addresses of the segments.  (C-1..2)
+        //:
+        //: 2 Append an empty buffer and append to an invalidated stream, and
+        //:   verify that the stream is unchanged.  (C-3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   appendExternalBuffer(const char *buffer, bsl::size_t length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'appendExternalBuffer'" << endl
+                          << "==============================" << endl;
+
+        const char BUFFER[] = "external buffer";
+        const int  LENGTH   = static_cast<int>(sizeof BUFFER - 1);
+
+        for (int blockSize = 1; blockSize <= 8; ++blockSize) {
+        for (int before = 0; before <= 10; ++before) {
+        for (int after = 0; after <= 10; ++after) {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(VERSION_SELECTOR, blockSize, &oa);  const Obj& X = mX;
+
+            bsl::string expected;
+            for (int i = 0; i < before; ++i) {
+                mX.putInt8('a' + i);
+                expected += static_cast<char>('a' + i);
+            }
+
+            const int SEGMENTS_BEFORE = X.numSegments();
+
+            mX.appendExternalBuffer(BUFFER, LENGTH);
+            expected.append(BUFFER, LENGTH);
+
+            LOOP3_ASSERT(blockSize, before, after,
+                         SEGMENTS_BEFORE + 1 == X.numSegments());
+            LOOP3_ASSERT(blockSize, before, after,
+                         BUFFER == X.segmentData(SEGMENTS_BEFORE));
+            LOOP3_ASSERT(blockSize, before, after,
+                         LENGTH == static_cast<int>(
+                                       X.segmentLength(SEGMENTS_BEFORE)));
+
+            for (int i = 0; i < after; ++i) {
+                mX.putInt8('A' + i);
+                expected += static_cast<char>('A' + i);
+            }
+
+            LOOP3_ASSERT(blockSize, before, after, expected == contents(X));
+            LOOP3_ASSERT(blockSize, before, after,
+                         expected.size() == X.length());
+
+            // Output following the buffer continues in the unused part of the
+            // current block.
+
+            if (0 < before % blockSize && 0 < after) {
+                const char *END = X.segmentData(SEGMENTS_BEFORE - 1)
+                                + X.segmentLength(SEGMENTS_BEFORE - 1);
+                LOOP3_ASSERT(blockSize, before, after,
+                             END == X.segmentData(SEGMENTS_BEFORE + 1));
+            }
+
+            // Appending an empty buffer has no effect.
+
+            const int NUM_SEGMENTS = X.numSegments();
+            mX.appendExternalBuffer(BUFFER, 0);
+            LOOP3_ASSERT(blockSize, before, after,
+                         NUM_SEGMENTS == X.numSegments());
+            LOOP3_ASSERT(blockSize, before, after, expected == contents(X));
+
+            // Appending to an invalid stream has no effect.
+
+            mX.invalidate();
+            mX.appendExternalBuffer(BUFFER, LENGTH);
+            LOOP3_ASSERT(blockSize, before, after,
+                         NUM_SEGMENTS == X.numSegments());
+            LOOP3_ASSERT(blockSize, before, after, expected == contents(X));
+        }
+        }
+        }
+
+        if (verbose) cout << "\nConsecutive external buffers." << endl;
+        {
+            Obj mX(VERSION_SELECTOR, &ta);  const Obj& X = mX;
+
+            mX.appendExternalBuffer(BUFFER, 3);
+            mX.appendExternalBuffer(BUFFER + 3, 5);
+            ASSERT(2 == X.numSegments());
+            ASSERT(8 == X.length());
+            ASSERT(static_cast<bsls::Types::Int64>(
+                                                   Obj::k_DEFAULT_BLOCK_SIZE)
+                                                       > ta.numBytesInUse());
+            ASSERT(bsl::string(BUFFER, 8) == contents(X));
+
+            mX.reset();
+            ASSERT(0 == X.numSegments());
+            ASSERT(0 == X.length());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(VERSION_SELECTOR, &ta);
+
+            ASSERT_SAFE_PASS(mX.appendExternalBuffer(0, 0));
+            ASSERT_SAFE_FAIL(mX.appendExternalBuffer(0, 1));
+            ASSERT_SAFE_PASS(mX.appendExternalBuffer(BUFFER, 1));
+        }
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // PUT STRING, LENGTH, AND VERSION TEST
+        //   Verify the methods externalize the expected bytes.
+        //
+        // Concerns:
+        //: 1 The methods externalize the same bytes as the corresponding
+        //:   methods of 'ByteOutStream', for both the short and the long
+        //:   length encodings, regardless of the position relative to block
+        //:   boundaries.
+        //:
+        //: 2 The methods have no effect on an invalid stream.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For several block sizes, externalize strings and lengths around
+        //:   the encoding threshold, and versions, to an object and to a
+        //:   'ByteOutStream', and verify that the contents are the same.
+        //:   (C-1)
+        //:
+        //: 2 Invalidate the stream, externalize values, and verify that the
+        //:   content is unchanged.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   putLength(int length);
+        //   putVersion(int version);
+        //   putString(const bsl::string& value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PUT STRING, LENGTH, AND VERSION TEST" << endl
+                          << "====================================" << endl;
+
+        const int LENGTHS[] = { 0, 1, 5, 126, 127, 128, 129, 300, 100000 };
+        const int NUM_LENGTHS = static_cast<int>(sizeof LENGTHS
+                                                 / sizeof *LENGTHS);
+
+        for (bsl::size_t blockSize = 1; blockSize <= 13; blockSize += 3) {
+            Obj           mX(VERSION_SELECTOR, blockSize, &ta);
+            const Obj&    X = mX;
+            ByteOutStream expected(VERSION_SELECTOR, &ta);
+
+            for (int i = 0; i < NUM_LENGTHS; ++i) {
+                const bsl::string STRING(LENGTHS[i],
+                                         static_cast<char>('a' + i));
+
+                mX.putString(STRING);
+                mX.putLength(LENGTHS[i]);
+                mX.putVersion(i + 1);
+
+                expected.putString(STRING);
+                expected.putLength(LENGTHS[i]);
+                expected.putVersion(i + 1);
+
+                LOOP2_ASSERT(blockSize, i, equals(X, expected));
+            }
+
+            mX.invalidate();
+            mX.putString(bsl::string("hello"));
+            mX.putLength(300);
+            mX.putVersion(1);
+            LOOP_ASSERT(blockSize, equals(X, expected));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(VERSION_SELECTOR, &ta);
+
+            ASSERT_SAFE_FAIL(mX.putLength(-1));
+            ASSERT_SAFE_PASS(mX.putLength(0));
+            ASSERT_SAFE_PASS(mX.putLength(1));
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // PUT ARRAY TEST
+        //   Verify the array methods externalize the expected bytes.
+        //
+        // Concerns:
+        //: 1 Each method externalizes the same bytes as the corresponding
+        //:   method of 'ByteOutStream', including values split across block
+        //:   boundaries and arrays spanning several blocks.
+        //:
+        //: 2 The methods have no effect on an invalid stream.
+        //:
+        //: 3 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For each array method, each block size from 1 to 19, each number
+        //:   of leading bytes from 0 to 8, and each array length from 0 to
+        //:   32, externalize the leading bytes and the array to an object and
+        //:   to a 'ByteOutStream', and verify that the contents are the same.
+        //:   (C-1)
+        //:
+        //: 2 Invalidate the stream, externalize an array, and verify that the
+        //:   content is unchanged.  (C-2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   putArrayInt64(const bsls::Types::Int64 *array, int count);
+        //   putArrayUint64(const bsls::Types::Uint64 *array, int count);
+        //   putArrayInt56(const bsls::Types::Int64 *array, int count);
+        //   putArrayUint56(const bsls::Types::Uint64 *array, int count);
+        //   putArrayInt48(const bsls::Types::Int64 *array, int count);
+        //   putArrayUint48(const bsls::Types::Uint64 *array, int count);
+        //   putArrayInt40(const bsls::Types::Int64 *array, int count);
+        //   putArrayUint40(const bsls::Types::Uint64 *array, int count);
+        //   putArrayInt32(const int *array, int count);
+        //   putArrayUint32(const unsigned int *array, int count);
+        //   putArrayInt24(const int *array, int count);
+        //   putArrayUint24(const unsigned int *array, int count);
+        //   putArrayInt16(const short *array, int count);
+        //   putArrayUint16(const unsigned short *array, int count);
+        //   putArrayInt8(const char *array, int count);
+        //   putArrayInt8(const signed char *array, int count);
+        //   putArrayUint8(const char *array, int count);
+        //   putArrayUint8(const unsigned char *array, int count);
+        //   putArrayFloat64(const double *array, int count);
+        //   putArrayFloat32(const float *array, int count);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PUT ARRAY TEST" << endl
+                          << "==============" << endl;
+
+        for (int method = 0; method < NUM_ARRAY_METHODS; ++method) {
+            if (veryVerbose) { T_ P(method) }
+
+            for (bsl::size_t blockSize = 1; blockSize <= 19; ++blockSize) {
+            for (int lead = 0; lead <= 8; ++lead) {
+            for (int length = 0; length <= 32; ++length) {
+                Obj           mX(VERSION_SELECTOR, blockSize, &ta);
+                const Obj&    X = mX;
+                ByteOutStream expected(VERSION_SELECTOR, &ta);
+
+                for (int i = 0; i < lead; ++i) {
+                    mX.putInt8(0xf0 + i);
+                    expected.putInt8(0xf0 + i);
+                }
+                putArray(&mX, method, length);
+                putArray(&expected, method, length);
+                mX.putInt8(0xaa);
+                expected.putInt8(0xaa);
+
+                LOOP4_ASSERT(method, blockSize, lead, length,
+                             equals(X, expected));
+
+                mX.invalidate();
+                putArray(&mX, method, length);
+                LOOP4_ASSERT(method, blockSize, lead, length,
+                             equals(X, expected));
+            }
+            }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(VERSION_SELECTOR, &ta);
+
+            const int  VALUES[] = { 1, 2, 3 };
+            const int *NULL_ARRAY = 0;
+            (void)NULL_ARRAY;
+
+            ASSERT_SAFE_FAIL(mX.putArrayInt32(NULL_ARRAY, 1));
+            ASSERT_SAFE_FAIL(mX.putArrayInt32(VALUES, -1));
+            ASSERT_SAFE_PASS(mX.putArrayInt32(VALUES, 0));
+            ASSERT_SAFE_PASS(mX.putArrayInt32(VALUES, 3));
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // PUT SCALAR TEST
+        //   Verify the scalar methods externalize the expected bytes.
+        //
+        // Concerns:
+        //: 1 Each method externalizes the same bytes as the corresponding
+        //:   method of 'ByteOutStream', at every position relative to a block
+        //:   boundary, including values split across blocks.
+        //:
+        //: 2 The methods have no effect on an invalid stream.
+        //
+        // Plan:
+        //: 1 For each scalar method, each block size from 1 to 17, and each
+        //:   number of leading bytes from 0 to 17, externalize the leading
+        //:   bytes and a sequence of values to an object and to a
+        //:   'ByteOutStream', and verify that the contents are the same.
+        //:   (C-1)
+        //:
+        //: 2 Invalidate the stream, externalize a value, and verify that the
+        //:   content is unchanged.  (C-2)
+        //
+        // Testing:
+        //   putInt64(bsls::Types::Int64 value);
+        //   putUint64(bsls::Types::Uint64 value);
+        //   putInt56(bsls::Types::Int64 value);
+        //   putUint56(bsls::Types::Uint64 value);
+        //   putInt48(bsls::Types::Int64 value);
+        //   putUint48(bsls::Types::Uint64 value);
+        //   putInt40(bsls::Types::Int64 value);
+        //   putUint40(bsls::Types::Uint64 value);
+        //   putInt32(int value);
+        //   putUint32(unsigned int value);
+        //   putInt24(int value);
+        //   putUint24(unsigned int value);
+        //   putInt16(int value);
+        //   putUint16(unsigned int value);
+        //   putUint8(unsigned int value);
+        //   putFloat64(double value);
+        //   putFloat32(float value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PUT SCALAR TEST" << endl
+                          << "===============" << endl;
+
+        for (int method = 0; method < NUM_SCALAR_METHODS; ++method) {
+            if (veryVerbose) { T_ P(method) }
+
+            for (bsl::size_t blockSize = 1; blockSize <= 17; ++blockSize) {
+            for (int lead = 0; lead <= 17; ++lead) {
+                Obj           mX(VERSION_SELECTOR, blockSize, &ta);
+                const Obj&    X = mX;
+                ByteOutStream expected(VERSION_SELECTOR, &ta);
+
+                for (int i = 0; i < lead; ++i) {
+                    mX.putInt8(0xf0 + i);
+                    expected.putInt8(0xf0 + i);
+                }
+                for (int i = 0; i < 10; ++i) {
+                    putScalar(&mX, method, i);
+                    putScalar(&expected, method, i);
+                }
+
+                LOOP3_ASSERT(method, blockSize, lead, equals(X, expected));
+
+                mX.invalidate();
+                putScalar(&mX, method, 0);
+                LOOP3_ASSERT(method, blockSize, lead, equals(X, expected));
+            }
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // PRINT OPERATOR
+        //   Verify the method produces the expected output format.
+        //
+        // Concerns:
+        //: 1 The method produces the same output as the print operator of
+        //:   'ByteOutStream' for the same content, regardless of the segments.
+        //:
+        //: 2 The method does not change the formatting flags of the stream.
+        //
+        // Plan:
+        //: 1 For several block sizes, write the same content, including an
+        //:   external buffer, to an object and to a 'ByteOutStream', print
+        //:   both, and compare the results.  (C-1)
+        //:
+        //: 2 Verify the formatting flags of the 'ostream' are unchanged.
+        //:   (C-2)
+        //
+        // Testing:
+        //   ostream& operator<<(ostream& stream, const SegmentedOutStream&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRINT OPERATOR" << endl
+                          << "==============" << endl;
+
+        const char BUFFER[] = "\x01\x02\x03\x04\x05";
+
+        for (bsl::size_t blockSize = 1; blockSize <= 10; ++blockSize) {
+            for (int length = 0; length <= 40; length += 3) {
+                Obj           mX(VERSION_SELECTOR, blockSize, &ta);
+                const Obj&    X = mX;
+                ByteOutStream expected(VERSION_SELECTOR, &ta);
+
+                for (int i = 0; i < length; ++i) {
+                    mX.putInt8(i * 7);
+                    expected.putInt8(i * 7);
+                }
+                mX.appendExternalBuffer(BUFFER, 5);
+                expected.putArrayInt8(BUFFER, 5);
+                mX.putInt8(0xff);
+                expected.putInt8(0xff);
+
+                bsl::ostringstream out1, out2;
+                out1 << bsl::dec << X;
+                out2 << bsl::dec << expected;
+                LOOP2_ASSERT(blockSize, length, out1.str() == out2.str());
+                LOOP2_ASSERT(blockSize, length,
+                             (out1.flags() & bsl::ios::dec) != 0);
+
+                if (veryVerbose && 0 == length) {
+                    cout << out1.str() << endl;
+                }
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // VALIDITY METHODS
+        //   Verify the methods that set and query the validity of the stream.
+        //
+        // Concerns:
+        //: 1 A stream is valid on construction.
+        //:
+        //: 2 'invalidate' makes a stream invalid, and output to an invalid
+        //:   stream has no effect.
+        //:
+        //: 3 'reset' makes a stream valid.
+        //:
+        //: 4 'operator const void *' and 'isValid' agree.
+        //
+        // Plan:
+        //: 1 Create an object, verify it is valid, invalidate it, write to
+        //:   it, and verify it is unchanged and invalid; then reset it and
+        //:   verify it is valid.  (C-1..4)
+        //
+        // Testing:
+        //   void invalidate();
+        //   operator const void *() const;
+        //   bool isValid() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VALIDITY METHODS" << endl
+                          << "================" << endl;
+
+        Obj mX(VERSION_SELECTOR, 4, &ta);  const Obj& X = mX;
+        ASSERT(X.isValid());
+        ASSERT(X);
+
+        mX.putInt32(1);
+        mX.invalidate();
+        ASSERT(!X.isValid());
+        ASSERT(!X);
+
+        mX.putInt32(2);
+        mX.putInt8(3);
+        ASSERT(4 == X.length());
+        ASSERT(1 == X.numSegments());
+
+        mX.invalidate();
+        ASSERT(!X.isValid());
+
+        mX.reset();
+        ASSERT(X.isValid());
+        ASSERT(X);
+        ASSERT(0 == X.length());
+
+        mX.putInt8(3);
+        ASSERT(1 == X.length());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // BASIC ACCESSORS
+        //   Verify the basic accessors work as expected.
+        //
+        // Concerns:
+        //: 1 'length' returns the number of bytes written.
+        //:
+        //: 2 Each segment but the last of a stream written with 'putInt8'
+        //:   fills a block, and the last one holds the remaining bytes.
+        //:
+        //: 3 'bdexVersionSelector' and 'blockSize' return the values supplied
+        //:   at construction.
+        //:
+        //: 4 The accessors are declared 'const'.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For several block sizes and lengths, write bytes using 'putInt8'
+        //:   and verify the accessors through a 'const' reference.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   int bdexVersionSelector() const;
+        //   bsl::size_t blockSize() const;
+        //   bsl::size_t length() const;
+        //   int numSegments() const;
+        //   const char *segmentData(int index) const;
+        //   bsl::size_t segmentLength(int index) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BASIC ACCESSORS" << endl
+                          << "===============" << endl;
+
+        for (int blockSize = 1; blockSize <= 9; ++blockSize) {
+            for (int length = 0; length <= 30; ++length) {
+                Obj mX(VERSION_SELECTOR + length, blockSize, &ta);
+                const Obj& X = mX;
+
+                LOOP2_ASSERT(blockSize, length,
+                             VERSION_SELECTOR + length ==
+                                                    X.bdexVersionSelector());
+                LOOP2_ASSERT(blockSize, length,
+                             static_cast<bsl::size_t>(blockSize) ==
+                                                              X.blockSize());
+
+                for (int i = 0; i < length; ++i) {
+                    mX.putInt8(i);
+                }
+
+                LOOP2_ASSERT(blockSize, length,
+                             static_cast<bsl::size_t>(length) == X.length());
+
+                const int NUM_SEGMENTS = (length + blockSize - 1) / blockSize;
+                LOOP2_ASSERT(blockSize, length,
+                             NUM_SEGMENTS == X.numSegments());
+
+                int offset = 0;
+                for (int s = 0; s < X.numSegments(); ++s) {
+                    const int EXP_LENGTH = length - offset < blockSize
+                                         ? length - offset
+                                         : blockSize;
+                    LOOP3_ASSERT(blockSize, length, s,
+                                 EXP_LENGTH == static_cast<int>(
+                                                         X.segmentLength(s)));
+                    for (int i = 0; i < EXP_LENGTH; ++i) {
+                        LOOP4_ASSERT(blockSize, length, s, i,
+                                     static_cast<char>(offset + i) ==
+                                                         X.segmentData(s)[i]);
+                    }
+                    offset += EXP_LENGTH;
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX(VERSION_SELECTOR, 2, &ta);  const Obj& X = mX;
+
+            ASSERT_SAFE_FAIL(X.segmentData(0));
+            ASSERT_SAFE_FAIL(X.segmentLength(0));
+
+            mX.putInt8(1);
+            mX.putInt8(2);
+            mX.putInt8(3);
+
+            ASSERT_SAFE_FAIL(X.segmentData(-1));
+            ASSERT_SAFE_PASS(X.segmentData(0));
+            ASSERT_SAFE_PASS(X.segmentData(1));
+            ASSERT_SAFE_FAIL(X.segmentData(2));
+
+            ASSERT_SAFE_FAIL(X.segmentLength(-1));
+            ASSERT_SAFE_PASS(X.segmentLength(0));
+            ASSERT_SAFE_PASS(X.segmentLength(1));
+            ASSERT_SAFE_FAIL(X.segmentLength(2));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS
+        //   Verify functionality of primary manipulators.
+        //
+        // Concerns:
+        //: 1 The constructors create an empty, valid stream that allocates
+        //:   nothing, and use the specified or default allocator.
+        //:
+        //: 2 The default block size is 'k_DEFAULT_BLOCK_SIZE'.
+        //:
+        //: 3 'putInt8' appends one byte, allocating a block of the block size
+        //:   only when the current one is full.
+        //:
+        //: 4 'reset' removes all content and validates the stream, and
+        //:   retains the blocks.
+        //:
+        //: 5 The destructor releases all blocks.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create objects using each constructor with and without an
+        //:   allocator, and verify the allocator usage.  (C-1..2)
+        //:
+        //: 2 Write bytes with 'putInt8' and verify the content and the
+        //:   allocations after each one.  (C-3)
+        //:
+        //: 3 Reset the object, verify it is empty, write again, and verify
+        //:   that nothing is allocated.  (C-4)
+        //:
+        //: 4 Destroy the object and verify that no memory is in use.  (C-5)
+        //:
+        //: 5 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   SegmentedOutStream(int sV, *ba = 0);
+        //   SegmentedOutStream(int sV, bsl::size_t blockSize, *ba = 0);
+        //   ~SegmentedOutStream();
+        //   putInt8(int value);
+        //   reset();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS" << endl
+                          << "====================" << endl;
+
+        if (verbose) cout << "\nTesting constructors." << endl;
+        {
+            {
+                Obj mX(VERSION_SELECTOR);  const Obj& X = mX;
+                ASSERT(X.isValid());
+                ASSERT(0 == X.length());
+                ASSERT(0 == X.numSegments());
+                ASSERT(Obj::k_DEFAULT_BLOCK_SIZE == X.blockSize());
+                ASSERT(0 == defaultAllocator.numBlocksTotal());
+
+                mX.putInt8(1);
+                ASSERT(static_cast<bsls::Types::Int64>(
+                                                   Obj::k_DEFAULT_BLOCK_SIZE)
+                                          <= defaultAllocator.numBytesInUse());
+                ASSERT(static_cast<bsls::Types::Int64>(
+                                                   Obj::k_DEFAULT_BLOCK_SIZE)
+                                     + 64 > defaultAllocator.numBytesInUse());
+            }
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+            {
+                Obj mX(VERSION_SELECTOR, 100);  const Obj& X = mX;
+                ASSERT(100 == X.blockSize());
+
+                mX.putInt8(1);
+                ASSERT(100 <= defaultAllocator.numBytesInUse());
+                ASSERT(164 >  defaultAllocator.numBytesInUse());
+            }
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+            const bsls::Types::Int64 NUM_DEFAULT =
+                                             defaultAllocator.numBlocksTotal();
+            {
+                Obj mX(VERSION_SELECTOR, &ta);
+                mX.putInt8(1);
+                ASSERT(static_cast<bsls::Types::Int64>(
+                                                   Obj::k_DEFAULT_BLOCK_SIZE)
+                                                      <= ta.numBytesInUse());
+            }
+            {
+                Obj mX(VERSION_SELECTOR, 100, &ta);
+                mX.putInt8(1);
+                ASSERT(100 <= ta.numBytesInUse());
+                ASSERT(164 >  ta.numBytesInUse());
+            }
+            ASSERT(NUM_DEFAULT == defaultAllocator.numBlocksTotal());
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting 'putInt8' and 'reset'." << endl;
+
+        for (int blockSize = 1; blockSize <= 5; ++blockSize) {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            {
+                Obj mX(VERSION_SELECTOR, blockSize, &oa);  const Obj& X = mX;
+
+                for (int i = 0; i < 20; ++i) {
+                    mX.putInt8(i + 1);
+
+                    LOOP2_ASSERT(blockSize, i,
+                                 static_cast<bsl::size_t>(i + 1) ==
+                                                                X.length());
+                    LOOP2_ASSERT(blockSize, i,
+                                 i / blockSize + 1 == X.numSegments());
+                    LOOP2_ASSERT(blockSize, i,
+                                 (i / blockSize + 1) * blockSize <=
+                                                        oa.numBytesInUse());
+
+                    const bsl::string CONTENT = contents(X);
+                    for (int j = 0; j <= i; ++j) {
+                        LOOP3_ASSERT(blockSize, i, j, j + 1 == CONTENT[j]);
+                    }
+                }
+
+                const bsls::Types::Int64 NUM_TOTAL = oa.numBlocksTotal();
+
+                mX.invalidate();
+                mX.reset();
+                LOOP_ASSERT(blockSize, X.isValid());
+                LOOP_ASSERT(blockSize, 0 == X.length());
+                LOOP_ASSERT(blockSize, 0 == X.numSegments());
+                LOOP_ASSERT(blockSize, NUM_TOTAL == oa.numBlocksTotal());
+
+                for (int i = 0; i < 20; ++i) {
+                    mX.putInt8(i + 100);
+                }
+                LOOP_ASSERT(blockSize, NUM_TOTAL == oa.numBlocksTotal());
+
+                const bsl::string CONTENT = contents(X);
+                LOOP_ASSERT(blockSize, 20 == CONTENT.size());
+                for (int j = 0; j < 20; ++j) {
+                    LOOP2_ASSERT(blockSize, j, j + 100 == CONTENT[j]);
+                }
+            }
+            LOOP_ASSERT(blockSize, 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            ASSERT_SAFE_FAIL(Obj(VERSION_SELECTOR, 0, &ta));
+            ASSERT_SAFE_PASS(Obj(VERSION_SELECTOR, 1, &ta));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create 'SegmentedOutStream' objects using both constructors,
+        //:   externalize values of several types, and verify the content.
+        //:   (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        {
+            Obj mX(VERSION_SELECTOR, &ta);  const Obj& X = mX;
+            ASSERT(0 == X.length());
+
+            mX.putInt8(1);
+            mX.putInt32(2);
+            mX.putString(bsl::string("abc"));
+            if (veryVerbose) { P(X) }
+
+            ASSERT(9 == X.length());
+            ASSERT(1 == X.numSegments());
+            ASSERT(0 == bsl::memcmp(X.segmentData(0),
+                                    "\x01" "\x00\x00\x00\x02" "\x03" "abc",
+                                    9));
+        }
+        {
+            Obj mX(VERSION_SELECTOR, 3, &ta);  const Obj& X = mX;
+
+            mX.putInt8(1);
+            mX.putInt32(2);
+            mX.putString(bsl::string("abc"));
+            if (veryVerbose) { P(X) }
+
+            ASSERT(9 == X.length());
+            ASSERT(3 == X.numSegments());
+            ASSERT(bsl::string("\x01" "\x00\x00\x00\x02" "\x03" "abc", 9)
+                                                               == contents(X));
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Externalizing a large message to a 'SegmentedOutStream' is faster
+        //:   than externalizing it to a 'ByteOutStream'.
+        //
+        // Plan:
+        //: 1 Repeatedly externalize a message of several megabytes, made of
+        //:   arrays and scalars, to a newly created stream of each kind, and
+        //:   to a reused stream of each kind, and report the times.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 20;
+        const int NUM_CHUNKS     = 4096;
+
+        bsl::vector<double> doubles(128, 1.5);
+        bsl::string         text(200, 't');
+
+        for (int reuse = 0; reuse < 2; ++reuse) {
+            bsls::Stopwatch byteTimer;
+            bsls::Stopwatch segmentedTimer;
+
+            ByteOutStream      byteStream(VERSION_SELECTOR);
+            SegmentedOutStream segmentedStream(VERSION_SELECTOR);
+
+            bsl::size_t length = 0;
+
+            for (int iteration = 0; iteration < NUM_ITERATIONS; ++iteration) {
+                byteTimer.start();
+                {
+                    ByteOutStream  localStream(VERSION_SELECTOR);
+                    ByteOutStream& stream = reuse ? byteStream : localStream;
+                    stream.reset();
+                    for (int i = 0; i < NUM_CHUNKS; ++i) {
+                        stream.putInt32(i);
+                        stream.putArrayFloat64(doubles.data(), 128);
+                        stream.putString(text);
+                    }
+                    length = stream.length();
+                }
+                byteTimer.stop();
+
+                segmentedTimer.start();
+                {
+                    SegmentedOutStream  localStream(VERSION_SELECTOR);
+                    SegmentedOutStream& stream = reuse ? segmentedStream
+                                                       : localStream;
+                    stream.reset();
+                    for (int i = 0; i < NUM_CHUNKS; ++i) {
+                        stream.putInt32(i);
+                        stream.putArrayFloat64(doubles.data(), 128);
+                        stream.putString(text);
+                    }
+                    ASSERT(length == stream.length());
+                }
+                segmentedTimer.stop();
+            }
+
+            printf("%s streams, %d messages of %d bytes:\n"
+                   "    ByteOutStream:      %8.3f ms/message\n"
+                   "    SegmentedOutStream: %8.3f ms/message\n",
+                   reuse ? "reused" : "new",
+                   NUM_ITERATIONS,
+                   static_cast<int>(length),
+                   byteTimer.accumulatedWallTime() * 1000 / NUM_ITERATIONS,
+                   segmentedTimer.accumulatedWallTime() * 1000
+                                                             / NUM_ITERATIONS);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2014 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
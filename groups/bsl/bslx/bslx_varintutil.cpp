@@ -0,0 +1,462 @@
+// bslx_varintutil.cpp                                                -*-C++-*-
+#include <bslx_varintutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bslx_varintutil_cpp,"$Id$ $CSID$")
+
+#include <bsls_platform.h>
+
+#include <bsl_cstring.h>
+
+#ifdef BSLX_VARINTUTIL_X86
+#error BSLX_VARINTUTIL_X86 must be a macro scoped locally to this file
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#define BSLX_VARINTUTIL_X86 1
+#include <emmintrin.h>
+#endif
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The array functions share two function templates, 'encodeArray' and
+// 'decodeArray', parameterized by a "transform" that maps between the values
+// of the array and the unsigned values actually marshalled (the identity, the
+// zig-zag encoding, or the zig-zag encoding of the difference from the
+// previous value).
+//
+// 'encodeArray' transforms the values in blocks of 'k_BLOCK_SIZE'; if every
+// value of a block is less than 128 (which is determined with a single test
+// of the bitwise OR of the block), the block is stored one byte per value
+// without further inspection.
+//
+// On x86-64 with GCC or Clang, 'decodeArray' gathers the most-significant
+// bits of 16 bytes at a time with the SSE2 'pmovmskb' instruction (SSE2 being
+// part of the x86-64 base instruction set, no run-time dispatch is needed).
+// If none is set, the 16 bytes are 16 complete values that are widened
+// without further tests.  Otherwise, the unset bits of the mask mark the
+// terminal bytes of the values that end among the 16 bytes, and those values
+// are located by repeatedly counting the trailing zero bits of the mask, with
+// no data-dependent loop over their bytes: a representation of at most 8
+// bytes is loaded as a single 64-bit word, and its seven-bit groups are
+// compacted with shifts and masks.  Consecutive values that are decoded in
+// this way do not depend on each other, which lets the processor overlap
+// their decoding.
+//
+// Elsewhere, and for the final bytes of the buffer, 'decodeArray' looks,
+// before decoding each value, for 8 bytes that have their most-significant
+// bit unset (with a single 64-bit load), widens them without further tests,
+// and decodes the value that follows them (if any) with 'getVarUint64'.
+
+namespace BloombergLP {
+namespace bslx {
+
+namespace {
+
+typedef bsls::Types::Int64  Int64;
+typedef bsls::Types::Uint64 Uint64;
+
+enum { k_BLOCK_SIZE = 8 };  // number of values tested at once when encoding
+
+                         // ========================
+                         // struct IdentityTransform
+                         // ========================
+
+struct IdentityTransform {
+    // This 'struct' maps unsigned values to themselves.
+
+    Uint64 encode(Uint64 value)
+        // Return the specified 'value'.
+    {
+        return value;
+    }
+
+    Uint64 decode(Uint64 value)
+        // Return the specified 'value'.
+    {
+        return value;
+    }
+};
+
+                          // ======================
+                          // struct ZigZagTransform
+                          // ======================
+
+struct ZigZagTransform {
+    // This 'struct' maps signed values to unsigned values by the zig-zag
+    // encoding.
+
+    Uint64 encode(Int64 value)
+        // Return the zig-zag encoding of the specified 'value'.
+    {
+        return VarIntUtil::zigZagEncode(value);
+    }
+
+    Int64 decode(Uint64 value)
+        // Return the signed value whose zig-zag encoding is the specified
+        // 'value'.
+    {
+        return VarIntUtil::zigZagDecode(value);
+    }
+};
+
+                          // =====================
+                          // struct DeltaTransform
+                          // =====================
+
+struct DeltaTransform {
+    // This 'struct' maps each of a sequence of signed values to the zig-zag
+    // encoding of its difference from the previous value of the sequence
+    // (computed modulo 2^64), the value preceding the first value being 0.
+
+    // DATA
+    Uint64 d_previous;  // previous value of the sequence
+
+    // CREATORS
+    DeltaTransform()
+        // Create a transform for a sequence yet to be started.
+    : d_previous(0)
+    {
+    }
+
+    // MANIPULATORS
+    Uint64 encode(Int64 value)
+        // Return the zig-zag encoding of the difference between the specified
+        // 'value' and the previous value of the sequence, and make 'value'
+        // the previous value.
+    {
+        const Uint64 current = static_cast<Uint64>(value);
+        const Uint64 delta   = current - d_previous;
+
+        d_previous = current;
+        return VarIntUtil::zigZagEncode(static_cast<Int64>(delta));
+    }
+
+    Int64 decode(Uint64 value)
+        // Return the sum of the previous value of the sequence and the signed
+        // value whose zig-zag encoding is the specified 'value', and make that
+        // sum the previous value.
+    {
+        d_previous += static_cast<Uint64>(VarIntUtil::zigZagDecode(value));
+        return static_cast<Int64>(d_previous);
+    }
+};
+
+                          // ---------------------
+                          // encoding and decoding
+                          // ---------------------
+
+template <class TYPE, class TRANSFORM>
+bsl::size_t encodeArray(char        *buffer,
+                        const TYPE  *values,
+                        int          numValues,
+                        TRANSFORM   *transform)
+    // Load into the specified 'buffer' the consecutive variable-length
+    // representations of each of the specified 'numValues' leading entries in
+    // the specified 'values', as mapped by the specified 'transform', and
+    // return the number of bytes loaded.  The behavior is undefined unless
+    // '0 <= numValues' and 'buffer' has a capacity of at least
+    // 'VarIntUtil::k_MAX_SIZEOF_VARINT64 * numValues' bytes.
+{
+    char *cursor = buffer;
+    int   i      = 0;
+
+    for (; i + k_BLOCK_SIZE <= numValues; i += k_BLOCK_SIZE) {
+        Uint64 block[k_BLOCK_SIZE];
+        Uint64 bits = 0;
+
+        for (int j = 0; j < k_BLOCK_SIZE; ++j) {
+            block[j] = transform->encode(values[i + j]);
+            bits    |= block[j];
+        }
+
+        if (bits < 0x80) {
+            for (int j = 0; j < k_BLOCK_SIZE; ++j) {
+                cursor[j] = static_cast<char>(block[j]);
+            }
+            cursor += k_BLOCK_SIZE;
+        }
+        else {
+            for (int j = 0; j < k_BLOCK_SIZE; ++j) {
+                cursor += VarIntUtil::putVarUint64(cursor, block[j]);
+            }
+        }
+    }
+
+    for (; i < numValues; ++i) {
+        cursor += VarIntUtil::putVarUint64(cursor,
+                                           transform->encode(values[i]));
+    }
+
+    return cursor - buffer;
+}
+
+inline
+int singleByteRunLength(const unsigned char *bytes, bsl::size_t numBytes)
+    // Return 8 if the specified 'bytes' of the specified 'numBytes' has at
+    // least 8 bytes, the first 8 of which have their most-significant bit
+    // unset, and 0 otherwise.
+{
+    if (8 <= numBytes) {
+        Uint64 word;
+        bsl::memcpy(&word, bytes, sizeof word);
+
+        return 0 == (word & 0x8080808080808080ULL) ? 8 : 0;           // RETURN
+    }
+    return 0;
+}
+
+#ifdef BSLX_VARINTUTIL_X86
+inline
+Uint64 gatherGroups(Uint64 word)
+    // Return the value whose consecutive seven-bit groups, least significant
+    // first, are the low-order seven bits of the consecutive bytes of the
+    // specified 'word', least significant first.
+{
+    return  (word        & 0x000000000000007fULL)
+          | ((word >> 1) & 0x0000000000003f80ULL)
+          | ((word >> 2) & 0x00000000001fc000ULL)
+          | ((word >> 3) & 0x000000000fe00000ULL)
+          | ((word >> 4) & 0x00000007f0000000ULL)
+          | ((word >> 5) & 0x000003f800000000ULL)
+          | ((word >> 6) & 0x0001fc0000000000ULL)
+          | ((word >> 7) & 0x00fe000000000000ULL);
+}
+#endif
+
+template <class TYPE, class TRANSFORM>
+int decodeArray(TYPE        *variables,
+                bsl::size_t *numBytesConsumed,
+                const char  *buffer,
+                bsl::size_t  numBytes,
+                int          numVariables,
+                TRANSFORM   *transform)
+    // Load into the specified 'variables' the specified 'numVariables'
+    // values, as mapped by the specified 'transform', whose consecutive
+    // variable-length representations are at the start of the specified
+    // 'buffer' of the specified 'numBytes', and load into the specified
+    // 'numBytesConsumed' the number of bytes of those representations.
+    // Return 0 on success, and a non-zero value otherwise.  The behavior is
+    // undefined unless '0 <= numVariables'.
+{
+    const unsigned char *cursor = reinterpret_cast<const unsigned char *>(
+                                                                       buffer);
+    const unsigned char *end    = cursor + numBytes;
+
+    int i = 0;
+
+#ifdef BSLX_VARINTUTIL_X86
+    while (i < numVariables && 16 <= end - cursor) {
+        const unsigned int mask = _mm_movemask_epi8(_mm_loadu_si128(
+                                   reinterpret_cast<const __m128i *>(cursor)));
+
+        if (0 == mask && 16 <= numVariables - i) {
+            for (int j = 0; j < 16; ++j) {
+                variables[i + j] = transform->decode(cursor[j]);
+            }
+            i      += 16;
+            cursor += 16;
+            continue;
+        }
+
+        // Decode every value whose terminal byte (i.e., a byte whose bit in
+        // 'mask' is unset) is among the 16 bytes at 'cursor'.
+
+        unsigned int terminals = ~mask & 0xffff;
+        if (0 == terminals) {
+            break;  // Let the portable loop diagnose the invalid value.
+        }
+
+        int position = 0;
+        do {
+            const int last   = __builtin_ctz(terminals);
+            const int length = last + 1 - position;
+
+            Uint64 value;
+            if (1 == length) {
+                value = cursor[position];
+            }
+            else if (length <= 8 && 8 <= end - cursor - position) {
+                Uint64 word;
+                bsl::memcpy(&word, cursor + position, sizeof word);
+                value = gatherGroups(word & (~0ULL >> (64 - 8 * length)));
+            }
+            else if (0 == VarIntUtil::getVarUint64(
+                          &value,
+                          reinterpret_cast<const char *>(cursor + position),
+                          length)) {
+                return -1;                                            // RETURN
+            }
+
+            variables[i++] = transform->decode(value);
+            position       = last + 1;
+            terminals     &= terminals - 1;
+        } while (0 != terminals && i < numVariables);
+
+        cursor += position;
+    }
+#endif
+
+    while (i < numVariables) {
+        int run = singleByteRunLength(cursor, end - cursor);
+        if (run > numVariables - i) {
+            run = numVariables - i;
+        }
+
+        for (int j = 0; j < run; ++j) {
+            variables[i + j] = transform->decode(cursor[j]);
+        }
+        i      += run;
+        cursor += run;
+
+        if (i == numVariables) {
+            break;
+        }
+
+        Uint64    value;
+        const int length = VarIntUtil::getVarUint64(
+                                    &value,
+                                    reinterpret_cast<const char *>(cursor),
+                                    end - cursor);
+        if (0 == length) {
+            return -1;                                                // RETURN
+        }
+        variables[i++] = transform->decode(value);
+        cursor += length;
+    }
+
+    *numBytesConsumed = cursor - reinterpret_cast<const unsigned char *>(
+                                                                       buffer);
+    return 0;
+}
+
+}  // close unnamed namespace
+
+                           // -----------------
+                           // struct VarIntUtil
+                           // -----------------
+
+// CLASS METHODS
+
+                        // *** put arrays of integral values ***
+
+bsl::size_t VarIntUtil::putArrayVarUint64(char                      *buffer,
+                                          const bsls::Types::Uint64 *values,
+                                          int                        numValues)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    IdentityTransform transform;
+    return encodeArray(buffer, values, numValues, &transform);
+}
+
+bsl::size_t VarIntUtil::putArrayVarInt64(char                     *buffer,
+                                         const bsls::Types::Int64 *values,
+                                         int                       numValues)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    ZigZagTransform transform;
+    return encodeArray(buffer, values, numValues, &transform);
+}
+
+bsl::size_t VarIntUtil::putDeltaArrayVarInt64(
+                                       char                     *buffer,
+                                       const bsls::Types::Int64 *values,
+                                       int                       numValues)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(values || 0 == numValues);
+    BSLS_ASSERT(0 <= numValues);
+
+    DeltaTransform transform;
+    return encodeArray(buffer, values, numValues, &transform);
+}
+
+                        // *** get arrays of integral values ***
+
+int VarIntUtil::getArrayVarUint64(bsls::Types::Uint64 *variables,
+                                  bsl::size_t         *numBytesConsumed,
+                                  const char          *buffer,
+                                  bsl::size_t          numBytes,
+                                  int                  numVariables)
+{
+    BSLS_ASSERT(variables || 0 == numVariables);
+    BSLS_ASSERT(numBytesConsumed);
+    BSLS_ASSERT(buffer || 0 == numBytes);
+    BSLS_ASSERT(0 <= numVariables);
+
+    IdentityTransform transform;
+    return decodeArray(variables,
+                       numBytesConsumed,
+                       buffer,
+                       numBytes,
+                       numVariables,
+                       &transform);
+}
+
+int VarIntUtil::getArrayVarInt64(bsls::Types::Int64 *variables,
+                                 bsl::size_t        *numBytesConsumed,
+                                 const char         *buffer,
+                                 bsl::size_t         numBytes,
+                                 int                 numVariables)
+{
+    BSLS_ASSERT(variables || 0 == numVariables);
+    BSLS_ASSERT(numBytesConsumed);
+    BSLS_ASSERT(buffer || 0 == numBytes);
+    BSLS_ASSERT(0 <= numVariables);
+
+    ZigZagTransform transform;
+    return decodeArray(variables,
+                       numBytesConsumed,
+                       buffer,
+                       numBytes,
+                       numVariables,
+                       &transform);
+}
+
+int VarIntUtil::getDeltaArrayVarInt64(bsls::Types::Int64 *variables,
+                                      bsl::size_t        *numBytesConsumed,
+                                      const char         *buffer,
+                                      bsl::size_t         numBytes,
+                                      int                 numVariables)
+{
+    BSLS_ASSERT(variables || 0 == numVariables);
+    BSLS_ASSERT(numBytesConsumed);
+    BSLS_ASSERT(buffer || 0 == numBytes);
+    BSLS_ASSERT(0 <= numVariables);
+
+    DeltaTransform transform;
+    return decodeArray(variables,
+                       numBytesConsumed,
+                       buffer,
+                       numBytes,
+                       numVariables,
+                       &transform);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#undef BSLX_VARINTUTIL_X86
+
+// ----------------------------------------------------------------------------
+// Copyright 2014 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,454 @@
+// bslx_varintutil.h                                                  -*-C++-*-
+#ifndef INCLUDED_BSLX_VARINTUTIL
+#define INCLUDED_BSLX_VARINTUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Support compact variable-length marshalling of integer values.
+//
+//@CLASSES:
+//   bslx::VarIntUtil: namespace for variable-length integer functions
+//
+//@SEE_ALSO: bslx_marshallingutil, bslx_byteoutstream, bslx_byteinstream
+//
+//@DESCRIPTION: This component provides a byte-array-based implementation,
+// 'bslx::VarIntUtil', for a suite of functions used to marshal 64-bit integer
+// values (and arrays of such values) to and from a compact, variable-length
+// representation.  Unlike the fixed-width representations supported by
+// 'bslx::MarshallingUtil', where each value occupies the same number of bytes
+// regardless of its magnitude, the number of bytes occupied by a value in
+// this representation grows with its magnitude, so that small values (such as
+// counts, sequence deltas, and enumerator codes) occupy a single byte.
+//
+///Variable-Length Format
+///----------------------
+// An unsigned 64-bit value is marshalled in the (unsigned) LEB128 format: the
+// value is split into groups of seven bits, and the groups are written, least
+// significant first, one per byte, in the low-order seven bits of that byte.
+// The most-significant bit of each byte is set if, and only if, another byte
+// follows.  A value therefore occupies between one byte (for values less than
+// 128) and 'k_MAX_SIZEOF_VARINT64' (10) bytes:
+//..
+//      VALUE RANGE                     BYTES
+//      -----------                     -----
+//      [     0 ..  2^7 - 1 ]           1
+//      [   2^7 .. 2^14 - 1 ]           2
+//      [  2^14 .. 2^21 - 1 ]           3
+//      ...                             ...
+//      [  2^63 .. 2^64 - 1 ]           10
+//..
+// A signed 64-bit value is first mapped to an unsigned value using the
+// "zig-zag" encoding, which interleaves non-negative and negative values
+// (0 -> 0, -1 -> 1, 1 -> 2, -2 -> 3, ...), so that values of small magnitude,
+// whatever their sign, also occupy few bytes.
+//
+// Decoding functions accept any sequence of at most 10 bytes terminated by a
+// byte whose most-significant bit is unset, provided the value so represented
+// fits in 64 bits.  A sequence that is not terminated within the supplied
+// buffer, that exceeds 10 bytes, or that represents a value of more than 64
+// bits, is rejected.
+//
+///Delta Encoding
+///--------------
+// The 'putDeltaArrayVarInt64' and 'getDeltaArrayVarInt64' functions marshal
+// an array of signed values as the zig-zag encoding of the first value,
+// followed by the zig-zag encodings of the differences between each value and
+// its predecessor (computed modulo 2^64).  For sorted (or nearly sorted)
+// sequences, such as timestamps or identifiers, the differences are typically
+// much smaller than the values themselves, and the encoding correspondingly
+// more compact.  Any sequence of values, sorted or not, is represented
+// exactly.
+//
+///Stream Support
+///--------------
+// 'bslx::ByteOutStream' and 'bslx::ByteInStream' provide methods (e.g.,
+// 'putArrayVarUint64' and 'getArrayVarUint64') that write and read these
+// representations.  Note that the variable-length representation is never
+// selected implicitly: the BDEX representation of a type (and, in particular,
+// of fundamental types and of 'bsl::vector') is unchanged, and a type opting
+// into the more compact representation must do so explicitly in (a new
+// version of) its 'bdexStreamOut' and 'bdexStreamIn' methods.
+//
+///Performance
+///-----------
+// The array functions recognize runs of values that each occupy a single byte
+// and process such runs several values at a time: on x86-64 platforms the
+// decoding functions inspect 16 bytes with a single SSE2 instruction, and
+// elsewhere 8 bytes with a single 64-bit load.  Arrays dominated by small
+// values (or by small differences, for the delta functions) are therefore
+// encoded and decoded at a small multiple of the cost of copying them.  On
+// x86-64 platforms, the decoding functions additionally locate the multi-byte
+// values among those 16 bytes from the same instruction, and decode each of
+// them without a loop over its bytes.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Round-Trip Marshalling
+///- - - - - - - - - - - - - - - - -
+// In this example, we marshal a signed value and a sorted array of
+// identifiers into a buffer, and then unmarshal them back.  First, we declare
+// the data to be marshalled, and a buffer that is sufficiently large to hold
+// the encoding of any four values:
+//..
+//  const bsls::Types::Int64 value = -3;
+//  const bsls::Types::Int64 ids[] = { 1000000, 1000001, 1000003 };
+//
+//  char buffer[4 * bslx::VarIntUtil::k_MAX_SIZEOF_VARINT64];
+//..
+// Then, we marshal the data into the 'buffer', and observe that it occupies
+// only six bytes, rather than the 32 bytes of a fixed-width representation:
+//..
+//  bsl::size_t numBytes = bslx::VarIntUtil::putVarInt64(buffer, value);
+//  numBytes += bslx::VarIntUtil::putDeltaArrayVarInt64(buffer + numBytes,
+//                                                      ids,
+//                                                      3);
+//  assert(6 == numBytes);
+//..
+// Next, we declare variables to hold the values to be extracted from the
+// 'buffer':
+//..
+//  bsls::Types::Int64 newValue = 0;
+//  bsls::Types::Int64 newIds[] = { 0, 0, 0 };
+//..
+// Finally, we unmarshal the data from the 'buffer', verifying that each
+// function succeeds, and confirm that the round trip preserved the values:
+//..
+//  const int valueBytes = bslx::VarIntUtil::getVarInt64(&newValue,
+//                                                       buffer,
+//                                                       numBytes);
+//  assert(1 == valueBytes);
+//
+//  bsl::size_t idsBytes = 0;
+//  const int   rc       = bslx::VarIntUtil::getDeltaArrayVarInt64(
+//                                                     newIds,
+//                                                     &idsBytes,
+//                                                     buffer + valueBytes,
+//                                                     numBytes - valueBytes,
+//                                                     3);
+//  assert(0 == rc);
+//  assert(5 == idsBytes);
+//
+//  assert(newValue  == value);
+//  assert(newIds[0] == ids[0]);
+//  assert(newIds[1] == ids[1]);
+//  assert(newIds[2] == ids[2]);
+//..
+
+#ifndef INCLUDED_BSLSCM_VERSION
+#include <bslscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+namespace BloombergLP {
+namespace bslx {
+
+                           // =================
+                           // struct VarIntUtil
+                           // =================
+
+struct VarIntUtil {
+    // This 'struct' provides a namespace for a suite of functions that
+    // facilitate the marshalling of 64-bit integer values, and C-style arrays
+    // of such values, in a compact, variable-length, platform-neutral
+    // representation.
+
+    // TYPES
+    enum {
+        k_MAX_SIZEOF_VARINT64 = 10  // maximum number of bytes occupied by the
+                                    // variable-length representation of a
+                                    // 64-bit value
+    };
+
+    // CLASS METHODS
+    static int encodedLength(bsls::Types::Uint64 value);
+        // Return the number of bytes occupied by the variable-length
+        // representation of the specified 'value'.  Note that the returned
+        // value is in the range '[1 .. k_MAX_SIZEOF_VARINT64]'.
+
+    static bsls::Types::Uint64 zigZagEncode(bsls::Types::Int64 value);
+        // Return the unsigned value to which the specified 'value' is mapped
+        // by the zig-zag encoding.
+
+    static bsls::Types::Int64 zigZagDecode(bsls::Types::Uint64 value);
+        // Return the signed value that is mapped to the specified 'value' by
+        // the zig-zag encoding.
+
+                        // *** put scalar integral values ***
+
+    static int putVarUint64(char *buffer, bsls::Types::Uint64 value);
+        // Load into the specified 'buffer' the variable-length representation
+        // of the specified 'value', and return the number of bytes loaded.
+        // The behavior is undefined unless 'buffer' has a capacity of at
+        // least 'encodedLength(value)' bytes.
+
+    static int putVarInt64(char *buffer, bsls::Types::Int64 value);
+        // Load into the specified 'buffer' the variable-length representation
+        // of the zig-zag encoding of the specified 'value', and return the
+        // number of bytes loaded.  The behavior is undefined unless 'buffer'
+        // has a capacity of at least 'encodedLength(zigZagEncode(value))'
+        // bytes.
+
+                        // *** get scalar integral values ***
+
+    static int getVarUint64(bsls::Types::Uint64 *variable,
+                            const char          *buffer,
+                            bsl::size_t          numBytes);
+        // Load into the specified 'variable' the value whose variable-length
+        // representation is at the start of the specified 'buffer' of the
+        // specified 'numBytes', and return the number of bytes of that
+        // representation.  Return 0, with no effect on 'variable', if the
+        // initial bytes of 'buffer' are not a valid representation (see
+        // {Variable-Length Format}).  The behavior is undefined unless
+        // 'buffer' has at least 'numBytes' bytes.
+
+    static int getVarInt64(bsls::Types::Int64 *variable,
+                           const char         *buffer,
+                           bsl::size_t         numBytes);
+        // Load into the specified 'variable' the value whose zig-zag encoding
+        // has its variable-length representation at the start of the
+        // specified 'buffer' of the specified 'numBytes', and return the
+        // number of bytes of that representation.  Return 0, with no effect on
+        // 'variable', if the initial bytes of 'buffer' are not a valid
+        // representation (see {Variable-Length Format}).  The behavior is
+        // undefined unless 'buffer' has at least 'numBytes' bytes.
+
+                        // *** put arrays of integral values ***
+
+    static bsl::size_t putArrayVarUint64(char                      *buffer,
+                                         const bsls::Types::Uint64 *values,
+                                         int                        numValues);
+        // Load into the specified 'buffer' the consecutive variable-length
+        // representations of each of the specified 'numValues' leading
+        // entries in the specified 'values', and return the number of bytes
+        // loaded.  The behavior is undefined unless '0 <= numValues', 'values'
+        // has sufficient contents, and 'buffer' has a capacity of at least
+        // 'k_MAX_SIZEOF_VARINT64 * numValues' bytes.
+
+    static bsl::size_t putArrayVarInt64(char                     *buffer,
+                                        const bsls::Types::Int64 *values,
+                                        int                       numValues);
+        // Load into the specified 'buffer' the consecutive variable-length
+        // representations of the zig-zag encodings of each of the specified
+        // 'numValues' leading entries in the specified 'values', and return
+        // the number of bytes loaded.  The behavior is undefined unless
+        // '0 <= numValues', 'values' has sufficient contents, and 'buffer' has
+        // a capacity of at least 'k_MAX_SIZEOF_VARINT64 * numValues' bytes.
+
+    static bsl::size_t putDeltaArrayVarInt64(
+                                       char                     *buffer,
+                                       const bsls::Types::Int64 *values,
+                                       int                       numValues);
+        // Load into the specified 'buffer' the consecutive variable-length
+        // representations of the zig-zag encodings of the first of the
+        // specified 'numValues' leading entries in the specified 'values', and
+        // of the difference between each subsequent entry and its predecessor
+        // (see {Delta Encoding}), and return the number of bytes loaded.  The
+        // behavior is undefined unless '0 <= numValues', 'values' has
+        // sufficient contents, and 'buffer' has a capacity of at least
+        // 'k_MAX_SIZEOF_VARINT64 * numValues' bytes.
+
+                        // *** get arrays of integral values ***
+
+    static int getArrayVarUint64(bsls::Types::Uint64 *variables,
+                                 bsl::size_t         *numBytesConsumed,
+                                 const char          *buffer,
+                                 bsl::size_t          numBytes,
+                                 int                  numVariables);
+        // Load into the specified 'variables' the specified 'numVariables'
+        // values whose consecutive variable-length representations are at the
+        // start of the specified 'buffer' of the specified 'numBytes', and
+        // load into the specified 'numBytesConsumed' the number of bytes of
+        // those representations.  Return 0 on success, and a non-zero value
+        // (with the contents of 'variables' and 'numBytesConsumed' undefined)
+        // if the initial bytes of 'buffer' are not 'numVariables' valid
+        // representations (see {Variable-Length Format}).  The behavior is
+        // undefined unless '0 <= numVariables', 'variables' has sufficient
+        // capacity, and 'buffer' has at least 'numBytes' bytes.
+
+    static int getArrayVarInt64(bsls::Types::Int64 *variables,
+                                bsl::size_t        *numBytesConsumed,
+                                const char         *buffer,
+                                bsl::size_t         numBytes,
+                                int                 numVariables);
+        // Load into the specified 'variables' the specified 'numVariables'
+        // values whose zig-zag encodings have consecutive variable-length
+        // representations at the start of the specified 'buffer' of the
+        // specified 'numBytes', and load into the specified
+        // 'numBytesConsumed' the number of bytes of those representations.
+        // Return 0 on success, and a non-zero value (with the contents of
+        // 'variables' and 'numBytesConsumed' undefined) if the initial bytes
+        // of 'buffer' are not 'numVariables' valid representations (see
+        // {Variable-Length Format}).  The behavior is undefined unless
+        // '0 <= numVariables', 'variables' has sufficient capacity, and
+        // 'buffer' has at least 'numBytes' bytes.
+
+    static int getDeltaArrayVarInt64(bsls::Types::Int64 *variables,
+                                     bsl::size_t        *numBytesConsumed,
+                                     const char         *buffer,
+                                     bsl::size_t         numBytes,
+                                     int                 numVariables);
+        // Load into the specified 'variables' the specified 'numVariables'
+        // values whose delta encoding (see {Delta Encoding}) is at the start
+        // of the specified 'buffer' of the specified 'numBytes', and load into
+        // the specified 'numBytesConsumed' the number of bytes of that
+        // encoding.  Return 0 on success, and a non-zero value (with the
+        // contents of 'variables' and 'numBytesConsumed' undefined) if the
+        // initial bytes of 'buffer' are not 'numVariables' valid
+        // representations (see {Variable-Length Format}).  The behavior is
+        // undefined unless '0 <= numVariables', 'variables' has sufficient
+        // capacity, and 'buffer' has at least 'numBytes' bytes.
+};
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                           // -----------------
+                           // struct VarIntUtil
+                           // -----------------
+
+// CLASS METHODS
+inline
+int VarIntUtil::encodedLength(bsls::Types::Uint64 value)
+{
+    int length = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        ++length;
+    }
+    return length;
+}
+
+inline
+bsls::Types::Uint64 VarIntUtil::zigZagEncode(bsls::Types::Int64 value)
+{
+    const bsls::Types::Uint64 bits = static_cast<bsls::Types::Uint64>(value);
+
+    return (bits << 1) ^ (0 - (bits >> 63));
+}
+
+inline
+bsls::Types::Int64 VarIntUtil::zigZagDecode(bsls::Types::Uint64 value)
+{
+    return static_cast<bsls::Types::Int64>((value >> 1) ^ (0 - (value & 1)));
+}
+
+                        // *** put scalar integral values ***
+
+inline
+int VarIntUtil::putVarUint64(char *buffer, bsls::Types::Uint64 value)
+{
+    BSLS_ASSERT_SAFE(buffer);
+
+    unsigned char *const begin  = reinterpret_cast<unsigned char *>(buffer);
+    unsigned char       *cursor = begin;
+
+    while (value >= 0x80) {
+        *cursor++ = static_cast<unsigned char>(value | 0x80);
+        value >>= 7;
+    }
+    *cursor++ = static_cast<unsigned char>(value);
+
+    return static_cast<int>(cursor - begin);
+}
+
+inline
+int VarIntUtil::putVarInt64(char *buffer, bsls::Types::Int64 value)
+{
+    BSLS_ASSERT_SAFE(buffer);
+
+    return putVarUint64(buffer, zigZagEncode(value));
+}
+
+                        // *** get scalar integral values ***
+
+inline
+int VarIntUtil::getVarUint64(bsls::Types::Uint64 *variable,
+                             const char          *buffer,
+                             bsl::size_t          numBytes)
+{
+    BSLS_ASSERT_SAFE(variable);
+    BSLS_ASSERT_SAFE(buffer || 0 == numBytes);
+
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(
+                                                                       buffer);
+    const int            limit =
+                  numBytes < static_cast<bsl::size_t>(k_MAX_SIZEOF_VARINT64)
+                  ? static_cast<int>(numBytes)
+                  : static_cast<int>(k_MAX_SIZEOF_VARINT64);
+
+    bsls::Types::Uint64 value = 0;
+
+    for (int i = 0; i < limit; ++i) {
+        const bsls::Types::Uint64 byte = bytes[i];
+
+        value |= (byte & 0x7f) << (7 * i);
+
+        if (byte < 0x80) {
+            // The last of the 10 bytes may contribute only the
+            // most-significant bit of the value.
+
+            if (k_MAX_SIZEOF_VARINT64 - 1 == i && 1 < byte) {
+                return 0;                                             // RETURN
+            }
+            *variable = value;
+            return i + 1;                                             // RETURN
+        }
+    }
+
+    return 0;
+}
+
+inline
+int VarIntUtil::getVarInt64(bsls::Types::Int64 *variable,
+                            const char         *buffer,
+                            bsl::size_t         numBytes)
+{
+    BSLS_ASSERT_SAFE(variable);
+    BSLS_ASSERT_SAFE(buffer || 0 == numBytes);
+
+    bsls::Types::Uint64 value;
+    const int           length = getVarUint64(&value, buffer, numBytes);
+
+    if (length) {
+        *variable = zigZagDecode(value);
+    }
+    return length;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2014 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
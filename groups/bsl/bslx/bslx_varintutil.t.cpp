@@ -0,0 +1,1188 @@
+// bslx_varintutil.t.cpp                                              -*-C++-*-
+
+#include <bslx_varintutil.h>
+
+#include <bslx_marshallingutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+using namespace bslx;
+
+// ============================================================================
+//                              TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// We are testing a suite of independent functions.  The scalar functions are
+// verified with table-driven tests against hand-computed encodings, including
+// every boundary at which the length of an encoding changes, and against
+// malformed input.  The array functions are verified to produce exactly the
+// concatenation of the corresponding scalar encodings, and to decode it back,
+// for arrays whose lengths and contents exercise both the block-at-a-time
+// fast paths and their fallbacks.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int encodedLength(Uint64 value);
+// [ 2] Uint64 zigZagEncode(Int64 value);
+// [ 2] Int64 zigZagDecode(Uint64 value);
+// [ 3] int putVarUint64(char *buffer, Uint64 value);
+// [ 3] int putVarInt64(char *buffer, Int64 value);
+// [ 4] int getVarUint64(Uint64 *var, const char *buffer, size_t numBytes);
+// [ 4] int getVarInt64(Int64 *var, const char *buffer, size_t numBytes);
+// [ 5] size_t putArrayVarUint64(char *buf, const Uint64 *ary, int count);
+// [ 5] size_t putArrayVarInt64(char *buf, const Int64 *ary, int count);
+// [ 5] int getArrayVarUint64(Uint64 *, size_t *, const char *, ...);
+// [ 5] int getArrayVarInt64(Int64 *, size_t *, const char *, ...);
+// [ 6] size_t putDeltaArrayVarInt64(char *, const Int64 *, int);
+// [ 6] int getDeltaArrayVarInt64(Int64 *, size_t *, const char *, ...);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define Q   BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P   BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_  BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef VarIntUtil          Util;
+typedef bsls::Types::Int64  Int64;
+typedef bsls::Types::Uint64 Uint64;
+
+const Int64  k_INT64_MIN  = static_cast<Int64>(0x8000000000000000ULL);
+const Int64  k_INT64_MAX  = static_cast<Int64>(0x7fffffffffffffffULL);
+const Uint64 k_UINT64_MAX = 0xffffffffffffffffULL;
+
+const int k_MAX = Util::k_MAX_SIZEOF_VARINT64;
+
+// ============================================================================
+//                      SUPPLEMENTARY TEST FUNCTIONALITY
+// ----------------------------------------------------------------------------
+
+static Uint64 nextRandom(Uint64 *state)
+    // Advance the specified 'state' of a linear congruential generator and
+    // return its next value.
+{
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return *state;
+}
+
+static Uint64 randomValue(Uint64 *state, int maxBits)
+    // Return a pseudo-random value, obtained from the generator having the
+    // specified 'state', whose number of significant bits is itself uniformly
+    // distributed in the range '[0 .. maxBits]'.  The behavior is undefined
+    // unless '0 <= maxBits <= 64'.
+{
+    const int bits = static_cast<int>((nextRandom(state) >> 32)
+                                                             % (maxBits + 1));
+    if (0 == bits) {
+        return 0;                                                     // RETURN
+    }
+    return nextRandom(state) >> (64 - bits);
+}
+
+static bsl::size_t encodeEach(char *buffer, const Uint64 *values, int n)
+    // Load into the specified 'buffer' the consecutive encodings, using
+    // 'putVarUint64', of the specified 'n' leading entries of the specified
+    // 'values', and return the number of bytes loaded.
+{
+    bsl::size_t length = 0;
+    for (int i = 0; i < n; ++i) {
+        length += Util::putVarUint64(buffer + length, values[i]);
+    }
+    return length;
+}
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Round-Trip Marshalling
+///- - - - - - - - - - - - - - - - -
+// In this example, we marshal a signed value and a sorted array of
+// identifiers into a buffer, and then unmarshal them back.  First, we declare
+// the data to be marshalled, and a buffer that is sufficiently large to hold
+// the encoding of any four values:
+//..
+    const bsls::Types::Int64 value = -3;
+    const bsls::Types::Int64 ids[] = { 1000000, 1000001, 1000003 };
+
+    char buffer[4 * bslx::VarIntUtil::k_MAX_SIZEOF_VARINT64];
+//..
+// Then, we marshal the data into the 'buffer', and observe that it occupies
+// only six bytes, rather than the 32 bytes of a fixed-width representation:
+//..
+    bsl::size_t numBytes = bslx::VarIntUtil::putVarInt64(buffer, value);
+    numBytes += bslx::VarIntUtil::putDeltaArrayVarInt64(buffer + numBytes,
+                                                        ids,
+                                                        3);
+    ASSERT(6 == numBytes);
+//..
+// Next, we declare variables to hold the values to be extracted from the
+// 'buffer':
+//..
+    bsls::Types::Int64 newValue = 0;
+    bsls::Types::Int64 newIds[] = { 0, 0, 0 };
+//..
+// Finally, we unmarshal the data from the 'buffer', verifying that each
+// function succeeds, and confirm that the round trip preserved the values:
+//..
+    const int valueBytes = bslx::VarIntUtil::getVarInt64(&newValue,
+                                                         buffer,
+                                                         numBytes);
+    ASSERT(1 == valueBytes);
+
+    bsl::size_t idsBytes = 0;
+    const int   rc       = bslx::VarIntUtil::getDeltaArrayVarInt64(
+                                                       newIds,
+                                                       &idsBytes,
+                                                       buffer + valueBytes,
+                                                       numBytes - valueBytes,
+                                                       3);
+    ASSERT(0 == rc);
+    ASSERT(5 == idsBytes);
+
+    ASSERT(newValue  == value);
+    ASSERT(newIds[0] == ids[0]);
+    ASSERT(newIds[1] == ids[1]);
+    ASSERT(newIds[2] == ids[2]);
+//..
+
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // DELTA ARRAY FUNCTIONS
+        //   Ensure sequences are delta-encoded and decoded correctly.
+        //
+        // Concerns:
+        //: 1 The encoding of an array is the concatenation of the zig-zag
+        //:   encodings of its first value and of the differences between
+        //:   consecutive values.
+        //:
+        //: 2 The decoding functions restore the original values, including
+        //:   for unsorted sequences and sequences whose differences overflow
+        //:   (and wrap modulo 2^64).
+        //:
+        //: 3 Sorted sequences with small differences occupy about one byte per
+        //:   value.
+        //:
+        //: 4 Truncated input is rejected.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For a set of sequences, including sorted, unsorted, and extreme
+        //:   sequences, compute the expected encoding with 'putVarInt64', and
+        //:   compare it with that produced by 'putDeltaArrayVarInt64'; decode
+        //:   it and compare with the original sequence.  (C-1..3)
+        //:
+        //: 2 Decode every proper prefix of an encoding and verify failure.
+        //:   (C-4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   size_t putDeltaArrayVarInt64(char *, const Int64 *, int);
+        //   int getDeltaArrayVarInt64(Int64 *, size_t *, const char *, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DELTA ARRAY FUNCTIONS" << endl
+                          << "=====================" << endl;
+
+        const int k_NUM_SEQUENCES = 6;
+        const int k_LENGTH        = 100;
+
+        for (int si = 0; si < k_NUM_SEQUENCES; ++si) {
+            Int64  values[k_LENGTH];
+            Uint64 state = si + 1;
+
+            for (int i = 0; i < k_LENGTH; ++i) {
+                switch (si) {
+                  case 0: {  // sorted, small steps from a large base
+                    values[i] = 1500000000000LL + 3 * i;
+                  } break;
+                  case 1: {  // sorted, random steps
+                    values[i] = (i ? values[i - 1] : 0)
+                              + static_cast<Int64>(randomValue(&state, 10));
+                  } break;
+                  case 2: {  // unsorted, random
+                    values[i] = static_cast<Int64>(randomValue(&state, 64));
+                  } break;
+                  case 3: {  // alternating extremes
+                    values[i] = i % 2 ? k_INT64_MAX : k_INT64_MIN;
+                  } break;
+                  case 4: {  // decreasing
+                    values[i] = -i;
+                  } break;
+                  default: {  // constant
+                    values[i] = 42;
+                  } break;
+                }
+            }
+
+            for (int n = 0; n <= k_LENGTH; n += (n < 20 ? 1 : 17)) {
+                char expected[k_LENGTH * k_MAX];
+                char encoded[k_LENGTH * k_MAX];
+
+                bsl::size_t expLength = 0;
+                for (int i = 0; i < n; ++i) {
+                    const Uint64 delta = static_cast<Uint64>(values[i])
+                                  - (i ? static_cast<Uint64>(values[i - 1])
+                                       : 0);
+                    expLength += Util::putVarInt64(expected + expLength,
+                                                   static_cast<Int64>(delta));
+                }
+
+                const bsl::size_t length = Util::putDeltaArrayVarInt64(
+                                                                      encoded,
+                                                                      values,
+                                                                      n);
+                LOOP2_ASSERT(si, n, expLength == length);
+                LOOP2_ASSERT(si, n, 0 == bsl::memcmp(expected,
+                                                     encoded,
+                                                     length));
+
+                if (0 == si && 0 < n) {
+                    LOOP_ASSERT(n, length == n - 1u + 6u);
+                }
+
+                Int64       decoded[k_LENGTH];
+                bsl::size_t consumed = 0;
+
+                LOOP2_ASSERT(si, n, 0 == Util::getDeltaArrayVarInt64(
+                                                                decoded,
+                                                                &consumed,
+                                                                encoded,
+                                                                length,
+                                                                n));
+                LOOP2_ASSERT(si, n, length == consumed);
+                for (int i = 0; i < n; ++i) {
+                    LOOP3_ASSERT(si, n, i, values[i] == decoded[i]);
+                }
+
+                for (bsl::size_t len = 0; len < length; ++len) {
+                    LOOP3_ASSERT(si, n, len,
+                                 0 != Util::getDeltaArrayVarInt64(decoded,
+                                                                  &consumed,
+                                                                  encoded,
+                                                                  len,
+                                                                  n));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char        buffer[k_MAX] = { 0 };
+            Int64       values[1] = { 0 };
+            bsl::size_t consumed;
+
+            ASSERT_PASS(Util::putDeltaArrayVarInt64(buffer, values, 1));
+            ASSERT_FAIL(Util::putDeltaArrayVarInt64(0, values, 1));
+            ASSERT_FAIL(Util::putDeltaArrayVarInt64(buffer, 0, 1));
+            ASSERT_FAIL(Util::putDeltaArrayVarInt64(buffer, values, -1));
+
+            ASSERT_PASS(Util::getDeltaArrayVarInt64(values,
+                                                    &consumed,
+                                                    buffer,
+                                                    1,
+                                                    1));
+            ASSERT_FAIL(Util::getDeltaArrayVarInt64(0,
+                                                    &consumed,
+                                                    buffer,
+                                                    1,
+                                                    1));
+            ASSERT_FAIL(Util::getDeltaArrayVarInt64(values,
+                                                    0,
+                                                    buffer,
+                                                    1,
+                                                    1));
+            ASSERT_FAIL(Util::getDeltaArrayVarInt64(values,
+                                                    &consumed,
+                                                    0,
+                                                    1,
+                                                    1));
+            ASSERT_FAIL(Util::getDeltaArrayVarInt64(values,
+                                                    &consumed,
+                                                    buffer,
+                                                    1,
+                                                    -1));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ARRAY FUNCTIONS
+        //   Ensure arrays are encoded and decoded correctly.
+        //
+        // Concerns:
+        //: 1 The encoding of an array is the concatenation of the encodings of
+        //:   its values, whether or not the values are handled by the
+        //:   single-byte fast paths.
+        //:
+        //: 2 The decoding functions restore the original values, and report
+        //:   the number of bytes consumed, when the buffer holds more bytes
+        //:   than the encoding.
+        //:
+        //: 3 Truncated or malformed input is rejected wherever it occurs in
+        //:   the array.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 For arrays of every length up to 40, and of selected greater
+        //:   lengths, whose values are either all small, all random, or small
+        //:   with sparse large values, compare the encoding produced by the
+        //:   array functions with that produced by the scalar functions, and
+        //:   decode it (followed by trailing bytes) back.  (C-1..2)
+        //:
+        //: 2 Decode every proper prefix of selected encodings, and encodings
+        //:   with a corrupted terminal byte, and verify failure.  (C-3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   size_t putArrayVarUint64(char *buf, const Uint64 *ary, int count);
+        //   size_t putArrayVarInt64(char *buf, const Int64 *ary, int count);
+        //   int getArrayVarUint64(Uint64 *, size_t *, const char *, ...);
+        //   int getArrayVarInt64(Int64 *, size_t *, const char *, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ARRAY FUNCTIONS" << endl
+                          << "===============" << endl;
+
+        const int k_MAX_LENGTH = 300;
+        const int k_TRAILER    = 20;
+
+        for (int mode = 0; mode < 3; ++mode) {
+            for (int n = 0; n <= k_MAX_LENGTH; n += (n < 40 ? 1 : 37)) {
+                Uint64 state = n * 3 + mode + 1;
+
+                bsl::vector<Uint64> values(n + 1);
+                bsl::vector<Int64>  signedValues(n + 1);
+
+                for (int i = 0; i < n; ++i) {
+                    switch (mode) {
+                      case 0: {
+                        values[i] = randomValue(&state, 7);
+                      } break;
+                      case 1: {
+                        values[i] = randomValue(&state, 64);
+                      } break;
+                      default: {
+                        values[i] = i % 11 == 5 ? randomValue(&state, 64)
+                                                : randomValue(&state, 7);
+                      } break;
+                    }
+                    signedValues[i] = i % 2
+                                      ? static_cast<Int64>(values[i])
+                                      : -static_cast<Int64>(values[i] >> 1);
+                }
+
+                bsl::vector<char> expected(n * k_MAX + 1);
+                bsl::vector<char> encoded(n * k_MAX + k_TRAILER);
+
+                // Unsigned values.
+
+                const bsl::size_t expLength = encodeEach(&expected[0],
+                                                         &values[0],
+                                                         n);
+                const bsl::size_t length = Util::putArrayVarUint64(
+                                                                  &encoded[0],
+                                                                  &values[0],
+                                                                  n);
+                LOOP2_ASSERT(mode, n, expLength == length);
+                LOOP2_ASSERT(mode, n, 0 == bsl::memcmp(&expected[0],
+                                                       &encoded[0],
+                                                       length));
+
+                // Follow the encoding with bytes that would be decodable as
+                // further (single-byte) values.
+
+                bsl::memset(&encoded[length], 0x01, k_TRAILER);
+
+                bsl::vector<Uint64> decoded(n + 1, 99);
+                bsl::size_t         consumed = 0;
+
+                LOOP2_ASSERT(mode, n, 0 == Util::getArrayVarUint64(
+                                                         &decoded[0],
+                                                         &consumed,
+                                                         &encoded[0],
+                                                         length + k_TRAILER,
+                                                         n));
+                LOOP2_ASSERT(mode, n, length == consumed);
+                for (int i = 0; i < n; ++i) {
+                    LOOP3_ASSERT(mode, n, i, values[i] == decoded[i]);
+                }
+                LOOP2_ASSERT(mode, n, 99 == decoded[n]);
+
+                if (n < 40) {
+                    for (bsl::size_t len = 0; len < length; ++len) {
+                        LOOP3_ASSERT(mode, n, len,
+                                     0 != Util::getArrayVarUint64(
+                                                                &decoded[0],
+                                                                &consumed,
+                                                                &encoded[0],
+                                                                len,
+                                                                n));
+                    }
+                }
+
+                if (0 < n) {
+                    // Set the continuation bit of the terminal byte of the
+                    // last value; the value then runs into the trailer and
+                    // (after 10 bytes) becomes invalid.
+
+                    encoded[length - 1] = static_cast<char>(
+                                                   encoded[length - 1] | 0x80);
+                    bsl::memset(&encoded[length], 0x80, k_TRAILER);
+                    LOOP2_ASSERT(mode, n, 0 != Util::getArrayVarUint64(
+                                                         &decoded[0],
+                                                         &consumed,
+                                                         &encoded[0],
+                                                         length + k_TRAILER,
+                                                         n));
+                }
+
+                // Signed values.
+
+                bsl::size_t expSignedLength = 0;
+                for (int i = 0; i < n; ++i) {
+                    expSignedLength += Util::putVarInt64(
+                                               &expected[expSignedLength],
+                                               signedValues[i]);
+                }
+
+                const bsl::size_t signedLength = Util::putArrayVarInt64(
+                                                            &encoded[0],
+                                                            &signedValues[0],
+                                                            n);
+                LOOP2_ASSERT(mode, n, expSignedLength == signedLength);
+                LOOP2_ASSERT(mode, n, 0 == bsl::memcmp(&expected[0],
+                                                       &encoded[0],
+                                                       signedLength));
+
+                bsl::vector<Int64> signedDecoded(n + 1, 99);
+
+                LOOP2_ASSERT(mode, n, 0 == Util::getArrayVarInt64(
+                                                         &signedDecoded[0],
+                                                         &consumed,
+                                                         &encoded[0],
+                                                         signedLength,
+                                                         n));
+                LOOP2_ASSERT(mode, n, signedLength == consumed);
+                for (int i = 0; i < n; ++i) {
+                    LOOP3_ASSERT(mode, n, i,
+                                 signedValues[i] == signedDecoded[i]);
+                }
+                LOOP2_ASSERT(mode, n, 99 == signedDecoded[n]);
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char        buffer[k_MAX] = { 0 };
+            Uint64      values[1] = { 0 };
+            Int64       signedValues[1] = { 0 };
+            bsl::size_t consumed;
+
+            ASSERT_PASS(Util::putArrayVarUint64(buffer, values, 1));
+            ASSERT_PASS(Util::putArrayVarUint64(buffer, 0, 0));
+            ASSERT_FAIL(Util::putArrayVarUint64(0, values, 1));
+            ASSERT_FAIL(Util::putArrayVarUint64(buffer, 0, 1));
+            ASSERT_FAIL(Util::putArrayVarUint64(buffer, values, -1));
+
+            ASSERT_PASS(Util::putArrayVarInt64(buffer, signedValues, 1));
+            ASSERT_FAIL(Util::putArrayVarInt64(0, signedValues, 1));
+            ASSERT_FAIL(Util::putArrayVarInt64(buffer, 0, 1));
+            ASSERT_FAIL(Util::putArrayVarInt64(buffer, signedValues, -1));
+
+            ASSERT_PASS(Util::getArrayVarUint64(values,
+                                                &consumed,
+                                                buffer,
+                                                1,
+                                                1));
+            ASSERT_PASS(Util::getArrayVarUint64(0, &consumed, 0, 0, 0));
+            ASSERT_FAIL(Util::getArrayVarUint64(0, &consumed, buffer, 1, 1));
+            ASSERT_FAIL(Util::getArrayVarUint64(values, 0, buffer, 1, 1));
+            ASSERT_FAIL(Util::getArrayVarUint64(values, &consumed, 0, 1, 1));
+            ASSERT_FAIL(Util::getArrayVarUint64(values,
+                                                &consumed,
+                                                buffer,
+                                                1,
+                                                -1));
+
+            ASSERT_PASS(Util::getArrayVarInt64(signedValues,
+                                               &consumed,
+                                               buffer,
+                                               1,
+                                               1));
+            ASSERT_FAIL(Util::getArrayVarInt64(0, &consumed, buffer, 1, 1));
+            ASSERT_FAIL(Util::getArrayVarInt64(signedValues,
+                                               0,
+                                               buffer,
+                                               1,
+                                               1));
+            ASSERT_FAIL(Util::getArrayVarInt64(signedValues,
+                                               &consumed,
+                                               0,
+                                               1,
+                                               1));
+            ASSERT_FAIL(Util::getArrayVarInt64(signedValues,
+                                               &consumed,
+                                               buffer,
+                                               1,
+                                               -1));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SCALAR GET FUNCTIONS
+        //   Ensure scalar values are decoded correctly, and malformed input
+        //   is rejected.
+        //
+        // Concerns:
+        //: 1 Every encoding produced by the put functions is decoded to the
+        //:   original value, consuming exactly the bytes of the encoding, even
+        //:   if the buffer holds further bytes.
+        //:
+        //: 2 Non-minimal encodings of at most 10 bytes are accepted.
+        //:
+        //: 3 Encodings that are truncated, longer than 10 bytes, or that
+        //:   represent a value of more than 64 bits are rejected, and leave
+        //:   the variable unmodified.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, decode a set of hand-crafted
+        //:   byte sequences, both valid and invalid, and verify the result
+        //:   and the value loaded.  (C-2..3)
+        //:
+        //: 2 Decode the encodings of values on either side of each length
+        //:   boundary, and of random values, with and without trailing bytes,
+        //:   and every proper prefix of each encoding.  (C-1, 3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   int getVarUint64(Uint64 *var, const char *buffer, size_t num);
+        //   int getVarInt64(Int64 *var, const char *buffer, size_t num);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SCALAR GET FUNCTIONS" << endl
+                          << "====================" << endl;
+
+        if (verbose) cout << "\nHand-crafted sequences." << endl;
+        {
+            static const struct {
+                int         d_line;     // source line number
+                const char *d_bytes;    // input bytes
+                int         d_length;   // number of input bytes
+                int         d_result;   // expected return value
+                Uint64      d_value;    // expected value (if successful)
+            } DATA[] = {
+                //LINE  BYTES                          LEN  RES  VALUE
+                //----  -----------------------------  ---  ---  -----
+                { L_,   "",                              0,   0,  0        },
+                { L_,   "\x00",                          1,   1,  0        },
+                { L_,   "\x7f\xff",                      2,   1,  127      },
+                { L_,   "\x80",                          1,   0,  0        },
+                { L_,   "\x80\x01",                      2,   2,  128      },
+                { L_,   "\x80\x00",                      2,   2,  0        },
+                { L_,   "\xff\xff\x03",                  3,   3,  65535    },
+                { L_,   "\xff\xff",                      2,   0,  0        },
+
+                // non-minimal, 10 bytes
+
+                { L_,   "\x81\x80\x80\x80\x80\x80\x80\x80\x80\x00",
+                                                        10,  10,  1        },
+
+                // 2^64 - 1
+
+                { L_,   "\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01",
+                                                        10,  10,  k_UINT64_MAX
+                                                                           },
+
+                // 65 bits
+
+                { L_,   "\xff\xff\xff\xff\xff\xff\xff\xff\xff\x02",
+                                                        10,   0,  0        },
+
+                // 11 bytes
+
+                { L_,   "\x80\x80\x80\x80\x80\x80\x80\x80\x80\x80\x00",
+                                                        11,   0,  0        },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int     LINE   = DATA[ti].d_line;
+                const char   *BYTES  = DATA[ti].d_bytes;
+                const int     LENGTH = DATA[ti].d_length;
+                const int     RESULT = DATA[ti].d_result;
+                const Uint64  VALUE  = DATA[ti].d_value;
+
+                Uint64 mX = 12345;
+                LOOP_ASSERT(LINE,
+                            RESULT == Util::getVarUint64(&mX, BYTES, LENGTH));
+                LOOP_ASSERT(LINE, (RESULT ? VALUE : 12345) == mX);
+
+                Int64 mY = 12345;
+                LOOP_ASSERT(LINE,
+                            RESULT == Util::getVarInt64(&mY, BYTES, LENGTH));
+                LOOP_ASSERT(LINE, (RESULT ? Util::zigZagDecode(VALUE)
+                                          : 12345) == mY);
+            }
+        }
+
+        if (verbose) cout << "\nRound trip." << endl;
+        {
+            Uint64 state = 1;
+
+            for (int i = 0; i < 2000; ++i) {
+                Uint64 value;
+                if (i < 64 * 3) {
+                    // Values on either side of each power of two.
+
+                    value = (1ULL << (i / 3)) - 1 + i % 3;
+                }
+                else {
+                    value = randomValue(&state, 64);
+                }
+
+                char buffer[k_MAX + 4];
+                bsl::memset(buffer, 0x01, sizeof buffer);
+
+                const int length = Util::putVarUint64(buffer, value);
+
+                Uint64 mX = 0;
+                LOOP_ASSERT(i, length == Util::getVarUint64(&mX,
+                                                            buffer,
+                                                            sizeof buffer));
+                LOOP_ASSERT(i, value == mX);
+
+                LOOP_ASSERT(i, length == Util::getVarUint64(&mX,
+                                                            buffer,
+                                                            length));
+
+                for (int len = 0; len < length; ++len) {
+                    LOOP2_ASSERT(i, len,
+                                 0 == Util::getVarUint64(&mX, buffer, len));
+                }
+
+                const Int64 signedValue = static_cast<Int64>(value);
+                const int   signedLength = Util::putVarInt64(buffer,
+                                                             signedValue);
+
+                Int64 mY = 0;
+                LOOP_ASSERT(i, signedLength == Util::getVarInt64(
+                                                               &mY,
+                                                               buffer,
+                                                               sizeof buffer));
+                LOOP_ASSERT(i, signedValue == mY);
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char   buffer[k_MAX] = { 0 };
+            Uint64 mX;
+            Int64  mY;
+
+            ASSERT_SAFE_PASS(Util::getVarUint64(&mX, buffer, 1));
+            ASSERT_SAFE_PASS(Util::getVarUint64(&mX, 0, 0));
+            ASSERT_SAFE_FAIL(Util::getVarUint64(0, buffer, 1));
+            ASSERT_SAFE_FAIL(Util::getVarUint64(&mX, 0, 1));
+
+            ASSERT_SAFE_PASS(Util::getVarInt64(&mY, buffer, 1));
+            ASSERT_SAFE_FAIL(Util::getVarInt64(0, buffer, 1));
+            ASSERT_SAFE_FAIL(Util::getVarInt64(&mY, 0, 1));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // SCALAR PUT FUNCTIONS
+        //   Ensure scalar values are encoded correctly.
+        //
+        // Concerns:
+        //: 1 Each value is encoded in the LEB128 format, least-significant
+        //:   group first, using the minimal number of bytes.
+        //:
+        //: 2 The returned length is that of the encoding, and no byte beyond
+        //:   it is modified.
+        //:
+        //: 3 Signed values are zig-zag encoded before being written.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, encode a set of values,
+        //:   including values on either side of each length boundary, and
+        //:   compare with hand-computed encodings.  (C-1..2)
+        //:
+        //: 2 Encode a set of signed values, and compare with the encodings of
+        //:   their hand-computed zig-zag encodings.  (C-3)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   int putVarUint64(char *buffer, Uint64 value);
+        //   int putVarInt64(char *buffer, Int64 value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SCALAR PUT FUNCTIONS" << endl
+                          << "====================" << endl;
+
+        if (verbose) cout << "\nUnsigned values." << endl;
+        {
+            static const struct {
+                int         d_line;     // source line number
+                Uint64      d_value;    // value to encode
+                const char *d_bytes;    // expected encoding
+                int         d_length;   // expected length
+            } DATA[] = {
+                //LINE  VALUE                  BYTES                     LEN
+                //----  -----                  -----                     ---
+                { L_,   0,                     "\x00",                    1 },
+                { L_,   1,                     "\x01",                    1 },
+                { L_,   127,                   "\x7f",                    1 },
+                { L_,   128,                   "\x80\x01",                2 },
+                { L_,   300,                   "\xac\x02",                2 },
+                { L_,   16383,                 "\xff\x7f",                2 },
+                { L_,   16384,                 "\x80\x80\x01",            3 },
+                { L_,   0xffffffffULL,         "\xff\xff\xff\xff\x0f",    5 },
+                { L_,   0x100000000ULL,        "\x80\x80\x80\x80\x10",    5 },
+                { L_,   0x7fffffffffffffffULL,
+                         "\xff\xff\xff\xff\xff\xff\xff\xff\x7f",          9 },
+                { L_,   0x8000000000000000ULL,
+                         "\x80\x80\x80\x80\x80\x80\x80\x80\x80\x01",     10 },
+                { L_,   k_UINT64_MAX,
+                         "\xff\xff\xff\xff\xff\xff\xff\xff\xff\x01",     10 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int     LINE   = DATA[ti].d_line;
+                const Uint64  VALUE  = DATA[ti].d_value;
+                const char   *BYTES  = DATA[ti].d_bytes;
+                const int     LENGTH = DATA[ti].d_length;
+
+                char buffer[k_MAX + 1];
+                bsl::memset(buffer, 0x55, sizeof buffer);
+
+                LOOP_ASSERT(LINE, LENGTH == Util::putVarUint64(buffer, VALUE));
+                LOOP_ASSERT(LINE, 0 == bsl::memcmp(buffer, BYTES, LENGTH));
+                LOOP_ASSERT(LINE, 0x55 == buffer[LENGTH]);
+            }
+        }
+
+        if (verbose) cout << "\nSigned values." << endl;
+        {
+            static const struct {
+                int    d_line;     // source line number
+                Int64  d_value;    // value to encode
+                Uint64 d_zigZag;   // expected zig-zag encoding
+            } DATA[] = {
+                //LINE  VALUE         ZIGZAG
+                //----  -----         ------
+                { L_,    0,           0                      },
+                { L_,   -1,           1                      },
+                { L_,    1,           2                      },
+                { L_,   -64,          127                    },
+                { L_,    64,          128                    },
+                { L_,   k_INT64_MAX,  0xfffffffffffffffeULL  },
+                { L_,   k_INT64_MIN,  k_UINT64_MAX           },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int    LINE   = DATA[ti].d_line;
+                const Int64  VALUE  = DATA[ti].d_value;
+                const Uint64 ZIGZAG = DATA[ti].d_zigZag;
+
+                char expected[k_MAX];
+                char buffer[k_MAX];
+
+                const int expLength = Util::putVarUint64(expected, ZIGZAG);
+                const int length    = Util::putVarInt64(buffer, VALUE);
+
+                LOOP_ASSERT(LINE, expLength == length);
+                LOOP_ASSERT(LINE, 0 == bsl::memcmp(buffer, expected, length));
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char buffer[k_MAX];
+
+            ASSERT_SAFE_PASS(Util::putVarUint64(buffer, 0));
+            ASSERT_SAFE_FAIL(Util::putVarUint64(0, 0));
+
+            ASSERT_SAFE_PASS(Util::putVarInt64(buffer, 0));
+            ASSERT_SAFE_FAIL(Util::putVarInt64(0, 0));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'encodedLength' AND ZIG-ZAG ENCODING
+        //   Ensure the helper functions compute correct results.
+        //
+        // Concerns:
+        //: 1 'encodedLength' returns the number of 7-bit groups needed to
+        //:   represent the value (and 1 for 0).
+        //:
+        //: 2 'zigZagEncode' maps 0, -1, 1, -2, 2, ... to 0, 1, 2, 3, 4, ...,
+        //:   including at the extremes of the range.
+        //:
+        //: 3 'zigZagDecode' is the inverse of 'zigZagEncode'.
+        //
+        // Plan:
+        //: 1 Verify 'encodedLength' for values on either side of each power
+        //:   of two, against a length computed from the bit width.  (C-1)
+        //:
+        //: 2 Verify 'zigZagEncode' for a range of small values and at the
+        //:   extremes, and that 'zigZagDecode' inverts it for those and for
+        //:   random values.  (C-2..3)
+        //
+        // Testing:
+        //   int encodedLength(Uint64 value);
+        //   Uint64 zigZagEncode(Int64 value);
+        //   Int64 zigZagDecode(Uint64 value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'encodedLength' AND ZIG-ZAG ENCODING" << endl
+                          << "====================================" << endl;
+
+        ASSERT(1 == Util::encodedLength(0));
+        for (int bits = 1; bits <= 64; ++bits) {
+            const Uint64 low  = 1ULL << (bits - 1);
+            const Uint64 high = bits < 64 ? (1ULL << bits) - 1 : k_UINT64_MAX;
+            const int    exp  = (bits + 6) / 7;
+
+            LOOP_ASSERT(bits, exp == Util::encodedLength(low));
+            LOOP_ASSERT(bits, exp == Util::encodedLength(high));
+
+            char buffer[k_MAX];
+            LOOP_ASSERT(bits, exp == Util::putVarUint64(buffer, high));
+        }
+
+        for (Int64 i = -1000; i <= 1000; ++i) {
+            const Uint64 exp = i < 0 ? static_cast<Uint64>(-i) * 2 - 1
+                                     : static_cast<Uint64>(i) * 2;
+            LOOP_ASSERT(i, exp == Util::zigZagEncode(i));
+            LOOP_ASSERT(i, i == Util::zigZagDecode(exp));
+        }
+
+        ASSERT(k_UINT64_MAX == Util::zigZagEncode(k_INT64_MIN));
+        ASSERT(k_UINT64_MAX - 1 == Util::zigZagEncode(k_INT64_MAX));
+        ASSERT(k_INT64_MIN == Util::zigZagDecode(k_UINT64_MAX));
+        ASSERT(k_INT64_MAX == Util::zigZagDecode(k_UINT64_MAX - 1));
+
+        Uint64 state = 7;
+        for (int i = 0; i < 1000; ++i) {
+            const Int64 value = static_cast<Int64>(nextRandom(&state));
+            const Uint64 encoded = Util::zigZagEncode(value);
+            LOOP_ASSERT(i, value == Util::zigZagDecode(encoded));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Round-trip a few scalar values and an array.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        char buffer[4 * k_MAX];
+
+        ASSERT(1 == Util::putVarUint64(buffer, 5));
+        ASSERT(5 == buffer[0]);
+
+        Uint64 mX = 0;
+        ASSERT(1 == Util::getVarUint64(&mX, buffer, 1));
+        ASSERT(5 == mX);
+
+        ASSERT(2 == Util::putVarInt64(buffer, -100));
+        Int64 mY = 0;
+        ASSERT(2 == Util::getVarInt64(&mY, buffer, 2));
+        ASSERT(-100 == mY);
+
+        const Uint64 VALUES[] = { 1, 1000, 1000000 };
+        ASSERT(6 == Util::putArrayVarUint64(buffer, VALUES, 3));
+
+        Uint64      decoded[3];
+        bsl::size_t consumed = 0;
+        ASSERT(0 == Util::getArrayVarUint64(decoded,
+                                            &consumed,
+                                            buffer,
+                                            sizeof buffer,
+                                            3));
+        ASSERT(6 == consumed);
+        ASSERT(1       == decoded[0]);
+        ASSERT(1000    == decoded[1]);
+        ASSERT(1000000 == decoded[2]);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Compare the throughput of the array functions with that of the
+        //   fixed-width 'bslx::MarshallingUtil' array functions and 'memcpy'.
+        //
+        // Concerns:
+        //: 1 Decoding arrays of small values runs at a small multiple of the
+        //:   cost of copying them.
+        //
+        // Plan:
+        //: 1 Time the encoding and decoding of arrays whose values are
+        //:   (a) all less than 128, (b) 90% less than 128, and (c) random
+        //:   32-bit values, and compare with 'MarshallingUtil' and 'memcpy'.
+        //:   The optional second argument specifies the number of
+        //:   iterations.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST" << endl
+             << "================" << endl;
+
+        const int k_LENGTH     = 1 << 16;
+        const int k_ITERATIONS = argc > 2 ? atoi(argv[2]) : 1000;
+
+        bsl::vector<Uint64> values(k_LENGTH);
+        bsl::vector<Uint64> decoded(k_LENGTH);
+        bsl::vector<char>   buffer(k_LENGTH * k_MAX);
+
+        for (int mode = 0; mode < 3; ++mode) {
+            Uint64 state = 1;
+            for (int i = 0; i < k_LENGTH; ++i) {
+                const Uint64 r = nextRandom(&state) >> 32;
+                values[i] = 0 == mode ? r % 128
+                          : 1 == mode ? (r % 10 ? r % 128 : r)
+                          :             r;
+            }
+
+            bsls::Stopwatch timer;
+            bsl::size_t     length = 0;
+            bsl::size_t     consumed = 0;
+
+            timer.start();
+            for (int it = 0; it < k_ITERATIONS; ++it) {
+                length = Util::putArrayVarUint64(&buffer[0],
+                                                 &values[0],
+                                                 k_LENGTH);
+            }
+            timer.stop();
+            const double encodeTime = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int it = 0; it < k_ITERATIONS; ++it) {
+                Util::getArrayVarUint64(&decoded[0],
+                                        &consumed,
+                                        &buffer[0],
+                                        length,
+                                        k_LENGTH);
+            }
+            timer.stop();
+            const double decodeTime = timer.elapsedTime();
+
+            ASSERT(values == decoded);
+
+            timer.reset();
+            timer.start();
+            for (int it = 0; it < k_ITERATIONS; ++it) {
+                MarshallingUtil::putArrayInt64(&buffer[0],
+                                               &values[0],
+                                               k_LENGTH);
+            }
+            timer.stop();
+            const double fixedEncodeTime = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int it = 0; it < k_ITERATIONS; ++it) {
+                MarshallingUtil::getArrayUint64(&decoded[0],
+                                                &buffer[0],
+                                                k_LENGTH);
+            }
+            timer.stop();
+            const double fixedDecodeTime = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int it = 0; it < k_ITERATIONS; ++it) {
+                bsl::memcpy(&decoded[0],
+                            &values[0],
+                            k_LENGTH * sizeof(Uint64));
+            }
+            timer.stop();
+            const double copyTime = timer.elapsedTime();
+
+            cout << (0 == mode ? "small values"
+                   : 1 == mode ? "90% small values"
+                   :             "random 32-bit values")
+                 << ": " << length << " bytes (fixed width: "
+                 << k_LENGTH * 8 << ")" << endl
+                 << "\tvarint encode/decode:      " << encodeTime
+                 << "s / " << decodeTime << "s" << endl
+                 << "\tfixed-width encode/decode: " << fixedEncodeTime
+                 << "s / " << fixedDecodeTime << "s" << endl
+                 << "\tmemcpy:                    " << copyTime << "s"
+                 << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2014 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------